@@ -0,0 +1,591 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "batch.h"
+#include "codec.h"
+#include "const.h"
+#include "counters.h"
+#include "gaussianLib.h"
+#include "init.h"
+#include "kern.h"
+#include "master.h"
+#include "mosaic.h"
+#include "mpi.h"
+#include "pipeline.h"
+#include "progress.h"
+#include "qdbmp.h"
+#include "timeline.h"
+#include "timing.h"
+#include "tune.h"
+
+/* Image loaded by the master, ahead of being sent */
+struct batch_image {
+  BMP *src;
+  UINT width, height;
+  USHORT depth;
+};
+
+/* Whole image in flight on a single slave */
+struct batch_slot {
+  int busy;
+  int job;
+  BMP *src;
+  int f_out;
+  USHORT depth;
+  int stdev;
+  int edge;
+  struct mosaic_tile tile;
+  UCHAR *wire;                        /* Encoded image (NULL if none) */
+  UCHAR *result;                      /* Blurred image (raw or encoded) */
+  MPI_Request send_reqs[PAYLOAD_COUNT];
+};
+
+/* parse_job
+ * ------
+ * Parse a job from a line of the form "<input> <output> <stdev> [mode]
+ * [edge]", where mode is one of "auto" (the default), "whole" or "tiled"
+ * and edge an edge mode as for --edge, in either order
+ *
+ * line:    line to parse (modified)
+ * opts:    job configuration (edge mode of a job that gives none and the
+ *          pyramid tolerance)
+ * job:     parsed job (out, with an empty input for a blank or comment line)
+ *
+ * returns: success or failure
+ *
+ */
+int parse_job(char *line, JOB_OPTS *opts, struct batch_job *job) {
+
+  char *in, *out, *sd, *word, *end;
+  int i;
+
+  job->fn_in[0] = '\0';
+  in = strtok(line, " \t\r\n");
+  if (in == NULL || in[0] == '#') return EXIT_SUCCESS;
+  out = strtok(NULL, " \t\r\n");
+  sd = strtok(NULL, " \t\r\n");
+  if (out == NULL || sd == NULL) {
+    fprintf(stderr, EM_BATCH_JOB);
+    return EXIT_FAILURE;
+  }
+  if (strlen(in) >= MAX_PATH || strlen(out) >= MAX_PATH) {
+    fprintf(stderr, EM_MAX_PATH, MAX_PATH);
+    return EXIT_FAILURE;
+  }
+  job->stdev = strtol(sd, &end, 10);
+  if (*end != '\0') {
+    fprintf(stderr, EM_BATCH_JOB);
+    return EXIT_FAILURE;
+  }
+  if (check_stdev(job->stdev, opts->pyramid) != EXIT_SUCCESS) {
+    return EXIT_FAILURE;
+  }
+
+  /* Each of the mode and the edge mode at most once, in either order */
+  job->mode = -1;
+  job->edge = -1;
+  for (i = 0; (word = strtok(NULL, " \t\r\n")) != NULL; i++) {
+    if (i == 2) {
+      fprintf(stderr, EM_BATCH_JOB);
+      return EXIT_FAILURE;
+    }
+    if (job->mode < 0 && strcmp(word, "auto") == 0) {
+      job->mode = BATCH_AUTO;
+    } else if (job->mode < 0 && strcmp(word, "whole") == 0) {
+      job->mode = BATCH_WHOLE;
+    } else if (job->mode < 0 && strcmp(word, "tiled") == 0) {
+      job->mode = BATCH_TILED;
+    } else if (job->edge < 0 && parse_edge(word) >= 0) {
+      job->edge = parse_edge(word);
+    } else {
+      fprintf(stderr, EM_BATCH_MODE, word);
+      return EXIT_FAILURE;
+    }
+  }
+  if (job->mode < 0) job->mode = BATCH_AUTO;
+  if (job->edge < 0) job->edge = opts->edge;
+
+  strcpy(job->fn_in, in);
+  strcpy(job->fn_out, out);
+
+  return EXIT_SUCCESS;
+
+}
+
+/* read_manifest
+ * ------
+ * Read every job from a manifest file
+ *
+ * fn:      manifest filename
+ * opts:    job configuration
+ * jobs:    array of jobs (out, to be freed by the caller)
+ * njob:    number of jobs (out)
+ *
+ * returns: success or failure
+ *
+ */
+static int read_manifest(char *fn, JOB_OPTS *opts, struct batch_job **jobs,
+  int *njob) {
+
+  FILE *f;
+  char line[BATCH_LINE_LEN];
+  struct batch_job job, *grown;
+  int n, cap, lineno;
+
+  *jobs = NULL;
+  *njob = 0;
+
+  if ((f = fopen(fn, "r")) == NULL) {
+    fprintf(stderr, EM_BATCH_MANIFEST, strerror(errno));
+    return EXIT_FAILURE;
+  }
+
+  n = 0;
+  cap = 0;
+  lineno = 0;
+  while (fgets(line, sizeof(line), f) != NULL) {
+    ++lineno;
+
+    if (parse_job(line, opts, &job) != EXIT_SUCCESS) {
+      fprintf(stderr, EM_BATCH_LINE, lineno);
+      goto fail;
+    }
+    if (job.fn_in[0] == '\0') continue;
+
+    if (n == cap) {
+      cap = cap ? cap * 2 : 16;
+      grown = realloc(*jobs, cap * sizeof(struct batch_job));
+      if (grown == NULL) {
+        fprintf(stderr, EM_OUT_OF_MEMORY, OOM_TYPE_MANIFEST);
+        goto fail;
+      }
+      *jobs = grown;
+    }
+    (*jobs)[n++] = job;
+  }
+  fclose(f);
+
+  if (n == 0) {
+    fprintf(stderr, EM_BATCH_EMPTY);
+    free(*jobs);
+    *jobs = NULL;
+    return EXIT_FAILURE;
+  }
+  *njob = n;
+
+  return EXIT_SUCCESS;
+
+fail:
+  fclose(f);
+  free(*jobs);
+  *jobs = NULL;
+  return EXIT_FAILURE;
+
+}
+
+/* load_image
+ * ------
+ * Read the next image of the batch that can be read, skipping (and
+ * counting) any that cannot
+ *
+ * jobs:    all jobs
+ * njob:    number of jobs
+ * next:    index of the next job to read (updated to the job loaded)
+ * img:     loaded image (out, src is NULL once the batch is exhausted)
+ * stats:   running totals
+ *
+ */
+static void load_image(struct batch_job *jobs, int njob, int *next,
+  struct batch_image *img, struct batch_stats *stats) {
+
+  img->src = NULL;
+  for (; *next < njob; ++*next) {
+    if (init_bmp(jobs[*next].fn_in, &img->src, &img->width, &img->height,
+          &img->depth) == EXIT_SUCCESS) {
+      return;
+    }
+    img->src = NULL;
+    fprintf(stderr, EM_BATCH_IMAGE, jobs[*next].fn_in);
+    ++stats->failed;
+  }
+
+}
+
+/* finish_slot
+ * ------
+ * Write out the image returned by a slave and free the slot
+ *
+ * slot:    slot of the slave
+ * status:  status of the completed receive
+ * codec:   transport codec the slave encoded the result with
+ * jobs:    all jobs
+ * stats:   running totals
+ *
+ */
+static void finish_slot(struct batch_slot *slot, MPI_Status *status,
+  int codec, struct batch_job *jobs, struct batch_stats *stats) {
+
+  UCHAR *data;
+  UINT calls;
+  int count, e;
+  double t, c[COUNTER_COUNT];
+
+  /* The slave has replied, so the image is no longer being sent */
+  MPI_Waitall(PAYLOAD_COUNT, slot->send_reqs, MPI_STATUSES_IGNORE);
+  progress_finish(slot->tile.id);
+
+  e = EXIT_SUCCESS;
+  data = BMP_GetData(slot->src);
+  TIMING_START(t);
+  COUNTERS_START(c);
+  if (codec == CODEC_NONE) {
+    BMP_SetData(slot->src, slot->result);
+  } else {
+    MPI_Get_count(status, MPI_UNSIGNED_CHAR, &count);
+    e = codec_decode(slot->result, count, slot->tile.w, slot->tile.h,
+      slot->depth, data);
+  }
+  COUNTERS_STOP(PHASE_REMAP, c, (double) slot->tile.w * slot->tile.h,
+    slot->tile.size);
+  TIMING_STOP(PHASE_REMAP, t, slot->tile.size);
+  calls = BMP_GetWriteCalls();
+  if (e == EXIT_SUCCESS) {
+    TIMING_START(t);
+    BMP_WriteFile(slot->src, slot->f_out);
+    TIMING_STOP(PHASE_WRITE, t, slot->tile.size);
+    if (BMP_CheckError(stderr) != BMP_OK) e = EXIT_FAILURE;
+  }
+  calls = BMP_GetWriteCalls() - calls;
+  if (close(slot->f_out) < 0) {
+    fprintf(stderr, EM_IO_CLOSE, strerror(errno));
+    e = EXIT_FAILURE;
+  }
+
+  if (e == EXIT_SUCCESS) {
+    ++stats->done;
+    stats->bytes += slot->tile.size;
+  } else {
+    fprintf(stderr, EM_BATCH_IMAGE, jobs[slot->job].fn_out);
+    ++stats->failed;
+  }
+#ifdef TRACE
+  fprintf(stderr, "rank id %d finished %s in %lu write calls\n",
+    slot->tile.id, jobs[slot->job].fn_out, calls);
+#endif
+
+  BMP_Free(slot->src);
+  free(slot->wire);
+  free(slot->result);
+  slot->busy = 0;
+
+}
+
+/* poll_slots
+ * ------
+ * Wait for busy slaves to return their images, until either a slave is idle
+ * (if all is zero) or every slave is idle
+ *
+ * slots:       slot per slave
+ * recv_reqs:   result receipt per slave (MPI_REQUEST_NULL when idle)
+ * nslave:      number of slaves
+ * all:         wait for every slave rather than any
+ * codec:       transport codec
+ * jobs:        all jobs
+ * stats:       running totals
+ *
+ * returns: index of an idle slot, or -1 if a slave fell behind the deadline
+ *          its heartbeats set (see progress.h)
+ *
+ */
+static int poll_slots(struct batch_slot *slots, MPI_Request *recv_reqs,
+  int nslave, int all, int codec, struct batch_job *jobs,
+  struct batch_stats *stats) {
+
+  MPI_Status status;
+  int i, idle, busy, flag, index, late;
+
+  while (1) {
+
+    /* Collect every result that has arrived */
+    do {
+      MPI_Testany(nslave, recv_reqs, &index, &flag, &status);
+      if (flag && index != MPI_UNDEFINED) {
+        TIMELINE_MARK(PHASE_RECV, index + 1);
+        finish_slot(&slots[index], &status, codec, jobs, stats);
+      }
+    } while (flag && index != MPI_UNDEFINED);
+
+    if ((late = progress_poll()) > 0) {
+      fprintf(stderr, EM_BATCH_TIMEOUT, late,
+        jobs[slots[late - 1].job].fn_in);
+      return -1;
+    }
+
+    for (idle = -1, busy = 0, i = 0; i < nslave; i++) {
+      if (!slots[i].busy) {
+        if (idle < 0) idle = i;
+        continue;
+      }
+      ++busy;
+    }
+    if (all ? busy == 0 : idle >= 0) return idle;
+
+    usleep(BATCH_POLL_U);
+  }
+
+}
+
+/* send_whole
+ * ------
+ * Send an entire image to a single slave and post the receipt of the result
+ *
+ * slot:        slot of the slave (idle)
+ * rank:        rank of the slave
+ * recv_req:    result receipt of the slave (out)
+ * img:         image to send (ownership passes to the slot)
+ * job:         index of the job
+ * jobs:        all jobs
+ * codec:       transport codec
+ * direct:      write the output with O_DIRECT
+ *
+ * returns: success or failure
+ *
+ */
+static int send_whole(struct batch_slot *slot, int rank,
+  MPI_Request *recv_req, struct batch_image *img, int job,
+  struct batch_job *jobs, int codec, int direct) {
+
+  MPI_Datatype type;
+  UINT buf_size;
+
+  if (init_out(jobs[job].fn_out, direct, &slot->f_out) != EXIT_SUCCESS) {
+    return EXIT_FAILURE;
+  }
+  if (whole_tile(&slot->tile, img->src, rank) != BMP_OK) {
+    close(slot->f_out);
+    return EXIT_FAILURE;
+  }
+
+  buf_size = codec == CODEC_NONE ? BMP_GetAllocSize(img->src)
+    : codec_bound(slot->tile.size);
+  slot->result = malloc(buf_size);
+  if (slot->result == NULL) {
+    fprintf(stderr, EM_OUT_OF_MEMORY, OOM_TYPE_RECEIPT_ARRAY);
+    close(slot->f_out);
+    return EXIT_FAILURE;
+  }
+
+  slot->job = job;
+  slot->src = img->src;
+  slot->depth = img->depth;
+  slot->stdev = jobs[job].stdev;
+  slot->edge = jobs[job].edge;
+  if (post_tile(&slot->tile, &slot->depth, &slot->stdev, &slot->edge,
+        codec, slot->send_reqs, &slot->wire) != EXIT_SUCCESS) {
+    free(slot->result);
+    free(slot->wire);
+    close(slot->f_out);
+    return EXIT_FAILURE;
+  }
+  if (codec == CODEC_NONE) {
+    type = tile_type(slot->tile.size, slot->tile.w, slot->tile.h,
+      slot->depth);
+    MPI_Irecv(slot->result, 1, type, rank, MPI_DATA_TAG, MPI_COMM_WORLD,
+      recv_req);
+    MPI_Type_free(&type);
+  } else {
+    MPI_Irecv(slot->result, buf_size, MPI_UNSIGNED_CHAR, rank, MPI_DATA_TAG,
+      MPI_COMM_WORLD, recv_req);
+  }
+
+  slot->busy = 1;
+
+  return EXIT_SUCCESS;
+
+}
+
+/* run_batch
+ * ------
+ * Blur a list of images, returning once every one is written.  Slaves are
+ * left waiting for more work.
+ *
+ * nslave:      number of slaves
+ * jobs:        images to blur
+ * njob:        number of images
+ * opts:        job configuration
+ * stats:       running totals (updated)
+ *
+ * return: success, or failure if any image failed
+ *
+ */
+int run_batch(int nslave, struct batch_job *jobs, int njob, JOB_OPTS *opts,
+  struct batch_stats *stats) {
+
+  struct batch_slot slots[nslave];
+  struct batch_image img, next;
+  struct mosaic_tile *head;
+  MPI_Request recv_reqs[nslave];
+  int job, i, f_out, ntile, overlap, max_data_size, kern_size, align,
+    failed, whole, e;
+  UINT calls;
+  double t, c[COUNTER_COUNT];
+
+  failed = stats->failed;
+  memset(slots, 0, sizeof(slots));
+  for (i = 0; i < nslave; i++) recv_reqs[i] = MPI_REQUEST_NULL;
+
+  job = 0;
+  load_image(jobs, njob, &job, &next, stats);
+
+  while (next.src != NULL) {
+
+    img = next;
+    i = job++;
+
+    /* Small images go whole to the first idle slave, reading the next
+     * image while it works */
+    whole = jobs[i].mode == BATCH_WHOLE || nslave == 1 ||
+      (jobs[i].mode == BATCH_AUTO &&
+       img.width * img.height <= BATCH_SMALL_PIXELS);
+    if (whole) {
+      e = poll_slots(slots, recv_reqs, nslave, 0, opts->codec, jobs, stats);
+      if (e < 0) {
+        MPI_Abort(MPI_COMM_WORLD, MPI_ABORT_FAIL_CODE);
+        return EXIT_FAILURE;
+      }
+      if (send_whole(&slots[e], e + 1, &recv_reqs[e], &img, i, jobs,
+            opts->codec, opts->direct) != EXIT_SUCCESS) {
+        fprintf(stderr, EM_BATCH_IMAGE, jobs[i].fn_in);
+        ++stats->failed;
+        BMP_Free(img.src);
+      }
+      load_image(jobs, njob, &job, &next, stats);
+      continue;
+    }
+    /* Large images are tiled across every slave, once all are idle */
+    if (poll_slots(slots, recv_reqs, nslave, 1, opts->codec, jobs, stats)
+        < 0) {
+      MPI_Abort(MPI_COMM_WORLD, MPI_ABORT_FAIL_CODE);
+      return EXIT_FAILURE;
+    }
+    head = NULL;
+    e = init_extent(jobs[i].stdev, opts->pyramid, &kern_size, &align);
+    if (e == EXIT_SUCCESS) {
+      e = init_out(jobs[i].fn_out, opts->direct && !opts->threaded, &f_out);
+    }
+    if (e == EXIT_SUCCESS) {
+      TIMING_START(t);
+      COUNTERS_START(c);
+      head = create_tiles(img.src, nslave, kern_size, tune_decomp(opts,
+        img.width * img.height, jobs[i].stdev, nslave),
+        jobs[i].edge == EDGE_WRAP, align, NULL, &ntile, &overlap,
+        &max_data_size);
+      COUNTERS_STOP(PHASE_TILE, c, (double) img.width * img.height,
+        BMP_GetDataSize(img.src));
+      TIMING_STOP(PHASE_TILE, t, BMP_GetDataSize(img.src));
+      if (head == NULL) {
+        close(f_out);
+        e = EXIT_FAILURE;
+      } else if (progress_on) {
+        fprintf(stderr, "dividing %s into %d tiles for %d nodes\n",
+          jobs[i].fn_in, ntile, nslave);
+      }
+    }
+    if (e != EXIT_SUCCESS) {
+      fprintf(stderr, EM_BATCH_IMAGE, jobs[i].fn_in);
+      ++stats->failed;
+      BMP_Free(img.src);
+      load_image(jobs, njob, &job, &next, stats);
+      continue;
+    }
+
+    if (send_payload(ntile, head, img.depth, jobs[i].stdev, jobs[i].edge,
+          opts->codec) != EXIT_SUCCESS) {
+      MPI_Abort(MPI_COMM_WORLD, MPI_ABORT_FAIL_CODE);
+      return EXIT_FAILURE;
+    }
+    load_image(jobs, njob, &job, &next, stats);
+
+    calls = BMP_GetWriteCalls();
+    if (opts->threaded) {
+      e = pipe_results(ntile, img.src, img.depth, head, max_data_size,
+        opts->codec, f_out);
+    } else {
+      e = recv_results(ntile, img.src, img.depth, head, max_data_size,
+        opts->codec);
+      if (e == EXIT_SUCCESS) {
+        TIMING_START(t);
+        BMP_WriteFile(img.src, f_out);
+        TIMING_STOP(PHASE_WRITE, t, BMP_GetDataSize(img.src));
+        if (BMP_CheckError(stderr) != BMP_OK) e = EXIT_FAILURE;
+      }
+    }
+    if (close(f_out) < 0) {
+      fprintf(stderr, EM_IO_CLOSE, strerror(errno));
+      e = EXIT_FAILURE;
+    }
+#ifdef TRACE
+    fprintf(stderr, "tiled %s in %lu write calls\n", jobs[i].fn_out,
+      BMP_GetWriteCalls() - calls);
+#endif
+    if (e == EXIT_SUCCESS) {
+      ++stats->done;
+      stats->bytes += BMP_GetDataSize(img.src);
+    } else {
+      fprintf(stderr, EM_BATCH_IMAGE, jobs[i].fn_out);
+      ++stats->failed;
+    }
+    free_tiles(head);
+    BMP_Free(img.src);
+  }
+
+  /* Drain the images still in flight */
+  if (poll_slots(slots, recv_reqs, nslave, 1, opts->codec, jobs, stats)
+      < 0) {
+    MPI_Abort(MPI_COMM_WORLD, MPI_ABORT_FAIL_CODE);
+    return EXIT_FAILURE;
+  }
+
+  return stats->failed == failed ? EXIT_SUCCESS : EXIT_FAILURE;
+
+}
+
+/* do_batch
+ * ------
+ * Main entry point for the master node in batch mode
+ *
+ * nslave:      number of slaves
+ * opts:        job configuration
+ *
+ * return: success, or failure if any image failed
+ *
+ */
+int do_batch(int nslave, JOB_OPTS *opts) {
+
+  struct batch_job *jobs;
+  struct batch_stats stats;
+  int njob, e;
+  double start, elapsed;
+
+  if (read_manifest(opts->fn_manifest, opts, &jobs, &njob) != EXIT_SUCCESS) {
+    MPI_Abort(MPI_COMM_WORLD, MPI_ABORT_FAIL_CODE);
+    return EXIT_FAILURE;
+  }
+
+  start = MPI_Wtime();
+  memset(&stats, 0, sizeof(stats));
+  e = run_batch(nslave, jobs, njob, opts, &stats);
+  release_slaves(1, nslave);
+
+  elapsed = MPI_Wtime() - start;
+  fprintf(stderr, "batch: %d/%d images in %.3f s (%.2f images/s, "
+    "%.2f MB/s)\n", stats.done, njob, elapsed, stats.done / elapsed,
+    stats.bytes / elapsed / 1e6);
+
+  free(jobs);
+
+  return e;
+
+}
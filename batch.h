@@ -0,0 +1,69 @@
+#ifndef _BATCH_H_
+#define _BATCH_H_
+
+/*
+ * batch.h
+ * -------
+ * Processes a manifest of images in a single MPI job, so the cost of
+ * starting the job is paid once rather than per image.  Each manifest line
+ * holds an input file, an output file, a standard deviation and optionally
+ * a mode and an edge mode (see --edge), separated by white space; blank
+ * lines and lines starting with '#' are skipped.
+ *
+ * Small images are sent whole to the next idle slave, so several are in
+ * flight at once.  Large images are tiled across every slave as in a single
+ * image job.  Either way the master reads the next image while the slaves
+ * are computing the current one.  The mode of a job may force either path.
+ *
+ */
+
+#include "init.h"
+
+/* Modes */
+#define BATCH_AUTO          0   /* Whole if small, otherwise tiled */
+#define BATCH_WHOLE         1   /* Whole image on a single slave */
+#define BATCH_TILED         2   /* Tiled across every slave (see --decomp) */
+
+/* Constants */
+#define BATCH_SMALL_PIXELS  (1024 * 1024) /* Largest image sent whole */
+#define BATCH_LINE_LEN      (2 * MAX_PATH + 32) /* Longest manifest line */
+#define BATCH_POLL_U        1000          /* Sleep between polls of slaves */
+
+/* Error messages */
+#define EM_BATCH_MANIFEST   "Failed to read manifest: %s\n"
+#define EM_BATCH_JOB        "Expected <input> <output> <stdev> [mode] " \
+  "[edge]\n"
+#define EM_BATCH_LINE       "Rejected manifest line %d\n"
+#define EM_BATCH_MODE       "Unknown mode '%s'\n"
+#define EM_BATCH_EMPTY      "Manifest lists no images\n"
+#define EM_BATCH_IMAGE      "Skipping image %s\n"
+#define EM_BATCH_TIMEOUT    "Rank %d timed out processing %s\n"
+#define EM_BATCH_OPTION     "Calibration is not supported with --batch or " \
+                            "--serve\n"
+#define OOM_TYPE_MANIFEST   "manifest"
+
+/*
+ * Image to blur
+ */
+struct batch_job {
+  char fn_in[MAX_PATH];
+  char fn_out[MAX_PATH];
+  int stdev;
+  int mode;                     /* See BATCH_AUTO */
+  int edge;                     /* Edge mode (see EDGE_ZERO) */
+};
+
+/*
+ * Running totals across jobs
+ */
+struct batch_stats {
+  int done, failed;
+  double bytes;                 /* Pixel data blurred */
+};
+
+int parse_job(char *line, JOB_OPTS *opts, struct batch_job *job);
+int run_batch(int nslave, struct batch_job *jobs, int njob, JOB_OPTS *opts,
+  struct batch_stats *stats);
+int do_batch(int nslave, JOB_OPTS *opts);
+
+#endif /* _BATCH_H_ */
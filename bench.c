@@ -0,0 +1,415 @@
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "const.h"
+#include "gaussianLib.h"
+#include "kern.h"
+#include "qdbmp.h"
+
+/*
+ * BENCH
+ * ------
+ *
+ * Times the convolution engines on deterministic synthetic images, so that
+ * a change to an engine shows up as a change in throughput or accuracy.
+ * For every depth and standard deviation asked for, the reference path
+ * (applyConvolution, the original pixel by pixel blur) is run once and each
+ * engine timed against it, and one line is printed per engine:
+ *
+ *   depth, size, stdev, engine, taps per pixel, seconds per image,
+ *   megapixels per second, nanoseconds per pixel per tap and the largest
+ *   difference of any channel from the reference.
+ *
+ * Each engine is run repeatedly for at least BENCH_MIN_S and the mean
+ * taken.
+ *
+ * compilation:
+ *   make bench
+ *
+ * usage:
+ *   bench [-w width] [-h height] [-d depths] [-s stdevs] [-e engine]
+ *   bench [-w width] [-h height] [-d depths] -c
+ *   bench [-w width] [-h height] [-d depth] -g <output>
+ *
+ *   -w <pixels>     width of the synthetic image (default 256)
+ *   -h <pixels>     height of the synthetic image (default 256)
+ *   -d <depths>     comma separated bit depths, of 8, 24 and 32 (default
+ *                   all three)
+ *   -s <stdevs>     standard deviation or inclusive range, e.g. 5 or 1-20
+ *                   (default 1 to MAX_STDEV); values beyond MAX_STDEV are
+ *                   allowed here
+ *   -e <engine>     time only the named engine
+ *   -c              compare the FFT engine with the separable one at
+ *                   MAX_STDEV, skipping the reference, and fail unless the
+ *                   FFT engine is the faster (e.g. bench -w 512 -h 512 -c)
+ *   -g <file>       write the synthetic image (of the first depth) to file
+ *                   and exit, e.g. as input for gaussianmpi
+ *
+ * notes:
+ *   - The reference path is as slow as the direct engine, so the default
+ *     image is small; at stdev 20 the square kernel has 14641 taps.
+ */
+
+/* Constants */
+#define BENCH_WIDTH       256
+#define BENCH_HEIGHT      256
+#define BENCH_MIN_S       0.25    /* Minimum time to run each engine for */
+
+/* Error messages */
+#define EM_BENCH_USAGE    \
+  "usage: bench [-w width] [-h height] [-d depths] [-s stdevs] " \
+  "[-e engine]\n" \
+  "       bench [-w width] [-h height] [-d depths] -c\n" \
+  "       bench [-w width] [-h height] [-d depth] -g <output>\n"
+#define EM_BENCH_DEPTH    "Unsupported depth '%s' (8, 24 or 32)\n"
+#define EM_BENCH_ENGINE   "Unknown engine '%s'\n"
+#define EM_BENCH_OOM      "Out of memory for benchmark images\n"
+#define EM_BENCH_SLOWER   \
+  "The FFT engine is no faster than the separable one at depth %d, " \
+  "%lux%lu\n"
+
+/* now
+ * ------
+ * returns: seconds from an arbitrary point
+ *
+ */
+static double now(void) {
+
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+
+}
+
+/* max_error
+ * ------
+ * Largest difference of any channel between two images of the same shape
+ *
+ * a, b:    images to compare
+ *
+ * returns: the difference
+ *
+ */
+static int max_error(BMP *a, BMP *b) {
+
+  UCHAR *pa, *pb;
+  UINT y, i, row_len;
+  int d, e;
+
+  row_len = BMP_GetWidth(a) * (BMP_GetDepth(a) >> 3);
+  for (e = 0, y = 0; y < BMP_GetHeight(a); y++) {
+    pa = BMP_GetData(a) + (size_t) y * BMP_GetStride(a);
+    pb = BMP_GetData(b) + (size_t) y * BMP_GetStride(b);
+    for (i = 0; i < row_len; i++) {
+      d = abs(pa[i] - pb[i]);
+      if (d > e) e = d;
+    }
+  }
+
+  return e;
+
+}
+
+/* reference
+ * ------
+ * Blur an image by the reference path: applyConvolution with the square
+ * kernel, tap by tap
+ *
+ * stdev:   standard deviation
+ * src:     image to blur
+ * ref:     blurred image (out)
+ *
+ * returns: success, or failure if out of memory
+ *
+ */
+static int reference(int stdev, BMP *src, BMP *ref) {
+
+  float **data, kernel_max, colour_max;
+  int size, orig;
+
+  init_kern(stdev, &size, &orig);
+  if ((data = init_kern_data(size)) == NULL) return EXIT_FAILURE;
+  generateGaussianKernel(data, size, stdev, orig, &kernel_max, &colour_max);
+  applyConvolution(data, size, orig, colour_max, src, ref);
+  free_kern_data(data, size);
+
+  return EXIT_SUCCESS;
+
+}
+
+/* time_engine
+ * ------
+ * Run one engine repeatedly for at least BENCH_MIN_S
+ *
+ * engine:  engine to run
+ * kern:    kernel to blur with
+ * src:     image to blur
+ * out:     blurred image (out)
+ *
+ * returns: mean seconds per image, or a negative value on failure
+ *
+ */
+static double time_engine(int engine, KERNEL *kern, BMP *src, BMP *out) {
+
+  double start, elapsed, runs;
+
+  runs = 0;
+  start = now();
+  do {
+    if (convolveBMP(engine, kern, EDGE_ZERO, src, out) != EXIT_SUCCESS) {
+      return -1;
+    }
+    runs++;
+  } while ((elapsed = now() - start) < BENCH_MIN_S);
+
+  return elapsed / runs;
+
+}
+
+/* print_row
+ * ------
+ * Print the line of one engine (see the columns above)
+ *
+ * depth, width, height:  shape of the image
+ * kern:                  kernel blurred with
+ * engine:                engine timed
+ * elapsed:               seconds per image
+ * error:                 largest difference from the reference
+ *
+ */
+static void print_row(USHORT depth, UINT width, UINT height, KERNEL *kern,
+  int engine, double elapsed, int error) {
+
+  double pixels, taps;
+
+  /* The FFT engine is charged the taps of the separable kernel it applies,
+   * so that ns/tap compares the two directly */
+  pixels = (double) width * height;
+  taps = engine == ENGINE_DIRECT ? (double) kern->size * kern->size
+    : 2.0 * kern->size;
+  printf("%5d %5lux%-5lu %5d %-10s %8.0f %10.6f %9.2f %8.3f %5d\n",
+    depth, width, height, kern->stdev, engineName(engine), taps, elapsed,
+    pixels / elapsed / 1e6, elapsed * 1e9 / (pixels * taps), error);
+  fflush(stdout);
+
+}
+
+/* bench_depth
+ * ------
+ * Time every selected engine on one synthetic image across a range of
+ * standard deviations
+ *
+ * width, height, depth:  shape of the image
+ * s_first, s_last:       standard deviations to run
+ * only:                  engine to run (-1 for all)
+ *
+ * returns: success or failure
+ *
+ */
+static int bench_depth(UINT width, UINT height, USHORT depth, int s_first,
+  int s_last, int only) {
+
+  BMP *src, *ref, *out;
+  KERNEL *kern;
+  double elapsed;
+  int engine, stdev;
+
+  src = syntheticBMP(width, height, depth);
+  ref = BMP_Create(width, height, depth);
+  out = BMP_Create(width, height, depth);
+  if (src == NULL || ref == NULL || out == NULL) {
+    fprintf(stderr, EM_BENCH_OOM);
+    BMP_Free(src);
+    BMP_Free(ref);
+    BMP_Free(out);
+    return EXIT_FAILURE;
+  }
+
+  for (stdev = s_first; stdev <= s_last; stdev++) {
+    if ((kern = create_kernel(stdev)) == NULL) break;
+    if (reference(stdev, src, ref) != EXIT_SUCCESS) {
+      free_kernel(kern);
+      break;
+    }
+
+    for (engine = 0; engine < ENGINE_COUNT; engine++) {
+      if (only >= 0 && engine != only) continue;
+      if ((elapsed = time_engine(engine, kern, src, out)) < 0) {
+        free_kernel(kern);
+        BMP_Free(src);
+        BMP_Free(ref);
+        BMP_Free(out);
+        return EXIT_FAILURE;
+      }
+      print_row(depth, width, height, kern, engine, elapsed,
+        max_error(ref, out));
+    }
+
+    free_kernel(kern);
+  }
+
+  BMP_Free(src);
+  BMP_Free(ref);
+  BMP_Free(out);
+
+  return stdev > s_last ? EXIT_SUCCESS : EXIT_FAILURE;
+
+}
+
+/* bench_compare
+ * ------
+ * Time the separable and FFT engines on one synthetic image at MAX_STDEV,
+ * the widest kernel of a plain blur, where the FFT engine should be the
+ * faster.  No reference is run: the error of the FFT engine is its largest
+ * difference from the separable engine's output.
+ *
+ * width, height, depth:  shape of the image
+ *
+ * returns: success, or failure if the FFT engine is not the faster
+ *
+ */
+static int bench_compare(UINT width, UINT height, USHORT depth) {
+
+  BMP *src, *sep, *out;
+  KERNEL *kern;
+  double t_sep, t_fft;
+
+  src = syntheticBMP(width, height, depth);
+  sep = BMP_Create(width, height, depth);
+  out = BMP_Create(width, height, depth);
+  kern = create_kernel(MAX_STDEV);
+  if (src == NULL || sep == NULL || out == NULL || kern == NULL) {
+    fprintf(stderr, EM_BENCH_OOM);
+    BMP_Free(src);
+    BMP_Free(sep);
+    BMP_Free(out);
+    if (kern != NULL) free_kernel(kern);
+    return EXIT_FAILURE;
+  }
+
+  t_sep = time_engine(ENGINE_SEPARABLE, kern, src, sep);
+  t_fft = t_sep < 0 ? -1 : time_engine(ENGINE_FFT, kern, src, out);
+  if (t_fft >= 0) {
+    print_row(depth, width, height, kern, ENGINE_SEPARABLE, t_sep, 0);
+    print_row(depth, width, height, kern, ENGINE_FFT, t_fft,
+      max_error(sep, out));
+    printf("%5d %5lux%-5lu %5d fft speed up %.2f\n", depth, width, height,
+      MAX_STDEV, t_sep / t_fft);
+  }
+
+  free_kernel(kern);
+  BMP_Free(src);
+  BMP_Free(sep);
+  BMP_Free(out);
+
+  if (t_fft < 0) return EXIT_FAILURE;
+  if (t_fft >= t_sep) {
+    fprintf(stderr, EM_BENCH_SLOWER, depth, width, height);
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+
+}
+
+int main(int argc, char **argv) {
+
+  UINT width, height;
+  USHORT depths[3];
+  int ndepth, s_first, s_last, c, f_out, e;
+  char *fn_gen, *tok;
+  int only, compare;
+  BMP *bmp;
+
+  width = BENCH_WIDTH;
+  height = BENCH_HEIGHT;
+  depths[0] = 8;
+  depths[1] = 24;
+  depths[2] = 32;
+  ndepth = 3;
+  s_first = MIN_STDEV;
+  s_last = MAX_STDEV;
+  fn_gen = NULL;
+  only = -1;
+  compare = 0;
+
+  while ((c = getopt(argc, argv, "cd:e:g:h:s:w:")) != -1) {
+    switch (c) {
+      case 'w':
+        width = atoi(optarg);
+        break;
+      case 'h':
+        height = atoi(optarg);
+        break;
+      case 'd':
+        for (ndepth = 0, tok = strtok(optarg, ","); tok != NULL;
+            tok = strtok(NULL, ",")) {
+          if (ndepth == 3 || (atoi(tok) != 8 && atoi(tok) != 24 &&
+                atoi(tok) != 32)) {
+            fprintf(stderr, EM_BENCH_DEPTH, tok);
+            return EXIT_FAILURE;
+          }
+          depths[ndepth++] = atoi(tok);
+        }
+        break;
+      case 's':
+        if (sscanf(optarg, "%d-%d", &s_first, &s_last) == 1) {
+          s_last = s_first;
+        }
+        break;
+      case 'e':
+        if ((only = engineByName(optarg)) < 0) {
+          fprintf(stderr, EM_BENCH_ENGINE, optarg);
+          return EXIT_FAILURE;
+        }
+        break;
+      case 'c':
+        compare = 1;
+        break;
+      case 'g':
+        fn_gen = optarg;
+        break;
+      default:
+        fprintf(stderr, EM_BENCH_USAGE);
+        return EXIT_FAILURE;
+    }
+  }
+  if (optind != argc || width < 1 || height < 1 || ndepth < 1 ||
+      s_first < MIN_STDEV || s_last < s_first) {
+    fprintf(stderr, EM_BENCH_USAGE);
+    return EXIT_FAILURE;
+  }
+
+  /* Generate an input image only */
+  if (fn_gen != NULL) {
+    if ((bmp = syntheticBMP(width, height, depths[0])) == NULL) {
+      return EXIT_FAILURE;
+    }
+    f_out = strcmp(fn_gen, STDIO_PATH) == 0 ? dup(STDOUT_FILENO)
+      : open(fn_gen, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (f_out < 0) {
+      perror(fn_gen);
+      BMP_Free(bmp);
+      return EXIT_FAILURE;
+    }
+    BMP_WriteFile(bmp, f_out);
+    e = BMP_CheckError(stderr) == BMP_OK ? EXIT_SUCCESS : EXIT_FAILURE;
+    close(f_out);
+    BMP_Free(bmp);
+    return e;
+  }
+
+  printf("%5s %11s %5s %-10s %8s %10s %9s %8s %5s\n", "depth", "size",
+    "stdev", "engine", "taps", "seconds", "MP/s", "ns/tap", "error");
+  for (c = 0; c < ndepth; c++) {
+    e = compare ? bench_compare(width, height, depths[c])
+      : bench_depth(width, height, depths[c], s_first, s_last, only);
+    if (e != EXIT_SUCCESS) return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+
+}
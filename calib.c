@@ -0,0 +1,236 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "calib.h"
+#include "const.h"
+#include "gaussianLib.h"
+#include "kern.h"
+#include "mpi.h"
+#include "qdbmp.h"
+
+/* measure_rate
+ * ------
+ * Convolve a small synthetic band with the job kernel until CALIB_MIN_S has
+ * elapsed and report the throughput.
+ *
+ * NOTE: The band is CALIB_WIDTH pixels wide, so the rate is only meaningful
+ * relative to the rates of other ranks measured the same way.
+ *
+ * stdev:       standard deviation of the kernel
+ * engine:      convolution engine (see ENGINE_DIRECT)
+ *
+ * returns: rows per second, or a negative value on failure
+ *
+ */
+static double measure_rate(int stdev, int engine) {
+
+  UINT x, y;
+  BMP *band, *out;
+  KERNEL *kern;
+  int kern_size;
+  double start, elapsed, rows;
+
+  if ((kern = create_kernel(stdev)) == NULL) return -1;
+  kern_size = kern->size;
+
+  /* The band is as tall as the kernel so that every tap is exercised */
+  band = BMP_Create(CALIB_WIDTH, kern_size, 24);
+  out = BMP_Create(CALIB_WIDTH, kern_size, 24);
+  if (band == NULL || out == NULL) {
+    fprintf(stderr, EM_CALIB_OOM);
+    BMP_Free(band);
+    BMP_Free(out);
+    free_kernel(kern);
+    return -1;
+  }
+  for (y = 0; y < kern_size; y++) {
+    for (x = 0; x < CALIB_WIDTH; x++) {
+      BMP_SetPixelRGB(band, x, y, x * 7 + y, x + y * 13, x ^ y);
+    }
+  }
+
+  rows = 0;
+  start = MPI_Wtime();
+  do {
+    convolveBMP(engine, kern, EDGE_CLAMP, band, out);
+    rows += kern_size;
+  } while ((elapsed = MPI_Wtime() - start) < CALIB_MIN_S);
+
+  BMP_Free(band);
+  BMP_Free(out);
+  free_kernel(kern);
+
+  return rows / elapsed;
+
+}
+
+/* load_profile
+ * ------
+ * Look up the rate of every rank by host name in a calibration profile.
+ *
+ * fn_profile:  profile file name
+ * names:       host name of each rank (MPI_MAX_PROCESSOR_NAME apart)
+ * nproc:       number of ranks
+ * rates:       rows per second of each rank (out)
+ *
+ * returns: 1 if every rank was found in the profile, otherwise 0
+ *
+ */
+static int load_profile(char *fn_profile, char *names, int nproc,
+  double *rates) {
+
+  FILE *f;
+  int i, found;
+  double rate;
+  char line[CALIB_HOST_LEN + 64], host[CALIB_HOST_LEN];
+
+  if ((f = fopen(fn_profile, "r")) == NULL) return 0;
+
+  for (i = 0; i < nproc; i++) rates[i] = 0;
+  while (fgets(line, sizeof(line), f) != NULL) {
+    if (line[0] == '#') continue;
+    if (sscanf(line, "%255s %lf", host, &rate) != 2 || rate <= 0) continue;
+    for (i = 0; i < nproc; i++) {
+      if (strcmp(host, names + i * MPI_MAX_PROCESSOR_NAME) == 0)
+        rates[i] = rate;
+    }
+  }
+  fclose(f);
+
+  found = 1;
+  for (i = 0; i < nproc; i++) {
+    if (rates[i] <= 0) found = 0;
+  }
+
+  return found;
+
+}
+
+/* save_profile
+ * ------
+ * Persist the measured rates, averaged over all ranks sharing a host.
+ *
+ * fn_profile:  profile file name
+ * names:       host name of each rank (MPI_MAX_PROCESSOR_NAME apart)
+ * nproc:       number of ranks
+ * rates:       rows per second of each rank
+ *
+ * returns: success or failure
+ *
+ */
+static int save_profile(char *fn_profile, char *names, int nproc,
+  double *rates) {
+
+  FILE *f;
+  int i, j, n;
+  double sum;
+  char *name;
+
+  if ((f = fopen(fn_profile, "w")) == NULL) {
+    fprintf(stderr, EM_CALIB_PROFILE, strerror(errno));
+    return EXIT_FAILURE;
+  }
+
+  fprintf(f, "%s\n", CALIB_HEADER);
+  for (i = 0; i < nproc; i++) {
+    name = names + i * MPI_MAX_PROCESSOR_NAME;
+
+    /* Only emit each host once, at its first rank */
+    for (j = 0; j < i; j++) {
+      if (strcmp(name, names + j * MPI_MAX_PROCESSOR_NAME) == 0) break;
+    }
+    if (j < i) continue;
+
+    for (sum = 0, n = 0, j = i; j < nproc; j++) {
+      if (strcmp(name, names + j * MPI_MAX_PROCESSOR_NAME) != 0) continue;
+      sum += rates[j];
+      n++;
+    }
+    fprintf(f, "%s %.3f\n", name, sum / n);
+  }
+
+  if (fclose(f) != 0) {
+    fprintf(stderr, EM_CALIB_PROFILE, strerror(errno));
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+
+}
+
+/* calibrate
+ * ------
+ * Establish the convolution throughput of every rank.  Must be called by
+ * all ranks.  Where a profile is given and covers every host in the job the
+ * measurement is skipped, otherwise all ranks measure and the profile is
+ * (re)written by the master.
+ *
+ * me:          current rank
+ * nproc:       number of processes, including master
+ * stdev:       standard deviation of the kernel
+ * engine:      convolution engine (see ENGINE_DIRECT)
+ * fn_profile:  calibration profile file name (empty for none)
+ * rates:       rows per second of each rank, indexed by rank (out, master)
+ *
+ * returns: success or failure
+ *
+ */
+int calibrate(int me, int nproc, int stdev, int engine, char *fn_profile,
+  double *rates) {
+
+  int i, len, loaded, e;
+  char name[MPI_MAX_PROCESSOR_NAME], *names;
+  double rate;
+
+  e = EXIT_SUCCESS;
+  loaded = 0;
+  names = NULL;
+
+  /* Gather host names so rates can be matched to the profile */
+  memset(name, 0, sizeof(name));
+  MPI_Get_processor_name(name, &len);
+  if (me == MPI_MASTER_NODE) {
+    names = calloc(nproc, MPI_MAX_PROCESSOR_NAME);
+    if (names == NULL) {
+      fprintf(stderr, EM_CALIB_OOM);
+      return EXIT_FAILURE;
+    }
+  }
+  MPI_Gather(name, MPI_MAX_PROCESSOR_NAME, MPI_CHAR, names,
+    MPI_MAX_PROCESSOR_NAME, MPI_CHAR, MPI_MASTER_NODE, MPI_COMM_WORLD);
+
+  if (me == MPI_MASTER_NODE && fn_profile[0] != '\0') {
+    loaded = load_profile(fn_profile, names, nproc, rates);
+  }
+  MPI_Bcast(&loaded, 1, MPI_INT, MPI_MASTER_NODE, MPI_COMM_WORLD);
+
+  if (!loaded) {
+    rate = measure_rate(stdev, engine);
+    MPI_Gather(&rate, 1, MPI_DOUBLE, rates, 1, MPI_DOUBLE, MPI_MASTER_NODE,
+      MPI_COMM_WORLD);
+    if (me == MPI_MASTER_NODE) {
+      for (i = 0; i < nproc; i++) {
+        if (rates[i] <= 0) e = EXIT_FAILURE;
+      }
+      if (e == EXIT_SUCCESS && fn_profile[0] != '\0') {
+        e = save_profile(fn_profile, names, nproc, rates);
+      }
+    }
+  }
+
+#ifdef TRACE
+  if (me == MPI_MASTER_NODE) {
+    for (i = 0; i < nproc; i++) {
+      fprintf(stderr, "rank %d (%s) %s %.1f rows/s\n", i,
+        names + i * MPI_MAX_PROCESSOR_NAME,
+        loaded ? "profiled at" : "calibrated at", rates[i]);
+    }
+  }
+#endif
+
+  free(names);
+
+  return e;
+
+}
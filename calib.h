@@ -0,0 +1,27 @@
+#ifndef _CALIB_H_
+#define _CALIB_H_
+
+/*
+ * calib.h
+ * -------
+ * Measures the convolution throughput of every rank so that tiles can be
+ * sized in proportion to the speed of the host they are sent to.  Results
+ * are keyed by host name and may be persisted to a profile file so later
+ * jobs can skip the measurement.
+ *
+ */
+
+/* Constants */
+#define CALIB_WIDTH       32      /* Width of the synthetic band (pixels) */
+#define CALIB_MIN_S       0.05    /* Minimum time spent measuring a rank */
+#define CALIB_HOST_LEN    256     /* Longest host name read from a profile */
+#define CALIB_HEADER      "# gaussianmpi calibration profile: <host> <rows/s>"
+
+/* Error messages */
+#define EM_CALIB_OOM      "Out of memory during calibration\n"
+#define EM_CALIB_PROFILE  "Failed to write calibration profile: %s\n"
+
+int calibrate(int me, int nproc, int stdev, int engine, char *fn_profile,
+  double *rates);
+
+#endif /* _CALIB_H_ */
@@ -0,0 +1,326 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "codec.h"
+#include "const.h"
+#include "mpi.h"
+#include "qdbmp.h"
+
+/* Running totals for this rank, reported by codec_report */
+static double codec_raw = 0;
+static double codec_wire = 0;
+static double codec_seconds = 0;
+
+/* predict
+ * ------
+ * LOCO-I median edge predictor for a pixel of a plane, from the pixels to
+ * the left (a), above (b) and above left (c).  Missing neighbours fall back
+ * to whichever neighbour is available.
+ *
+ * p:       plane
+ * width:   width of the plane
+ * x:       column of the pixel
+ * y:       row of the pixel
+ *
+ * returns: predicted value of the pixel
+ *
+ */
+static UCHAR predict(UCHAR *p, UINT width, UINT x, UINT y) {
+
+  int a, b, c, lo, hi;
+
+  a = x > 0 ? p[y * width + x - 1] : (y > 0 ? p[(y - 1) * width + x] : 0);
+  b = y > 0 ? p[(y - 1) * width + x] : a;
+  c = x > 0 && y > 0 ? p[(y - 1) * width + x - 1] : b;
+
+  lo = a < b ? a : b;
+  hi = a < b ? b : a;
+  if (c >= hi) return lo;
+  if (c <= lo) return hi;
+  return a + b - c;
+
+}
+
+/* pack_encode
+ * ------
+ * Pack zigzag coded residuals CODEC_BLOCK at a time at the width of the
+ * largest residual in the block, run length encoding all zero blocks.
+ *
+ * src:   residuals to encode
+ * n:     number of residuals
+ * dst:   encoded bytes (at least codec_bound(n) long)
+ *
+ * returns: number of encoded bytes
+ *
+ */
+static UINT pack_encode(UCHAR *src, UINT n, UCHAR *dst) {
+
+  UINT i, j, o, len, run, bits, acc, nacc;
+  UCHAR max;
+
+  o = 0;
+  run = 0;
+  for (i = 0; i < n; i += CODEC_BLOCK) {
+    len = n - i < CODEC_BLOCK ? n - i : CODEC_BLOCK;
+    for (max = 0, j = 0; j < len; j++) max |= src[i + j];
+
+    /* Extend the current run of zero blocks */
+    if (max == 0) {
+      if (++run == CODEC_MAX_RUN) {
+        dst[o++] = 127 + run;
+        run = 0;
+      }
+      continue;
+    }
+    if (run > 0) {
+      dst[o++] = 127 + run;
+      run = 0;
+    }
+
+    /* Pack the block at the width of its largest residual */
+    for (bits = 0; max; bits++) max >>= 1;
+    dst[o++] = bits;
+    for (acc = 0, nacc = 0, j = 0; j < len; j++) {
+      acc |= (UINT) src[i + j] << nacc;
+      nacc += bits;
+      while (nacc >= 8) {
+        dst[o++] = acc & 0xff;
+        acc >>= 8;
+        nacc -= 8;
+      }
+    }
+    if (nacc > 0) dst[o++] = acc & 0xff;
+  }
+  if (run > 0) dst[o++] = 127 + run;
+
+  return o;
+
+}
+
+/* pack_decode
+ * ------
+ * Reverse pack_encode.
+ *
+ * src:   encoded bytes
+ * enc:   number of encoded bytes
+ * dst:   decoded residuals
+ * n:     expected number of residuals
+ *
+ * returns: success or failure
+ *
+ */
+static int pack_decode(UCHAR *src, UINT enc, UCHAR *dst, UINT n) {
+
+  UINT i, j, o, len, bits, acc, nacc, mask;
+  UCHAR c;
+
+  i = 0;
+  o = 0;
+  while (i < enc) {
+    c = src[i++];
+
+    /* Run of zero blocks */
+    if (c >= 128) {
+      len = (c - 127) * CODEC_BLOCK;
+      if (len > n - o) len = n - o;
+      memset(dst + o, 0, len);
+      o += len;
+      continue;
+    }
+
+    /* Packed block */
+    bits = c;
+    if (bits == 0 || bits > 8 || o >= n) return EXIT_FAILURE;
+    len = n - o < CODEC_BLOCK ? n - o : CODEC_BLOCK;
+    if (i + (len * bits + 7) / 8 > enc) return EXIT_FAILURE;
+    mask = (1u << bits) - 1;
+    for (acc = 0, nacc = 0, j = 0; j < len; j++) {
+      while (nacc < bits) {
+        acc |= (UINT) src[i++] << nacc;
+        nacc += 8;
+      }
+      dst[o++] = acc & mask;
+      acc >>= bits;
+      nacc -= bits;
+    }
+  }
+
+  return o == n ? EXIT_SUCCESS : EXIT_FAILURE;
+
+}
+
+/* codec_bound
+ * ------
+ * Worst case size of an encoded buffer
+ *
+ * size:  size of the raw bitmap data in bytes
+ *
+ * returns: maximum number of encoded bytes
+ *
+ */
+UINT codec_bound(UINT size) {
+
+  return size + size / CODEC_BLOCK + 2;
+
+}
+
+/* codec_encode
+ * ------
+ * Encode bitmap data for transfer
+ *
+ * src:     bitmap data (rows padded to 4 bytes)
+ * width:   width of the bitmap (pixels)
+ * height:  height of the bitmap (pixels)
+ * depth:   depth of the bitmap (bits)
+ * dst:     encoded data (at least codec_bound of the data size long)
+ *
+ * returns: number of encoded bytes, or 0 on failure
+ *
+ */
+UINT codec_encode(UCHAR *src, UINT width, UINT height, USHORT depth,
+  UCHAR *dst) {
+
+  UCHAR *planes, *res, *p, *row, r;
+  UINT bpp, stride, n, x, y, k, enc;
+  double start;
+
+  start = MPI_Wtime();
+
+  bpp = depth >> 3;
+  stride = BMP_RowStride(width, depth);
+  n = width * height;
+
+  planes = malloc(2 * n * bpp);
+  if (planes == NULL) {
+    fprintf(stderr, EM_CODEC_OOM);
+    return 0;
+  }
+  res = planes + n * bpp;
+
+  /* Split into one plane per channel */
+  for (p = planes, k = 0; k < bpp; k++) {
+    for (y = 0; y < height; y++) {
+      row = src + y * stride + k;
+      for (x = 0; x < width; x++, row += bpp) *p++ = *row;
+    }
+  }
+
+  /* Zigzag code the prediction error so small errors have small codes */
+  for (k = 0; k < bpp; k++) {
+    p = planes + k * n;
+    for (y = 0; y < height; y++) {
+      for (x = 0; x < width; x++) {
+        r = p[y * width + x] - predict(p, width, x, y);
+        r = r & 0x80 ? ((UCHAR) ~r << 1) | 1 : r << 1;
+        res[k * n + y * width + x] = r;
+      }
+    }
+  }
+
+  enc = pack_encode(res, n * bpp, dst);
+  free(planes);
+
+  codec_raw += stride * height;
+  codec_wire += enc;
+  codec_seconds += MPI_Wtime() - start;
+
+  return enc;
+
+}
+
+/* codec_decode
+ * ------
+ * Decode bitmap data produced by codec_encode
+ *
+ * src:       encoded data
+ * enc_size:  number of encoded bytes
+ * width:     width of the bitmap (pixels)
+ * height:    height of the bitmap (pixels)
+ * depth:     depth of the bitmap (bits)
+ * dst:       bitmap data (rows padded to 4 bytes)
+ *
+ * returns: success or failure
+ *
+ */
+int codec_decode(UCHAR *src, UINT enc_size, UINT width, UINT height,
+  USHORT depth, UCHAR *dst) {
+
+  UCHAR *planes, *res, *p, *row, r;
+  UINT bpp, stride, n, x, y, k;
+  double start;
+
+  start = MPI_Wtime();
+
+  bpp = depth >> 3;
+  stride = BMP_RowStride(width, depth);
+  n = width * height;
+
+  planes = malloc(2 * n * bpp);
+  if (planes == NULL) {
+    fprintf(stderr, EM_CODEC_OOM);
+    return EXIT_FAILURE;
+  }
+  res = planes + n * bpp;
+  if (pack_decode(src, enc_size, res, n * bpp) != EXIT_SUCCESS) {
+    fprintf(stderr, EM_CODEC_CORRUPT);
+    free(planes);
+    return EXIT_FAILURE;
+  }
+
+  /* Undo the prediction in raster order, so every neighbour is known */
+  for (k = 0; k < bpp; k++) {
+    p = planes + k * n;
+    for (y = 0; y < height; y++) {
+      for (x = 0; x < width; x++) {
+        r = res[k * n + y * width + x];
+        r = r & 1 ? ~(r >> 1) : r >> 1;
+        p[y * width + x] = predict(p, width, x, y) + r;
+      }
+    }
+  }
+
+  /* Interleave the planes back into pixels */
+  memset(dst, 0, stride * height);
+  for (p = planes, k = 0; k < bpp; k++) {
+    for (y = 0; y < height; y++) {
+      row = dst + y * stride + k;
+      for (x = 0; x < width; x++, row += bpp) *row = *p++;
+    }
+  }
+  free(planes);
+
+  codec_seconds += MPI_Wtime() - start;
+
+  return EXIT_SUCCESS;
+
+}
+
+/* codec_report
+ * ------
+ * Sum the codec totals of all ranks and print the compression achieved,
+ * the time spent coding and the transfer time saved on an assumed link of
+ * CODEC_LINK_BPS.  Must be called by all ranks.
+ *
+ * me:    current rank
+ *
+ */
+void codec_report(int me) {
+
+  double local[3], total[3], saved;
+
+  local[0] = codec_raw;
+  local[1] = codec_wire;
+  local[2] = codec_seconds;
+  MPI_Reduce(local, total, 3, MPI_DOUBLE, MPI_SUM, MPI_MASTER_NODE,
+    MPI_COMM_WORLD);
+
+  if (me != MPI_MASTER_NODE || total[1] == 0) return;
+
+  saved = (total[0] - total[1]) / CODEC_LINK_BPS;
+  fprintf(stderr, "codec: %.0f -> %.0f bytes (ratio %.2f)\n", total[0],
+    total[1], total[0] / total[1]);
+  fprintf(stderr, "codec: %.3f s coding vs %.3f s transfer saved at "
+    "%.0f MB/s (net %+.3f s)\n", total[2], saved, CODEC_LINK_BPS / 1e6,
+    saved - total[2]);
+
+}
@@ -0,0 +1,43 @@
+#ifndef _CODEC_H_
+#define _CODEC_H_
+
+/*
+ * codec.h
+ * -------
+ * Lightweight lossless codec for shipping tiles between nodes.  Pixel data
+ * is split into byte planes (one per colour channel) and delta coded against
+ * a prediction from the neighbouring pixels (the LOCO-I median predictor).
+ * The residuals are then packed in blocks of CODEC_BLOCK values at the fewest
+ * bits that hold the largest residual of the block, with runs of all zero
+ * blocks run length encoded.  Row padding is dropped on encoding and restored
+ * as zeros on decoding.
+ *
+ * Each block starts with a control byte: values below 128 give the bit width
+ * of the packed residuals that follow, otherwise (value - 127) zero blocks
+ * are skipped.
+ *
+ */
+
+#include "qdbmp.h"
+
+/* Codecs */
+#define CODEC_NONE        0
+#define CODEC_PACK        1
+
+/* Constants */
+#define CODEC_BLOCK       16      /* Residuals packed per control byte */
+#define CODEC_MAX_RUN     128     /* Most zero blocks per control byte */
+#define CODEC_LINK_BPS    125.0e6 /* Assumed link speed for reports (1 GbE) */
+
+/* Error messages */
+#define EM_CODEC_OOM      "Out of memory while encoding tile\n"
+#define EM_CODEC_CORRUPT  "Encoded tile is corrupt\n"
+
+UINT codec_bound(UINT size);
+UINT codec_encode(UCHAR *src, UINT width, UINT height, USHORT depth,
+  UCHAR *dst);
+int codec_decode(UCHAR *src, UINT enc_size, UINT width, UINT height,
+  USHORT depth, UCHAR *dst);
+void codec_report(int me);
+
+#endif /* _CODEC_H_ */
@@ -2,15 +2,17 @@
 #define MAX_PATH                128
 #define MAX_STDEV               20
 #define MIN_STDEV               1
+#define MAX_PYRAMID_STDEV       1000  /* With --pyramid */
+#define STDIO_PATH              "-"   /* Input or output on stdin/stdout */
 
-/* Tracing */
+/* Tracing, on stderr so stdout is free to carry the output image */
 #define TRACE
 
 /* Codes to use within MPI */
 #define MPI_ABORT_FAIL_CODE     -1
 
 /* Payload configuration */
-#define PAYLOAD_COUNT           5
+#define PAYLOAD_COUNT           7
 
 /* Tags for data in MPI */
 #define MPI_DATA_TAG            1
@@ -18,16 +20,20 @@
 #define MPI_HEIGHT_TAG          3
 #define MPI_WIDTH_TAG           4
 #define MPI_DEPTH_TAG           5
+#define MPI_STDEV_TAG           6
+#define MPI_CLOCK_TAG           7
+#define MPI_PROGRESS_TAG        8
+#define MPI_EDGE_TAG            9
 
 /* Node Ids */
 #define MPI_MASTER_NODE         0
 
 /* Timing - Note: these values are approximate, not guaranteed */
 #define MICRO_IN_S     1000000.0f
-#define TIMEOUT_PAYLOAD_S    15.0f   /* Timeout for sending payload to slaves */
+#define TIMEOUT_PAYLOAD_S    15.0f   /* Timeout for any payload send to
+                                        complete (see progress.h for the
+                                        timeout of processing) */
 #define TIMEOUT_PAYLOAD_U       TIMEOUT_PAYLOAD_S * MICRO_IN_S
-#define TIMEOUT_PROCESS_S    60.0f   /* Timeout for slaves to process image */
-#define TIMEOUT_PROCESS_U       TIMEOUT_S * MICRO_IN_S
 #define SLEEP_S              0.1f   /* Time to sleep between iterations*/
 #define SLEEP_U                 SLEEP_S * MICRO_IN_S
 
@@ -39,6 +45,24 @@
 #define EM_MAX_PATH             "File name exceeded max file path of %d\n"
 #define EM_OUT_OF_MEMORY        "Out of memory while initializing type %s\n"
 #define EM_PARSE_ARGS           "Failed to parse arguments\n"
+#define EM_USAGE                \
+   "usage: gaussianmpi [-Dctvz] [-p profile] [-d band|block] " \
+   "[-e separable|direct|fft] [-E clamp|mirror|wrap|zero] [-j threads] " \
+   "[-m] [-P tolerance] [-r report [-C]] [-T timeline] [-U tuned] " \
+   "<input> <output> <stdev>\n" \
+   "       gaussianmpi [-Dtvz] [-d band|block] [-e separable|direct|fft] " \
+   "[-E clamp|mirror|wrap|zero] [-P tolerance] [-r report [-C]] " \
+   "[-T timeline] [-U tuned] -b <manifest>\n" \
+   "       gaussianmpi [-Dtvz] [-d band|block] [-e separable|direct|fft] " \
+   "[-E clamp|mirror|wrap|zero] [-P tolerance] [-r report [-C]] " \
+   "[-T timeline] [-U tuned] -s <socket>\n" \
+   "       gaussianmpi -u <profile>    (writes a tuning profile for -U)\n"
+#define EM_DECOMP               "Unknown decomposition '%s'\n"
+#define EM_ENGINE               "Unknown engine '%s'\n"
+#define EM_EDGE                 "Unknown edge mode '%s'\n"
+#define EM_PYRAMID              "Invalid pyramid tolerance '%s'\n"
+#define EM_THREADS              "Invalid thread count '%s'\n"
+#define EM_COUNTERS_REPORT      "--counters needs a report (--report)\n"
 #define EM_STDEV_RANGE          "Standard deviation range is %d-%d inclusive\n"
 #define EM_TILE_NOT_FOUND       "Tile id %d not found in linked list\n"
 #define EM_PAYLOAD_TIMEOUT      \
@@ -46,3 +70,4 @@
 #define EM_TIMEOUT_RECV_SLAVE   \
    "Receiving processed data timed out for %d/%d nodes\n"
 #define OOM_TYPE_RECEIPT_ARRAY  "receipt array buffer"
+#define OOM_TYPE_WIRE_BUFFER    "encoded tile buffer"
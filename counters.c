@@ -0,0 +1,214 @@
+#include <errno.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#include "counters.h"
+#include "timing.h"
+
+/* Counters of one thread, opened on its first use */
+struct counters_fds {
+  int fd[COUNTER_COUNT];      /* -1 where the counter is unavailable */
+};
+
+int counters_on = 0;
+
+static double counters_total[PHASE_COUNT * COUNTER_FIELDS];
+static int counters_seen[COUNTER_COUNT];  /* Opened by some thread */
+static pthread_mutex_t counters_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_key_t counters_key;
+static pthread_once_t counters_once = PTHREAD_ONCE_INIT;
+static int counters_warned;
+
+static const char *counter_names[COUNTER_COUNT] = {
+  "cycles", "instructions", "l1d_misses", "llc_misses", "dtlb_misses"
+};
+
+/* Type and config of each counter for perf_event_open */
+static const struct {
+  uint32_t type;
+  uint64_t config;
+} counter_events[COUNTER_COUNT] = {
+  { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+  { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+  { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D |
+    (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+    (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+  { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_LL |
+    (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+    (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) },
+  { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_DTLB |
+    (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+    (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) }
+};
+
+/* close_fds
+ * ------
+ * Thread exit: close the counters of the thread
+ *
+ * arg:     counters of the thread
+ *
+ */
+static void close_fds(void *arg) {
+
+  struct counters_fds *fds;
+  int i;
+
+  fds = arg;
+  for (i = 0; i < COUNTER_COUNT; i++) {
+    if (fds->fd[i] >= 0) close(fds->fd[i]);
+  }
+  free(fds);
+
+}
+
+/* make_key
+ * ------
+ * Create the key under which each thread keeps its counters
+ *
+ */
+static void make_key(void) {
+
+  pthread_key_create(&counters_key, close_fds);
+
+}
+
+/* open_fds
+ * ------
+ * Open the counters of the calling thread, user space only.  Counters the
+ * kernel refuses are left closed; if none open, say so once.
+ *
+ * returns: counters of the thread, or NULL if out of memory
+ *
+ */
+static struct counters_fds *open_fds(void) {
+
+  struct counters_fds *fds;
+  struct perf_event_attr attr;
+  int i, e, opened;
+
+  pthread_once(&counters_once, make_key);
+  if ((fds = pthread_getspecific(counters_key)) != NULL) return fds;
+  if ((fds = malloc(sizeof(*fds))) == NULL) return NULL;
+
+  e = 0;
+  opened = 0;
+  for (i = 0; i < COUNTER_COUNT; i++) {
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = counter_events[i].type;
+    attr.config = counter_events[i].config;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED |
+      PERF_FORMAT_TOTAL_TIME_RUNNING;
+    fds->fd[i] = syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    if (fds->fd[i] < 0) {
+      e = errno;
+      continue;
+    }
+    ++opened;
+    __atomic_store_n(&counters_seen[i], 1, __ATOMIC_RELAXED);
+  }
+  if (opened == 0 &&
+      !__atomic_exchange_n(&counters_warned, 1, __ATOMIC_RELAXED)) {
+    fprintf(stderr, EM_COUNTERS_NONE, strerror(e));
+  }
+  pthread_setspecific(counters_key, fds);
+
+  return fds;
+
+}
+
+/* counters_read
+ * ------
+ * Read the counters of the calling thread, scaled up if the kernel had to
+ * share the hardware between them
+ *
+ * values:  COUNTER_COUNT values (out, 0 where unavailable)
+ *
+ */
+void counters_read(double *values) {
+
+  struct counters_fds *fds;
+  uint64_t buf[3];              /* Value, time enabled, time running */
+  int i;
+
+  fds = open_fds();
+  for (i = 0; i < COUNTER_COUNT; i++) {
+    values[i] = 0;
+    if (fds == NULL || fds->fd[i] < 0 ||
+        read(fds->fd[i], buf, sizeof(buf)) != sizeof(buf)) {
+      continue;
+    }
+    values[i] = buf[2] == 0 ? 0 : (double) buf[0] * buf[1] / buf[2];
+  }
+
+}
+
+/* counters_add
+ * ------
+ * Charge the counts since start to a phase
+ *
+ * phase:   phase to charge (see PHASE_READ)
+ * start:   counters_read when the phase began
+ * pixels:  pixels processed during the phase
+ * bytes:   bytes processed during the phase
+ *
+ */
+void counters_add(int phase, double *start, double pixels, double bytes) {
+
+  double end[COUNTER_COUNT], *total;
+  int i;
+
+  counters_read(end);
+  pthread_mutex_lock(&counters_lock);
+  total = counters_total + phase * COUNTER_FIELDS;
+  for (i = 0; i < COUNTER_COUNT; i++) total[i] += end[i] - start[i];
+  total[COUNTER_COUNT] += pixels;
+  total[COUNTER_COUNT + 1] += bytes;
+  pthread_mutex_unlock(&counters_lock);
+
+}
+
+/* counters_totals
+ * ------
+ * Totals of every phase so far
+ *
+ * totals:  COUNTER_FIELDS values per phase (out); counters no thread could
+ *          open are -1
+ *
+ */
+void counters_totals(double *totals) {
+
+  int p, i;
+
+  pthread_mutex_lock(&counters_lock);
+  memcpy(totals, counters_total, sizeof(counters_total));
+  pthread_mutex_unlock(&counters_lock);
+  for (p = 0; p < PHASE_COUNT; p++) {
+    for (i = 0; i < COUNTER_COUNT; i++) {
+      if (!counters_seen[i]) totals[p * COUNTER_FIELDS + i] = -1;
+    }
+  }
+
+}
+
+/* counters_name
+ * ------
+ * Name of a counter, as used in reports
+ *
+ * counter: counter (see COUNTER_CYCLES)
+ *
+ * returns: name
+ *
+ */
+const char *counters_name(int counter) {
+
+  return counter_names[counter];
+
+}
@@ -0,0 +1,55 @@
+#ifndef _COUNTERS_H_
+#define _COUNTERS_H_
+
+/*
+ * counters.h
+ * ----------
+ * Hardware performance counters (Linux perf_event_open) read around the
+ * hot loops: the convolution itself and the copies into and out of tiles.
+ * Each thread counts only itself, so the bands of a single process build
+ * and the remap thread of a threaded master are counted where they run.
+ * The totals per phase appear in the timing report, with IPC, bytes per
+ * cycle and cache misses per pixel derived from them.
+ *
+ * Where the kernel refuses a counter (as in many containers, or under a
+ * strict perf_event_paranoid) it is reported as unavailable and the report
+ * falls back to the wall clock times alone.
+ *
+ * Example:
+ *   double c[COUNTER_COUNT];
+ *   COUNTERS_START(c);
+ *   ...
+ *   COUNTERS_STOP(PHASE_CONVOLVE, c, pixels, bytes);
+ *
+ */
+
+/* Counters */
+#define COUNTER_CYCLES        0
+#define COUNTER_INSTRUCTIONS  1
+#define COUNTER_L1D_MISSES    2     /* Level 1 data cache read misses */
+#define COUNTER_LLC_MISSES    3     /* Last level cache read misses */
+#define COUNTER_DTLB_MISSES   4     /* Data TLB read misses */
+#define COUNTER_COUNT         5
+
+/* Fields kept per phase: each counter, then pixels and bytes */
+#define COUNTER_FIELDS        (COUNTER_COUNT + 2)
+
+/* Error messages */
+#define EM_COUNTERS_NONE      \
+  "Hardware counters unavailable (%s), reporting wall clock only\n"
+
+/* Set when counters were asked for */
+extern int counters_on;
+
+#define COUNTERS_START(c) \
+  do { if (counters_on) counters_read(c); } while (0)
+#define COUNTERS_STOP(phase, c, pixels, bytes) \
+  do { if (counters_on) counters_add((phase), (c), (pixels), (bytes)); } \
+  while (0)
+
+void counters_read(double *values);
+void counters_add(int phase, double *start, double pixels, double bytes);
+void counters_totals(double *totals);
+const char *counters_name(int counter);
+
+#endif /* _COUNTERS_H_ */
@@ -0,0 +1,269 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "fft.h"
+
+/* Error messages */
+#define EM_FFT_LENGTH     "Unsupported FFT length %d\n"
+
+/* transform
+ * ------
+ * Complex transform by recursive decimation in time: the m / r interleaved
+ * subsequences are transformed into consecutive blocks of out, which are
+ * then combined with an r point transform for each output frequency.
+ * Unnormalised in both directions.
+ *
+ * plan:    plan whose complex length m divides
+ * in:      input, every stride'th complex value
+ * out:     output (m complex values, must not overlap in)
+ * m:       length of this transform
+ * stride:  step between the input values, in complex values
+ * f:       index of the radix to split m by
+ * inverse: 1 for the inverse transform, 0 for the forward one
+ *
+ */
+static void transform(const FFT_PLAN *plan, const double *in, double *out,
+  int m, int stride, int f, int inverse) {
+
+  const double *tw;
+  double t[2 * 5], root[2 * 5], re, im, wr, wi;
+  int r, m1, q, q2, k, j, step;
+
+  if (m == 1) {
+    out[0] = in[0];
+    out[1] = in[1];
+    return;
+  }
+
+  r = plan->factors[f];
+  m1 = m / r;
+  for (q = 0; q < r; q++) {
+    transform(plan, in + 2 * q * stride, out + 2 * q * m1, m1, stride * r,
+      f + 1, inverse);
+  }
+
+  /* exp(-2 pi i j / m) is twiddle[j * n / m], conjugated for the inverse */
+  tw = plan->twiddle;
+  for (q = 0; q < r; q++) {
+    root[2 * q] = tw[2 * q * (plan->n / r)];
+    root[2 * q + 1] = inverse ? -tw[2 * q * (plan->n / r) + 1]
+      : tw[2 * q * (plan->n / r) + 1];
+  }
+  step = plan->n / m;
+  for (k = 0; k < m1; k++) {
+    t[0] = out[2 * k];
+    t[1] = out[2 * k + 1];
+    for (q = 1; q < r; q++) {
+      j = q * k * step;
+      wr = tw[2 * j];
+      wi = inverse ? -tw[2 * j + 1] : tw[2 * j + 1];
+      re = out[2 * (q * m1 + k)];
+      im = out[2 * (q * m1 + k) + 1];
+      t[2 * q] = re * wr - im * wi;
+      t[2 * q + 1] = re * wi + im * wr;
+    }
+
+    if (r == 2) {
+      out[2 * k] = t[0] + t[2];
+      out[2 * k + 1] = t[1] + t[3];
+      out[2 * (m1 + k)] = t[0] - t[2];
+      out[2 * (m1 + k) + 1] = t[1] - t[3];
+      continue;
+    }
+    for (q2 = 0; q2 < r; q2++) {
+      re = t[0];
+      im = t[1];
+      for (j = q2, q = 1; q < r; q++, j += q2) {
+        if (j >= r) j -= r;
+        re += t[2 * q] * root[2 * j] - t[2 * q + 1] * root[2 * j + 1];
+        im += t[2 * q] * root[2 * j + 1] + t[2 * q + 1] * root[2 * j];
+      }
+      out[2 * (q2 * m1 + k)] = re;
+      out[2 * (q2 * m1 + k) + 1] = im;
+    }
+  }
+
+}
+
+/* factorise
+ * ------
+ * Split a length into radices of 5, 3 and 2
+ *
+ * m:       length
+ * factors: radices (out, FFT_MAX_FACTORS)
+ *
+ * returns: number of radices, or -1 if m has any other prime factor
+ *
+ */
+static int factorise(int m, int *factors) {
+
+  static const int radices[] = { 5, 3, 2 };
+  int i, n;
+
+  n = 0;
+  for (i = 0; i < 3; i++) {
+    while (m % radices[i] == 0 && n < FFT_MAX_FACTORS) {
+      factors[n++] = radices[i];
+      m /= radices[i];
+    }
+  }
+
+  return m == 1 ? n : -1;
+
+}
+
+/* fft_good_size
+ * ------
+ * returns: the smallest length of at least n that fft_plan accepts
+ *
+ */
+int fft_good_size(int n) {
+
+  int factors[FFT_MAX_FACTORS];
+
+  if (n < 2) n = 2;
+  n += n & 1;
+  while (factorise(n / 2, factors) < 0) n += 2;
+
+  return n;
+
+}
+
+/* fft_plan
+ * ------
+ * Compute the twiddle factors for real transforms of one length
+ *
+ * n:       length, even with n / 2 a product of 2, 3 and 5 (see
+ *          fft_good_size)
+ *
+ * returns: the plan, or NULL on failure
+ *
+ */
+FFT_PLAN *fft_plan(int n) {
+
+  FFT_PLAN *plan;
+  int k;
+
+  plan = calloc(1, sizeof(FFT_PLAN));
+  if (plan == NULL) {
+    fprintf(stderr, EM_FFT_OOM, n);
+    return NULL;
+  }
+  plan->n = n;
+  if (n < 2 || n % 2 != 0 ||
+      (plan->nfactor = factorise(n / 2, plan->factors)) < 0) {
+    fprintf(stderr, EM_FFT_LENGTH, n);
+    free(plan);
+    return NULL;
+  }
+
+  plan->twiddle = malloc(2 * (size_t) n * sizeof(double));
+  if (plan->twiddle == NULL) {
+    fprintf(stderr, EM_FFT_OOM, n);
+    free(plan);
+    return NULL;
+  }
+  for (k = 0; k < n; k++) {
+    plan->twiddle[2 * k] = cos(2.0 * M_PI * k / n);
+    plan->twiddle[2 * k + 1] = -sin(2.0 * M_PI * k / n);
+  }
+
+  return plan;
+
+}
+
+/* fft_free
+ * ------
+ * Free a plan created by fft_plan
+ *
+ * plan:    plan (may be NULL)
+ *
+ */
+void fft_free(FFT_PLAN *plan) {
+
+  if (plan == NULL) return;
+
+  free(plan->twiddle);
+  free(plan);
+
+}
+
+/* fft_forward
+ * ------
+ * Forward transform of real samples.  The samples, taken in pairs as
+ * complex values, are transformed at half the length and the spectra of
+ * the even and odd samples separated out of the result:
+ *
+ *   X[k] = E[k] + exp(-2 pi i k / n) O[k]
+ *
+ * plan:    plan for the length
+ * in:      n samples
+ * out:     n / 2 + 1 complex values (out, must not overlap in)
+ * work:    FFT_WORK(n) doubles
+ *
+ */
+void fft_forward(const FFT_PLAN *plan, const double *in, double *out,
+  double *work) {
+
+  const double *tw;
+  double zr, zi, cr, ci, er, ei, or, oi;
+  int m, k, j;
+
+  m = plan->n / 2;
+  transform(plan, in, work, m, 1, 0, 0);
+
+  tw = plan->twiddle;
+  for (k = 0; k <= m; k++) {
+    j = k % m;
+    zr = work[2 * j];
+    zi = work[2 * j + 1];
+    j = (m - k) % m;
+    cr = work[2 * j];
+    ci = -work[2 * j + 1];
+    er = (zr + cr) / 2;
+    ei = (zi + ci) / 2;
+    or = (zi - ci) / 2;
+    oi = -(zr - cr) / 2;
+    out[2 * k] = er + or * tw[2 * k] - oi * tw[2 * k + 1];
+    out[2 * k + 1] = ei + or * tw[2 * k + 1] + oi * tw[2 * k];
+  }
+
+}
+
+/* fft_inverse
+ * ------
+ * Inverse of fft_forward, unnormalised: the samples come out n times
+ * their size
+ *
+ * plan:    plan for the length
+ * in:      n / 2 + 1 complex values
+ * out:     n samples (out, must not overlap in)
+ * work:    FFT_WORK(n) doubles
+ *
+ */
+void fft_inverse(const FFT_PLAN *plan, const double *in, double *out,
+  double *work) {
+
+  const double *tw;
+  double xr, xi, cr, ci, er, ei, dr, di, or, oi;
+  int m, k;
+
+  m = plan->n / 2;
+  tw = plan->twiddle;
+  for (k = 0; k < m; k++) {
+    xr = in[2 * k];
+    xi = in[2 * k + 1];
+    cr = in[2 * (m - k)];
+    ci = -in[2 * (m - k) + 1];
+    er = xr + cr;
+    ei = xi + ci;
+    dr = xr - cr;
+    di = xi - ci;
+    or = dr * tw[2 * k] + di * tw[2 * k + 1];
+    oi = di * tw[2 * k] - dr * tw[2 * k + 1];
+    work[2 * k] = er - oi;
+    work[2 * k + 1] = ei + or;
+  }
+  transform(plan, work, out, m, 1, 0, 1);
+
+}
@@ -0,0 +1,46 @@
+#ifndef _FFT_H_
+#define _FFT_H_
+
+/*
+ * fft.h
+ * -----
+ * Real to complex fast Fourier transforms of any even length whose half
+ * is a product of 2, 3 and 5 (mixed radix, no external library).  A real
+ * transform of length n is computed as a complex transform of length n / 2
+ * on the even and odd samples packed together.
+ *
+ * A plan holds the twiddle factors for one length and is only read by the
+ * transforms, so threads may share it; each thread passes its own work
+ * buffer of FFT_WORK(n) doubles.
+ *
+ * Spectra are stored as n / 2 + 1 complex values, each a real part followed
+ * by an imaginary part.
+ *
+ */
+
+/* Constants */
+#define FFT_MAX_FACTORS   32
+#define FFT_WORK(n)       (2 * (size_t) (n))  /* Doubles of work buffer */
+
+/* Error messages */
+#define EM_FFT_OOM        "Out of memory for an FFT of length %d\n"
+
+/*
+ * Twiddle factors for a real transform of one length
+ */
+typedef struct fft_plan {
+  int n;                        /* Real length */
+  int nfactor;
+  int factors[FFT_MAX_FACTORS]; /* Radices of the complex length n / 2 */
+  double *twiddle;              /* exp(-2 pi i k / n), for k < n */
+} FFT_PLAN;
+
+int fft_good_size(int n);
+FFT_PLAN *fft_plan(int n);
+void fft_free(FFT_PLAN *plan);
+void fft_forward(const FFT_PLAN *plan, const double *in, double *out,
+  double *work);
+void fft_inverse(const FFT_PLAN *plan, const double *in, double *out,
+  double *work);
+
+#endif /* _FFT_H_ */
@@ -1,4 +1,8 @@
+#ifndef _GAUSSIANLIB_H_
+#define _GAUSSIANLIB_H_
+
 #include "qdbmp.h"		/*Our Bitmap operations library */
+#include "kern.h"		/*Kernel in the forms the engines use */
 #include <stdio.h>		/*For I/O */
 #include <math.h>		/*For maths operations e.g pow,sqrt */
 #include <stdlib.h>		/*For utils e.g. malloc */
@@ -18,5 +22,55 @@ void bitmapFromSquareMatrix(float **mat, const char *filename, int mat_dim,
                             float mat_max, float colour_min,
                             float colour_max);
 
+/* Convolution engines */
+#define ENGINE_DIRECT     0	/*Square kernel, one pass */
+#define ENGINE_SEPARABLE  1	/*One dimensional kernel, two passes */
+#define ENGINE_FFT        2	/*One dimensional kernel, two passes by FFT */
+#define ENGINE_COUNT      3	/*Engines, numbered from 0 (see engineName) */
+
+#define FFT_SEGMENT       1024	/*Pixels of a line per FFT, at most */
+
+/* Pyramid blurs (see planPyramid) */
+#define PYRAMID_MAX_LEVELS 8	/*Most halvings of the image */
+#define PYRAMID_MIN_STDEV 3	/*Least blur at the coarsest level */
+
+#define EM_PYRAMID_PLAN   "No pyramid blurs stdev %d within tolerance %g\n"
+
+/* Edge modes: what pixels beyond the edge of the image are taken to be */
+#define EDGE_ZERO         0	/*Zero, darkening the borders */
+#define EDGE_CLAMP        1	/*The nearest edge pixel */
+#define EDGE_MIRROR       2	/*Reflected about the edge pixel */
+#define EDGE_WRAP         3	/*From the opposite edge, as if tiled */
+
 void applyConvolution(float **kernel, int kernel_dim, float kernel_origin,
                       float colour_max, BMP *old_bmp, BMP *new_bmp);
+
+int convolveRows(int engine, KERNEL *kern, int edge,
+                 const unsigned char *src, int src_stride,
+                 unsigned char *dst, int dst_stride, int width, int height,
+                 int channels, int y0, int y1);
+
+int planPyramid(int stdev, float tolerance, int *levels, int *coarse);
+
+int pyramidHalo(int levels, int coarse);
+
+int pyramidRows(int engine, KERNEL *kern, int levels, int edge,
+                const unsigned char *src, int src_stride,
+                unsigned char *dst, int dst_stride, int width, int height,
+                int channels, int y0, int y1);
+
+int convolveBMP(int engine, KERNEL *kern, int edge, BMP *old_bmp,
+                BMP *new_bmp);
+
+void freeKernelSpectra(KERNEL *kern);
+
+const char *engineName(int engine);
+
+#define SYNTH_SEED        12345	/*Seed of the synthetic image noise */
+
+BMP *syntheticBMP(unsigned int width, unsigned int height,
+                  unsigned short depth);
+
+int engineByName(const char *name);
+
+#endif /* _GAUSSIANLIB_H_ */
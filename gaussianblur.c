@@ -0,0 +1,153 @@
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "gaussianblur.h"
+#include "gaussianLib.h"
+#include "kern.h"
+
+/* Error messages */
+#define EM_GB_ARGS        "gb_blur: invalid image or arguments\n"
+#define EM_GB_THREAD      "gb_blur: failed to start thread\n"
+
+/* Rows of the image blurred by a single thread */
+struct gb_band {
+  const GB_IMAGE *src;
+  GB_IMAGE *dst;
+  KERNEL *kern;
+  int engine;
+  int edge;
+  int y0, y1;
+  int e;
+};
+
+/* blur_band
+ * ------
+ * Thread entry point: blur one band of rows
+ *
+ * arg:     band to blur
+ *
+ */
+static void *blur_band(void *arg) {
+
+  struct gb_band *band;
+
+  band = arg;
+  band->e = convolveRows(band->engine, band->kern, band->edge,
+    band->src->pixels, band->src->stride, band->dst->pixels,
+    band->dst->stride, band->src->width, band->src->height,
+    band->src->channels, band->y0, band->y1);
+
+  return NULL;
+
+}
+
+/* gb_blur
+ * ------
+ * Blur an image into another of the same dimensions.  Pixels beyond the
+ * edge of the image count as 0 (see gb_blur_edge for the other edge modes).
+ *
+ * src:     image to blur
+ * dst:     blurred image (out, must not overlap src)
+ * stdev:   standard deviation of the blur (at least 1)
+ * engine:  GB_ENGINE_DIRECT, GB_ENGINE_SEPARABLE or GB_ENGINE_FFT
+ * threads: number of threads to share the rows between (at least 1)
+ *
+ * returns: EXIT_SUCCESS or EXIT_FAILURE
+ *
+ */
+int gb_blur(const GB_IMAGE *src, GB_IMAGE *dst, int stdev, int engine,
+  int threads) {
+
+  return gb_blur_edge(src, dst, stdev, engine, GB_EDGE_ZERO, threads);
+
+}
+
+/* gb_blur_edge
+ * ------
+ * Blur an image into another of the same dimensions, taking the pixels
+ * beyond the edge of the image from the given edge mode
+ *
+ * src:     image to blur
+ * dst:     blurred image (out, must not overlap src)
+ * stdev:   standard deviation of the blur (at least 1)
+ * engine:  GB_ENGINE_DIRECT, GB_ENGINE_SEPARABLE or GB_ENGINE_FFT
+ * edge:    GB_EDGE_ZERO, GB_EDGE_CLAMP, GB_EDGE_MIRROR or GB_EDGE_WRAP
+ * threads: number of threads to share the rows between (at least 1)
+ *
+ * returns: EXIT_SUCCESS or EXIT_FAILURE
+ *
+ */
+int gb_blur_edge(const GB_IMAGE *src, GB_IMAGE *dst, int stdev, int engine,
+  int edge, int threads) {
+
+  KERNEL *kern;
+  struct gb_band *bands;
+  pthread_t *tids;
+  int i, started, e;
+
+  if (src == NULL || dst == NULL || src->pixels == NULL ||
+      dst->pixels == NULL || src->pixels == dst->pixels ||
+      src->width < 1 || src->height < 1 || src->channels < 1 ||
+      src->channels > GB_MAX_CHANNELS ||
+      src->stride < src->width * src->channels ||
+      dst->stride < src->width * src->channels ||
+      dst->width != src->width || dst->height != src->height ||
+      dst->channels != src->channels || stdev < 1 ||
+      (engine != GB_ENGINE_DIRECT && engine != GB_ENGINE_SEPARABLE &&
+      engine != GB_ENGINE_FFT) ||
+      (edge != GB_EDGE_ZERO && edge != GB_EDGE_CLAMP &&
+      edge != GB_EDGE_MIRROR && edge != GB_EDGE_WRAP)) {
+    fprintf(stderr, EM_GB_ARGS);
+    return EXIT_FAILURE;
+  }
+  if (threads < 1) threads = 1;
+  if (threads > src->height) threads = src->height;
+
+  if ((kern = create_kernel(stdev)) == NULL) return EXIT_FAILURE;
+
+  bands = calloc(threads, sizeof(struct gb_band));
+  tids = calloc(threads, sizeof(pthread_t));
+  if (bands == NULL || tids == NULL) {
+    fprintf(stderr, EM_KERN_OOM);
+    free(bands);
+    free(tids);
+    free_kernel(kern);
+    return EXIT_FAILURE;
+  }
+
+  /* The calling thread takes the first band */
+  for (i = 0; i < threads; i++) {
+    bands[i].src = src;
+    bands[i].dst = dst;
+    bands[i].kern = kern;
+    bands[i].engine = engine == GB_ENGINE_DIRECT ? ENGINE_DIRECT
+      : engine == GB_ENGINE_FFT ? ENGINE_FFT : ENGINE_SEPARABLE;
+    bands[i].edge = edge == GB_EDGE_CLAMP ? EDGE_CLAMP
+      : edge == GB_EDGE_MIRROR ? EDGE_MIRROR
+      : edge == GB_EDGE_WRAP ? EDGE_WRAP : EDGE_ZERO;
+    bands[i].y0 = (long) src->height * i / threads;
+    bands[i].y1 = (long) src->height * (i + 1) / threads;
+    bands[i].e = EXIT_SUCCESS;
+  }
+  for (started = 1; started < threads; started++) {
+    if (pthread_create(&tids[started], NULL, blur_band, &bands[started])
+        != 0) {
+      fprintf(stderr, EM_GB_THREAD);
+      break;
+    }
+  }
+  blur_band(&bands[0]);
+
+  e = started == threads ? EXIT_SUCCESS : EXIT_FAILURE;
+  for (i = 1; i < started; i++) pthread_join(tids[i], NULL);
+  for (i = 0; i < threads; i++) {
+    if (bands[i].e != EXIT_SUCCESS) e = EXIT_FAILURE;
+  }
+
+  free(bands);
+  free(tids);
+  free_kernel(kern);
+
+  return e;
+
+}
@@ -0,0 +1,50 @@
+#ifndef _GAUSSIANBLUR_H_
+#define _GAUSSIANBLUR_H_
+
+/*
+ * gaussianblur.h
+ * --------------
+ * In memory gaussian blur, for linking into other programs as
+ * libgaussianblur (see the makefile).  Works on caller owned pixel buffers
+ * of interleaved 8 bit channels, with no MPI and no files involved.  The
+ * rows of an image are divided between threads, which all read the shared
+ * source directly.
+ *
+ * Example:
+ *   GB_IMAGE src = { pixels, width, height, stride, 3 };
+ *   GB_IMAGE dst = { out, width, height, stride, 3 };
+ *   gb_blur(&src, &dst, 4, GB_ENGINE_SEPARABLE, 8);
+ *   gb_blur_edge(&src, &dst, 4, GB_ENGINE_SEPARABLE, GB_EDGE_MIRROR, 8);
+ *
+ */
+
+/* Engines */
+#define GB_ENGINE_DIRECT      0   /* Square kernel, one pass */
+#define GB_ENGINE_SEPARABLE   1   /* One dimensional kernel, two passes */
+#define GB_ENGINE_FFT         2   /* One dimensional kernel, passes by FFT */
+
+/* Edge modes: what pixels beyond the edge of the image are taken to be */
+#define GB_EDGE_ZERO          0   /* Zero, darkening the borders */
+#define GB_EDGE_CLAMP         1   /* The nearest edge pixel */
+#define GB_EDGE_MIRROR        2   /* Reflected about the edge pixel */
+#define GB_EDGE_WRAP          3   /* From the opposite edge, as if tiled */
+
+/* Limits */
+#define GB_MAX_CHANNELS       4
+
+/*
+ * Caller owned image
+ */
+typedef struct gb_image {
+  unsigned char *pixels;        /* First row of pixels */
+  int width, height;            /* Dimensions (pixels) */
+  int stride;                   /* Bytes from one row to the next */
+  int channels;                 /* Interleaved 8 bit channels per pixel */
+} GB_IMAGE;
+
+int gb_blur(const GB_IMAGE *src, GB_IMAGE *dst, int stdev, int engine,
+  int threads);
+int gb_blur_edge(const GB_IMAGE *src, GB_IMAGE *dst, int stdev, int engine,
+  int edge, int threads);
+
+#endif /* _GAUSSIANBLUR_H_ */
@@ -0,0 +1,79 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "const.h"
+#include "counters.h"
+#include "init.h"
+#include "local.h"
+#include "timeline.h"
+#include "timing.h"
+#include "tune.h"
+
+/*
+ * GAUSSIANLOCAL
+ * ------
+ *
+ * Performs the same gaussian blur as gaussianmpi within a single process,
+ * for images that fit on one host.  The image is split into bands of rows
+ * that a pool of threads blur straight from the source bitmap, so there is
+ * no MPI start up and no tile is copied.
+ *
+ * compilation:
+ *   - Requires a C compiler and the math library (no MPI)
+ *   - Example:
+ *        make gaussianlocal
+ *
+ * usage:
+ *   gaussianlocal [options] <input filename> <output filename> <stdev>
+ *   gaussianlocal -u <profile>
+ *
+ *   -e, --engine <name>   convolution engine, as per gaussianmpi
+ *   -j, --threads <n>     number of threads (default: one per processor)
+ *   -D, --direct          write the output with O_DIRECT, as per gaussianmpi
+ *   -r, --report <file>   write a timing report, as per gaussianmpi
+ *   -C, --counters        add hardware counters to the report, as per
+ *                         gaussianmpi
+ *   -T, --timeline <file> write a Chrome trace, as per gaussianmpi
+ *   -u, --tune <profile>  write the tuning profile <profile> of the engines
+ *                         and thread counts, as per gaussianmpi
+ *   -U, --tuned <file>    choose the engine and thread count from a tuning
+ *                         profile, as per gaussianmpi
+ *
+ *   Options that need MPI (batch, service, calibration and the transport
+ *   options) are rejected.
+ *
+ *   "-" as the input or output filename means stdin or stdout.
+ */
+int main(int argc, char **argv) {
+
+  JOB_OPTS opts;
+  int threads, e;
+
+  if (parse_args(argc, argv, &opts) == EXIT_FAILURE) return EXIT_FAILURE;
+  if (is_distributed(&opts)) {
+    fprintf(stderr, EM_LOCAL_OPTION);
+    return EXIT_FAILURE;
+  }
+  timeline_on = opts.fn_timeline[0] != '\0';
+  counters_on = opts.counters;
+  timing_on = opts.fn_report[0] != '\0' || timeline_on;
+
+  if (opts.fn_tune[0] != '\0') return do_tune(0, 1, &opts);
+  if (opts.fn_tuned[0] != '\0' && tune_load(0, opts.fn_tuned)
+      != EXIT_SUCCESS) {
+    return EXIT_FAILURE;
+  }
+
+  threads = opts.threads;
+  if (threads == 0) threads = sysconf(_SC_NPROCESSORS_ONLN);
+  if (threads < 1) threads = 1;
+
+  e = do_local(&opts, threads);
+  if (timing_report(0, 1, opts.fn_report) != EXIT_SUCCESS ||
+      timeline_write(0, 1, opts.fn_timeline) != EXIT_SUCCESS) {
+    e = EXIT_FAILURE;
+  }
+
+  return e;
+
+}
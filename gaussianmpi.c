@@ -4,14 +4,25 @@
 #include <stdio.h>
 #include <string.h>
 #include <unistd.h>
+#include "batch.h"
+#include "calib.h"
+#include "codec.h"
 #include "const.h"
+#include "counters.h"
+#include "gaussianLib.h"
 #include "init.h"
 #include "kern.h"
+#include "local.h"
 #include "master.h"
 #include "mosaic.h"
 #include "mpi.h"
+#include "progress.h"
 #include "qdbmp.h"
+#include "serve.h"
 #include "slave.h"
+#include "timeline.h"
+#include "timing.h"
+#include "tune.h"
 
 /*
  * GAUSSIANMPI
@@ -23,18 +34,125 @@
  * across multiple processes using the MPI standard.
  *
  * configuration:
- *   Check the const.h header file for some configurable fields.  Most notably
- *   one might want to configure the timeout in order to support larger images.
+ *   Check the const.h header file for some configurable fields.  Slaves are
+ *   timed out from the rate their heartbeats report rather than a fixed
+ *   limit, so larger images need no configuration; progress.h holds the
+ *   allowances.
  *
  * compilation:
  *   - Requires openmpi, math libraries
  *   - Example:
- *        mpicc gaussianLib.o init.o kern.o master.o mosaic.o qdbmp.o slave.o \
- *          gaussianmpi.c -o gaussianmpi -lm
- *   See the makefile for additional information.
+ *        mpicc batch.o calib.o codec.o counters.o fft.o gaussianLib.o init.o \
+ *          kern.o local.o master.o mosaic.o pipeline.o progress.o qdbmp.o \
+ *          serve.o slave.o timeline.o timing.o tune.o gaussianmpi.c \
+ *          -o gaussianmpi -lm -pthread
+ *   kern.o includes kern_table.h, the precomputed kernels, which the
+ *   makefile generates first with kerngen (see kerngen.c).
+ *   See the makefile for additional information.  "make lib" also builds
+ *   the blur as a library without MPI (libgaussianblur, see gaussianblur.h),
+ *   "make gaussianlocal" a single process build (see gaussianlocal.c) and
+ *   "make bench" a benchmark of the convolution engines (see bench.c).
+ *   "make PMPI=1" builds in a profile of the messages between ranks (see
+ *   pmpi.c), and "make check" compares the output of every distributed path
+ *   with gaussianlocal's (see check).
  *
  * usage:
- *   gaussianmpi <input filename> <output filename> <standard deviation>
+ *   gaussianmpi [options] <input filename> <output filename> <stdev>
+ *   gaussianmpi [options] -b <manifest>
+ *   gaussianmpi [options] -s <socket>
+ *   gaussianmpi -u <profile>
+ *
+ *   -c, --calibrate       measure the throughput of every rank at startup and
+ *                         size each tile in proportion to it
+ *   -p, --profile <file>  calibration profile; used in place of measuring if
+ *                         it covers every host, otherwise (re)written
+ *   -d, --decomp <layout> "band" splits the image into horizontal bands (the
+ *                         default, sized by calibration if enabled); "block"
+ *                         splits it into a grid of blocks shaped to minimise
+ *                         the halo shipped to each slave
+ *   -t, --threaded        receive tiles, remap them and write finished rows
+ *                         on separate threads, so the output is written
+ *                         while the remaining slaves are still working
+ *   -e, --engine <name>   convolution engine: "separable" (the default) runs
+ *                         a horizontal then a vertical pass of the one
+ *                         dimensional kernel; "direct" applies the square
+ *                         kernel in one pass, as earlier releases did;
+ *                         "fft" runs both passes of the one dimensional
+ *                         kernel by FFT, which suits the largest stdevs
+ *   -E, --edge <mode>     what the kernel reads beyond the edge of the
+ *                         image: "clamp" (the default) repeats the edge
+ *                         pixel, "mirror" reflects the image about it,
+ *                         "wrap" takes the opposite edge as if the image
+ *                         were tiled and "zero" reads black, darkening the
+ *                         borders as earlier releases did
+ *   -P, --pyramid <tol>   blur through a gaussian pyramid, which also
+ *                         allows stdevs beyond MAX_STDEV (up to
+ *                         MAX_PYRAMID_STDEV): the image is halved by a
+ *                         binomial filter as many times as keeps the stdev
+ *                         within tol of the one asked for (e.g. 0.05 for
+ *                         5%), blurred at the coarsest level with a
+ *                         tabulated kernel and interpolated back up
+ *                         bilinearly; tiles then start on multiples of
+ *                         2^levels pixels, so they agree with the whole
+ *                         image (an image smaller than their halo is
+ *                         blurred as a single tile)
+ *   -j, --threads <n>     threads to blur with on a single host (default:
+ *                         one per rank)
+ *   -m, --mpi             distribute tiles over MPI even when every rank is
+ *                         on the same host; otherwise such jobs are blurred
+ *                         by a pool of threads on the master, reading the
+ *                         source bitmap in place (as gaussianlocal does),
+ *                         unless an option below that needs MPI is given
+ *   -z, --compress        encode tiles in transit with the in-tree codec
+ *                         (byte planes, delta and run length coding) and
+ *                         report the ratio and time saved
+ *   -D, --direct          write the output with O_DIRECT through an aligned
+ *                         buffer, keeping very large outputs out of the page
+ *                         cache (ignored with -t, which writes rows as they
+ *                         finish, and for stdout)
+ *   -r, --report <file>   time the read, tile, send, convolve, receive,
+ *                         remap and write phases on every rank and write
+ *                         the min, median and max across ranks, the bytes
+ *                         each phase moved and the peak resident set of
+ *                         each rank to file (CSV if it ends in ".csv",
+ *                         JSON otherwise)
+ *   -C, --counters        add hardware performance counters (cycles,
+ *                         instructions, L1 data, last level cache and data
+ *                         TLB misses) read around the convolution and the
+ *                         tile copies to the report, per rank and phase,
+ *                         with IPC, bytes per cycle and misses per pixel;
+ *                         where perf_event_open is refused (e.g. in a
+ *                         container) the report keeps the times alone
+ *   -T, --timeline <file> record each send, receipt, convolution, remap and
+ *                         write on every rank (with the completions seen
+ *                         by MPI_Testany) and write them to file as Chrome
+ *                         trace events, with the clock of every rank
+ *                         aligned to the master's; open the file with
+ *                         chrome://tracing or ui.perfetto.dev
+ *   -v, --verbose         print the number of tiles each image is divided
+ *                         into, and the aggregate throughput of the slaves
+ *                         and the time left every PROGRESS_REPORT_S while
+ *                         tiles are in flight
+ *   -b, --batch <file>    blur every image listed in the manifest, one
+ *                         "<input> <output> <stdev>" per line, in a single
+ *                         job; small images are blurred whole on one slave,
+ *                         large ones tiled across all of them, and the
+ *                         images per second and bytes per second reported;
+ *                         an optional fourth column ("auto", "whole" or
+ *                         "tiled") forces either path, and an edge mode
+ *                         (as for -E) may follow the stdev too
+ *   -s, --serve <socket>  keep the ranks running as a service, accepting
+ *                         manifest lines on a Unix domain socket and
+ *                         replying "ok <seconds>" or "error <seconds>" per
+ *                         job; the line "quit" stops the service
+ *   -u, --tune <profile>  time every engine, 1, 2, 4... threads and (with
+ *                         two or more slaves) both decompositions over a
+ *                         grid of image sizes and stdevs on this machine,
+ *                         and write the fastest of each to the tuning
+ *                         profile <profile> (an output, read back by -U)
+ *   -U, --tuned <file>    choose the engine (per tile, on each slave), the
+ *                         decomposition and the thread count from a tuning
+ *                         profile, wherever -e, -d or -j is not given
  *
  * bugs:
  *   - pencils_large.bmp is _not_ processing for some unknown reason.
@@ -48,6 +166,12 @@
  *     ourselves.
  *   - if the output file does not exist, the output file will be created and
  *     become locked throughout the duration of the application.
+ *   - "-" as the input or output filename reads the image from stdin or
+ *     writes it to stdout, so the blur can sit in a shell pipeline, e.g.
+ *        decode | mpirun -np 4 gaussianmpi - - 3 | upload
+ *     Progress and trace messages always go to stderr.
+ *   - While slaves are working the master prints their aggregate throughput
+ *     and the time left every few seconds, on stderr.
  *   - needs some imrovement on memory management.  It would be more efficient
  *     to load the source bitmap one line at a time.  In addition, we could
  *     also read the kernel more efficiently and write to the destination
@@ -55,9 +179,13 @@
  */
 int main(int argc, char **argv) {
 
-  int me, nproc;
-  int nslave, stdev, kern_size, kern_orig;
-  char fn_in[MAX_PATH], fn_out[MAX_PATH];
+  int me, nproc, e;
+  int nslave, kern_size, align, levels, calib_stdev;
+  double *rates;
+  JOB_OPTS opts;
+
+  rates = NULL;
+  e = EXIT_SUCCESS;
 
   /* Initialize MPI */
   if (init_mpi(&argc, &argv, &me, &nproc) != MPI_SUCCESS) {
@@ -68,26 +196,96 @@ int main(int argc, char **argv) {
   nslave = nproc - 1;
 
   /* Parse arguments and make calculations required for all nodes */
-  if (parse_args(argc, argv, &stdev, fn_in, fn_out) == EXIT_FAILURE) {
+  if (parse_args(argc, argv, &opts) == EXIT_FAILURE) {
     MPI_Abort(MPI_COMM_WORLD, MPI_ABORT_FAIL_CODE);
     return EXIT_FAILURE;
   }
-  if (init_kern(stdev, &kern_size, &kern_orig) == EXIT_FAILURE) {
+  timeline_on = opts.fn_timeline[0] != '\0';
+  counters_on = opts.counters;
+  progress_on = opts.verbose;
+  timing_on = opts.fn_report[0] != '\0' || timeline_on;
+
+  /* Tuning times this machine and writes the profile, blurring nothing */
+  if (opts.fn_tune[0] != '\0') {
+    e = do_tune(me, nproc, &opts);
+    MPI_Finalize();
+    return e;
+  }
+  if (opts.fn_tuned[0] != '\0' && tune_load(me, opts.fn_tuned)
+      != EXIT_SUCCESS) {
     MPI_Abort(MPI_COMM_WORLD, MPI_ABORT_FAIL_CODE);
     return EXIT_FAILURE;
   }
 
+  /* With every rank on one host, blur in shared memory on the master
+   * rather than shipping tiles between processes */
+  if (!is_distributed(&opts) && is_single_node(nproc)) {
+    if (me == MPI_MASTER_NODE) {
+      e = do_local(&opts, opts.threads ? opts.threads : nproc);
+    }
+    if (timing_report(me, nproc, opts.fn_report) != EXIT_SUCCESS ||
+        timeline_write(me, nproc, opts.fn_timeline) != EXIT_SUCCESS) {
+      e = EXIT_FAILURE;
+    }
+    MPI_Finalize();
+    return e;
+  }
+
+  /* A single image is blurred by one kernel (batches and services size
+   * theirs per job), and through a pyramid at its coarsest level */
+  kern_size = 0;
+  align = 1;
+  calib_stdev = opts.stdev;
+  if (opts.fn_manifest[0] == '\0' && opts.fn_socket[0] == '\0') {
+    if (init_extent(opts.stdev, opts.pyramid, &kern_size, &align)
+        == EXIT_FAILURE) {
+      MPI_Abort(MPI_COMM_WORLD, MPI_ABORT_FAIL_CODE);
+      return EXIT_FAILURE;
+    }
+    if (opts.pyramid > 0) {
+      planPyramid(opts.stdev, opts.pyramid, &levels, &calib_stdev);
+    }
+  }
+
+  /* Measure (or look up) the relative speed of every rank */
+  if (opts.calibrate) {
+    rates = calloc(nproc, sizeof(double));
+    if (rates == NULL || calibrate(me, nproc, calib_stdev, opts.engine,
+          opts.fn_profile, rates) != EXIT_SUCCESS) {
+      MPI_Abort(MPI_COMM_WORLD, MPI_ABORT_FAIL_CODE);
+      return EXIT_FAILURE;
+    }
+  }
+
   /* Distribute work */
-  if (me == MPI_MASTER_NODE) {
-    if (do_master(nslave, kern_size, fn_in, fn_out) != EXIT_SUCCESS) {
+  if (me == MPI_MASTER_NODE && opts.fn_manifest[0] != '\0') {
+    e = do_batch(nslave, &opts);
+  } else if (me == MPI_MASTER_NODE && opts.fn_socket[0] != '\0') {
+    e = do_serve(nslave, &opts);
+  } else if (me == MPI_MASTER_NODE) {
+    /* Slave ranks start at 1, so skip the master's rate */
+    if (do_master(nslave, kern_size, align, &opts, rates ? rates + 1 : NULL)
+        != EXIT_SUCCESS) {
       MPI_Abort(MPI_COMM_WORLD, MPI_ABORT_FAIL_CODE);
       return EXIT_FAILURE;
     }
   } else {
-    do_slave(me, kern_size, stdev, kern_orig);
+    do_slave(me, &opts);
     // TODO: Return
   }
+  /* Pixel buffers pooled for the next image are no longer wanted */
+  BMP_DrainPool();
+
+  if (opts.codec != CODEC_NONE) codec_report(me);
+  if (timing_report(me, nproc, opts.fn_report) != EXIT_SUCCESS ||
+      timeline_write(me, nproc, opts.fn_timeline) != EXIT_SUCCESS) {
+    e = EXIT_FAILURE;
+  }
+
+  free(rates);
 
   MPI_Finalize();
 
+  return e;
+
 }
@@ -1,12 +1,67 @@
+#define _GNU_SOURCE   /* O_DIRECT */
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <errno.h>
+#include <getopt.h>
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
+#include "batch.h"
+#include "codec.h"
 #include "const.h"
+#include "gaussianLib.h"
 #include "init.h"
+#include "timing.h"
+#ifndef GAUSSIAN_LOCAL
 #include "mpi.h"
+#endif
+
+/* parse_edge
+ * -------
+ * parses the name of an edge mode
+ *
+ * name:  "zero", "clamp", "mirror" or "wrap"
+ *
+ * returns: the edge mode (see EDGE_ZERO), or -1 if unknown
+ *
+ */
+int parse_edge(const char *name) {
+
+  if (strcmp(name, "zero") == 0) return EDGE_ZERO;
+  if (strcmp(name, "clamp") == 0) return EDGE_CLAMP;
+  if (strcmp(name, "mirror") == 0) return EDGE_MIRROR;
+  if (strcmp(name, "wrap") == 0) return EDGE_WRAP;
+  return -1;
+
+}
+
+/* check_stdev
+ * -------
+ * checks a standard deviation is in range, and that a pyramid can blur it
+ * within the tolerance if one is to be used
+ *
+ * stdev:     standard deviation
+ * pyramid:   pyramid tolerance (0 for none)
+ *
+ * returns: success or failure
+ *
+ */
+int check_stdev(int stdev, float pyramid) {
+
+  int max, levels, coarse;
+
+  max = pyramid > 0 ? MAX_PYRAMID_STDEV : MAX_STDEV;
+  if (stdev < MIN_STDEV || stdev > max) {
+    fprintf(stderr, EM_STDEV_RANGE, MIN_STDEV, max);
+    return EXIT_FAILURE;
+  }
+  if (pyramid > 0) return planPyramid(stdev, pyramid, &levels, &coarse);
+
+  return EXIT_SUCCESS;
+
+}
 
 /* parse_args
  * -------
@@ -14,55 +69,318 @@
  *
  * argc:  as per main
  * argv:  as per main
- * stdev: standard deviation value (see MIN_STDEV, MAX_STDEV)
- * fn_in: filename for image input
- * fn_out: filename for image output
+ * opts:  job configuration (out)
+ *
+ * options:
+ *   -c, --calibrate       size tiles by the measured throughput of each rank
+ *   -p, --profile <file>  calibration profile to load, or to save if it does
+ *                         not yet exist (implies --calibrate)
+ *   -d, --decomp <layout> tile layout: "band" (default) or "block"
+ *   -e, --engine <name>   convolution engine: "separable" (default),
+ *                         "direct" or "fft"
+ *   -E, --edge <mode>     what pixels beyond the edge of the image are taken
+ *                         to be: "clamp" (default, the nearest edge pixel),
+ *                         "mirror", "wrap" or "zero"
+ *   -P, --pyramid <tol>   blur through a gaussian pyramid where that keeps the
+ *                         standard deviation within tol of the one asked
+ *                         for (e.g. 0.05), allowing up to MAX_PYRAMID_STDEV
+ *   -j, --threads <n>     threads to blur with when running in a single
+ *                         process (default: one per rank, or per processor
+ *                         for gaussianlocal)
+ *   -m, --mpi             always distribute tiles over MPI, even if every
+ *                         rank shares a host
+ *   -t, --threaded        receive, remap and write on separate threads
+ *   -z, --compress        encode tiles in transit
+ *   -D, --direct          write output files with O_DIRECT, bypassing the
+ *                         page cache (where the file system allows it)
+ *   -r, --report <file>   time each phase on every rank and write a summary
+ *                         to file, as CSV if its name ends in ".csv" and as
+ *                         JSON otherwise
+ *   -C, --counters        read hardware performance counters around the
+ *                         convolution and tile copies (needs --report)
+ *   -T, --timeline <file> record every phase on every rank and write them
+ *                         to file as Chrome trace events
+ *   -v, --verbose         print the tiles each image is divided into, and
+ *                         the throughput and time left of the tiles in
+ *                         flight as they are blurred
+ *   -b, --batch <file>    process every image listed in a manifest, in place
+ *                         of the input, output and stdev arguments
+ *   -s, --serve <socket>  accept jobs on a Unix domain socket until told
+ *                         to quit, in place of the positional arguments
+ *   -u, --tune <profile>  benchmark the engines, thread counts and
+ *                         decompositions on this machine and write them to
+ *                         the tuning profile <profile>, in place of the
+ *                         positional arguments
+ *   -U, --tuned <file>    choose whichever of the engine, decomposition and
+ *                         thread count is not given from a tuning profile
  *
  * returns: success or failure
  *
  */
-int parse_args(int argc, char **argv, int *stdev, char *fn_in, char *fn_out) {
+int parse_args(int argc, char **argv, JOB_OPTS *opts) {
+
+  int c, stdev_in;
+  char *end;
+  static struct option long_opts[] = {
+    { "calibrate", no_argument,       NULL, 'c' },
+    { "profile",   required_argument, NULL, 'p' },
+    { "decomp",    required_argument, NULL, 'd' },
+    { "engine",    required_argument, NULL, 'e' },
+    { "edge",      required_argument, NULL, 'E' },
+    { "pyramid",   required_argument, NULL, 'P' },
+    { "compress",  no_argument,       NULL, 'z' },
+    { "threaded",  no_argument,       NULL, 't' },
+    { "threads",   required_argument, NULL, 'j' },
+    { "mpi",       no_argument,       NULL, 'm' },
+    { "batch",     required_argument, NULL, 'b' },
+    { "serve",     required_argument, NULL, 's' },
+    { "direct",    no_argument,       NULL, 'D' },
+    { "report",    required_argument, NULL, 'r' },
+    { "timeline",  required_argument, NULL, 'T' },
+    { "counters",  no_argument,       NULL, 'C' },
+    { "verbose",   no_argument,       NULL, 'v' },
+    { "tune",      required_argument, NULL, 'u' },
+    { "tuned",     required_argument, NULL, 'U' },
+    { NULL,        0,                 NULL, 0 }
+  };
 
-  int stdev_in;
+  memset(opts, 0, sizeof(*opts));
+  opts->engine = ENGINE_SEPARABLE;
+  opts->edge = EDGE_CLAMP;
 
-  stdev_in = atoi(argv[3]);
+  while ((c = getopt_long(argc, argv, "b:CcDd:E:e:j:mP:p:r:s:T:tU:u:vz",
+          long_opts, NULL)) != -1) {
+    switch (c) {
+      case 'b':
+        if (strlen(optarg) >= MAX_PATH) {
+          fprintf(stderr, EM_MAX_PATH, MAX_PATH);
+          return EXIT_FAILURE;
+        }
+        strcpy(opts->fn_manifest, optarg);
+        break;
+      case 's':
+        if (strlen(optarg) >= MAX_PATH) {
+          fprintf(stderr, EM_MAX_PATH, MAX_PATH);
+          return EXIT_FAILURE;
+        }
+        strcpy(opts->fn_socket, optarg);
+        break;
+      case 'c':
+        opts->calibrate = 1;
+        break;
+      case 'C':
+        opts->counters = 1;
+        break;
+      case 'D':
+        opts->direct = 1;
+        break;
+      case 'p':
+        if (strlen(optarg) >= MAX_PATH) {
+          fprintf(stderr, EM_MAX_PATH, MAX_PATH);
+          return EXIT_FAILURE;
+        }
+        strcpy(opts->fn_profile, optarg);
+        opts->calibrate = 1;
+        break;
+      case 'r':
+        if (strlen(optarg) >= MAX_PATH) {
+          fprintf(stderr, EM_MAX_PATH, MAX_PATH);
+          return EXIT_FAILURE;
+        }
+        strcpy(opts->fn_report, optarg);
+        break;
+      case 'T':
+        if (strlen(optarg) >= MAX_PATH) {
+          fprintf(stderr, EM_MAX_PATH, MAX_PATH);
+          return EXIT_FAILURE;
+        }
+        strcpy(opts->fn_timeline, optarg);
+        break;
+      case 'u':
+        if (strlen(optarg) >= MAX_PATH) {
+          fprintf(stderr, EM_MAX_PATH, MAX_PATH);
+          return EXIT_FAILURE;
+        }
+        strcpy(opts->fn_tune, optarg);
+        break;
+      case 'U':
+        if (strlen(optarg) >= MAX_PATH) {
+          fprintf(stderr, EM_MAX_PATH, MAX_PATH);
+          return EXIT_FAILURE;
+        }
+        strcpy(opts->fn_tuned, optarg);
+        break;
+      case 'd':
+        if (strcmp(optarg, "band") == 0) {
+          opts->decomp = DECOMP_BAND;
+        } else if (strcmp(optarg, "block") == 0) {
+          opts->decomp = DECOMP_BLOCK;
+        } else {
+          fprintf(stderr, EM_DECOMP, optarg);
+          return EXIT_FAILURE;
+        }
+        opts->chosen |= CHOSE_DECOMP;
+        break;
+      case 'e':
+        if ((opts->engine = engineByName(optarg)) < 0) {
+          fprintf(stderr, EM_ENGINE, optarg);
+          return EXIT_FAILURE;
+        }
+        opts->chosen |= CHOSE_ENGINE;
+        break;
+      case 'E':
+        if ((opts->edge = parse_edge(optarg)) < 0) {
+          fprintf(stderr, EM_EDGE, optarg);
+          return EXIT_FAILURE;
+        }
+        break;
+      case 'P':
+        opts->pyramid = strtod(optarg, &end);
+        if (*end != '\0' || !(opts->pyramid > 0 && opts->pyramid < 1)) {
+          fprintf(stderr, EM_PYRAMID, optarg);
+          return EXIT_FAILURE;
+        }
+        break;
+      case 'j':
+        opts->threads = atoi(optarg);
+        if (opts->threads < 1) {
+          fprintf(stderr, EM_THREADS, optarg);
+          return EXIT_FAILURE;
+        }
+        opts->chosen |= CHOSE_THREADS;
+        break;
+      case 'm':
+        opts->mpi = 1;
+        break;
+      case 't':
+        opts->threaded = 1;
+        break;
+      case 'v':
+        opts->verbose = 1;
+        break;
+      case 'z':
+        opts->codec = CODEC_PACK;
+        break;
+      default:
+        fprintf(stderr, EM_USAGE);
+        return EXIT_FAILURE;
+    }
+  }
+
+  /* Counters are only written to the report */
+  if (opts->counters && opts->fn_report[0] == '\0') {
+    fprintf(stderr, EM_COUNTERS_REPORT);
+    return EXIT_FAILURE;
+  }
+
+  /* Tuning blurs only synthetic images */
+  if (opts->fn_tune[0] != '\0') {
+    if (argc != optind || opts->fn_manifest[0] != '\0' ||
+        opts->fn_socket[0] != '\0') {
+      fprintf(stderr, EM_USAGE);
+      return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+  }
+
+  /* Images and their standard deviations come from the manifest (or the
+   * service socket) */
+  if (opts->fn_manifest[0] != '\0' || opts->fn_socket[0] != '\0') {
+    if (argc != optind ||
+        (opts->fn_manifest[0] != '\0' && opts->fn_socket[0] != '\0')) {
+      fprintf(stderr, EM_USAGE);
+      return EXIT_FAILURE;
+    }
+    /* Calibration measures a single kernel size */
+    if (opts->calibrate) {
+      fprintf(stderr, EM_BATCH_OPTION);
+      return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+  }
+
+  /* Remaining positional arguments: input, output, standard deviation */
+  if (argc - optind != 3) {
+    fprintf(stderr, EM_USAGE);
+    return EXIT_FAILURE;
+  }
+  argv += optind;
+
+  stdev_in = atoi(argv[2]);
 
   /* Check range of standard deviaion */
-  if (stdev_in < MIN_STDEV || stdev_in > MAX_STDEV) {
-    fprintf(stderr, EM_STDEV_RANGE, MIN_STDEV, MAX_STDEV);
+  if (check_stdev(stdev_in, opts->pyramid) != EXIT_SUCCESS) {
     return EXIT_FAILURE;
   }
-  *stdev = atoi(argv[3]);
+  opts->stdev = stdev_in;
 
   /* Check filenames are present */
-  if (strlen(fn_in) > MAX_PATH || strlen(fn_out) > MAX_PATH) {
+  if (strlen(argv[0]) >= MAX_PATH || strlen(argv[1]) >= MAX_PATH) {
     fprintf(stderr, EM_MAX_PATH, MAX_PATH);
     return EXIT_FAILURE;
   }
 
-  strcpy(fn_in, argv[1]);
-  strcpy(fn_out, argv[2]);
+  strcpy(opts->fn_in, argv[0]);
+  strcpy(opts->fn_out, argv[1]);
 
   return EXIT_SUCCESS;
 
 }
 
+/* is_distributed
+ * ------
+ * Check whether a job asks for anything only the MPI path provides: batch
+ * or service mode, calibration, the transport codec, threaded receipt,
+ * a block layout or --mpi itself.
+ *
+ * opts:  job configuration
+ *
+ * return: non zero if the job must be distributed over MPI
+ *
+ */
+int is_distributed(JOB_OPTS *opts) {
+
+  return opts->mpi || opts->fn_manifest[0] != '\0' ||
+    opts->fn_socket[0] != '\0' || opts->calibrate ||
+    opts->codec != CODEC_NONE || opts->threaded ||
+    opts->decomp != DECOMP_BAND;
+
+}
+
 /* init_out
  * ------
  * Initialize the output file by providing an up front lock.
  *
  * NOTE: If the file exists, the open will fail.  If the file does not exist,
- * it will be created.
+ * it will be created.  STDIO_PATH names stdout, which is duplicated so the
+ * caller may close it like any other handle.
+ *
+ * O_DIRECT is set once the file is open, so a file system that refuses it
+ * leaves an ordinary handle rather than an error.  qdbmp notices the flag
+ * and writes through an aligned buffer, clearing it and finishing buffered
+ * should the file system take the flag but then reject the writes (EINVAL,
+ * e.g. tmpfs or some FUSE and NFS mounts); writers of partial files must not
+ * ask for it.
  *
  * fn_out: output filename
+ * direct: bypass the page cache if possible
  * f_out:  file handle pointer id
  *
  * return: success or fail
  *
  */
-int init_out(char *fn_out, int *f_out) {
+int init_out(char *fn_out, int direct, int *f_out) {
+
+  int modes, perms, fh, flags;
 
-  int modes, perms, fh;
+  if (strcmp(fn_out, STDIO_PATH) == 0) {
+    if ((fh = dup(STDOUT_FILENO)) < 0) {
+      fprintf(stderr, EM_IO_DEST_FAIL, strerror(errno));
+      return EXIT_FAILURE;
+    }
+    *f_out = fh;
+    return EXIT_SUCCESS;
+  }
 
   modes = O_CREAT | O_WRONLY;
 #ifndef DEBUG
@@ -74,6 +392,13 @@ int init_out(char *fn_out, int *f_out) {
     fprintf(stderr, EM_IO_DEST_FAIL, strerror(errno));
     return EXIT_FAILURE;
   }
+  if (direct && ((flags = fcntl(fh, F_GETFL)) < 0 ||
+        fcntl(fh, F_SETFL, flags | O_DIRECT) < 0)) {
+#ifdef TRACE
+    fprintf(stderr, "O_DIRECT unavailable for %s: %s\n", fn_out,
+      strerror(errno));
+#endif
+  }
 
   *f_out =  fh;
 
@@ -85,7 +410,7 @@ int init_out(char *fn_out, int *f_out) {
  * ------
  * Initialize the source bitmap and gather some reusable metadata
  *
- * fn_in:   input file name
+ * fn_in:   input file name, or STDIO_PATH to read from stdin
  * src:     bitmap of source image
  * width:   width of source image (pixels)
  * height:  height of source image (pixels)
@@ -97,14 +422,21 @@ int init_out(char *fn_out, int *f_out) {
 int init_bmp(char *fn_in, BMP **src, UINT *width, UINT *height, USHORT *depth) {
 
   int e;
+  double t;
 
   e = BMP_OK;
 
   /* Load image into BMP structure */
-  *src = BMP_ReadFile(fn_in);
+  TIMING_START(t);
+  if (strcmp(fn_in, STDIO_PATH) == 0) {
+    *src = BMP_ReadStream(STDIN_FILENO);
+  } else {
+    *src = BMP_ReadFile(fn_in);
+  }
   if ((e = BMP_CheckError(stderr)) != BMP_OK) {
     return EXIT_FAILURE;
   }
+  TIMING_STOP(PHASE_READ, t, BMP_GetDataSize(*src));
 
   /* Get image metadata */
   *height = BMP_GetHeight(*src);
@@ -127,10 +459,15 @@ int init_bmp(char *fn_in, BMP **src, UINT *width, UINT *height, USHORT *depth) {
 
 }
 
+#ifndef GAUSSIAN_LOCAL
 /* init_mpi
  * ------
  * Iniitalize the MPI framework
  *
+ * NOTE: The master may run helper threads, but only ever makes MPI calls
+ * from the main thread.  An MPI library that cannot support even that
+ * (MPI_THREAD_FUNNELED) fails here, rather than once the threads start.
+ *
  * argc:  as per main (MPIs arguments will be withdrawn)
  * argv:  as per main (MPIs arguments will be withdrawn)
  * me:    current rank
@@ -141,12 +478,18 @@ int init_bmp(char *fn_in, BMP **src, UINT *width, UINT *height, USHORT *depth) {
  */
 int init_mpi(int *argc, char ***argv, int *me, int *nproc) {
 
-  int e;
+  int e, provided;
 
-  if ((e = MPI_Init(argc, argv)) != MPI_SUCCESS) {
+  if ((e = MPI_Init_thread(argc, argv, MPI_THREAD_FUNNELED, &provided))
+      != MPI_SUCCESS) {
     fprintf(stderr, "Failed to initialize MPI\n");
     return e;
   }
+  if (provided < MPI_THREAD_FUNNELED) {
+    fprintf(stderr, "MPI provides no thread support (MPI_THREAD_FUNNELED)\n");
+    MPI_Finalize();
+    return MPI_ERR_OTHER;
+  }
   if ((e = MPI_Comm_rank(MPI_COMM_WORLD, me)) != MPI_SUCCESS) {
     fprintf(stderr, "Failed to establish MPI Comm rank\n");
     return e;
@@ -159,3 +502,28 @@ int init_mpi(int *argc, char ***argv, int *me, int *nproc) {
   return e;
 
 }
+
+/* is_single_node
+ * ------
+ * Check whether every rank runs on the same host (and so could share
+ * memory rather than pass tiles).  Must be called by all ranks.
+ *
+ * nproc: number of processes, including master
+ *
+ * return: non zero if all ranks share a host
+ *
+ */
+int is_single_node(int nproc) {
+
+  MPI_Comm node;
+  int nlocal;
+
+  MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL,
+    &node);
+  MPI_Comm_size(node, &nlocal);
+  MPI_Comm_free(&node);
+
+  return nlocal == nproc;
+
+}
+#endif /* GAUSSIAN_LOCAL */
@@ -1,11 +1,54 @@
 #ifndef _INIT_H_
 #define _INIT_H_
 
+#include "const.h"
+#include "mosaic.h"
 #include "qdbmp.h"
 
+/* Options given on the command line, which a tuning profile leaves be */
+#define CHOSE_ENGINE    1
+#define CHOSE_DECOMP    2
+#define CHOSE_THREADS   4
+
+/*
+ * Job configuration parsed from the command line.  Every rank parses the
+ * same arguments, so all fields are known to all nodes.
+ */
+typedef struct job_opts {
+  int stdev;                    /* Standard deviation of the blur */
+  char fn_in[MAX_PATH];         /* Input image filename */
+  char fn_out[MAX_PATH];        /* Output image filename */
+  int calibrate;                /* Size tiles by measured rank throughput */
+  char fn_profile[MAX_PATH];    /* Calibration profile (empty for none) */
+  int decomp;                   /* Tile layout (see DECOMP_BAND) */
+  int codec;                    /* Transport codec (see CODEC_NONE) */
+  int threaded;                 /* Receive, remap and write concurrently */
+  int engine;                   /* Convolution engine (see ENGINE_DIRECT) */
+  int edge;                     /* Edge mode (see EDGE_ZERO) */
+  float pyramid;                /* Pyramid tolerance (0: blur directly) */
+  int threads;                  /* Threads for a single process (0: auto) */
+  int mpi;                      /* Distribute over MPI even on one host */
+  char fn_manifest[MAX_PATH];   /* Batch manifest (empty for one image) */
+  char fn_socket[MAX_PATH];     /* Service socket (empty unless serving) */
+  int direct;                   /* Write output files with O_DIRECT */
+  char fn_report[MAX_PATH];     /* Timing report (empty for none) */
+  char fn_timeline[MAX_PATH];   /* Chrome trace events (empty for none) */
+  int counters;                 /* Report hardware performance counters */
+  int verbose;                  /* Print the live progress of tiles */
+  char fn_tune[MAX_PATH];       /* Tuning profile to write (empty unless
+                                   tuning) */
+  char fn_tuned[MAX_PATH];      /* Tuning profile to choose by (empty for
+                                   none) */
+  int chosen;                   /* Options given (see CHOSE_ENGINE) */
+} JOB_OPTS;
+
 int init_bmp(char *fn_in, BMP **src, UINT *width, UINT *height, USHORT *depth);
 int init_mpi(int *argc, char ***argv, int *me, int *nproc);
-int init_out(char *fn_out, int *f_out);
-int parse_args(int argc, char **argv, int *stdev, char *fn_in, char *fn_out);
+int is_single_node(int nproc);
+int init_out(char *fn_out, int direct, int *f_out);
+int is_distributed(JOB_OPTS *opts);
+int parse_edge(const char *name);
+int check_stdev(int stdev, float pyramid);
+int parse_args(int argc, char **argv, JOB_OPTS *opts);
 
 #endif /* _INIT_H_ */
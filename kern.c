@@ -1,6 +1,11 @@
+#include <math.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include "gaussianLib.h"
 #include "kern.h"
+#ifndef KERN_NO_TABLE
+#include "kern_table.h"
+#endif
 
 /*
  *  Initialize the given kernel values based on the set parameters
@@ -17,6 +22,37 @@ int init_kern(int stdev, int *kern_size, int *kern_orig) {
 
 }
 
+/*
+ *  Initialize the size of the kernel a blur reads with, and the multiple
+ *  that tiles must start on, for a blur that may go through a pyramid
+ *  (see planPyramid)
+ *  ------
+ *  stdev:      standard deviation of the blur
+ *  tolerance:  error allowed in the standard deviation by a pyramid, relative
+ *              to it (0 for a plain blur)
+ *  kern_size:  width of the pixels an output pixel depends on (out)
+ *  align:      multiple of pixels that tiles must start on (out)
+ *
+ *  returns: success, or failure if no pyramid is within the tolerance
+ */
+int init_extent(int stdev, float tolerance, int *kern_size, int *align) {
+
+  int levels, coarse, orig;
+
+  *align = 1;
+  if (tolerance <= 0) return init_kern(stdev, kern_size, &orig);
+
+  if (planPyramid(stdev, tolerance, &levels, &coarse) != EXIT_SUCCESS) {
+    return EXIT_FAILURE;
+  }
+  if (levels == 0) return init_kern(coarse, kern_size, &orig);
+  *kern_size = 2 * pyramidHalo(levels, coarse) + 1;
+  *align = 1 << levels;
+
+  return EXIT_SUCCESS;
+
+}
+
 /*
  *  Initialize an 2-dimensional array of float values.
  *  ------
@@ -56,3 +92,160 @@ float **init_kern_data(int kern_size) {
   return data;
 
 }
+
+/*
+ *  Free a 2-dimensional array of float values.
+ *  ------
+ *  data:       kernel data as returned by init_kern_data
+ *  kern_size:  width and height of the kernel
+ */
+void free_kern_data(float **data, int kern_size) {
+
+  int i;
+
+  if (data == NULL) return;
+
+  for (i = 0; i < kern_size; i++) {
+    free(data[i]);
+  }
+  free(data);
+
+}
+
+/*
+ *  Compute the weights of a kernel, for standard deviations that are not
+ *  tabulated (and to generate the table).  Each weight of the folded form is
+ *  evaluated exactly as generateGaussianKernel evaluates it, and colour_max
+ *  summed over the whole square in the same order, but only a quarter of the
+ *  square is evaluated and no square is allocated.
+ *  ------
+ *  kern:   kernel with its standard deviation, size and origin set
+ *
+ *  returns: success, or failure if out of memory
+ */
+static int generate_kern(KERNEL *kern) {
+
+  int a, b, i, j, o;
+  float sd, colour_max, *half, *row;
+  int *half_fixed, *row_fixed;
+  double sqrt_term, sum;
+
+  o = kern->orig;
+  half = malloc((o + 1) * (o + 1) * sizeof(float));
+  row = malloc(kern->size * sizeof(float));
+  half_fixed = malloc((o + 1) * (o + 1) * sizeof(int));
+  row_fixed = malloc(kern->size * sizeof(int));
+  kern->half = half;
+  kern->row = row;
+  kern->half_fixed = half_fixed;
+  kern->row_fixed = row_fixed;
+  if (half == NULL || row == NULL || half_fixed == NULL ||
+      row_fixed == NULL) {
+    fprintf(stderr, EM_KERN_OOM);
+    return EXIT_FAILURE;
+  }
+
+  sd = kern->stdev;
+  sqrt_term = sqrt(2.0 * M_PI * ((double) sd * sd));
+  for (b = 0; b <= o; b++) {
+    for (a = 0; a <= o; a++) {
+      half[b * (o + 1) + a] = (1.0 / sqrt_term) *
+        exp(-(((double) a * a + (double) b * b) / (2.0 * ((double) sd * sd))));
+    }
+  }
+  for (colour_max = 0, i = 0; i < kern->size; i++) {
+    for (j = 0; j < kern->size; j++) {
+      colour_max = colour_max + (half[abs(o - j) * (o + 1) + abs(o - i)] *
+        255.0);
+    }
+  }
+  kern->colour_max = colour_max;
+
+  /* The square kernel is the outer product of this row with itself */
+  for (sum = 0, i = 0; i < kern->size; i++) {
+    sum += exp(-((double) (i - o) * (i - o)) / (2.0 * sd * sd));
+  }
+  for (i = 0; i < kern->size; i++) {
+    row[i] = exp(-((double) (i - o) * (i - o)) / (2.0 * sd * sd)) / sum;
+  }
+
+  for (i = 0; i < (o + 1) * (o + 1); i++) {
+    half_fixed[i] = lround(half[i] * 255.0 / colour_max *
+      (1 << KERN_FIXED_BITS));
+  }
+  for (i = 0; i < kern->size; i++) {
+    row_fixed[i] = lround(row[i] * (1 << KERN_FIXED_BITS));
+  }
+
+  return EXIT_SUCCESS;
+
+}
+
+/*
+ *  Create a kernel for the given standard deviation, in both the folded form
+ *  (one contiguous quarter of the square kernel, which is symmetric about
+ *  its origin on both axes) and the one dimensional form used by separable
+ *  passes.  Standard deviations in kern_table.h (generated at build time by
+ *  kerngen) are looked up; any other is computed.
+ *  ------
+ *  stdev:  standard deviation of the blur
+ *
+ *  returns: the kernel, or NULL on failure
+ */
+KERNEL *create_kernel(int stdev) {
+
+  KERNEL *kern;
+#ifndef KERN_NO_TABLE
+  const KERN_ENTRY *entry;
+#endif
+
+  kern = calloc(1, sizeof(KERNEL));
+  if (kern == NULL) {
+    fprintf(stderr, EM_KERN_OOM);
+    return NULL;
+  }
+  kern->stdev = stdev;
+  init_kern(stdev, &kern->size, &kern->orig);
+
+#ifndef KERN_NO_TABLE
+  if (stdev >= KERN_TABLE_MIN && stdev <= KERN_TABLE_MAX) {
+    entry = &kern_table[stdev - KERN_TABLE_MIN];
+    kern->colour_max = entry->colour_max;
+    kern->half = entry->half;
+    kern->row = entry->row;
+    kern->half_fixed = entry->half_fixed;
+    kern->row_fixed = entry->row_fixed;
+    kern->tabulated = 1;
+    return kern;
+  }
+#endif
+
+  if (generate_kern(kern) != EXIT_SUCCESS) {
+    free_kernel(kern);
+    return NULL;
+  }
+
+  return kern;
+
+}
+
+/*
+ *  Free a kernel created by create_kernel.
+ *  ------
+ *  kern:   kernel (may be NULL)
+ */
+void free_kernel(KERNEL *kern) {
+
+  if (kern == NULL) return;
+
+  freeKernelSpectra(kern);
+  free_kern_data(kern->data, kern->size);
+  if (!kern->tabulated) {
+    free((void *) kern->half);
+    free((void *) kern->row);
+    free((void *) kern->half_fixed);
+    free((void *) kern->row_fixed);
+  }
+  free(kern);
+
+}
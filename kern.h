@@ -3,12 +3,51 @@
 
 /* Constants */
 #define KERNEL_DIMENSION_SD     3
+#define KERN_FIXED_BITS         24    /* Fraction bits of fixed point weights */
 
 /* Error messages */
 #define EM_KERN_OOM       "Kernel failed to initialize float array\n"
 
+/*
+ * Gaussian kernel in the forms used by the convolution engines
+ */
+typedef struct kernel {
+  int stdev;
+  int size;                   /* Width and height of the kernel */
+  int orig;                   /* Origin (and radius) of the kernel */
+  float **data;               /* Square kernel of any weights, or NULL */
+  const float *half;          /* Square kernel folded about its origin:
+                                 (orig + 1)^2 weights, half[b * (orig + 1)
+                                 + a] for the pixels at (+-a, +-b) */
+  float colour_max;           /* Sum of the square kernel, times 255 */
+  const float *row;           /* One dimensional kernel, summing to one */
+  const int *half_fixed;      /* half / colour_max * 255, in fixed point */
+  const int *row_fixed;       /* row, in fixed point */
+  int tabulated;              /* Weights are in kern_table.h, not owned */
+  struct kernel_spectrum *spectra;  /* Cached by the FFT engine */
+} KERNEL;
+
+/*
+ * Precomputed weights of one standard deviation (see kerngen.c)
+ */
+typedef struct kern_entry {
+  float colour_max;
+  const float *half;
+  const float *row;
+  const int *half_fixed;
+  const int *row_fixed;
+} KERN_ENTRY;
+
+KERNEL *create_kernel(int stdev);
+
+void free_kernel(KERNEL *kern);
+
 float **init_kern_data(int kern_size);
 
+void free_kern_data(float **data, int kern_size);
+
 int init_kern(int stdev, int *kern_size, int *kern_orig);
 
+int init_extent(int stdev, float tolerance, int *kern_size, int *align);
+
 #endif /* _KERN_H_ */
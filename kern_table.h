@@ -0,0 +1,7373 @@
+#ifndef _KERN_TABLE_H_
+#define _KERN_TABLE_H_
+
+/*
+ * kern_table.h
+ * ------------
+ * Gaussian kernels for standard deviations 1 to 20, generated by
+ * kerngen (see kerngen.c): do not edit.
+ *
+ */
+
+#define KERN_TABLE_MIN 1
+#define KERN_TABLE_MAX 20
+
+static const float kern_half_1[] = {
+  3.98942292e-01f, 2.41970718e-01f, 5.39909676e-02f, 4.43184841e-03f, 2.41970718e-01f, 1.46762669e-01f,
+  3.27471755e-02f, 2.68805190e-03f, 5.39909676e-02f, 3.27471755e-02f, 7.30688265e-03f, 5.99785475e-04f,
+  4.43184841e-03f, 2.68805190e-03f, 5.99785475e-04f, 4.92333893e-05f
+};
+static const float kern_row_1[] = {
+  4.43304796e-03f, 5.40055819e-02f, 2.42036223e-01f, 3.99050266e-01f, 2.42036223e-01f, 5.40055819e-02f,
+  4.43304796e-03f
+};
+static const int kern_half_fixed_1[] = {
+  2671622, 1620421, 361565, 29679, 1620421, 982835, 219300, 18001, 361565, 219300, 48932, 4017,
+  29679, 18001, 4017, 330
+};
+static const int kern_row_fixed_1[] = {
+  74374, 906063, 4060694, 6694953, 4060694, 906063, 74374
+};
+
+static const float kern_half_2[] = {
+  1.99471146e-01f, 1.76032662e-01f, 1.20985359e-01f, 6.47588000e-02f, 2.69954838e-02f, 8.76415055e-03f,
+  2.21592421e-03f, 1.76032662e-01f, 1.55348286e-01f, 1.06769204e-01f, 5.71494401e-02f, 2.38234308e-02f,
+  7.73433549e-03f, 1.95554621e-03f, 1.20985359e-01f, 1.06769204e-01f, 7.33813345e-02f, 3.92781980e-02f,
+  1.63735878e-02f, 5.31572569e-03f, 1.34402595e-03f, 6.47588000e-02f, 5.71494401e-02f, 3.92781980e-02f,
+  2.10241042e-02f, 8.76415055e-03f, 2.84530292e-03f, 7.19405245e-04f, 2.69954838e-02f, 2.38234308e-02f,
+  1.63735878e-02f, 8.76415055e-03f, 3.65344132e-03f, 1.18609879e-03f, 2.99892738e-04f, 8.76415055e-03f,
+  7.73433549e-03f, 5.31572569e-03f, 2.84530292e-03f, 1.18609879e-03f, 3.85069899e-04f, 9.73609131e-05f,
+  2.21592421e-03f, 1.95554621e-03f, 1.34402595e-03f, 7.19405245e-04f, 2.99892738e-04f, 9.73609131e-05f,
+  2.46166946e-05f
+};
+static const float kern_row_2[] = {
+  2.21819594e-03f, 8.77313502e-03f, 2.70231571e-02f, 6.48251846e-02f, 1.21109389e-01f, 1.76213115e-01f,
+  1.99675635e-01f, 1.76213115e-01f, 1.21109389e-01f, 6.48251846e-02f, 2.70231571e-02f, 8.77313502e-03f,
+  2.21819594e-03f
+};
+static const int kern_half_fixed_2[] = {
+  668914, 590314, 405717, 217164, 90528, 29390, 7431, 590314, 520950, 358044, 191647, 79890,
+  25937, 6558, 405717, 358044, 246080, 131717, 54908, 17826, 4507, 217164, 191647, 131717,
+  70503, 29390, 9542, 2412, 90528, 79890, 54908, 29390, 12252, 3978, 1006, 29390,
+  25937, 17826, 9542, 3978, 1291, 326, 7431, 6558, 4507, 2412, 1006, 326,
+  83
+};
+static const int kern_row_fixed_2[] = {
+  37215, 147189, 453373, 1087586, 2031878, 2956366, 3350001, 2956366, 2031878, 1087586, 453373, 147189,
+  37215
+};
+
+static const float kern_half_3[] = {
+  1.32980764e-01f, 1.25794411e-01f, 1.06482670e-01f, 8.06569085e-02f, 5.46700247e-02f, 3.31590474e-02f,
+  1.79969892e-02f, 8.74063000e-03f, 3.79866199e-03f, 1.47728284e-03f, 1.25794411e-01f, 1.18996412e-01f,
+  1.00728288e-01f, 7.62981623e-02f, 5.17156273e-02f, 3.13671120e-02f, 1.70244221e-02f, 8.26828182e-03f,
+  3.59338033e-03f, 1.39744964e-03f, 1.06482670e-01f, 1.00728288e-01f, 8.52646530e-02f, 6.45850003e-02f,
+  4.37763333e-02f, 2.65516881e-02f, 1.44108618e-02f, 6.99894922e-03f, 3.04173073e-03f, 1.18291564e-03f,
+  8.06569085e-02f, 7.62981623e-02f, 6.45850003e-02f, 4.89208885e-02f, 3.31590474e-02f, 2.01119781e-02f,
+  1.09157255e-02f, 5.30145969e-03f, 2.30400497e-03f, 8.96017300e-04f, 5.46700247e-02f, 5.17156273e-02f,
+  4.37763333e-02f, 3.31590474e-02f, 2.24755183e-02f, 1.36320917e-02f, 7.39878323e-03f, 3.59338033e-03f,
+  1.56167662e-03f, 6.07329130e-04f, 3.31590474e-02f, 3.13671120e-02f, 2.65516881e-02f, 2.01119781e-02f,
+  1.36320917e-02f, 8.26828182e-03f, 4.48758900e-03f, 2.17949529e-03f, 9.47204768e-04f, 3.68363719e-04f,
+  1.79969892e-02f, 1.70244221e-02f, 1.44108618e-02f, 1.09157255e-02f, 7.39878323e-03f, 4.48758900e-03f,
+  2.43562763e-03f, 1.18291564e-03f, 5.14092972e-04f, 1.99928487e-04f, 8.74063000e-03f, 8.26828182e-03f,
+  6.99894922e-03f, 5.30145969e-03f, 3.59338033e-03f, 2.17949529e-03f, 1.18291564e-03f, 5.74508740e-04f,
+  2.49680452e-04f, 9.70996261e-05f, 3.79866199e-03f, 3.59338033e-03f, 3.04173073e-03f, 2.30400497e-03f,
+  1.56167662e-03f, 9.47204768e-04f, 5.14092972e-04f, 2.49680452e-04f, 1.08510685e-04f, 4.21993245e-05f,
+  1.47728284e-03f, 1.39744964e-03f, 1.18291564e-03f, 8.96017300e-04f, 6.07329130e-04f, 3.68363719e-04f,
+  1.99928487e-04f, 9.70996261e-05f, 4.21993245e-05f, 1.64111298e-05f
+};
+static const float kern_row_3[] = {
+  1.47945166e-03f, 3.80423898e-03f, 8.75346269e-03f, 1.80234108e-02f, 3.32077295e-02f, 5.47502898e-02f,
+  8.07753280e-02f, 1.06638998e-01f, 1.25979096e-01f, 1.33175999e-01f, 1.25979096e-01f, 1.06638998e-01f,
+  8.07753280e-02f, 5.47502898e-02f, 3.32077295e-02f, 1.80234108e-02f, 8.75346269e-03f, 3.80423898e-03f,
+  1.47945166e-03f
+};
+static const int kern_half_fixed_3[] = {
+  297558, 281478, 238266, 180478, 122330, 74197, 40270, 19558, 8500, 3306, 281478, 266267,
+  225390, 170725, 115719, 70187, 38094, 18501, 8041, 3127, 238266, 225390, 190788, 144516,
+  97954, 59412, 32246, 15661, 6806, 2647, 180478, 170725, 144516, 109466, 74197, 45003,
+  24425, 11863, 5155, 2005, 122330, 115719, 97954, 74197, 50291, 30503, 16556, 8041,
+  3494, 1359, 74197, 70187, 59412, 45003, 30503, 18501, 10041, 4877, 2119, 824,
+  40270, 38094, 32246, 24425, 16556, 10041, 5450, 2647, 1150, 447, 19558, 18501,
+  15661, 11863, 8041, 4877, 2647, 1286, 559, 217, 8500, 8041, 6806, 5155,
+  3494, 2119, 1150, 559, 243, 94, 3306, 3127, 2647, 2005, 1359, 824,
+  447, 217, 94, 37
+};
+static const int kern_row_fixed_3[] = {
+  24821, 63825, 146859, 302383, 557133, 918557, 1355185, 1789106, 2113579, 2234323, 2113579, 1789106,
+  1355185, 918557, 557133, 302383, 146859, 63825, 24821
+};
+
+static const float kern_half_4[] = {
+  9.97355729e-02f, 9.66670290e-02f, 8.80163312e-02f, 7.52843544e-02f, 6.04926795e-02f, 4.56622727e-02f,
+  3.23794000e-02f, 2.15693302e-02f, 1.34977419e-02f, 7.93491304e-03f, 4.38207528e-03f, 2.27339054e-03f,
+  1.10796210e-03f, 9.66670290e-02f, 9.36928988e-02f, 8.53083506e-02f, 7.29681030e-02f, 5.86315170e-02f,
+  4.42573912e-02f, 3.13831903e-02f, 2.09057108e-02f, 1.30824596e-02f, 7.69078126e-03f, 4.24725283e-03f,
+  2.20344565e-03f, 1.07387372e-03f, 8.80163312e-02f, 8.53083506e-02f, 7.76741430e-02f, 6.64382130e-02f,
+  5.33846021e-02f, 4.02968116e-02f, 2.85747200e-02f, 1.90348662e-02f, 1.19117154e-02f, 7.00253621e-03f,
+  3.86716775e-03f, 2.00626021e-03f, 9.77773103e-04f, 7.52843544e-02f, 7.29681030e-02f, 6.64382130e-02f,
+  5.68276159e-02f, 4.56622727e-02f, 3.44676897e-02f, 2.44412534e-02f, 1.62813850e-02f, 1.01886299e-02f,
+  5.98958647e-03f, 3.30776395e-03f, 1.71604531e-03f, 8.36333667e-04f, 6.04926795e-02f, 5.86315170e-02f,
+  5.33846021e-02f, 4.56622727e-02f, 3.66906673e-02f, 2.76955683e-02f, 1.96390990e-02f, 1.30824596e-02f,
+  8.18679389e-03f, 4.81276819e-03f, 2.65786285e-03f, 1.37888116e-03f, 6.72012975e-04f, 4.56622727e-02f,
+  4.42573912e-02f, 4.02968116e-02f, 3.44676897e-02f, 2.76955683e-02f, 2.09057108e-02f, 1.48243690e-02f,
+  9.87515878e-03f, 6.17971644e-03f, 3.63286794e-03f, 2.00626021e-03f, 1.04083412e-03f, 5.07262012e-04f,
+  3.23794000e-02f, 3.13831903e-02f, 2.85747200e-02f, 2.44412534e-02f, 1.96390990e-02f, 1.48243690e-02f,
+  1.05120521e-02f, 7.00253621e-03f, 4.38207528e-03f, 2.57608900e-03f, 1.42265146e-03f, 7.38061848e-04f,
+  3.59702623e-04f, 2.15693302e-02f, 2.09057108e-02f, 1.90348662e-02f, 1.62813850e-02f, 1.30824596e-02f,
+  9.87515878e-03f, 7.00253621e-03f, 4.66469489e-03f, 2.91909138e-03f, 1.71604531e-03f, 9.47690220e-04f,
+  4.91655199e-04f, 2.39613611e-04f, 1.34977419e-02f, 1.30824596e-02f, 1.19117154e-02f, 1.01886299e-02f,
+  8.18679389e-03f, 6.17971644e-03f, 4.38207528e-03f, 2.91909138e-03f, 1.82672066e-03f, 1.07387372e-03f,
+  5.93049394e-04f, 3.07669950e-04f, 1.49946369e-04f, 7.93491304e-03f, 7.69078126e-03f, 7.00253621e-03f,
+  5.98958647e-03f, 4.81276819e-03f, 3.63286794e-03f, 2.57608900e-03f, 1.71604531e-03f, 1.07387372e-03f,
+  6.31297764e-04f, 3.48635745e-04f, 1.80869843e-04f, 8.81489177e-05f, 4.38207528e-03f, 4.24725283e-03f,
+  3.86716775e-03f, 3.30776395e-03f, 2.65786285e-03f, 2.00626021e-03f, 1.42265146e-03f, 9.47690220e-04f,
+  5.93049394e-04f, 3.48635745e-04f, 1.92534950e-04f, 9.98858159e-05f, 4.86804565e-05f, 2.27339054e-03f,
+  2.20344565e-03f, 2.00626021e-03f, 1.71604531e-03f, 1.37888116e-03f, 1.04083412e-03f, 7.38061848e-04f,
+  4.91655199e-04f, 3.07669950e-04f, 1.80869843e-04f, 9.98858159e-05f, 5.18200759e-05f, 2.52550890e-05f,
+  1.10796210e-03f, 1.07387372e-03f, 9.77773103e-04f, 8.36333667e-04f, 6.72012975e-04f, 5.07262012e-04f,
+  3.59702623e-04f, 2.39613611e-04f, 1.49946369e-04f, 8.81489177e-05f, 4.86804565e-05f, 2.52550890e-05f,
+  1.23083473e-05f
+};
+static const float kern_row_4[] = {
+  1.10988156e-03f, 2.27732910e-03f, 4.38966695e-03f, 7.94866029e-03f, 1.35211255e-02f, 2.16066986e-02f,
+  3.24354954e-02f, 4.57413793e-02f, 6.05974831e-02f, 7.54147843e-02f, 8.81688148e-02f, 9.68345031e-02f,
+  9.99083593e-02f, 9.68345031e-02f, 8.81688148e-02f, 7.54147843e-02f, 6.05974831e-02f, 4.57413793e-02f,
+  3.24354954e-02f, 2.16066986e-02f, 1.35211255e-02f, 7.94866029e-03f, 4.38966695e-03f, 2.27732910e-03f,
+  1.10988156e-03f
+};
+static const int kern_half_fixed_4[] = {
+  167465, 162312, 147787, 126409, 101573, 76671, 54368, 36217, 22664, 13323, 7358, 3817,
+  1860, 162312, 157319, 143240, 122520, 98447, 74312, 52695, 35103, 21967, 12914, 7132,
+  3700, 1803, 147787, 143240, 130422, 111556, 89637, 67662, 47979, 31961, 20001, 11758,
+  6493, 3369, 1642, 126409, 122520, 111556, 95419, 76671, 57874, 41039, 27338, 17108,
+  10057, 5554, 2881, 1404, 101573, 98447, 89637, 76671, 61607, 46503, 32976, 21967,
+  13746, 8081, 4463, 2315, 1128, 76671, 74312, 67662, 57874, 46503, 35103, 24891,
+  16581, 10376, 6100, 3369, 1748, 852, 54368, 52695, 47979, 41039, 32976, 24891,
+  17651, 11758, 7358, 4325, 2389, 1239, 604, 36217, 35103, 31961, 27338, 21967,
+  16581, 11758, 7832, 4901, 2881, 1591, 826, 402, 22664, 21967, 20001, 17108,
+  13746, 10376, 7358, 4901, 3067, 1803, 996, 517, 252, 13323, 12914, 11758,
+  10057, 8081, 6100, 4325, 2881, 1803, 1060, 585, 304, 148, 7358, 7132,
+  6493, 5554, 4463, 3369, 2389, 1591, 996, 585, 323, 168, 82, 3817,
+  3700, 3369, 2881, 2315, 1748, 1239, 826, 517, 304, 168, 87, 42,
+  1860, 1803, 1642, 1404, 1128, 852, 604, 402, 252, 148, 82, 42,
+  21
+};
+static const int kern_row_fixed_4[] = {
+  18621, 38207, 73646, 133356, 226847, 362500, 544177, 767413, 1016657, 1265250, 1479227, 1624613,
+  1676184, 1624613, 1479227, 1265250, 1016657, 767413, 544177, 362500, 226847, 133356, 73646, 38207,
+  18621
+};
+
+static const float kern_half_5[] = {
+  7.97884539e-02f, 7.82085359e-02f, 7.36540258e-02f, 6.66449219e-02f, 5.79383112e-02f, 4.83941436e-02f,
+  3.88372093e-02f, 2.99454927e-02f, 2.21841671e-02f, 1.57900322e-02f, 1.07981935e-02f, 7.09491875e-03f,
+  4.47890628e-03f, 2.71659391e-03f, 1.58309028e-03f, 8.86369671e-04f, 7.82085359e-02f, 7.66599029e-02f,
+  7.21955821e-02f, 6.53252602e-02f, 5.67910559e-02f, 4.74358760e-02f, 3.80681828e-02f, 2.93525327e-02f,
+  2.17448901e-02f, 1.54773677e-02f, 1.05843749e-02f, 6.95442967e-03f, 4.39021783e-03f, 2.66280165e-03f,
+  1.55174301e-03f, 8.68818373e-04f, 7.36540258e-02f, 7.21955821e-02f, 6.79912344e-02f, 6.15210161e-02f,
+  5.34838028e-02f, 4.46734279e-02f, 3.58512625e-02f, 2.76431739e-02f, 2.04785671e-02f, 1.45760365e-02f,
+  9.96798836e-03f, 6.54943520e-03f, 4.13455162e-03f, 2.50773225e-03f, 1.46137655e-03f, 8.18222354e-04f,
+  6.66449219e-02f, 6.53252602e-02f, 6.15210161e-02f, 5.56665175e-02f, 4.83941436e-02f, 4.04221863e-02f,
+  3.24395671e-02f, 2.50125788e-02f, 1.85297746e-02f, 1.31889433e-02f, 9.01940931e-03f, 5.92617411e-03f,
+  3.74109671e-03f, 2.26908992e-03f, 1.32230821e-03f, 7.40358199e-04f, 5.79383112e-02f, 5.67910559e-02f,
+  5.34838028e-02f, 4.83941436e-02f, 4.20718491e-02f, 3.51413600e-02f, 2.82016043e-02f, 2.17448901e-02f,
+  1.61090121e-02f, 1.14659164e-02f, 7.84109812e-03f, 5.15196845e-03f, 3.25235329e-03f, 1.97265204e-03f,
+  1.14955951e-03f, 6.43636507e-04f, 4.83941436e-02f, 4.74358760e-02f, 4.46734279e-02f, 4.04221863e-02f,
+  3.51413600e-02f, 2.93525327e-02f, 2.35559586e-02f, 1.81628596e-02f, 1.34553770e-02f, 9.57713835e-03f,
+  6.54943520e-03f, 4.30328585e-03f, 2.71659391e-03f, 1.64769741e-03f, 9.60192818e-04f, 5.37610380e-04f,
+  3.88372093e-02f, 3.80681828e-02f, 3.58512625e-02f, 3.24395671e-02f, 2.82016043e-02f, 2.35559586e-02f,
+  1.89040992e-02f, 1.45760365e-02f, 1.07981935e-02f, 7.68583361e-03f, 5.25604514e-03f, 3.45346751e-03f,
+  2.18011765e-03f, 1.32230821e-03f, 7.70572806e-04f, 4.31442430e-04f, 2.99454927e-02f, 2.93525327e-02f,
+  2.76431739e-02f, 2.50125788e-02f, 2.17448901e-02f, 1.81628596e-02f, 1.45760365e-02f, 1.12388758e-02f,
+  8.32596421e-03f, 5.92617411e-03f, 4.05268185e-03f, 2.66280165e-03f, 1.68098311e-03f, 1.01956783e-03f,
+  5.94151381e-04f, 3.32664378e-04f, 2.21841671e-02f, 2.17448901e-02f, 2.04785671e-02f, 1.85297746e-02f,
+  1.61090121e-02f, 1.34553770e-02f, 1.07981935e-02f, 8.32596421e-03f, 6.16802601e-03f, 4.39021783e-03f,
+  3.00230063e-03f, 1.97265204e-03f, 1.24530296e-03f, 7.55314424e-04f, 4.40158154e-04f, 2.46443844e-04f,
+  1.57900322e-02f, 1.54773677e-02f, 1.45760365e-02f, 1.31889433e-02f, 1.14659164e-02f, 9.57713835e-03f,
+  7.68583361e-03f, 5.92617411e-03f, 4.39021783e-03f, 3.12482682e-03f, 2.13694852e-03f, 1.40407518e-03f,
+  8.86369671e-04f, 5.37610380e-04f, 3.13291501e-04f, 1.75411406e-04f, 1.07981935e-02f, 1.05843749e-02f,
+  9.96798836e-03f, 9.01940931e-03f, 7.84109812e-03f, 6.54943520e-03f, 5.25604514e-03f, 4.05268185e-03f,
+  3.00230063e-03f, 2.13694852e-03f, 1.46137655e-03f, 9.60192818e-04f, 6.06154033e-04f, 3.67650995e-04f,
+  2.14247979e-04f, 1.19957091e-04f, 7.09491875e-03f, 6.95442967e-03f, 6.54943520e-03f, 5.92617411e-03f,
+  5.15196845e-03f, 4.30328585e-03f, 3.45346751e-03f, 2.66280165e-03f, 1.97265204e-03f, 1.40407518e-03f,
+  9.60192818e-04f, 6.30891649e-04f, 3.98271572e-04f, 2.41563917e-04f, 1.40770950e-04f, 7.88174293e-05f,
+  4.47890628e-03f, 4.39021783e-03f, 4.13455162e-03f, 3.74109671e-03f, 3.25235329e-03f, 2.71659391e-03f,
+  2.18011765e-03f, 1.68098311e-03f, 1.24530296e-03f, 8.86369671e-04f, 6.06154033e-04f, 3.98271572e-04f,
+  2.51422316e-04f, 1.52495355e-04f, 8.88663999e-05f, 4.97561523e-05f, 2.71659391e-03f, 2.66280165e-03f,
+  2.50773225e-03f, 2.26908992e-03f, 1.97265204e-03f, 1.64769741e-03f, 1.32230821e-03f, 1.01956783e-03f,
+  7.55314424e-04f, 5.37610380e-04f, 3.67650995e-04f, 2.41563917e-04f, 1.52495355e-04f, 9.24931082e-05f,
+  5.39001958e-05f, 3.01786313e-05f, 1.58309028e-03f, 1.55174301e-03f, 1.46137655e-03f, 1.32230821e-03f,
+  1.14955951e-03f, 9.60192818e-04f, 7.70572806e-04f, 5.94151381e-04f, 4.40158154e-04f, 3.13291501e-04f,
+  2.14247979e-04f, 1.40770950e-04f, 8.88663999e-05f, 5.39001958e-05f, 3.14102435e-05f, 1.75865443e-05f,
+  8.86369671e-04f, 8.68818373e-04f, 8.18222354e-04f, 7.40358199e-04f, 6.43636507e-04f, 5.37610380e-04f,
+  4.31442430e-04f, 3.32664378e-04f, 2.46443844e-04f, 1.75411406e-04f, 1.19957091e-04f, 7.88174293e-05f,
+  4.97561523e-05f, 3.01786313e-05f, 1.75865443e-05f, 9.84667804e-06f
+};
+static const float kern_row_5[] = {
+  8.88058508e-04f, 1.58610661e-03f, 2.72176997e-03f, 4.48743999e-03f, 7.10843690e-03f, 1.08187674e-02f,
+  1.58201177e-02f, 2.22264361e-02f, 3.00025493e-02f, 3.89112085e-02f, 4.84863520e-02f, 5.80487028e-02f,
+  6.67719021e-02f, 7.37943649e-02f, 7.83575550e-02f, 7.99404830e-02f, 7.83575550e-02f, 7.37943649e-02f,
+  6.67719021e-02f, 5.80487028e-02f, 4.84863520e-02f, 3.89112085e-02f, 3.00025493e-02f, 2.22264361e-02f,
+  1.58201177e-02f, 1.08187674e-02f, 7.10843690e-03f, 4.48743999e-03f, 2.72176997e-03f, 1.58610661e-03f,
+  8.88058508e-04f
+};
+static const int kern_half_fixed_5[] = {
+  107214, 105091, 98971, 89553, 77854, 65029, 52187, 40239, 29810, 21218, 14510, 9534,
+  6018, 3650, 2127, 1191, 105091, 103011, 97012, 87780, 76312, 63741, 51154, 39442,
+  29219, 20797, 14223, 9345, 5899, 3578, 2085, 1167, 98971, 97012, 91362, 82668,
+  71868, 60029, 48175, 37145, 27518, 19586, 13394, 8801, 5556, 3370, 1964, 1099,
+  89553, 87780, 82668, 74801, 65029, 54317, 43590, 33610, 24899, 17722, 12120, 7963,
+  5027, 3049, 1777, 995, 77854, 76312, 71868, 65029, 56533, 47221, 37895, 29219,
+  21646, 15407, 10536, 6923, 4370, 2651, 1545, 865, 65029, 63741, 60029, 54317,
+  47221, 39442, 31653, 24406, 18080, 12869, 8801, 5782, 3650, 2214, 1290, 722,
+  52187, 51154, 48175, 43590, 37895, 31653, 25402, 19586, 14510, 10328, 7063, 4641,
+  2929, 1777, 1035, 580, 40239, 39442, 37145, 33610, 29219, 24406, 19586, 15102,
+  11188, 7963, 5446, 3578, 2259, 1370, 798, 447, 29810, 29219, 27518, 24899,
+  21646, 18080, 14510, 11188, 8288, 5899, 4034, 2651, 1673, 1015, 591, 331,
+  21218, 20797, 19586, 17722, 15407, 12869, 10328, 7963, 5899, 4199, 2871, 1887,
+  1191, 722, 421, 236, 14510, 14223, 13394, 12120, 10536, 8801, 7063, 5446,
+  4034, 2871, 1964, 1290, 815, 494, 288, 161, 9534, 9345, 8801, 7963,
+  6923, 5782, 4641, 3578, 2651, 1887, 1290, 848, 535, 325, 189, 106,
+  6018, 5899, 5556, 5027, 4370, 3650, 2929, 2259, 1673, 1191, 815, 535,
+  338, 205, 119, 67, 3650, 3578, 3370, 3049, 2651, 2214, 1777, 1370,
+  1015, 722, 494, 325, 205, 124, 72, 41, 2127, 2085, 1964, 1777,
+  1545, 1290, 1035, 798, 591, 421, 288, 189, 119, 72, 42, 24,
+  1191, 1167, 1099, 995, 865, 722, 580, 447, 331, 236, 161, 106,
+  67, 41, 24, 13
+};
+static const int kern_row_fixed_5[] = {
+  14899, 26610, 45664, 75287, 119260, 181509, 265418, 372898, 503359, 652822, 813466, 973896,
+  1120247, 1238064, 1314622, 1341179, 1314622, 1238064, 1120247, 973896, 813466, 652822, 503359, 372898,
+  265418, 181509, 119260, 75287, 45664, 26610, 14899
+};
+
+static const float kern_half_6[] = {
+  6.64903820e-02f, 6.55732825e-02f, 6.28972054e-02f, 5.86775541e-02f, 5.32413349e-02f, 4.69853133e-02f,
+  4.03284542e-02f, 3.36664468e-02f, 2.73350123e-02f, 2.15862654e-02f, 1.65795237e-02f, 1.23851942e-02f,
+  8.99849460e-03f, 6.35877065e-03f, 4.37031500e-03f, 2.92138336e-03f, 1.89933099e-03f, 1.20101660e-03f,
+  7.38641422e-04f, 6.55732825e-02f, 6.46688417e-02f, 6.20296709e-02f, 5.78682236e-02f, 5.25069833e-02f,
+  4.63372506e-02f, 3.97722088e-02f, 3.32020894e-02f, 2.69579832e-02f, 2.12885290e-02f, 1.63508430e-02f,
+  1.22143663e-02f, 8.87437910e-03f, 6.27106475e-03f, 4.31003561e-03f, 2.88108923e-03f, 1.87313370e-03f,
+  1.18445116e-03f, 7.28453393e-04f, 6.28972054e-02f, 6.20296709e-02f, 5.94982058e-02f, 5.55065870e-02f,
+  5.03641441e-02f, 4.44462001e-02f, 3.81490812e-02f, 3.18470933e-02f, 2.58578137e-02f, 2.04197336e-02f,
+  1.56835560e-02f, 1.17158918e-02f, 8.51221103e-03f, 6.01513917e-03f, 4.13414091e-03f, 2.76351022e-03f,
+  1.79669017e-03f, 1.13611307e-03f, 6.98724820e-04f, 5.86775541e-02f, 5.78682236e-02f, 5.55065870e-02f,
+  5.17827608e-02f, 4.69853133e-02f, 4.14643921e-02f, 3.55897360e-02f, 2.97105350e-02f, 2.41230633e-02f,
+  1.90498121e-02f, 1.46313775e-02f, 1.09298956e-02f, 7.94114359e-03f, 5.61159523e-03f, 3.85678932e-03f,
+  2.57811183e-03f, 1.67615374e-03f, 1.05989340e-03f, 6.51848735e-04f, 5.32413349e-02f, 5.25069833e-02f,
+  5.03641441e-02f, 4.69853133e-02f, 4.26323265e-02f, 3.76228988e-02f, 3.22925001e-02f, 2.69579832e-02f,
+  2.18881667e-02f, 1.72849298e-02f, 1.32758440e-02f, 9.91728809e-03f, 7.20543088e-03f, 5.09170536e-03f,
+  3.49947461e-03f, 2.33926089e-03f, 1.52086536e-03f, 9.61698941e-04f, 5.91457821e-04f, 4.69853133e-02f,
+  4.63372506e-02f, 4.44462001e-02f, 4.14643921e-02f, 3.76228988e-02f, 3.32020894e-02f, 2.84980331e-02f,
+  2.37903371e-02f, 1.93162393e-02f, 1.52538978e-02f, 1.17158918e-02f, 8.75197630e-03f, 6.35877065e-03f,
+  4.49341442e-03f, 3.08827544e-03f, 2.06439057e-03f, 1.34215900e-03f, 8.48696334e-04f, 5.21959679e-04f,
+  4.03284542e-02f, 3.97722088e-02f, 3.81490812e-02f, 3.55897360e-02f, 3.22925001e-02f, 2.84980331e-02f,
+  2.44604442e-02f, 2.04197336e-02f, 1.65795237e-02f, 1.30927321e-02f, 1.00559890e-02f, 7.51199992e-03f,
+  5.45786275e-03f, 3.85678932e-03f, 2.65072985e-03f, 1.77190860e-03f, 1.15200249e-03f, 7.28453393e-04f,
+  4.48008650e-04f, 3.36664468e-02f, 3.32020894e-02f, 3.18470933e-02f, 2.97105350e-02f, 2.69579832e-02f,
+  2.37903371e-02f, 2.04197336e-02f, 1.70465223e-02f, 1.38406903e-02f, 1.09298956e-02f, 8.39480292e-03f,
+  6.27106475e-03f, 4.55625821e-03f, 3.21967201e-03f, 2.21284595e-03f, 1.47920044e-03f, 9.61698941e-04f,
+  6.08117494e-04f, 3.74000461e-04f, 2.73350123e-02f, 2.69579832e-02f, 2.58578137e-02f, 2.41230633e-02f,
+  2.18881667e-02f, 1.93162393e-02f, 1.65795237e-02f, 1.38406903e-02f, 1.12377591e-02f, 8.87437910e-03f,
+  6.81604585e-03f, 5.09170536e-03f, 3.69939161e-03f, 2.61416868e-03f, 1.79669017e-03f, 1.20101660e-03f,
+  7.80838309e-04f, 4.93752712e-04f, 3.03664565e-04f, 2.15862654e-02f, 2.12885290e-02f, 2.04197336e-02f,
+  1.90498121e-02f, 1.72849298e-02f, 1.52538978e-02f, 1.30927321e-02f, 1.09298956e-02f, 8.87437910e-03f,
+  7.00803427e-03f, 5.38258301e-03f, 4.02088370e-03f, 2.92138336e-03f, 2.06439057e-03f, 1.41883350e-03f,
+  9.48434346e-04f, 6.16622507e-04f, 3.89913010e-04f, 2.39801753e-04f, 1.65795237e-02f, 1.63508430e-02f,
+  1.56835560e-02f, 1.46313775e-02f, 1.32758440e-02f, 1.17158918e-02f, 1.00559890e-02f, 8.39480292e-03f,
+  6.81604585e-03f, 5.38258301e-03f, 4.13414091e-03f, 3.08827544e-03f, 2.24379450e-03f, 1.58557354e-03f,
+  1.08974765e-03f, 7.28453393e-04f, 4.73602384e-04f, 2.99476145e-04f, 1.84181859e-04f, 1.23851942e-02f,
+  1.22143663e-02f, 1.17158918e-02f, 1.09298956e-02f, 9.91728809e-03f, 8.75197630e-03f, 7.51199992e-03f,
+  6.27106475e-03f, 5.09170536e-03f, 4.02088370e-03f, 3.08827544e-03f, 2.30699591e-03f, 1.67615374e-03f,
+  1.18445116e-03f, 8.14060564e-04f, 5.44167415e-04f, 3.53789277e-04f, 2.23713927e-04f, 1.37587078e-04f,
+  8.99849460e-03f, 8.87437910e-03f, 8.51221103e-03f, 7.94114359e-03f, 7.20543088e-03f, 6.35877065e-03f,
+  5.45786275e-03f, 4.55625821e-03f, 3.69939161e-03f, 2.92138336e-03f, 2.24379450e-03f, 1.67615374e-03f,
+  1.21781381e-03f, 8.60566041e-04f, 5.91457821e-04f, 3.95366253e-04f, 2.57046486e-04f, 1.62539931e-04f,
+  9.99642434e-05f, 6.35877065e-03f, 6.27106475e-03f, 6.01513917e-03f, 5.61159523e-03f, 5.09170536e-03f,
+  4.49341442e-03f, 3.85678932e-03f, 3.21967201e-03f, 2.61416868e-03f, 2.06439057e-03f, 1.58557354e-03f,
+  1.18445116e-03f, 8.60566041e-04f, 6.08117494e-04f, 4.17952630e-04f, 2.79384869e-04f, 1.81641473e-04f,
+  1.14858558e-04f, 7.06395585e-05f, 4.37031500e-03f, 4.31003561e-03f, 4.13414091e-03f, 3.85678932e-03f,
+  3.49947461e-03f, 3.08827544e-03f, 2.65072985e-03f, 2.21284595e-03f, 1.79669017e-03f, 1.41883350e-03f,
+  1.08974765e-03f, 8.14060564e-04f, 5.91457821e-04f, 4.17952630e-04f, 2.87254370e-04f, 1.92018240e-04f,
+  1.24840226e-04f, 7.89410551e-05f, 4.85498131e-05f, 2.92138336e-03f, 2.88108923e-03f, 2.76351022e-03f,
+  2.57811183e-03f, 2.33926089e-03f, 2.06439057e-03f, 1.77190860e-03f, 1.47920044e-03f, 1.20101660e-03f,
+  9.48434346e-04f, 7.28453393e-04f, 5.44167415e-04f, 3.95366253e-04f, 2.79384869e-04f, 1.92018240e-04f,
+  1.28356623e-04f, 8.34507809e-05f, 5.27689881e-05f, 3.24536377e-05f, 1.89933099e-03f, 1.87313370e-03f,
+  1.79669017e-03f, 1.67615374e-03f, 1.52086536e-03f, 1.34215900e-03f, 1.15200249e-03f, 9.61698941e-04f,
+  7.80838309e-04f, 6.16622507e-04f, 4.73602384e-04f, 3.53789277e-04f, 2.57046486e-04f, 1.81641473e-04f,
+  1.24840226e-04f, 8.34507809e-05f, 5.42553425e-05f, 3.43076426e-05f, 2.10996623e-05f, 1.20101660e-03f,
+  1.18445116e-03f, 1.13611307e-03f, 1.05989340e-03f, 9.61698941e-04f, 8.48696334e-04f, 7.28453393e-04f,
+  6.08117494e-04f, 4.93752712e-04f, 3.89913010e-04f, 2.99476145e-04f, 2.23713927e-04f, 1.62539931e-04f,
+  1.14858558e-04f, 7.89410551e-05f, 5.27689881e-05f, 3.43076426e-05f, 2.16939789e-05f, 1.33420899e-05f,
+  7.38641422e-04f, 7.28453393e-04f, 6.98724820e-04f, 6.51848735e-04f, 5.91457821e-04f, 5.21959679e-04f,
+  4.48008650e-04f, 3.74000461e-04f, 3.03664565e-04f, 2.39801753e-04f, 1.84181859e-04f, 1.37587078e-04f,
+  9.99642434e-05f, 7.06395585e-05f, 4.85498131e-05f, 3.24536377e-05f, 2.10996623e-05f, 1.33420899e-05f,
+  8.20556488e-06f
+};
+static const float kern_row_6[] = {
+  7.40138348e-04f, 1.20345061e-03f, 1.90318027e-03f, 2.92730401e-03f, 4.37917188e-03f, 6.37165736e-03f,
+  9.01673082e-03f, 1.24102943e-02f, 1.66131239e-02f, 2.16300134e-02f, 2.73904111e-02f, 3.37346755e-02f,
+  4.04101834e-02f, 4.70805354e-02f, 5.33492342e-02f, 5.87964728e-02f, 6.30246773e-02f, 6.57061785e-02f,
+  6.66251332e-02f, 6.57061785e-02f, 6.30246773e-02f, 5.87964728e-02f, 5.33492342e-02f, 4.70805354e-02f,
+  4.04101834e-02f, 3.37346755e-02f, 2.73904111e-02f, 2.16300134e-02f, 1.66131239e-02f, 1.24102943e-02f,
+  9.01673082e-03f, 6.37165736e-03f, 4.37917188e-03f, 2.92730401e-03f, 1.90318027e-03f, 1.20345061e-03f,
+  7.40138348e-04f
+};
+static const int kern_half_fixed_6[] = {
+  74473, 73445, 70448, 65722, 59633, 52626, 45170, 37708, 30617, 24178, 18570, 13872,
+  10079, 7122, 4895, 3272, 2127, 1345, 827, 73445, 72432, 69476, 64815, 58810,
+  51900, 44547, 37188, 30194, 23844, 18314, 13681, 9940, 7024, 4827, 3227, 2098,
+  1327, 816, 70448, 69476, 66641, 62170, 56410, 49782, 42729, 35670, 28962, 22871,
+  17566, 13122, 9534, 6737, 4630, 3095, 2012, 1273, 783, 65722, 64815, 62170,
+  57999, 52626, 46442, 39862, 33277, 27019, 21337, 16388, 12242, 8894, 6285, 4320,
+  2888, 1877, 1187, 730, 59633, 58810, 56410, 52626, 47750, 42140, 36169, 30194,
+  24516, 19360, 14870, 11108, 8070, 5703, 3920, 2620, 1703, 1077, 662, 52626,
+  51900, 49782, 46442, 42140, 37188, 31919, 26646, 21635, 17085, 13122, 9803, 7122,
+  5033, 3459, 2312, 1503, 951, 585, 45170, 44547, 42729, 39862, 36169, 31919,
+  27397, 22871, 18570, 14665, 11263, 8414, 6113, 4320, 2969, 1985, 1290, 816,
+  502, 37708, 37188, 35670, 33277, 30194, 26646, 22871, 19093, 15502, 12242, 9403,
+  7024, 5103, 3606, 2478, 1657, 1077, 681, 419, 30617, 30194, 28962, 27019,
+  24516, 21635, 18570, 15502, 12587, 9940, 7634, 5703, 4144, 2928, 2012, 1345,
+  875, 553, 340, 24178, 23844, 22871, 21337, 19360, 17085, 14665, 12242, 9940,
+  7849, 6029, 4504, 3272, 2312, 1589, 1062, 691, 437, 269, 18570, 18314,
+  17566, 16388, 14870, 13122, 11263, 9403, 7634, 6029, 4630, 3459, 2513, 1776,
+  1221, 816, 530, 335, 206, 13872, 13681, 13122, 12242, 11108, 9803, 8414,
+  7024, 5703, 4504, 3459, 2584, 1877, 1327, 912, 609, 396, 251, 154,
+  10079, 9940, 9534, 8894, 8070, 7122, 6113, 5103, 4144, 3272, 2513, 1877,
+  1364, 964, 662, 443, 288, 182, 112, 7122, 7024, 6737, 6285, 5703,
+  5033, 4320, 3606, 2928, 2312, 1776, 1327, 964, 681, 468, 313, 203,
+  129, 79, 4895, 4827, 4630, 4320, 3920, 3459, 2969, 2478, 2012, 1589,
+  1221, 912, 662, 468, 322, 215, 140, 88, 54, 3272, 3227, 3095,
+  2888, 2620, 2312, 1985, 1657, 1345, 1062, 816, 609, 443, 313, 215,
+  144, 93, 59, 36, 2127, 2098, 2012, 1877, 1703, 1503, 1290, 1077,
+  875, 691, 530, 396, 288, 203, 140, 93, 61, 38, 24, 1345,
+  1327, 1273, 1187, 1077, 951, 816, 681, 553, 437, 335, 251, 182,
+  129, 88, 59, 38, 24, 15, 827, 816, 783, 730, 662, 585,
+  502, 419, 340, 269, 206, 154, 112, 79, 54, 36, 24, 15,
+  9
+};
+static const int kern_row_fixed_6[] = {
+  12417, 20191, 31930, 49112, 73470, 106899, 151276, 208210, 278722, 362891, 459535, 565974,
+  677970, 789880, 895052, 986441, 1057379, 1102367, 1117784, 1102367, 1057379, 986441, 895052, 789880,
+  677970, 565974, 459535, 362891, 278722, 208210, 151276, 106899, 73470, 49112, 31930, 20191,
+  12417
+};
+
+static const float kern_half_7[] = {
+  5.69917560e-02f, 5.64131625e-02f, 5.47123961e-02f, 5.19909598e-02f, 4.84068468e-02f, 4.41593453e-02f,
+  3.94707397e-02f, 3.45672481e-02f, 2.96613649e-02f, 2.49375813e-02f, 2.05425527e-02f, 1.65802576e-02f,
+  1.31118819e-02f, 1.01595772e-02f, 7.71299517e-03f, 5.73729724e-03f, 4.18146513e-03f, 2.98597710e-03f,
+  2.08920613e-03f, 1.43223070e-03f, 9.62014194e-04f, 6.33121177e-04f, 5.64131625e-02f, 5.58404438e-02f,
+  5.41569442e-02f, 5.14631383e-02f, 4.79154140e-02f, 4.37110290e-02f, 3.90700251e-02f, 3.42163146e-02f,
+  2.93602366e-02f, 2.46844105e-02f, 2.03339998e-02f, 1.64119322e-02f, 1.29787680e-02f, 1.00564351e-02f,
+  7.63469143e-03f, 5.67905093e-03f, 4.13901405e-03f, 2.95566279e-03f, 2.06799619e-03f, 1.41769042e-03f,
+  9.52247647e-04f, 6.26693654e-04f, 5.47123961e-02f, 5.41569442e-02f, 5.25241978e-02f, 4.99116033e-02f,
+  4.64708358e-02f, 4.23932113e-02f, 3.78921255e-02f, 3.31847444e-02f, 2.84750722e-02f, 2.39402149e-02f,
+  1.97209623e-02f, 1.59171373e-02f, 1.25874784e-02f, 9.75324959e-03f, 7.40451738e-03f, 5.50783658e-03f,
+  4.01422940e-03f, 2.86655431e-03f, 2.00564926e-03f, 1.37494924e-03f, 9.23538872e-04f, 6.07799797e-04f,
+  5.19909598e-02f, 5.14631383e-02f, 4.99116033e-02f, 4.74289656e-02f, 4.41593453e-02f, 4.02845405e-02f,
+  3.60073447e-02f, 3.15341130e-02f, 2.70587020e-02f, 2.27494109e-02f, 1.87400263e-02f, 1.51254078e-02f,
+  1.19613679e-02f, 9.26811527e-03f, 7.03621143e-03f, 5.23387268e-03f, 3.81455873e-03f, 2.72396975e-03f,
+  1.90588681e-03f, 1.30655826e-03f, 8.77601386e-04f, 5.77567378e-04f, 4.84068468e-02f, 4.79154140e-02f,
+  4.64708358e-02f, 4.41593453e-02f, 4.11151238e-02f, 3.75074372e-02f, 3.35250981e-02f, 2.93602366e-02f,
+  2.51933504e-02f, 2.11811289e-02f, 1.74481422e-02f, 1.40827047e-02f, 1.11367842e-02f, 8.62919725e-03f,
+  6.55115442e-03f, 4.87306435e-03f, 3.55159352e-03f, 2.53618672e-03f, 1.77450024e-03f, 1.21648773e-03f,
+  8.17101973e-04f, 5.37751534e-04f, 4.41593453e-02f, 4.37110290e-02f, 4.23932113e-02f, 4.02845405e-02f,
+  3.75074372e-02f, 3.42163146e-02f, 3.05834077e-02f, 2.67839972e-02f, 2.29827370e-02f, 1.93225723e-02f,
+  1.59171373e-02f, 1.28470045e-02f, 1.01595772e-02f, 7.87202083e-03f, 5.97631745e-03f, 4.44547273e-03f,
+  3.23995575e-03f, 2.31364672e-03f, 1.61879510e-03f, 1.10974594e-03f, 7.45404628e-04f, 4.90566017e-04f,
+  3.94707397e-02f, 3.90700251e-02f, 3.78921255e-02f, 3.60073447e-02f, 3.35250981e-02f, 3.05834077e-02f,
+  2.73362249e-02f, 2.39402149e-02f, 2.05425527e-02f, 1.72710046e-02f, 1.42271416e-02f, 1.14829782e-02f,
+  9.08088684e-03f, 7.03621143e-03f, 5.34178410e-03f, 3.97347612e-03f, 2.89595453e-03f, 2.06799619e-03f,
+  1.44692010e-03f, 9.91918962e-04f, 6.66261534e-04f, 4.38480318e-04f, 3.45672481e-02f, 3.42163146e-02f,
+  3.31847444e-02f, 3.15341130e-02f, 2.93602366e-02f, 2.67839972e-02f, 2.39402149e-02f, 2.09660940e-02f,
+  1.79905277e-02f, 1.51254078e-02f, 1.24596879e-02f, 1.00564351e-02f, 7.95275811e-03f, 6.16209488e-03f,
+  4.67816787e-03f, 3.47984675e-03f, 2.53618672e-03f, 1.81108667e-03f, 1.26716762e-03f, 8.68691830e-04f,
+  5.83491114e-04f, 3.84007406e-04f, 2.96613649e-02f, 2.93602366e-02f, 2.84750722e-02f, 2.70587020e-02f,
+  2.51933504e-02f, 2.29827370e-02f, 2.05425527e-02f, 1.79905277e-02f, 1.54372612e-02f, 1.29787680e-02f,
+  1.06913736e-02f, 8.62919725e-03f, 6.82408037e-03f, 5.28755318e-03f, 4.01422940e-03f, 2.98597710e-03f,
+  2.17624404e-03f, 1.55405211e-03f, 1.08732760e-03f, 7.45404628e-04f, 5.00680413e-04f, 3.29508010e-04f,
+  2.49375813e-02f, 2.46844105e-02f, 2.39402149e-02f, 2.27494109e-02f, 2.11811289e-02f, 1.93225723e-02f,
+  1.72710046e-02f, 1.51254078e-02f, 1.29787680e-02f, 1.09118065e-02f, 8.98869615e-03f, 7.25493627e-03f,
+  5.73729724e-03f, 4.44547273e-03f, 3.37493466e-03f, 2.51043891e-03f, 1.82966166e-03f, 1.30655826e-03f,
+  9.14162956e-04f, 6.26693654e-04f, 4.20943485e-04f, 2.77031504e-04f, 2.05425527e-02f, 2.03339998e-02f,
+  1.97209623e-02f, 1.87400263e-02f, 1.74481422e-02f, 1.59171373e-02f, 1.42271416e-02f, 1.24596879e-02f,
+  1.06913736e-02f, 8.98869615e-03f, 7.40451738e-03f, 5.97631745e-03f, 4.72614868e-03f, 3.66199715e-03f,
+  2.78013200e-03f, 2.06799619e-03f, 1.50719984e-03f, 1.07628887e-03f, 7.53049739e-04f, 5.16244385e-04f,
+  3.46755900e-04f, 2.28207136e-04f, 1.65802576e-02f, 1.64119322e-02f, 1.59171373e-02f, 1.51254078e-02f,
+  1.40827047e-02f, 1.28470045e-02f, 1.14829782e-02f, 1.00564351e-02f, 8.62919725e-03f, 7.25493627e-03f,
+  5.97631745e-03f, 4.82359203e-03f, 3.81455873e-03f, 2.95566279e-03f, 2.24389392e-03f, 1.66911632e-03f,
+  1.21648773e-03f, 8.68691830e-04f, 6.07799797e-04f, 4.16669995e-04f, 2.79872824e-04f, 1.84190038e-04f,
+  1.31118819e-02f, 1.29787680e-02f, 1.25874784e-02f, 1.19613679e-02f, 1.11367842e-02f, 1.01595772e-02f,
+  9.08088684e-03f, 7.95275811e-03f, 6.82408037e-03f, 5.73729724e-03f, 4.72614868e-03f, 3.81455873e-03f,
+  3.01660225e-03f, 2.33737635e-03f, 1.77450024e-03f, 1.31995871e-03f, 9.62014194e-04f, 6.86972693e-04f,
+  4.80655930e-04f, 3.29508010e-04f, 2.21327049e-04f, 1.45659855e-04f, 1.01595772e-02f, 1.00564351e-02f,
+  9.75324959e-03f, 9.26811527e-03f, 8.62919725e-03f, 7.87202083e-03f, 7.03621143e-03f, 6.16209488e-03f,
+  5.28755318e-03f, 4.44547273e-03f, 3.66199715e-03f, 2.95566279e-03f, 2.33737635e-03f, 1.81108667e-03f,
+  1.37494924e-03f, 1.02275342e-03f, 7.45404628e-04f, 5.32292121e-04f, 3.72430193e-04f, 2.55315128e-04f,
+  1.71492487e-04f, 1.12862705e-04f, 7.71299517e-03f, 7.63469143e-03f, 7.40451738e-03f, 7.03621143e-03f,
+  6.55115442e-03f, 5.97631745e-03f, 5.34178410e-03f, 4.67816787e-03f, 4.01422940e-03f, 3.37493466e-03f,
+  2.78013200e-03f, 2.24389392e-03f, 1.77450024e-03f, 1.37494924e-03f, 1.04384043e-03f, 7.76458764e-04f,
+  5.65899769e-04f, 4.04108054e-04f, 2.82743305e-04f, 1.93831336e-04f, 1.30194472e-04f, 8.56836341e-05f,
+  5.73729724e-03f, 5.67905093e-03f, 5.50783658e-03f, 5.23387268e-03f, 4.87306435e-03f, 4.44547273e-03f,
+  3.97347612e-03f, 3.47984675e-03f, 2.98597710e-03f, 2.51043891e-03f, 2.06799619e-03f, 1.66911632e-03f,
+  1.31995871e-03f, 1.02275342e-03f, 7.76458764e-04f, 5.77567378e-04f, 4.20943485e-04f, 3.00595013e-04f,
+  2.10318089e-04f, 1.44181089e-04f, 9.68449094e-05f, 6.37356134e-05f, 4.18146513e-03f, 4.13901405e-03f,
+  4.01422940e-03f, 3.81455873e-03f, 3.55159352e-03f, 3.23995575e-03f, 2.89595453e-03f, 2.53618672e-03f,
+  2.17624404e-03f, 1.82966166e-03f, 1.50719984e-03f, 1.21648773e-03f, 9.62014194e-04f, 7.45404628e-04f,
+  5.65899769e-04f, 4.20943485e-04f, 3.06792645e-04f, 2.19080088e-04f, 1.53284331e-04f, 1.05082261e-04f,
+  7.05826460e-05f, 4.64518816e-05f, 2.98597710e-03f, 2.95566279e-03f, 2.86655431e-03f, 2.72396975e-03f,
+  2.53618672e-03f, 2.31364672e-03f, 2.06799619e-03f, 1.81108667e-03f, 1.55405211e-03f, 1.30655826e-03f,
+  1.07628887e-03f, 8.68691830e-04f, 6.86972693e-04f, 5.32292121e-04f, 4.04108054e-04f, 3.00595013e-04f,
+  2.19080088e-04f, 1.56444716e-04f, 1.09460074e-04f, 7.50390609e-05f, 5.04029449e-05f, 3.31712072e-05f,
+  2.08920613e-03f, 2.06799619e-03f, 2.00564926e-03f, 1.90588681e-03f, 1.77450024e-03f, 1.61879510e-03f,
+  1.44692010e-03f, 1.26716762e-03f, 1.08732760e-03f, 9.14162956e-04f, 7.53049739e-04f, 6.07799797e-04f,
+  4.80655930e-04f, 3.72430193e-04f, 2.82743305e-04f, 2.10318089e-04f, 1.53284331e-04f, 1.09460074e-04f,
+  7.65862060e-05f, 5.25027717e-05f, 3.52655588e-05f, 2.32089842e-05f, 1.43223070e-03f, 1.41769042e-03f,
+  1.37494924e-03f, 1.30655826e-03f, 1.21648773e-03f, 1.10974594e-03f, 9.91918962e-04f, 8.68691830e-04f,
+  7.45404628e-04f, 6.26693654e-04f, 5.16244385e-04f, 4.16669995e-04f, 3.29508010e-04f, 2.55315128e-04f,
+  1.93831336e-04f, 1.44181089e-04f, 1.05082261e-04f, 7.50390609e-05f, 5.25027717e-05f, 3.59926562e-05f,
+  2.41758880e-05f, 1.59106457e-05f, 9.62014194e-04f, 9.52247647e-04f, 9.23538872e-04f, 8.77601386e-04f,
+  8.17101973e-04f, 7.45404628e-04f, 6.66261534e-04f, 5.83491114e-04f, 5.00680413e-04f, 4.20943485e-04f,
+  3.46755900e-04f, 2.79872824e-04f, 2.21327049e-04f, 1.71492487e-04f, 1.30194472e-04f, 9.68449094e-05f,
+  7.05826460e-05f, 5.04029449e-05f, 3.52655588e-05f, 2.41758880e-05f, 1.62386877e-05f, 1.06870129e-05f,
+  6.33121177e-04f, 6.26693654e-04f, 6.07799797e-04f, 5.77567378e-04f, 5.37751534e-04f, 4.90566017e-04f,
+  4.38480318e-04f, 3.84007406e-04f, 3.29508010e-04f, 2.77031504e-04f, 2.28207136e-04f, 1.84190038e-04f,
+  1.45659855e-04f, 1.12862705e-04f, 8.56836341e-05f, 6.37356134e-05f, 4.64518816e-05f, 3.31712072e-05f,
+  2.32089842e-05f, 1.59106457e-05f, 1.06870129e-05f, 7.03334126e-06f
+};
+static const float kern_row_7[] = {
+  6.34461059e-04f, 9.64050123e-04f, 1.43526169e-03f, 2.09362735e-03f, 2.99229613e-03f, 4.19031410e-03f,
+  5.74943889e-03f, 7.72931799e-03f, 1.01810778e-02f, 1.31396307e-02f, 1.66153461e-02f, 2.05860250e-02f,
+  2.49903575e-02f, 2.97241379e-02f, 3.46404016e-02f, 3.95542718e-02f, 4.42527980e-02f, 4.85092886e-02f,
+  5.21009862e-02f, 5.48281819e-02f, 5.65325469e-02f, 5.71123660e-02f, 5.65325469e-02f, 5.48281819e-02f,
+  5.21009862e-02f, 4.85092886e-02f, 4.42527980e-02f, 3.95542718e-02f, 3.46404016e-02f, 2.97241379e-02f,
+  2.49903575e-02f, 2.05860250e-02f, 1.66153461e-02f, 1.31396307e-02f, 1.01810778e-02f, 7.72931799e-03f,
+  5.74943889e-03f, 4.19031410e-03f, 2.99229613e-03f, 2.09362735e-03f, 1.43526169e-03f, 9.64050123e-04f,
+  6.34461059e-04f
+};
+static const int kern_half_fixed_7[] = {
+  54724, 54169, 52536, 49922, 46481, 42402, 37900, 33192, 28481, 23945, 19725, 15921,
+  12590, 9755, 7406, 5509, 4015, 2867, 2006, 1375, 924, 608, 54169, 53619,
+  52002, 49416, 46009, 41972, 37516, 32855, 28192, 23702, 19525, 15759, 12462, 9656,
+  7331, 5453, 3974, 2838, 1986, 1361, 914, 602, 52536, 52002, 50435, 47926,
+  44622, 40707, 36385, 31864, 27342, 22988, 18936, 15284, 12087, 9365, 7110, 5289,
+  3855, 2753, 1926, 1320, 887, 584, 49922, 49416, 47926, 45542, 42402, 38682,
+  34575, 30280, 25982, 21844, 17994, 14524, 11485, 8899, 6756, 5026, 3663, 2616,
+  1830, 1255, 843, 555, 46481, 46009, 44622, 42402, 39479, 36015, 32191, 28192,
+  24191, 20338, 16754, 13522, 10694, 8286, 6291, 4679, 3410, 2435, 1704, 1168,
+  785, 516, 42402, 41972, 40707, 38682, 36015, 32855, 29367, 25718, 22068, 18554,
+  15284, 12336, 9755, 7559, 5739, 4269, 3111, 2222, 1554, 1066, 716, 471,
+  37900, 37516, 36385, 34575, 32191, 29367, 26249, 22988, 19725, 16584, 13661, 11026,
+  8720, 6756, 5129, 3815, 2781, 1986, 1389, 952, 640, 421, 33192, 32855,
+  31864, 30280, 28192, 25718, 22988, 20132, 17275, 14524, 11964, 9656, 7636, 5917,
+  4492, 3341, 2435, 1739, 1217, 834, 560, 369, 28481, 28192, 27342, 25982,
+  24191, 22068, 19725, 17275, 14823, 12462, 10266, 8286, 6553, 5077, 3855, 2867,
+  2090, 1492, 1044, 716, 481, 316, 23945, 23702, 22988, 21844, 20338, 18554,
+  16584, 14524, 12462, 10478, 8631, 6966, 5509, 4269, 3241, 2411, 1757, 1255,
+  878, 602, 404, 266, 19725, 19525, 18936, 17994, 16754, 15284, 13661, 11964,
+  10266, 8631, 7110, 5739, 4538, 3516, 2670, 1986, 1447, 1033, 723, 496,
+  333, 219, 15921, 15759, 15284, 14524, 13522, 12336, 11026, 9656, 8286, 6966,
+  5739, 4632, 3663, 2838, 2155, 1603, 1168, 834, 584, 400, 269, 177,
+  12590, 12462, 12087, 11485, 10694, 9755, 8720, 7636, 6553, 5509, 4538, 3663,
+  2897, 2244, 1704, 1267, 924, 660, 462, 316, 213, 140, 9755, 9656,
+  9365, 8899, 8286, 7559, 6756, 5917, 5077, 4269, 3516, 2838, 2244, 1739,
+  1320, 982, 716, 511, 358, 245, 165, 108, 7406, 7331, 7110, 6756,
+  6291, 5739, 5129, 4492, 3855, 3241, 2670, 2155, 1704, 1320, 1002, 746,
+  543, 388, 271, 186, 125, 82, 5509, 5453, 5289, 5026, 4679, 4269,
+  3815, 3341, 2867, 2411, 1986, 1603, 1267, 982, 746, 555, 404, 289,
+  202, 138, 93, 61, 4015, 3974, 3855, 3663, 3410, 3111, 2781, 2435,
+  2090, 1757, 1447, 1168, 924, 716, 543, 404, 295, 210, 147, 101,
+  68, 45, 2867, 2838, 2753, 2616, 2435, 2222, 1986, 1739, 1492, 1255,
+  1033, 834, 660, 511, 388, 289, 210, 150, 105, 72, 48, 32,
+  2006, 1986, 1926, 1830, 1704, 1554, 1389, 1217, 1044, 878, 723, 584,
+  462, 358, 271, 202, 147, 105, 74, 50, 34, 22, 1375, 1361,
+  1320, 1255, 1168, 1066, 952, 834, 716, 602, 496, 400, 316, 245,
+  186, 138, 101, 72, 50, 35, 23, 15, 924, 914, 887, 843,
+  785, 716, 640, 560, 481, 404, 333, 269, 213, 165, 125, 93,
+  68, 48, 34, 23, 16, 10, 608, 602, 584, 555, 516, 471,
+  421, 369, 316, 266, 219, 177, 140, 108, 82, 61, 45, 32,
+  22, 15, 10, 7
+};
+static const int kern_row_fixed_7[] = {
+  10644, 16174, 24080, 35125, 50202, 70302, 96460, 129676, 170810, 220446, 278759, 345376,
+  419269, 498688, 581170, 663611, 742439, 813851, 874110, 919864, 948459, 958187, 948459, 919864,
+  874110, 813851, 742439, 663611, 581170, 498688, 419269, 345376, 278759, 220446, 170810, 129676,
+  96460, 70302, 50202, 35125, 24080, 16174, 10644
+};
+
+static const float kern_half_8[] = {
+  4.98677865e-02f, 4.94797118e-02f, 4.83335145e-02f, 4.64818850e-02f, 4.40081656e-02f, 4.10201214e-02f,
+  3.76421772e-02f, 3.40068750e-02f, 3.02463397e-02f, 2.64845807e-02f, 2.28311364e-02f, 1.93765331e-02f,
+  1.61897000e-02f, 1.33172832e-02f, 1.07846651e-02f, 8.59828480e-03f, 6.74887095e-03f, 5.21512330e-03f,
+  3.96745652e-03f, 2.97148759e-03f, 2.19103764e-03f, 1.59052270e-03f, 1.13669527e-03f, 7.99765054e-04f,
+  5.53981052e-04f, 4.94797118e-02f, 4.90946583e-02f, 4.79573794e-02f, 4.61201631e-02f, 4.36656922e-02f,
+  4.07009013e-02f, 3.73492464e-02f, 3.37422304e-02f, 3.00109610e-02f, 2.62784753e-02f, 2.26534624e-02f,
+  1.92257445e-02f, 1.60637107e-02f, 1.32136475e-02f, 1.07007381e-02f, 8.53137206e-03f, 6.69635087e-03f,
+  5.17453859e-03f, 3.93658131e-03f, 2.94836331e-03f, 2.17398675e-03f, 1.57814519e-03f, 1.12784945e-03f,
+  7.93541200e-04f, 5.49669960e-04f, 4.83335145e-02f, 4.79573794e-02f, 4.68464494e-02f, 4.50517908e-02f,
+  4.26541753e-02f, 3.97580639e-02f, 3.64840515e-02f, 3.29605937e-02f, 2.93157585e-02f, 2.56697349e-02f,
+  2.21286956e-02f, 1.87803805e-02f, 1.56915952e-02f, 1.29075535e-02f, 1.04528554e-02f, 8.33374262e-03f,
+  6.54122978e-03f, 5.05467085e-03f, 3.84539063e-03f, 2.88006454e-03f, 2.12362641e-03f, 1.54158741e-03f,
+  1.10172282e-03f, 7.75158871e-04f, 5.36936859e-04f, 4.64818850e-02f, 4.61201631e-02f, 4.50517908e-02f,
+  4.33258824e-02f, 4.10201214e-02f, 3.82349566e-02f, 3.50863673e-02f, 3.16978917e-02f, 2.81926896e-02f,
+  2.46863440e-02f, 2.12809592e-02f, 1.80609152e-02f, 1.50904590e-02f, 1.24130733e-02f, 1.00524127e-02f,
+  8.01448245e-03f, 6.29063928e-03f, 4.86102933e-03f, 3.69807612e-03f, 2.76973099e-03f, 2.04227166e-03f,
+  1.48253015e-03f, 1.05951657e-03f, 7.45463010e-04f, 5.16367145e-04f, 4.40081656e-02f, 4.36656922e-02f,
+  4.26541753e-02f, 4.10201214e-02f, 3.88370715e-02f, 3.62001285e-02f, 3.32191065e-02f, 3.00109610e-02f,
+  2.66923010e-02f, 2.33725607e-02f, 2.01484058e-02f, 1.70997307e-02f, 1.42873600e-02f, 1.17524611e-02f,
+  9.51743312e-03f, 7.58795952e-03f, 5.95585769e-03f, 4.60232981e-03f, 3.50126810e-03f, 2.62232870e-03f,
+  1.93358387e-03f, 1.40363141e-03f, 1.00313011e-03f, 7.05790182e-04f, 4.88886551e-04f, 4.10201214e-02f,
+  4.07009013e-02f, 3.97580639e-02f, 3.82349566e-02f, 3.62001285e-02f, 3.37422304e-02f, 3.09636127e-02f,
+  2.79732924e-02f, 2.48799603e-02f, 2.17856225e-02f, 1.87803805e-02f, 1.59387011e-02f, 1.33172832e-02f,
+  1.09544983e-02f, 8.87122378e-03f, 7.07275607e-03f, 5.55146951e-03f, 4.28984314e-03f, 3.26354057e-03f,
+  2.44427891e-03f, 1.80229836e-03f, 1.30832824e-03f, 9.35020042e-04f, 6.57868804e-04f, 4.55692381e-04f,
+  3.76421772e-02f, 3.73492464e-02f, 3.64840515e-02f, 3.50863673e-02f, 3.32191065e-02f, 3.09636127e-02f,
+  2.84138080e-02f, 2.56697349e-02f, 2.28311364e-02f, 1.99916102e-02f, 1.72338448e-02f, 1.46261742e-02f,
+  1.22206267e-02f, 1.00524127e-02f, 8.14069249e-03f, 6.49032556e-03f, 5.09431493e-03f, 3.93658131e-03f,
+  2.99479323e-03f, 2.24299659e-03f, 1.65388198e-03f, 1.20058947e-03f, 8.58022657e-04f, 6.03694352e-04f,
+  4.18166834e-04f, 3.40068750e-02f, 3.37422304e-02f, 3.29605937e-02f, 3.16978917e-02f, 3.00109610e-02f,
+  2.79732924e-02f, 2.56697349e-02f, 2.31906734e-02f, 2.06262115e-02f, 1.80609152e-02f, 1.55694820e-02f,
+  1.32136475e-02f, 1.10404156e-02f, 9.08159837e-03f, 7.35450257e-03f, 5.86352078e-03f, 4.60232981e-03f,
+  3.55640496e-03f, 2.70557031e-03f, 2.02637841e-03f, 1.49415783e-03f, 1.08464225e-03f, 7.75158871e-04f,
+  5.45392395e-04f, 3.77782242e-04f, 3.02463397e-02f, 3.00109610e-02f, 2.93157585e-02f, 2.81926896e-02f,
+  2.66923010e-02f, 2.48799603e-02f, 2.28311364e-02f, 2.06262115e-02f, 1.83453336e-02f, 1.60637107e-02f,
+  1.38477841e-02f, 1.17524611e-02f, 9.81954951e-03f, 8.07734113e-03f, 6.54122978e-03f, 5.21512330e-03f,
+  4.09339694e-03f, 3.16313212e-03f, 2.40638410e-03f, 1.80229836e-03f, 1.32893142e-03f, 9.64700768e-04f,
+  6.89440581e-04f, 4.85082011e-04f, 3.36006487e-04f, 2.64845807e-02f, 2.62784753e-02f, 2.56697349e-02f,
+  2.46863440e-02f, 2.33725607e-02f, 2.17856225e-02f, 1.99916102e-02f, 1.80609152e-02f, 1.60637107e-02f,
+  1.40658543e-02f, 1.21255247e-02f, 1.02907987e-02f, 8.59828480e-03f, 7.07275607e-03f, 5.72769204e-03f,
+  4.56651440e-03f, 3.58429831e-03f, 2.76973099e-03f, 2.10710033e-03f, 1.57814519e-03f, 1.16365124e-03f,
+  8.44720227e-04f, 6.03694352e-04f, 4.24752012e-04f, 2.94217112e-04f, 2.28311364e-02f, 2.26534624e-02f,
+  2.21286956e-02f, 2.12809592e-02f, 2.01484058e-02f, 1.87803805e-02f, 1.72338448e-02f, 1.55694820e-02f,
+  1.38477841e-02f, 1.21255247e-02f, 1.04528554e-02f, 8.87122378e-03f, 7.41218450e-03f, 6.09709648e-03f,
+  4.93757939e-03f, 3.93658131e-03f, 3.08985822e-03f, 2.38765730e-03f, 1.81643397e-03f, 1.36044621e-03f,
+  1.00313011e-03f, 7.28194369e-04f, 5.20417059e-04f, 3.66159104e-04f, 2.53631006e-04f, 1.93765331e-02f,
+  1.92257445e-02f, 1.87803805e-02f, 1.80609152e-02f, 1.70997307e-02f, 1.59387011e-02f, 1.46261742e-02f,
+  1.32136475e-02f, 1.17524611e-02f, 1.02907987e-02f, 8.87122378e-03f, 7.52890948e-03f, 6.29063928e-03f,
+  5.17453859e-03f, 4.19046916e-03f, 3.34093324e-03f, 2.62232870e-03f, 2.02637841e-03f, 1.54158741e-03f,
+  1.15459564e-03f, 8.51345481e-04f, 6.18010527e-04f, 4.41672193e-04f, 3.10755218e-04f, 2.15253836e-04f,
+  1.61897000e-02f, 1.60637107e-02f, 1.56915952e-02f, 1.50904590e-02f, 1.42873600e-02f, 1.33172832e-02f,
+  1.22206267e-02f, 1.10404156e-02f, 9.81954951e-03f, 8.59828480e-03f, 7.41218450e-03f, 6.29063928e-03f,
+  5.25602605e-03f, 4.32348903e-03f, 3.50126810e-03f, 2.79145432e-03f, 2.19103764e-03f, 1.69310265e-03f,
+  1.28804450e-03f, 9.64700768e-04f, 7.11325731e-04f, 5.16367145e-04f, 3.69030924e-04f, 2.59645691e-04f,
+  1.79851311e-04f, 1.33172832e-02f, 1.32136475e-02f, 1.29075535e-02f, 1.24130733e-02f, 1.17524611e-02f,
+  1.09544983e-02f, 1.00524127e-02f, 9.08159837e-03f, 8.07734113e-03f, 7.07275607e-03f, 6.09709648e-03f,
+  5.17453859e-03f, 4.32348903e-03f, 3.55640496e-03f, 2.88006454e-03f, 2.29618768e-03f, 1.80229836e-03f,
+  1.39270816e-03f, 1.05951657e-03f, 7.93541200e-04f, 5.85120579e-04f, 4.24752012e-04f, 3.03556561e-04f,
+  2.13578722e-04f, 1.47941653e-04f, 1.07846651e-02f, 1.07007381e-02f, 1.04528554e-02f, 1.00524127e-02f,
+  9.51743312e-03f, 8.87122378e-03f, 8.14069249e-03f, 7.35450257e-03f, 6.54122978e-03f, 5.72769204e-03f,
+  4.93757939e-03f, 4.19046916e-03f, 3.50126810e-03f, 2.88006454e-03f, 2.33234745e-03f, 1.85950939e-03f,
+  1.45954569e-03f, 1.12784945e-03f, 8.58022657e-04f, 6.42629282e-04f, 4.73845110e-04f, 3.43974651e-04f,
+  2.45827599e-04f, 1.72961314e-04f, 1.19806806e-04f, 8.59828480e-03f, 8.53137206e-03f, 8.33374262e-03f,
+  8.01448245e-03f, 7.58795952e-03f, 7.07275607e-03f, 6.49032556e-03f, 5.86352078e-03f, 5.21512330e-03f,
+  4.56651440e-03f, 3.93658131e-03f, 3.34093324e-03f, 2.79145432e-03f, 2.29618768e-03f, 1.85950939e-03f,
+  1.48253015e-03f, 1.16365124e-03f, 8.99199978e-04f, 6.84075290e-04f, 5.12348721e-04f, 3.77782242e-04f,
+  2.74240505e-04f, 1.95990855e-04f, 1.37896786e-04f, 9.55183132e-05f, 6.74887095e-03f, 6.69635087e-03f,
+  6.54122978e-03f, 6.29063928e-03f, 5.95585769e-03f, 5.55146951e-03f, 5.09431493e-03f, 4.60232981e-03f,
+  4.09339694e-03f, 3.58429831e-03f, 3.08985822e-03f, 2.62232870e-03f, 2.19103764e-03f, 1.80229836e-03f,
+  1.45954569e-03f, 1.16365124e-03f, 9.13360331e-04f, 7.05790182e-04f, 5.36936859e-04f, 4.02147125e-04f,
+  2.96524697e-04f, 2.15253836e-04f, 1.53834975e-04f, 1.08236425e-04f, 7.49731844e-05f, 5.21512330e-03f,
+  5.17453859e-03f, 5.05467085e-03f, 4.86102933e-03f, 4.60232981e-03f, 4.28984314e-03f, 3.93658131e-03f,
+  3.55640496e-03f, 3.16313212e-03f, 2.76973099e-03f, 2.38765730e-03f, 2.02637841e-03f, 1.69310265e-03f,
+  1.39270816e-03f, 1.12784945e-03f, 8.99199978e-04f, 7.05790182e-04f, 5.45392395e-04f, 4.14912647e-04f,
+  3.10755218e-04f, 2.29136524e-04f, 1.66335274e-04f, 1.18874457e-04f, 8.36386316e-05f, 5.79347834e-05f,
+  3.96745652e-03f, 3.93658131e-03f, 3.84539063e-03f, 3.69807612e-03f, 3.50126810e-03f, 3.26354057e-03f,
+  2.99479323e-03f, 2.70557031e-03f, 2.40638410e-03f, 2.10710033e-03f, 1.81643397e-03f, 1.54158741e-03f,
+  1.28804450e-03f, 1.05951657e-03f, 8.58022657e-04f, 6.84075290e-04f, 5.36936859e-04f, 4.14912647e-04f,
+  3.15648882e-04f, 2.36410095e-04f, 1.74317873e-04f, 1.26541199e-04f, 9.04349217e-05f, 6.36289114e-05f,
+  4.40744589e-05f, 2.97148759e-03f, 2.94836331e-03f, 2.88006454e-03f, 2.76973099e-03f, 2.62232870e-03f,
+  2.44427891e-03f, 2.24299659e-03f, 2.02637841e-03f, 1.80229836e-03f, 1.57814519e-03f, 1.36044621e-03f,
+  1.15459564e-03f, 9.64700768e-04f, 7.93541200e-04f, 6.42629282e-04f, 5.12348721e-04f, 4.02147125e-04f,
+  3.10755218e-04f, 2.36410095e-04f, 1.77062975e-04f, 1.30558052e-04f, 9.47749795e-05f, 6.77326243e-05f,
+  4.76558525e-05f, 3.30102448e-05f, 2.19103764e-03f, 2.17398675e-03f, 2.12362641e-03f, 2.04227166e-03f,
+  1.93358387e-03f, 1.80229836e-03f, 1.65388198e-03f, 1.49415783e-03f, 1.32893142e-03f, 1.16365124e-03f,
+  1.00313011e-03f, 8.51345481e-04f, 7.11325731e-04f, 5.85120579e-04f, 4.73845110e-04f, 3.77782242e-04f,
+  2.96524697e-04f, 2.29136524e-04f, 1.74317873e-04f, 1.30558052e-04f, 9.62674749e-05f, 6.98826916e-05f,
+  4.99429079e-05f, 3.51392227e-05f, 2.43402283e-05f, 1.59052270e-03f, 1.57814519e-03f, 1.54158741e-03f,
+  1.48253015e-03f, 1.40363141e-03f, 1.30832824e-03f, 1.20058947e-03f, 1.08464225e-03f, 9.64700768e-04f,
+  8.44720227e-04f, 7.28194369e-04f, 6.18010527e-04f, 5.16367145e-04f, 4.24752012e-04f, 3.43974651e-04f,
+  2.74240505e-04f, 2.15253836e-04f, 1.66335274e-04f, 1.26541199e-04f, 9.47749795e-05f, 6.98826916e-05f,
+  5.07293917e-05f, 3.62546634e-05f, 2.55083414e-05f, 1.76691119e-05f, 1.13669527e-03f, 1.12784945e-03f,
+  1.10172282e-03f, 1.05951657e-03f, 1.00313011e-03f, 9.35020042e-04f, 8.58022657e-04f, 7.75158871e-04f,
+  6.89440581e-04f, 6.03694352e-04f, 5.20417059e-04f, 4.41672193e-04f, 3.69030924e-04f, 3.03556561e-04f,
+  2.45827599e-04f, 1.95990855e-04f, 1.53834975e-04f, 1.18874457e-04f, 9.04349217e-05f, 6.77326243e-05f,
+  4.99429079e-05f, 3.62546634e-05f, 2.59100379e-05f, 1.82299882e-05f, 1.26275445e-05f, 7.99765054e-04f,
+  7.93541200e-04f, 7.75158871e-04f, 7.45463010e-04f, 7.05790182e-04f, 6.57868804e-04f, 6.03694352e-04f,
+  5.45392395e-04f, 4.85082011e-04f, 4.24752012e-04f, 3.66159104e-04f, 3.10755218e-04f, 2.59645691e-04f,
+  2.13578722e-04f, 1.72961314e-04f, 1.37896786e-04f, 1.08236425e-04f, 8.36386316e-05f, 6.36289114e-05f,
+  4.76558525e-05f, 3.51392227e-05f, 2.55083414e-05f, 1.82299882e-05f, 1.28263991e-05f, 8.88458726e-06f,
+  5.53981052e-04f, 5.49669960e-04f, 5.36936859e-04f, 5.16367145e-04f, 4.88886551e-04f, 4.55692381e-04f,
+  4.18166834e-04f, 3.77782242e-04f, 3.36006487e-04f, 2.94217112e-04f, 2.53631006e-04f, 2.15253836e-04f,
+  1.79851311e-04f, 1.47941653e-04f, 1.19806806e-04f, 9.55183132e-05f, 7.49731844e-05f, 5.79347834e-05f,
+  4.40744589e-05f, 3.30102448e-05f, 2.43402283e-05f, 1.76691119e-05f, 1.26275445e-05f, 8.88458726e-06f,
+  6.15417366e-06f
+};
+static const float kern_row_8[] = {
+  5.55191597e-04f, 8.01512622e-04f, 1.13917910e-03f, 1.59399828e-03f, 2.19582533e-03f, 2.97798077e-03f,
+  3.97612574e-03f, 5.22651896e-03f, 6.76361797e-03f, 8.61707330e-03f, 1.08082313e-02f, 1.33463833e-02f,
+  1.62250772e-02f, 1.94188729e-02f, 2.28810254e-02f, 2.65424531e-02f, 3.03124338e-02f, 3.40811834e-02f,
+  3.77244316e-02f, 4.11097556e-02f, 4.41043302e-02f, 4.65834551e-02f, 4.84391302e-02f, 4.95878309e-02f,
+  4.99767549e-02f, 4.95878309e-02f, 4.84391302e-02f, 4.65834551e-02f, 4.41043302e-02f, 4.11097556e-02f,
+  3.77244316e-02f, 3.40811834e-02f, 3.03124338e-02f, 2.65424531e-02f, 2.28810254e-02f, 1.94188729e-02f,
+  1.62250772e-02f, 1.33463833e-02f, 1.08082313e-02f, 8.61707330e-03f, 6.76361797e-03f, 5.22651896e-03f,
+  3.97612574e-03f, 2.97798077e-03f, 2.19582533e-03f, 1.59399828e-03f, 1.13917910e-03f, 8.01512622e-04f,
+  5.55191597e-04f
+};
+static const int kern_half_fixed_8[] = {
+  41904, 41578, 40615, 39059, 36980, 34469, 31631, 28576, 25416, 22255, 19185, 16282,
+  13604, 11191, 9062, 7225, 5671, 4382, 3334, 2497, 1841, 1337, 955, 672,
+  466, 41578, 41254, 40299, 38755, 36692, 34201, 31385, 28354, 25218, 22082, 19036,
+  16155, 13498, 11103, 8992, 7169, 5627, 4348, 3308, 2478, 1827, 1326, 948,
+  667, 462, 40615, 40299, 39365, 37857, 35842, 33409, 30658, 27697, 24634, 21570,
+  18595, 15781, 13186, 10846, 8784, 7003, 5497, 4247, 3231, 2420, 1784, 1295,
+  926, 651, 451, 39059, 38755, 37857, 36407, 34469, 32129, 29483, 26636, 23690,
+  20744, 17882, 15177, 12681, 10431, 8447, 6735, 5286, 4085, 3108, 2327, 1716,
+  1246, 890, 626, 434, 36980, 36692, 35842, 34469, 32635, 30419, 27914, 25218,
+  22430, 19640, 16931, 14369, 12006, 9876, 7998, 6376, 5005, 3867, 2942, 2204,
+  1625, 1179, 843, 593, 411, 34469, 34201, 33409, 32129, 30419, 28354, 26019,
+  23506, 20907, 18307, 15781, 13393, 11191, 9205, 7455, 5943, 4665, 3605, 2742,
+  2054, 1514, 1099, 786, 553, 383, 31631, 31385, 30658, 29483, 27914, 26019,
+  23876, 21570, 19185, 16799, 14482, 12290, 10269, 8447, 6841, 5454, 4281, 3308,
+  2517, 1885, 1390, 1009, 721, 507, 351, 28576, 28354, 27697, 26636, 25218,
+  23506, 21570, 19487, 17332, 15177, 13083, 11103, 9277, 7631, 6180, 4927, 3867,
+  2988, 2273, 1703, 1256, 911, 651, 458, 317, 25416, 25218, 24634, 23690,
+  22430, 20907, 19185, 17332, 15416, 13498, 11636, 9876, 8251, 6787, 5497, 4382,
+  3440, 2658, 2022, 1514, 1117, 811, 579, 408, 282, 22255, 22082, 21570,
+  20744, 19640, 18307, 16799, 15177, 13498, 11820, 10189, 8647, 7225, 5943, 4813,
+  3837, 3012, 2327, 1771, 1326, 978, 710, 507, 357, 247, 19185, 19036,
+  18595, 17882, 16931, 15781, 14482, 13083, 11636, 10189, 8784, 7455, 6228, 5123,
+  4149, 3308, 2596, 2006, 1526, 1143, 843, 612, 437, 308, 213, 16282,
+  16155, 15781, 15177, 14369, 13393, 12290, 11103, 9876, 8647, 7455, 6327, 5286,
+  4348, 3521, 2807, 2204, 1703, 1295, 970, 715, 519, 371, 261, 181,
+  13604, 13498, 13186, 12681, 12006, 11191, 10269, 9277, 8251, 7225, 6228, 5286,
+  4417, 3633, 2942, 2346, 1841, 1423, 1082, 811, 598, 434, 310, 218,
+  151, 11191, 11103, 10846, 10431, 9876, 9205, 8447, 7631, 6787, 5943, 5123,
+  4348, 3633, 2988, 2420, 1929, 1514, 1170, 890, 667, 492, 357, 255,
+  179, 124, 9062, 8992, 8784, 8447, 7998, 7455, 6841, 6180, 5497, 4813,
+  4149, 3521, 2942, 2420, 1960, 1563, 1226, 948, 721, 540, 398, 289,
+  207, 145, 101, 7225, 7169, 7003, 6735, 6376, 5943, 5454, 4927, 4382,
+  3837, 3308, 2807, 2346, 1929, 1563, 1246, 978, 756, 575, 431, 317,
+  230, 165, 116, 80, 5671, 5627, 5497, 5286, 5005, 4665, 4281, 3867,
+  3440, 3012, 2596, 2204, 1841, 1514, 1226, 978, 767, 593, 451, 338,
+  249, 181, 129, 91, 63, 4382, 4348, 4247, 4085, 3867, 3605, 3308,
+  2988, 2658, 2327, 2006, 1703, 1423, 1170, 948, 756, 593, 458, 349,
+  261, 193, 140, 100, 70, 49, 3334, 3308, 3231, 3108, 2942, 2742,
+  2517, 2273, 2022, 1771, 1526, 1295, 1082, 890, 721, 575, 451, 349,
+  265, 199, 146, 106, 76, 53, 37, 2497, 2478, 2420, 2327, 2204,
+  2054, 1885, 1703, 1514, 1326, 1143, 970, 811, 667, 540, 431, 338,
+  261, 199, 149, 110, 80, 57, 40, 28, 1841, 1827, 1784, 1716,
+  1625, 1514, 1390, 1256, 1117, 978, 843, 715, 598, 492, 398, 317,
+  249, 193, 146, 110, 81, 59, 42, 30, 20, 1337, 1326, 1295,
+  1246, 1179, 1099, 1009, 911, 811, 710, 612, 519, 434, 357, 289,
+  230, 181, 140, 106, 80, 59, 43, 30, 21, 15, 955, 948,
+  926, 890, 843, 786, 721, 651, 579, 507, 437, 371, 310, 255,
+  207, 165, 129, 100, 76, 57, 42, 30, 22, 15, 11, 672,
+  667, 651, 626, 593, 553, 507, 458, 408, 357, 308, 261, 218,
+  179, 145, 116, 91, 70, 53, 40, 30, 21, 15, 11, 7,
+  466, 462, 451, 434, 411, 383, 351, 317, 282, 247, 213, 181,
+  151, 124, 101, 80, 63, 49, 37, 28, 20, 15, 11, 7,
+  5
+};
+static const int kern_row_fixed_8[] = {
+  9315, 13447, 19112, 26743, 36840, 49962, 66708, 87686, 113475, 144571, 181332, 223915,
+  272212, 325795, 383880, 445308, 508558, 571787, 632911, 689707, 739948, 781541, 812674, 831946,
+  838471, 831946, 812674, 781541, 739948, 689707, 632911, 571787, 508558, 445308, 383880, 325795,
+  272212, 223915, 181332, 144571, 113475, 87686, 66708, 49962, 36840, 26743, 19112, 13447,
+  9315
+};
+
+static const float kern_half_9[] = {
+  4.43269201e-02f, 4.40541394e-02f, 4.32458296e-02f, 4.19314690e-02f, 4.01582047e-02f, 3.79880331e-02f,
+  3.54942232e-02f, 3.27572078e-02f, 2.98603177e-02f, 2.68856362e-02f, 2.39102729e-02f, 2.10032798e-02f,
+  1.82233416e-02f, 1.56173473e-02f, 1.32197989e-02f, 1.10530155e-02f, 9.12798755e-03f, 7.44573632e-03f,
+  5.99899609e-03f, 4.77406010e-03f, 3.75262788e-03f, 2.91354326e-03f, 2.23432202e-03f, 1.69242104e-03f,
+  1.26622070e-03f, 9.35726042e-04f, 6.83008926e-04f, 4.92427615e-04f, 4.40541394e-02f, 4.37830389e-02f,
+  4.29797024e-02f, 4.16734293e-02f, 3.99110764e-02f, 3.77542600e-02f, 3.52757983e-02f, 3.25556248e-02f,
+  2.96765622e-02f, 2.67201867e-02f, 2.37631332e-02f, 2.08740290e-02f, 1.81111991e-02f, 1.55212404e-02f,
+  1.31384470e-02f, 1.09849973e-02f, 9.07181576e-03f, 7.39991665e-03f, 5.96207939e-03f, 4.74468153e-03f,
+  3.72953480e-03f, 2.89561390e-03f, 2.22057244e-03f, 1.68200617e-03f, 1.25842856e-03f, 9.29967733e-04f,
+  6.78805809e-04f, 4.89397265e-04f, 4.32458296e-02f, 4.29797024e-02f, 4.21911068e-02f, 4.09088023e-02f,
+  3.91787849e-02f, 3.70615423e-02f, 3.46285552e-02f, 3.19582932e-02f, 2.91320533e-02f, 2.62299217e-02f,
+  2.33271252e-02f, 2.04910301e-02f, 1.77788921e-02f, 1.52364550e-02f, 1.28973806e-02f, 1.07834432e-02f,
+  8.90536513e-03f, 7.26414192e-03f, 5.85268671e-03f, 4.65762522e-03f, 3.66110494e-03f, 2.84248474e-03f,
+  2.17982917e-03f, 1.65114459e-03f, 1.23533874e-03f, 9.12904623e-04f, 6.66350999e-04f, 4.80417773e-04f,
+  4.19314690e-02f, 4.16734293e-02f, 4.09088023e-02f, 3.96654718e-02f, 3.79880331e-02f, 3.59351374e-02f,
+  3.35760973e-02f, 3.09869908e-02f, 2.82466505e-02f, 2.54327226e-02f, 2.26181503e-02f, 1.98682509e-02f,
+  1.72385424e-02f, 1.47733772e-02f, 1.25053944e-02f, 1.04557043e-02f, 8.63470603e-03f, 7.04336492e-03f,
+  5.67480735e-03f, 4.51606745e-03f, 3.54983378e-03f, 2.75609386e-03f, 2.11357814e-03f, 1.60096167e-03f,
+  1.19779340e-03f, 8.85158894e-04f, 6.46098750e-04f, 4.65816556e-04f, 4.01582047e-02f, 3.99110764e-02f,
+  3.91787849e-02f, 3.79880331e-02f, 3.63815315e-02f, 3.44154537e-02f, 3.21561769e-02f, 2.96765622e-02f,
+  2.70521101e-02f, 2.43571810e-02f, 2.16616355e-02f, 1.90280303e-02f, 1.65095311e-02f, 1.41486172e-02f,
+  1.19765457e-02f, 1.00135366e-02f, 8.26954748e-03f, 6.74550328e-03f, 5.43482183e-03f, 4.32508439e-03f,
+  3.39971273e-03f, 2.63953954e-03f, 2.02419562e-03f, 1.53325766e-03f, 1.14713924e-03f, 8.47725896e-04f,
+  6.18775492e-04f, 4.46117338e-04f, 3.79880331e-02f, 3.77542600e-02f, 3.70615423e-02f, 3.59351374e-02f,
+  3.44154537e-02f, 3.25556248e-02f, 3.04184388e-02f, 2.80728247e-02f, 2.55902000e-02f, 2.30409056e-02f,
+  2.04910301e-02f, 1.79997459e-02f, 1.56173473e-02f, 1.33840181e-02f, 1.13293268e-02f, 9.47239995e-03f,
+  7.82265700e-03f, 6.38097292e-03f, 5.14112134e-03f, 4.09135455e-03f, 3.21599049e-03f, 2.49689748e-03f,
+  1.91480701e-03f, 1.45039952e-03f, 1.08514715e-03f, 8.01914313e-04f, 5.85336529e-04f, 4.22008918e-04f,
+  3.54942232e-02f, 3.52757983e-02f, 3.46285552e-02f, 3.35760973e-02f, 3.21561769e-02f, 3.04184388e-02f,
+  2.84215510e-02f, 2.62299217e-02f, 2.39102729e-02f, 2.15283353e-02f, 1.91458501e-02f, 1.68181118e-02f,
+  1.45921111e-02f, 1.25053944e-02f, 1.05855875e-02f, 8.85056332e-03f, 7.30912108e-03f, 5.96207939e-03f,
+  4.80362074e-03f, 3.82276834e-03f, 3.00486945e-03f, 2.33298307e-03f, 1.78910524e-03f, 1.35518482e-03f,
+  1.01391028e-03f, 7.49270839e-04f, 5.46910800e-04f, 3.94305185e-04f, 3.27572078e-02f, 3.25556248e-02f,
+  3.19582932e-02f, 3.09869908e-02f, 2.96765622e-02f, 2.80728247e-02f, 2.62299217e-02f, 2.42072921e-02f,
+  2.20665149e-02f, 1.98682509e-02f, 1.76694840e-02f, 1.55212404e-02f, 1.34668909e-02f, 1.15410835e-02f,
+  9.76931676e-03f, 8.16808175e-03f, 6.74550328e-03f, 5.50233433e-03f, 4.43320582e-03f, 3.52798891e-03f,
+  2.77315942e-03f, 2.15308298e-03f, 1.65114459e-03f, 1.25068438e-03f, 9.35726042e-04f, 6.91493391e-04f,
+  5.04737662e-04f, 3.63899715e-04f, 2.98603177e-02f, 2.96765622e-02f, 2.91320533e-02f, 2.82466505e-02f,
+  2.70521101e-02f, 2.55902000e-02f, 2.39102729e-02f, 2.20665149e-02f, 2.01150589e-02f, 1.81111991e-02f,
+  1.61068793e-02f, 1.41486172e-02f, 1.22759435e-02f, 1.05204452e-02f, 8.90536513e-03f, 7.44573632e-03f,
+  6.14896370e-03f, 5.01573412e-03f, 4.04115440e-03f, 3.21599049e-03f, 2.52791448e-03f, 1.96267478e-03f,
+  1.50512520e-03f, 1.14007993e-03f, 8.52974947e-04f, 6.30341063e-04f, 4.60101088e-04f, 3.31718154e-04f,
+  2.68856362e-02f, 2.67201867e-02f, 2.62299217e-02f, 2.54327226e-02f, 2.43571810e-02f, 2.30409056e-02f,
+  2.15283353e-02f, 1.98682509e-02f, 1.81111991e-02f, 1.63069628e-02f, 1.45023139e-02f, 1.27391331e-02f,
+  1.10530155e-02f, 9.47239995e-03f, 8.01821332e-03f, 6.70399284e-03f, 5.53640444e-03f, 4.51606745e-03f,
+  3.63857509e-03f, 2.89561390e-03f, 2.27608392e-03f, 1.76715327e-03f, 1.35518482e-03f, 1.02650526e-03f,
+  7.68001657e-04f, 5.67546522e-04f, 4.14265873e-04f, 2.98672443e-04f, 2.39102729e-02f, 2.37631332e-02f,
+  2.33271252e-02f, 2.26181503e-02f, 2.16616355e-02f, 2.04910301e-02f, 1.91458501e-02f, 1.76694840e-02f,
+  1.61068793e-02f, 1.45023139e-02f, 1.28973806e-02f, 1.13293268e-02f, 9.82980710e-03f, 8.42411444e-03f,
+  7.13085895e-03f, 5.96207939e-03f, 4.92370501e-03f, 4.01628623e-03f, 3.23590357e-03f, 2.57516373e-03f,
+  2.02419562e-03f, 1.57158705e-03f, 1.20521011e-03f, 9.12904623e-04f, 6.83008926e-04f, 5.04737662e-04f,
+  3.68420151e-04f, 2.65619135e-04f, 2.10032798e-02f, 2.08740290e-02f, 2.04910301e-02f, 1.98682509e-02f,
+  1.90280303e-02f, 1.79997459e-02f, 1.68181118e-02f, 1.55212404e-02f, 1.41486172e-02f, 1.27391331e-02f,
+  1.13293268e-02f, 9.95191559e-03f, 8.63470603e-03f, 7.39991665e-03f, 6.26389403e-03f, 5.23721427e-03f,
+  4.32508439e-03f, 3.52798891e-03f, 2.84248474e-03f, 2.26207729e-03f, 1.77809538e-03f, 1.38051470e-03f,
+  1.05868152e-03f, 8.01914313e-04f, 5.99969178e-04f, 4.43372002e-04f, 3.23627901e-04f, 2.33325365e-04f,
+  1.82233416e-02f, 1.81111991e-02f, 1.77788921e-02f, 1.72385424e-02f, 1.65095311e-02f, 1.56173473e-02f,
+  1.45921111e-02f, 1.34668909e-02f, 1.22759435e-02f, 1.10530155e-02f, 9.82980710e-03f, 8.63470603e-03f,
+  7.49183958e-03f, 6.42048335e-03f, 5.43482183e-03f, 4.54403041e-03f, 3.75262788e-03f, 3.06103379e-03f,
+  2.46626115e-03f, 1.96267478e-03f, 1.54275144e-03f, 1.19779340e-03f, 9.18557227e-04f, 6.95775088e-04f,
+  5.20558853e-04f, 3.84688494e-04f, 2.80793378e-04f, 2.02443043e-04f, 1.56173473e-02f, 1.55212404e-02f,
+  1.52364550e-02f, 1.47733772e-02f, 1.41486172e-02f, 1.33840181e-02f, 1.25053944e-02f, 1.15410835e-02f,
+  1.05204452e-02f, 9.47239995e-03f, 8.42411444e-03f, 7.39991665e-03f, 6.42048335e-03f, 5.50233433e-03f,
+  4.65762522e-03f, 3.89422011e-03f, 3.21599049e-03f, 2.62329634e-03f, 2.11357814e-03f, 1.68200617e-03f,
+  1.32213323e-03f, 1.02650526e-03f, 7.87200697e-04f, 5.96277067e-04f, 4.46117338e-04f, 3.29676841e-04f,
+  2.40639041e-04f, 1.73493056e-04f, 1.32197989e-02f, 1.31384470e-02f, 1.28973806e-02f, 1.25053944e-02f,
+  1.19765457e-02f, 1.13293268e-02f, 1.05855875e-02f, 9.76931676e-03f, 8.90536513e-03f, 8.01821332e-03f,
+  7.13085895e-03f, 6.26389403e-03f, 5.43482183e-03f, 4.65762522e-03f, 3.94259486e-03f, 3.29638598e-03f,
+  2.72227707e-03f, 2.22057244e-03f, 1.78910524e-03f, 1.42378744e-03f, 1.11916161e-03f, 8.68917909e-04f,
+  6.66350999e-04f, 5.04737662e-04f, 3.77630175e-04f, 2.79065425e-04f, 2.03696545e-04f, 1.46858700e-04f,
+  1.10530155e-02f, 1.09849973e-02f, 1.07834432e-02f, 1.04557043e-02f, 1.00135366e-02f, 9.47239995e-03f,
+  8.85056332e-03f, 8.16808175e-03f, 7.44573632e-03f, 6.70399284e-03f, 5.96207939e-03f, 5.23721427e-03f,
+  4.54403041e-03f, 3.89422011e-03f, 3.29638598e-03f, 2.75609386e-03f, 2.27608392e-03f, 1.85661076e-03f,
+  1.49586296e-03f, 1.19042245e-03f, 9.35726042e-04f, 7.26498431e-04f, 5.57133113e-04f, 4.22008918e-04f,
+  3.15734913e-04f, 2.33325365e-04f, 1.70309781e-04f, 1.22787911e-04f, 9.12798755e-03f, 9.07181576e-03f,
+  8.90536513e-03f, 8.63470603e-03f, 8.26954748e-03f, 7.82265700e-03f, 7.30912108e-03f, 6.74550328e-03f,
+  6.14896370e-03f, 5.53640444e-03f, 4.92370501e-03f, 4.32508439e-03f, 3.75262788e-03f, 3.21599049e-03f,
+  2.72227707e-03f, 2.27608392e-03f, 1.87967392e-03f, 1.53325766e-03f, 1.23533874e-03f, 9.83094680e-04f,
+  7.72757048e-04f, 5.99969178e-04f, 4.60101088e-04f, 3.48510541e-04f, 2.60745524e-04f, 1.92688676e-04f,
+  1.40648102e-04f, 1.01402780e-04f, 7.44573632e-03f, 7.39991665e-03f, 7.26414192e-03f, 7.04336492e-03f,
+  6.74550328e-03f, 6.38097292e-03f, 5.96207939e-03f, 5.50233433e-03f, 5.01573412e-03f, 4.51606745e-03f,
+  4.01628623e-03f, 3.52798891e-03f, 3.06103379e-03f, 2.62329634e-03f, 2.22057244e-03f, 1.85661076e-03f,
+  1.53325766e-03f, 1.25068438e-03f, 1.00767077e-03f, 8.01914313e-04f, 6.30341063e-04f, 4.89397265e-04f,
+  3.75306292e-04f, 2.84281443e-04f, 2.12691186e-04f, 1.57176939e-04f, 1.14727220e-04f, 8.27146578e-05f,
+  5.99899609e-03f, 5.96207939e-03f, 5.85268671e-03f, 5.67480735e-03f, 5.43482183e-03f, 5.14112134e-03f,
+  4.80362074e-03f, 4.43320582e-03f, 4.04115440e-03f, 3.63857509e-03f, 3.23590357e-03f, 2.84248474e-03f,
+  2.46626115e-03f, 2.11357814e-03f, 1.78910524e-03f, 1.49586296e-03f, 1.23533874e-03f, 1.00767077e-03f,
+  8.11875856e-04f, 6.46098750e-04f, 5.07862947e-04f, 3.94305185e-04f, 3.02382599e-04f, 2.29044279e-04f,
+  1.71364329e-04f, 1.26636747e-04f, 9.24352062e-05f, 6.66428314e-05f, 4.77406010e-03f, 4.74468153e-03f,
+  4.65762522e-03f, 4.51606745e-03f, 4.32508439e-03f, 4.09135455e-03f, 3.82276834e-03f, 3.52798891e-03f,
+  3.21599049e-03f, 2.89561390e-03f, 2.57516373e-03f, 2.26207729e-03f, 1.96267478e-03f, 1.68200617e-03f,
+  1.42378744e-03f, 1.19042245e-03f, 9.83094680e-04f, 8.01914313e-04f, 6.46098750e-04f, 5.14171727e-04f,
+  4.04162332e-04f, 3.13791941e-04f, 2.40639041e-04f, 1.82275689e-04f, 1.36373419e-04f, 1.00778765e-04f,
+  7.35608410e-05f, 5.30350153e-05f, 3.75262788e-03f, 3.72953480e-03f, 3.66110494e-03f, 3.54983378e-03f,
+  3.39971273e-03f, 3.21599049e-03f, 3.00486945e-03f, 2.77315942e-03f, 2.52791448e-03f, 2.27608392e-03f,
+  2.02419562e-03f, 1.77809538e-03f, 1.54275144e-03f, 1.32213323e-03f, 1.11916161e-03f, 9.35726042e-04f,
+  7.72757048e-04f, 6.30341063e-04f, 5.07862947e-04f, 4.04162332e-04f, 3.17689934e-04f, 2.46654701e-04f,
+  1.89153216e-04f, 1.43276964e-04f, 1.07195694e-04f, 7.92166829e-05f, 5.78221625e-05f, 4.16879302e-05f,
+  2.91354326e-03f, 2.89561390e-03f, 2.84248474e-03f, 2.75609386e-03f, 2.63953954e-03f, 2.49689748e-03f,
+  2.33298307e-03f, 2.15308298e-03f, 1.96267478e-03f, 1.76715327e-03f, 1.57158705e-03f, 1.38051470e-03f,
+  1.19779340e-03f, 1.02650526e-03f, 8.68917909e-04f, 7.26498431e-04f, 5.99969178e-04f, 4.89397265e-04f,
+  3.94305185e-04f, 3.13791941e-04f, 2.46654701e-04f, 1.91502913e-04f, 1.46858700e-04f, 1.11240348e-04f,
+  8.32268197e-05f, 6.15038953e-05f, 4.48931714e-05f, 3.23665408e-05f, 2.23432202e-03f, 2.22057244e-03f,
+  2.17982917e-03f, 2.11357814e-03f, 2.02419562e-03f, 1.91480701e-03f, 1.78910524e-03f, 1.65114459e-03f,
+  1.50512520e-03f, 1.35518482e-03f, 1.20521011e-03f, 1.05868152e-03f, 9.18557227e-04f, 7.87200697e-04f,
+  6.66350999e-04f, 5.57133113e-04f, 4.60101088e-04f, 3.75306292e-04f, 3.02382599e-04f, 2.40639041e-04f,
+  1.89153216e-04f, 1.46858700e-04f, 1.12622198e-04f, 8.53073871e-05f, 6.38245256e-05f, 4.71657695e-05f,
+  3.44274304e-05f, 2.48210763e-05f, 1.69242104e-03f, 1.68200617e-03f, 1.65114459e-03f, 1.60096167e-03f,
+  1.53325766e-03f, 1.45039952e-03f, 1.35518482e-03f, 1.25068438e-03f, 1.14007993e-03f, 1.02650526e-03f,
+  9.12904623e-04f, 8.01914313e-04f, 6.95775088e-04f, 5.96277067e-04f, 5.04737662e-04f, 4.22008918e-04f,
+  3.48510541e-04f, 2.84281443e-04f, 2.29044279e-04f, 1.82275689e-04f, 1.43276964e-04f, 1.11240348e-04f,
+  8.53073871e-05f, 6.46173721e-05f, 4.83448530e-05f, 3.57264253e-05f, 2.60775778e-05f, 1.88010999e-05f,
+  1.26622070e-03f, 1.25842856e-03f, 1.23533874e-03f, 1.19779340e-03f, 1.14713924e-03f, 1.08514715e-03f,
+  1.01391028e-03f, 9.35726042e-04f, 8.52974947e-04f, 7.68001657e-04f, 6.83008926e-04f, 5.99969178e-04f,
+  5.20558853e-04f, 4.46117338e-04f, 3.77630175e-04f, 3.15734913e-04f, 2.60745524e-04f, 2.12691186e-04f,
+  1.71364329e-04f, 1.36373419e-04f, 1.07195694e-04f, 8.32268197e-05f, 6.38245256e-05f, 4.83448530e-05f,
+  3.61702259e-05f, 2.67294836e-05f, 1.95104931e-05f, 1.40664406e-05f, 9.35726042e-04f, 9.29967733e-04f,
+  9.12904623e-04f, 8.85158894e-04f, 8.47725896e-04f, 8.01914313e-04f, 7.49270839e-04f, 6.91493391e-04f,
+  6.30341063e-04f, 5.67546522e-04f, 5.04737662e-04f, 4.43372002e-04f, 3.84688494e-04f, 3.29676841e-04f,
+  2.79065425e-04f, 2.33325365e-04f, 1.92688676e-04f, 1.57176939e-04f, 1.26636747e-04f, 1.00778765e-04f,
+  7.92166829e-05f, 6.15038953e-05f, 4.71657695e-05f, 3.57264253e-05f, 2.67294836e-05f, 1.97528552e-05f,
+  1.44180840e-05f, 1.03949778e-05f, 6.83008926e-04f, 6.78805809e-04f, 6.66350999e-04f, 6.46098750e-04f,
+  6.18775492e-04f, 5.85336529e-04f, 5.46910800e-04f, 5.04737662e-04f, 4.60101088e-04f, 4.14265873e-04f,
+  3.68420151e-04f, 3.23627901e-04f, 2.80793378e-04f, 2.40639041e-04f, 2.03696545e-04f, 1.70309781e-04f,
+  1.40648102e-04f, 1.14727220e-04f, 9.24352062e-05f, 7.35608410e-05f, 5.78221625e-05f, 4.48931714e-05f,
+  3.44274304e-05f, 2.60775778e-05f, 1.95104931e-05f, 1.44180840e-05f, 1.05241061e-05f, 7.58754368e-06f,
+  4.92427615e-04f, 4.89397265e-04f, 4.80417773e-04f, 4.65816556e-04f, 4.46117338e-04f, 4.22008918e-04f,
+  3.94305185e-04f, 3.63899715e-04f, 3.31718154e-04f, 2.98672443e-04f, 2.65619135e-04f, 2.33325365e-04f,
+  2.02443043e-04f, 1.73493056e-04f, 1.46858700e-04f, 1.22787911e-04f, 1.01402780e-04f, 8.27146578e-05f,
+  6.66428314e-05f, 5.30350153e-05f, 4.16879302e-05f, 3.23665408e-05f, 2.48210763e-05f, 1.88010999e-05f,
+  1.40664406e-05f, 1.03949778e-05f, 7.58754368e-06f, 5.47037644e-06f
+};
+static const float kern_row_9[] = {
+  4.93530475e-04f, 6.84538682e-04f, 9.37821809e-04f, 1.26905658e-03f, 1.69621152e-03f, 2.23932625e-03f,
+  2.92006880e-03f, 3.76103260e-03f, 4.78475261e-03f, 6.01243228e-03f, 7.46241258e-03f, 9.14843194e-03f,
+  1.10777710e-02f, 1.32494075e-02f, 1.56523250e-02f, 1.82641558e-02f, 2.10503209e-02f, 2.39638258e-02f,
+  2.69458517e-02f, 2.99271960e-02f, 3.28305736e-02f, 3.55737209e-02f, 3.80731151e-02f, 4.02481444e-02f,
+  4.20253836e-02f, 4.33426872e-02f, 4.41528074e-02f, 4.44261990e-02f, 4.41528074e-02f, 4.33426872e-02f,
+  4.20253836e-02f, 4.02481444e-02f, 3.80731151e-02f, 3.55737209e-02f, 3.28305736e-02f, 2.99271960e-02f,
+  2.69458517e-02f, 2.39638258e-02f, 2.10503209e-02f, 1.82641558e-02f, 1.56523250e-02f, 1.32494075e-02f,
+  1.10777710e-02f, 9.14843194e-03f, 7.46241258e-03f, 6.01243228e-03f, 4.78475261e-03f, 3.76103260e-03f,
+  2.92006880e-03f, 2.23932625e-03f, 1.69621152e-03f, 1.26905658e-03f, 9.37821809e-04f, 6.84538682e-04f,
+  4.93530475e-04f
+};
+static const int kern_half_fixed_9[] = {
+  33113, 32909, 32305, 31324, 29999, 28378, 26515, 24470, 22306, 20084, 17861, 15690,
+  13613, 11666, 9875, 8257, 6819, 5562, 4481, 3566, 2803, 2176, 1669, 1264,
+  946, 699, 510, 368, 32909, 32707, 32107, 31131, 29814, 28203, 26352, 24320,
+  22169, 19960, 17751, 15593, 13529, 11595, 9815, 8206, 6777, 5528, 4454, 3544,
+  2786, 2163, 1659, 1256, 940, 695, 507, 366, 32305, 32107, 31517, 30560,
+  29267, 27686, 25868, 23873, 21762, 19594, 17426, 15307, 13281, 11382, 9635, 8055,
+  6652, 5426, 4372, 3479, 2735, 2123, 1628, 1233, 923, 682, 498, 359,
+  31324, 31131, 30560, 29631, 28378, 26844, 25082, 23148, 21101, 18999, 16896, 14842,
+  12877, 11036, 9342, 7811, 6450, 5262, 4239, 3374, 2652, 2059, 1579, 1196,
+  895, 661, 483, 348, 29999, 29814, 29267, 28378, 27178, 25709, 24021, 22169,
+  20208, 18195, 16182, 14214, 12333, 10569, 8947, 7480, 6177, 5039, 4060, 3231,
+  2540, 1972, 1512, 1145, 857, 633, 462, 333, 28378, 28203, 27686, 26844,
+  25709, 24320, 22723, 20971, 19116, 17212, 15307, 13446, 11666, 9998, 8463, 7076,
+  5844, 4767, 3841, 3056, 2402, 1865, 1430, 1083, 811, 599, 437, 315,
+  26515, 26352, 25868, 25082, 24021, 22723, 21231, 19594, 17861, 16082, 14302, 12563,
+  10901, 9342, 7908, 6612, 5460, 4454, 3588, 2856, 2245, 1743, 1336, 1012,
+  757, 560, 409, 295, 24470, 24320, 23873, 23148, 22169, 20971, 19594, 18083,
+  16484, 14842, 13199, 11595, 10060, 8621, 7298, 6102, 5039, 4110, 3312, 2635,
+  2072, 1608, 1233, 934, 699, 517, 377, 272, 22306, 22169, 21762, 21101,
+  20208, 19116, 17861, 16484, 15026, 13529, 12032, 10569, 9170, 7859, 6652, 5562,
+  4593, 3747, 3019, 2402, 1888, 1466, 1124, 852, 637, 471, 344, 248,
+  20084, 19960, 19594, 18999, 18195, 17212, 16082, 14842, 13529, 12182, 10833, 9516,
+  8257, 7076, 5990, 5008, 4136, 3374, 2718, 2163, 1700, 1320, 1012, 767,
+  574, 424, 309, 223, 17861, 17751, 17426, 16896, 16182, 15307, 14302, 13199,
+  12032, 10833, 9635, 8463, 7343, 6293, 5327, 4454, 3678, 3000, 2417, 1924,
+  1512, 1174, 900, 682, 510, 377, 275, 198, 15690, 15593, 15307, 14842,
+  14214, 13446, 12563, 11595, 10569, 9516, 8463, 7434, 6450, 5528, 4679, 3912,
+  3231, 2635, 2123, 1690, 1328, 1031, 791, 599, 448, 331, 242, 174,
+  13613, 13529, 13281, 12877, 12333, 11666, 10901, 10060, 9170, 8257, 7343, 6450,
+  5597, 4796, 4060, 3394, 2803, 2287, 1842, 1466, 1152, 895, 686, 520,
+  389, 287, 210, 151, 11666, 11595, 11382, 11036, 10569, 9998, 9342, 8621,
+  7859, 7076, 6293, 5528, 4796, 4110, 3479, 2909, 2402, 1960, 1579, 1256,
+  988, 767, 588, 445, 333, 246, 180, 130, 9875, 9815, 9635, 9342,
+  8947, 8463, 7908, 7298, 6652, 5990, 5327, 4679, 4060, 3479, 2945, 2462,
+  2034, 1659, 1336, 1064, 836, 649, 498, 377, 282, 208, 152, 110,
+  8257, 8206, 8055, 7811, 7480, 7076, 6612, 6102, 5562, 5008, 4454, 3912,
+  3394, 2909, 2462, 2059, 1700, 1387, 1117, 889, 699, 543, 416, 315,
+  236, 174, 127, 92, 6819, 6777, 6652, 6450, 6177, 5844, 5460, 5039,
+  4593, 4136, 3678, 3231, 2803, 2402, 2034, 1700, 1404, 1145, 923, 734,
+  577, 448, 344, 260, 195, 144, 105, 76, 5562, 5528, 5426, 5262,
+  5039, 4767, 4454, 4110, 3747, 3374, 3000, 2635, 2287, 1960, 1659, 1387,
+  1145, 934, 753, 599, 471, 366, 280, 212, 159, 117, 86, 62,
+  4481, 4454, 4372, 4239, 4060, 3841, 3588, 3312, 3019, 2718, 2417, 2123,
+  1842, 1579, 1336, 1117, 923, 753, 606, 483, 379, 295, 226, 171,
+  128, 95, 69, 50, 3566, 3544, 3479, 3374, 3231, 3056, 2856, 2635,
+  2402, 2163, 1924, 1690, 1466, 1256, 1064, 889, 734, 599, 483, 384,
+  302, 234, 180, 136, 102, 75, 55, 40, 2803, 2786, 2735, 2652,
+  2540, 2402, 2245, 2072, 1888, 1700, 1512, 1328, 1152, 988, 836, 699,
+  577, 471, 379, 302, 237, 184, 141, 107, 80, 59, 43, 31,
+  2176, 2163, 2123, 2059, 1972, 1865, 1743, 1608, 1466, 1320, 1174, 1031,
+  895, 767, 649, 543, 448, 366, 295, 234, 184, 143, 110, 83,
+  62, 46, 34, 24, 1669, 1659, 1628, 1579, 1512, 1430, 1336, 1233,
+  1124, 1012, 900, 791, 686, 588, 498, 416, 344, 280, 226, 180,
+  141, 110, 84, 64, 48, 35, 26, 19, 1264, 1256, 1233, 1196,
+  1145, 1083, 1012, 934, 852, 767, 682, 599, 520, 445, 377, 315,
+  260, 212, 171, 136, 107, 83, 64, 48, 36, 27, 19, 14,
+  946, 940, 923, 895, 857, 811, 757, 699, 637, 574, 510, 448,
+  389, 333, 282, 236, 195, 159, 128, 102, 80, 62, 48, 36,
+  27, 20, 15, 11, 699, 695, 682, 661, 633, 599, 560, 517,
+  471, 424, 377, 331, 287, 246, 208, 174, 144, 117, 95, 75,
+  59, 46, 35, 27, 20, 15, 11, 8, 510, 507, 498, 483,
+  462, 437, 409, 377, 344, 309, 275, 242, 210, 180, 152, 127,
+  105, 86, 69, 55, 43, 34, 26, 19, 15, 11, 8, 6,
+  368, 366, 359, 348, 333, 315, 295, 272, 248, 223, 198, 174,
+  151, 130, 110, 92, 76, 62, 50, 40, 31, 24, 19, 14,
+  11, 8, 6, 4
+};
+static const int kern_row_fixed_9[] = {
+  8280, 11485, 15734, 21291, 28458, 37570, 48991, 63100, 80275, 100872, 125199, 153485,
+  185854, 222288, 262602, 306422, 353166, 402046, 452076, 502095, 550806, 596828, 638761, 675252,
+  705069, 727170, 740761, 745348, 740761, 727170, 705069, 675252, 638761, 596828, 550806, 502095,
+  452076, 402046, 353166, 306422, 262602, 222288, 185854, 153485, 125199, 100872, 80275, 63100,
+  48991, 37570, 28458, 21291, 15734, 11485, 8280
+};
+
+static const float kern_half_10[] = {
+  3.98942269e-02f, 3.96952555e-02f, 3.91042680e-02f, 3.81387807e-02f, 3.68270129e-02f, 3.52065340e-02f,
+  3.33224609e-02f, 3.12253926e-02f, 2.89691556e-02f, 2.66085248e-02f, 2.41970718e-02f, 2.17852183e-02f,
+  1.94186047e-02f, 1.71368588e-02f, 1.49727464e-02f, 1.29517596e-02f, 1.10920835e-02f, 9.40490793e-03f,
+  7.89501611e-03f, 6.56158151e-03f, 5.39909676e-03f, 4.39835945e-03f, 3.54745938e-03f, 2.83270376e-03f,
+  2.23945314e-03f, 1.75282999e-03f, 1.35829696e-03f, 1.04209350e-03f, 7.91545142e-04f, 5.95253252e-04f,
+  4.43184836e-04f, 3.96952555e-02f, 3.94972749e-02f, 3.89092378e-02f, 3.79485637e-02f, 3.66433375e-02f,
+  3.50309387e-02f, 3.31562646e-02f, 3.10696568e-02f, 2.88246702e-02f, 2.64758151e-02f, 2.40763891e-02f,
+  2.16765627e-02f, 1.93217546e-02f, 1.70513894e-02f, 1.48980701e-02f, 1.28871622e-02f, 1.10367611e-02f,
+  9.35800094e-03f, 7.85563886e-03f, 6.52885530e-03f, 5.37216850e-03f, 4.37642261e-03f, 3.52976634e-03f,
+  2.81857559e-03f, 2.22828379e-03f, 1.74408779e-03f, 1.35152240e-03f, 1.03689602e-03f, 7.87597324e-04f,
+  5.92284428e-04f, 4.40974458e-04f, 3.91042680e-02f, 3.89092378e-02f, 3.83299515e-02f, 3.73835824e-02f,
+  3.60977910e-02f, 3.45093980e-02f, 3.26626301e-02f, 3.06070894e-02f, 2.83955280e-02f, 2.60816403e-02f,
+  2.37179380e-02f, 2.13538408e-02f, 1.90340914e-02f, 1.67975258e-02f, 1.46762663e-02f, 1.26952976e-02f,
+  1.08724451e-02f, 9.21867788e-03f, 7.73868384e-03f, 6.43165363e-03f, 5.29218744e-03f, 4.31126636e-03f,
+  3.47721484e-03f, 2.77661253e-03f, 2.19510891e-03f, 1.71812170e-03f, 1.33140082e-03f, 1.02145865e-03f,
+  7.75871507e-04f, 5.83466433e-04f, 4.34409187e-04f, 3.81387807e-02f, 3.79485637e-02f, 3.73835824e-02f,
+  3.64605784e-02f, 3.52065340e-02f, 3.36573571e-02f, 3.18561867e-02f, 2.98513975e-02f, 2.76944395e-02f,
+  2.54376829e-02f, 2.31323410e-02f, 2.08266135e-02f, 1.85641386e-02f, 1.63827948e-02f, 1.43139083e-02f,
+  1.23818498e-02f, 1.06040034e-02f, 8.99106823e-03f, 7.54761510e-03f, 6.27285521e-03f, 5.16152289e-03f,
+  4.20482084e-03f, 3.39136203e-03f, 2.70805764e-03f, 2.14091153e-03f, 1.67570112e-03f, 1.29852840e-03f,
+  9.96238785e-04f, 7.56715192e-04f, 5.69060619e-04f, 4.23683581e-04f, 3.68270129e-02f, 3.66433375e-02f,
+  3.60977910e-02f, 3.52065340e-02f, 3.39956172e-02f, 3.24997269e-02f, 3.07605080e-02f, 2.88246702e-02f,
+  2.67419014e-02f, 2.45627649e-02f, 2.23367140e-02f, 2.01102905e-02f, 1.79256313e-02f, 1.58193149e-02f,
+  1.38215870e-02f, 1.19559811e-02f, 1.02392836e-02f, 8.68182443e-03f, 7.28801824e-03f, 6.05710316e-03f,
+  4.98399418e-03f, 4.06019762e-03f, 3.27471760e-03f, 2.61491514e-03f, 2.06727581e-03f, 1.61806610e-03f,
+  1.25386612e-03f, 9.61973506e-04f, 7.30688276e-04f, 5.49488002e-04f, 4.09111177e-04f, 3.52065340e-02f,
+  3.50309387e-02f, 3.45093980e-02f, 3.36573571e-02f, 3.24997269e-02f, 3.10696568e-02f, 2.94069685e-02f,
+  2.75563132e-02f, 2.55651902e-02f, 2.34819409e-02f, 2.13538408e-02f, 1.92253869e-02f, 1.71368588e-02f,
+  1.51232248e-02f, 1.32134026e-02f, 1.14298873e-02f, 9.78872925e-03f, 8.29980150e-03f, 6.96732709e-03f,
+  5.79057541e-03f, 4.76468587e-03f, 3.88153875e-03f, 3.13062174e-03f, 2.49985233e-03f, 1.97631028e-03f,
+  1.54686708e-03f, 1.19869283e-03f, 9.19644255e-04f, 6.98536169e-04f, 5.25309122e-04f, 3.91109235e-04f,
+  3.33224609e-02f, 3.31562646e-02f, 3.26626301e-02f, 3.18561867e-02f, 3.07605080e-02f, 2.94069685e-02f,
+  2.78332587e-02f, 2.60816403e-02f, 2.41970718e-02f, 2.22253092e-02f, 2.02110931e-02f, 1.81965437e-02f,
+  1.62197836e-02f, 1.43139083e-02f, 1.25062894e-02f, 1.08182188e-02f, 9.26488731e-03f, 7.85563886e-03f,
+  6.59447163e-03f, 5.48069365e-03f, 4.50970465e-03f, 3.67381866e-03f, 2.96308706e-03f, 2.36607296e-03f,
+  1.87054835e-03f, 1.46408670e-03f, 1.13454496e-03f, 8.70429620e-04f, 6.61154103e-04f, 4.97197325e-04f,
+  3.70179099e-04f, 3.12253926e-02f, 3.10696568e-02f, 3.06070894e-02f, 2.98513975e-02f, 2.88246702e-02f,
+  2.75563132e-02f, 2.60816403e-02f, 2.44402569e-02f, 2.26742886e-02f, 2.08266135e-02f, 1.89391579e-02f,
+  1.70513894e-02f, 1.51990307e-02f, 1.34130977e-02f, 1.17192371e-02f, 1.01374006e-02f, 8.68182443e-03f,
+  7.36126397e-03f, 6.17946452e-03f, 5.13577973e-03f, 4.22589760e-03f, 3.44261597e-03f, 2.77661253e-03f,
+  2.21717008e-03f, 1.75282999e-03f, 1.37194805e-03f, 1.06314512e-03f, 8.15651321e-04f, 6.19545986e-04f,
+  4.65907418e-04f, 3.46882793e-04f, 2.89691556e-02f, 2.88246702e-02f, 2.83955280e-02f, 2.76944395e-02f,
+  2.67419014e-02f, 2.55651902e-02f, 2.41970718e-02f, 2.26742886e-02f, 2.10359246e-02f, 1.93217546e-02f,
+  1.75706800e-02f, 1.58193149e-02f, 1.41008021e-02f, 1.24439141e-02f, 1.08724451e-02f, 9.40490793e-03f,
+  8.05450603e-03f, 6.82936469e-03f, 5.73295821e-03f, 4.76468587e-03f, 3.92054906e-03f, 3.19386460e-03f,
+  2.57598422e-03f, 2.05696514e-03f, 1.62617664e-03f, 1.27281586e-03f, 9.86326020e-04f, 7.56715192e-04f,
+  5.74779755e-04f, 4.32242581e-04f, 3.21818254e-04f, 2.66085248e-02f, 2.64758151e-02f, 2.60816403e-02f,
+  2.54376829e-02f, 2.45627649e-02f, 2.34819409e-02f, 2.22253092e-02f, 2.08266135e-02f, 1.93217546e-02f,
+  1.77472699e-02f, 1.61388870e-02f, 1.45302350e-02f, 1.29517596e-02f, 1.14298873e-02f, 9.98647511e-03f,
+  8.63852352e-03f, 7.39816250e-03f, 6.27285521e-03f, 5.26579237e-03f, 4.37642261e-03f, 3.60107236e-03f,
+  2.93360394e-03f, 2.36607296e-03f, 1.88934768e-03f, 1.49366329e-03f, 1.16909703e-03f, 9.05952533e-04f,
+  6.95052207e-04f, 5.27942262e-04f, 3.97020107e-04f, 2.95594014e-04f, 2.41970718e-02f, 2.40763891e-02f,
+  2.37179380e-02f, 2.31323410e-02f, 2.23367140e-02f, 2.13538408e-02f, 2.02110931e-02f, 1.89391579e-02f,
+  1.75706800e-02f, 1.61388870e-02f, 1.46762663e-02f, 1.32134026e-02f, 1.17779793e-02f, 1.03940303e-02f,
+  9.08142980e-03f, 7.85563886e-03f, 6.72768848e-03f, 5.70436474e-03f, 4.78856917e-03f, 3.97980027e-03f,
+  3.27471760e-03f, 2.66773999e-03f, 2.15164293e-03f, 1.71812170e-03f, 1.35829696e-03f, 1.06314512e-03f,
+  8.23848706e-04f, 6.32061623e-04f, 4.80096409e-04f, 3.61039332e-04f, 2.68805190e-04f, 2.17852183e-02f,
+  2.16765627e-02f, 2.13538408e-02f, 2.08266135e-02f, 2.01102905e-02f, 1.92253869e-02f, 1.81965437e-02f,
+  1.70513894e-02f, 1.58193149e-02f, 1.45302350e-02f, 1.32134026e-02f, 1.18963504e-02f, 1.06040034e-02f,
+  9.35800094e-03f, 8.17623362e-03f, 7.07262475e-03f, 6.05710316e-03f, 5.13577973e-03f, 4.31126636e-03f,
+  3.58311180e-03f, 2.94830860e-03f, 2.40183179e-03f, 1.93717680e-03f, 1.54686708e-03f, 1.22290803e-03f,
+  9.57175682e-04f, 7.41731201e-04f, 5.69060619e-04f, 4.32242581e-04f, 3.25052562e-04f, 2.42011913e-04f,
+  1.94186047e-02f, 1.93217546e-02f, 1.90340914e-02f, 1.85641386e-02f, 1.79256313e-02f, 1.71368588e-02f,
+  1.62197836e-02f, 1.51990307e-02f, 1.41008021e-02f, 1.29517596e-02f, 1.17779793e-02f, 1.06040034e-02f,
+  9.45204962e-03f, 8.34140461e-03f, 7.28801824e-03f, 6.30429806e-03f, 5.39909676e-03f, 4.57786024e-03f,
+  3.84291681e-03f, 3.19386460e-03f, 2.62802257e-03f, 2.14091153e-03f, 1.72673375e-03f, 1.37882493e-03f,
+  1.09005882e-03f, 8.53193982e-04f, 6.61154103e-04f, 5.07241348e-04f, 3.85286403e-04f, 2.89740856e-04f,
+  2.15721215e-04f, 1.71368588e-02f, 1.70513894e-02f, 1.67975258e-02f, 1.63827948e-02f, 1.58193149e-02f,
+  1.51232248e-02f, 1.43139083e-02f, 1.34130977e-02f, 1.24439141e-02f, 1.14298873e-02f, 1.03940303e-02f,
+  9.35800094e-03f, 8.34140461e-03f, 7.36126397e-03f, 6.43165363e-03f, 5.56352362e-03f, 4.76468587e-03f,
+  4.03994741e-03f, 3.39136203e-03f, 2.81857559e-03f, 2.31922162e-03f, 1.88934768e-03f, 1.52383721e-03f,
+  1.21680880e-03f, 9.61973506e-04f, 7.52941065e-04f, 5.83466433e-04f, 4.47638915e-04f, 3.40014056e-04f,
+  2.55695399e-04f, 1.90373306e-04f, 1.49727464e-02f, 1.48980701e-02f, 1.46762663e-02f, 1.43139083e-02f,
+  1.38215870e-02f, 1.32134026e-02f, 1.25062894e-02f, 1.17192371e-02f, 1.08724451e-02f, 9.98647511e-03f,
+  9.08142980e-03f, 8.17623362e-03f, 7.28801824e-03f, 6.43165363e-03f, 5.61943790e-03f, 4.86093899e-03f,
+  4.16298211e-03f, 3.52976634e-03f, 2.96308706e-03f, 2.46263435e-03f, 2.02634092e-03f, 1.65075320e-03f,
+  1.33140082e-03f, 1.06314512e-03f, 8.40491557e-04f, 6.57856581e-04f, 5.09783917e-04f, 3.91109235e-04f,
+  2.97075690e-04f, 2.23405150e-04f, 1.66332189e-04f, 1.29517596e-02f, 1.28871622e-02f, 1.26952976e-02f,
+  1.23818498e-02f, 1.19559811e-02f, 1.14298873e-02f, 1.08182188e-02f, 1.01374006e-02f, 9.40490793e-03f,
+  8.63852352e-03f, 7.85563886e-03f, 7.07262475e-03f, 6.30429806e-03f, 5.56352362e-03f, 4.86093899e-03f,
+  4.20482084e-03f, 3.60107236e-03f, 3.05332639e-03f, 2.56313640e-03f, 2.13023368e-03f, 1.75282999e-03f,
+  1.42793835e-03f, 1.15169142e-03f, 9.19644255e-04f, 7.27043953e-04f, 5.69060619e-04f, 4.40974458e-04f,
+  3.38318234e-04f, 2.56977102e-04f, 1.93250438e-04f, 1.43881058e-04f, 1.10920835e-02f, 1.10367611e-02f,
+  1.08724451e-02f, 1.06040034e-02f, 1.02392836e-02f, 9.78872925e-03f, 9.26488731e-03f, 8.68182443e-03f,
+  8.05450603e-03f, 7.39816250e-03f, 6.72768848e-03f, 6.05710316e-03f, 5.39909676e-03f, 4.76468587e-03f,
+  4.16298211e-03f, 3.60107236e-03f, 3.08401301e-03f, 2.61491514e-03f, 2.19510891e-03f, 1.82436442e-03f,
+  1.50115031e-03f, 1.22290803e-03f, 9.86326020e-04f, 7.87597324e-04f, 6.22651482e-04f, 4.87352139e-04f,
+  3.77657212e-04f, 2.89740856e-04f, 2.20079077e-04f, 1.65502599e-04f, 1.23221922e-04f, 9.40490793e-03f,
+  9.35800094e-03f, 9.21867788e-03f, 8.99106823e-03f, 8.68182443e-03f, 8.29980150e-03f, 7.85563886e-03f,
+  7.36126397e-03f, 6.82936469e-03f, 6.27285521e-03f, 5.70436474e-03f, 5.13577973e-03f, 4.57786024e-03f,
+  4.03994741e-03f, 3.52976634e-03f, 3.05332639e-03f, 2.61491514e-03f, 2.21717008e-03f, 1.86121906e-03f,
+  1.54686708e-03f, 1.27281586e-03f, 1.03689602e-03f, 8.36299616e-04f, 6.67798799e-04f, 5.27942262e-04f,
+  4.13222820e-04f, 3.20213177e-04f, 2.45669449e-04f, 1.86603662e-04f, 1.40328615e-04f, 1.04479084e-04f,
+  7.89501611e-03f, 7.85563886e-03f, 7.73868384e-03f, 7.54761510e-03f, 7.28801824e-03f, 6.96732709e-03f,
+  6.59447163e-03f, 6.17946452e-03f, 5.73295821e-03f, 5.26579237e-03f, 4.78856917e-03f, 4.31126636e-03f,
+  3.84291681e-03f, 3.39136203e-03f, 2.96308706e-03f, 2.56313640e-03f, 2.19510891e-03f, 1.86121906e-03f,
+  1.56241341e-03f, 1.29852840e-03f, 1.06847426e-03f, 8.70429620e-04f, 7.02037592e-04f, 5.60588378e-04f,
+  4.43184836e-04f, 3.46882793e-04f, 2.68805190e-04f, 2.06228942e-04f, 1.56645750e-04f, 1.17799842e-04f,
+  8.77057028e-05f, 6.56158151e-03f, 6.52885530e-03f, 6.43165363e-03f, 6.27285521e-03f, 6.05710316e-03f,
+  5.79057541e-03f, 5.48069365e-03f, 5.13577973e-03f, 4.76468587e-03f, 4.37642261e-03f, 3.97980027e-03f,
+  3.58311180e-03f, 3.19386460e-03f, 2.81857559e-03f, 2.46263435e-03f, 2.13023368e-03f, 1.82436442e-03f,
+  1.54686708e-03f, 1.29852840e-03f, 1.07921252e-03f, 8.88013514e-04f, 7.23417790e-04f, 5.83466433e-04f,
+  4.65907418e-04f, 3.68332810e-04f, 2.88295763e-04f, 2.23405150e-04f, 1.71397754e-04f, 1.30188957e-04f,
+  9.79039542e-05f, 7.28925879e-05f, 5.39909676e-03f, 5.37216850e-03f, 5.29218744e-03f, 5.16152289e-03f,
+  4.98399418e-03f, 4.76468587e-03f, 4.50970465e-03f, 4.22589760e-03f, 3.92054906e-03f, 3.60107236e-03f,
+  3.27471760e-03f, 2.94830860e-03f, 2.62802257e-03f, 2.31922162e-03f, 2.02634092e-03f, 1.75282999e-03f,
+  1.50115031e-03f, 1.27281586e-03f, 1.06847426e-03f, 8.88013514e-04f, 7.30688276e-04f, 5.95253252e-04f,
+  4.80096409e-04f, 3.83364764e-04f, 3.03077017e-04f, 2.37219749e-04f, 1.83825498e-04f, 1.41032011e-04f,
+  1.07123989e-04f, 8.05587697e-05f, 5.99785453e-05f, 4.39835945e-03f, 4.37642261e-03f, 4.31126636e-03f,
+  4.20482084e-03f, 4.06019762e-03f, 3.88153875e-03f, 3.67381866e-03f, 3.44261597e-03f, 3.19386460e-03f,
+  2.93360394e-03f, 2.66773999e-03f, 2.40183179e-03f, 2.14091153e-03f, 1.88934768e-03f, 1.65075320e-03f,
+  1.42793835e-03f, 1.22290803e-03f, 1.03689602e-03f, 8.70429620e-04f, 7.23417790e-04f, 5.95253252e-04f,
+  4.84921446e-04f, 3.91109235e-04f, 3.12307093e-04f, 2.46900861e-04f, 1.93250438e-04f, 1.49752945e-04f,
+  1.14891351e-04f, 8.72682722e-05f, 6.56269840e-05f, 4.88613623e-05f, 3.54745938e-03f, 3.52976634e-03f,
+  3.47721484e-03f, 3.39136203e-03f, 3.27471760e-03f, 3.13062174e-03f, 2.96308706e-03f, 2.77661253e-03f,
+  2.57598422e-03f, 2.36607296e-03f, 2.15164293e-03f, 1.93717680e-03f, 1.72673375e-03f, 1.52383721e-03f,
+  1.33140082e-03f, 1.15169142e-03f, 9.86326020e-04f, 8.36299616e-04f, 7.02037592e-04f, 5.83466433e-04f,
+  4.80096409e-04f, 3.91109235e-04f, 3.15445825e-04f, 2.51888589e-04f, 1.99135786e-04f, 1.55864487e-04f,
+  1.20781959e-04f, 9.26646389e-05f, 7.03854748e-05f, 5.29308818e-05f, 3.94087147e-05f, 2.83270376e-03f,
+  2.81857559e-03f, 2.77661253e-03f, 2.70805764e-03f, 2.61491514e-03f, 2.49985233e-03f, 2.36607296e-03f,
+  2.21717008e-03f, 2.05696514e-03f, 1.88934768e-03f, 1.71812170e-03f, 1.54686708e-03f, 1.37882493e-03f,
+  1.21680880e-03f, 1.06314512e-03f, 9.19644255e-04f, 7.87597324e-04f, 6.67798799e-04f, 5.60588378e-04f,
+  4.65907418e-04f, 3.83364764e-04f, 3.12307093e-04f, 2.51888589e-04f, 2.01137140e-04f, 1.59013158e-04f,
+  1.24460319e-04f, 9.64463543e-05f, 7.39942188e-05f, 5.62039422e-05f, 4.22661687e-05f, 3.14684949e-05f,
+  2.23945314e-03f, 2.22828379e-03f, 2.19510891e-03f, 2.14091153e-03f, 2.06727581e-03f, 1.97631028e-03f,
+  1.87054835e-03f, 1.75282999e-03f, 1.62617664e-03f, 1.49366329e-03f, 1.35829696e-03f, 1.22290803e-03f,
+  1.09005882e-03f, 9.61973506e-04f, 8.40491557e-04f, 7.27043953e-04f, 6.22651482e-04f, 5.27942262e-04f,
+  4.43184836e-04f, 3.68332810e-04f, 3.03077017e-04f, 2.46900861e-04f, 1.99135786e-04f, 1.59013158e-04f,
+  1.25711158e-04f, 9.83946957e-05f, 7.62476775e-05f, 5.84976697e-05f, 4.44331999e-05f, 3.34143988e-05f,
+  2.48780761e-05f, 1.75282999e-03f, 1.74408779e-03f, 1.71812170e-03f, 1.67570112e-03f, 1.61806610e-03f,
+  1.54686708e-03f, 1.46408670e-03f, 1.37194805e-03f, 1.27281586e-03f, 1.16909703e-03f, 1.06314512e-03f,
+  9.57175682e-04f, 8.53193982e-04f, 7.52941065e-04f, 6.57856581e-04f, 5.69060619e-04f, 4.87352139e-04f,
+  4.13222820e-04f, 3.46882793e-04f, 2.88295763e-04f, 2.37219749e-04f, 1.93250438e-04f, 1.55864487e-04f,
+  1.24460319e-04f, 9.83946957e-05f, 7.70139741e-05f, 5.96794016e-05f, 4.57863935e-05f, 3.47780660e-05f,
+  2.61536024e-05f, 1.94721833e-05f, 1.35829696e-03f, 1.35152240e-03f, 1.33140082e-03f, 1.29852840e-03f,
+  1.25386612e-03f, 1.19869283e-03f, 1.13454496e-03f, 1.06314512e-03f, 9.86326020e-04f, 9.05952533e-04f,
+  8.23848706e-04f, 7.41731201e-04f, 6.61154103e-04f, 5.83466433e-04f, 5.09783917e-04f, 4.40974458e-04f,
+  3.77657212e-04f, 3.20213177e-04f, 2.68805190e-04f, 2.23405150e-04f, 1.83825498e-04f, 1.49752945e-04f,
+  1.20781959e-04f, 9.64463543e-05f, 7.62476775e-05f, 5.96794016e-05f, 4.62465541e-05f, 3.54806289e-05f,
+  2.69500979e-05f, 2.02668580e-05f, 1.50893156e-05f, 1.04209350e-03f, 1.03689602e-03f, 1.02145865e-03f,
+  9.96238785e-04f, 9.61973506e-04f, 9.19644255e-04f, 8.70429620e-04f, 8.15651321e-04f, 7.56715192e-04f,
+  6.95052207e-04f, 6.32061623e-04f, 5.69060619e-04f, 5.07241348e-04f, 4.47638915e-04f, 3.91109235e-04f,
+  3.38318234e-04f, 2.89740856e-04f, 2.45669449e-04f, 2.06228942e-04f, 1.71397754e-04f, 1.41032011e-04f,
+  1.14891351e-04f, 9.26646389e-05f, 7.39942188e-05f, 5.84976697e-05f, 4.57863935e-05f, 3.54806289e-05f,
+  2.72209509e-05f, 2.06762761e-05f, 1.55488542e-05f, 1.15766125e-05f, 7.91545142e-04f, 7.87597324e-04f,
+  7.75871507e-04f, 7.56715192e-04f, 7.30688276e-04f, 6.98536169e-04f, 6.61154103e-04f, 6.19545986e-04f,
+  5.74779755e-04f, 5.27942262e-04f, 4.80096409e-04f, 4.32242581e-04f, 3.85286403e-04f, 3.40014056e-04f,
+  2.97075690e-04f, 2.56977102e-04f, 2.20079077e-04f, 1.86603662e-04f, 1.56645750e-04f, 1.30188957e-04f,
+  1.07123989e-04f, 8.72682722e-05f, 7.03854748e-05f, 5.62039422e-05f, 4.44331999e-05f, 3.47780660e-05f,
+  2.69500979e-05f, 2.06762761e-05f, 1.57051218e-05f, 1.18104763e-05f, 8.79327217e-06f, 5.95253252e-04f,
+  5.92284428e-04f, 5.83466433e-04f, 5.69060619e-04f, 5.49488002e-04f, 5.25309122e-04f, 4.97197325e-04f,
+  4.65907418e-04f, 4.32242581e-04f, 3.97020107e-04f, 3.61039332e-04f, 3.25052562e-04f, 2.89740856e-04f,
+  2.55695399e-04f, 2.23405150e-04f, 1.93250438e-04f, 1.65502599e-04f, 1.40328615e-04f, 1.17799842e-04f,
+  9.79039542e-05f, 8.05587697e-05f, 6.56269840e-05f, 5.29308818e-05f, 4.22661687e-05f, 3.34143988e-05f,
+  2.61536024e-05f, 2.02668580e-05f, 1.55488542e-05f, 1.18104763e-05f, 8.88164595e-06f, 6.61266631e-06f,
+  4.43184836e-04f, 4.40974458e-04f, 4.34409187e-04f, 4.23683581e-04f, 4.09111177e-04f, 3.91109235e-04f,
+  3.70179099e-04f, 3.46882793e-04f, 3.21818254e-04f, 2.95594014e-04f, 2.68805190e-04f, 2.42011913e-04f,
+  2.15721215e-04f, 1.90373306e-04f, 1.66332189e-04f, 1.43881058e-04f, 1.23221922e-04f, 1.04479084e-04f,
+  8.77057028e-05f, 7.28925879e-05f, 5.99785453e-05f, 4.88613623e-05f, 3.94087147e-05f, 3.14684949e-05f,
+  2.48780761e-05f, 1.94721833e-05f, 1.50893156e-05f, 1.15766125e-05f, 8.79327217e-06f, 6.61266631e-06f,
+  4.92333902e-06f
+};
+static const float kern_row_10[] = {
+  4.44197067e-04f, 5.96612750e-04f, 7.93353014e-04f, 1.04447361e-03f, 1.36139919e-03f, 1.75683340e-03f,
+  2.24456773e-03f, 2.83917342e-03f, 3.55556142e-03f, 4.40840516e-03f, 5.41142793e-03f, 6.57656789e-03f,
+  7.91304745e-03f, 9.42638796e-03f, 1.11174174e-02f, 1.29813412e-02f, 1.50069436e-02f, 1.71759985e-02f,
+  1.94629561e-02f, 2.18349732e-02f, 2.42523383e-02f, 2.66692974e-02f, 2.90353186e-02f, 3.12967114e-02f,
+  3.33985686e-02f, 3.52869444e-02f, 3.69111262e-02f, 3.82258892e-02f, 3.91935818e-02f, 3.97859178e-02f,
+  3.99853438e-02f, 3.97859178e-02f, 3.91935818e-02f, 3.82258892e-02f, 3.69111262e-02f, 3.52869444e-02f,
+  3.33985686e-02f, 3.12967114e-02f, 2.90353186e-02f, 2.66692974e-02f, 2.42523383e-02f, 2.18349732e-02f,
+  1.94629561e-02f, 1.71759985e-02f, 1.50069436e-02f, 1.29813412e-02f, 1.11174174e-02f, 9.42638796e-03f,
+  7.91304745e-03f, 6.57656789e-03f, 5.41142793e-03f, 4.40840516e-03f, 3.55556142e-03f, 2.83917342e-03f,
+  2.24456773e-03f, 1.75683340e-03f, 1.36139919e-03f, 1.04447361e-03f, 7.93353014e-04f, 5.96612750e-04f,
+  4.44197067e-04f
+};
+static const int kern_half_fixed_10[] = {
+  26824, 26690, 26293, 25644, 24762, 23672, 22405, 20995, 19478, 17891, 16269, 14648,
+  13057, 11522, 10067, 8708, 7458, 6324, 5308, 4412, 3630, 2957, 2385, 1905,
+  1506, 1179, 913, 701, 532, 400, 298, 26690, 26557, 26162, 25516, 24638,
+  23554, 22293, 20890, 19381, 17802, 16188, 14575, 12991, 11465, 10017, 8665, 7421,
+  6292, 5282, 4390, 3612, 2943, 2373, 1895, 1498, 1173, 909, 697, 530,
+  398, 297, 26293, 26162, 25772, 25136, 24271, 23203, 21962, 20579, 19092, 17537,
+  15947, 14358, 12798, 11294, 9868, 8536, 7310, 6198, 5203, 4324, 3558, 2899,
+  2338, 1867, 1476, 1155, 895, 687, 522, 392, 292, 25644, 25516, 25136,
+  24515, 23672, 22630, 21419, 20071, 18621, 17104, 15554, 14003, 12482, 11015, 9624,
+  8325, 7130, 6045, 5075, 4218, 3470, 2827, 2280, 1821, 1439, 1127, 873,
+  670, 509, 383, 285, 24762, 24638, 24271, 23672, 22858, 21852, 20683, 19381,
+  17981, 16515, 15019, 13522, 12053, 10637, 9293, 8039, 6885, 5837, 4900, 4073,
+  3351, 2730, 2202, 1758, 1390, 1088, 843, 647, 491, 369, 275, 23672,
+  23554, 23203, 22630, 21852, 20890, 19772, 18528, 17189, 15789, 14358, 12927, 11522,
+  10168, 8884, 7685, 6582, 5581, 4685, 3893, 3204, 2610, 2105, 1681, 1329,
+  1040, 806, 618, 470, 353, 263, 22405, 22293, 21962, 21419, 20683, 19772,
+  18714, 17537, 16269, 14944, 13589, 12235, 10906, 9624, 8409, 7274, 6229, 5282,
+  4434, 3685, 3032, 2470, 1992, 1591, 1258, 984, 763, 585, 445, 334,
+  249, 20995, 20890, 20579, 20071, 19381, 18528, 17537, 16433, 15246, 14003, 12734,
+  11465, 10219, 9019, 7880, 6816, 5837, 4950, 4155, 3453, 2841, 2315, 1867,
+  1491, 1179, 922, 715, 548, 417, 313, 233, 19478, 19381, 19092, 18621,
+  17981, 17189, 16269, 15246, 14144, 12991, 11814, 10637, 9481, 8367, 7310, 6324,
+  5416, 4592, 3855, 3204, 2636, 2147, 1732, 1383, 1093, 856, 663, 509,
+  386, 291, 216, 17891, 17802, 17537, 17104, 16515, 15789, 14944, 14003, 12991,
+  11933, 10851, 9770, 8708, 7685, 6715, 5808, 4974, 4218, 3541, 2943, 2421,
+  1972, 1591, 1270, 1004, 786, 609, 467, 355, 267, 199, 16269, 16188,
+  15947, 15554, 15019, 14358, 13589, 12734, 11814, 10851, 9868, 8884, 7919, 6989,
+  6106, 5282, 4524, 3835, 3220, 2676, 2202, 1794, 1447, 1155, 913, 715,
+  554, 425, 323, 243, 181, 14648, 14575, 14358, 14003, 13522, 12927, 12235,
+  11465, 10637, 9770, 8884, 7999, 7130, 6292, 5497, 4755, 4073, 3453, 2899,
+  2409, 1982, 1615, 1303, 1040, 822, 644, 499, 383, 291, 219, 163,
+  13057, 12991, 12798, 12482, 12053, 11522, 10906, 10219, 9481, 8708, 7919, 7130,
+  6355, 5609, 4900, 4239, 3630, 3078, 2584, 2147, 1767, 1439, 1161, 927,
+  733, 574, 445, 341, 259, 195, 145, 11522, 11465, 11294, 11015, 10637,
+  10168, 9624, 9019, 8367, 7685, 6989, 6292, 5609, 4950, 4324, 3741, 3204,
+  2716, 2280, 1895, 1559, 1270, 1025, 818, 647, 506, 392, 301, 229,
+  172, 128, 10067, 10017, 9868, 9624, 9293, 8884, 8409, 7880, 7310, 6715,
+  6106, 5497, 4900, 4324, 3778, 3268, 2799, 2373, 1992, 1656, 1362, 1110,
+  895, 715, 565, 442, 343, 263, 200, 150, 112, 8708, 8665, 8536,
+  8325, 8039, 7685, 7274, 6816, 6324, 5808, 5282, 4755, 4239, 3741, 3268,
+  2827, 2421, 2053, 1723, 1432, 1179, 960, 774, 618, 489, 383, 297,
+  227, 173, 130, 97, 7458, 7421, 7310, 7130, 6885, 6582, 6229, 5837,
+  5416, 4974, 4524, 4073, 3630, 3204, 2799, 2421, 2074, 1758, 1476, 1227,
+  1009, 822, 663, 530, 419, 328, 254, 195, 148, 111, 83, 6324,
+  6292, 6198, 6045, 5837, 5581, 5282, 4950, 4592, 4218, 3835, 3453, 3078,
+  2716, 2373, 2053, 1758, 1491, 1251, 1040, 856, 697, 562, 449, 355,
+  278, 215, 165, 125, 94, 70, 5308, 5282, 5203, 5075, 4900, 4685,
+  4434, 4155, 3855, 3541, 3220, 2899, 2584, 2280, 1992, 1723, 1476, 1251,
+  1051, 873, 718, 585, 472, 377, 298, 233, 181, 139, 105, 79,
+  59, 4412, 4390, 4324, 4218, 4073, 3893, 3685, 3453, 3204, 2943, 2676,
+  2409, 2147, 1895, 1656, 1432, 1227, 1040, 873, 726, 597, 486, 392,
+  313, 248, 194, 150, 115, 88, 66, 49, 3630, 3612, 3558, 3470,
+  3351, 3204, 3032, 2841, 2636, 2421, 2202, 1982, 1767, 1559, 1362, 1179,
+  1009, 856, 718, 597, 491, 400, 323, 258, 204, 160, 124, 95,
+  72, 54, 40, 2957, 2943, 2899, 2827, 2730, 2610, 2470, 2315, 2147,
+  1972, 1794, 1615, 1439, 1270, 1110, 960, 822, 697, 585, 486, 400,
+  326, 263, 210, 166, 130, 101, 77, 59, 44, 33, 2385, 2373,
+  2338, 2280, 2202, 2105, 1992, 1867, 1732, 1591, 1447, 1303, 1161, 1025,
+  895, 774, 663, 562, 472, 392, 323, 263, 212, 169, 134, 105,
+  81, 62, 47, 36, 26, 1905, 1895, 1867, 1821, 1758, 1681, 1591,
+  1491, 1383, 1270, 1155, 1040, 927, 818, 715, 618, 530, 449, 377,
+  313, 258, 210, 169, 135, 107, 84, 65, 50, 38, 28, 21,
+  1506, 1498, 1476, 1439, 1390, 1329, 1258, 1179, 1093, 1004, 913, 822,
+  733, 647, 565, 489, 419, 355, 298, 248, 204, 166, 134, 107,
+  85, 66, 51, 39, 30, 22, 17, 1179, 1173, 1155, 1127, 1088,
+  1040, 984, 922, 856, 786, 715, 644, 574, 506, 442, 383, 328,
+  278, 233, 194, 160, 130, 105, 84, 66, 52, 40, 31, 23,
+  18, 13, 913, 909, 895, 873, 843, 806, 763, 715, 663, 609,
+  554, 499, 445, 392, 343, 297, 254, 215, 181, 150, 124, 101,
+  81, 65, 51, 40, 31, 24, 18, 14, 10, 701, 697, 687,
+  670, 647, 618, 585, 548, 509, 467, 425, 383, 341, 301, 263,
+  227, 195, 165, 139, 115, 95, 77, 62, 50, 39, 31, 24,
+  18, 14, 10, 8, 532, 530, 522, 509, 491, 470, 445, 417,
+  386, 355, 323, 291, 259, 229, 200, 173, 148, 125, 105, 88,
+  72, 59, 47, 38, 30, 23, 18, 14, 11, 8, 6, 400,
+  398, 392, 383, 369, 353, 334, 313, 291, 267, 243, 219, 195,
+  172, 150, 130, 111, 94, 79, 66, 54, 44, 36, 28, 22,
+  18, 14, 10, 8, 6, 4, 298, 297, 292, 285, 275, 263,
+  249, 233, 216, 199, 181, 163, 145, 128, 112, 97, 83, 70,
+  59, 49, 40, 33, 26, 21, 17, 13, 10, 8, 6, 4,
+  3
+};
+static const int kern_row_fixed_10[] = {
+  7452, 10010, 13310, 17523, 22840, 29475, 37658, 47633, 59652, 73961, 90789, 110337,
+  132759, 158149, 186519, 217791, 251775, 288165, 326534, 366330, 406887, 447437, 487132, 525072,
+  560335, 592017, 619266, 641324, 657559, 667497, 670843, 667497, 657559, 641324, 619266, 592017,
+  560335, 525072, 487132, 447437, 406887, 366330, 326534, 288165, 251775, 217791, 186519, 158149,
+  132759, 110337, 90789, 73961, 59652, 47633, 37658, 29475, 22840, 17523, 13310, 10010,
+  7452
+};
+
+static const float kern_half_11[] = {
+  3.62674817e-02f, 3.61179225e-02f, 3.56729440e-02f, 3.49434614e-02f, 3.39471810e-02f, 3.27078700e-02f,
+  3.12544294e-02f, 2.96197720e-02f, 2.78395768e-02f, 2.59510148e-02f, 2.39914693e-02f, 2.19973382e-02f,
+  2.00029574e-02f, 1.80396903e-02f, 1.61352139e-02f, 1.43130170e-02f, 1.25921080e-02f, 1.09869326e-02f,
+  9.50747635e-03f, 8.15952476e-03f, 6.94504799e-03f, 5.86268352e-03f, 4.90826974e-03f, 4.07540891e-03f,
+  3.35602136e-03f, 2.74087396e-03f, 2.22005742e-03f, 1.78340555e-03f, 1.42084539e-03f, 1.12267572e-03f,
+  8.79777013e-04f, 6.83756836e-04f, 5.27037540e-04f, 4.02895297e-04f, 3.61179225e-02f, 3.59689854e-02f,
+  3.55258398e-02f, 3.47993672e-02f, 3.38071920e-02f, 3.25729921e-02f, 3.11255474e-02f, 2.94976290e-02f,
+  2.77247746e-02f, 2.58440003e-02f, 2.38925349e-02f, 2.19066273e-02f, 1.99204721e-02f, 1.79653000e-02f,
+  1.60686783e-02f, 1.42539944e-02f, 1.25401812e-02f, 1.09416256e-02f, 9.46827047e-03f, 8.12587701e-03f,
+  6.91640889e-03f, 5.83850732e-03f, 4.88802930e-03f, 4.05860320e-03f, 3.34218214e-03f, 2.72957142e-03f,
+  2.21090252e-03f, 1.77605136e-03f, 1.41498621e-03f, 1.11804612e-03f, 8.76149104e-04f, 6.80937257e-04f,
+  5.24864183e-04f, 4.01233876e-04f, 3.56729440e-02f, 3.55258398e-02f, 3.50881554e-02f, 3.43706310e-02f,
+  3.33906822e-02f, 3.21716852e-02f, 3.07420753e-02f, 2.91342139e-02f, 2.73832008e-02f, 2.55255979e-02f,
+  2.35981755e-02f, 2.16367338e-02f, 1.96750481e-02f, 1.77439637e-02f, 1.58707090e-02f, 1.40783824e-02f,
+  1.23856841e-02f, 1.08068231e-02f, 9.35161952e-03f, 8.02576542e-03f, 6.83119753e-03f, 5.76657616e-03f,
+  4.82780812e-03f, 4.00860049e-03f, 3.30100604e-03f, 2.69594253e-03f, 2.18366389e-03f, 1.75417005e-03f,
+  1.39755337e-03f, 1.10427162e-03f, 8.65354785e-04f, 6.72547962e-04f, 5.18397777e-04f, 3.96290619e-04f,
+  3.49434614e-02f, 3.47993672e-02f, 3.43706310e-02f, 3.36677805e-02f, 3.27078700e-02f, 3.15138027e-02f,
+  3.01134251e-02f, 2.85384431e-02f, 2.68232375e-02f, 2.50036214e-02f, 2.31156126e-02f, 2.11942811e-02f,
+  1.92727093e-02f, 1.73811149e-02f, 1.55461654e-02f, 1.37904910e-02f, 1.21324072e-02f, 1.05858324e-02f,
+  9.16038733e-03f, 7.86164496e-03f, 6.69150520e-03f, 5.64865442e-03f, 4.72908327e-03f, 3.92662780e-03f,
+  3.23350308e-03f, 2.64081289e-03f, 2.13900977e-03f, 1.71829876e-03f, 1.36897457e-03f, 1.08169019e-03f,
+  8.47658957e-04f, 6.58794947e-04f, 5.07796998e-04f, 3.88186803e-04f, 3.39471810e-02f, 3.38071920e-02f,
+  3.33906822e-02f, 3.27078700e-02f, 3.17753255e-02f, 3.06153037e-02f, 2.92548519e-02f, 2.77247746e-02f,
+  2.60584727e-02f, 2.42907349e-02f, 2.24565566e-02f, 2.05900054e-02f, 1.87232196e-02f, 1.68855581e-02f,
+  1.51029248e-02f, 1.33973071e-02f, 1.17864963e-02f, 1.02840168e-02f, 8.89921281e-03f, 7.63749937e-03f,
+  6.50072191e-03f, 5.48760407e-03f, 4.59425105e-03f, 3.81467468e-03f, 3.14131170e-03f, 2.56551988e-03f,
+  2.07802374e-03f, 1.66930782e-03f, 1.32994330e-03f, 1.05084979e-03f, 8.23491137e-04f, 6.40011858e-04f,
+  4.93319007e-04f, 3.77119111e-04f, 3.27078700e-02f, 3.25729921e-02f, 3.21716852e-02f, 3.15138027e-02f,
+  3.06153037e-02f, 2.94976290e-02f, 2.81868447e-02f, 2.67126262e-02f, 2.51071546e-02f, 2.34039538e-02f,
+  2.16367338e-02f, 1.98383257e-02f, 1.80396903e-02f, 1.62691157e-02f, 1.45515623e-02f, 1.29082110e-02f,
+  1.13562066e-02f, 9.90857743e-03f, 8.57432839e-03f, 7.35867675e-03f, 6.26339996e-03f, 5.28726773e-03f,
+  4.42652870e-03f, 3.67541215e-03f, 3.02663189e-03f, 2.47186050e-03f, 2.00216123e-03f, 1.60836638e-03f,
+  1.28139113e-03f, 1.01248641e-03f, 7.93427927e-04f, 6.16646896e-04f, 4.75309411e-04f, 3.63351603e-04f,
+  3.12544294e-02f, 3.11255474e-02f, 3.07420753e-02f, 3.01134251e-02f, 2.92548519e-02f, 2.81868447e-02f,
+  2.69343071e-02f, 2.55255979e-02f, 2.39914693e-02f, 2.23639533e-02f, 2.06752643e-02f, 1.89567711e-02f,
+  1.72380619e-02f, 1.55461654e-02f, 1.39049347e-02f, 1.23346094e-02f, 1.08515713e-02f, 9.46827047e-03f,
+  8.19331128e-03f, 7.03167962e-03f, 5.98507328e-03f, 5.05231787e-03f, 4.22982732e-03f, 3.51208798e-03f,
+  2.89213751e-03f, 2.36201845e-03f, 1.91319140e-03f, 1.53689540e-03f, 1.22444995e-03f, 9.67494561e-04f,
+  7.58170383e-04f, 5.89244999e-04f, 4.54188121e-04f, 3.47205350e-04f, 2.96197720e-02f, 2.94976290e-02f,
+  2.91342139e-02f, 2.85384431e-02f, 2.77247746e-02f, 2.67126262e-02f, 2.55255979e-02f, 2.41905674e-02f,
+  2.27366760e-02f, 2.11942811e-02f, 1.95939131e-02f, 1.79653000e-02f, 1.63364820e-02f, 1.47330761e-02f,
+  1.31776836e-02f, 1.16894888e-02f, 1.02840168e-02f, 8.97306483e-03f, 7.76478788e-03f, 6.66391151e-03f,
+  5.67204412e-03f, 4.78807325e-03f, 4.00860049e-03f, 3.32839997e-03f, 2.74087396e-03f, 2.23848107e-03f,
+  1.81312836e-03f, 1.45651330e-03f, 1.16040919e-03f, 9.16893012e-04f, 7.18516822e-04f, 5.58426487e-04f,
+  4.30433342e-04f, 3.29045957e-04f, 2.78395768e-02f, 2.77247746e-02f, 2.73832008e-02f, 2.68232375e-02f,
+  2.60584727e-02f, 2.51071546e-02f, 2.39914693e-02f, 2.27366760e-02f, 2.13701669e-02f, 1.99204721e-02f,
+  1.84162892e-02f, 1.68855581e-02f, 1.53546343e-02f, 1.38475951e-02f, 1.23856841e-02f, 1.09869326e-02f,
+  9.66593064e-03f, 8.43376946e-03f, 7.29811192e-03f, 6.26339996e-03f, 5.33114513e-03f, 4.50030249e-03f,
+  3.76767712e-03f, 3.12835793e-03f, 2.57614325e-03f, 2.10394477e-03f, 1.70415640e-03f, 1.36897457e-03f,
+  1.09066674e-03f, 8.61786306e-04f, 6.75332849e-04f, 5.24864183e-04f, 4.04563616e-04f, 3.09269759e-04f,
+  2.59510148e-02f, 2.58440003e-02f, 2.55255979e-02f, 2.50036214e-02f, 2.42907349e-02f, 2.34039538e-02f,
+  2.23639533e-02f, 2.11942811e-02f, 1.99204721e-02f, 1.85691193e-02f, 1.71669777e-02f, 1.57400873e-02f,
+  1.43130170e-02f, 1.29082110e-02f, 1.15454728e-02f, 1.02416081e-02f, 9.01021995e-03f, 7.86164496e-03f,
+  6.80302782e-03f, 5.83850732e-03f, 4.96949488e-03f, 4.19501401e-03f, 3.51208798e-03f, 2.91613862e-03f,
+  2.40138453e-03f, 1.96121866e-03f, 1.58855098e-03f, 1.27610704e-03f, 1.01667887e-03f, 8.03325034e-04f,
+  6.29520102e-04f, 4.89258789e-04f, 3.77119111e-04f, 2.88289739e-04f, 2.39914693e-02f, 2.38925349e-02f,
+  2.35981755e-02f, 2.31156126e-02f, 2.24565566e-02f, 2.16367338e-02f, 2.06752643e-02f, 1.95939131e-02f,
+  1.84162892e-02f, 1.71669777e-02f, 1.58707090e-02f, 1.45515623e-02f, 1.32322498e-02f, 1.19335195e-02f,
+  1.06736813e-02f, 9.46827047e-03f, 8.32986366e-03f, 7.26801669e-03f, 6.28933497e-03f, 5.39764529e-03f,
+  4.59425105e-03f, 3.87825095e-03f, 3.24689224e-03f, 2.69594253e-03f, 2.22005742e-03f, 1.81312836e-03f,
+  1.46860047e-03f, 1.17974891e-03f, 9.39910067e-04f, 7.42666423e-04f, 5.81985398e-04f, 4.52315173e-04f,
+  3.48643051e-04f, 2.66521150e-04f, 2.19973382e-02f, 2.19066273e-02f, 2.16367338e-02f, 2.11942811e-02f,
+  2.05900054e-02f, 1.98383257e-02f, 1.89567711e-02f, 1.79653000e-02f, 1.68855581e-02f, 1.57400873e-02f,
+  1.45515623e-02f, 1.33420601e-02f, 1.21324072e-02f, 1.09416256e-02f, 9.78650246e-03f, 8.68128333e-03f,
+  7.63749937e-03f, 6.66391151e-03f, 5.76657616e-03f, 4.94900206e-03f, 4.21238458e-03f, 3.55589716e-03f,
+  2.97701615e-03f, 2.47186050e-03f, 2.03552982e-03f, 1.66242407e-03f, 1.34653284e-03f, 1.08169019e-03f,
+  8.61786306e-04f, 6.80937257e-04f, 5.33611747e-04f, 4.14719485e-04f, 3.19664425e-04f, 2.44368362e-04f,
+  2.00029574e-02f, 1.99204721e-02f, 1.96750481e-02f, 1.92727093e-02f, 1.87232196e-02f, 1.80396903e-02f,
+  1.72380619e-02f, 1.63364820e-02f, 1.53546343e-02f, 1.43130170e-02f, 1.32322498e-02f, 1.21324072e-02f,
+  1.10324267e-02f, 9.94960684e-03f, 8.89921281e-03f, 7.89419841e-03f, 6.94504799e-03f, 6.05972996e-03f,
+  5.24375169e-03f, 4.50030249e-03f, 3.83047038e-03f, 3.23350308e-03f, 2.70710606e-03f, 2.24775006e-03f,
+  1.85097929e-03f, 1.51170103e-03f, 1.22444995e-03f, 9.83619131e-04f, 7.83652766e-04f, 6.19200291e-04f,
+  4.85232013e-04f, 3.77119111e-04f, 2.90682161e-04f, 2.22212795e-04f, 1.80396903e-02f, 1.79653000e-02f,
+  1.77439637e-02f, 1.73811149e-02f, 1.68855581e-02f, 1.62691157e-02f, 1.55461654e-02f, 1.47330761e-02f,
+  1.38475951e-02f, 1.29082110e-02f, 1.19335195e-02f, 1.09416256e-02f, 9.94960684e-03f, 8.97306483e-03f,
+  8.02576542e-03f, 7.11939158e-03f, 6.26339996e-03f, 5.46497479e-03f, 4.72908327e-03f, 4.05860320e-03f,
+  3.45451408e-03f, 2.91613862e-03f, 2.44140672e-03f, 2.02713604e-03f, 1.66930782e-03f, 1.36332936e-03f,
+  1.10427162e-03f, 8.87078058e-04f, 7.06738152e-04f, 5.58426487e-04f, 4.37607057e-04f, 3.40105296e-04f,
+  2.62152054e-04f, 2.00402865e-04f, 1.61352139e-02f, 1.60686783e-02f, 1.58707090e-02f, 1.55461654e-02f,
+  1.51029248e-02f, 1.45515623e-02f, 1.39049347e-02f, 1.31776836e-02f, 1.23856841e-02f, 1.15454728e-02f,
+  1.06736813e-02f, 9.78650246e-03f, 8.89921281e-03f, 8.02576542e-03f, 7.17847375e-03f, 6.36778725e-03f,
+  5.60216373e-03f, 4.88802930e-03f, 4.22982732e-03f, 3.63013055e-03f, 3.08981608e-03f, 2.60827760e-03f,
+  2.18366389e-03f, 1.81312836e-03f, 1.49307656e-03f, 1.21940067e-03f, 9.87692038e-04f, 7.93427927e-04f,
+  6.32126757e-04f, 4.99472604e-04f, 3.91408248e-04f, 3.04199901e-04f, 2.34476276e-04f, 1.79246039e-04f,
+  1.43130170e-02f, 1.42539944e-02f, 1.40783824e-02f, 1.37904910e-02f, 1.33973071e-02f, 1.29082110e-02f,
+  1.23346094e-02f, 1.16894888e-02f, 1.09869326e-02f, 1.02416081e-02f, 9.46827047e-03f, 8.68128333e-03f,
+  7.89419841e-03f, 7.11939158e-03f, 6.36778725e-03f, 5.64865442e-03f, 4.96949488e-03f, 4.33600973e-03f,
+  3.75214033e-03f, 3.22016911e-03f, 2.74087396e-03f, 2.31371704e-03f, 1.93705619e-03f, 1.60836638e-03f,
+  1.32445910e-03f, 1.08169019e-03f, 8.76149104e-04f, 7.03823753e-04f, 5.60738845e-04f, 4.43065714e-04f,
+  3.47205350e-04f, 2.69845710e-04f, 2.07996185e-04f, 1.59003263e-04f, 1.25921080e-02f, 1.25401812e-02f,
+  1.23856841e-02f, 1.21324072e-02f, 1.17864963e-02f, 1.13562066e-02f, 1.08515713e-02f, 1.02840168e-02f,
+  9.66593064e-03f, 9.01021995e-03f, 8.32986366e-03f, 7.63749937e-03f, 6.94504799e-03f, 6.26339996e-03f,
+  5.60216373e-03f, 4.96949488e-03f, 4.37199324e-03f, 3.81467468e-03f, 3.30100604e-03f, 2.83299573e-03f,
+  2.41132802e-03f, 2.03552982e-03f, 1.70415640e-03f, 1.41498621e-03f, 1.16521423e-03f, 9.51634371e-04f,
+  7.70806277e-04f, 6.19200291e-04f, 4.93319007e-04f, 3.89794208e-04f, 3.05459514e-04f, 2.37401109e-04f,
+  1.82987991e-04f, 1.39885684e-04f, 1.09869326e-02f, 1.09416256e-02f, 1.08068231e-02f, 1.05858324e-02f,
+  1.02840168e-02f, 9.90857743e-03f, 9.46827047e-03f, 8.97306483e-03f, 8.43376946e-03f, 7.86164496e-03f,
+  7.26801669e-03f, 6.66391151e-03f, 6.05972996e-03f, 5.46497479e-03f, 4.88802930e-03f, 4.33600973e-03f,
+  3.81467468e-03f, 3.32839997e-03f, 2.88021122e-03f, 2.47186050e-03f, 2.10394477e-03f, 1.77605136e-03f,
+  1.48691959e-03f, 1.23461126e-03f, 1.01667887e-03f, 8.30325065e-04f, 6.72547962e-04f, 5.40267909e-04f,
+  4.30433342e-04f, 3.40105296e-04f, 2.66521150e-04f, 2.07138466e-04f, 1.59661649e-04f, 1.22053796e-04f,
+  9.50747635e-03f, 9.46827047e-03f, 9.35161952e-03f, 9.16038733e-03f, 8.89921281e-03f, 8.57432839e-03f,
+  8.19331128e-03f, 7.76478788e-03f, 7.29811192e-03f, 6.80302782e-03f, 6.28933497e-03f, 5.76657616e-03f,
+  5.24375169e-03f, 4.72908327e-03f, 4.22982732e-03f, 3.75214033e-03f, 3.30100604e-03f, 2.88021122e-03f,
+  2.49237358e-03f, 2.13900977e-03f, 1.82063610e-03f, 1.53689540e-03f, 1.28669699e-03f, 1.06836355e-03f,
+  8.79777013e-04f, 7.18516822e-04f, 5.81985398e-04f, 4.67517646e-04f, 3.72472918e-04f, 2.94308091e-04f,
+  2.30632490e-04f, 1.79246039e-04f, 1.38162257e-04f, 1.05618521e-04f, 8.15952476e-03f, 8.12587701e-03f,
+  8.02576542e-03f, 7.86164496e-03f, 7.63749937e-03f, 7.35867675e-03f, 7.03167962e-03f, 6.66391151e-03f,
+  6.26339996e-03f, 5.83850732e-03f, 5.39764529e-03f, 4.94900206e-03f, 4.50030249e-03f, 4.05860320e-03f,
+  3.63013055e-03f, 3.22016911e-03f, 2.83299573e-03f, 2.47186050e-03f, 2.13900977e-03f, 1.83574506e-03f,
+  1.56250980e-03f, 1.31899735e-03f, 1.10427162e-03f, 9.16893012e-04f, 7.55043933e-04f, 6.16646896e-04f,
+  4.99472604e-04f, 4.01233876e-04f, 3.19664425e-04f, 2.52581667e-04f, 1.97933870e-04f, 1.53832880e-04f,
+  1.18573880e-04f, 9.06441346e-05f, 6.94504799e-03f, 6.91640889e-03f, 6.83119753e-03f, 6.69150520e-03f,
+  6.50072191e-03f, 6.26339996e-03f, 5.98507328e-03f, 5.67204412e-03f, 5.33114513e-03f, 4.96949488e-03f,
+  4.59425105e-03f, 4.21238458e-03f, 3.83047038e-03f, 3.45451408e-03f, 3.08981608e-03f, 2.74087396e-03f,
+  2.41132802e-03f, 2.10394477e-03f, 1.82063610e-03f, 1.56250980e-03f, 1.32994330e-03f, 1.12267572e-03f,
+  9.39910067e-04f, 7.80421193e-04f, 6.42661995e-04f, 5.24864183e-04f, 4.25130333e-04f, 3.41513602e-04f,
+  2.72085075e-04f, 2.14986998e-04f, 1.68473067e-04f, 1.30936154e-04f, 1.00925157e-04f, 7.71525156e-05f,
+  5.86268352e-03f, 5.83850732e-03f, 5.76657616e-03f, 5.64865442e-03f, 5.48760407e-03f, 5.28726773e-03f,
+  5.05231787e-03f, 4.78807325e-03f, 4.50030249e-03f, 4.19501401e-03f, 3.87825095e-03f, 3.55589716e-03f,
+  3.23350308e-03f, 2.91613862e-03f, 2.60827760e-03f, 2.31371704e-03f, 2.03552982e-03f, 1.77605136e-03f,
+  1.53689540e-03f, 1.31899735e-03f, 1.12267572e-03f, 9.47710127e-04f, 7.93427927e-04f, 6.58794947e-04f,
+  5.42505062e-04f, 4.43065714e-04f, 3.58875055e-04f, 2.88289739e-04f, 2.29681435e-04f, 1.81481926e-04f,
+  1.42217061e-04f, 1.10530149e-04f, 8.51962759e-05f, 6.51285300e-05f, 4.90826974e-03f, 4.88802930e-03f,
+  4.82780812e-03f, 4.72908327e-03f, 4.59425105e-03f, 4.42652870e-03f, 4.22982732e-03f, 4.00860049e-03f,
+  3.76767712e-03f, 3.51208798e-03f, 3.24689224e-03f, 2.97701615e-03f, 2.70710606e-03f, 2.44140672e-03f,
+  2.18366389e-03f, 1.93705619e-03f, 1.70415640e-03f, 1.48691959e-03f, 1.28669699e-03f, 1.10427162e-03f,
+  9.39910067e-04f, 7.93427927e-04f, 6.64262043e-04f, 5.51546633e-04f, 4.54188121e-04f, 3.70936963e-04f,
+  3.00452084e-04f, 2.41357702e-04f, 1.92290521e-04f, 1.51937638e-04f, 1.19064869e-04f, 9.25364293e-05f,
+  7.13267727e-05f, 5.45259500e-05f, 4.07540891e-03f, 4.05860320e-03f, 4.00860049e-03f, 3.92662780e-03f,
+  3.81467468e-03f, 3.67541215e-03f, 3.51208798e-03f, 3.32839997e-03f, 3.12835793e-03f, 2.91613862e-03f,
+  2.69594253e-03f, 2.47186050e-03f, 2.24775006e-03f, 2.02713604e-03f, 1.81312836e-03f, 1.60836638e-03f,
+  1.41498621e-03f, 1.23461126e-03f, 1.06836355e-03f, 9.16893012e-04f, 7.80421193e-04f, 6.58794947e-04f,
+  5.51546633e-04f, 4.57957300e-04f, 3.77119111e-04f, 3.07994429e-04f, 2.49469798e-04f, 2.00402865e-04f,
+  1.59661649e-04f, 1.26156068e-04f, 9.88613247e-05f, 7.68343598e-05f, 5.92236756e-05f, 4.52737040e-05f,
+  3.35602136e-03f, 3.34218214e-03f, 3.30100604e-03f, 3.23350308e-03f, 3.14131170e-03f, 3.02663189e-03f,
+  2.89213751e-03f, 2.74087396e-03f, 2.57614325e-03f, 2.40138453e-03f, 2.22005742e-03f, 2.03552982e-03f,
+  1.85097929e-03f, 1.66930782e-03f, 1.49307656e-03f, 1.32445910e-03f, 1.16521423e-03f, 1.01667887e-03f,
+  8.79777013e-04f, 7.55043933e-04f, 6.42661995e-04f, 5.42505062e-04f, 4.54188121e-04f, 3.77119111e-04f,
+  3.10550386e-04f, 2.53627542e-04f, 2.05433636e-04f, 1.65027930e-04f, 1.31478329e-04f, 1.03887112e-04f,
+  8.14104133e-05f, 6.32716328e-05f, 4.87695688e-05f, 3.72820323e-05f, 2.74087396e-03f, 2.72957142e-03f,
+  2.69594253e-03f, 2.64081289e-03f, 2.56551988e-03f, 2.47186050e-03f, 2.36201845e-03f, 2.23848107e-03f,
+  2.10394477e-03f, 1.96121866e-03f, 1.81312836e-03f, 1.66242407e-03f, 1.51170103e-03f, 1.36332936e-03f,
+  1.21940067e-03f, 1.08169019e-03f, 9.51634371e-04f, 8.30325065e-04f, 7.18516822e-04f, 6.16646896e-04f,
+  5.24864183e-04f, 4.43065714e-04f, 3.70936963e-04f, 3.07994429e-04f, 2.53627542e-04f, 2.07138466e-04f,
+  1.67778344e-04f, 1.34778864e-04f, 1.07378793e-04f, 8.48449563e-05f, 6.64881591e-05f, 5.16741529e-05f,
+  3.98302691e-05f, 3.04483601e-05f, 2.22005742e-03f, 2.21090252e-03f, 2.18366389e-03f, 2.13900977e-03f,
+  2.07802374e-03f, 2.00216123e-03f, 1.91319140e-03f, 1.81312836e-03f, 1.70415640e-03f, 1.58855098e-03f,
+  1.46860047e-03f, 1.34653284e-03f, 1.22444995e-03f, 1.10427162e-03f, 9.87692038e-04f, 8.76149104e-04f,
+  7.70806277e-04f, 6.72547962e-04f, 5.81985398e-04f, 4.99472604e-04f, 4.25130333e-04f, 3.58875055e-04f,
+  3.00452084e-04f, 2.49469798e-04f, 2.05433636e-04f, 1.67778344e-04f, 1.35897353e-04f, 1.09168395e-04f,
+  8.69748401e-05f, 6.87228458e-05f, 5.38541826e-05f, 4.18551135e-05f, 3.22617852e-05f, 2.46626096e-05f,
+  1.78340555e-03f, 1.77605136e-03f, 1.75417005e-03f, 1.71829876e-03f, 1.66930782e-03f, 1.60836638e-03f,
+  1.53689540e-03f, 1.45651330e-03f, 1.36897457e-03f, 1.27610704e-03f, 1.17974891e-03f, 1.08169019e-03f,
+  9.83619131e-04f, 8.87078058e-04f, 7.93427927e-04f, 7.03823753e-04f, 6.19200291e-04f, 5.40267909e-04f,
+  4.67517646e-04f, 4.01233876e-04f, 3.41513602e-04f, 2.88289739e-04f, 2.41357702e-04f, 2.00402865e-04f,
+  1.65027930e-04f, 1.34778864e-04f, 1.09168395e-04f, 8.76966224e-05f, 6.98682052e-05f, 5.52060992e-05f,
+  4.32618763e-05f, 3.36228441e-05f, 2.59163771e-05f, 1.98118469e-05f, 1.42084539e-03f, 1.41498621e-03f,
+  1.39755337e-03f, 1.36897457e-03f, 1.32994330e-03f, 1.28139113e-03f, 1.22444995e-03f, 1.16040919e-03f,
+  1.09066674e-03f, 1.01667887e-03f, 9.39910067e-04f, 8.61786306e-04f, 7.83652766e-04f, 7.06738152e-04f,
+  6.32126757e-04f, 5.60738845e-04f, 4.93319007e-04f, 4.30433342e-04f, 3.72472918e-04f, 3.19664425e-04f,
+  2.72085075e-04f, 2.29681435e-04f, 1.92290521e-04f, 1.59661649e-04f, 1.31478329e-04f, 1.07378793e-04f,
+  8.69748401e-05f, 6.98682052e-05f, 5.56642372e-05f, 4.39828909e-05f, 3.44668879e-05f, 2.67874348e-05f,
+  2.06476670e-05f, 1.57841660e-05f, 1.12267572e-03f, 1.11804612e-03f, 1.10427162e-03f, 1.08169019e-03f,
+  1.05084979e-03f, 1.01248641e-03f, 9.67494561e-04f, 9.16893012e-04f, 8.61786306e-04f, 8.03325034e-04f,
+  7.42666423e-04f, 6.80937257e-04f, 6.19200291e-04f, 5.58426487e-04f, 4.99472604e-04f, 4.43065714e-04f,
+  3.89794208e-04f, 3.40105296e-04f, 2.94308091e-04f, 2.52581667e-04f, 2.14986998e-04f, 1.81481926e-04f,
+  1.51937638e-04f, 1.26156068e-04f, 1.03887112e-04f, 8.48449563e-05f, 6.87228458e-05f, 5.52060992e-05f,
+  4.39828909e-05f, 3.47529167e-05f, 2.72338821e-05f, 2.11659917e-05f, 1.63146779e-05f, 1.24718008e-05f,
+  8.79777013e-04f, 8.76149104e-04f, 8.65354785e-04f, 8.47658957e-04f, 8.23491137e-04f, 7.93427927e-04f,
+  7.58170383e-04f, 7.18516822e-04f, 6.75332849e-04f, 6.29520102e-04f, 5.81985398e-04f, 5.33611747e-04f,
+  4.85232013e-04f, 4.37607057e-04f, 3.91408248e-04f, 3.47205350e-04f, 3.05459514e-04f, 2.66521150e-04f,
+  2.30632490e-04f, 1.97933870e-04f, 1.68473067e-04f, 1.42217061e-04f, 1.19064869e-04f, 9.88613247e-05f,
+  8.14104133e-05f, 6.64881591e-05f, 5.38541826e-05f, 4.32618763e-05f, 3.44668879e-05f, 2.72338821e-05f,
+  2.13416424e-05f, 1.65865822e-05f, 1.27848843e-05f, 9.77344007e-06f, 6.83756836e-04f, 6.80937257e-04f,
+  6.72547962e-04f, 6.58794947e-04f, 6.40011858e-04f, 6.16646896e-04f, 5.89244999e-04f, 5.58426487e-04f,
+  5.24864183e-04f, 4.89258789e-04f, 4.52315173e-04f, 4.14719485e-04f, 3.77119111e-04f, 3.40105296e-04f,
+  3.04199901e-04f, 2.69845710e-04f, 2.37401109e-04f, 2.07138466e-04f, 1.79246039e-04f, 1.53832880e-04f,
+  1.30936154e-04f, 1.10530149e-04f, 9.25364293e-05f, 7.68343598e-05f, 6.32716328e-05f, 5.16741529e-05f,
+  4.18551135e-05f, 3.36228441e-05f, 2.67874348e-05f, 2.11659917e-05f, 1.65865822e-05f, 1.28909824e-05f,
+  9.93632693e-06f, 7.59585237e-06f, 5.27037540e-04f, 5.24864183e-04f, 5.18397777e-04f, 5.07796998e-04f,
+  4.93319007e-04f, 4.75309411e-04f, 4.54188121e-04f, 4.30433342e-04f, 4.04563616e-04f, 3.77119111e-04f,
+  3.48643051e-04f, 3.19664425e-04f, 2.90682161e-04f, 2.62152054e-04f, 2.34476276e-04f, 2.07996185e-04f,
+  1.82987991e-04f, 1.59661649e-04f, 1.38162257e-04f, 1.18573880e-04f, 1.00925157e-04f, 8.51962759e-05f,
+  7.13267727e-05f, 5.92236756e-05f, 4.87695688e-05f, 3.98302691e-05f, 3.22617852e-05f, 2.59163771e-05f,
+  2.06476670e-05f, 1.63146779e-05f, 1.27848843e-05f, 9.93632693e-06f, 7.65888853e-06f, 5.85485850e-06f,
+  4.02895297e-04f, 4.01233876e-04f, 3.96290619e-04f, 3.88186803e-04f, 3.77119111e-04f, 3.63351603e-04f,
+  3.47205350e-04f, 3.29045957e-04f, 3.09269759e-04f, 2.88289739e-04f, 2.66521150e-04f, 2.44368362e-04f,
+  2.22212795e-04f, 2.00402865e-04f, 1.79246039e-04f, 1.59003263e-04f, 1.39885684e-04f, 1.22053796e-04f,
+  1.05618521e-04f, 9.06441346e-05f, 7.71525156e-05f, 6.51285300e-05f, 5.45259500e-05f, 4.52737040e-05f,
+  3.72820323e-05f, 3.04483601e-05f, 2.46626096e-05f, 1.98118469e-05f, 1.57841660e-05f, 1.24718008e-05f,
+  9.77344007e-06f, 7.59585237e-06f, 5.85485850e-06f, 4.47576258e-06f
+};
+static const float kern_row_11[] = {
+  4.03830258e-04f, 5.28260600e-04f, 6.85343577e-04f, 8.81818589e-04f, 1.12528098e-03f, 1.42414263e-03f,
+  1.78754411e-03f, 2.22520926e-03f, 2.74723442e-03f, 3.36380932e-03f, 4.08486603e-03f, 4.91965981e-03f,
+  5.87628828e-03f, 6.96116453e-03f, 8.17845948e-03f, 9.52953938e-03f, 1.10124284e-02f, 1.26213282e-02f,
+  1.43462317e-02f, 1.61726568e-02f, 1.80815533e-02f, 2.00493764e-02f, 2.20483858e-02f, 2.40471438e-02f,
+  2.60112360e-02f, 2.79041808e-02f, 2.96885073e-02f, 3.13269570e-02f, 3.27837691e-02f, 3.40259559e-02f,
+  3.50245498e-02f, 3.57557274e-02f, 3.62017378e-02f, 3.63516398e-02f, 3.62017378e-02f, 3.57557274e-02f,
+  3.50245498e-02f, 3.40259559e-02f, 3.27837691e-02f, 3.13269570e-02f, 2.96885073e-02f, 2.79041808e-02f,
+  2.60112360e-02f, 2.40471438e-02f, 2.20483858e-02f, 2.00493764e-02f, 1.80815533e-02f, 1.61726568e-02f,
+  1.43462317e-02f, 1.26213282e-02f, 1.10124284e-02f, 9.52953938e-03f, 8.17845948e-03f, 6.96116453e-03f,
+  5.87628828e-03f, 4.91965981e-03f, 4.08486603e-03f, 3.36380932e-03f, 2.74723442e-03f, 2.22520926e-03f,
+  1.78754411e-03f, 1.42414263e-03f, 1.12528098e-03f, 8.81818589e-04f, 6.85343577e-04f, 5.28260600e-04f,
+  4.03830258e-04f
+};
+static const int kern_half_fixed_11[] = {
+  22170, 22079, 21807, 21361, 20752, 19994, 19106, 18106, 17018, 15864, 14666, 13447,
+  12228, 11028, 9863, 8749, 7697, 6716, 5812, 4988, 4245, 3584, 3000, 2491,
+  2052, 1675, 1357, 1090, 869, 686, 538, 418, 322, 246, 22079, 21988,
+  21717, 21273, 20666, 19912, 19027, 18032, 16948, 15798, 14605, 13391, 12177, 10982,
+  9823, 8713, 7666, 6689, 5788, 4967, 4228, 3569, 2988, 2481, 2043, 1669,
+  1352, 1086, 865, 683, 536, 416, 321, 245, 21807, 21717, 21449, 21010,
+  20411, 19666, 18792, 17810, 16739, 15604, 14425, 13226, 12027, 10847, 9702, 8606,
+  7571, 6606, 5717, 4906, 4176, 3525, 2951, 2450, 2018, 1648, 1335, 1072,
+  854, 675, 529, 411, 317, 242, 21361, 21273, 21010, 20581, 19994, 19264,
+  18408, 17445, 16397, 15285, 14130, 12956, 11781, 10625, 9503, 8430, 7416, 6471,
+  5600, 4806, 4090, 3453, 2891, 2400, 1977, 1614, 1308, 1050, 837, 661,
+  518, 403, 310, 237, 20752, 20666, 20411, 19994, 19424, 18715, 17883, 16948,
+  15929, 14849, 13728, 12587, 11445, 10322, 9232, 8190, 7205, 6287, 5440, 4669,
+  3974, 3355, 2808, 2332, 1920, 1568, 1270, 1020, 813, 642, 503, 391,
+  302, 231, 19994, 19912, 19666, 19264, 18715, 18032, 17230, 16329, 15348, 14307,
+  13226, 12127, 11028, 9945, 8895, 7891, 6942, 6057, 5241, 4498, 3829, 3232,
+  2706, 2247, 1850, 1511, 1224, 983, 783, 619, 485, 377, 291, 222,
+  19106, 19027, 18792, 18408, 17883, 17230, 16465, 15604, 14666, 13671, 12639, 11588,
+  10537, 9503, 8500, 7540, 6633, 5788, 5009, 4298, 3659, 3088, 2586, 2147,
+  1768, 1444, 1170, 939, 748, 591, 463, 360, 278, 212, 18106, 18032,
+  17810, 17445, 16948, 16329, 15604, 14787, 13899, 12956, 11978, 10982, 9986, 9006,
+  8055, 7146, 6287, 5485, 4747, 4074, 3467, 2927, 2450, 2035, 1675, 1368,
+  1108, 890, 709, 560, 439, 341, 263, 201, 17018, 16948, 16739, 16397,
+  15929, 15348, 14666, 13899, 13063, 12177, 11258, 10322, 9386, 8465, 7571, 6716,
+  5909, 5155, 4461, 3829, 3259, 2751, 2303, 1912, 1575, 1286, 1042, 837,
+  667, 527, 413, 321, 247, 189, 15864, 15798, 15604, 15285, 14849, 14307,
+  13671, 12956, 12177, 11351, 10494, 9622, 8749, 7891, 7058, 6261, 5508, 4806,
+  4159, 3569, 3038, 2564, 2147, 1783, 1468, 1199, 971, 780, 621, 491,
+  385, 299, 231, 176, 14666, 14605, 14425, 14130, 13728, 13226, 12639, 11978,
+  11258, 10494, 9702, 8895, 8089, 7295, 6525, 5788, 5092, 4443, 3845, 3300,
+  2808, 2371, 1985, 1648, 1357, 1108, 898, 721, 575, 454, 356, 276,
+  213, 163, 13447, 13391, 13226, 12956, 12587, 12127, 11588, 10982, 10322, 9622,
+  8895, 8156, 7416, 6689, 5982, 5307, 4669, 4074, 3525, 3025, 2575, 2174,
+  1820, 1511, 1244, 1016, 823, 661, 527, 416, 326, 254, 195, 149,
+  12228, 12177, 12027, 11781, 11445, 11028, 10537, 9986, 9386, 8749, 8089, 7416,
+  6744, 6082, 5440, 4826, 4245, 3704, 3205, 2751, 2342, 1977, 1655, 1374,
+  1131, 924, 748, 601, 479, 379, 297, 231, 178, 136, 11028, 10982,
+  10847, 10625, 10322, 9945, 9503, 9006, 8465, 7891, 7295, 6689, 6082, 5485,
+  4906, 4352, 3829, 3341, 2891, 2481, 2112, 1783, 1492, 1239, 1020, 833,
+  675, 542, 432, 341, 268, 208, 160, 123, 9863, 9823, 9702, 9503,
+  9232, 8895, 8500, 8055, 7571, 7058, 6525, 5982, 5440, 4906, 4388, 3893,
+  3425, 2988, 2586, 2219, 1889, 1594, 1335, 1108, 913, 745, 604, 485,
+  386, 305, 239, 186, 143, 110, 8749, 8713, 8606, 8430, 8190, 7891,
+  7540, 7146, 6716, 6261, 5788, 5307, 4826, 4352, 3893, 3453, 3038, 2651,
+  2294, 1968, 1675, 1414, 1184, 983, 810, 661, 536, 430, 343, 271,
+  212, 165, 127, 97, 7697, 7666, 7571, 7416, 7205, 6942, 6633, 6287,
+  5909, 5508, 5092, 4669, 4245, 3829, 3425, 3038, 2673, 2332, 2018, 1732,
+  1474, 1244, 1042, 865, 712, 582, 471, 379, 302, 238, 187, 145,
+  112, 86, 6716, 6689, 6606, 6471, 6287, 6057, 5788, 5485, 5155, 4806,
+  4443, 4074, 3704, 3341, 2988, 2651, 2332, 2035, 1761, 1511, 1286, 1086,
+  909, 755, 621, 508, 411, 330, 263, 208, 163, 127, 98, 75,
+  5812, 5788, 5717, 5600, 5440, 5241, 5009, 4747, 4461, 4159, 3845, 3525,
+  3205, 2891, 2586, 2294, 2018, 1761, 1524, 1308, 1113, 939, 787, 653,
+  538, 439, 356, 286, 228, 180, 141, 110, 84, 65, 4988, 4967,
+  4906, 4806, 4669, 4498, 4298, 4074, 3829, 3569, 3300, 3025, 2751, 2481,
+  2219, 1968, 1732, 1511, 1308, 1122, 955, 806, 675, 560, 462, 377,
+  305, 245, 195, 154, 121, 94, 72, 55, 4245, 4228, 4176, 4090,
+  3974, 3829, 3659, 3467, 3259, 3038, 2808, 2575, 2342, 2112, 1889, 1675,
+  1474, 1286, 1113, 955, 813, 686, 575, 477, 393, 321, 260, 209,
+  166, 131, 103, 80, 62, 47, 3584, 3569, 3525, 3453, 3355, 3232,
+  3088, 2927, 2751, 2564, 2371, 2174, 1977, 1783, 1594, 1414, 1244, 1086,
+  939, 806, 686, 579, 485, 403, 332, 271, 219, 176, 140, 111,
+  87, 68, 52, 40, 3000, 2988, 2951, 2891, 2808, 2706, 2586, 2450,
+  2303, 2147, 1985, 1820, 1655, 1492, 1335, 1184, 1042, 909, 787, 675,
+  575, 485, 406, 337, 278, 227, 184, 148, 118, 93, 73, 57,
+  44, 33, 2491, 2481, 2450, 2400, 2332, 2247, 2147, 2035, 1912, 1783,
+  1648, 1511, 1374, 1239, 1108, 983, 865, 755, 653, 560, 477, 403,
+  337, 280, 231, 188, 152, 123, 98, 77, 60, 47, 36, 28,
+  2052, 2043, 2018, 1977, 1920, 1850, 1768, 1675, 1575, 1468, 1357, 1244,
+  1131, 1020, 913, 810, 712, 621, 538, 462, 393, 332, 278, 231,
+  190, 155, 126, 101, 80, 64, 50, 39, 30, 23, 1675, 1669,
+  1648, 1614, 1568, 1511, 1444, 1368, 1286, 1199, 1108, 1016, 924, 833,
+  745, 661, 582, 508, 439, 377, 321, 271, 227, 188, 155, 127,
+  103, 82, 66, 52, 41, 32, 24, 19, 1357, 1352, 1335, 1308,
+  1270, 1224, 1170, 1108, 1042, 971, 898, 823, 748, 675, 604, 536,
+  471, 411, 356, 305, 260, 219, 184, 152, 126, 103, 83, 67,
+  53, 42, 33, 26, 20, 15, 1090, 1086, 1072, 1050, 1020, 983,
+  939, 890, 837, 780, 721, 661, 601, 542, 485, 430, 379, 330,
+  286, 245, 209, 176, 148, 123, 101, 82, 67, 54, 43, 34,
+  26, 21, 16, 12, 869, 865, 854, 837, 813, 783, 748, 709,
+  667, 621, 575, 527, 479, 432, 386, 343, 302, 263, 228, 195,
+  166, 140, 118, 98, 80, 66, 53, 43, 34, 27, 21, 16,
+  13, 10, 686, 683, 675, 661, 642, 619, 591, 560, 527, 491,
+  454, 416, 379, 341, 305, 271, 238, 208, 180, 154, 131, 111,
+  93, 77, 64, 52, 42, 34, 27, 21, 17, 13, 10, 8,
+  538, 536, 529, 518, 503, 485, 463, 439, 413, 385, 356, 326,
+  297, 268, 239, 212, 187, 163, 141, 121, 103, 87, 73, 60,
+  50, 41, 33, 26, 21, 17, 13, 10, 8, 6, 418, 416,
+  411, 403, 391, 377, 360, 341, 321, 299, 276, 254, 231, 208,
+  186, 165, 145, 127, 110, 94, 80, 68, 57, 47, 39, 32,
+  26, 21, 16, 13, 10, 8, 6, 5, 322, 321, 317, 310,
+  302, 291, 278, 263, 247, 231, 213, 195, 178, 160, 143, 127,
+  112, 98, 84, 72, 62, 52, 44, 36, 30, 24, 20, 16,
+  13, 10, 8, 6, 5, 4, 246, 245, 242, 237, 231, 222,
+  212, 201, 189, 176, 163, 149, 136, 123, 110, 97, 86, 75,
+  65, 55, 47, 40, 33, 28, 23, 19, 15, 12, 10, 8,
+  6, 5, 4, 3
+};
+static const int kern_row_fixed_11[] = {
+  6775, 8863, 11498, 14794, 18879, 23893, 29990, 37333, 46091, 56435, 68533, 82538,
+  98588, 116789, 137212, 159879, 184758, 211751, 240690, 271332, 303358, 336373, 369911, 403444,
+  436396, 468154, 498091, 525579, 550020, 570861, 587614, 599882, 607364, 609879, 607364, 599882,
+  587614, 570861, 550020, 525579, 498091, 468154, 436396, 403444, 369911, 336373, 303358, 271332,
+  240690, 211751, 184758, 159879, 137212, 116789, 98588, 82538, 68533, 56435, 46091, 37333,
+  29990, 23893, 18879, 14794, 11498, 8863, 6775
+};
+
+static const float kern_half_12[] = {
+  3.32451910e-02f, 3.31299566e-02f, 3.27866413e-02f, 3.22223417e-02f, 3.14486027e-02f, 3.04810312e-02f,
+  2.93387771e-02f, 2.80439015e-02f, 2.66206674e-02f, 2.50947867e-02f, 2.34926566e-02f, 2.18406133e-02f,
+  2.01642271e-02f, 1.84876788e-02f, 1.68332234e-02f, 1.52207576e-02f, 1.36675062e-02f, 1.21878292e-02f,
+  1.07931327e-02f, 9.49189160e-03f, 8.28976184e-03f, 7.18977675e-03f, 6.19259709e-03f, 5.29680867e-03f,
+  4.49924730e-03f, 3.79532948e-03f, 3.17938533e-03f, 2.64497101e-03f, 2.18515750e-03f, 1.79278664e-03f,
+  1.46069168e-03f, 1.18187780e-03f, 9.49665497e-04f, 7.57796864e-04f, 6.00508298e-04f, 4.72573447e-04f,
+  3.69320711e-04f, 3.31299566e-02f, 3.30151208e-02f, 3.26729976e-02f, 3.21106538e-02f, 3.13395970e-02f,
+  3.03753763e-02f, 2.92370822e-02f, 2.79466957e-02f, 2.65283938e-02f, 2.50078030e-02f, 2.34112255e-02f,
+  2.17649080e-02f, 2.00943332e-02f, 1.84235983e-02f, 1.67748760e-02f, 1.51679991e-02f, 1.36201316e-02f,
+  1.21455844e-02f, 1.07557215e-02f, 9.45899077e-03f, 8.26102775e-03f, 7.16485549e-03f, 6.17113197e-03f,
+  5.27844904e-03f, 4.48365184e-03f, 3.78217408e-03f, 3.16836499e-03f, 2.63580307e-03f, 2.17758329e-03f,
+  1.78657251e-03f, 1.45562866e-03f, 1.17778115e-03f, 9.46373795e-04f, 7.55170186e-04f, 5.98426850e-04f,
+  4.70935396e-04f, 3.68040550e-04f, 3.27866413e-02f, 3.26729976e-02f, 3.23344208e-02f, 3.17779034e-02f,
+  3.10148355e-02f, 3.00606098e-02f, 2.89341118e-02f, 2.76570953e-02f, 2.62534916e-02f, 2.47486569e-02f,
+  2.31686253e-02f, 2.15393677e-02f, 1.98861044e-02f, 1.82326809e-02f, 1.66010447e-02f, 1.50108188e-02f,
+  1.34789916e-02f, 1.20197246e-02f, 1.06442645e-02f, 9.36097093e-03f, 8.17542151e-03f, 7.09060859e-03f,
+  6.10718317e-03f, 5.22375060e-03f, 4.43718955e-03f, 3.74298077e-03f, 3.13553237e-03f, 2.60848925e-03f,
+  2.15501781e-03f, 1.76805898e-03f, 1.44054461e-03f, 1.16557628e-03f, 9.36566852e-04f, 7.47344689e-04f,
+  5.92225580e-04f, 4.66055295e-04f, 3.64226697e-04f, 3.22223417e-02f, 3.21106538e-02f, 3.17779034e-02f,
+  3.12309656e-02f, 3.04810312e-02f, 2.95432284e-02f, 2.84361187e-02f, 2.71810815e-02f, 2.58016344e-02f,
+  2.43226998e-02f, 2.27698628e-02f, 2.11686473e-02f, 1.95438396e-02f, 1.79188736e-02f, 1.63153205e-02f,
+  1.47524634e-02f, 1.32470010e-02f, 1.18128490e-02f, 1.04610631e-02f, 9.19985678e-03f, 8.03471263e-03f,
+  6.96857041e-03f, 6.00207085e-03f, 5.13384305e-03f, 4.36081970e-03f, 3.67855933e-03f, 3.08156596e-03f,
+  2.56359368e-03f, 2.11792719e-03f, 1.73762836e-03f, 1.41575094e-03f, 1.14551524e-03f, 9.20447346e-04f,
+  7.34481902e-04f, 5.82032604e-04f, 4.58033872e-04f, 3.57957906e-04f, 3.14486027e-02f, 3.13395970e-02f,
+  3.10148355e-02f, 3.04810312e-02f, 2.97491029e-02f, 2.88338196e-02f, 2.77532935e-02f, 2.65283938e-02f,
+  2.51820721e-02f, 2.37386506e-02f, 2.22231001e-02f, 2.06603352e-02f, 1.90745406e-02f, 1.74885951e-02f,
+  1.59235466e-02f, 1.43982191e-02f, 1.29289068e-02f, 1.15291923e-02f, 1.02098668e-02f, 8.97894427e-03f,
+  7.84177799e-03f, 6.80123735e-03f, 5.85794589e-03f, 5.01056667e-03f, 4.25610552e-03f, 3.59022780e-03f,
+  3.00756958e-03f, 2.50203535e-03f, 2.06707045e-03f, 1.69590348e-03f, 1.38175511e-03f, 1.11800851e-03f,
+  8.98345083e-04f, 7.16845156e-04f, 5.68056537e-04f, 4.47035301e-04f, 3.49362410e-04f, 3.04810312e-02f,
+  3.03753763e-02f, 3.00606098e-02f, 2.95432284e-02f, 2.88338196e-02f, 2.79466957e-02f, 2.68994141e-02f,
+  2.57122014e-02f, 2.44073011e-02f, 2.30082888e-02f, 2.15393677e-02f, 2.00246833e-02f, 1.84876788e-02f,
+  1.69505272e-02f, 1.54336318e-02f, 1.39552327e-02f, 1.25311259e-02f, 1.11744767e-02f, 9.89574194e-03f,
+  8.70269164e-03f, 7.60051236e-03f, 6.59198500e-03f, 5.67771588e-03f, 4.85640764e-03f, 4.12515877e-03f,
+  3.47976806e-03f, 2.91503640e-03f, 2.42505572e-03f, 2.00347323e-03f, 1.64372602e-03f, 1.33924303e-03f,
+  1.08361105e-03f, 8.70705873e-04f, 6.94790098e-04f, 5.50579280e-04f, 4.33281471e-04f, 3.38613667e-04f,
+  2.93387771e-02f, 2.92370822e-02f, 2.89341118e-02f, 2.84361187e-02f, 2.77532935e-02f, 2.68994141e-02f,
+  2.58913804e-02f, 2.47486569e-02f, 2.34926566e-02f, 2.21460704e-02f, 2.07321960e-02f, 1.92742739e-02f,
+  1.77948680e-02f, 1.63153205e-02f, 1.48552675e-02f, 1.34322708e-02f, 1.20615317e-02f, 1.07557215e-02f,
+  9.52490605e-03f, 8.37656483e-03f, 7.31568877e-03f, 6.34495541e-03f, 5.46494778e-03f, 4.67441743e-03f,
+  3.97057179e-03f, 3.34936637e-03f, 2.80579762e-03f, 2.33417866e-03f, 1.92839466e-03f, 1.58212869e-03f,
+  1.28905592e-03f, 1.04300352e-03f, 8.38076870e-04f, 6.68753404e-04f, 5.29946701e-04f, 4.17044590e-04f,
+  3.25924368e-04f, 2.80439015e-02f, 2.79466957e-02f, 2.76570953e-02f, 2.71810815e-02f, 2.65283938e-02f,
+  2.57122014e-02f, 2.47486569e-02f, 2.36563683e-02f, 2.24558003e-02f, 2.11686473e-02f, 1.98171753e-02f,
+  1.84235983e-02f, 1.70094855e-02f, 1.55952387e-02f, 1.41996266e-02f, 1.28394337e-02f, 1.15291923e-02f,
+  1.02810152e-02f, 9.10452195e-03f, 8.00686236e-03f, 6.99280901e-03f, 6.06491929e-03f, 5.22375060e-03f,
+  4.46811086e-03f, 3.79532948e-03f, 3.20154126e-03f, 2.68196291e-03f, 2.23115901e-03f, 1.84328447e-03f,
+  1.51230092e-03f, 1.23216305e-03f, 9.96970222e-04f, 8.01088114e-04f, 6.39237755e-04f, 5.06557350e-04f,
+  3.98638222e-04f, 3.11539596e-04f, 2.66206674e-02f, 2.65283938e-02f, 2.62534916e-02f, 2.58016344e-02f,
+  2.51820721e-02f, 2.44073011e-02f, 2.34926566e-02f, 2.24558003e-02f, 2.13161632e-02f, 2.00943332e-02f,
+  1.88114494e-02f, 1.74885951e-02f, 1.61462501e-02f, 1.48037765e-02f, 1.34789916e-02f, 1.21878292e-02f,
+  1.09440833e-02f, 9.75925103e-03f, 8.64246488e-03f, 7.60051236e-03f, 6.63792202e-03f, 5.75712323e-03f,
+  4.95864404e-03f, 4.24135290e-03f, 3.60271544e-03f, 3.03906226e-03f, 2.54585268e-03f, 2.11792719e-03f,
+  1.74973730e-03f, 1.43555133e-03f, 1.16963044e-03f, 9.46373795e-04f, 7.60432682e-04f, 6.06796297e-04f,
+  4.80849470e-04f, 3.78407218e-04f, 2.95728911e-04f, 2.50947867e-02f, 2.50078030e-02f, 2.47486569e-02f,
+  2.43226998e-02f, 2.37386506e-02f, 2.30082888e-02f, 2.21460704e-02f, 2.11686473e-02f, 2.00943332e-02f,
+  1.89425386e-02f, 1.77331865e-02f, 1.64861586e-02f, 1.52207576e-02f, 1.39552327e-02f, 1.27063841e-02f,
+  1.14892302e-02f, 1.03167752e-02f, 9.19985678e-03f, 8.14708415e-03f, 7.16485549e-03f, 6.25744043e-03f,
+  5.42712817e-03f, 4.67441743e-03f, 3.99824092e-03f, 3.39621003e-03f, 2.86486489e-03f, 2.39992584e-03f,
+  1.99652882e-03f, 1.64944341e-03f, 1.35326642e-03f, 1.10258791e-03f, 8.92128155e-04f, 7.16845156e-04f,
+  5.72015066e-04f, 4.53287445e-04f, 3.56717152e-04f, 2.78777879e-04f, 2.34926566e-02f, 2.34112255e-02f,
+  2.31686253e-02f, 2.27698628e-02f, 2.22231001e-02f, 2.15393677e-02f, 2.07321960e-02f, 1.98171753e-02f,
+  1.88114494e-02f, 1.77331865e-02f, 1.66010447e-02f, 1.54336318e-02f, 1.42490165e-02f, 1.30642867e-02f,
+  1.18951686e-02f, 1.07557215e-02f, 9.65811964e-03f, 8.61250889e-03f, 7.62694888e-03f, 6.70742849e-03f,
+  5.85794589e-03f, 5.08064311e-03f, 4.37598815e-03f, 3.74298077e-03f, 3.17938533e-03f, 2.68196291e-03f,
+  2.24670721e-03f, 1.86906417e-03f, 1.54413772e-03f, 1.26686960e-03f, 1.03219529e-03f, 8.35171901e-04f,
+  6.71079499e-04f, 5.35495870e-04f, 4.24348167e-04f, 3.33943201e-04f, 2.60979839e-04f, 2.18406133e-02f,
+  2.17649080e-02f, 2.15393677e-02f, 2.11686473e-02f, 2.06603352e-02f, 2.00246833e-02f, 1.92742739e-02f,
+  1.84235983e-02f, 1.74885951e-02f, 1.64861586e-02f, 1.54336318e-02f, 1.43483123e-02f, 1.32470010e-02f,
+  1.21455844e-02f, 1.10586798e-02f, 9.99936089e-03f, 8.97894427e-03f, 8.00686236e-03f, 7.09060859e-03f,
+  6.23575086e-03f, 5.44600515e-03f, 4.72336356e-03f, 4.06826101e-03f, 3.47976806e-03f, 2.95580551e-03f,
+  2.49336287e-03f, 2.08871486e-03f, 1.73762836e-03f, 1.43555133e-03f, 1.17778115e-03f, 9.59609577e-04f,
+  7.76441186e-04f, 6.23888045e-04f, 4.97838890e-04f, 3.94507282e-04f, 3.10459756e-04f, 2.42627299e-04f,
+  2.01642271e-02f, 2.00943332e-02f, 1.98861044e-02f, 1.95438396e-02f, 1.90745406e-02f, 1.84876788e-02f,
+  1.77948680e-02f, 1.70094855e-02f, 1.61462501e-02f, 1.52207576e-02f, 1.42490165e-02f, 1.32470010e-02f,
+  1.22302221e-02f, 1.12133445e-02f, 1.02098668e-02f, 9.23185609e-03f, 8.28976184e-03f, 7.39229238e-03f,
+  6.54636603e-03f, 5.75712323e-03f, 5.02799451e-03f, 4.36081970e-03f, 3.75599996e-03f, 3.21267708e-03f,
+  2.72893137e-03f, 2.30198354e-03f, 1.92839466e-03f, 1.60425599e-03f, 1.32536492e-03f, 1.08738011e-03f,
+  8.85954301e-04f, 7.16845156e-04f, 5.76001243e-04f, 4.59627045e-04f, 3.64226697e-04f, 2.86630268e-04f,
+  2.24004325e-04f, 1.84876788e-02f, 1.84235983e-02f, 1.82326809e-02f, 1.79188736e-02f, 1.74885951e-02f,
+  1.69505272e-02f, 1.63153205e-02f, 1.55952387e-02f, 1.48037765e-02f, 1.39552327e-02f, 1.30642867e-02f,
+  1.21455844e-02f, 1.12133445e-02f, 1.02810152e-02f, 9.36097093e-03f, 8.46427679e-03f, 7.60051236e-03f,
+  6.77766278e-03f, 6.00207085e-03f, 5.27844904e-03f, 4.60994383e-03f, 3.99824092e-03f, 3.44370864e-03f,
+  2.94556003e-03f, 2.50203535e-03f, 2.11058604e-03f, 1.76805898e-03f, 1.47087069e-03f, 1.21516793e-03f,
+  9.96970222e-04f, 8.12291924e-04f, 6.57243305e-04f, 5.28109842e-04f, 4.21411503e-04f, 3.33943201e-04f,
+  2.62798509e-04f, 2.05379562e-04f, 1.68332234e-02f, 1.67748760e-02f, 1.66010447e-02f, 1.63153205e-02f,
+  1.59235466e-02f, 1.54336318e-02f, 1.48552675e-02f, 1.41996266e-02f, 1.34789916e-02f, 1.27063841e-02f,
+  1.18951686e-02f, 1.10586798e-02f, 1.02098668e-02f, 9.36097093e-03f, 8.52326117e-03f, 7.70681165e-03f,
+  6.92034513e-03f, 6.17113197e-03f, 5.46494778e-03f, 4.80608270e-03f, 4.19740146e-03f, 3.64044006e-03f,
+  3.13553237e-03f, 2.68196291e-03f, 2.27812910e-03f, 1.92171044e-03f, 1.60983601e-03f, 1.33924303e-03f,
+  1.10642298e-03f, 9.07751732e-04f, 7.39600218e-04f, 5.98426850e-04f, 4.80849470e-04f, 3.83699546e-04f,
+  3.04058747e-04f, 2.39280766e-04f, 1.87000231e-04f, 1.52207576e-02f, 1.51679991e-02f, 1.50108188e-02f,
+  1.47524634e-02f, 1.43982191e-02f, 1.39552327e-02f, 1.34322708e-02f, 1.28394337e-02f, 1.21878292e-02f,
+  1.14892302e-02f, 1.07557215e-02f, 9.99936089e-03f, 9.23185609e-03f, 8.46427679e-03f, 7.70681165e-03f,
+  6.96857041e-03f, 6.25744043e-03f, 5.57999499e-03f, 4.94145649e-03f, 4.34570434e-03f, 3.79532948e-03f,
+  3.29171959e-03f, 2.83517758e-03f, 2.42505572e-03f, 2.05990556e-03f, 1.73762836e-03f, 1.45562866e-03f,
+  1.21095590e-03f, 1.00043800e-03f, 8.20797519e-04f, 6.68753404e-04f, 5.41103072e-04f, 4.34788555e-04f,
+  3.46944697e-04f, 2.74932740e-04f, 2.16359884e-04f, 1.69087332e-04f, 1.36675062e-02f, 1.36201316e-02f,
+  1.34789916e-02f, 1.32470010e-02f, 1.29289068e-02f, 1.25311259e-02f, 1.20615317e-02f, 1.15291923e-02f,
+  1.09440833e-02f, 1.03167752e-02f, 9.65811964e-03f, 8.97894427e-03f, 8.28976184e-03f, 7.60051236e-03f,
+  6.92034513e-03f, 6.25744043e-03f, 5.61887957e-03f, 5.01056667e-03f, 4.43718955e-03f, 3.90223321e-03f,
+  3.40802292e-03f, 2.95580551e-03f, 2.54585268e-03f, 2.17758329e-03f, 1.84969581e-03f, 1.56030653e-03f,
+  1.30708434e-03f, 1.08738011e-03f, 8.98345083e-04f, 7.37036637e-04f, 6.00508298e-04f, 4.85884491e-04f,
+  3.90419154e-04f, 3.11539596e-04f, 2.46876356e-04f, 1.94280743e-04f, 1.51832282e-04f, 1.21878292e-02f,
+  1.21455844e-02f, 1.20197246e-02f, 1.18128490e-02f, 1.15291923e-02f, 1.11744767e-02f, 1.07557215e-02f,
+  1.02810152e-02f, 9.75925103e-03f, 9.19985678e-03f, 8.61250889e-03f, 8.00686236e-03f, 7.39229238e-03f,
+  6.77766278e-03f, 6.17113197e-03f, 5.57999499e-03f, 5.01056667e-03f, 4.46811086e-03f, 3.95680871e-03f,
+  3.47976806e-03f, 3.03906226e-03f, 2.63580307e-03f, 2.27023265e-03f, 1.94183295e-03f, 1.64944341e-03f,
+  1.39138405e-03f, 1.16557628e-03f, 9.69657733e-04f, 8.01088114e-04f, 6.57243305e-04f, 5.35495870e-04f,
+  4.33281471e-04f, 3.48151458e-04f, 2.77811603e-04f, 2.20148926e-04f, 1.73247448e-04f, 1.35394555e-04f,
+  1.07931327e-02f, 1.07557215e-02f, 1.06442645e-02f, 1.04610631e-02f, 1.02098668e-02f, 9.89574194e-03f,
+  9.52490605e-03f, 9.10452195e-03f, 8.64246488e-03f, 8.14708415e-03f, 7.62694888e-03f, 7.09060859e-03f,
+  6.54636603e-03f, 6.00207085e-03f, 5.46494778e-03f, 4.94145649e-03f, 4.43718955e-03f, 3.95680871e-03f,
+  3.50401714e-03f, 3.08156596e-03f, 2.69129151e-03f, 2.33417866e-03f, 2.01044185e-03f, 1.71962206e-03f,
+  1.46069168e-03f, 1.23216305e-03f, 1.03219529e-03f, 8.58696352e-04f, 7.09416752e-04f, 5.82032604e-04f,
+  4.74217173e-04f, 3.83699546e-04f, 3.08311253e-04f, 2.46020616e-04f, 1.94956505e-04f, 1.53422137e-04f,
+  1.19900877e-04f, 9.49189160e-03f, 9.45899077e-03f, 9.36097093e-03f, 9.19985678e-03f, 8.97894427e-03f,
+  8.70269164e-03f, 8.37656483e-03f, 8.00686236e-03f, 7.60051236e-03f, 7.16485549e-03f, 6.70742849e-03f,
+  6.23575086e-03f, 5.75712323e-03f, 5.27844904e-03f, 4.80608270e-03f, 4.34570434e-03f, 3.90223321e-03f,
+  3.47976806e-03f, 3.08156596e-03f, 2.71004601e-03f, 2.36682408e-03f, 2.05276534e-03f, 1.76805898e-03f,
+  1.51230092e-03f, 1.28458778e-03f, 1.08361105e-03f, 9.07751732e-04f, 7.55170186e-04f, 6.23888045e-04f,
+  5.11861581e-04f, 4.17044590e-04f, 3.37439968e-04f, 2.71140627e-04f, 2.16359884e-04f, 1.71452164e-04f,
+  1.34925256e-04f, 1.05445390e-04f, 8.28976184e-03f, 8.26102775e-03f, 8.17542151e-03f, 8.03471263e-03f,
+  7.84177799e-03f, 7.60051236e-03f, 7.31568877e-03f, 6.99280901e-03f, 6.63792202e-03f, 6.25744043e-03f,
+  5.85794589e-03f, 5.44600515e-03f, 5.02799451e-03f, 4.60994383e-03f, 4.19740146e-03f, 3.79532948e-03f,
+  3.40802292e-03f, 3.03906226e-03f, 2.69129151e-03f, 2.36682408e-03f, 2.06707045e-03f, 1.79278664e-03f,
+  1.54413772e-03f, 1.32077094e-03f, 1.12189725e-03f, 9.46373795e-04f, 7.92786770e-04f, 6.59529353e-04f,
+  5.44873823e-04f, 4.47035301e-04f, 3.64226697e-04f, 2.94703845e-04f, 2.36801192e-04f, 1.88958322e-04f,
+  1.49738073e-04f, 1.17837233e-04f, 9.20909297e-05f, 7.18977675e-03f, 7.16485549e-03f, 7.09060859e-03f,
+  6.96857041e-03f, 6.80123735e-03f, 6.59198500e-03f, 6.34495541e-03f, 6.06491929e-03f, 5.75712323e-03f,
+  5.42712817e-03f, 5.08064311e-03f, 4.72336356e-03f, 4.36081970e-03f, 3.99824092e-03f, 3.64044006e-03f,
+  3.29171959e-03f, 2.95580551e-03f, 2.63580307e-03f, 2.33417866e-03f, 2.05276534e-03f, 1.79278664e-03f,
+  1.55489822e-03f, 1.33924303e-03f, 1.14551524e-03f, 9.73030459e-04f, 8.20797519e-04f, 6.87590276e-04f,
+  5.72015066e-04f, 4.72573447e-04f, 3.87717300e-04f, 3.15896730e-04f, 2.55599007e-04f, 2.05379562e-04f,
+  1.63885066e-04f, 1.29869033e-04f, 1.02201171e-04f, 7.98712063e-05f, 6.19259709e-03f, 6.17113197e-03f,
+  6.10718317e-03f, 6.00207085e-03f, 5.85794589e-03f, 5.67771588e-03f, 5.46494778e-03f, 5.22375060e-03f,
+  4.95864404e-03f, 4.67441743e-03f, 4.37598815e-03f, 4.06826101e-03f, 3.75599996e-03f, 3.44370864e-03f,
+  3.13553237e-03f, 2.83517758e-03f, 2.54585268e-03f, 2.27023265e-03f, 2.01044185e-03f, 1.76805898e-03f,
+  1.54413772e-03f, 1.33924303e-03f, 1.15349796e-03f, 9.86639061e-04f, 8.38076870e-04f, 7.06957770e-04f,
+  5.92225580e-04f, 4.92679945e-04f, 4.07030282e-04f, 3.33943201e-04f, 2.72083707e-04f, 2.20148926e-04f,
+  1.76894639e-04f, 1.41155178e-04f, 1.11856963e-04f, 8.80264706e-05f, 6.87935390e-05f, 5.29680867e-03f,
+  5.27844904e-03f, 5.22375060e-03f, 5.13384305e-03f, 5.01056667e-03f, 4.85640764e-03f, 4.67441743e-03f,
+  4.46811086e-03f, 4.24135290e-03f, 3.99824092e-03f, 3.74298077e-03f, 3.47976806e-03f, 3.21267708e-03f,
+  2.94556003e-03f, 2.68196291e-03f, 2.42505572e-03f, 2.17758329e-03f, 1.94183295e-03f, 1.71962206e-03f,
+  1.51230092e-03f, 1.32077094e-03f, 1.14551524e-03f, 9.86639061e-04f, 8.43917078e-04f, 7.16845156e-04f,
+  6.04693021e-04f, 5.06557350e-04f, 4.21411503e-04f, 3.48151458e-04f, 2.85636750e-04f, 2.32725535e-04f,
+  1.88303355e-04f, 1.51305998e-04f, 1.20736418e-04f, 9.56763324e-05f, 7.52930355e-05f, 5.88422299e-05f,
+  4.49924730e-03f, 4.48365184e-03f, 4.43718955e-03f, 4.36081970e-03f, 4.25610552e-03f, 4.12515877e-03f,
+  3.97057179e-03f, 3.79532948e-03f, 3.60271544e-03f, 3.39621003e-03f, 3.17938533e-03f, 2.95580551e-03f,
+  2.72893137e-03f, 2.50203535e-03f, 2.27812910e-03f, 2.05990556e-03f, 1.84969581e-03f, 1.64944341e-03f,
+  1.46069168e-03f, 1.28458778e-03f, 1.12189725e-03f, 9.73030459e-04f, 8.38076870e-04f, 7.16845156e-04f,
+  6.08906907e-04f, 5.13641979e-04f, 4.30283020e-04f, 3.57957906e-04f, 2.95728911e-04f, 2.42627299e-04f,
+  1.97683126e-04f, 1.59949763e-04f, 1.28523243e-04f, 1.02556653e-04f, 8.12699654e-05f, 6.39558566e-05f,
+  4.99821217e-05f, 3.79532948e-03f, 3.78217408e-03f, 3.74298077e-03f, 3.67855933e-03f, 3.59022780e-03f,
+  3.47976806e-03f, 3.34936637e-03f, 3.20154126e-03f, 3.03906226e-03f, 2.86486489e-03f, 2.68196291e-03f,
+  2.49336287e-03f, 2.30198354e-03f, 2.11058604e-03f, 1.92171044e-03f, 1.73762836e-03f, 1.56030653e-03f,
+  1.39138405e-03f, 1.23216305e-03f, 1.08361105e-03f, 9.46373795e-04f, 8.20797519e-04f, 7.06957770e-04f,
+  6.04693021e-04f, 5.13641979e-04f, 4.33281471e-04f, 3.62964231e-04f, 3.01954540e-04f, 2.49461416e-04f,
+  2.04667682e-04f, 1.66755141e-04f, 1.34925256e-04f, 1.08415486e-04f, 8.65114271e-05f, 6.85550840e-05f,
+  5.39498142e-05f, 4.21623008e-05f, 3.17938533e-03f, 3.16836499e-03f, 3.13553237e-03f, 3.08156596e-03f,
+  3.00756958e-03f, 2.91503640e-03f, 2.80579762e-03f, 2.68196291e-03f, 2.54585268e-03f, 2.39992584e-03f,
+  2.24670721e-03f, 2.08871486e-03f, 1.92839466e-03f, 1.76805898e-03f, 1.60983601e-03f, 1.45562866e-03f,
+  1.30708434e-03f, 1.16557628e-03f, 1.03219529e-03f, 9.07751732e-04f, 7.92786770e-04f, 6.87590276e-04f,
+  5.92225580e-04f, 5.06557350e-04f, 4.30283020e-04f, 3.62964231e-04f, 3.04058747e-04f, 2.52950325e-04f,
+  2.08976315e-04f, 1.71452164e-04f, 1.39692434e-04f, 1.13028225e-04f, 9.08207367e-05f, 7.24714846e-05f,
+  5.74292790e-05f, 4.51942979e-05f, 3.53197793e-05f, 2.64497101e-03f, 2.63580307e-03f, 2.60848925e-03f,
+  2.56359368e-03f, 2.50203535e-03f, 2.42505572e-03f, 2.33417866e-03f, 2.23115901e-03f, 2.11792719e-03f,
+  1.99652882e-03f, 1.86906417e-03f, 1.73762836e-03f, 1.60425599e-03f, 1.47087069e-03f, 1.33924303e-03f,
+  1.21095590e-03f, 1.08738011e-03f, 9.69657733e-04f, 8.58696352e-04f, 7.55170186e-04f, 6.59529353e-04f,
+  5.72015066e-04f, 4.92679945e-04f, 4.21411503e-04f, 3.57957906e-04f, 3.01954540e-04f, 2.52950325e-04f,
+  2.10432598e-04f, 1.73850058e-04f, 1.42633231e-04f, 1.16211915e-04f, 9.40296159e-05f, 7.55549190e-05f,
+  6.02899454e-05f, 4.77761459e-05f, 3.75977106e-05f, 2.93829744e-05f, 2.18515750e-03f, 2.17758329e-03f,
+  2.15501781e-03f, 2.11792719e-03f, 2.06707045e-03f, 2.00347323e-03f, 1.92839466e-03f, 1.84328447e-03f,
+  1.74973730e-03f, 1.64944341e-03f, 1.54413772e-03f, 1.43555133e-03f, 1.32536492e-03f, 1.21516793e-03f,
+  1.10642298e-03f, 1.00043800e-03f, 8.98345083e-04f, 8.01088114e-04f, 7.09416752e-04f, 6.23888045e-04f,
+  5.44873823e-04f, 4.72573447e-04f, 4.07030282e-04f, 3.48151458e-04f, 2.95728911e-04f, 2.49461416e-04f,
+  2.08976315e-04f, 1.73850058e-04f, 1.43627185e-04f, 1.17837233e-04f, 9.60091202e-05f, 7.76830930e-05f,
+  6.24201130e-05f, 4.98088739e-05f, 3.94705276e-05f, 3.10615578e-05f, 2.42749065e-05f, 1.79278664e-03f,
+  1.78657251e-03f, 1.76805898e-03f, 1.73762836e-03f, 1.69590348e-03f, 1.64372602e-03f, 1.58212869e-03f,
+  1.51230092e-03f, 1.43555133e-03f, 1.35326642e-03f, 1.26686960e-03f, 1.17778115e-03f, 1.08738011e-03f,
+  9.96970222e-04f, 9.07751732e-04f, 8.20797519e-04f, 7.37036637e-04f, 6.57243305e-04f, 5.82032604e-04f,
+  5.11861581e-04f, 4.47035301e-04f, 3.87717300e-04f, 3.33943201e-04f, 2.85636750e-04f, 2.42627299e-04f,
+  2.04667682e-04f, 1.71452164e-04f, 1.42633231e-04f, 1.17837233e-04f, 9.66781663e-05f, 7.87695462e-05f,
+  6.37341727e-05f, 5.12118495e-05f, 4.08651031e-05f, 3.23831300e-05f, 2.54840888e-05f, 1.99160604e-05f,
+  1.46069168e-03f, 1.45562866e-03f, 1.44054461e-03f, 1.41575094e-03f, 1.38175511e-03f, 1.33924303e-03f,
+  1.28905592e-03f, 1.23216305e-03f, 1.16963044e-03f, 1.10258791e-03f, 1.03219529e-03f, 9.59609577e-04f,
+  8.85954301e-04f, 8.12291924e-04f, 7.39600218e-04f, 6.68753404e-04f, 6.00508298e-04f, 5.35495870e-04f,
+  4.74217173e-04f, 4.17044590e-04f, 3.64226697e-04f, 3.15896730e-04f, 2.72083707e-04f, 2.32725535e-04f,
+  1.97683126e-04f, 1.66755141e-04f, 1.39692434e-04f, 1.16211915e-04f, 9.60091202e-05f, 7.87695462e-05f,
+  6.41783117e-05f, 5.19280875e-05f, 4.17253905e-05f, 3.32952695e-05f, 2.63844940e-05f, 2.07634275e-05f,
+  1.62268188e-05f, 1.18187780e-03f, 1.17778115e-03f, 1.16557628e-03f, 1.14551524e-03f, 1.11800851e-03f,
+  1.08361105e-03f, 1.04300352e-03f, 9.96970222e-04f, 9.46373795e-04f, 8.92128155e-04f, 8.35171901e-04f,
+  7.76441186e-04f, 7.16845156e-04f, 6.57243305e-04f, 5.98426850e-04f, 5.41103072e-04f, 4.85884491e-04f,
+  4.33281471e-04f, 3.83699546e-04f, 3.37439968e-04f, 2.94703845e-04f, 2.55599007e-04f, 2.20148926e-04f,
+  1.88303355e-04f, 1.59949763e-04f, 1.34925256e-04f, 1.13028225e-04f, 9.40296159e-05f, 7.76830930e-05f,
+  6.37341727e-05f, 5.19280875e-05f, 4.20161596e-05f, 3.37609308e-05f, 2.69399370e-05f, 2.13482745e-05f,
+  1.68001461e-05f, 1.31294764e-05f, 9.49665497e-04f, 9.46373795e-04f, 9.36566852e-04f, 9.20447346e-04f,
+  8.98345083e-04f, 8.70705873e-04f, 8.38076870e-04f, 8.01088114e-04f, 7.60432682e-04f, 7.16845156e-04f,
+  6.71079499e-04f, 6.23888045e-04f, 5.76001243e-04f, 5.28109842e-04f, 4.80849470e-04f, 4.34788555e-04f,
+  3.90419154e-04f, 3.48151458e-04f, 3.08311253e-04f, 2.71140627e-04f, 2.36801192e-04f, 2.05379562e-04f,
+  1.76894639e-04f, 1.51305998e-04f, 1.28523243e-04f, 1.08415486e-04f, 9.08207367e-05f, 7.55549190e-05f,
+  6.24201130e-05f, 5.12118495e-05f, 4.17253905e-05f, 3.37609308e-05f, 2.71276713e-05f, 2.16468470e-05f,
+  1.71538213e-05f, 1.34992970e-05f, 1.05498311e-05f, 7.57796864e-04f, 7.55170186e-04f, 7.47344689e-04f,
+  7.34481902e-04f, 7.16845156e-04f, 6.94790098e-04f, 6.68753404e-04f, 6.39237755e-04f, 6.06796297e-04f,
+  5.72015066e-04f, 5.35495870e-04f, 4.97838890e-04f, 4.59627045e-04f, 4.21411503e-04f, 3.83699546e-04f,
+  3.46944697e-04f, 3.11539596e-04f, 2.77811603e-04f, 2.46020616e-04f, 2.16359884e-04f, 1.88958322e-04f,
+  1.63885066e-04f, 1.41155178e-04f, 1.20736418e-04f, 1.02556653e-04f, 8.65114271e-05f, 7.24714846e-05f,
+  6.02899454e-05f, 4.98088739e-05f, 4.08651031e-05f, 3.32952695e-05f, 2.69399370e-05f, 2.16468470e-05f,
+  1.72733598e-05f, 1.36880954e-05f, 1.07719243e-05f, 8.41836300e-06f, 6.00508298e-04f, 5.98426850e-04f,
+  5.92225580e-04f, 5.82032604e-04f, 5.68056537e-04f, 5.50579280e-04f, 5.29946701e-04f, 5.06557350e-04f,
+  4.80849470e-04f, 4.53287445e-04f, 4.24348167e-04f, 3.94507282e-04f, 3.64226697e-04f, 3.33943201e-04f,
+  3.04058747e-04f, 2.74932740e-04f, 2.46876356e-04f, 2.20148926e-04f, 1.94956505e-04f, 1.71452164e-04f,
+  1.49738073e-04f, 1.29869033e-04f, 1.11856963e-04f, 9.56763324e-05f, 8.12699654e-05f, 6.85550840e-05f,
+  5.74292790e-05f, 4.77761459e-05f, 3.94705276e-05f, 3.23831300e-05f, 2.63844940e-05f, 2.13482745e-05f,
+  1.71538213e-05f, 1.36880954e-05f, 1.08469894e-05f, 8.53610072e-06f, 6.67104496e-06f, 4.72573447e-04f,
+  4.70935396e-04f, 4.66055295e-04f, 4.58033872e-04f, 4.47035301e-04f, 4.33281471e-04f, 4.17044590e-04f,
+  3.98638222e-04f, 3.78407218e-04f, 3.56717152e-04f, 3.33943201e-04f, 3.10459756e-04f, 2.86630268e-04f,
+  2.62798509e-04f, 2.39280766e-04f, 2.16359884e-04f, 1.94280743e-04f, 1.73247448e-04f, 1.53422137e-04f,
+  1.34925256e-04f, 1.17837233e-04f, 1.02201171e-04f, 8.80264706e-05f, 7.52930355e-05f, 6.39558566e-05f,
+  5.39498142e-05f, 4.51942979e-05f, 3.75977106e-05f, 3.10615578e-05f, 2.54840888e-05f, 2.07634275e-05f,
+  1.68001461e-05f, 1.34992970e-05f, 1.07719243e-05f, 8.53610072e-06f, 6.71753287e-06f, 5.24981670e-06f,
+  3.69320711e-04f, 3.68040550e-04f, 3.64226697e-04f, 3.57957906e-04f, 3.49362410e-04f, 3.38613667e-04f,
+  3.25924368e-04f, 3.11539596e-04f, 2.95728911e-04f, 2.78777879e-04f, 2.60979839e-04f, 2.42627299e-04f,
+  2.24004325e-04f, 2.05379562e-04f, 1.87000231e-04f, 1.69087332e-04f, 1.51832282e-04f, 1.35394555e-04f,
+  1.19900877e-04f, 1.05445390e-04f, 9.20909297e-05f, 7.98712063e-05f, 6.87935390e-05f, 5.88422299e-05f,
+  4.99821217e-05f, 4.21623008e-05f, 3.53197793e-05f, 2.93829744e-05f, 2.42749065e-05f, 1.99160604e-05f,
+  1.62268188e-05f, 1.31294764e-05f, 1.05498311e-05f, 8.41836300e-06f, 6.67104496e-06f, 5.24981670e-06f,
+  4.10278244e-06f
+};
+static const float kern_row_12[] = {
+  3.70189111e-04f, 4.73684631e-04f, 6.01920357e-04f, 7.59578717e-04f, 9.51898517e-04f, 1.18465687e-03f,
+  1.46412628e-03f, 1.79700216e-03f, 2.19029561e-03f, 2.65119039e-03f, 3.18686129e-03f, 3.80425365e-03f,
+  4.50982666e-03f, 5.30926371e-03f, 6.20715786e-03f, 7.20668258e-03f, 8.30925349e-03f, 9.51420981e-03f,
+  1.08185112e-02f, 1.22164879e-02f, 1.36996433e-02f, 1.52565464e-02f, 1.68728046e-02f, 1.85311511e-02f,
+  2.02116407e-02f, 2.18919683e-02f, 2.35478971e-02f, 2.51537934e-02f, 2.66832616e-02f, 2.81098429e-02f,
+  2.94077639e-02f, 3.05527020e-02f, 3.15225497e-02f, 3.22981104e-02f, 3.28637362e-02f, 3.32078561e-02f,
+  3.33233625e-02f, 3.32078561e-02f, 3.28637362e-02f, 3.22981104e-02f, 3.15225497e-02f, 3.05527020e-02f,
+  2.94077639e-02f, 2.81098429e-02f, 2.66832616e-02f, 2.51537934e-02f, 2.35478971e-02f, 2.18919683e-02f,
+  2.02116407e-02f, 1.85311511e-02f, 1.68728046e-02f, 1.52565464e-02f, 1.36996433e-02f, 1.22164879e-02f,
+  1.08185112e-02f, 9.51420981e-03f, 8.30925349e-03f, 7.20668258e-03f, 6.20715786e-03f, 5.30926371e-03f,
+  4.50982666e-03f, 3.80425365e-03f, 3.18686129e-03f, 2.65119039e-03f, 2.19029561e-03f, 1.79700216e-03f,
+  1.46412628e-03f, 1.18465687e-03f, 9.51898517e-04f, 7.59578717e-04f, 6.01920357e-04f, 4.73684631e-04f,
+  3.70189111e-04f
+};
+static const int kern_half_fixed_12[] = {
+  18630, 18566, 18373, 18057, 17623, 17081, 16441, 15715, 14918, 14063, 13165, 12239,
+  11300, 10360, 9433, 8530, 7659, 6830, 6048, 5319, 4645, 4029, 3470, 2968,
+  2521, 2127, 1782, 1482, 1225, 1005, 819, 662, 532, 425, 337, 265,
+  207, 18566, 18501, 18310, 17994, 17562, 17022, 16384, 15661, 14866, 14014, 13119,
+  12197, 11261, 10324, 9400, 8500, 7633, 6806, 6027, 5301, 4629, 4015, 3458,
+  2958, 2513, 2119, 1776, 1477, 1220, 1001, 816, 660, 530, 423, 335,
+  264, 206, 18373, 18310, 18120, 17808, 17380, 16846, 16214, 15499, 14712, 13869,
+  12983, 12070, 11144, 10217, 9303, 8412, 7553, 6736, 5965, 5246, 4581, 3973,
+  3422, 2927, 2487, 2098, 1757, 1462, 1208, 991, 807, 653, 525, 419,
+  332, 261, 204, 18057, 17994, 17808, 17501, 17081, 16556, 15935, 15232, 14459,
+  13630, 12760, 11863, 10952, 10042, 9143, 8267, 7423, 6620, 5862, 5155, 4503,
+  3905, 3363, 2877, 2444, 2061, 1727, 1437, 1187, 974, 793, 642, 516,
+  412, 326, 257, 201, 17623, 17562, 17380, 17081, 16671, 16158, 15553, 14866,
+  14112, 13303, 12454, 11578, 10689, 9800, 8923, 8069, 7245, 6461, 5721, 5032,
+  4394, 3811, 3283, 2808, 2385, 2012, 1685, 1402, 1158, 950, 774, 627,
+  503, 402, 318, 251, 196, 17081, 17022, 16846, 16556, 16158, 15661, 15074,
+  14409, 13678, 12894, 12070, 11222, 10360, 9499, 8649, 7820, 7022, 6262, 5545,
+  4877, 4259, 3694, 3182, 2721, 2312, 1950, 1634, 1359, 1123, 921, 750,
+  607, 488, 389, 309, 243, 190, 16441, 16384, 16214, 15935, 15553, 15074,
+  14509, 13869, 13165, 12410, 11618, 10801, 9972, 9143, 8325, 7527, 6759, 6027,
+  5338, 4694, 4100, 3556, 3062, 2619, 2225, 1877, 1572, 1308, 1081, 887,
+  722, 584, 470, 375, 297, 234, 183, 15715, 15661, 15499, 15232, 14866,
+  14409, 13869, 13257, 12584, 11863, 11105, 10324, 9532, 8739, 7957, 7195, 6461,
+  5761, 5102, 4487, 3919, 3399, 2927, 2504, 2127, 1794, 1503, 1250, 1033,
+  847, 690, 559, 449, 358, 284, 223, 175, 14918, 14866, 14712, 14459,
+  14112, 13678, 13165, 12584, 11945, 11261, 10542, 9800, 9048, 8296, 7553, 6830,
+  6133, 5469, 4843, 4259, 3720, 3226, 2779, 2377, 2019, 1703, 1427, 1187,
+  981, 804, 655, 530, 426, 340, 269, 212, 166, 14063, 14014, 13869,
+  13630, 13303, 12894, 12410, 11863, 11261, 10615, 9937, 9239, 8530, 7820, 7121,
+  6438, 5781, 5155, 4566, 4015, 3507, 3041, 2619, 2241, 1903, 1605, 1345,
+  1119, 924, 758, 618, 500, 402, 321, 254, 200, 156, 13165, 13119,
+  12983, 12760, 12454, 12070, 11618, 11105, 10542, 9937, 9303, 8649, 7985, 7321,
+  6666, 6027, 5412, 4826, 4274, 3759, 3283, 2847, 2452, 2098, 1782, 1503,
+  1259, 1047, 865, 710, 578, 468, 376, 300, 238, 187, 146, 12239,
+  12197, 12070, 11863, 11578, 11222, 10801, 10324, 9800, 9239, 8649, 8041, 7423,
+  6806, 6197, 5604, 5032, 4487, 3973, 3494, 3052, 2647, 2280, 1950, 1656,
+  1397, 1170, 974, 804, 660, 538, 435, 350, 279, 221, 174, 136,
+  11300, 11261, 11144, 10952, 10689, 10360, 9972, 9532, 9048, 8530, 7985, 7423,
+  6854, 6284, 5721, 5173, 4645, 4143, 3669, 3226, 2818, 2444, 2105, 1800,
+  1529, 1290, 1081, 899, 743, 609, 496, 402, 323, 258, 204, 161,
+  126, 10360, 10324, 10217, 10042, 9800, 9499, 9143, 8739, 8296, 7820, 7321,
+  6806, 6284, 5761, 5246, 4743, 4259, 3798, 3363, 2958, 2583, 2241, 1930,
+  1651, 1402, 1183, 991, 824, 681, 559, 455, 368, 296, 236, 187,
+  147, 115, 9433, 9400, 9303, 9143, 8923, 8649, 8325, 7957, 7553, 7121,
+  6666, 6197, 5721, 5246, 4776, 4319, 3878, 3458, 3062, 2693, 2352, 2040,
+  1757, 1503, 1277, 1077, 902, 750, 620, 509, 414, 335, 269, 215,
+  170, 134, 105, 8530, 8500, 8412, 8267, 8069, 7820, 7527, 7195, 6830,
+  6438, 6027, 5604, 5173, 4743, 4319, 3905, 3507, 3127, 2769, 2435, 2127,
+  1845, 1589, 1359, 1154, 974, 816, 679, 561, 460, 375, 303, 244,
+  194, 154, 121, 95, 7659, 7633, 7553, 7423, 7245, 7022, 6759, 6461,
+  6133, 5781, 5412, 5032, 4645, 4259, 3878, 3507, 3149, 2808, 2487, 2187,
+  1910, 1656, 1427, 1220, 1037, 874, 732, 609, 503, 413, 337, 272,
+  219, 175, 138, 109, 85, 6830, 6806, 6736, 6620, 6461, 6262, 6027,
+  5761, 5469, 5155, 4826, 4487, 4143, 3798, 3458, 3127, 2808, 2504, 2217,
+  1950, 1703, 1477, 1272, 1088, 924, 780, 653, 543, 449, 368, 300,
+  243, 195, 156, 123, 97, 76, 6048, 6027, 5965, 5862, 5721, 5545,
+  5338, 5102, 4843, 4566, 4274, 3973, 3669, 3363, 3062, 2769, 2487, 2217,
+  1964, 1727, 1508, 1308, 1127, 964, 819, 690, 578, 481, 398, 326,
+  266, 215, 173, 138, 109, 86, 67, 5319, 5301, 5246, 5155, 5032,
+  4877, 4694, 4487, 4259, 4015, 3759, 3494, 3226, 2958, 2693, 2435, 2187,
+  1950, 1727, 1519, 1326, 1150, 991, 847, 720, 607, 509, 423, 350,
+  287, 234, 189, 152, 121, 96, 76, 59, 4645, 4629, 4581, 4503,
+  4394, 4259, 4100, 3919, 3720, 3507, 3283, 3052, 2818, 2583, 2352, 2127,
+  1910, 1703, 1508, 1326, 1158, 1005, 865, 740, 629, 530, 444, 370,
+  305, 251, 204, 165, 133, 106, 84, 66, 52, 4029, 4015, 3973,
+  3905, 3811, 3694, 3556, 3399, 3226, 3041, 2847, 2647, 2444, 2241, 2040,
+  1845, 1656, 1477, 1308, 1150, 1005, 871, 750, 642, 545, 460, 385,
+  321, 265, 217, 177, 143, 115, 92, 73, 57, 45, 3470, 3458,
+  3422, 3363, 3283, 3182, 3062, 2927, 2779, 2619, 2452, 2280, 2105, 1930,
+  1757, 1589, 1427, 1272, 1127, 991, 865, 750, 646, 553, 470, 396,
+  332, 276, 228, 187, 152, 123, 99, 79, 63, 49, 39, 2968,
+  2958, 2927, 2877, 2808, 2721, 2619, 2504, 2377, 2241, 2098, 1950, 1800,
+  1651, 1503, 1359, 1220, 1088, 964, 847, 740, 642, 553, 473, 402,
+  339, 284, 236, 195, 160, 130, 106, 85, 68, 54, 42, 33,
+  2521, 2513, 2487, 2444, 2385, 2312, 2225, 2127, 2019, 1903, 1782, 1656,
+  1529, 1402, 1277, 1154, 1037, 924, 819, 720, 629, 545, 470, 402,
+  341, 288, 241, 201, 166, 136, 111, 90, 72, 57, 46, 36,
+  28, 2127, 2119, 2098, 2061, 2012, 1950, 1877, 1794, 1703, 1605, 1503,
+  1397, 1290, 1183, 1077, 974, 874, 780, 690, 607, 530, 460, 396,
+  339, 288, 243, 203, 169, 140, 115, 93, 76, 61, 48, 38,
+  30, 24, 1782, 1776, 1757, 1727, 1685, 1634, 1572, 1503, 1427, 1345,
+  1259, 1170, 1081, 991, 902, 816, 732, 653, 578, 509, 444, 385,
+  332, 284, 241, 203, 170, 142, 117, 96, 78, 63, 51, 41,
+  32, 25, 20, 1482, 1477, 1462, 1437, 1402, 1359, 1308, 1250, 1187,
+  1119, 1047, 974, 899, 824, 750, 679, 609, 543, 481, 423, 370,
+  321, 276, 236, 201, 169, 142, 118, 97, 80, 65, 53, 42,
+  34, 27, 21, 16, 1225, 1220, 1208, 1187, 1158, 1123, 1081, 1033,
+  981, 924, 865, 804, 743, 681, 620, 561, 503, 449, 398, 350,
+  305, 265, 228, 195, 166, 140, 117, 97, 80, 66, 54, 44,
+  35, 28, 22, 17, 14, 1005, 1001, 991, 974, 950, 921, 887,
+  847, 804, 758, 710, 660, 609, 559, 509, 460, 413, 368, 326,
+  287, 251, 217, 187, 160, 136, 115, 96, 80, 66, 54, 44,
+  36, 29, 23, 18, 14, 11, 819, 816, 807, 793, 774, 750,
+  722, 690, 655, 618, 578, 538, 496, 455, 414, 375, 337, 300,
+  266, 234, 204, 177, 152, 130, 111, 93, 78, 65, 54, 44,
+  36, 29, 23, 19, 15, 12, 9, 662, 660, 653, 642, 627,
+  607, 584, 559, 530, 500, 468, 435, 402, 368, 335, 303, 272,
+  243, 215, 189, 165, 143, 123, 106, 90, 76, 63, 53, 44,
+  36, 29, 24, 19, 15, 12, 9, 7, 532, 530, 525, 516,
+  503, 488, 470, 449, 426, 402, 376, 350, 323, 296, 269, 244,
+  219, 195, 173, 152, 133, 115, 99, 85, 72, 61, 51, 42,
+  35, 29, 23, 19, 15, 12, 10, 8, 6, 425, 423, 419,
+  412, 402, 389, 375, 358, 340, 321, 300, 279, 258, 236, 215,
+  194, 175, 156, 138, 121, 106, 92, 79, 68, 57, 48, 41,
+  34, 28, 23, 19, 15, 12, 10, 8, 6, 5, 337, 335,
+  332, 326, 318, 309, 297, 284, 269, 254, 238, 221, 204, 187,
+  170, 154, 138, 123, 109, 96, 84, 73, 63, 54, 46, 38,
+  32, 27, 22, 18, 15, 12, 10, 8, 6, 5, 4, 265,
+  264, 261, 257, 251, 243, 234, 223, 212, 200, 187, 174, 161,
+  147, 134, 121, 109, 97, 86, 76, 66, 57, 49, 42, 36,
+  30, 25, 21, 17, 14, 12, 9, 8, 6, 5, 4, 3,
+  207, 206, 204, 201, 196, 190, 183, 175, 166, 156, 146, 136,
+  126, 115, 105, 95, 85, 76, 67, 59, 52, 45, 39, 33,
+  28, 24, 20, 16, 14, 11, 9, 7, 6, 5, 4, 3,
+  2
+};
+static const int kern_row_fixed_12[] = {
+  6211, 7947, 10099, 12744, 15970, 19875, 24564, 30149, 36747, 44480, 53467, 63825,
+  75662, 89075, 104139, 120908, 139406, 159622, 181505, 204959, 229842, 255962, 283079, 310901,
+  339095, 367286, 395068, 422011, 447671, 471605, 493380, 512589, 528861, 541872, 551362, 557135,
+  559073, 557135, 551362, 541872, 528861, 512589, 493380, 471605, 447671, 422011, 395068, 367286,
+  339095, 310901, 283079, 255962, 229842, 204959, 181505, 159622, 139406, 120908, 104139, 89075,
+  75662, 63825, 53467, 44480, 36747, 30149, 24564, 19875, 15970, 12744, 10099, 7947,
+  6211
+};
+
+static const float kern_half_13[] = {
+  3.06878686e-02f, 3.05972099e-02f, 3.03268377e-02f, 2.98815183e-02f, 2.92690340e-02f, 2.84999665e-02f,
+  2.75873821e-02f, 2.65464745e-02f, 2.53941361e-02f, 2.41485033e-02f, 2.28284914e-02f, 2.14533154e-02f,
+  2.00420357e-02f, 1.86131336e-02f, 1.71841197e-02f, 1.57712232e-02f, 1.43890996e-02f, 1.30506484e-02f,
+  1.17668649e-02f, 1.05467746e-02f, 9.39742196e-03f, 8.32392275e-03f, 7.32955430e-03f, 6.41589565e-03f,
+  5.58299525e-03f, 4.82955808e-03f, 4.15315107e-03f, 3.55040841e-03f, 3.01723485e-03f, 2.54900148e-03f,
+  2.14072689e-03f, 1.78723922e-03f, 1.48331816e-03f, 1.22381607e-03f, 1.00375607e-03f, 8.18409084e-04f,
+  6.63350278e-04f, 5.34497376e-04f, 4.28132742e-04f, 3.40911414e-04f, 3.05972099e-02f, 3.05068195e-02f,
+  3.02372463e-02f, 2.97932420e-02f, 2.91825682e-02f, 2.84157712e-02f, 2.75058839e-02f, 2.64680516e-02f,
+  2.53191162e-02f, 2.40771640e-02f, 2.27610525e-02f, 2.13899389e-02f, 1.99828278e-02f, 1.85581464e-02f,
+  1.71333551e-02f, 1.57246310e-02f, 1.43465912e-02f, 1.30120935e-02f, 1.17321033e-02f, 1.05156172e-02f,
+  9.36966017e-03f, 8.29933211e-03f, 7.30790151e-03f, 6.39694184e-03f, 5.56650152e-03f, 4.81529068e-03f,
+  4.14088182e-03f, 3.53991985e-03f, 3.00832116e-03f, 2.54147127e-03f, 2.13440275e-03f, 1.78195944e-03f,
+  1.47893617e-03f, 1.22020068e-03f, 1.00079074e-03f, 8.15991312e-04f, 6.61390601e-04f, 5.32918377e-04f,
+  4.26867948e-04f, 3.39904305e-04f, 3.03268377e-02f, 3.02372463e-02f, 2.99700554e-02f, 2.95299757e-02f,
+  2.89246961e-02f, 2.81646755e-02f, 2.72628292e-02f, 2.62341667e-02f, 2.50953846e-02f, 2.38644071e-02f,
+  2.25599241e-02f, 2.12009270e-02f, 1.98062509e-02f, 1.83941573e-02f, 1.69819575e-02f, 1.55856805e-02f,
+  1.42198177e-02f, 1.28971133e-02f, 1.16284322e-02f, 1.04226964e-02f, 9.28686559e-03f, 8.22599605e-03f,
+  7.24332547e-03f, 6.34041568e-03f, 5.51731372e-03f, 4.77274042e-03f, 4.10429109e-03f, 3.50863952e-03f,
+  2.98173819e-03f, 2.51901359e-03f, 2.11554230e-03f, 1.76621322e-03f, 1.46586762e-03f, 1.20941841e-03f,
+  9.91947367e-04f, 8.08780838e-04f, 6.55546202e-04f, 5.28209261e-04f, 4.23095946e-04f, 3.36900732e-04f,
+  2.98815183e-02f, 2.97932420e-02f, 2.95299757e-02f, 2.90963557e-02f, 2.84999665e-02f, 2.77511049e-02f,
+  2.68625002e-02f, 2.58489437e-02f, 2.47268844e-02f, 2.35139821e-02f, 2.22286545e-02f, 2.08896119e-02f,
+  1.95154157e-02f, 1.81240570e-02f, 1.67325940e-02f, 1.53568201e-02f, 1.40110143e-02f, 1.27077317e-02f,
+  1.14576807e-02f, 1.02696484e-02f, 9.15049762e-03f, 8.10520537e-03f, 7.13696424e-03f, 6.24731276e-03f,
+  5.43629704e-03f, 4.70265746e-03f, 4.04402381e-03f, 3.45711852e-03f, 2.93795438e-03f, 2.48202425e-03f,
+  2.08447757e-03f, 1.74027809e-03f, 1.44434278e-03f, 1.19165925e-03f, 9.77381598e-04f, 7.96904671e-04f,
+  6.45920169e-04f, 5.20452973e-04f, 4.16883209e-04f, 3.31953692e-04f, 2.92690340e-02f, 2.91825682e-02f,
+  2.89246961e-02f, 2.84999665e-02f, 2.79158000e-02f, 2.71822885e-02f, 2.63118986e-02f, 2.53191162e-02f,
+  2.42200550e-02f, 2.30320133e-02f, 2.17730310e-02f, 2.04614364e-02f, 1.91154052e-02f, 1.77525673e-02f,
+  1.63896233e-02f, 1.50420507e-02f, 1.37238288e-02f, 1.24472603e-02f, 1.12228319e-02f, 1.00591509e-02f,
+  8.96293856e-03f, 7.93907233e-03f, 6.99067721e-03f, 6.11926103e-03f, 5.32486895e-03f, 4.60626651e-03f,
+  3.96113284e-03f, 3.38625768e-03f, 2.87773483e-03f, 2.43115006e-03f, 2.04175198e-03f, 1.70460739e-03f,
+  1.41473790e-03f, 1.16723368e-03f, 9.57348093e-04f, 7.80570495e-04f, 6.32680720e-04f, 5.09785255e-04f,
+  4.08338325e-04f, 3.25149595e-04f, 2.84999665e-02f, 2.84157712e-02f, 2.81646755e-02f, 2.77511049e-02f,
+  2.71822885e-02f, 2.64680516e-02f, 2.56205313e-02f, 2.46538352e-02f, 2.35836525e-02f, 2.24268287e-02f,
+  2.12009270e-02f, 1.99237950e-02f, 1.86131336e-02f, 1.72861032e-02f, 1.59589723e-02f, 1.46468077e-02f,
+  1.33632235e-02f, 1.21201975e-02f, 1.09279426e-02f, 9.79483873e-03f, 8.72743037e-03f, 7.73046631e-03f,
+  6.80699153e-03f, 5.95847238e-03f, 5.18495357e-03f, 4.48523322e-03f, 3.85705102e-03f, 3.29728099e-03f,
+  2.80212006e-03f, 2.36726948e-03f, 1.98810315e-03f, 1.65981741e-03f, 1.37756451e-03f, 1.13656372e-03f,
+  9.32192954e-04f, 7.60060328e-04f, 6.16056495e-04f, 4.96390217e-04f, 3.97608877e-04f, 3.16606020e-04f,
+  2.75873821e-02f, 2.75058839e-02f, 2.72628292e-02f, 2.68625002e-02f, 2.63118986e-02f, 2.56205313e-02f,
+  2.48001479e-02f, 2.38644071e-02f, 2.28284914e-02f, 2.17087101e-02f, 2.05220617e-02f, 1.92858241e-02f,
+  1.80171300e-02f, 1.67325940e-02f, 1.54479584e-02f, 1.41778095e-02f, 1.29353264e-02f, 1.17321033e-02f,
+  1.05780242e-02f, 9.48120281e-03f, 8.44797306e-03f, 7.48293288e-03f, 6.58902805e-03f, 5.76767884e-03f,
+  5.01892855e-03f, 4.34161350e-03f, 3.73354624e-03f, 3.19170021e-03f, 2.71239458e-03f, 2.29146844e-03f,
+  1.92444306e-03f, 1.60666928e-03f, 1.33345416e-03f, 1.10017031e-03f, 9.02343658e-04f, 7.35722831e-04f,
+  5.96330035e-04f, 4.80495539e-04f, 3.84877232e-04f, 3.06468137e-04f, 2.65464745e-02f, 2.64680516e-02f,
+  2.62341667e-02f, 2.58489437e-02f, 2.53191162e-02f, 2.46538352e-02f, 2.38644071e-02f, 2.29639728e-02f,
+  2.19671428e-02f, 2.08896119e-02f, 1.97477378e-02f, 1.85581464e-02f, 1.73373204e-02f, 1.61012504e-02f,
+  1.48650873e-02f, 1.36428624e-02f, 1.24472603e-02f, 1.12894354e-02f, 1.01789013e-02f, 9.12346505e-03f,
+  8.12922046e-03f, 7.20059220e-03f, 6.34041568e-03f, 5.55005716e-03f, 4.82955808e-03f, 4.17779898e-03f,
+  3.59267462e-03f, 3.07127344e-03f, 2.61005247e-03f, 2.20500841e-03f, 1.85183133e-03f, 1.54604751e-03f,
+  1.28314120e-03f, 1.05865952e-03f, 8.68297066e-04f, 7.07963074e-04f, 5.73829748e-04f, 4.62365831e-04f,
+  3.70355323e-04f, 2.94904690e-04f, 2.53941361e-02f, 2.53191162e-02f, 2.50953846e-02f, 2.47268844e-02f,
+  2.42200550e-02f, 2.35836525e-02f, 2.28284914e-02f, 2.19671428e-02f, 2.10135859e-02f, 1.99828278e-02f,
+  1.88905206e-02f, 1.77525673e-02f, 1.65847372e-02f, 1.54023217e-02f, 1.42198177e-02f, 1.30506484e-02f,
+  1.19069451e-02f, 1.07993800e-02f, 9.73705202e-03f, 8.72743037e-03f, 7.77634420e-03f, 6.88802591e-03f,
+  6.06518844e-03f, 5.30913798e-03f, 4.61991457e-03f, 3.99644766e-03f, 3.43672256e-03f, 2.93795438e-03f,
+  2.49675428e-03f, 2.10929243e-03f, 1.77144643e-03f, 1.47893617e-03f, 1.22744218e-03f, 1.01270480e-03f,
+  8.30605743e-04f, 6.77231525e-04f, 5.48920711e-04f, 4.42295277e-04f, 3.54278804e-04f, 2.82103370e-04f,
+  2.41485033e-02f, 2.40771640e-02f, 2.38644071e-02f, 2.35139821e-02f, 2.30320133e-02f, 2.24268287e-02f,
+  2.17087101e-02f, 2.08896119e-02f, 1.99828278e-02f, 1.90026313e-02f, 1.79639049e-02f, 1.68817677e-02f,
+  1.57712232e-02f, 1.46468077e-02f, 1.35223083e-02f, 1.24104880e-02f, 1.13228858e-02f, 1.02696484e-02f,
+  9.25943069e-03f, 8.29933211e-03f, 7.39489915e-03f, 6.55015465e-03f, 5.76767884e-03f, 5.04871458e-03f,
+  4.39329911e-03f, 3.80041404e-03f, 3.26814456e-03f, 2.79384200e-03f, 2.37428374e-03f, 2.00582761e-03f,
+  1.68455346e-03f, 1.40639138e-03f, 1.16723368e-03f, 9.63029626e-04f, 7.89862883e-04f, 6.44012005e-04f,
+  5.21995069e-04f, 4.20599827e-04f, 3.36900732e-04f, 2.68265634e-04f, 2.28284914e-02f, 2.27610525e-02f,
+  2.25599241e-02f, 2.22286545e-02f, 2.17730310e-02f, 2.12009270e-02f, 2.05220617e-02f, 1.97477378e-02f,
+  1.88905206e-02f, 1.79639049e-02f, 1.69819575e-02f, 1.59589723e-02f, 1.49091315e-02f, 1.38461804e-02f,
+  1.27831483e-02f, 1.17321033e-02f, 1.07039511e-02f, 9.70828626e-03f, 8.75328947e-03f, 7.84567185e-03f,
+  6.99067721e-03f, 6.19210862e-03f, 5.45240473e-03f, 4.77274042e-03f, 4.15315107e-03f, 3.59267462e-03f,
+  3.08950036e-03f, 2.64112419e-03f, 2.24449998e-03f, 1.89618452e-03f, 1.59247196e-03f, 1.32951490e-03f,
+  1.10343006e-03f, 9.10388306e-04f, 7.46687176e-04f, 6.08808827e-04f, 4.93461674e-04f, 3.97608877e-04f,
+  3.18484992e-04f, 2.53601640e-04f, 2.14533154e-02f, 2.13899389e-02f, 2.12009270e-02f, 2.08896119e-02f,
+  2.04614364e-02f, 1.99237950e-02f, 1.92858241e-02f, 1.85581464e-02f, 1.77525673e-02f, 1.68817677e-02f,
+  1.59589723e-02f, 1.49976127e-02f, 1.40110143e-02f, 1.30120935e-02f, 1.20130982e-02f, 1.10253673e-02f,
+  1.00591509e-02f, 9.12346505e-03f, 8.22599605e-03f, 7.37305311e-03f, 6.56956248e-03f, 5.81909949e-03f,
+  5.12395473e-03f, 4.48523322e-03f, 3.90296779e-03f, 3.37625388e-03f, 2.90339068e-03f, 2.48202425e-03f,
+  2.10929243e-03f, 1.78195944e-03f, 1.49654236e-03f, 1.24942570e-03f, 1.03696005e-03f, 8.55546969e-04f,
+  7.01707148e-04f, 5.72134508e-04f, 4.63735778e-04f, 3.73657153e-04f, 2.99299631e-04f, 2.38324807e-04f,
+  2.00420357e-02f, 1.99828278e-02f, 1.98062509e-02f, 1.95154157e-02f, 1.91154052e-02f, 1.86131336e-02f,
+  1.80171300e-02f, 1.73373204e-02f, 1.65847372e-02f, 1.57712232e-02f, 1.49091315e-02f, 1.40110143e-02f,
+  1.30893169e-02f, 1.21561093e-02f, 1.12228319e-02f, 1.03000775e-02f, 9.39742196e-03f, 8.52328911e-03f,
+  7.68485898e-03f, 6.88802591e-03f, 6.13739202e-03f, 5.43629704e-03f, 4.78688162e-03f, 4.19017766e-03f,
+  3.64621589e-03f, 3.15415137e-03f, 2.71239458e-03f, 2.31874757e-03f, 1.97053538e-03f, 1.66473538e-03f,
+  1.39809411e-03f, 1.16723368e-03f, 9.68744920e-04f, 7.99265865e-04f, 6.55546202e-04f, 5.34497376e-04f,
+  4.33229521e-04f, 3.49076581e-04f, 2.79610569e-04f, 2.22646908e-04f, 1.86131336e-02f, 1.85581464e-02f,
+  1.83941573e-02f, 1.81240570e-02f, 1.77525673e-02f, 1.72861032e-02f, 1.67325940e-02f, 1.61012504e-02f,
+  1.54023217e-02f, 1.46468077e-02f, 1.38461804e-02f, 1.30120935e-02f, 1.21561093e-02f, 1.12894354e-02f,
+  1.04226964e-02f, 9.56572965e-03f, 8.72743037e-03f, 7.91561790e-03f, 7.13696424e-03f, 6.39694184e-03f,
+  5.69982501e-03f, 5.04871458e-03f, 4.44559939e-03f, 3.89143755e-03f, 3.38625768e-03f, 2.92927492e-03f,
+  2.51901359e-03f, 2.15343153e-03f, 1.83004537e-03f, 1.54604751e-03f, 1.29841652e-03f, 1.08401536e-03f,
+  8.99677980e-04f, 7.42281962e-04f, 6.08808827e-04f, 4.96390217e-04f, 4.02342266e-04f, 3.24189052e-04f,
+  2.59675639e-04f, 2.06773228e-04f, 1.71841197e-02f, 1.71333551e-02f, 1.69819575e-02f, 1.67325940e-02f,
+  1.63896233e-02f, 1.59589723e-02f, 1.54479584e-02f, 1.48650873e-02f, 1.42198177e-02f, 1.35223083e-02f,
+  1.27831483e-02f, 1.20130982e-02f, 1.12228319e-02f, 1.04226964e-02f, 9.62249935e-03f, 8.83132685e-03f,
+  8.05738661e-03f, 7.30790151e-03f, 6.58902805e-03f, 5.90582052e-03f, 5.26222400e-03f, 4.66110231e-03f,
+  4.10429109e-03f, 3.59267462e-03f, 3.12627968e-03f, 2.70438171e-03f, 2.32561771e-03f, 1.98810315e-03f,
+  1.68954476e-03f, 1.42735068e-03f, 1.19873136e-03f, 1.00079074e-03f, 8.30605743e-04f, 6.85293693e-04f,
+  5.62067900e-04f, 4.58280148e-04f, 3.71452683e-04f, 2.99299631e-04f, 2.39739195e-04f, 1.90898339e-04f,
+  1.57712232e-02f, 1.57246310e-02f, 1.55856805e-02f, 1.53568201e-02f, 1.50420507e-02f, 1.46468077e-02f,
+  1.41778095e-02f, 1.36428624e-02f, 1.30506484e-02f, 1.24104880e-02f, 1.17321033e-02f, 1.10253673e-02f,
+  1.03000775e-02f, 9.56572965e-03f, 8.83132685e-03f, 8.10520537e-03f, 7.39489915e-03f, 6.70703733e-03f,
+  6.04727073e-03f, 5.42023731e-03f, 4.82955808e-03f, 4.27786121e-03f, 3.76683171e-03f, 3.29728099e-03f,
+  2.86923349e-03f, 2.48202425e-03f, 2.13440275e-03f, 1.82463904e-03f, 1.55062845e-03f, 1.30999228e-03f,
+  1.10017031e-03f, 9.18504607e-04f, 7.62312382e-04f, 6.28948095e-04f, 5.15854044e-04f, 4.20599827e-04f,
+  3.40911414e-04f, 2.74690858e-04f, 2.20027563e-04f, 1.75202455e-04f, 1.43890996e-02f, 1.43465912e-02f,
+  1.42198177e-02f, 1.40110143e-02f, 1.37238288e-02f, 1.33632235e-02f, 1.29353264e-02f, 1.24472603e-02f,
+  1.19069451e-02f, 1.13228858e-02f, 1.07039511e-02f, 1.00591509e-02f, 9.39742196e-03f, 8.72743037e-03f,
+  8.05738661e-03f, 7.39489915e-03f, 6.74684159e-03f, 6.11926103e-03f, 5.51731372e-03f, 4.94523067e-03f,
+  4.40631621e-03f, 3.90296779e-03f, 3.43672256e-03f, 3.00832116e-03f, 2.61778594e-03f, 2.26451014e-03f,
+  1.94735290e-03f, 1.66473538e-03f, 1.41473790e-03f, 1.19519013e-03f, 1.00375607e-03f, 8.38010747e-04f,
+  6.95506518e-04f, 5.73829748e-04f, 4.70646773e-04f, 3.83740233e-04f, 3.11035401e-04f, 2.50618119e-04f,
+  2.00745286e-04f, 1.59848452e-04f, 1.30506484e-02f, 1.30120935e-02f, 1.28971133e-02f, 1.27077317e-02f,
+  1.24472603e-02f, 1.21201975e-02f, 1.17321033e-02f, 1.12894354e-02f, 1.07993800e-02f, 1.02696484e-02f,
+  9.70828626e-03f, 9.12346505e-03f, 8.52328911e-03f, 7.91561790e-03f, 7.30790151e-03f, 6.70703733e-03f,
+  6.11926103e-03f, 5.55005716e-03f, 5.00410190e-03f, 4.48523322e-03f, 3.99644766e-03f, 3.53991985e-03f,
+  3.11704399e-03f, 2.72849202e-03f, 2.37428374e-03f, 2.05386919e-03f, 1.76621322e-03f, 1.50988437e-03f,
+  1.28314120e-03f, 1.08401536e-03f, 9.10388306e-04f, 7.60060328e-04f, 6.30811614e-04f, 5.20452973e-04f,
+  4.26867948e-04f, 3.48045316e-04f, 2.82103370e-04f, 2.27306024e-04f, 1.82072283e-04f, 1.44979611e-04f,
+  1.17668649e-02f, 1.17321033e-02f, 1.16284322e-02f, 1.14576807e-02f, 1.12228319e-02f, 1.09279426e-02f,
+  1.05780242e-02f, 1.01789013e-02f, 9.73705202e-03f, 9.25943069e-03f, 8.75328947e-03f, 8.22599605e-03f,
+  7.68485898e-03f, 7.13696424e-03f, 6.58902805e-03f, 6.04727073e-03f, 5.51731372e-03f, 5.00410190e-03f,
+  4.51185182e-03f, 4.04402381e-03f, 3.60331964e-03f, 3.19170021e-03f, 2.81042256e-03f, 2.46009207e-03f,
+  2.14072689e-03f, 1.85183133e-03f, 1.59247196e-03f, 1.36135810e-03f, 1.15691952e-03f, 9.77381598e-04f,
+  8.20834015e-04f, 6.85293693e-04f, 5.68759104e-04f, 4.69256396e-04f, 3.84877232e-04f, 3.13808356e-04f,
+  2.54353043e-04f, 2.04946075e-04f, 1.64161946e-04f, 1.30718065e-04f, 1.05467746e-02f, 1.05156172e-02f,
+  1.04226964e-02f, 1.02696484e-02f, 1.00591509e-02f, 9.79483873e-03f, 9.48120281e-03f, 9.12346505e-03f,
+  8.72743037e-03f, 8.29933211e-03f, 7.84567185e-03f, 7.37305311e-03f, 6.88802591e-03f, 6.39694184e-03f,
+  5.90582052e-03f, 5.42023731e-03f, 4.94523067e-03f, 4.48523322e-03f, 4.04402381e-03f, 3.62470420e-03f,
+  3.22969630e-03f, 2.86075706e-03f, 2.51901359e-03f, 2.20500841e-03f, 1.91875792e-03f, 1.65981741e-03f,
+  1.42735068e-03f, 1.22020068e-03f, 1.03696005e-03f, 8.76038161e-04f, 7.35722831e-04f, 6.14236516e-04f,
+  5.09785255e-04f, 4.20599827e-04f, 3.44969827e-04f, 2.81269982e-04f, 2.27979515e-04f, 1.83695491e-04f,
+  1.47140221e-04f, 1.17164076e-04f, 9.39742196e-03f, 9.36966017e-03f, 9.28686559e-03f, 9.15049762e-03f,
+  8.96293856e-03f, 8.72743037e-03f, 8.44797306e-03f, 8.12922046e-03f, 7.77634420e-03f, 7.39489915e-03f,
+  6.99067721e-03f, 6.56956248e-03f, 6.13739202e-03f, 5.69982501e-03f, 5.26222400e-03f, 4.82955808e-03f,
+  4.40631621e-03f, 3.99644766e-03f, 3.60331964e-03f, 3.22969630e-03f, 2.87773483e-03f, 2.54900148e-03f,
+  2.24449998e-03f, 1.96471391e-03f, 1.70965807e-03f, 1.47893617e-03f, 1.27180282e-03f, 1.08722725e-03f,
+  9.23955638e-04f, 7.80570495e-04f, 6.55546202e-04f, 5.47299103e-04f, 4.54230554e-04f, 3.74764262e-04f,
+  3.07376176e-04f, 2.50618119e-04f, 2.03135089e-04f, 1.63676974e-04f, 1.31105378e-04f, 1.04395935e-04f,
+  8.32392275e-03f, 8.29933211e-03f, 8.22599605e-03f, 8.10520537e-03f, 7.93907233e-03f, 7.73046631e-03f,
+  7.48293288e-03f, 7.20059220e-03f, 6.88802591e-03f, 6.55015465e-03f, 6.19210862e-03f, 5.81909949e-03f,
+  5.43629704e-03f, 5.04871458e-03f, 4.66110231e-03f, 4.27786121e-03f, 3.90296779e-03f, 3.53991985e-03f,
+  3.19170021e-03f, 2.86075706e-03f, 2.54900148e-03f, 2.25782045e-03f, 1.98810315e-03f, 1.74027809e-03f,
+  1.51435810e-03f, 1.30999228e-03f, 1.12652045e-03f, 9.63029626e-04f, 8.18409084e-04f, 6.91403286e-04f,
+  5.80660941e-04f, 4.84779273e-04f, 4.02342266e-04f, 3.31953692e-04f, 2.72263569e-04f, 2.21989161e-04f,
+  1.79930270e-04f, 1.44979611e-04f, 1.16128758e-04f, 9.24704291e-05f, 7.32955430e-03f, 7.30790151e-03f,
+  7.24332547e-03f, 7.13696424e-03f, 6.99067721e-03f, 6.80699153e-03f, 6.58902805e-03f, 6.34041568e-03f,
+  6.06518844e-03f, 5.76767884e-03f, 5.45240473e-03f, 5.12395473e-03f, 4.78688162e-03f, 4.44559939e-03f,
+  4.10429109e-03f, 3.76683171e-03f, 3.43672256e-03f, 3.11704399e-03f, 2.81042256e-03f, 2.51901359e-03f,
+  2.24449998e-03f, 1.98810315e-03f, 1.75060611e-03f, 1.53238594e-03f, 1.33345416e-03f, 1.15350168e-03f,
+  9.91947367e-04f, 8.47986958e-04f, 7.20642623e-04f, 6.08808827e-04f, 5.11295686e-04f, 4.26867948e-04f,
+  3.54278804e-04f, 2.92298791e-04f, 2.39739195e-04f, 1.95470537e-04f, 1.58435956e-04f, 1.27660474e-04f,
+  1.02256119e-04f, 8.14239975e-05f, 6.41589565e-03f, 6.39694184e-03f, 6.34041568e-03f, 6.24731276e-03f,
+  6.11926103e-03f, 5.95847238e-03f, 5.76767884e-03f, 5.55005716e-03f, 5.30913798e-03f, 5.04871458e-03f,
+  4.77274042e-03f, 4.48523322e-03f, 4.19017766e-03f, 3.89143755e-03f, 3.59267462e-03f, 3.29728099e-03f,
+  3.00832116e-03f, 2.72849202e-03f, 2.46009207e-03f, 2.20500841e-03f, 1.96471391e-03f, 1.74027809e-03f,
+  1.53238594e-03f, 1.34136784e-03f, 1.16723368e-03f, 1.00971304e-03f, 8.68297066e-04f, 7.42281962e-04f,
+  6.30811614e-04f, 5.32918377e-04f, 4.47560626e-04f, 3.73657153e-04f, 3.10116535e-04f, 2.55862571e-04f,
+  2.09854741e-04f, 1.71104344e-04f, 1.38686271e-04f, 1.11747075e-04f, 8.95094781e-05f, 7.12741676e-05f,
+  5.58299525e-03f, 5.56650152e-03f, 5.51731372e-03f, 5.43629704e-03f, 5.32486895e-03f, 5.18495357e-03f,
+  5.01892855e-03f, 4.82955808e-03f, 4.61991457e-03f, 4.39329911e-03f, 4.15315107e-03f, 3.90296779e-03f,
+  3.64621589e-03f, 3.38625768e-03f, 3.12627968e-03f, 2.86923349e-03f, 2.61778594e-03f, 2.37428374e-03f,
+  2.14072689e-03f, 1.91875792e-03f, 1.70965807e-03f, 1.51435810e-03f, 1.33345416e-03f, 1.16723368e-03f,
+  1.01570541e-03f, 8.78633815e-04f, 7.55576242e-04f, 6.45920169e-04f, 5.48920711e-04f, 4.63735778e-04f,
+  3.89459077e-04f, 3.25149595e-04f, 2.69857730e-04f, 2.22646908e-04f, 1.82611751e-04f, 1.48891864e-04f,
+  1.20682256e-04f, 9.72402559e-05f, 7.78895119e-05f, 6.20214705e-05f, 4.82955808e-03f, 4.81529068e-03f,
+  4.77274042e-03f, 4.70265746e-03f, 4.60626651e-03f, 4.48523322e-03f, 4.34161350e-03f, 4.17779898e-03f,
+  3.99644766e-03f, 3.80041404e-03f, 3.59267462e-03f, 3.37625388e-03f, 3.15415137e-03f, 2.92927492e-03f,
+  2.70438171e-03f, 2.48202425e-03f, 2.26451014e-03f, 2.05386919e-03f, 1.85183133e-03f, 1.65981741e-03f,
+  1.47893617e-03f, 1.30999228e-03f, 1.15350168e-03f, 1.00971304e-03f, 8.78633815e-04f, 7.60060328e-04f,
+  6.53609633e-04f, 5.58751868e-04f, 4.74842702e-04f, 4.01153666e-04f, 3.36900732e-04f, 2.81269982e-04f,
+  2.33439845e-04f, 1.92600244e-04f, 1.57967908e-04f, 1.28798594e-04f, 1.04395935e-04f, 8.41174769e-05f,
+  6.73781542e-05f, 5.36515436e-05f, 4.15315107e-03f, 4.14088182e-03f, 4.10429109e-03f, 4.04402381e-03f,
+  3.96113284e-03f, 3.85705102e-03f, 3.73354624e-03f, 3.59267462e-03f, 3.43672256e-03f, 3.26814456e-03f,
+  3.08950036e-03f, 2.90339068e-03f, 2.71239458e-03f, 2.51901359e-03f, 2.32561771e-03f, 2.13440275e-03f,
+  1.94735290e-03f, 1.76621322e-03f, 1.59247196e-03f, 1.42735068e-03f, 1.27180282e-03f, 1.12652045e-03f,
+  9.91947367e-04f, 8.68297066e-04f, 7.55576242e-04f, 6.53609633e-04f, 5.62067900e-04f, 4.80495539e-04f,
+  4.08338325e-04f, 3.44969827e-04f, 2.89715885e-04f, 2.41876536e-04f, 2.00745286e-04f, 1.65625490e-04f,
+  1.35843613e-04f, 1.10759625e-04f, 8.97746941e-05f, 7.23363555e-05f, 5.79414664e-05f, 4.61373420e-05f,
+  3.55040841e-03f, 3.53991985e-03f, 3.50863952e-03f, 3.45711852e-03f, 3.38625768e-03f, 3.29728099e-03f,
+  3.19170021e-03f, 3.07127344e-03f, 2.93795438e-03f, 2.79384200e-03f, 2.64112419e-03f, 2.48202425e-03f,
+  2.31874757e-03f, 2.15343153e-03f, 1.98810315e-03f, 1.82463904e-03f, 1.66473538e-03f, 1.50988437e-03f,
+  1.36135810e-03f, 1.22020068e-03f, 1.08722725e-03f, 9.63029626e-04f, 8.47986958e-04f, 7.42281962e-04f,
+  6.45920169e-04f, 5.58751868e-04f, 4.80495539e-04f, 4.10761684e-04f, 3.49076581e-04f, 2.94904690e-04f,
+  2.47669697e-04f, 2.06773228e-04f, 1.71611318e-04f, 1.41588433e-04f, 1.16128758e-04f, 9.46851869e-05f,
+  7.67457823e-05f, 6.18382473e-05f, 4.95324784e-05f, 3.94414747e-05f, 3.01723485e-03f, 3.00832116e-03f,
+  2.98173819e-03f, 2.93795438e-03f, 2.87773483e-03f, 2.80212006e-03f, 2.71239458e-03f, 2.61005247e-03f,
+  2.49675428e-03f, 2.37428374e-03f, 2.24449998e-03f, 2.10929243e-03f, 1.97053538e-03f, 1.83004537e-03f,
+  1.68954476e-03f, 1.55062845e-03f, 1.41473790e-03f, 1.28314120e-03f, 1.15691952e-03f, 1.03696005e-03f,
+  9.23955638e-04f, 8.18409084e-04f, 7.20642623e-04f, 6.30811614e-04f, 5.48920711e-04f, 4.74842702e-04f,
+  4.08338325e-04f, 3.49076581e-04f, 2.96654878e-04f, 2.50618119e-04f, 2.10476530e-04f, 1.75721580e-04f,
+  1.45840022e-04f, 1.20325742e-04f, 9.86894156e-05f, 8.04660740e-05f, 6.52206727e-05f, 5.25518444e-05f,
+  4.20940632e-05f, 3.35184486e-05f, 2.54900148e-03f, 2.54147127e-03f, 2.51901359e-03f, 2.48202425e-03f,
+  2.43115006e-03f, 2.36726948e-03f, 2.29146844e-03f, 2.20500841e-03f, 2.10929243e-03f, 2.00582761e-03f,
+  1.89618452e-03f, 1.78195944e-03f, 1.66473538e-03f, 1.54604751e-03f, 1.42735068e-03f, 1.30999228e-03f,
+  1.19519013e-03f, 1.08401536e-03f, 9.77381598e-04f, 8.76038161e-04f, 7.80570495e-04f, 6.91403286e-04f,
+  6.08808827e-04f, 5.32918377e-04f, 4.63735778e-04f, 4.01153666e-04f, 3.44969827e-04f, 2.94904690e-04f,
+  2.50618119e-04f, 2.11725637e-04f, 1.77813476e-04f, 1.48452003e-04f, 1.23207661e-04f, 1.01652840e-04f,
+  8.33741797e-05f, 6.79788500e-05f, 5.50993245e-05f, 4.43965218e-05f, 3.55616430e-05f, 2.83168483e-05f,
+  2.14072689e-03f, 2.13440275e-03f, 2.11554230e-03f, 2.08447757e-03f, 2.04175198e-03f, 1.98810315e-03f,
+  1.92444306e-03f, 1.85183133e-03f, 1.77144643e-03f, 1.68455346e-03f, 1.59247196e-03f, 1.49654236e-03f,
+  1.39809411e-03f, 1.29841652e-03f, 1.19873136e-03f, 1.10017031e-03f, 1.00375607e-03f, 9.10388306e-04f,
+  8.20834015e-04f, 7.35722831e-04f, 6.55546202e-04f, 5.80660941e-04f, 5.11295686e-04f, 4.47560626e-04f,
+  3.89459077e-04f, 3.36900732e-04f, 2.89715885e-04f, 2.47669697e-04f, 2.10476530e-04f, 1.77813476e-04f,
+  1.49333020e-04f, 1.24674392e-04f, 1.03473438e-04f, 8.53710662e-05f, 7.00201053e-05f, 5.70906523e-05f,
+  4.62740463e-05f, 3.72855138e-05f, 2.98657233e-05f, 2.37813292e-05f, 1.78723922e-03f, 1.78195944e-03f,
+  1.76621322e-03f, 1.74027809e-03f, 1.70460739e-03f, 1.65981741e-03f, 1.60666928e-03f, 1.54604751e-03f,
+  1.47893617e-03f, 1.40639138e-03f, 1.32951490e-03f, 1.24942570e-03f, 1.16723368e-03f, 1.08401536e-03f,
+  1.00079074e-03f, 9.18504607e-04f, 8.38010747e-04f, 7.60060328e-04f, 6.85293693e-04f, 6.14236516e-04f,
+  5.47299103e-04f, 4.84779273e-04f, 4.26867948e-04f, 3.73657153e-04f, 3.25149595e-04f, 2.81269982e-04f,
+  2.41876536e-04f, 2.06773228e-04f, 1.75721580e-04f, 1.48452003e-04f, 1.24674392e-04f, 1.04087529e-04f,
+  8.63873793e-05f, 7.12741676e-05f, 5.84580303e-05f, 4.76635541e-05f, 3.86330394e-05f, 3.11287404e-05f,
+  2.49341429e-05f, 1.98544349e-05f, 1.48331816e-03f, 1.47893617e-03f, 1.46586762e-03f, 1.44434278e-03f,
+  1.41473790e-03f, 1.37756451e-03f, 1.33345416e-03f, 1.28314120e-03f, 1.22744218e-03f, 1.16723368e-03f,
+  1.10343006e-03f, 1.03696005e-03f, 9.68744920e-04f, 8.99677980e-04f, 8.30605743e-04f, 7.62312382e-04f,
+  6.95506518e-04f, 6.30811614e-04f, 5.68759104e-04f, 5.09785255e-04f, 4.54230554e-04f, 4.02342266e-04f,
+  3.54278804e-04f, 3.10116535e-04f, 2.69857730e-04f, 2.33439845e-04f, 2.00745286e-04f, 1.71611318e-04f,
+  1.45840022e-04f, 1.23207661e-04f, 1.03473438e-04f, 8.63873793e-05f, 7.16971554e-05f, 5.91539501e-05f,
+  4.85172059e-05f, 3.95583374e-05f, 3.20634681e-05f, 2.58352811e-05f, 2.06940767e-05f, 1.64781759e-05f,
+  1.22381607e-03f, 1.22020068e-03f, 1.20941841e-03f, 1.19165925e-03f, 1.16723368e-03f, 1.13656372e-03f,
+  1.10017031e-03f, 1.05865952e-03f, 1.01270480e-03f, 9.63029626e-04f, 9.10388306e-04f, 8.55546969e-04f,
+  7.99265865e-04f, 7.42281962e-04f, 6.85293693e-04f, 6.28948095e-04f, 5.73829748e-04f, 5.20452973e-04f,
+  4.69256396e-04f, 4.20599827e-04f, 3.74764262e-04f, 3.31953692e-04f, 2.92298791e-04f, 2.55862571e-04f,
+  2.22646908e-04f, 1.92600244e-04f, 1.65625490e-04f, 1.41588433e-04f, 1.20325742e-04f, 1.01652840e-04f,
+  8.53710662e-05f, 7.12741676e-05f, 5.91539501e-05f, 4.88051410e-05f, 4.00292665e-05f, 3.26377231e-05f,
+  2.64540595e-05f, 2.13154744e-05f, 1.70737094e-05f, 1.35953687e-05f, 1.00375607e-03f, 1.00079074e-03f,
+  9.91947367e-04f, 9.77381598e-04f, 9.57348093e-04f, 9.32192954e-04f, 9.02343658e-04f, 8.68297066e-04f,
+  8.30605743e-04f, 7.89862883e-04f, 7.46687176e-04f, 7.01707148e-04f, 6.55546202e-04f, 6.08808827e-04f,
+  5.62067900e-04f, 5.15854044e-04f, 4.70646773e-04f, 4.26867948e-04f, 3.84877232e-04f, 3.44969827e-04f,
+  3.07376176e-04f, 2.72263569e-04f, 2.39739195e-04f, 2.09854741e-04f, 1.82611751e-04f, 1.57967908e-04f,
+  1.35843613e-04f, 1.16128758e-04f, 9.86894156e-05f, 8.33741797e-05f, 7.00201053e-05f, 5.84580303e-05f,
+  4.85172059e-05f, 4.00292665e-05f, 3.28314200e-05f, 2.67689866e-05f, 2.16972348e-05f, 1.74826419e-05f,
+  1.40036072e-05f, 1.11507225e-05f, 8.18409084e-04f, 8.15991312e-04f, 8.08780838e-04f, 7.96904671e-04f,
+  7.80570495e-04f, 7.60060328e-04f, 7.35722831e-04f, 7.07963074e-04f, 6.77231525e-04f, 6.44012005e-04f,
+  6.08808827e-04f, 5.72134508e-04f, 5.34497376e-04f, 4.96390217e-04f, 4.58280148e-04f, 4.20599827e-04f,
+  3.83740233e-04f, 3.48045316e-04f, 3.13808356e-04f, 2.81269982e-04f, 2.50618119e-04f, 2.21989161e-04f,
+  1.95470537e-04f, 1.71104344e-04f, 1.48891864e-04f, 1.28798594e-04f, 1.10759625e-04f, 9.46851869e-05f,
+  8.04660740e-05f, 6.79788500e-05f, 5.70906523e-05f, 4.76635541e-05f, 3.95583374e-05f, 3.26377231e-05f,
+  2.67689866e-05f, 2.18260011e-05f, 1.76907652e-05f, 1.42544113e-05f, 1.14177938e-05f, 9.09170376e-06f,
+  6.63350278e-04f, 6.61390601e-04f, 6.55546202e-04f, 6.45920169e-04f, 6.32680720e-04f, 6.16056495e-04f,
+  5.96330035e-04f, 5.73829748e-04f, 5.48920711e-04f, 5.21995069e-04f, 4.93461674e-04f, 4.63735778e-04f,
+  4.33229521e-04f, 4.02342266e-04f, 3.71452683e-04f, 3.40911414e-04f, 3.11035401e-04f, 2.82103370e-04f,
+  2.54353043e-04f, 2.27979515e-04f, 2.03135089e-04f, 1.79930270e-04f, 1.58435956e-04f, 1.38686271e-04f,
+  1.20682256e-04f, 1.04395935e-04f, 8.97746941e-05f, 7.67457823e-05f, 6.52206727e-05f, 5.50993245e-05f,
+  4.62740463e-05f, 3.86330394e-05f, 3.20634681e-05f, 2.64540595e-05f, 2.16972348e-05f, 1.76907652e-05f,
+  1.43390071e-05f, 1.15537177e-05f, 9.25453605e-06f, 7.36915581e-06f, 5.34497376e-04f, 5.32918377e-04f,
+  5.28209261e-04f, 5.20452973e-04f, 5.09785255e-04f, 4.96390217e-04f, 4.80495539e-04f, 4.62365831e-04f,
+  4.42295277e-04f, 4.20599827e-04f, 3.97608877e-04f, 3.73657153e-04f, 3.49076581e-04f, 3.24189052e-04f,
+  2.99299631e-04f, 2.74690858e-04f, 2.50618119e-04f, 2.27306024e-04f, 2.04946075e-04f, 1.83695491e-04f,
+  1.63676974e-04f, 1.44979611e-04f, 1.27660474e-04f, 1.11747075e-04f, 9.72402559e-05f, 8.41174769e-05f,
+  7.23363555e-05f, 6.18382473e-05f, 5.25518444e-05f, 4.43965218e-05f, 3.72855138e-05f, 3.11287404e-05f,
+  2.58352811e-05f, 2.13154744e-05f, 1.74826419e-05f, 1.42544113e-05f, 1.15537177e-05f, 9.30945862e-06f,
+  7.45688294e-06f, 5.93772938e-06f, 4.28132742e-04f, 4.26867948e-04f, 4.23095946e-04f, 4.16883209e-04f,
+  4.08338325e-04f, 3.97608877e-04f, 3.84877232e-04f, 3.70355323e-04f, 3.54278804e-04f, 3.36900732e-04f,
+  3.18484992e-04f, 2.99299631e-04f, 2.79610569e-04f, 2.59675639e-04f, 2.39739195e-04f, 2.20027563e-04f,
+  2.00745286e-04f, 1.82072283e-04f, 1.64161946e-04f, 1.47140221e-04f, 1.31105378e-04f, 1.16128758e-04f,
+  1.02256119e-04f, 8.95094781e-05f, 7.78895119e-05f, 6.73781542e-05f, 5.79414664e-05f, 4.95324784e-05f,
+  4.20940632e-05f, 3.55616430e-05f, 2.98657233e-05f, 2.49341429e-05f, 2.06940767e-05f, 1.70737094e-05f,
+  1.40036072e-05f, 1.14177938e-05f, 9.25453605e-06f, 7.45688294e-06f, 5.97296821e-06f, 4.75612524e-06f,
+  3.40911414e-04f, 3.39904305e-04f, 3.36900732e-04f, 3.31953692e-04f, 3.25149595e-04f, 3.16606020e-04f,
+  3.06468137e-04f, 2.94904690e-04f, 2.82103370e-04f, 2.68265634e-04f, 2.53601640e-04f, 2.38324807e-04f,
+  2.22646908e-04f, 2.06773228e-04f, 1.90898339e-04f, 1.75202455e-04f, 1.59848452e-04f, 1.44979611e-04f,
+  1.30718065e-04f, 1.17164076e-04f, 1.04395935e-04f, 9.24704291e-05f, 8.14239975e-05f, 7.12741676e-05f,
+  6.20214705e-05f, 5.36515436e-05f, 4.61373420e-05f, 3.94414747e-05f, 3.35184486e-05f, 2.83168483e-05f,
+  2.37813292e-05f, 1.98544349e-05f, 1.64781759e-05f, 1.35953687e-05f, 1.11507225e-05f, 9.09170376e-06f,
+  7.36915581e-06f, 5.93772938e-06f, 4.75612524e-06f, 3.78718369e-06f
+};
+static const float kern_row_13[] = {
+  3.41721985e-04f, 4.29150707e-04f, 5.35768224e-04f, 6.64927473e-04f, 8.20354966e-04f, 1.00614259e-03f,
+  1.22672587e-03f, 1.48684497e-03f, 1.79148861e-03f, 2.14581680e-03f, 2.55506206e-03f, 3.02440859e-03f,
+  3.55884992e-03f, 4.16302588e-03f, 4.84104082e-03f, 5.59626939e-03f, 6.43115025e-03f, 7.34698121e-03f,
+  8.34371429e-03f, 9.41976625e-03f, 1.05718505e-02f, 1.17948418e-02f, 1.30816782e-02f, 1.44233117e-02f,
+  1.58087201e-02f, 1.72249787e-02f, 1.86573882e-02f, 2.00896896e-02f, 2.15043239e-02f, 2.28827689e-02f,
+  2.42059194e-02f, 2.54545137e-02f, 2.66095921e-02f, 2.76529752e-02f, 2.85677277e-02f, 2.93386262e-02f,
+  2.99525652e-02f, 3.03989444e-02f, 3.06699574e-02f, 3.07608321e-02f, 3.06699574e-02f, 3.03989444e-02f,
+  2.99525652e-02f, 2.93386262e-02f, 2.85677277e-02f, 2.76529752e-02f, 2.66095921e-02f, 2.54545137e-02f,
+  2.42059194e-02f, 2.28827689e-02f, 2.15043239e-02f, 2.00896896e-02f, 1.86573882e-02f, 1.72249787e-02f,
+  1.58087201e-02f, 1.44233117e-02f, 1.30816782e-02f, 1.17948418e-02f, 1.05718505e-02f, 9.41976625e-03f,
+  8.34371429e-03f, 7.34698121e-03f, 6.43115025e-03f, 5.59626939e-03f, 4.84104082e-03f, 4.16302588e-03f,
+  3.55884992e-03f, 3.02440859e-03f, 2.55506206e-03f, 2.14581680e-03f, 1.79148861e-03f, 1.48684497e-03f,
+  1.22672587e-03f, 1.00614259e-03f, 8.20354966e-04f, 6.64927473e-04f, 5.35768224e-04f, 4.29150707e-04f,
+  3.41721985e-04f
+};
+static const int kern_half_fixed_13[] = {
+  15875, 15828, 15688, 15458, 15141, 14743, 14271, 13733, 13137, 12492, 11809, 11098,
+  10368, 9629, 8889, 8159, 7444, 6751, 6087, 5456, 4861, 4306, 3792, 3319,
+  2888, 2498, 2148, 1837, 1561, 1319, 1107, 925, 767, 633, 519, 423,
+  343, 277, 221, 176, 15828, 15781, 15642, 15412, 15096, 14700, 14229, 13692,
+  13098, 12455, 11774, 11065, 10337, 9600, 8863, 8134, 7422, 6731, 6069, 5440,
+  4847, 4293, 3780, 3309, 2880, 2491, 2142, 1831, 1556, 1315, 1104, 922,
+  765, 631, 518, 422, 342, 276, 221, 176, 15688, 15642, 15504, 15276,
+  14963, 14570, 14103, 13571, 12982, 12345, 11670, 10967, 10246, 9515, 8785, 8063,
+  7356, 6672, 6015, 5392, 4804, 4255, 3747, 3280, 2854, 2469, 2123, 1815,
+  1542, 1303, 1094, 914, 758, 626, 513, 418, 339, 273, 219, 174,
+  15458, 15412, 15276, 15052, 14743, 14356, 13896, 13372, 12791, 12164, 11499, 10806,
+  10095, 9376, 8656, 7944, 7248, 6574, 5927, 5313, 4734, 4193, 3692, 3232,
+  2812, 2433, 2092, 1788, 1520, 1284, 1078, 900, 747, 616, 506, 412,
+  334, 269, 216, 172, 15141, 15096, 14963, 14743, 14441, 14062, 13611, 13098,
+  12529, 11915, 11263, 10585, 9889, 9184, 8478, 7781, 7099, 6439, 5806, 5204,
+  4637, 4107, 3616, 3166, 2755, 2383, 2049, 1752, 1489, 1258, 1056, 882,
+  732, 604, 495, 404, 327, 264, 211, 168, 14743, 14700, 14570, 14356,
+  14062, 13692, 13254, 12754, 12200, 11602, 10967, 10307, 9629, 8942, 8256, 7577,
+  6913, 6270, 5653, 5067, 4515, 3999, 3521, 3082, 2682, 2320, 1995, 1706,
+  1450, 1225, 1028, 859, 713, 588, 482, 393, 319, 257, 206, 164,
+  14271, 14229, 14103, 13896, 13611, 13254, 12829, 12345, 11809, 11230, 10616, 9977,
+  9320, 8656, 7991, 7334, 6692, 6069, 5472, 4905, 4370, 3871, 3409, 2984,
+  2596, 2246, 1931, 1651, 1403, 1185, 996, 831, 690, 569, 467, 381,
+  308, 249, 199, 159, 13733, 13692, 13571, 13372, 13098, 12754, 12345, 11879,
+  11364, 10806, 10216, 9600, 8969, 8329, 7690, 7058, 6439, 5840, 5266, 4720,
+  4205, 3725, 3280, 2871, 2498, 2161, 1859, 1589, 1350, 1141, 958, 800,
+  664, 548, 449, 366, 297, 239, 192, 153, 13137, 13098, 12982, 12791,
+  12529, 12200, 11809, 11364, 10871, 10337, 9772, 9184, 8579, 7968, 7356, 6751,
+  6160, 5587, 5037, 4515, 4023, 3563, 3138, 2746, 2390, 2067, 1778, 1520,
+  1292, 1091, 916, 765, 635, 524, 430, 350, 284, 229, 183, 146,
+  12492, 12455, 12345, 12164, 11915, 11602, 11230, 10806, 10337, 9830, 9293, 8733,
+  8159, 7577, 6995, 6420, 5857, 5313, 4790, 4293, 3825, 3388, 2984, 2612,
+  2273, 1966, 1691, 1445, 1228, 1038, 871, 728, 604, 498, 409, 333,
+  270, 218, 174, 139, 11809, 11774, 11670, 11499, 11263, 10967, 10616, 10216,
+  9772, 9293, 8785, 8256, 7713, 7163, 6613, 6069, 5537, 5022, 4528, 4059,
+  3616, 3203, 2821, 2469, 2148, 1859, 1598, 1366, 1161, 981, 824, 688,
+  571, 471, 386, 315, 255, 206, 165, 131, 11098, 11065, 10967, 10806,
+  10585, 10307, 9977, 9600, 9184, 8733, 8256, 7758, 7248, 6731, 6214, 5704,
+  5204, 4720, 4255, 3814, 3398, 3010, 2651, 2320, 2019, 1747, 1502, 1284,
+  1091, 922, 774, 646, 536, 443, 363, 296, 240, 193, 155, 123,
+  10368, 10337, 10246, 10095, 9889, 9629, 9320, 8969, 8579, 8159, 7713, 7248,
+  6771, 6288, 5806, 5328, 4861, 4409, 3975, 3563, 3175, 2812, 2476, 2168,
+  1886, 1632, 1403, 1200, 1019, 861, 723, 604, 501, 413, 339, 277,
+  224, 181, 145, 115, 9629, 9600, 9515, 9376, 9184, 8942, 8656, 8329,
+  7968, 7577, 7163, 6731, 6288, 5840, 5392, 4948, 4515, 4095, 3692, 3309,
+  2949, 2612, 2300, 2013, 1752, 1515, 1303, 1114, 947, 800, 672, 561,
+  465, 384, 315, 257, 208, 168, 134, 107, 8889, 8863, 8785, 8656,
+  8478, 8256, 7991, 7690, 7356, 6995, 6613, 6214, 5806, 5392, 4978, 4569,
+  4168, 3780, 3409, 3055, 2722, 2411, 2123, 1859, 1617, 1399, 1203, 1028,
+  874, 738, 620, 518, 430, 355, 291, 237, 192, 155, 124, 99,
+  8159, 8134, 8063, 7944, 7781, 7577, 7334, 7058, 6751, 6420, 6069, 5704,
+  5328, 4948, 4569, 4193, 3825, 3470, 3128, 2804, 2498, 2213, 1949, 1706,
+  1484, 1284, 1104, 944, 802, 678, 569, 475, 394, 325, 267, 218,
+  176, 142, 114, 91, 7444, 7422, 7356, 7248, 7099, 6913, 6692, 6439,
+  6160, 5857, 5537, 5204, 4861, 4515, 4168, 3825, 3490, 3166, 2854, 2558,
+  2279, 2019, 1778, 1556, 1354, 1171, 1007, 861, 732, 618, 519, 434,
+  360, 297, 243, 199, 161, 130, 104, 83, 6751, 6731, 6672, 6574,
+  6439, 6270, 6069, 5840, 5587, 5313, 5022, 4720, 4409, 4095, 3780, 3470,
+  3166, 2871, 2589, 2320, 2067, 1831, 1612, 1411, 1228, 1062, 914, 781,
+  664, 561, 471, 393, 326, 269, 221, 180, 146, 118, 94, 75,
+  6087, 6069, 6015, 5927, 5806, 5653, 5472, 5266, 5037, 4790, 4528, 4255,
+  3975, 3692, 3409, 3128, 2854, 2589, 2334, 2092, 1864, 1651, 1454, 1273,
+  1107, 958, 824, 704, 598, 506, 425, 355, 294, 243, 199, 162,
+  132, 106, 85, 68, 5456, 5440, 5392, 5313, 5204, 5067, 4905, 4720,
+  4515, 4293, 4059, 3814, 3563, 3309, 3055, 2804, 2558, 2320, 2092, 1875,
+  1671, 1480, 1303, 1141, 993, 859, 738, 631, 536, 453, 381, 318,
+  264, 218, 178, 146, 118, 95, 76, 61, 4861, 4847, 4804, 4734,
+  4637, 4515, 4370, 4205, 4023, 3825, 3616, 3398, 3175, 2949, 2722, 2498,
+  2279, 2067, 1864, 1671, 1489, 1319, 1161, 1016, 884, 765, 658, 562,
+  478, 404, 339, 283, 235, 194, 159, 130, 105, 85, 68, 54,
+  4306, 4293, 4255, 4193, 4107, 3999, 3871, 3725, 3563, 3388, 3203, 3010,
+  2812, 2612, 2411, 2213, 2019, 1831, 1651, 1480, 1319, 1168, 1028, 900,
+  783, 678, 583, 498, 423, 358, 300, 251, 208, 172, 141, 115,
+  93, 75, 60, 48, 3792, 3780, 3747, 3692, 3616, 3521, 3409, 3280,
+  3138, 2984, 2821, 2651, 2476, 2300, 2123, 1949, 1778, 1612, 1454, 1303,
+  1161, 1028, 906, 793, 690, 597, 513, 439, 373, 315, 264, 221,
+  183, 151, 124, 101, 82, 66, 53, 42, 3319, 3309, 3280, 3232,
+  3166, 3082, 2984, 2871, 2746, 2612, 2469, 2320, 2168, 2013, 1859, 1706,
+  1556, 1411, 1273, 1141, 1016, 900, 793, 694, 604, 522, 449, 384,
+  326, 276, 232, 193, 160, 132, 109, 89, 72, 58, 46, 37,
+  2888, 2880, 2854, 2812, 2755, 2682, 2596, 2498, 2390, 2273, 2148, 2019,
+  1886, 1752, 1617, 1484, 1354, 1228, 1107, 993, 884, 783, 690, 604,
+  525, 455, 391, 334, 284, 240, 201, 168, 140, 115, 94, 77,
+  62, 50, 40, 32, 2498, 2491, 2469, 2433, 2383, 2320, 2246, 2161,
+  2067, 1966, 1859, 1747, 1632, 1515, 1399, 1284, 1171, 1062, 958, 859,
+  765, 678, 597, 522, 455, 393, 338, 289, 246, 208, 174, 146,
+  121, 100, 82, 67, 54, 44, 35, 28, 2148, 2142, 2123, 2092,
+  2049, 1995, 1931, 1859, 1778, 1691, 1598, 1502, 1403, 1303, 1203, 1104,
+  1007, 914, 824, 738, 658, 583, 513, 449, 391, 338, 291, 249,
+  211, 178, 150, 125, 104, 86, 70, 57, 46, 37, 30, 24,
+  1837, 1831, 1815, 1788, 1752, 1706, 1651, 1589, 1520, 1445, 1366, 1284,
+  1200, 1114, 1028, 944, 861, 781, 704, 631, 562, 498, 439, 384,
+  334, 289, 249, 212, 181, 153, 128, 107, 89, 73, 60, 49,
+  40, 32, 26, 20, 1561, 1556, 1542, 1520, 1489, 1450, 1403, 1350,
+  1292, 1228, 1161, 1091, 1019, 947, 874, 802, 732, 664, 598, 536,
+  478, 423, 373, 326, 284, 246, 211, 181, 153, 130, 109, 91,
+  75, 62, 51, 42, 34, 27, 22, 17, 1319, 1315, 1303, 1284,
+  1258, 1225, 1185, 1141, 1091, 1038, 981, 922, 861, 800, 738, 678,
+  618, 561, 506, 453, 404, 358, 315, 276, 240, 208, 178, 153,
+  130, 110, 92, 77, 64, 53, 43, 35, 29, 23, 18, 15,
+  1107, 1104, 1094, 1078, 1056, 1028, 996, 958, 916, 871, 824, 774,
+  723, 672, 620, 569, 519, 471, 425, 381, 339, 300, 264, 232,
+  201, 174, 150, 128, 109, 92, 77, 64, 54, 44, 36, 30,
+  24, 19, 15, 12, 925, 922, 914, 900, 882, 859, 831, 800,
+  765, 728, 688, 646, 604, 561, 518, 475, 434, 393, 355, 318,
+  283, 251, 221, 193, 168, 146, 125, 107, 91, 77, 64, 54,
+  45, 37, 30, 25, 20, 16, 13, 10, 767, 765, 758, 747,
+  732, 713, 690, 664, 635, 604, 571, 536, 501, 465, 430, 394,
+  360, 326, 294, 264, 235, 208, 183, 160, 140, 121, 104, 89,
+  75, 64, 54, 45, 37, 31, 25, 20, 17, 13, 11, 9,
+  633, 631, 626, 616, 604, 588, 569, 548, 524, 498, 471, 443,
+  413, 384, 355, 325, 297, 269, 243, 218, 194, 172, 151, 132,
+  115, 100, 86, 73, 62, 53, 44, 37, 31, 25, 21, 17,
+  14, 11, 9, 7, 519, 518, 513, 506, 495, 482, 467, 449,
+  430, 409, 386, 363, 339, 315, 291, 267, 243, 221, 199, 178,
+  159, 141, 124, 109, 94, 82, 70, 60, 51, 43, 36, 30,
+  25, 21, 17, 14, 11, 9, 7, 6, 423, 422, 418, 412,
+  404, 393, 381, 366, 350, 333, 315, 296, 277, 257, 237, 218,
+  199, 180, 162, 146, 130, 115, 101, 89, 77, 67, 57, 49,
+  42, 35, 30, 25, 20, 17, 14, 11, 9, 7, 6, 5,
+  343, 342, 339, 334, 327, 319, 308, 297, 284, 270, 255, 240,
+  224, 208, 192, 176, 161, 146, 132, 118, 105, 93, 82, 72,
+  62, 54, 46, 40, 34, 29, 24, 20, 17, 14, 11, 9,
+  7, 6, 5, 4, 277, 276, 273, 269, 264, 257, 249, 239,
+  229, 218, 206, 193, 181, 168, 155, 142, 130, 118, 106, 95,
+  85, 75, 66, 58, 50, 44, 37, 32, 27, 23, 19, 16,
+  13, 11, 9, 7, 6, 5, 4, 3, 221, 221, 219, 216,
+  211, 206, 199, 192, 183, 174, 165, 155, 145, 134, 124, 114,
+  104, 94, 85, 76, 68, 60, 53, 46, 40, 35, 30, 26,
+  22, 18, 15, 13, 11, 9, 7, 6, 5, 4, 3, 2,
+  176, 176, 174, 172, 168, 164, 159, 153, 146, 139, 131, 123,
+  115, 107, 99, 91, 83, 75, 68, 61, 54, 48, 42, 37,
+  32, 28, 24, 20, 17, 15, 12, 10, 9, 7, 6, 5,
+  4, 3, 2, 2
+};
+static const int kern_row_fixed_13[] = {
+  5733, 7200, 8989, 11156, 13763, 16880, 20581, 24945, 30056, 36001, 42867, 50741,
+  59708, 69844, 81219, 93890, 107897, 123262, 139984, 158037, 177366, 197885, 219474, 241983,
+  265226, 288987, 313019, 337049, 360783, 383909, 406108, 427056, 446435, 463940, 479287, 492220,
+  502521, 510010, 514557, 516081, 514557, 510010, 502521, 492220, 479287, 463940, 446435, 427056,
+  406108, 383909, 360783, 337049, 313019, 288987, 265226, 241983, 219474, 197885, 177366, 158037,
+  139984, 123262, 107897, 93890, 81219, 69844, 59708, 50741, 42867, 36001, 30056, 24945,
+  20581, 16880, 13763, 11156, 8989, 7200, 5733
+};
+
+static const float kern_half_14[] = {
+  2.84958780e-02f, 2.84232758e-02f, 2.82065812e-02f, 2.78490875e-02f, 2.73561981e-02f, 2.67352760e-02f,
+  2.59954799e-02f, 2.51475237e-02f, 2.42034234e-02f, 2.31762193e-02f, 2.20796727e-02f, 2.09279582e-02f,
+  1.97353698e-02f, 1.85160320e-02f, 1.72836240e-02f, 1.60511397e-02f, 1.48306824e-02f, 1.36332894e-02f,
+  1.24687906e-02f, 1.13457255e-02f, 1.02712763e-02f, 9.25125647e-03f, 8.29012878e-03f, 7.39104860e-03f,
+  6.55594096e-03f, 5.78559749e-03f, 5.07978862e-03f, 4.43738652e-03f, 3.85649758e-03f, 3.33459512e-03f,
+  2.86864862e-03f, 2.45525059e-03f, 2.09073257e-03f, 1.77127251e-03f, 1.49298855e-03f, 1.25202141e-03f,
+  1.04460306e-03f, 8.67111667e-04f, 7.16115348e-04f, 5.88403316e-04f, 4.81007097e-04f, 3.91211914e-04f,
+  3.16560589e-04f, 2.84232758e-02f, 2.83508599e-02f, 2.81347167e-02f, 2.77781356e-02f, 2.72864997e-02f,
+  2.66671609e-02f, 2.59292498e-02f, 2.50834525e-02f, 2.41417587e-02f, 2.31171735e-02f, 2.20234189e-02f,
+  2.08746381e-02f, 1.96850896e-02f, 1.84688568e-02f, 1.72395892e-02f, 1.60102453e-02f, 1.47928977e-02f,
+  1.35985548e-02f, 1.24370232e-02f, 1.13168191e-02f, 1.02451071e-02f, 9.22768656e-03f, 8.26900732e-03f,
+  7.37221772e-03f, 6.53923815e-03f, 5.77085745e-03f, 5.06684650e-03f, 4.42608073e-03f, 3.84667213e-03f,
+  3.32609937e-03f, 2.86133983e-03f, 2.44899513e-03f, 2.08540587e-03f, 1.76675967e-03f, 1.48918468e-03f,
+  1.24883163e-03f, 1.04194169e-03f, 8.64902453e-04f, 7.14290829e-04f, 5.86904236e-04f, 4.79781622e-04f,
+  3.90215195e-04f, 3.15754063e-04f, 2.82065812e-02f, 2.81347167e-02f, 2.79202219e-02f, 2.75663584e-02f,
+  2.70784721e-02f, 2.64638551e-02f, 2.57315692e-02f, 2.48922203e-02f, 2.39577070e-02f, 2.29409300e-02f,
+  2.18555145e-02f, 2.07154937e-02f, 1.95350125e-02f, 1.83280539e-02f, 1.71081573e-02f, 1.58881843e-02f,
+  1.46801183e-02f, 1.34948809e-02f, 1.23422053e-02f, 1.12305414e-02f, 1.01669999e-02f, 9.15733632e-03f,
+  8.20596609e-03f, 7.31601333e-03f, 6.48938399e-03f, 5.72686130e-03f, 5.02821757e-03f, 4.39233705e-03f,
+  3.81734571e-03f, 3.30074155e-03f, 2.83952546e-03f, 2.43032444e-03f, 2.06950703e-03f, 1.75329018e-03f,
+  1.47783139e-03f, 1.23931072e-03f, 1.03399809e-03f, 8.58308573e-04f, 7.08845211e-04f, 5.82429755e-04f,
+  4.76123823e-04f, 3.87240259e-04f, 3.13346827e-04f, 2.78490875e-02f, 2.77781356e-02f, 2.75663584e-02f,
+  2.72169802e-02f, 2.67352760e-02f, 2.61284485e-02f, 2.54054442e-02f, 2.45767348e-02f, 2.36540642e-02f,
+  2.26501748e-02f, 2.15785168e-02f, 2.04529427e-02f, 1.92874242e-02f, 1.80957615e-02f, 1.68913268e-02f,
+  1.56868156e-02f, 1.44940615e-02f, 1.33238453e-02f, 1.21857794e-02f, 1.10882046e-02f, 1.00381421e-02f,
+  9.04127490e-03f, 8.10196251e-03f, 7.22328946e-03f, 6.40713656e-03f, 5.65427821e-03f, 4.96448949e-03f,
+  4.33666818e-03f, 3.76896420e-03f, 3.25890770e-03f, 2.80353706e-03f, 2.39952211e-03f, 2.04327796e-03f,
+  1.73106883e-03f, 1.45910122e-03f, 1.22360350e-03f, 1.02089311e-03f, 8.47430259e-04f, 6.99861208e-04f,
+  5.75047976e-04f, 4.70089377e-04f, 3.82332335e-04f, 3.09375435e-04f, 2.73561981e-02f, 2.72864997e-02f,
+  2.70784721e-02f, 2.67352760e-02f, 2.62620989e-02f, 2.56660115e-02f, 2.49558017e-02f, 2.41417587e-02f,
+  2.32354179e-02f, 2.22492982e-02f, 2.11966056e-02f, 2.00909525e-02f, 1.89460628e-02f, 1.77754909e-02f,
+  1.65923722e-02f, 1.54091809e-02f, 1.42375361e-02f, 1.30880317e-02f, 1.19701074e-02f, 1.08919581e-02f,
+  9.86048114e-03f, 8.88125692e-03f, 7.95856863e-03f, 7.09544681e-03f, 6.29373919e-03f, 5.55420527e-03f,
+  4.87662479e-03f, 4.25991509e-03f, 3.70225869e-03f, 3.20122950e-03f, 2.75391829e-03f, 2.35705380e-03f,
+  2.00711470e-03f, 1.70043122e-03f, 1.43327715e-03f, 1.20194745e-03f, 1.00282463e-03f, 8.32431891e-04f,
+  6.87474618e-04f, 5.64870425e-04f, 4.61769436e-04f, 3.75565578e-04f, 3.03899898e-04f, 2.67352760e-02f,
+  2.66671609e-02f, 2.64638551e-02f, 2.61284485e-02f, 2.56660115e-02f, 2.50834525e-02f, 2.43893657e-02f,
+  2.35937983e-02f, 2.27080304e-02f, 2.17442904e-02f, 2.07154937e-02f, 1.96349360e-02f, 1.85160320e-02f,
+  1.73720308e-02f, 1.62157640e-02f, 1.50594292e-02f, 1.39143774e-02f, 1.27909640e-02f, 1.16984146e-02f,
+  1.06447367e-02f, 9.63667128e-03f, 8.67967308e-03f, 7.77792837e-03f, 6.93439692e-03f, 6.15088595e-03f,
+  5.42813772e-03f, 4.76593664e-03f, 4.16322518e-03f, 3.61822615e-03f, 3.12856911e-03f, 2.69141095e-03f,
+  2.30355444e-03f, 1.96155789e-03f, 1.66183547e-03f, 1.40074512e-03f, 1.17466610e-03f, 9.80062876e-04f,
+  8.13537685e-04f, 6.71870541e-04f, 5.52049198e-04f, 4.51288361e-04f, 3.67041124e-04f, 2.97002087e-04f,
+  2.59954799e-02f, 2.59292498e-02f, 2.57315692e-02f, 2.54054442e-02f, 2.49558017e-02f, 2.43893657e-02f,
+  2.37144828e-02f, 2.29409300e-02f, 2.20796727e-02f, 2.11426020e-02f, 2.01422703e-02f, 1.90916155e-02f,
+  1.80036724e-02f, 1.68913268e-02f, 1.57670565e-02f, 1.46427173e-02f, 1.35293510e-02f, 1.24370232e-02f,
+  1.13747055e-02f, 1.03501845e-02f, 9.37001314e-03f, 8.43949709e-03f, 7.56270392e-03f, 6.74251420e-03f,
+  5.98068396e-03f, 5.27793495e-03f, 4.63405764e-03f, 4.04802384e-03f, 3.51810572e-03f, 3.04199802e-03f,
+  2.61693634e-03f, 2.23981240e-03f, 1.90727937e-03f, 1.61585049e-03f, 1.36198488e-03f, 1.14216167e-03f,
+  9.52943403e-04f, 7.91026163e-04f, 6.53279130e-04f, 5.36773354e-04f, 4.38800693e-04f, 3.56884673e-04f,
+  2.88783689e-04f, 2.51475237e-02f, 2.50834525e-02f, 2.48922203e-02f, 2.45767348e-02f, 2.41417587e-02f,
+  2.35937983e-02f, 2.29409300e-02f, 2.21926123e-02f, 2.13594474e-02f, 2.04529427e-02f, 1.94852427e-02f,
+  1.84688568e-02f, 1.74164027e-02f, 1.63403414e-02f, 1.52527438e-02f, 1.41650802e-02f, 1.30880317e-02f,
+  1.20313354e-02f, 1.10036694e-02f, 1.00125670e-02f, 9.06436890e-03f, 8.16420559e-03f, 7.31601333e-03f,
+  6.52257772e-03f, 5.78559749e-03f, 5.10577206e-03f, 4.48289746e-03f, 3.91597953e-03f, 3.40334722e-03f,
+  2.94276979e-03f, 2.53157341e-03f, 2.16675107e-03f, 1.84506504e-03f, 1.56314240e-03f, 1.31755776e-03f,
+  1.10490504e-03f, 9.21858940e-04f, 7.65223347e-04f, 6.31969539e-04f, 5.19264140e-04f, 4.24487283e-04f,
+  3.45243287e-04f, 2.79363740e-04f, 2.42034234e-02f, 2.41417587e-02f, 2.39577070e-02f, 2.36540642e-02f,
+  2.32354179e-02f, 2.27080304e-02f, 2.20796727e-02f, 2.13594474e-02f, 2.05575619e-02f, 1.96850896e-02f,
+  1.87537186e-02f, 1.77754909e-02f, 1.67625491e-02f, 1.57268848e-02f, 1.46801183e-02f, 1.36332894e-02f,
+  1.25966752e-02f, 1.15796495e-02f, 1.05905645e-02f, 9.63667128e-03f, 8.72407109e-03f, 7.85770174e-03f,
+  7.04135234e-03f, 6.27770415e-03f, 5.56839211e-03f, 4.91408864e-03f, 4.31459863e-03f, 3.76896420e-03f,
+  3.27557721e-03f, 2.83229095e-03f, 2.43653217e-03f, 2.08540587e-03f, 1.77579676e-03f, 1.50445825e-03f,
+  1.26809336e-03f, 1.06342428e-03f, 8.87250120e-04f, 7.36495014e-04f, 6.08243863e-04f, 4.99769696e-04f,
+  4.08550986e-04f, 3.32282012e-04f, 2.68875767e-04f, 2.31762193e-02f, 2.31171735e-02f, 2.29409300e-02f,
+  2.26501748e-02f, 2.22492982e-02f, 2.17442904e-02f, 2.11426020e-02f, 2.04529427e-02f, 1.96850896e-02f,
+  1.88496448e-02f, 1.79578029e-02f, 1.70210917e-02f, 1.60511397e-02f, 1.50594292e-02f, 1.40570877e-02f,
+  1.30546866e-02f, 1.20620662e-02f, 1.10882046e-02f, 1.01410970e-02f, 9.22768656e-03f, 8.35381728e-03f,
+  7.52421701e-03f, 6.74251420e-03f, 6.01127557e-03f, 5.33206714e-03f, 4.70553292e-03f, 4.13148524e-03f,
+  3.60900769e-03f, 3.13656032e-03f, 2.71208747e-03f, 2.33312463e-03f, 1.99690042e-03f, 1.70043122e-03f,
+  1.44060841e-03f, 1.21427502e-03f, 1.01829204e-03f, 8.49594828e-04f, 7.05237850e-04f, 5.82429755e-04f,
+  4.78559232e-04f, 3.91211914e-04f, 3.18179838e-04f, 2.57464562e-04f, 2.20796727e-02f, 2.20234189e-02f,
+  2.18555145e-02f, 2.15785168e-02f, 2.11966056e-02f, 2.07154937e-02f, 2.01422703e-02f, 1.94852427e-02f,
+  1.87537186e-02f, 1.79578029e-02f, 1.71081573e-02f, 1.62157640e-02f, 1.52917039e-02f, 1.43469153e-02f,
+  1.33919986e-02f, 1.24370232e-02f, 1.14913685e-02f, 1.05635822e-02f, 9.66128614e-03f, 8.79109278e-03f,
+  7.95856863e-03f, 7.16821989e-03f, 6.42350223e-03f, 5.72686130e-03f, 5.07978862e-03f, 4.48289746e-03f,
+  3.93601041e-03f, 3.43825296e-03f, 2.98815873e-03f, 2.58376915e-03f, 2.22273637e-03f, 1.90241996e-03f,
+  1.61997788e-03f, 1.37244817e-03f, 1.15682336e-03f, 9.70113091e-04f, 8.09397548e-04f, 6.71870541e-04f,
+  5.54872968e-04f, 4.55916917e-04f, 3.72702314e-04f, 3.03125620e-04f, 2.45283009e-04f, 2.09279582e-02f,
+  2.08746381e-02f, 2.07154937e-02f, 2.04529427e-02f, 2.00909525e-02f, 1.96349360e-02f, 1.90916155e-02f,
+  1.84688568e-02f, 1.77754909e-02f, 1.70210917e-02f, 1.62157640e-02f, 1.53699219e-02f, 1.44940615e-02f,
+  1.35985548e-02f, 1.26934480e-02f, 1.17882863e-02f, 1.08919581e-02f, 1.00125670e-02f, 9.15733632e-03f,
+  8.33253376e-03f, 7.54343579e-03f, 6.79431297e-03f, 6.08844124e-03f, 5.42813772e-03f, 4.81481757e-03f,
+  4.24906192e-03f, 3.73070105e-03f, 3.25890770e-03f, 2.83229095e-03f, 2.44899513e-03f, 2.10679439e-03f,
+  1.80318637e-03f, 1.53547700e-03f, 1.30085892e-03f, 1.09648146e-03f, 9.19510261e-04f, 7.67177960e-04f,
+  6.36824640e-04f, 5.25929790e-04f, 4.32135508e-04f, 3.53261508e-04f, 2.87314062e-04f, 2.32488601e-04f,
+  1.97353698e-02f, 1.96850896e-02f, 1.95350125e-02f, 1.92874242e-02f, 1.89460628e-02f, 1.85160320e-02f,
+  1.80036724e-02f, 1.74164027e-02f, 1.67625491e-02f, 1.60511397e-02f, 1.52917039e-02f, 1.44940615e-02f,
+  1.36681125e-02f, 1.28236357e-02f, 1.19701074e-02f, 1.11165270e-02f, 1.02712763e-02f, 9.44199786e-03f,
+  8.63550231e-03f, 7.85770174e-03f, 7.11357081e-03f, 6.40713656e-03f, 5.74148912e-03f, 5.11881337e-03f,
+  4.54044342e-03f, 4.00692737e-03f, 3.51810572e-03f, 3.07319756e-03f, 2.67089205e-03f, 2.30943831e-03f,
+  1.98673806e-03f, 1.70043122e-03f, 1.44797727e-03f, 1.22672901e-03f, 1.03399809e-03f, 8.67111667e-04f,
+  7.23460049e-04f, 6.00534957e-04f, 4.95959481e-04f, 4.07510088e-04f, 3.33130767e-04f, 2.70941382e-04f,
+  2.19240159e-04f, 1.85160320e-02f, 1.84688568e-02f, 1.83280539e-02f, 1.80957615e-02f, 1.77754909e-02f,
+  1.73720308e-02f, 1.68913268e-02f, 1.63403414e-02f, 1.57268848e-02f, 1.50594292e-02f, 1.43469153e-02f,
+  1.35985548e-02f, 1.28236357e-02f, 1.20313354e-02f, 1.12305414e-02f, 1.04296990e-02f, 9.63667128e-03f,
+  8.85862950e-03f, 8.10196251e-03f, 7.37221772e-03f, 6.67406293e-03f, 6.01127557e-03f, 5.38675440e-03f,
+  4.80255065e-03f, 4.25991509e-03f, 3.75936180e-03f, 3.30074155e-03f, 2.88332207e-03f, 2.50587240e-03f,
+  2.16675107e-03f, 1.86398858e-03f, 1.59537105e-03f, 1.35851488e-03f, 1.15093624e-03f, 9.70113091e-04f,
+  8.13537685e-04f, 6.78761513e-04f, 5.63431240e-04f, 4.65316960e-04f, 3.82332335e-04f, 3.12548480e-04f,
+  2.54201412e-04f, 2.05694538e-04f, 1.72836240e-02f, 1.72395892e-02f, 1.71081573e-02f, 1.68913268e-02f,
+  1.65923722e-02f, 1.62157640e-02f, 1.57670565e-02f, 1.52527438e-02f, 1.46801183e-02f, 1.40570877e-02f,
+  1.33919986e-02f, 1.26934480e-02f, 1.19701074e-02f, 1.12305414e-02f, 1.04830470e-02f, 9.73550789e-03f,
+  8.99526384e-03f, 8.26900732e-03f, 7.56270392e-03f, 6.88153040e-03f, 6.22984394e-03f, 5.61117101e-03f,
+  5.02821757e-03f, 4.48289746e-03f, 3.97637906e-03f, 3.50914244e-03f, 3.08104744e-03f, 2.69141095e-03f,
+  2.33908393e-03f, 2.02253414e-03f, 1.73992338e-03f, 1.48918468e-03f, 1.26809336e-03f, 1.07433100e-03f,
+  9.05543333e-04f, 7.59389426e-04f, 6.33583812e-04f, 5.25929790e-04f, 4.34345915e-04f, 3.56884673e-04f,
+  2.91745557e-04f, 2.37282016e-04f, 1.92003703e-04f, 1.60511397e-02f, 1.60102453e-02f, 1.58881843e-02f,
+  1.56868156e-02f, 1.54091809e-02f, 1.50594292e-02f, 1.46427173e-02f, 1.41650802e-02f, 1.36332894e-02f,
+  1.30546866e-02f, 1.24370232e-02f, 1.17882863e-02f, 1.11165270e-02f, 1.04296990e-02f, 9.73550789e-03f,
+  9.04127490e-03f, 8.35381728e-03f, 7.67935021e-03f, 7.02341273e-03f, 6.39081281e-03f, 5.78559749e-03f,
+  5.21104177e-03f, 4.66965837e-03f, 4.16322518e-03f, 3.69282626e-03f, 3.25890770e-03f, 2.86133983e-03f,
+  2.49948818e-03f, 2.17228546e-03f, 1.87830860e-03f, 1.61585049e-03f, 1.38299190e-03f, 1.17766648e-03f,
+  9.97721218e-04f, 8.40969617e-04f, 7.05237850e-04f, 5.88403316e-04f, 4.88426071e-04f, 4.03372978e-04f,
+  3.31435440e-04f, 2.70941382e-04f, 2.20361588e-04f, 1.78312053e-04f, 1.48306824e-02f, 1.47928977e-02f,
+  1.46801183e-02f, 1.44940615e-02f, 1.42375361e-02f, 1.39143774e-02f, 1.35293510e-02f, 1.30880317e-02f,
+  1.25966752e-02f, 1.20620662e-02f, 1.14913685e-02f, 1.08919581e-02f, 1.02712763e-02f, 9.63667128e-03f,
+  8.99526384e-03f, 8.35381728e-03f, 7.71863060e-03f, 7.09544681e-03f, 6.48938399e-03f, 5.90488408e-03f,
+  5.34568680e-03f, 4.81481757e-03f, 4.31459863e-03f, 3.84667213e-03f, 3.41204018e-03f, 3.01111490e-03f,
+  2.64377659e-03f, 2.30943831e-03f, 2.00711470e-03f, 1.73549040e-03f, 1.49298855e-03f, 1.27783546e-03f,
+  1.08812202e-03f, 9.21858940e-04f, 7.77026056e-04f, 6.51614740e-04f, 5.43663802e-04f, 4.51288361e-04f,
+  3.72702314e-04f, 3.06234579e-04f, 2.50340207e-04f, 2.03606294e-04f, 1.64754005e-04f, 1.36332894e-02f,
+  1.35985548e-02f, 1.34948809e-02f, 1.33238453e-02f, 1.30880317e-02f, 1.27909640e-02f, 1.24370232e-02f,
+  1.20313354e-02f, 1.15796495e-02f, 1.10882046e-02f, 1.05635822e-02f, 1.00125670e-02f, 9.44199786e-03f,
+  8.85862950e-03f, 8.26900732e-03f, 7.67935021e-03f, 7.09544681e-03f, 6.52257772e-03f, 5.96544659e-03f,
+  5.42813772e-03f, 4.91408864e-03f, 4.42608073e-03f, 3.96624813e-03f, 3.53610096e-03f, 3.13656032e-03f,
+  2.76800478e-03f, 2.43032444e-03f, 2.12297984e-03f, 1.84506504e-03f, 1.59537105e-03f, 1.37244817e-03f,
+  1.17466610e-03f, 1.00026967e-03f, 8.47430259e-04f, 7.14290829e-04f, 5.99004910e-04f, 4.99769696e-04f,
+  4.14852431e-04f, 3.42611223e-04f, 2.81509943e-04f, 2.30128338e-04f, 1.87167607e-04f, 1.51452157e-04f,
+  1.24687906e-02f, 1.24370232e-02f, 1.23422053e-02f, 1.21857794e-02f, 1.19701074e-02f, 1.16984146e-02f,
+  1.13747055e-02f, 1.10036694e-02f, 1.05905645e-02f, 1.01410970e-02f, 9.66128614e-03f, 9.15733632e-03f,
+  8.63550231e-03f, 8.10196251e-03f, 7.56270392e-03f, 7.02341273e-03f, 6.48938399e-03f, 5.96544659e-03f,
+  5.45590324e-03f, 4.96448949e-03f, 4.49434808e-03f, 4.04802384e-03f, 3.62746813e-03f, 3.23406234e-03f,
+  2.86864862e-03f, 2.53157341e-03f, 2.22273637e-03f, 1.94164377e-03f, 1.68746733e-03f, 1.45910122e-03f,
+  1.25521945e-03f, 1.07433100e-03f, 9.14830831e-04f, 7.75046356e-04f, 6.53279130e-04f, 5.47840435e-04f,
+  4.57081478e-04f, 3.79417499e-04f, 3.13346827e-04f, 2.57464562e-04f, 2.10471742e-04f, 1.71180538e-04f,
+  1.38515752e-04f, 1.13457255e-02f, 1.13168191e-02f, 1.12305414e-02f, 1.10882046e-02f, 1.08919581e-02f,
+  1.06447367e-02f, 1.03501845e-02f, 1.00125670e-02f, 9.63667128e-03f, 9.22768656e-03f, 8.79109278e-03f,
+  8.33253376e-03f, 7.85770174e-03f, 7.37221772e-03f, 6.88153040e-03f, 6.39081281e-03f, 5.90488408e-03f,
+  5.42813772e-03f, 4.96448949e-03f, 4.51733731e-03f, 4.08954173e-03f, 3.68341780e-03f, 3.30074155e-03f,
+  2.94276979e-03f, 2.61026900e-03f, 2.30355444e-03f, 2.02253414e-03f, 1.76675967e-03f, 1.53547700e-03f,
+  1.32767973e-03f, 1.14216167e-03f, 9.77565884e-04f, 8.32431891e-04f, 7.05237850e-04f, 5.94438170e-04f,
+  4.98496403e-04f, 4.15912073e-04f, 3.45243287e-04f, 2.85123620e-04f, 2.34274688e-04f, 1.91514526e-04f,
+  1.55762289e-04f, 1.26039624e-04f, 1.02712763e-02f, 1.02451071e-02f, 1.01669999e-02f, 1.00381421e-02f,
+  9.86048114e-03f, 9.63667128e-03f, 9.37001314e-03f, 9.06436890e-03f, 8.72407109e-03f, 8.35381728e-03f,
+  7.95856863e-03f, 7.54343579e-03f, 7.11357081e-03f, 6.67406293e-03f, 6.22984394e-03f, 5.78559749e-03f,
+  5.34568680e-03f, 4.91408864e-03f, 4.49434808e-03f, 4.08954173e-03f, 3.70225869e-03f, 3.33459512e-03f,
+  2.98815873e-03f, 2.66408711e-03f, 2.36307434e-03f, 2.08540587e-03f, 1.83099858e-03f, 1.59944606e-03f,
+  1.39006600e-03f, 1.20194745e-03f, 1.03399809e-03f, 8.84989626e-04f, 7.53599918e-04f, 6.38451253e-04f,
+  5.38144435e-04f, 4.51288361e-04f, 3.76524869e-04f, 3.12548480e-04f, 2.58122192e-04f, 2.12088678e-04f,
+  1.73377950e-04f, 1.41011464e-04f, 1.14103568e-04f, 9.25125647e-03f, 9.22768656e-03f, 9.15733632e-03f,
+  9.04127490e-03f, 8.88125692e-03f, 8.67967308e-03f, 8.43949709e-03f, 8.16420559e-03f, 7.85770174e-03f,
+  7.52421701e-03f, 7.16821989e-03f, 6.79431297e-03f, 6.40713656e-03f, 6.01127557e-03f, 5.61117101e-03f,
+  5.21104177e-03f, 4.81481757e-03f, 4.42608073e-03f, 4.04802384e-03f, 3.68341780e-03f, 3.33459512e-03f,
+  3.00344336e-03f, 2.69141095e-03f, 2.39952211e-03f, 2.12840247e-03f, 1.87830860e-03f, 1.64916588e-03f,
+  1.44060841e-03f, 1.25202141e-03f, 1.08258449e-03f, 9.31313843e-04f, 7.97103159e-04f, 6.78761513e-04f,
+  5.75047976e-04f, 4.84702410e-04f, 4.06471867e-04f, 3.39132966e-04f, 2.81509943e-04f, 2.32488601e-04f,
+  1.91026600e-04f, 1.56160138e-04f, 1.27007908e-04f, 1.02772181e-04f, 8.29012878e-03f, 8.26900732e-03f,
+  8.20596609e-03f, 8.10196251e-03f, 7.95856863e-03f, 7.77792837e-03f, 7.56270392e-03f, 7.31601333e-03f,
+  7.04135234e-03f, 6.74251420e-03f, 6.42350223e-03f, 6.08844124e-03f, 5.74148912e-03f, 5.38675440e-03f,
+  5.02821757e-03f, 4.66965837e-03f, 4.31459863e-03f, 3.96624813e-03f, 3.62746813e-03f, 3.30074155e-03f,
+  2.98815873e-03f, 2.69141095e-03f, 2.41179601e-03f, 2.15023197e-03f, 1.90727937e-03f, 1.68316811e-03f,
+  1.47783139e-03f, 1.29094138e-03f, 1.12194696e-03f, 9.70113091e-04f, 8.34558159e-04f, 7.14290829e-04f,
+  6.08243863e-04f, 5.15305321e-04f, 4.34345915e-04f, 3.64242849e-04f, 3.03899898e-04f, 2.52263417e-04f,
+  2.08334997e-04f, 1.71180538e-04f, 1.39936412e-04f, 1.13812857e-04f, 9.20950188e-05f, 7.39104860e-03f,
+  7.37221772e-03f, 7.31601333e-03f, 7.22328946e-03f, 7.09544681e-03f, 6.93439692e-03f, 6.74251420e-03f,
+  6.52257772e-03f, 6.27770415e-03f, 6.01127557e-03f, 5.72686130e-03f, 5.42813772e-03f, 5.11881337e-03f,
+  4.80255065e-03f, 4.48289746e-03f, 4.16322518e-03f, 3.84667213e-03f, 3.53610096e-03f, 3.23406234e-03f,
+  2.94276979e-03f, 2.66408711e-03f, 2.39952211e-03f, 2.15023197e-03f, 1.91703520e-03f, 1.70043122e-03f,
+  1.50062528e-03f, 1.31755776e-03f, 1.15093624e-03f, 1.00026967e-03f, 8.64902453e-04f, 7.44048739e-04f,
+  6.36824640e-04f, 5.42278634e-04f, 4.59419476e-04f, 3.87240259e-04f, 3.24740016e-04f, 2.70941382e-04f,
+  2.24904972e-04f, 1.85740661e-04f, 1.52615685e-04f, 1.24760045e-04f, 1.01469632e-04f, 8.21071299e-05f,
+  6.55594096e-03f, 6.53923815e-03f, 6.48938399e-03f, 6.40713656e-03f, 6.29373919e-03f, 6.15088595e-03f,
+  5.98068396e-03f, 5.78559749e-03f, 5.56839211e-03f, 5.33206714e-03f, 5.07978862e-03f, 4.81481757e-03f,
+  4.54044342e-03f, 4.25991509e-03f, 3.97637906e-03f, 3.69282626e-03f, 3.41204018e-03f, 3.13656032e-03f,
+  2.86864862e-03f, 2.61026900e-03f, 2.36307434e-03f, 2.12840247e-03f, 1.90727937e-03f, 1.70043122e-03f,
+  1.50830112e-03f, 1.33107102e-03f, 1.16868818e-03f, 1.02089311e-03f, 8.87250120e-04f, 7.67177960e-04f,
+  6.59979356e-04f, 5.64870425e-04f, 4.81007097e-04f, 4.07510088e-04f, 3.43486347e-04f, 2.88047944e-04f,
+  2.40327965e-04f, 1.99493166e-04f, 1.64754005e-04f, 1.35371782e-04f, 1.10663525e-04f, 9.00046798e-05f,
+  7.28299274e-05f, 5.78559749e-03f, 5.77085745e-03f, 5.72686130e-03f, 5.65427821e-03f, 5.55420527e-03f,
+  5.42813772e-03f, 5.27793495e-03f, 5.10577206e-03f, 4.91408864e-03f, 4.70553292e-03f, 4.48289746e-03f,
+  4.24906192e-03f, 4.00692737e-03f, 3.75936180e-03f, 3.50914244e-03f, 3.25890770e-03f, 3.01111490e-03f,
+  2.76800478e-03f, 2.53157341e-03f, 2.30355444e-03f, 2.08540587e-03f, 1.87830860e-03f, 1.68316811e-03f,
+  1.50062528e-03f, 1.33107102e-03f, 1.17466610e-03f, 1.03136362e-03f, 9.00934974e-04f, 7.82995485e-04f,
+  6.77032163e-04f, 5.82429755e-04f, 4.98496403e-04f, 4.24487283e-04f, 3.59626400e-04f, 3.03125620e-04f,
+  2.54201412e-04f, 2.12088678e-04f, 1.76052112e-04f, 1.45394893e-04f, 1.19465178e-04f, 9.76602169e-05f,
+  7.94288499e-05f, 6.42721861e-05f, 5.07978862e-03f, 5.06684650e-03f, 5.02821757e-03f, 4.96448949e-03f,
+  4.87662479e-03f, 4.76593664e-03f, 4.63405764e-03f, 4.48289746e-03f, 4.31459863e-03f, 4.13148524e-03f,
+  3.93601041e-03f, 3.73070105e-03f, 3.51810572e-03f, 3.30074155e-03f, 3.08104744e-03f, 2.86133983e-03f,
+  2.64377659e-03f, 2.43032444e-03f, 2.22273637e-03f, 2.02253414e-03f, 1.83099858e-03f, 1.64916588e-03f,
+  1.47783139e-03f, 1.31755776e-03f, 1.16868818e-03f, 1.03136362e-03f, 9.05543333e-04f, 7.91026163e-04f,
+  6.87474618e-04f, 5.94438170e-04f, 5.11376711e-04f, 4.37682727e-04f, 3.72702314e-04f, 3.15754063e-04f,
+  2.66146060e-04f, 2.23190335e-04f, 1.86215097e-04f, 1.54574780e-04f, 1.27657564e-04f, 1.04891122e-04f,
+  8.57462437e-05f, 6.97389914e-05f, 5.64313523e-05f, 4.43738652e-03f, 4.42608073e-03f, 4.39233705e-03f,
+  4.33666818e-03f, 4.25991509e-03f, 4.16322518e-03f, 4.04802384e-03f, 3.91597953e-03f, 3.76896420e-03f,
+  3.60900769e-03f, 3.43825296e-03f, 3.25890770e-03f, 3.07319756e-03f, 2.88332207e-03f, 2.69141095e-03f,
+  2.49948818e-03f, 2.30943831e-03f, 2.12297984e-03f, 1.94164377e-03f, 1.76675967e-03f, 1.59944606e-03f,
+  1.44060841e-03f, 1.29094138e-03f, 1.15093624e-03f, 1.02089311e-03f, 9.00934974e-04f, 7.91026163e-04f,
+  6.90991117e-04f, 6.00534957e-04f, 5.19264140e-04f, 4.46706807e-04f, 3.82332335e-04f, 3.25569476e-04f,
+  2.75823055e-04f, 2.32488601e-04f, 1.94965149e-04f, 1.62665892e-04f, 1.35026887e-04f, 1.11513691e-04f,
+  9.16263380e-05f, 7.49025639e-05f, 6.09196322e-05f, 4.92949112e-05f, 3.85649758e-03f, 3.84667213e-03f,
+  3.81734571e-03f, 3.76896420e-03f, 3.70225869e-03f, 3.61822615e-03f, 3.51810572e-03f, 3.40334722e-03f,
+  3.27557721e-03f, 3.13656032e-03f, 2.98815873e-03f, 2.83229095e-03f, 2.67089205e-03f, 2.50587240e-03f,
+  2.33908393e-03f, 2.17228546e-03f, 2.00711470e-03f, 1.84506504e-03f, 1.68746733e-03f, 1.53547700e-03f,
+  1.39006600e-03f, 1.25202141e-03f, 1.12194696e-03f, 1.00026967e-03f, 8.87250120e-04f, 7.82995485e-04f,
+  6.87474618e-04f, 6.00534957e-04f, 5.21920214e-04f, 4.51288361e-04f, 3.88229382e-04f, 3.32282012e-04f,
+  2.82949884e-04f, 2.39715664e-04f, 2.02054027e-04f, 1.69442676e-04f, 1.41371653e-04f, 1.17350799e-04f,
+  9.69156681e-05f, 7.96317327e-05f, 6.50972361e-05f, 5.29447752e-05f, 4.28418170e-05f, 3.33459512e-03f,
+  3.32609937e-03f, 3.30074155e-03f, 3.25890770e-03f, 3.20122950e-03f, 3.12856911e-03f, 3.04199802e-03f,
+  2.94276979e-03f, 2.83229095e-03f, 2.71208747e-03f, 2.58376915e-03f, 2.44899513e-03f, 2.30943831e-03f,
+  2.16675107e-03f, 2.02253414e-03f, 1.87830860e-03f, 1.73549040e-03f, 1.59537105e-03f, 1.45910122e-03f,
+  1.32767973e-03f, 1.20194745e-03f, 1.08258449e-03f, 9.70113091e-04f, 8.64902453e-04f, 7.67177960e-04f,
+  6.77032163e-04f, 5.94438170e-04f, 5.19264140e-04f, 4.51288361e-04f, 3.90215195e-04f, 3.35690012e-04f,
+  2.87314062e-04f, 2.44658091e-04f, 2.07274774e-04f, 1.74709916e-04f, 1.46511884e-04f, 1.22239726e-04f,
+  1.01469632e-04f, 8.38000051e-05f, 6.88551154e-05f, 5.62875794e-05f, 4.57797214e-05f, 3.70440066e-05f,
+  2.86864862e-03f, 2.86133983e-03f, 2.83952546e-03f, 2.80353706e-03f, 2.75391829e-03f, 2.69141095e-03f,
+  2.61693634e-03f, 2.53157341e-03f, 2.43653217e-03f, 2.33312463e-03f, 2.22273637e-03f, 2.10679439e-03f,
+  1.98673806e-03f, 1.86398858e-03f, 1.73992338e-03f, 1.61585049e-03f, 1.49298855e-03f, 1.37244817e-03f,
+  1.25521945e-03f, 1.14216167e-03f, 1.03399809e-03f, 9.31313843e-04f, 8.34558159e-04f, 7.44048739e-04f,
+  6.59979356e-04f, 5.82429755e-04f, 5.11376711e-04f, 4.46706807e-04f, 3.88229382e-04f, 3.35690012e-04f,
+  2.88783689e-04f, 2.47167365e-04f, 2.10471742e-04f, 1.78312053e-04f, 1.50297506e-04f, 1.26039624e-04f,
+  1.05159044e-04f, 8.72911769e-05f, 7.20905446e-05f, 5.92339165e-05f, 4.84224547e-05f, 3.93828741e-05f,
+  3.18678067e-05f, 2.45525059e-03f, 2.44899513e-03f, 2.43032444e-03f, 2.39952211e-03f, 2.35705380e-03f,
+  2.30355444e-03f, 2.23981240e-03f, 2.16675107e-03f, 2.08540587e-03f, 1.99690042e-03f, 1.90241996e-03f,
+  1.80318637e-03f, 1.70043122e-03f, 1.59537105e-03f, 1.48918468e-03f, 1.38299190e-03f, 1.27783546e-03f,
+  1.17466610e-03f, 1.07433100e-03f, 9.77565884e-04f, 8.84989626e-04f, 7.97103159e-04f, 7.14290829e-04f,
+  6.36824640e-04f, 5.64870425e-04f, 4.98496403e-04f, 4.37682727e-04f, 3.82332335e-04f, 3.32282012e-04f,
+  2.87314062e-04f, 2.47167365e-04f, 2.11548322e-04f, 1.80140880e-04f, 1.52615685e-04f, 1.28638290e-04f,
+  1.07876178e-04f, 9.00046798e-05f, 7.47117301e-05f, 6.17016485e-05f, 5.06977776e-05f, 4.14443457e-05f,
+  3.37074453e-05f, 2.72753696e-05f, 2.09073257e-03f, 2.08540587e-03f, 2.06950703e-03f, 2.04327796e-03f,
+  2.00711470e-03f, 1.96155789e-03f, 1.90727937e-03f, 1.84506504e-03f, 1.77579676e-03f, 1.70043122e-03f,
+  1.61997788e-03f, 1.53547700e-03f, 1.44797727e-03f, 1.35851488e-03f, 1.26809336e-03f, 1.17766648e-03f,
+  1.08812202e-03f, 1.00026967e-03f, 9.14830831e-04f, 8.32431891e-04f, 7.53599918e-04f, 6.78761513e-04f,
+  6.08243863e-04f, 5.42278634e-04f, 4.81007097e-04f, 4.24487283e-04f, 3.72702314e-04f, 3.25569476e-04f,
+  2.82949884e-04f, 2.44658091e-04f, 2.10471742e-04f, 1.80140880e-04f, 1.53396322e-04f, 1.29957640e-04f,
+  1.09540044e-04f, 9.18603764e-05f, 7.66421654e-05f, 6.36196783e-05f, 5.25411306e-05f, 4.31709486e-05f,
+  3.52913230e-05f, 2.87030816e-05f, 2.32259408e-05f, 1.77127251e-03f, 1.76675967e-03f, 1.75329018e-03f,
+  1.73106883e-03f, 1.70043122e-03f, 1.66183547e-03f, 1.61585049e-03f, 1.56314240e-03f, 1.50445825e-03f,
+  1.44060841e-03f, 1.37244817e-03f, 1.30085892e-03f, 1.22672901e-03f, 1.15093624e-03f, 1.07433100e-03f,
+  9.97721218e-04f, 9.21858940e-04f, 8.47430259e-04f, 7.75046356e-04f, 7.05237850e-04f, 6.38451253e-04f,
+  5.75047976e-04f, 5.15305321e-04f, 4.59419476e-04f, 4.07510088e-04f, 3.59626400e-04f, 3.15754063e-04f,
+  2.75823055e-04f, 2.39715664e-04f, 2.07274774e-04f, 1.78312053e-04f, 1.52615685e-04f, 1.29957640e-04f,
+  1.10100351e-04f, 9.28025256e-05f, 7.78242829e-05f, 6.49313806e-05f, 5.38987078e-05f, 4.45129444e-05f,
+  3.65745072e-05f, 2.98988743e-05f, 2.43173035e-05f, 1.96770598e-05f, 1.49298855e-03f, 1.48918468e-03f,
+  1.47783139e-03f, 1.45910122e-03f, 1.43327715e-03f, 1.40074512e-03f, 1.36198488e-03f, 1.31755776e-03f,
+  1.26809336e-03f, 1.21427502e-03f, 1.15682336e-03f, 1.09648146e-03f, 1.03399809e-03f, 9.70113091e-04f,
+  9.05543333e-04f, 8.40969617e-04f, 7.77026056e-04f, 7.14290829e-04f, 6.53279130e-04f, 5.94438170e-04f,
+  5.38144435e-04f, 4.84702410e-04f, 4.34345915e-04f, 3.87240259e-04f, 3.43486347e-04f, 3.03125620e-04f,
+  2.66146060e-04f, 2.32488601e-04f, 2.02054027e-04f, 1.74709916e-04f, 1.50297506e-04f, 1.28638290e-04f,
+  1.09540044e-04f, 9.28025256e-05f, 7.82223578e-05f, 6.55973345e-05f, 5.47300369e-05f, 4.54307046e-05f,
+  3.75195305e-05f, 3.08282979e-05f, 2.52014725e-05f, 2.04968201e-05f, 1.65856036e-05f, 1.25202141e-03f,
+  1.24883163e-03f, 1.23931072e-03f, 1.22360350e-03f, 1.20194745e-03f, 1.17466610e-03f, 1.14216167e-03f,
+  1.10490504e-03f, 1.06342428e-03f, 1.01829204e-03f, 9.70113091e-04f, 9.19510261e-04f, 8.67111667e-04f,
+  8.13537685e-04f, 7.59389426e-04f, 7.05237850e-04f, 6.51614740e-04f, 5.99004910e-04f, 5.47840435e-04f,
+  4.98496403e-04f, 4.51288361e-04f, 4.06471867e-04f, 3.64242849e-04f, 3.24740016e-04f, 2.88047944e-04f,
+  2.54201412e-04f, 2.23190335e-04f, 1.94965149e-04f, 1.69442676e-04f, 1.46511884e-04f, 1.26039624e-04f,
+  1.07876178e-04f, 9.18603764e-05f, 7.78242829e-05f, 6.55973345e-05f, 5.50099830e-05f, 4.58966570e-05f,
+  3.80982274e-05f, 3.14639110e-05f, 2.58526379e-05f, 2.11339775e-05f, 1.71886513e-05f, 1.39087024e-05f,
+  1.04460306e-03f, 1.04194169e-03f, 1.03399809e-03f, 1.02089311e-03f, 1.00282463e-03f, 9.80062876e-04f,
+  9.52943403e-04f, 9.21858940e-04f, 8.87250120e-04f, 8.49594828e-04f, 8.09397548e-04f, 7.67177960e-04f,
+  7.23460049e-04f, 6.78761513e-04f, 6.33583812e-04f, 5.88403316e-04f, 5.43663802e-04f, 4.99769696e-04f,
+  4.57081478e-04f, 4.15912073e-04f, 3.76524869e-04f, 3.39132966e-04f, 3.03899898e-04f, 2.70941382e-04f,
+  2.40327965e-04f, 2.12088678e-04f, 1.86215097e-04f, 1.62665892e-04f, 1.41371653e-04f, 1.22239726e-04f,
+  1.05159044e-04f, 9.00046798e-05f, 7.66421654e-05f, 6.49313806e-05f, 5.47300369e-05f, 4.58966570e-05f,
+  3.82931030e-05f, 3.17866143e-05f, 2.62513859e-05f, 2.15697146e-05f, 1.76327794e-05f, 1.43410625e-05f,
+  1.16044921e-05f, 8.67111667e-04f, 8.64902453e-04f, 8.58308573e-04f, 8.47430259e-04f, 8.32431891e-04f,
+  8.13537685e-04f, 7.91026163e-04f, 7.65223347e-04f, 7.36495014e-04f, 7.05237850e-04f, 6.71870541e-04f,
+  6.36824640e-04f, 6.00534957e-04f, 5.63431240e-04f, 5.25929790e-04f, 4.88426071e-04f, 4.51288361e-04f,
+  4.14852431e-04f, 3.79417499e-04f, 3.45243287e-04f, 3.12548480e-04f, 2.81509943e-04f, 2.52263417e-04f,
+  2.24904972e-04f, 1.99493166e-04f, 1.76052112e-04f, 1.54574780e-04f, 1.35026887e-04f, 1.17350799e-04f,
+  1.01469632e-04f, 8.72911769e-05f, 7.47117301e-05f, 6.36196783e-05f, 5.38987078e-05f, 4.54307046e-05f,
+  3.80982274e-05f, 3.17866143e-05f, 2.63856637e-05f, 2.17909401e-05f, 1.79047438e-05f, 1.46367447e-05f,
+  1.19043334e-05f, 9.63274033e-06f, 7.16115348e-04f, 7.14290829e-04f, 7.08845211e-04f, 6.99861208e-04f,
+  6.87474618e-04f, 6.71870541e-04f, 6.53279130e-04f, 6.31969539e-04f, 6.08243863e-04f, 5.82429755e-04f,
+  5.54872968e-04f, 5.25929790e-04f, 4.95959481e-04f, 4.65316960e-04f, 4.34345915e-04f, 4.03372978e-04f,
+  3.72702314e-04f, 3.42611223e-04f, 3.13346827e-04f, 2.85123620e-04f, 2.58122192e-04f, 2.32488601e-04f,
+  2.08334997e-04f, 1.85740661e-04f, 1.64754005e-04f, 1.45394893e-04f, 1.27657564e-04f, 1.11513691e-04f,
+  9.69156681e-05f, 8.38000051e-05f, 7.20905446e-05f, 6.17016485e-05f, 5.25411306e-05f, 4.45129444e-05f,
+  3.75195305e-05f, 3.14639110e-05f, 2.62513859e-05f, 2.17909401e-05f, 1.79963281e-05f, 1.47868632e-05f,
+  1.20879440e-05f, 9.83134669e-06f, 7.95532287e-06f, 5.88403316e-04f, 5.86904236e-04f, 5.82429755e-04f,
+  5.75047976e-04f, 5.64870425e-04f, 5.52049198e-04f, 5.36773354e-04f, 5.19264140e-04f, 4.99769696e-04f,
+  4.78559232e-04f, 4.55916917e-04f, 4.32135508e-04f, 4.07510088e-04f, 3.82332335e-04f, 3.56884673e-04f,
+  3.31435440e-04f, 3.06234579e-04f, 2.81509943e-04f, 2.57464562e-04f, 2.34274688e-04f, 2.12088678e-04f,
+  1.91026600e-04f, 1.71180538e-04f, 1.52615685e-04f, 1.35371782e-04f, 1.19465178e-04f, 1.04891122e-04f,
+  9.16263380e-05f, 7.96317327e-05f, 6.88551154e-05f, 5.92339165e-05f, 5.06977776e-05f, 4.31709486e-05f,
+  3.65745072e-05f, 3.08282979e-05f, 2.58526379e-05f, 2.15697146e-05f, 1.79047438e-05f, 1.47868632e-05f,
+  1.21497742e-05f, 9.93218055e-06f, 8.07802462e-06f, 6.53657071e-06f, 4.81007097e-04f, 4.79781622e-04f,
+  4.76123823e-04f, 4.70089377e-04f, 4.61769436e-04f, 4.51288361e-04f, 4.38800693e-04f, 4.24487283e-04f,
+  4.08550986e-04f, 3.91211914e-04f, 3.72702314e-04f, 3.53261508e-04f, 3.33130767e-04f, 3.12548480e-04f,
+  2.91745557e-04f, 2.70941382e-04f, 2.50340207e-04f, 2.30128338e-04f, 2.10471742e-04f, 1.91514526e-04f,
+  1.73377950e-04f, 1.56160138e-04f, 1.39936412e-04f, 1.24760045e-04f, 1.10663525e-04f, 9.76602169e-05f,
+  8.57462437e-05f, 7.49025639e-05f, 6.50972361e-05f, 5.62875794e-05f, 4.84224547e-05f, 4.14443457e-05f,
+  3.52913230e-05f, 2.98988743e-05f, 2.52014725e-05f, 2.11339775e-05f, 1.76327794e-05f, 1.46367447e-05f,
+  1.20879440e-05f, 9.93218055e-06f, 8.11934387e-06f, 6.60361184e-06f, 5.34350647e-06f, 3.91211914e-04f,
+  3.90215195e-04f, 3.87240259e-04f, 3.82332335e-04f, 3.75565578e-04f, 3.67041124e-04f, 3.56884673e-04f,
+  3.45243287e-04f, 3.32282012e-04f, 3.18179838e-04f, 3.03125620e-04f, 2.87314062e-04f, 2.70941382e-04f,
+  2.54201412e-04f, 2.37282016e-04f, 2.20361588e-04f, 2.03606294e-04f, 1.87167607e-04f, 1.71180538e-04f,
+  1.55762289e-04f, 1.41011464e-04f, 1.27007908e-04f, 1.13812857e-04f, 1.01469632e-04f, 9.00046798e-05f,
+  7.94288499e-05f, 6.97389914e-05f, 6.09196322e-05f, 5.29447752e-05f, 4.57797214e-05f, 3.93828741e-05f,
+  3.37074453e-05f, 2.87030816e-05f, 2.43173035e-05f, 2.04968201e-05f, 1.71886513e-05f, 1.43410625e-05f,
+  1.19043334e-05f, 9.83134669e-06f, 8.07802462e-06f, 6.60361184e-06f, 5.37083861e-06f, 4.34597177e-06f,
+  3.16560589e-04f, 3.15754063e-04f, 3.13346827e-04f, 3.09375435e-04f, 3.03899898e-04f, 2.97002087e-04f,
+  2.88783689e-04f, 2.79363740e-04f, 2.68875767e-04f, 2.57464562e-04f, 2.45283009e-04f, 2.32488601e-04f,
+  2.19240159e-04f, 2.05694538e-04f, 1.92003703e-04f, 1.78312053e-04f, 1.64754005e-04f, 1.51452157e-04f,
+  1.38515752e-04f, 1.26039624e-04f, 1.14103568e-04f, 1.02772181e-04f, 9.20950188e-05f, 8.21071299e-05f,
+  7.28299274e-05f, 6.42721861e-05f, 5.64313523e-05f, 4.92949112e-05f, 4.28418170e-05f, 3.70440066e-05f,
+  3.18678067e-05f, 2.72753696e-05f, 2.32259408e-05f, 1.96770598e-05f, 1.65856036e-05f, 1.39087024e-05f,
+  1.16044921e-05f, 9.63274033e-06f, 7.95532287e-06f, 6.53657071e-06f, 5.34350647e-06f, 4.34597177e-06f,
+  3.51667063e-06f
+};
+static const float kern_row_14[] = {
+  3.17320431e-04f, 3.92150920e-04f, 4.82161646e-04f, 5.89815667e-04f, 7.17834220e-04f, 8.69192998e-04f,
+  1.04711042e-03f, 1.25502667e-03f, 1.49657216e-03f, 1.77552400e-03f, 2.09575100e-03f, 2.46114377e-03f,
+  2.87553412e-03f, 3.34259914e-03f, 3.86575423e-03f, 4.44803713e-03f, 5.09198150e-03f, 5.79948490e-03f,
+  6.57167705e-03f, 7.40878936e-03f, 8.31002742e-03f, 9.27346293e-03f, 1.02959303e-02f, 1.13729583e-02f,
+  1.24987196e-02f, 1.36660123e-02f, 1.48662804e-02f, 1.60896666e-02f, 1.73251089e-02f, 1.85604766e-02f,
+  1.97827406e-02f, 2.09781900e-02f, 2.21326705e-02f, 2.32318491e-02f, 2.42615193e-02f, 2.52078846e-02f,
+  2.60578766e-02f, 2.67994478e-02f, 2.74218600e-02f, 2.79159341e-02f, 2.82742847e-02f, 2.84915008e-02f,
+  2.85642762e-02f, 2.84915008e-02f, 2.82742847e-02f, 2.79159341e-02f, 2.74218600e-02f, 2.67994478e-02f,
+  2.60578766e-02f, 2.52078846e-02f, 2.42615193e-02f, 2.32318491e-02f, 2.21326705e-02f, 2.09781900e-02f,
+  1.97827406e-02f, 1.85604766e-02f, 1.73251089e-02f, 1.60896666e-02f, 1.48662804e-02f, 1.36660123e-02f,
+  1.24987196e-02f, 1.13729583e-02f, 1.02959303e-02f, 9.27346293e-03f, 8.31002742e-03f, 7.40878936e-03f,
+  6.57167705e-03f, 5.79948490e-03f, 5.09198150e-03f, 4.44803713e-03f, 3.86575423e-03f, 3.34259914e-03f,
+  2.87553412e-03f, 2.46114377e-03f, 2.09575100e-03f, 1.77552400e-03f, 1.49657216e-03f, 1.25502667e-03f,
+  1.04711042e-03f, 8.69192998e-04f, 7.17834220e-04f, 5.89815667e-04f, 4.82161646e-04f, 3.92150920e-04f,
+  3.17320431e-04f
+};
+static const int kern_half_fixed_14[] = {
+  13689, 13654, 13550, 13378, 13141, 12843, 12488, 12080, 11627, 11133, 10607, 10053,
+  9480, 8895, 8303, 7711, 7124, 6549, 5990, 5450, 4934, 4444, 3982, 3550,
+  3149, 2779, 2440, 2132, 1853, 1602, 1378, 1179, 1004, 851, 717, 601,
+  502, 417, 344, 283, 231, 188, 152, 13654, 13619, 13515, 13344, 13108,
+  12810, 12456, 12050, 11597, 11105, 10580, 10028, 9456, 8872, 8282, 7691, 7106,
+  6532, 5974, 5436, 4922, 4433, 3972, 3541, 3141, 2772, 2434, 2126, 1848,
+  1598, 1375, 1176, 1002, 849, 715, 600, 501, 415, 343, 282, 230,
+  187, 152, 13550, 13515, 13412, 13242, 13008, 12713, 12361, 11958, 11509, 11020,
+  10499, 9951, 9384, 8804, 8218, 7632, 7052, 6483, 5929, 5395, 4884, 4399,
+  3942, 3514, 3117, 2751, 2415, 2110, 1834, 1586, 1364, 1167, 994, 842,
+  710, 595, 497, 412, 341, 280, 229, 186, 151, 13378, 13344, 13242,
+  13074, 12843, 12552, 12204, 11806, 11363, 10881, 10366, 9825, 9265, 8693, 8114,
+  7536, 6963, 6400, 5854, 5327, 4822, 4343, 3892, 3470, 3078, 2716, 2385,
+  2083, 1811, 1566, 1347, 1153, 982, 832, 701, 588, 490, 407, 336,
+  276, 226, 184, 149, 13141, 13108, 13008, 12843, 12616, 12329, 11988, 11597,
+  11162, 10688, 10182, 9651, 9101, 8539, 7971, 7402, 6839, 6287, 5750, 5232,
+  4737, 4266, 3823, 3408, 3023, 2668, 2343, 2046, 1778, 1538, 1323, 1132,
+  964, 817, 689, 577, 482, 400, 330, 271, 222, 180, 146, 12843,
+  12810, 12713, 12552, 12329, 12050, 11716, 11334, 10908, 10445, 9951, 9432, 8895,
+  8345, 7790, 7234, 6684, 6144, 5620, 5113, 4629, 4170, 3736, 3331, 2955,
+  2608, 2289, 2000, 1738, 1503, 1293, 1107, 942, 798, 673, 564, 471,
+  391, 323, 265, 217, 176, 143, 12488, 12456, 12361, 12204, 11988, 11716,
+  11392, 11020, 10607, 10156, 9676, 9171, 8649, 8114, 7574, 7034, 6499, 5974,
+  5464, 4972, 4501, 4054, 3633, 3239, 2873, 2535, 2226, 1945, 1690, 1461,
+  1257, 1076, 916, 776, 654, 549, 458, 380, 314, 258, 211, 171,
+  139, 12080, 12050, 11958, 11806, 11597, 11334, 11020, 10661, 10261, 9825, 9360,
+  8872, 8366, 7850, 7327, 6805, 6287, 5780, 5286, 4810, 4354, 3922, 3514,
+  3133, 2779, 2453, 2153, 1881, 1635, 1414, 1216, 1041, 886, 751, 633,
+  531, 443, 368, 304, 249, 204, 166, 134, 11627, 11597, 11509, 11363,
+  11162, 10908, 10607, 10261, 9875, 9456, 9009, 8539, 8052, 7555, 7052, 6549,
+  6051, 5563, 5087, 4629, 4191, 3775, 3383, 3016, 2675, 2361, 2073, 1811,
+  1574, 1361, 1170, 1002, 853, 723, 609, 511, 426, 354, 292, 240,
+  196, 160, 129, 11133, 11105, 11020, 10881, 10688, 10445, 10156, 9825, 9456,
+  9055, 8627, 8177, 7711, 7234, 6753, 6271, 5794, 5327, 4872, 4433, 4013,
+  3614, 3239, 2888, 2561, 2260, 1985, 1734, 1507, 1303, 1121, 959, 817,
+  692, 583, 489, 408, 339, 280, 230, 188, 153, 124, 10607, 10580,
+  10499, 10366, 10182, 9951, 9676, 9360, 9009, 8627, 8218, 7790, 7346, 6892,
+  6433, 5974, 5520, 5075, 4641, 4223, 3823, 3443, 3086, 2751, 2440, 2153,
+  1891, 1652, 1435, 1241, 1068, 914, 778, 659, 556, 466, 389, 323,
+  267, 219, 179, 146, 118, 10053, 10028, 9951, 9825, 9651, 9432, 9171,
+  8872, 8539, 8177, 7790, 7383, 6963, 6532, 6098, 5663, 5232, 4810, 4399,
+  4003, 3624, 3264, 2925, 2608, 2313, 2041, 1792, 1566, 1361, 1176, 1012,
+  866, 738, 625, 527, 442, 369, 306, 253, 208, 170, 138, 112,
+  9480, 9456, 9384, 9265, 9101, 8895, 8649, 8366, 8052, 7711, 7346, 6963,
+  6566, 6160, 5750, 5340, 4934, 4536, 4148, 3775, 3417, 3078, 2758, 2459,
+  2181, 1925, 1690, 1476, 1283, 1109, 954, 817, 696, 589, 497, 417,
+  348, 288, 238, 196, 160, 130, 105, 8895, 8872, 8804, 8693, 8539,
+  8345, 8114, 7850, 7555, 7234, 6892, 6532, 6160, 5780, 5395, 5010, 4629,
+  4255, 3892, 3541, 3206, 2888, 2588, 2307, 2046, 1806, 1586, 1385, 1204,
+  1041, 895, 766, 653, 553, 466, 391, 326, 271, 224, 184, 150,
+  122, 99, 8303, 8282, 8218, 8114, 7971, 7790, 7574, 7327, 7052, 6753,
+  6433, 6098, 5750, 5395, 5036, 4677, 4321, 3972, 3633, 3306, 2993, 2695,
+  2415, 2153, 1910, 1686, 1480, 1293, 1124, 972, 836, 715, 609, 516,
+  435, 365, 304, 253, 209, 171, 140, 114, 92, 7711, 7691, 7632,
+  7536, 7402, 7234, 7034, 6805, 6549, 6271, 5974, 5663, 5340, 5010, 4677,
+  4343, 4013, 3689, 3374, 3070, 2779, 2503, 2243, 2000, 1774, 1566, 1375,
+  1201, 1044, 902, 776, 664, 566, 479, 404, 339, 283, 235, 194,
+  159, 130, 106, 86, 7124, 7106, 7052, 6963, 6839, 6684, 6499, 6287,
+  6051, 5794, 5520, 5232, 4934, 4629, 4321, 4013, 3708, 3408, 3117, 2837,
+  2568, 2313, 2073, 1848, 1639, 1446, 1270, 1109, 964, 834, 717, 614,
+  523, 443, 373, 313, 261, 217, 179, 147, 120, 98, 79, 6549,
+  6532, 6483, 6400, 6287, 6144, 5974, 5780, 5563, 5327, 5075, 4810, 4536,
+  4255, 3972, 3689, 3408, 3133, 2866, 2608, 2361, 2126, 1905, 1699, 1507,
+  1330, 1167, 1020, 886, 766, 659, 564, 481, 407, 343, 288, 240,
+  199, 165, 135, 111, 90, 73, 5990, 5974, 5929, 5854, 5750, 5620,
+  5464, 5286, 5087, 4872, 4641, 4399, 4148, 3892, 3633, 3374, 3117, 2866,
+  2621, 2385, 2159, 1945, 1743, 1554, 1378, 1216, 1068, 933, 811, 701,
+  603, 516, 439, 372, 314, 263, 220, 182, 151, 124, 101, 82,
+  67, 5450, 5436, 5395, 5327, 5232, 5113, 4972, 4810, 4629, 4433, 4223,
+  4003, 3775, 3541, 3306, 3070, 2837, 2608, 2385, 2170, 1965, 1769, 1586,
+  1414, 1254, 1107, 972, 849, 738, 638, 549, 470, 400, 339, 286,
+  239, 200, 166, 137, 113, 92, 75, 61, 4934, 4922, 4884, 4822,
+  4737, 4629, 4501, 4354, 4191, 4013, 3823, 3624, 3417, 3206, 2993, 2779,
+  2568, 2361, 2159, 1965, 1778, 1602, 1435, 1280, 1135, 1002, 880, 768,
+  668, 577, 497, 425, 362, 307, 259, 217, 181, 150, 124, 102,
+  83, 68, 55, 4444, 4433, 4399, 4343, 4266, 4170, 4054, 3922, 3775,
+  3614, 3443, 3264, 3078, 2888, 2695, 2503, 2313, 2126, 1945, 1769, 1602,
+  1443, 1293, 1153, 1022, 902, 792, 692, 601, 520, 447, 383, 326,
+  276, 233, 195, 163, 135, 112, 92, 75, 61, 49, 3982, 3972,
+  3942, 3892, 3823, 3736, 3633, 3514, 3383, 3239, 3086, 2925, 2758, 2588,
+  2415, 2243, 2073, 1905, 1743, 1586, 1435, 1293, 1159, 1033, 916, 809,
+  710, 620, 539, 466, 401, 343, 292, 248, 209, 175, 146, 121,
+  100, 82, 67, 55, 44, 3550, 3541, 3514, 3470, 3408, 3331, 3239,
+  3133, 3016, 2888, 2751, 2608, 2459, 2307, 2153, 2000, 1848, 1699, 1554,
+  1414, 1280, 1153, 1033, 921, 817, 721, 633, 553, 481, 415, 357,
+  306, 260, 221, 186, 156, 130, 108, 89, 73, 60, 49, 39,
+  3149, 3141, 3117, 3078, 3023, 2955, 2873, 2779, 2675, 2561, 2440, 2313,
+  2181, 2046, 1910, 1774, 1639, 1507, 1378, 1254, 1135, 1022, 916, 817,
+  725, 639, 561, 490, 426, 369, 317, 271, 231, 196, 165, 138,
+  115, 96, 79, 65, 53, 43, 35, 2779, 2772, 2751, 2716, 2668,
+  2608, 2535, 2453, 2361, 2260, 2153, 2041, 1925, 1806, 1686, 1566, 1446,
+  1330, 1216, 1107, 1002, 902, 809, 721, 639, 564, 495, 433, 376,
+  325, 280, 239, 204, 173, 146, 122, 102, 85, 70, 57, 47,
+  38, 31, 2440, 2434, 2415, 2385, 2343, 2289, 2226, 2153, 2073, 1985,
+  1891, 1792, 1690, 1586, 1480, 1375, 1270, 1167, 1068, 972, 880, 792,
+  710, 633, 561, 495, 435, 380, 330, 286, 246, 210, 179, 152,
+  128, 107, 89, 74, 61, 50, 41, 34, 27, 2132, 2126, 2110,
+  2083, 2046, 2000, 1945, 1881, 1811, 1734, 1652, 1566, 1476, 1385, 1293,
+  1201, 1109, 1020, 933, 849, 768, 692, 620, 553, 490, 433, 380,
+  332, 288, 249, 215, 184, 156, 132, 112, 94, 78, 65, 54,
+  44, 36, 29, 24, 1853, 1848, 1834, 1811, 1778, 1738, 1690, 1635,
+  1574, 1507, 1435, 1361, 1283, 1204, 1124, 1044, 964, 886, 811, 738,
+  668, 601, 539, 481, 426, 376, 330, 288, 251, 217, 186, 160,
+  136, 115, 97, 81, 68, 56, 47, 38, 31, 25, 21, 1602,
+  1598, 1586, 1566, 1538, 1503, 1461, 1414, 1361, 1303, 1241, 1176, 1109,
+  1041, 972, 902, 834, 766, 701, 638, 577, 520, 466, 415, 369,
+  325, 286, 249, 217, 187, 161, 138, 118, 100, 84, 70, 59,
+  49, 40, 33, 27, 22, 18, 1378, 1375, 1364, 1347, 1323, 1293,
+  1257, 1216, 1170, 1121, 1068, 1012, 954, 895, 836, 776, 717, 659,
+  603, 549, 497, 447, 401, 357, 317, 280, 246, 215, 186, 161,
+  139, 119, 101, 86, 72, 61, 51, 42, 35, 28, 23, 19,
+  15, 1179, 1176, 1167, 1153, 1132, 1107, 1076, 1041, 1002, 959, 914,
+  866, 817, 766, 715, 664, 614, 564, 516, 470, 425, 383, 343,
+  306, 271, 239, 210, 184, 160, 138, 119, 102, 87, 73, 62,
+  52, 43, 36, 30, 24, 20, 16, 13, 1004, 1002, 994, 982,
+  964, 942, 916, 886, 853, 817, 778, 738, 696, 653, 609, 566,
+  523, 481, 439, 400, 362, 326, 292, 260, 231, 204, 179, 156,
+  136, 118, 101, 87, 74, 62, 53, 44, 37, 31, 25, 21,
+  17, 14, 11, 851, 849, 842, 832, 817, 798, 776, 751, 723,
+  692, 659, 625, 589, 553, 516, 479, 443, 407, 372, 339, 307,
+  276, 248, 221, 196, 173, 152, 132, 115, 100, 86, 73, 62,
+  53, 45, 37, 31, 26, 21, 18, 14, 12, 9, 717, 715,
+  710, 701, 689, 673, 654, 633, 609, 583, 556, 527, 497, 466,
+  435, 404, 373, 343, 314, 286, 259, 233, 209, 186, 165, 146,
+  128, 112, 97, 84, 72, 62, 53, 45, 38, 32, 26, 22,
+  18, 15, 12, 10, 8, 601, 600, 595, 588, 577, 564, 549,
+  531, 511, 489, 466, 442, 417, 391, 365, 339, 313, 288, 263,
+  239, 217, 195, 175, 156, 138, 122, 107, 94, 81, 70, 61,
+  52, 44, 37, 32, 26, 22, 18, 15, 12, 10, 8, 7,
+  502, 501, 497, 490, 482, 471, 458, 443, 426, 408, 389, 369,
+  348, 326, 304, 283, 261, 240, 220, 200, 181, 163, 146, 130,
+  115, 102, 89, 78, 68, 59, 51, 43, 37, 31, 26, 22,
+  18, 15, 13, 10, 8, 7, 6, 417, 415, 412, 407, 400,
+  391, 380, 368, 354, 339, 323, 306, 288, 271, 253, 235, 217,
+  199, 182, 166, 150, 135, 121, 108, 96, 85, 74, 65, 56,
+  49, 42, 36, 31, 26, 22, 18, 15, 13, 10, 9, 7,
+  6, 5, 344, 343, 341, 336, 330, 323, 314, 304, 292, 280,
+  267, 253, 238, 224, 209, 194, 179, 165, 151, 137, 124, 112,
+  100, 89, 79, 70, 61, 54, 47, 40, 35, 30, 25, 21,
+  18, 15, 13, 10, 9, 7, 6, 5, 4, 283, 282, 280,
+  276, 271, 265, 258, 249, 240, 230, 219, 208, 196, 184, 171,
+  159, 147, 135, 124, 113, 102, 92, 82, 73, 65, 57, 50,
+  44, 38, 33, 28, 24, 21, 18, 15, 12, 10, 9, 7,
+  6, 5, 4, 3, 231, 230, 229, 226, 222, 217, 211, 204,
+  196, 188, 179, 170, 160, 150, 140, 130, 120, 111, 101, 92,
+  83, 75, 67, 60, 53, 47, 41, 36, 31, 27, 23, 20,
+  17, 14, 12, 10, 8, 7, 6, 5, 4, 3, 3, 188,
+  187, 186, 184, 180, 176, 171, 166, 160, 153, 146, 138, 130,
+  122, 114, 106, 98, 90, 82, 75, 68, 61, 55, 49, 43,
+  38, 34, 29, 25, 22, 19, 16, 14, 12, 10, 8, 7,
+  6, 5, 4, 3, 3, 2, 152, 152, 151, 149, 146, 143,
+  139, 134, 129, 124, 118, 112, 105, 99, 92, 86, 79, 73,
+  67, 61, 55, 49, 44, 39, 35, 31, 27, 24, 21, 18,
+  15, 13, 11, 9, 8, 7, 6, 5, 4, 3, 3, 2,
+  2
+};
+static const int kern_row_fixed_14[] = {
+  5324, 6579, 8089, 9895, 12043, 14583, 17568, 21056, 25108, 29788, 35161, 41291,
+  48243, 56080, 64857, 74626, 85429, 97299, 110254, 124299, 139419, 155583, 172737, 190807,
+  209694, 229278, 249415, 269940, 290667, 311393, 331899, 351956, 371325, 389766, 407041, 422918,
+  437179, 449620, 460062, 468352, 474364, 478008, 479229, 478008, 474364, 468352, 460062, 449620,
+  437179, 422918, 407041, 389766, 371325, 351956, 331899, 311393, 290667, 269940, 249415, 229278,
+  209694, 190807, 172737, 155583, 139419, 124299, 110254, 97299, 85429, 74626, 64857, 56080,
+  48243, 41291, 35161, 29788, 25108, 21056, 17568, 14583, 12043, 9895, 8089, 6579,
+  5324
+};
+
+static const float kern_half_15[] = {
+  2.65961513e-02f, 2.65371148e-02f, 2.63607893e-02f, 2.60695126e-02f, 2.56671254e-02f, 2.51588821e-02f,
+  2.45513432e-02f, 2.38522291e-02f, 2.30702590e-02f, 2.22149733e-02f, 2.12965328e-02f, 2.03255285e-02f,
+  1.93127710e-02f, 1.82690974e-02f, 1.72051881e-02f, 1.61313824e-02f, 1.50575219e-02f, 1.39928199e-02f,
+  1.29457368e-02f, 1.19238943e-02f, 1.09340046e-02f, 9.98183060e-03f, 9.07216594e-03f, 8.20883457e-03f,
+  7.39472220e-03f, 6.63180929e-03f, 5.92123065e-03f, 5.26334392e-03f, 4.65780497e-03f, 4.10365360e-03f,
+  3.59939784e-03f, 3.14310449e-03f, 2.73248367e-03f, 2.36497284e-03f, 2.03781389e-03f, 1.74812588e-03f,
+  1.49296864e-03f, 1.26940000e-03f, 1.07452390e-03f, 9.05531284e-04f, 7.59732386e-04f, 6.34581840e-04f,
+  5.27696800e-04f, 4.36868810e-04f, 3.60070408e-04f, 2.95456557e-04f, 2.65371148e-02f, 2.64782086e-02f,
+  2.63022743e-02f, 2.60116458e-02f, 2.56101508e-02f, 2.51030345e-02f, 2.44968440e-02f, 2.37992834e-02f,
+  2.30190493e-02f, 2.21656617e-02f, 2.12492608e-02f, 2.02804115e-02f, 1.92699004e-02f, 1.82285458e-02f,
+  1.71669964e-02f, 1.60955731e-02f, 1.50240976e-02f, 1.39617594e-02f, 1.29170008e-02f, 1.18974261e-02f,
+  1.09097343e-02f, 9.95967351e-03f, 9.05202795e-03f, 8.19061324e-03f, 7.37830764e-03f, 6.61708834e-03f,
+  5.90808690e-03f, 5.25166048e-03f, 4.64746589e-03f, 4.09454433e-03f, 3.59140802e-03f, 3.13612749e-03f,
+  2.72641820e-03f, 2.35972321e-03f, 2.03329045e-03f, 1.74424553e-03f, 1.48965465e-03f, 1.26658217e-03f,
+  1.07213866e-03f, 9.03521199e-04f, 7.58045993e-04f, 6.33173215e-04f, 5.26525429e-04f, 4.35899070e-04f,
+  3.59271158e-04f, 2.94800731e-04f, 2.63607893e-02f, 2.63022743e-02f, 2.61275098e-02f, 2.58388110e-02f,
+  2.54399832e-02f, 2.49362383e-02f, 2.43340749e-02f, 2.36411486e-02f, 2.28661001e-02f, 2.20183823e-02f,
+  2.11080704e-02f, 2.01456584e-02f, 1.91418622e-02f, 1.81074254e-02f, 1.70529317e-02f, 1.59886274e-02f,
+  1.49242701e-02f, 1.38689904e-02f, 1.28311738e-02f, 1.18183736e-02f, 1.08372448e-02f, 9.89349652e-03f,
+  8.99188127e-03f, 8.13619047e-03f, 7.32928282e-03f, 6.57312106e-03f, 5.86883072e-03f, 5.21676615e-03f,
+  4.61658603e-03f, 4.06733807e-03f, 3.56754498e-03f, 3.11528961e-03f, 2.70830258e-03f, 2.34404393e-03f,
+  2.01978046e-03f, 1.73265592e-03f, 1.47975667e-03f, 1.25816639e-03f, 1.06501486e-03f, 8.97517777e-04f,
+  7.53009168e-04f, 6.28966140e-04f, 5.23026916e-04f, 4.33002744e-04f, 3.56883975e-04f, 2.92841927e-04f,
+  2.60695126e-02f, 2.60116458e-02f, 2.58388110e-02f, 2.55533028e-02f, 2.51588821e-02f, 2.46607028e-02f,
+  2.40651928e-02f, 2.33799219e-02f, 2.26134378e-02f, 2.17750873e-02f, 2.08748337e-02f, 1.99230555e-02f,
+  1.89303514e-02f, 1.79073457e-02f, 1.68645028e-02f, 1.58119593e-02f, 1.47593627e-02f, 1.37157431e-02f,
+  1.26893939e-02f, 1.16877854e-02f, 1.07174972e-02f, 9.78417788e-03f, 8.89252499e-03f, 8.04628897e-03f,
+  7.24829687e-03f, 6.50049048e-03f, 5.80398273e-03f, 5.15912287e-03f, 4.56557423e-03f, 4.02239570e-03f,
+  3.52812489e-03f, 3.08086677e-03f, 2.67837686e-03f, 2.31814315e-03f, 1.99746247e-03f, 1.71351072e-03f,
+  1.46340590e-03f, 1.24426419e-03f, 1.05324690e-03f, 8.87600589e-04f, 7.44688674e-04f, 6.22016261e-04f,
+  5.17247652e-04f, 4.28218220e-04f, 3.52940551e-04f, 2.89606134e-04f, 2.56671254e-02f, 2.56101508e-02f,
+  2.54399832e-02f, 2.51588821e-02f, 2.47705504e-02f, 2.42800601e-02f, 2.36937422e-02f, 2.30190493e-02f,
+  2.22643949e-02f, 2.14389842e-02f, 2.05526277e-02f, 1.96155403e-02f, 1.86381582e-02f, 1.76309422e-02f,
+  1.66041963e-02f, 1.55678978e-02f, 1.45315491e-02f, 1.35040386e-02f, 1.24935312e-02f, 1.15073826e-02f,
+  1.05520701e-02f, 9.63315647e-03f, 8.75526667e-03f, 7.92209338e-03f, 7.13641802e-03f, 6.40015444e-03f,
+  5.71439695e-03f, 5.07949060e-03f, 4.49510384e-03f, 3.96030908e-03f, 3.47366766e-03f, 3.03331297e-03f,
+  2.63703568e-03f, 2.28236220e-03f, 1.96663127e-03f, 1.68706232e-03f, 1.44081796e-03f, 1.22505869e-03f,
+  1.03698985e-03f, 8.73900251e-04f, 7.33194291e-04f, 6.12415315e-04f, 5.09263831e-04f, 4.21608594e-04f,
+  3.47492838e-04f, 2.85135990e-04f, 2.51588821e-02f, 2.51030345e-02f, 2.49362383e-02f, 2.46607028e-02f,
+  2.42800601e-02f, 2.37992834e-02f, 2.32245754e-02f, 2.25632414e-02f, 2.18235310e-02f, 2.10144650e-02f,
+  2.01456584e-02f, 1.92271266e-02f, 1.82690974e-02f, 1.72818266e-02f, 1.62754115e-02f, 1.52596328e-02f,
+  1.42438058e-02f, 1.32366400e-02f, 1.22461421e-02f, 1.12795206e-02f, 1.03431251e-02f, 9.44240764e-03f,
+  8.58190097e-03f, 7.76522513e-03f, 6.99510751e-03f, 6.27342286e-03f, 5.60124451e-03f, 4.97891009e-03f,
+  4.40609502e-03f, 3.88188986e-03f, 3.40488437e-03f, 2.97324941e-03f, 2.58481875e-03f, 2.23716837e-03f,
+  1.92768942e-03f, 1.65365625e-03f, 1.41228782e-03f, 1.20080088e-03f, 1.01645605e-03f, 8.56595871e-04f,
+  7.18676078e-04f, 6.00288680e-04f, 4.99179761e-04f, 4.13260190e-04f, 3.40612023e-04f, 2.79489934e-04f,
+  2.45513432e-02f, 2.44968440e-02f, 2.43340749e-02f, 2.40651928e-02f, 2.36937422e-02f, 2.32245754e-02f,
+  2.26637460e-02f, 2.20183823e-02f, 2.12965328e-02f, 2.05070060e-02f, 1.96591783e-02f, 1.87628269e-02f,
+  1.78279337e-02f, 1.68645028e-02f, 1.58823915e-02f, 1.48911420e-02f, 1.38998441e-02f, 1.29170008e-02f,
+  1.19504211e-02f, 1.10071423e-02f, 1.00933583e-02f, 9.21439100e-03f, 8.37466400e-03f, 7.57770939e-03f,
+  6.82618888e-03f, 6.12193160e-03f, 5.46598481e-03f, 4.85867867e-03f, 4.29969607e-03f, 3.78814945e-03f,
+  3.32266302e-03f, 2.90145120e-03f, 2.52240035e-03f, 2.18314514e-03f, 1.88113935e-03f, 1.61372358e-03f,
+  1.37818384e-03f, 1.17180392e-03f, 9.91910580e-04f, 8.35910731e-04f, 7.01321405e-04f, 5.85792877e-04f,
+  4.87125508e-04f, 4.03280748e-04f, 3.32386873e-04f, 2.72740785e-04f, 2.38522291e-02f, 2.37992834e-02f,
+  2.36411486e-02f, 2.33799219e-02f, 2.30190493e-02f, 2.25632414e-02f, 2.20183823e-02f, 2.13913955e-02f,
+  2.06901021e-02f, 1.99230555e-02f, 1.90993715e-02f, 1.82285458e-02f, 1.73202734e-02f, 1.63842756e-02f,
+  1.54301301e-02f, 1.44671081e-02f, 1.35040386e-02f, 1.25491815e-02f, 1.16101261e-02f, 1.06937066e-02f,
+  9.80594475e-03f, 8.95200577e-03f, 8.13619047e-03f, 7.36192986e-03f, 6.63180929e-03f, 5.94760571e-03f,
+  5.31033752e-03f, 4.72032512e-03f, 4.17725975e-03f, 3.68027971e-03f, 3.22804810e-03f, 2.81883054e-03f,
+  2.45057349e-03f, 2.12097866e-03f, 1.82757282e-03f, 1.56777189e-03f, 1.33893918e-03f, 1.13843603e-03f,
+  9.63665312e-04f, 8.12107697e-04f, 6.81350881e-04f, 5.69112075e-04f, 4.73254331e-04f, 3.91797075e-04f,
+  3.22921958e-04f, 2.64974311e-04f, 2.30702590e-02f, 2.30190493e-02f, 2.28661001e-02f, 2.26134378e-02f,
+  2.22643949e-02f, 2.18235310e-02f, 2.12965328e-02f, 2.06901021e-02f, 2.00117994e-02f, 1.92699004e-02f,
+  1.84732191e-02f, 1.76309422e-02f, 1.67524461e-02f, 1.58471353e-02f, 1.49242701e-02f, 1.39928199e-02f,
+  1.30613232e-02f, 1.21377707e-02f, 1.12295011e-02f, 1.03431251e-02f, 9.48446710e-03f, 8.65852460e-03f,
+  7.86945503e-03f, 7.12057715e-03f, 6.41439250e-03f, 5.75262029e-03f, 5.13624400e-03f, 4.56557423e-03f,
+  4.04031295e-03f, 3.55962571e-03f, 3.12222005e-03f, 2.72641820e-03f, 2.37023411e-03f, 2.05144472e-03f,
+  1.76765781e-03f, 1.51637418e-03f, 1.29504350e-03f, 1.10111362e-03f, 9.32072580e-04f, 7.85483629e-04f,
+  6.59013516e-04f, 5.50454366e-04f, 4.57739196e-04f, 3.78952449e-04f, 3.12335324e-04f, 2.56287429e-04f,
+  2.22149733e-02f, 2.21656617e-02f, 2.20183823e-02f, 2.17750873e-02f, 2.14389842e-02f, 2.10144650e-02f,
+  2.05070060e-02f, 1.99230555e-02f, 1.92699004e-02f, 1.85555052e-02f, 1.77883599e-02f, 1.69773083e-02f,
+  1.61313824e-02f, 1.52596328e-02f, 1.43709816e-02f, 1.34740621e-02f, 1.25770997e-02f, 1.16877854e-02f,
+  1.08131887e-02f, 9.95967351e-03f, 9.13284905e-03f, 8.33752658e-03f, 7.57770939e-03f, 6.85659517e-03f,
+  6.17659139e-03f, 5.53935254e-03f, 4.94582765e-03f, 4.39631427e-03f, 3.89052578e-03f, 3.42765939e-03f,
+  3.00646969e-03f, 2.62534153e-03f, 2.28236220e-03f, 1.97539129e-03f, 1.70212530e-03f, 1.46015757e-03f,
+  1.24703231e-03f, 1.06029201e-03f, 8.97517777e-04f, 7.56363326e-04f, 6.34581840e-04f, 5.30047284e-04f,
+  4.40769392e-04f, 3.64903506e-04f, 3.00756103e-04f, 2.46786076e-04f, 2.12965328e-02f, 2.12492608e-02f,
+  2.11080704e-02f, 2.08748337e-02f, 2.05526277e-02f, 2.01456584e-02f, 1.96591783e-02f, 1.90993715e-02f,
+  1.84732191e-02f, 1.77883599e-02f, 1.70529317e-02f, 1.62754115e-02f, 1.54644577e-02f, 1.46287503e-02f,
+  1.37768378e-02f, 1.29170008e-02f, 1.20571209e-02f, 1.12045743e-02f, 1.03661362e-02f, 9.54790786e-03f,
+  8.75526667e-03f, 7.99282547e-03f, 7.26442225e-03f, 6.57312106e-03f, 5.92123065e-03f, 5.31033752e-03f,
+  4.74135112e-03f, 4.21455642e-03f, 3.72967869e-03f, 3.28594889e-03f, 2.88217235e-03f, 2.51680124e-03f,
+  2.18800199e-03f, 1.89372222e-03f, 1.63175387e-03f, 1.39978982e-03f, 1.19547592e-03f, 1.01645605e-03f,
+  8.60411441e-04f, 7.25092774e-04f, 6.08346134e-04f, 5.08133438e-04f, 4.22546553e-04f, 3.49817186e-04f,
+  2.88321840e-04f, 2.36583117e-04f, 2.03255285e-02f, 2.02804115e-02f, 2.01456584e-02f, 1.99230555e-02f,
+  1.96155403e-02f, 1.92271266e-02f, 1.87628269e-02f, 1.82285458e-02f, 1.76309422e-02f, 1.69773083e-02f,
+  1.62754115e-02f, 1.55333411e-02f, 1.47593627e-02f, 1.39617594e-02f, 1.31486896e-02f, 1.23280566e-02f,
+  1.15073826e-02f, 1.06937066e-02f, 9.89349652e-03f, 9.11257602e-03f, 8.35607480e-03f, 7.62839662e-03f,
+  6.93320436e-03f, 6.27342286e-03f, 5.65125514e-03f, 5.06821554e-03f, 4.52517113e-03f, 4.02239570e-03f,
+  3.55962571e-03f, 3.13612749e-03f, 2.75076111e-03f, 2.40204902e-03f, 2.08824105e-03f, 1.80737884e-03f,
+  1.55735482e-03f, 1.33596710e-03f, 1.14096876e-03f, 9.70111229e-04f, 8.21181398e-04f, 6.92032510e-04f,
+  5.80608903e-04f, 4.84965305e-04f, 4.03280748e-04f, 3.33867443e-04f, 2.75175960e-04f, 2.25796219e-04f,
+  1.93127710e-02f, 1.92699004e-02f, 1.91418622e-02f, 1.89303514e-02f, 1.86381582e-02f, 1.82690974e-02f,
+  1.78279337e-02f, 1.73202734e-02f, 1.67524461e-02f, 1.61313824e-02f, 1.54644577e-02f, 1.47593627e-02f,
+  1.40239494e-02f, 1.32660875e-02f, 1.24935312e-02f, 1.17137870e-02f, 1.09340046e-02f, 1.01608727e-02f,
+  9.40053444e-03f, 8.65852460e-03f, 7.93971680e-03f, 7.24829687e-03f, 6.58774422e-03f, 5.96083747e-03f,
+  5.36967069e-03f, 4.81568184e-03f, 4.29969607e-03f, 3.82197206e-03f, 3.38226068e-03f, 2.97986390e-03f,
+  2.61369930e-03f, 2.28236220e-03f, 1.98419043e-03f, 1.71732274e-03f, 1.47975667e-03f, 1.26940000e-03f,
+  1.08411780e-03f, 9.21773550e-04f, 7.80264498e-04f, 6.57550641e-04f, 5.51678939e-04f, 4.60801006e-04f,
+  3.83186503e-04f, 3.17231868e-04f, 2.61464796e-04f, 2.14545493e-04f, 1.82690974e-02f, 1.82285458e-02f,
+  1.81074254e-02f, 1.79073457e-02f, 1.76309422e-02f, 1.72818266e-02f, 1.68645028e-02f, 1.63842756e-02f,
+  1.58471353e-02f, 1.52596328e-02f, 1.46287503e-02f, 1.39617594e-02f, 1.32660875e-02f, 1.25491815e-02f,
+  1.18183736e-02f, 1.10807680e-02f, 1.03431251e-02f, 9.61177330e-03f, 8.89252499e-03f, 8.19061324e-03f,
+  7.51065044e-03f, 6.85659517e-03f, 6.23173919e-03f, 5.63871069e-03f, 5.07949060e-03f, 4.55544004e-03f,
+  4.06733807e-03f, 3.61543079e-03f, 3.19948141e-03f, 2.81883054e-03f, 2.47245352e-03f, 2.15902226e-03f,
+  1.87696377e-03f, 1.62451772e-03f, 1.39978982e-03f, 1.20080088e-03f, 1.02553144e-03f, 8.71960423e-04f,
+  7.38098577e-04f, 6.22016261e-04f, 5.21865906e-04f, 4.35899070e-04f, 3.62478895e-04f, 3.00088490e-04f,
+  2.47335091e-04f, 2.02951342e-04f, 1.72051881e-02f, 1.71669964e-02f, 1.70529317e-02f, 1.68645028e-02f,
+  1.66041963e-02f, 1.62754115e-02f, 1.58823915e-02f, 1.54301301e-02f, 1.49242701e-02f, 1.43709816e-02f,
+  1.37768378e-02f, 1.31486896e-02f, 1.24935312e-02f, 1.18183736e-02f, 1.11301253e-02f, 1.04354741e-02f,
+  9.74078849e-03f, 9.05202795e-03f, 8.37466400e-03f, 7.71362893e-03f, 7.07326457e-03f, 6.45729806e-03f,
+  5.86883072e-03f, 5.31033752e-03f, 4.78368392e-03f, 4.29015188e-03f, 3.83047480e-03f, 3.40488437e-03f,
+  3.01315822e-03f, 2.65467470e-03f, 2.32846895e-03f, 2.03329045e-03f, 1.76765781e-03f, 1.52991316e-03f,
+  1.31827244e-03f, 1.13087171e-03f, 9.65809159e-04f, 8.21181398e-04f, 6.95115072e-04f, 5.85792877e-04f,
+  4.91474813e-04f, 4.10514273e-04f, 3.41369770e-04f, 2.82612687e-04f, 2.32931416e-04f, 1.91132378e-04f,
+  1.61313824e-02f, 1.60955731e-02f, 1.59886274e-02f, 1.58119593e-02f, 1.55678978e-02f, 1.52596328e-02f,
+  1.48911420e-02f, 1.44671081e-02f, 1.39928199e-02f, 1.34740621e-02f, 1.29170008e-02f, 1.23280566e-02f,
+  1.17137870e-02f, 1.10807680e-02f, 1.04354741e-02f, 9.78417788e-03f, 9.13284905e-03f, 8.48707464e-03f,
+  7.85198621e-03f, 7.23220734e-03f, 6.63180929e-03f, 6.05428638e-03f, 5.50254667e-03f, 4.97891009e-03f,
+  4.48512565e-03f, 4.02239570e-03f, 3.59140802e-03f, 3.19237937e-03f, 2.82510160e-03f, 2.48899171e-03f,
+  2.18314514e-03f, 1.90638925e-03f, 1.65733520e-03f, 1.43442850e-03f, 1.23599661e-03f, 1.06029201e-03f,
+  9.05531284e-04f, 7.69930019e-04f, 6.51731680e-04f, 5.49232471e-04f, 4.60801006e-04f, 3.84893356e-04f,
+  3.20064282e-04f, 2.64974311e-04f, 2.18393747e-04f, 1.79203460e-04f, 1.50575219e-02f, 1.50240976e-02f,
+  1.49242701e-02f, 1.47593627e-02f, 1.45315491e-02f, 1.42438058e-02f, 1.38998441e-02f, 1.35040386e-02f,
+  1.30613232e-02f, 1.25770997e-02f, 1.20571209e-02f, 1.15073826e-02f, 1.09340046e-02f, 1.03431251e-02f,
+  9.74078849e-03f, 9.13284905e-03f, 8.52487888e-03f, 7.92209338e-03f, 7.32928282e-03f, 6.75076246e-03f,
+  6.19033212e-03f, 5.65125514e-03f, 5.13624400e-03f, 4.64746589e-03f, 4.18655295e-03f, 3.75462626e-03f,
+  3.35232937e-03f, 2.97986390e-03f, 2.63703568e-03f, 2.32330034e-03f, 2.03781389e-03f, 1.77948165e-03f,
+  1.54700701e-03f, 1.33893918e-03f, 1.15371682e-03f, 9.89708700e-04f, 8.45250441e-04f, 7.18676078e-04f,
+  6.08346134e-04f, 5.12670318e-04f, 4.30125656e-04f, 3.59271158e-04f, 2.98757717e-04f, 2.47335091e-04f,
+  2.03855365e-04f, 1.67273960e-04f, 1.39928199e-02f, 1.39617594e-02f, 1.38689904e-02f, 1.37157431e-02f,
+  1.35040386e-02f, 1.32366400e-02f, 1.29170008e-02f, 1.25491815e-02f, 1.21377707e-02f, 1.16877854e-02f,
+  1.12045743e-02f, 1.06937066e-02f, 1.01608727e-02f, 9.61177330e-03f, 9.05202795e-03f, 8.48707464e-03f,
+  7.92209338e-03f, 7.36192986e-03f, 6.81103673e-03f, 6.27342286e-03f, 5.75262029e-03f, 5.25166048e-03f,
+  4.77306545e-03f, 4.31884825e-03f, 3.89052578e-03f, 3.48914042e-03f, 3.11528961e-03f, 2.76916078e-03f,
+  2.45057349e-03f, 2.15902226e-03f, 1.89372222e-03f, 1.65365625e-03f, 1.43761968e-03f, 1.24426419e-03f,
+  1.07213866e-03f, 9.19727434e-04f, 7.85483629e-04f, 6.67859218e-04f, 5.65330614e-04f, 4.76419897e-04f,
+  3.99711891e-04f, 3.33867443e-04f, 2.77632877e-04f, 2.29846279e-04f, 1.89440951e-04f, 1.55446192e-04f,
+  1.29457368e-02f, 1.29170008e-02f, 1.28311738e-02f, 1.26893939e-02f, 1.24935312e-02f, 1.22461421e-02f,
+  1.19504211e-02f, 1.16101261e-02f, 1.12295011e-02f, 1.08131887e-02f, 1.03661362e-02f, 9.89349652e-03f,
+  9.40053444e-03f, 8.89252499e-03f, 8.37466400e-03f, 7.85198621e-03f, 7.32928282e-03f, 6.81103673e-03f,
+  6.30136672e-03f, 5.80398273e-03f, 5.32215182e-03f, 4.85867867e-03f, 4.41589719e-03f, 3.99566907e-03f,
+  3.59939784e-03f, 3.22804810e-03f, 2.88217235e-03f, 2.56194454e-03f, 2.26719724e-03f, 1.99746247e-03f,
+  1.75201497e-03f, 1.52991316e-03f, 1.33004261e-03f, 1.15115591e-03f, 9.91910580e-04f, 8.50904267e-04f,
+  7.26705883e-04f, 6.17883285e-04f, 5.23026916e-04f, 4.40769392e-04f, 3.69801448e-04f, 3.08884133e-04f,
+  2.56857602e-04f, 2.12646875e-04f, 1.75265086e-04f, 1.43814148e-04f, 1.19238943e-02f, 1.18974261e-02f,
+  1.18183736e-02f, 1.16877854e-02f, 1.15073826e-02f, 1.12795206e-02f, 1.10071423e-02f, 1.06937066e-02f,
+  1.03431251e-02f, 9.95967351e-03f, 9.54790786e-03f, 9.11257602e-03f, 8.65852460e-03f, 8.19061324e-03f,
+  7.71362893e-03f, 7.23220734e-03f, 6.75076246e-03f, 6.27342286e-03f, 5.80398273e-03f, 5.34585817e-03f,
+  4.90205968e-03f, 4.47516982e-03f, 4.06733807e-03f, 3.68027971e-03f, 3.31528741e-03f, 2.97324941e-03f,
+  2.65467470e-03f, 2.35972321e-03f, 2.08824105e-03f, 1.83979736e-03f, 1.61372358e-03f, 1.40915299e-03f,
+  1.22505869e-03f, 1.06029201e-03f, 9.13616328e-04f, 7.83740019e-04f, 6.69344969e-04f, 5.69112075e-04f,
+  4.81742958e-04f, 4.05978266e-04f, 3.40612023e-04f, 2.84503069e-04f, 2.36583117e-04f, 1.95862071e-04f,
+  1.61430929e-04f, 1.32462505e-04f, 1.09340046e-02f, 1.09097343e-02f, 1.08372448e-02f, 1.07174972e-02f,
+  1.05520701e-02f, 1.03431251e-02f, 1.00933583e-02f, 9.80594475e-03f, 9.48446710e-03f, 9.13284905e-03f,
+  8.75526667e-03f, 8.35607480e-03f, 7.93971680e-03f, 7.51065044e-03f, 7.07326457e-03f, 6.63180929e-03f,
+  6.19033212e-03f, 5.75262029e-03f, 5.32215182e-03f, 4.90205968e-03f, 4.49510384e-03f, 4.10365360e-03f,
+  3.72967869e-03f, 3.37475282e-03f, 3.04006133e-03f, 2.72641820e-03f, 2.43429071e-03f, 2.16382532e-03f,
+  1.91488094e-03f, 1.68706232e-03f, 1.47975667e-03f, 1.29216886e-03f, 1.12335768e-03f, 9.72269394e-04f,
+  8.37770349e-04f, 7.18676078e-04f, 6.13777782e-04f, 5.21865906e-04f, 4.41749959e-04f, 3.72275041e-04f,
+  3.12335324e-04f, 2.60884408e-04f, 2.16942630e-04f, 1.79602139e-04f, 1.48029372e-04f, 1.21465826e-04f,
+  9.98183060e-03f, 9.95967351e-03f, 9.89349652e-03f, 9.78417788e-03f, 9.63315647e-03f, 9.44240764e-03f,
+  9.21439100e-03f, 8.95200577e-03f, 8.65852460e-03f, 8.33752658e-03f, 7.99282547e-03f, 7.62839662e-03f,
+  7.24829687e-03f, 6.85659517e-03f, 6.45729806e-03f, 6.05428638e-03f, 5.65125514e-03f, 5.25166048e-03f,
+  4.85867867e-03f, 4.47516982e-03f, 4.10365360e-03f, 3.74629209e-03f, 3.40488437e-03f, 3.08086677e-03f,
+  2.77532125e-03f, 2.48899171e-03f, 2.22230353e-03f, 1.97539129e-03f, 1.74812588e-03f, 1.54014665e-03f,
+  1.35089399e-03f, 1.17964193e-03f, 1.02553144e-03f, 8.87600589e-04f, 7.64814205e-04f, 6.56091084e-04f,
+  5.60327724e-04f, 4.76419897e-04f, 4.03280748e-04f, 3.39855935e-04f, 2.85135990e-04f, 2.38165609e-04f,
+  1.98050460e-04f, 1.63961711e-04f, 1.35138427e-04f, 1.10888126e-04f, 9.07216594e-03f, 9.05202795e-03f,
+  8.99188127e-03f, 8.89252499e-03f, 8.75526667e-03f, 8.58190097e-03f, 8.37466400e-03f, 8.13619047e-03f,
+  7.86945503e-03f, 7.57770939e-03f, 7.26442225e-03f, 6.93320436e-03f, 6.58774422e-03f, 6.23173919e-03f,
+  5.86883072e-03f, 5.50254667e-03f, 5.13624400e-03f, 4.77306545e-03f, 4.41589719e-03f, 4.06733807e-03f,
+  3.72967869e-03f, 3.40488437e-03f, 3.09459004e-03f, 2.80010095e-03f, 2.52240035e-03f, 2.26216461e-03f,
+  2.01978046e-03f, 1.79536978e-03f, 1.58881547e-03f, 1.39978982e-03f, 1.22778409e-03f, 1.07213866e-03f,
+  9.32072580e-04f, 8.06711614e-04f, 6.95115072e-04f, 5.96300117e-04f, 5.09263831e-04f, 4.33002744e-04f,
+  3.66528897e-04f, 3.08884133e-04f, 2.59150955e-04f, 2.16461063e-04f, 1.80001691e-04f, 1.49019528e-04f,
+  1.22822967e-04f, 1.00782658e-04f, 8.20883457e-03f, 8.19061324e-03f, 8.13619047e-03f, 8.04628897e-03f,
+  7.92209338e-03f, 7.76522513e-03f, 7.57770939e-03f, 7.36192986e-03f, 7.12057715e-03f, 6.85659517e-03f,
+  6.57312106e-03f, 6.27342286e-03f, 5.96083747e-03f, 5.63871069e-03f, 5.31033752e-03f, 4.97891009e-03f,
+  4.64746589e-03f, 4.31884825e-03f, 3.99566907e-03f, 3.68027971e-03f, 3.37475282e-03f, 3.08086677e-03f,
+  2.80010095e-03f, 2.53363606e-03f, 2.28236220e-03f, 2.04689102e-03f, 1.82757282e-03f, 1.62451772e-03f,
+  1.43761968e-03f, 1.26658217e-03f, 1.11094501e-03f, 9.70111229e-04f, 8.43374175e-04f, 7.29942869e-04f,
+  6.28966140e-04f, 5.39554632e-04f, 4.60801006e-04f, 3.91797075e-04f, 3.31649062e-04f, 2.79489934e-04f,
+  2.34489475e-04f, 1.95862071e-04f, 1.62872268e-04f, 1.34838454e-04f, 1.11134817e-04f, 9.11919196e-05f,
+  7.39472220e-03f, 7.37830764e-03f, 7.32928282e-03f, 7.24829687e-03f, 7.13641802e-03f, 6.99510751e-03f,
+  6.82618888e-03f, 6.63180929e-03f, 6.41439250e-03f, 6.17659139e-03f, 5.92123065e-03f, 5.65125514e-03f,
+  5.36967069e-03f, 5.07949060e-03f, 4.78368392e-03f, 4.48512565e-03f, 4.18655295e-03f, 3.89052578e-03f,
+  3.59939784e-03f, 3.31528741e-03f, 3.04006133e-03f, 2.77532125e-03f, 2.52240035e-03f, 2.28236220e-03f,
+  2.05600867e-03f, 1.84389029e-03f, 1.64632301e-03f, 1.46340590e-03f, 1.29504350e-03f, 1.14096876e-03f,
+  1.00076688e-03f, 8.73900251e-04f, 7.59732386e-04f, 6.57550641e-04f, 5.66588307e-04f, 4.86044213e-04f,
+  4.15100978e-04f, 3.52940551e-04f, 2.98757717e-04f, 2.51771475e-04f, 2.11233943e-04f, 1.76437417e-04f,
+  1.46719380e-04f, 1.21465826e-04f, 1.00113008e-04f, 8.21479480e-05f, 6.63180929e-03f, 6.61708834e-03f,
+  6.57312106e-03f, 6.50049048e-03f, 6.40015444e-03f, 6.27342286e-03f, 6.12193160e-03f, 5.94760571e-03f,
+  5.75262029e-03f, 5.53935254e-03f, 5.31033752e-03f, 5.06821554e-03f, 4.81568184e-03f, 4.55544004e-03f,
+  4.29015188e-03f, 4.02239570e-03f, 3.75462626e-03f, 3.48914042e-03f, 3.22804810e-03f, 2.97324941e-03f,
+  2.72641820e-03f, 2.48899171e-03f, 2.26216461e-03f, 2.04689102e-03f, 1.84389029e-03f, 1.65365625e-03f,
+  1.47647201e-03f, 1.31242641e-03f, 1.16143399e-03f, 1.02325506e-03f, 8.97517777e-04f, 7.83740019e-04f,
+  6.81350881e-04f, 5.89711184e-04f, 5.08133438e-04f, 4.35899070e-04f, 3.72275041e-04f, 3.16527672e-04f,
+  2.67934898e-04f, 2.25796219e-04f, 1.89440951e-04f, 1.58234383e-04f, 1.31582361e-04f, 1.08934204e-04f,
+  8.97843493e-05f, 7.36727452e-05f, 5.92123065e-03f, 5.90808690e-03f, 5.86883072e-03f, 5.80398273e-03f,
+  5.71439695e-03f, 5.60124451e-03f, 5.46598481e-03f, 5.31033752e-03f, 5.13624400e-03f, 4.94582765e-03f,
+  4.74135112e-03f, 4.52517113e-03f, 4.29969607e-03f, 4.06733807e-03f, 3.83047480e-03f, 3.59140802e-03f,
+  3.35232937e-03f, 3.11528961e-03f, 2.88217235e-03f, 2.65467470e-03f, 2.43429071e-03f, 2.22230353e-03f,
+  2.01978046e-03f, 1.82757282e-03f, 1.64632301e-03f, 1.47647201e-03f, 1.31827244e-03f, 1.17180392e-03f,
+  1.03698985e-03f, 9.13616328e-04f, 8.01351445e-04f, 6.99764641e-04f, 6.08346134e-04f, 5.26525429e-04f,
+  4.53688437e-04f, 3.89193796e-04f, 3.32386873e-04f, 2.82612687e-04f, 2.39226472e-04f, 2.01602830e-04f,
+  1.69142921e-04f, 1.41280048e-04f, 1.17483702e-04f, 9.72622292e-05f, 8.01642309e-05f, 6.57789351e-05f,
+  5.26334392e-03f, 5.25166048e-03f, 5.21676615e-03f, 5.15912287e-03f, 5.07949060e-03f, 4.97891009e-03f,
+  4.85867867e-03f, 4.72032512e-03f, 4.56557423e-03f, 4.39631427e-03f, 4.21455642e-03f, 4.02239570e-03f,
+  3.82197206e-03f, 3.61543079e-03f, 3.40488437e-03f, 3.19237937e-03f, 2.97986390e-03f, 2.76916078e-03f,
+  2.56194454e-03f, 2.35972321e-03f, 2.16382532e-03f, 1.97539129e-03f, 1.79536978e-03f, 1.62451772e-03f,
+  1.46340590e-03f, 1.31242641e-03f, 1.17180392e-03f, 1.04160886e-03f, 9.21773550e-04f, 8.12107697e-04f,
+  7.12316134e-04f, 6.22016261e-04f, 5.40754991e-04f, 4.68025042e-04f, 4.03280748e-04f, 3.45951848e-04f,
+  2.95456557e-04f, 2.51212594e-04f, 2.12646875e-04f, 1.79203460e-04f, 1.50350053e-04f, 1.25582927e-04f,
+  1.04430503e-04f, 8.64557660e-05f, 7.12574692e-05f, 5.84704685e-05f, 4.65780497e-03f, 4.64746589e-03f,
+  4.61658603e-03f, 4.56557423e-03f, 4.49510384e-03f, 4.40609502e-03f, 4.29969607e-03f, 4.17725975e-03f,
+  4.04031295e-03f, 3.89052578e-03f, 3.72967869e-03f, 3.55962571e-03f, 3.38226068e-03f, 3.19948141e-03f,
+  3.01315822e-03f, 2.82510160e-03f, 2.63703568e-03f, 2.45057349e-03f, 2.26719724e-03f, 2.08824105e-03f,
+  1.91488094e-03f, 1.74812588e-03f, 1.58881547e-03f, 1.43761968e-03f, 1.29504350e-03f, 1.16143399e-03f,
+  1.03698985e-03f, 9.21773550e-04f, 8.15725070e-04f, 7.18676078e-04f, 6.30365394e-04f, 5.50454366e-04f,
+  4.78542031e-04f, 4.14179551e-04f, 3.56883975e-04f, 3.06150672e-04f, 2.61464796e-04f, 2.22311020e-04f,
+  1.88182210e-04f, 1.58586408e-04f, 1.33052541e-04f, 1.11134817e-04f, 9.24159540e-05f, 7.65091754e-05f,
+  6.30594150e-05f, 5.17435401e-05f, 4.10365360e-03f, 4.09454433e-03f, 4.06733807e-03f, 4.02239570e-03f,
+  3.96030908e-03f, 3.88188986e-03f, 3.78814945e-03f, 3.68027971e-03f, 3.55962571e-03f, 3.42765939e-03f,
+  3.28594889e-03f, 3.13612749e-03f, 2.97986390e-03f, 2.81883054e-03f, 2.65467470e-03f, 2.48899171e-03f,
+  2.32330034e-03f, 2.15902226e-03f, 1.99746247e-03f, 1.83979736e-03f, 1.68706232e-03f, 1.54014665e-03f,
+  1.39978982e-03f, 1.26658217e-03f, 1.14096876e-03f, 1.02325506e-03f, 9.13616328e-04f, 8.12107697e-04f,
+  7.18676078e-04f, 6.33173215e-04f, 5.55369072e-04f, 4.84965305e-04f, 4.21608594e-04f, 3.64903506e-04f,
+  3.14424513e-04f, 2.69727112e-04f, 2.30357618e-04f, 1.95862071e-04f, 1.65793666e-04f, 1.39718948e-04f,
+  1.17222917e-04f, 9.79128090e-05f, 8.14209779e-05f, 6.74066760e-05f, 5.55570659e-05f, 4.55874724e-05f,
+  3.59939784e-03f, 3.59140802e-03f, 3.56754498e-03f, 3.52812489e-03f, 3.47366766e-03f, 3.40488437e-03f,
+  3.32266302e-03f, 3.22804810e-03f, 3.12222005e-03f, 3.00646969e-03f, 2.88217235e-03f, 2.75076111e-03f,
+  2.61369930e-03f, 2.47245352e-03f, 2.32846895e-03f, 2.18314514e-03f, 2.03781389e-03f, 1.89372222e-03f,
+  1.75201497e-03f, 1.61372358e-03f, 1.47975667e-03f, 1.35089399e-03f, 1.22778409e-03f, 1.11094501e-03f,
+  1.00076688e-03f, 8.97517777e-04f, 8.01351445e-04f, 7.12316134e-04f, 6.30365394e-04f, 5.55369072e-04f,
+  4.87125508e-04f, 4.25372942e-04f, 3.69801448e-04f, 3.20064282e-04f, 2.75788130e-04f, 2.36583117e-04f,
+  2.02051335e-04f, 1.71794600e-04f, 1.45421000e-04f, 1.22550337e-04f, 1.02818602e-04f, 8.58813146e-05f,
+  7.14159905e-05f, 5.91237622e-05f, 4.87302314e-05f, 3.99856981e-05f, 3.14310449e-03f, 3.13612749e-03f,
+  3.11528961e-03f, 3.08086677e-03f, 3.03331297e-03f, 2.97324941e-03f, 2.90145120e-03f, 2.81883054e-03f,
+  2.72641820e-03f, 2.62534153e-03f, 2.51680124e-03f, 2.40204902e-03f, 2.28236220e-03f, 2.15902226e-03f,
+  2.03329045e-03f, 1.90638925e-03f, 1.77948165e-03f, 1.65365625e-03f, 1.52991316e-03f, 1.40915299e-03f,
+  1.29216886e-03f, 1.17964193e-03f, 1.07213866e-03f, 9.70111229e-04f, 8.73900251e-04f, 7.83740019e-04f,
+  6.99764641e-04f, 6.22016261e-04f, 5.50454366e-04f, 4.84965305e-04f, 4.25372942e-04f, 3.71448667e-04f,
+  3.22921958e-04f, 2.79489934e-04f, 2.40826645e-04f, 2.06591634e-04f, 1.76437417e-04f, 1.50016320e-04f,
+  1.26986066e-04f, 1.07014705e-04f, 8.97843493e-05f, 7.49941973e-05f, 6.23626329e-05f, 5.16286818e-05f,
+  4.25527323e-05f, 3.49167349e-05f, 2.73248367e-03f, 2.72641820e-03f, 2.70830258e-03f, 2.67837686e-03f,
+  2.63703568e-03f, 2.58481875e-03f, 2.52240035e-03f, 2.45057349e-03f, 2.37023411e-03f, 2.28236220e-03f,
+  2.18800199e-03f, 2.08824105e-03f, 1.98419043e-03f, 1.87696377e-03f, 1.76765781e-03f, 1.65733520e-03f,
+  1.54700701e-03f, 1.43761968e-03f, 1.33004261e-03f, 1.22505869e-03f, 1.12335768e-03f, 1.02553144e-03f,
+  9.32072580e-04f, 8.43374175e-04f, 7.59732386e-04f, 6.81350881e-04f, 6.08346134e-04f, 5.40754991e-04f,
+  4.78542031e-04f, 4.21608594e-04f, 3.69801448e-04f, 3.22921958e-04f, 2.80734879e-04f, 2.42976879e-04f,
+  2.09364633e-04f, 1.79602139e-04f, 1.53387329e-04f, 1.30417917e-04f, 1.10396380e-04f, 9.30341193e-05f,
+  7.80547634e-05f, 6.51968221e-05f, 5.42154703e-05f, 4.48838218e-05f, 3.69935660e-05f, 3.03551515e-05f,
+  2.36497284e-03f, 2.35972321e-03f, 2.34404393e-03f, 2.31814315e-03f, 2.28236220e-03f, 2.23716837e-03f,
+  2.18314514e-03f, 2.12097866e-03f, 2.05144472e-03f, 1.97539129e-03f, 1.89372222e-03f, 1.80737884e-03f,
+  1.71732274e-03f, 1.62451772e-03f, 1.52991316e-03f, 1.43442850e-03f, 1.33893918e-03f, 1.24426419e-03f,
+  1.15115591e-03f, 1.06029201e-03f, 9.72269394e-04f, 8.87600589e-04f, 8.06711614e-04f, 7.29942869e-04f,
+  6.57550641e-04f, 5.89711184e-04f, 5.26525429e-04f, 4.68025042e-04f, 4.14179551e-04f, 3.64903506e-04f,
+  3.20064282e-04f, 2.79489934e-04f, 2.42976879e-04f, 2.10297207e-04f, 1.81205716e-04f, 1.55446192e-04f,
+  1.32757195e-04f, 1.12877096e-04f, 9.55483993e-05f, 8.05213058e-05f, 6.75566334e-05f, 5.64280454e-05f,
+  4.69236511e-05f, 3.88470798e-05f, 3.20180443e-05f, 2.62724752e-05f, 2.03781389e-03f, 2.03329045e-03f,
+  2.01978046e-03f, 1.99746247e-03f, 1.96663127e-03f, 1.92768942e-03f, 1.88113935e-03f, 1.82757282e-03f,
+  1.76765781e-03f, 1.70212530e-03f, 1.63175387e-03f, 1.55735482e-03f, 1.47975667e-03f, 1.39978982e-03f,
+  1.31827244e-03f, 1.23599661e-03f, 1.15371682e-03f, 1.07213866e-03f, 9.91910580e-04f, 9.13616328e-04f,
+  8.37770349e-04f, 7.64814205e-04f, 6.95115072e-04f, 6.28966140e-04f, 5.66588307e-04f, 5.08133438e-04f,
+  4.53688437e-04f, 4.03280748e-04f, 3.56883975e-04f, 3.14424513e-04f, 2.75788130e-04f, 2.40826645e-04f,
+  2.09364633e-04f, 1.81205716e-04f, 1.56138602e-04f, 1.33942522e-04f, 1.14392205e-04f, 9.72622292e-05f,
+  8.23306982e-05f, 6.93823822e-05f, 5.82111752e-05f, 4.86220633e-05f, 4.04324601e-05f, 3.34731631e-05f,
+  2.75888233e-05f, 2.26380689e-05f, 1.74812588e-03f, 1.74424553e-03f, 1.73265592e-03f, 1.71351072e-03f,
+  1.68706232e-03f, 1.65365625e-03f, 1.61372358e-03f, 1.56777189e-03f, 1.51637418e-03f, 1.46015757e-03f,
+  1.39978982e-03f, 1.33596710e-03f, 1.26940000e-03f, 1.20080088e-03f, 1.13087171e-03f, 1.06029201e-03f,
+  9.89708700e-04f, 9.19727434e-04f, 8.50904267e-04f, 7.83740019e-04f, 7.18676078e-04f, 6.56091084e-04f,
+  5.96300117e-04f, 5.39554632e-04f, 4.86044213e-04f, 4.35899070e-04f, 3.89193796e-04f, 3.45951848e-04f,
+  3.06150672e-04f, 2.69727112e-04f, 2.36583117e-04f, 2.06591634e-04f, 1.79602139e-04f, 1.55446192e-04f,
+  1.33942522e-04f, 1.14901748e-04f, 9.81306366e-05f, 8.34357925e-05f, 7.06268765e-05f, 5.95192396e-05f,
+  4.99360940e-05f, 4.17101292e-05f, 3.46847337e-05f, 2.87147432e-05f, 2.36668984e-05f, 1.94199256e-05f,
+  1.49296864e-03f, 1.48965465e-03f, 1.47975667e-03f, 1.46340590e-03f, 1.44081796e-03f, 1.41228782e-03f,
+  1.37818384e-03f, 1.33893918e-03f, 1.29504350e-03f, 1.24703231e-03f, 1.19547592e-03f, 1.14096876e-03f,
+  1.08411780e-03f, 1.02553144e-03f, 9.65809159e-04f, 9.05531284e-04f, 8.45250441e-04f, 7.85483629e-04f,
+  7.26705883e-04f, 6.69344969e-04f, 6.13777782e-04f, 5.60327724e-04f, 5.09263831e-04f, 4.60801006e-04f,
+  4.15100978e-04f, 3.72275041e-04f, 3.32386873e-04f, 2.95456557e-04f, 2.61464796e-04f, 2.30357618e-04f,
+  2.02051335e-04f, 1.76437417e-04f, 1.53387329e-04f, 1.32757195e-04f, 1.14392205e-04f, 9.81306366e-05f,
+  8.38074411e-05f, 7.12574692e-05f, 6.03181434e-05f, 5.08317826e-05f, 4.26473998e-05f, 3.56221026e-05f,
+  2.96221333e-05f, 2.45235260e-05f, 2.02124666e-05f, 1.65853835e-05f, 1.26940000e-03f, 1.26658217e-03f,
+  1.25816639e-03f, 1.24426419e-03f, 1.22505869e-03f, 1.20080088e-03f, 1.17180392e-03f, 1.13843603e-03f,
+  1.10111362e-03f, 1.06029201e-03f, 1.01645605e-03f, 9.70111229e-04f, 9.21773550e-04f, 8.71960423e-04f,
+  8.21181398e-04f, 7.69930019e-04f, 7.18676078e-04f, 6.67859218e-04f, 6.17883285e-04f, 5.69112075e-04f,
+  5.21865906e-04f, 4.76419897e-04f, 4.33002744e-04f, 3.91797075e-04f, 3.52940551e-04f, 3.16527672e-04f,
+  2.82612687e-04f, 2.51212594e-04f, 2.22311020e-04f, 1.95862071e-04f, 1.71794600e-04f, 1.50016320e-04f,
+  1.30417917e-04f, 1.12877096e-04f, 9.72622292e-05f, 8.34357925e-05f, 7.12574692e-05f, 6.05868190e-05f,
+  5.12856350e-05f, 4.32198394e-05f, 3.62610444e-05f, 3.02877706e-05f, 2.51862857e-05f, 2.08511829e-05f,
+  1.71856955e-05f, 1.41017599e-05f, 1.07452390e-03f, 1.07213866e-03f, 1.06501486e-03f, 1.05324690e-03f,
+  1.03698985e-03f, 1.01645605e-03f, 9.91910580e-04f, 9.63665312e-04f, 9.32072580e-04f, 8.97517777e-04f,
+  8.60411441e-04f, 8.21181398e-04f, 7.80264498e-04f, 7.38098577e-04f, 6.95115072e-04f, 6.51731680e-04f,
+  6.08346134e-04f, 5.65330614e-04f, 5.23026916e-04f, 4.81742958e-04f, 4.41749959e-04f, 4.03280748e-04f,
+  3.66528897e-04f, 3.31649062e-04f, 2.98757717e-04f, 2.67934898e-04f, 2.39226472e-04f, 2.12646875e-04f,
+  1.88182210e-04f, 1.65793666e-04f, 1.45421000e-04f, 1.26986066e-04f, 1.10396380e-04f, 9.55483993e-05f,
+  8.23306982e-05f, 7.06268765e-05f, 6.03181434e-05f, 5.12856350e-05f, 4.34123540e-05f, 3.65848027e-05f,
+  3.06943111e-05f, 2.56380445e-05f, 2.13197309e-05f, 1.76501453e-05f, 1.45473768e-05f, 1.19368824e-05f,
+  9.05531284e-04f, 9.03521199e-04f, 8.97517777e-04f, 8.87600589e-04f, 8.73900251e-04f, 8.56595871e-04f,
+  8.35910731e-04f, 8.12107697e-04f, 7.85483629e-04f, 7.56363326e-04f, 7.25092774e-04f, 6.92032510e-04f,
+  6.57550641e-04f, 6.22016261e-04f, 5.85792877e-04f, 5.49232471e-04f, 5.12670318e-04f, 4.76419897e-04f,
+  4.40769392e-04f, 4.05978266e-04f, 3.72275041e-04f, 3.39855935e-04f, 3.08884133e-04f, 2.79489934e-04f,
+  2.51771475e-04f, 2.25796219e-04f, 2.01602830e-04f, 1.79203460e-04f, 1.58586408e-04f, 1.39718948e-04f,
+  1.22550337e-04f, 1.07014705e-04f, 9.30341193e-05f, 8.05213058e-05f, 6.93823822e-05f, 5.95192396e-05f,
+  5.08317826e-05f, 4.32198394e-05f, 3.65848027e-05f, 3.08310337e-05f, 2.58669552e-05f, 2.16058961e-05f,
+  1.79667313e-05f, 1.48742711e-05f, 1.22594811e-05f, 1.00595435e-05f, 7.59732386e-04f, 7.58045993e-04f,
+  7.53009168e-04f, 7.44688674e-04f, 7.33194291e-04f, 7.18676078e-04f, 7.01321405e-04f, 6.81350881e-04f,
+  6.59013516e-04f, 6.34581840e-04f, 6.08346134e-04f, 5.80608903e-04f, 5.51678939e-04f, 5.21865906e-04f,
+  4.91474813e-04f, 4.60801006e-04f, 4.30125656e-04f, 3.99711891e-04f, 3.69801448e-04f, 3.40612023e-04f,
+  3.12335324e-04f, 2.85135990e-04f, 2.59150955e-04f, 2.34489475e-04f, 2.11233943e-04f, 1.89440951e-04f,
+  1.69142921e-04f, 1.50350053e-04f, 1.33052541e-04f, 1.17222917e-04f, 1.02818602e-04f, 8.97843493e-05f,
+  7.80547634e-05f, 6.75566334e-05f, 5.82111752e-05f, 4.99360940e-05f, 4.26473998e-05f, 3.62610444e-05f,
+  3.06943111e-05f, 2.58669552e-05f, 2.17021370e-05f, 1.81271480e-05f, 1.50739224e-05f, 1.24793760e-05f,
+  1.02855920e-05f, 8.43986436e-06f, 6.34581840e-04f, 6.33173215e-04f, 6.28966140e-04f, 6.22016261e-04f,
+  6.12415315e-04f, 6.00288680e-04f, 5.85792877e-04f, 5.69112075e-04f, 5.50454366e-04f, 5.30047284e-04f,
+  5.08133438e-04f, 4.84965305e-04f, 4.60801006e-04f, 4.35899070e-04f, 4.10514273e-04f, 3.84893356e-04f,
+  3.59271158e-04f, 3.33867443e-04f, 3.08884133e-04f, 2.84503069e-04f, 2.60884408e-04f, 2.38165609e-04f,
+  2.16461063e-04f, 1.95862071e-04f, 1.76437417e-04f, 1.58234383e-04f, 1.41280048e-04f, 1.25582927e-04f,
+  1.11134817e-04f, 9.79128090e-05f, 8.58813146e-05f, 7.49941973e-05f, 6.51968221e-05f, 5.64280454e-05f,
+  4.86220633e-05f, 4.17101292e-05f, 3.56221026e-05f, 3.02877706e-05f, 2.56380445e-05f, 2.16058961e-05f,
+  1.81271480e-05f, 1.51410668e-05f, 1.25907982e-05f, 1.04236515e-05f, 8.59124793e-06f, 7.04956756e-06f,
+  5.27696800e-04f, 5.26525429e-04f, 5.23026916e-04f, 5.17247652e-04f, 5.09263831e-04f, 4.99179761e-04f,
+  4.87125508e-04f, 4.73254331e-04f, 4.57739196e-04f, 4.40769392e-04f, 4.22546553e-04f, 4.03280748e-04f,
+  3.83186503e-04f, 3.62478895e-04f, 3.41369770e-04f, 3.20064282e-04f, 2.98757717e-04f, 2.77632877e-04f,
+  2.56857602e-04f, 2.36583117e-04f, 2.16942630e-04f, 1.98050460e-04f, 1.80001691e-04f, 1.62872268e-04f,
+  1.46719380e-04f, 1.31582361e-04f, 1.17483702e-04f, 1.04430503e-04f, 9.24159540e-05f, 8.14209779e-05f,
+  7.14159905e-05f, 6.23626329e-05f, 5.42154703e-05f, 4.69236511e-05f, 4.04324601e-05f, 3.46847337e-05f,
+  2.96221333e-05f, 2.51862857e-05f, 2.13197309e-05f, 1.79667313e-05f, 1.50739224e-05f, 1.25907982e-05f,
+  1.04700821e-05f, 8.66795563e-06f, 7.14419139e-06f, 5.86218175e-06f, 4.36868810e-04f, 4.35899070e-04f,
+  4.33002744e-04f, 4.28218220e-04f, 4.21608594e-04f, 4.13260190e-04f, 4.03280748e-04f, 3.91797075e-04f,
+  3.78952449e-04f, 3.64903506e-04f, 3.49817186e-04f, 3.33867443e-04f, 3.17231868e-04f, 3.00088490e-04f,
+  2.82612687e-04f, 2.64974311e-04f, 2.47335091e-04f, 2.29846279e-04f, 2.12646875e-04f, 1.95862071e-04f,
+  1.79602139e-04f, 1.63961711e-04f, 1.49019528e-04f, 1.34838454e-04f, 1.21465826e-04f, 1.08934204e-04f,
+  9.72622292e-05f, 8.64557660e-05f, 7.65091754e-05f, 6.74066760e-05f, 5.91237622e-05f, 5.16286818e-05f,
+  4.48838218e-05f, 3.88470798e-05f, 3.34731631e-05f, 2.87147432e-05f, 2.45235260e-05f, 2.08511829e-05f,
+  1.76501453e-05f, 1.48742711e-05f, 1.24793760e-05f, 1.04236515e-05f, 8.66795563e-06f, 7.17601370e-06f,
+  5.91452226e-06f, 4.85317423e-06f, 3.60070408e-04f, 3.59271158e-04f, 3.56883975e-04f, 3.52940551e-04f,
+  3.47492838e-04f, 3.40612023e-04f, 3.32386873e-04f, 3.22921958e-04f, 3.12335324e-04f, 3.00756103e-04f,
+  2.88321840e-04f, 2.75175960e-04f, 2.61464796e-04f, 2.47335091e-04f, 2.32931416e-04f, 2.18393747e-04f,
+  2.03855365e-04f, 1.89440951e-04f, 1.75265086e-04f, 1.61430929e-04f, 1.48029372e-04f, 1.35138427e-04f,
+  1.22822967e-04f, 1.11134817e-04f, 1.00113008e-04f, 8.97843493e-05f, 8.01642309e-05f, 7.12574692e-05f,
+  6.30594150e-05f, 5.55570659e-05f, 4.87302314e-05f, 4.25527323e-05f, 3.69935660e-05f, 3.20180443e-05f,
+  2.75888233e-05f, 2.36668984e-05f, 2.02124666e-05f, 1.71856955e-05f, 1.45473768e-05f, 1.22594811e-05f,
+  1.02855920e-05f, 8.59124793e-06f, 7.14419139e-06f, 5.91452226e-06f, 4.87479156e-06f, 4.00002091e-06f,
+  2.95456557e-04f, 2.94800731e-04f, 2.92841927e-04f, 2.89606134e-04f, 2.85135990e-04f, 2.79489934e-04f,
+  2.72740785e-04f, 2.64974311e-04f, 2.56287429e-04f, 2.46786076e-04f, 2.36583117e-04f, 2.25796219e-04f,
+  2.14545493e-04f, 2.02951342e-04f, 1.91132378e-04f, 1.79203460e-04f, 1.67273960e-04f, 1.55446192e-04f,
+  1.43814148e-04f, 1.32462505e-04f, 1.21465826e-04f, 1.10888126e-04f, 1.00782658e-04f, 9.11919196e-05f,
+  8.21479480e-05f, 7.36727452e-05f, 6.57789351e-05f, 5.84704685e-05f, 5.17435401e-05f, 4.55874724e-05f,
+  3.99856981e-05f, 3.49167349e-05f, 3.03551515e-05f, 2.62724752e-05f, 2.26380689e-05f, 1.94199256e-05f,
+  1.65853835e-05f, 1.41017599e-05f, 1.19368824e-05f, 1.00595435e-05f, 8.43986436e-06f, 7.04956756e-06f,
+  5.86218175e-06f, 4.85317423e-06f, 4.00002091e-06f, 3.28222586e-06f
+};
+static const float kern_row_15[] = {
+  2.96171580e-04f, 3.60941805e-04f, 4.37926035e-04f, 5.28973818e-04f, 6.36117533e-04f, 7.61570991e-04f,
+  9.07722686e-04f, 1.07712427e-03f, 1.27247197e-03f, 1.49658171e-03f, 1.75235642e-03f, 2.04274547e-03f,
+  2.37069605e-03f, 2.73909653e-03f, 3.15071084e-03f, 3.60810850e-03f, 4.11358429e-03f, 4.66907723e-03f,
+  5.27608115e-03f, 5.93556045e-03f, 6.64785830e-03f, 7.41261756e-03f, 8.22870061e-03f, 9.09412000e-03f,
+  1.00059872e-02f, 1.09604653e-02f, 1.19527504e-02f, 1.29770664e-02f, 1.40266828e-02f, 1.50939617e-02f,
+  1.61704198e-02f, 1.72468256e-02f, 1.83133092e-02f, 1.93595067e-02f, 2.03747172e-02f, 2.13480722e-02f,
+  2.22687349e-02f, 2.31260899e-02f, 2.39099525e-02f, 2.46107578e-02f, 2.52197664e-02f, 2.57292408e-02f,
+  2.61326022e-02f, 2.64245830e-02f, 2.66013350e-02f, 2.66605150e-02f, 2.66013350e-02f, 2.64245830e-02f,
+  2.61326022e-02f, 2.57292408e-02f, 2.52197664e-02f, 2.46107578e-02f, 2.39099525e-02f, 2.31260899e-02f,
+  2.22687349e-02f, 2.13480722e-02f, 2.03747172e-02f, 1.93595067e-02f, 1.83133092e-02f, 1.72468256e-02f,
+  1.61704198e-02f, 1.50939617e-02f, 1.40266828e-02f, 1.29770664e-02f, 1.19527504e-02f, 1.09604653e-02f,
+  1.00059872e-02f, 9.09412000e-03f, 8.22870061e-03f, 7.41261756e-03f, 6.64785830e-03f, 5.93556045e-03f,
+  5.27608115e-03f, 4.66907723e-03f, 4.11358429e-03f, 3.60810850e-03f, 3.15071084e-03f, 2.73909653e-03f,
+  2.37069605e-03f, 2.04274547e-03f, 1.75235642e-03f, 1.49658171e-03f, 1.27247197e-03f, 1.07712427e-03f,
+  9.07722686e-04f, 7.61570991e-04f, 6.36117533e-04f, 5.28973818e-04f, 4.37926035e-04f, 3.60941805e-04f,
+  2.96171580e-04f
+};
+static const int kern_half_fixed_15[] = {
+  11925, 11898, 11819, 11689, 11508, 11281, 11008, 10695, 10344, 9961, 9549, 9113,
+  8659, 8191, 7714, 7233, 6751, 6274, 5805, 5346, 4902, 4476, 4068, 3681,
+  3316, 2974, 2655, 2360, 2088, 1840, 1614, 1409, 1225, 1060, 914, 784,
+  669, 569, 482, 406, 341, 285, 237, 196, 161, 132, 11898, 11872,
+  11793, 11663, 11483, 11255, 10984, 10671, 10321, 9938, 9528, 9093, 8640, 8173,
+  7697, 7217, 6736, 6260, 5792, 5334, 4892, 4466, 4059, 3672, 3308, 2967,
+  2649, 2355, 2084, 1836, 1610, 1406, 1222, 1058, 912, 782, 668, 568,
+  481, 405, 340, 284, 236, 195, 161, 132, 11819, 11793, 11715, 11585,
+  11407, 11181, 10911, 10600, 10253, 9872, 9464, 9033, 8583, 8119, 7646, 7169,
+  6692, 6218, 5753, 5299, 4859, 4436, 4032, 3648, 3286, 2947, 2631, 2339,
+  2070, 1824, 1600, 1397, 1214, 1051, 906, 777, 663, 564, 478, 402,
+  338, 282, 235, 194, 160, 131, 11689, 11663, 11585, 11457, 11281, 11057,
+  10790, 10483, 10139, 9763, 9360, 8933, 8488, 8029, 7562, 7090, 6618, 6150,
+  5690, 5240, 4805, 4387, 3987, 3608, 3250, 2915, 2602, 2313, 2047, 1804,
+  1582, 1381, 1201, 1039, 896, 768, 656, 558, 472, 398, 334, 279,
+  232, 192, 158, 130, 11508, 11483, 11407, 11281, 11106, 10886, 10624, 10321,
+  9983, 9613, 9215, 8795, 8357, 7905, 7445, 6980, 6516, 6055, 5602, 5160,
+  4731, 4319, 3926, 3552, 3200, 2870, 2562, 2277, 2015, 1776, 1557, 1360,
+  1182, 1023, 882, 756, 646, 549, 465, 392, 329, 275, 228, 189,
+  156, 128, 11281, 11255, 11181, 11057, 10886, 10671, 10413, 10117, 9785, 9422,
+  9033, 8621, 8191, 7749, 7297, 6842, 6387, 5935, 5491, 5057, 4638, 4234,
+  3848, 3482, 3136, 2813, 2511, 2232, 1976, 1741, 1527, 1333, 1159, 1003,
+  864, 741, 633, 538, 456, 384, 322, 269, 224, 185, 153, 125,
+  11008, 10984, 10911, 10790, 10624, 10413, 10162, 9872, 9549, 9195, 8815, 8413,
+  7994, 7562, 7121, 6677, 6232, 5792, 5358, 4935, 4526, 4131, 3755, 3398,
+  3061, 2745, 2451, 2178, 1928, 1698, 1490, 1301, 1131, 979, 843, 724,
+  618, 525, 445, 375, 314, 263, 218, 181, 149, 122, 10695, 10671,
+  10600, 10483, 10321, 10117, 9872, 9591, 9277, 8933, 8564, 8173, 7766, 7346,
+  6918, 6487, 6055, 5627, 5206, 4795, 4397, 4014, 3648, 3301, 2974, 2667,
+  2381, 2116, 1873, 1650, 1447, 1264, 1099, 951, 819, 703, 600, 510,
+  432, 364, 305, 255, 212, 176, 145, 119, 10344, 10321, 10253, 10139,
+  9983, 9785, 9549, 9277, 8973, 8640, 8283, 7905, 7511, 7105, 6692, 6274,
+  5856, 5442, 5035, 4638, 4253, 3882, 3528, 3193, 2876, 2579, 2303, 2047,
+  1812, 1596, 1400, 1222, 1063, 920, 793, 680, 581, 494, 418, 352,
+  295, 247, 205, 170, 140, 115, 9961, 9938, 9872, 9763, 9613, 9422,
+  9195, 8933, 8640, 8320, 7976, 7612, 7233, 6842, 6444, 6041, 5639, 5240,
+  4848, 4466, 4095, 3738, 3398, 3074, 2769, 2484, 2218, 1971, 1744, 1537,
+  1348, 1177, 1023, 886, 763, 655, 559, 475, 402, 339, 285, 238,
+  198, 164, 135, 111, 9549, 9528, 9464, 9360, 9215, 9033, 8815, 8564,
+  8283, 7976, 7646, 7297, 6934, 6559, 6177, 5792, 5406, 5024, 4648, 4281,
+  3926, 3584, 3257, 2947, 2655, 2381, 2126, 1890, 1672, 1473, 1292, 1128,
+  981, 849, 732, 628, 536, 456, 386, 325, 273, 228, 189, 157,
+  129, 106, 9113, 9093, 9033, 8933, 8795, 8621, 8413, 8173, 7905, 7612,
+  7297, 6965, 6618, 6260, 5896, 5528, 5160, 4795, 4436, 4086, 3747, 3420,
+  3109, 2813, 2534, 2272, 2029, 1804, 1596, 1406, 1233, 1077, 936, 810,
+  698, 599, 512, 435, 368, 310, 260, 217, 181, 150, 123, 101,
+  8659, 8640, 8583, 8488, 8357, 8191, 7994, 7766, 7511, 7233, 6934, 6618,
+  6288, 5948, 5602, 5252, 4902, 4556, 4215, 3882, 3560, 3250, 2954, 2673,
+  2408, 2159, 1928, 1714, 1517, 1336, 1172, 1023, 890, 770, 663, 569,
+  486, 413, 350, 295, 247, 207, 172, 142, 117, 96, 8191, 8173,
+  8119, 8029, 7905, 7749, 7562, 7346, 7105, 6842, 6559, 6260, 5948, 5627,
+  5299, 4968, 4638, 4310, 3987, 3672, 3368, 3074, 2794, 2528, 2277, 2043,
+  1824, 1621, 1435, 1264, 1109, 968, 842, 728, 628, 538, 460, 391,
+  331, 279, 234, 195, 163, 135, 111, 91, 7714, 7697, 7646, 7562,
+  7445, 7297, 7121, 6918, 6692, 6444, 6177, 5896, 5602, 5299, 4990, 4679,
+  4367, 4059, 3755, 3459, 3171, 2895, 2631, 2381, 2145, 1924, 1717, 1527,
+  1351, 1190, 1044, 912, 793, 686, 591, 507, 433, 368, 312, 263,
+  220, 184, 153, 127, 104, 86, 7233, 7217, 7169, 7090, 6980, 6842,
+  6677, 6487, 6274, 6041, 5792, 5528, 5252, 4968, 4679, 4387, 4095, 3805,
+  3521, 3243, 2974, 2715, 2467, 2232, 2011, 1804, 1610, 1431, 1267, 1116,
+  979, 855, 743, 643, 554, 475, 406, 345, 292, 246, 207, 173,
+  144, 119, 98, 80, 6751, 6736, 6692, 6618, 6516, 6387, 6232, 6055,
+  5856, 5639, 5406, 5160, 4902, 4638, 4367, 4095, 3822, 3552, 3286, 3027,
+  2776, 2534, 2303, 2084, 1877, 1683, 1503, 1336, 1182, 1042, 914, 798,
+  694, 600, 517, 444, 379, 322, 273, 230, 193, 161, 134, 111,
+  91, 75, 6274, 6260, 6218, 6150, 6055, 5935, 5792, 5627, 5442, 5240,
+  5024, 4795, 4556, 4310, 4059, 3805, 3552, 3301, 3054, 2813, 2579, 2355,
+  2140, 1936, 1744, 1564, 1397, 1242, 1099, 968, 849, 741, 645, 558,
+  481, 412, 352, 299, 253, 214, 179, 150, 124, 103, 85, 70,
+  5805, 5792, 5753, 5690, 5602, 5491, 5358, 5206, 5035, 4848, 4648, 4436,
+  4215, 3987, 3755, 3521, 3286, 3054, 2825, 2602, 2386, 2178, 1980, 1792,
+  1614, 1447, 1292, 1149, 1017, 896, 786, 686, 596, 516, 445, 382,
+  326, 277, 235, 198, 166, 138, 115, 95, 79, 64, 5346, 5334,
+  5299, 5240, 5160, 5057, 4935, 4795, 4638, 4466, 4281, 4086, 3882, 3672,
+  3459, 3243, 3027, 2813, 2602, 2397, 2198, 2007, 1824, 1650, 1486, 1333,
+  1190, 1058, 936, 825, 724, 632, 549, 475, 410, 351, 300, 255,
+  216, 182, 153, 128, 106, 88, 72, 59, 4902, 4892, 4859, 4805,
+  4731, 4638, 4526, 4397, 4253, 4095, 3926, 3747, 3560, 3368, 3171, 2974,
+  2776, 2579, 2386, 2198, 2015, 1840, 1672, 1513, 1363, 1222, 1091, 970,
+  859, 756, 663, 579, 504, 436, 376, 322, 275, 234, 198, 167,
+  140, 117, 97, 81, 66, 54, 4476, 4466, 4436, 4387, 4319, 4234,
+  4131, 4014, 3882, 3738, 3584, 3420, 3250, 3074, 2895, 2715, 2534, 2355,
+  2178, 2007, 1840, 1680, 1527, 1381, 1244, 1116, 996, 886, 784, 691,
+  606, 529, 460, 398, 343, 294, 251, 214, 181, 152, 128, 107,
+  89, 74, 61, 50, 4068, 4059, 4032, 3987, 3926, 3848, 3755, 3648,
+  3528, 3398, 3257, 3109, 2954, 2794, 2631, 2467, 2303, 2140, 1980, 1824,
+  1672, 1527, 1388, 1255, 1131, 1014, 906, 805, 712, 628, 551, 481,
+  418, 362, 312, 267, 228, 194, 164, 138, 116, 97, 81, 67,
+  55, 45, 3681, 3672, 3648, 3608, 3552, 3482, 3398, 3301, 3193, 3074,
+  2947, 2813, 2673, 2528, 2381, 2232, 2084, 1936, 1792, 1650, 1513, 1381,
+  1255, 1136, 1023, 918, 819, 728, 645, 568, 498, 435, 378, 327,
+  282, 242, 207, 176, 149, 125, 105, 88, 73, 60, 50, 41,
+  3316, 3308, 3286, 3250, 3200, 3136, 3061, 2974, 2876, 2769, 2655, 2534,
+  2408, 2277, 2145, 2011, 1877, 1744, 1614, 1486, 1363, 1244, 1131, 1023,
+  922, 827, 738, 656, 581, 512, 449, 392, 341, 295, 254, 218,
+  186, 158, 134, 113, 95, 79, 66, 54, 45, 37, 2974, 2967,
+  2947, 2915, 2870, 2813, 2745, 2667, 2579, 2484, 2381, 2272, 2159, 2043,
+  1924, 1804, 1683, 1564, 1447, 1333, 1222, 1116, 1014, 918, 827, 741,
+  662, 588, 521, 459, 402, 351, 305, 264, 228, 195, 167, 142,
+  120, 101, 85, 71, 59, 49, 40, 33, 2655, 2649, 2631, 2602,
+  2562, 2511, 2451, 2381, 2303, 2218, 2126, 2029, 1928, 1824, 1717, 1610,
+  1503, 1397, 1292, 1190, 1091, 996, 906, 819, 738, 662, 591, 525,
+  465, 410, 359, 314, 273, 236, 203, 175, 149, 127, 107, 90,
+  76, 63, 53, 44, 36, 29, 2360, 2355, 2339, 2313, 2277, 2232,
+  2178, 2116, 2047, 1971, 1890, 1804, 1714, 1621, 1527, 1431, 1336, 1242,
+  1149, 1058, 970, 886, 805, 728, 656, 588, 525, 467, 413, 364,
+  319, 279, 242, 210, 181, 155, 132, 113, 95, 80, 67, 56,
+  47, 39, 32, 26, 2088, 2084, 2070, 2047, 2015, 1976, 1928, 1873,
+  1812, 1744, 1672, 1596, 1517, 1435, 1351, 1267, 1182, 1099, 1017, 936,
+  859, 784, 712, 645, 581, 521, 465, 413, 366, 322, 283, 247,
+  215, 186, 160, 137, 117, 100, 84, 71, 60, 50, 41, 34,
+  28, 23, 1840, 1836, 1824, 1804, 1776, 1741, 1698, 1650, 1596, 1537,
+  1473, 1406, 1336, 1264, 1190, 1116, 1042, 968, 896, 825, 756, 691,
+  628, 568, 512, 459, 410, 364, 322, 284, 249, 217, 189, 164,
+  141, 121, 103, 88, 74, 63, 53, 44, 37, 30, 25, 20,
+  1614, 1610, 1600, 1582, 1557, 1527, 1490, 1447, 1400, 1348, 1292, 1233,
+  1172, 1109, 1044, 979, 914, 849, 786, 724, 663, 606, 551, 498,
+  449, 402, 359, 319, 283, 249, 218, 191, 166, 144, 124, 106,
+  91, 77, 65, 55, 46, 39, 32, 27, 22, 18, 1409, 1406,
+  1397, 1381, 1360, 1333, 1301, 1264, 1222, 1177, 1128, 1077, 1023, 968,
+  912, 855, 798, 741, 686, 632, 579, 529, 481, 435, 392, 351,
+  314, 279, 247, 217, 191, 167, 145, 125, 108, 93, 79, 67,
+  57, 48, 40, 34, 28, 23, 19, 16, 1225, 1222, 1214, 1201,
+  1182, 1159, 1131, 1099, 1063, 1023, 981, 936, 890, 842, 793, 743,
+  694, 645, 596, 549, 504, 460, 418, 378, 341, 305, 273, 242,
+  215, 189, 166, 145, 126, 109, 94, 81, 69, 58, 49, 42,
+  35, 29, 24, 20, 17, 14, 1060, 1058, 1051, 1039, 1023, 1003,
+  979, 951, 920, 886, 849, 810, 770, 728, 686, 643, 600, 558,
+  516, 475, 436, 398, 362, 327, 295, 264, 236, 210, 186, 164,
+  144, 125, 109, 94, 81, 70, 60, 51, 43, 36, 30, 25,
+  21, 17, 14, 12, 914, 912, 906, 896, 882, 864, 843, 819,
+  793, 763, 732, 698, 663, 628, 591, 554, 517, 481, 445, 410,
+  376, 343, 312, 282, 254, 228, 203, 181, 160, 141, 124, 108,
+  94, 81, 70, 60, 51, 44, 37, 31, 26, 22, 18, 15,
+  12, 10, 784, 782, 777, 768, 756, 741, 724, 703, 680, 655,
+  628, 599, 569, 538, 507, 475, 444, 412, 382, 351, 322, 294,
+  267, 242, 218, 195, 175, 155, 137, 121, 106, 93, 81, 70,
+  60, 52, 44, 37, 32, 27, 22, 19, 16, 13, 11, 9,
+  669, 668, 663, 656, 646, 633, 618, 600, 581, 559, 536, 512,
+  486, 460, 433, 406, 379, 352, 326, 300, 275, 251, 228, 207,
+  186, 167, 149, 132, 117, 103, 91, 79, 69, 60, 51, 44,
+  38, 32, 27, 23, 19, 16, 13, 11, 9, 7, 569, 568,
+  564, 558, 549, 538, 525, 510, 494, 475, 456, 435, 413, 391,
+  368, 345, 322, 299, 277, 255, 234, 214, 194, 176, 158, 142,
+  127, 113, 100, 88, 77, 67, 58, 51, 44, 37, 32, 27,
+  23, 19, 16, 14, 11, 9, 8, 6, 482, 481, 478, 472,
+  465, 456, 445, 432, 418, 402, 386, 368, 350, 331, 312, 292,
+  273, 253, 235, 216, 198, 181, 164, 149, 134, 120, 107, 95,
+  84, 74, 65, 57, 49, 43, 37, 32, 27, 23, 19, 16,
+  14, 11, 10, 8, 7, 5, 406, 405, 402, 398, 392, 384,
+  375, 364, 352, 339, 325, 310, 295, 279, 263, 246, 230, 214,
+  198, 182, 167, 152, 138, 125, 113, 101, 90, 80, 71, 63,
+  55, 48, 42, 36, 31, 27, 23, 19, 16, 14, 12, 10,
+  8, 7, 5, 5, 341, 340, 338, 334, 329, 322, 314, 305,
+  295, 285, 273, 260, 247, 234, 220, 207, 193, 179, 166, 153,
+  140, 128, 116, 105, 95, 85, 76, 67, 60, 53, 46, 40,
+  35, 30, 26, 22, 19, 16, 14, 12, 10, 8, 7, 6,
+  5, 4, 285, 284, 282, 279, 275, 269, 263, 255, 247, 238,
+  228, 217, 207, 195, 184, 173, 161, 150, 138, 128, 117, 107,
+  97, 88, 79, 71, 63, 56, 50, 44, 39, 34, 29, 25,
+  22, 19, 16, 14, 11, 10, 8, 7, 6, 5, 4, 3,
+  237, 236, 235, 232, 228, 224, 218, 212, 205, 198, 189, 181,
+  172, 163, 153, 144, 134, 124, 115, 106, 97, 89, 81, 73,
+  66, 59, 53, 47, 41, 37, 32, 28, 24, 21, 18, 16,
+  13, 11, 10, 8, 7, 6, 5, 4, 3, 3, 196, 195,
+  194, 192, 189, 185, 181, 176, 170, 164, 157, 150, 142, 135,
+  127, 119, 111, 103, 95, 88, 81, 74, 67, 60, 54, 49,
+  44, 39, 34, 30, 27, 23, 20, 17, 15, 13, 11, 9,
+  8, 7, 6, 5, 4, 3, 3, 2, 161, 161, 160, 158,
+  156, 153, 149, 145, 140, 135, 129, 123, 117, 111, 104, 98,
+  91, 85, 79, 72, 66, 61, 55, 50, 45, 40, 36, 32,
+  28, 25, 22, 19, 17, 14, 12, 11, 9, 8, 7, 5,
+  5, 4, 3, 3, 2, 2, 132, 132, 131, 130, 128, 125,
+  122, 119, 115, 111, 106, 101, 96, 91, 86, 80, 75, 70,
+  64, 59, 54, 50, 45, 41, 37, 33, 29, 26, 23, 20,
+  18, 16, 14, 12, 10, 9, 7, 6, 5, 5, 4, 3,
+  3, 2, 2, 1
+};
+static const int kern_row_fixed_15[] = {
+  4969, 6056, 7347, 8875, 10672, 12777, 15229, 18071, 21349, 25108, 29400, 34272,
+  39774, 45954, 52860, 60534, 69014, 78334, 88518, 99582, 111533, 124363, 138055, 152574,
+  167873, 183886, 200534, 217719, 235329, 253235, 271295, 289354, 307246, 324799, 341831, 358161,
+  373607, 387991, 401142, 412900, 423117, 431665, 438432, 443331, 446296, 447289, 446296, 443331,
+  438432, 431665, 423117, 412900, 401142, 387991, 373607, 358161, 341831, 324799, 307246, 289354,
+  271295, 253235, 235329, 217719, 200534, 183886, 167873, 152574, 138055, 124363, 111533, 99582,
+  88518, 78334, 69014, 60534, 52860, 45954, 39774, 34272, 29400, 25108, 21349, 18071,
+  15229, 12777, 10672, 8875, 7347, 6056, 4969
+};
+
+static const float kern_half_16[] = {
+  2.49338932e-02f, 2.48852409e-02f, 2.47398559e-02f, 2.44994313e-02f, 2.41667572e-02f, 2.37456635e-02f,
+  2.32409425e-02f, 2.26582699e-02f, 2.20040828e-02f, 2.12854743e-02f, 2.05100607e-02f, 1.96858458e-02f,
+  1.88210886e-02f, 1.79241672e-02f, 1.70034375e-02f, 1.60671193e-02f, 1.51231699e-02f, 1.41791832e-02f,
+  1.32422904e-02f, 1.23190880e-02f, 1.14155682e-02f, 1.05370739e-02f, 9.68826655e-03f, 8.87310598e-03f,
+  8.09485000e-03f, 7.35606300e-03f, 6.65864162e-03f, 6.00384362e-03f, 5.39233256e-03f, 4.82422393e-03f,
+  4.29914240e-03f, 3.81627539e-03f, 3.37443547e-03f, 2.97211809e-03f, 2.60756165e-03f, 2.27880199e-03f,
+  1.98372826e-03f, 1.72013009e-03f, 1.48574379e-03f, 1.27829215e-03f, 1.09551882e-03f, 9.35218472e-04f,
+  7.95261352e-04f, 6.73612580e-04f, 5.68347634e-04f, 4.77662863e-04f, 3.99882527e-04f, 3.33462434e-04f,
+  2.76990526e-04f, 2.48852409e-02f, 2.48366836e-02f, 2.46915817e-02f, 2.44516265e-02f, 2.41196025e-02f,
+  2.36993302e-02f, 2.31955945e-02f, 2.26140581e-02f, 2.19611488e-02f, 2.12439429e-02f, 2.04700418e-02f,
+  1.96474344e-02f, 1.87843647e-02f, 1.78891923e-02f, 1.69702601e-02f, 1.60357691e-02f, 1.50936618e-02f,
+  1.41515164e-02f, 1.32164517e-02f, 1.22950505e-02f, 1.13932937e-02f, 1.05165141e-02f, 9.66936257e-03f,
+  8.85579269e-03f, 8.07905477e-03f, 7.34170992e-03f, 6.64564921e-03f, 5.99212898e-03f, 5.38181094e-03f,
+  4.81481105e-03f, 4.29075351e-03f, 3.80882900e-03f, 3.36785126e-03f, 2.96631898e-03f, 2.60247360e-03f,
+  2.27435562e-03f, 1.97985745e-03f, 1.71677372e-03f, 1.48284482e-03f, 1.27579784e-03f, 1.09338120e-03f,
+  9.33393661e-04f, 7.93709594e-04f, 6.72298251e-04f, 5.67238661e-04f, 4.76730842e-04f, 3.99102253e-04f,
+  3.32811760e-04f, 2.76450068e-04f, 2.47398559e-02f, 2.46915817e-02f, 2.45473292e-02f, 2.43087746e-02f,
+  2.39786897e-02f, 2.35608723e-02f, 2.30600815e-02f, 2.24819425e-02f, 2.18328461e-02f, 2.11198293e-02f,
+  2.03504506e-02f, 1.95326488e-02f, 1.86746232e-02f, 1.77846793e-02f, 1.68711152e-02f, 1.59420837e-02f,
+  1.50054805e-02f, 1.40688401e-02f, 1.31392376e-02f, 1.22232195e-02f, 1.13267312e-02f, 1.04550738e-02f,
+  9.61287227e-03f, 8.80405493e-03f, 8.03185534e-03f, 7.29881786e-03f, 6.60682376e-03f, 5.95712150e-03f,
+  5.35036903e-03f, 4.78668185e-03f, 4.26568603e-03f, 3.78657691e-03f, 3.34817544e-03f, 2.94898893e-03f,
+  2.58726929e-03f, 2.26106821e-03f, 1.96829066e-03f, 1.70674385e-03f, 1.47418166e-03f, 1.26834435e-03f,
+  1.08699338e-03f, 9.27940535e-04f, 7.89072597e-04f, 6.68370514e-04f, 5.63924725e-04f, 4.73945664e-04f,
+  3.96770600e-04f, 3.30867391e-04f, 2.74834980e-04f, 2.44994313e-02f, 2.44516265e-02f, 2.43087746e-02f,
+  2.40725409e-02f, 2.37456635e-02f, 2.33319066e-02f, 2.28359811e-02f, 2.22634599e-02f, 2.16206722e-02f,
+  2.09145844e-02f, 2.01526824e-02f, 1.93428285e-02f, 1.84931401e-02f, 1.76118463e-02f, 1.67071596e-02f,
+  1.57871563e-02f, 1.48596559e-02f, 1.39321173e-02f, 1.30115496e-02f, 1.21044330e-02f, 1.12166572e-02f,
+  1.03534702e-02f, 9.51945316e-03f, 8.71849619e-03f, 7.95380119e-03f, 7.22788740e-03f, 6.54261792e-03f,
+  5.89922955e-03f, 5.29837376e-03f, 4.74016415e-03f, 4.22423193e-03f, 3.74977849e-03f, 3.31563735e-03f,
+  2.92033050e-03f, 2.56212614e-03f, 2.23909505e-03f, 1.94916269e-03f, 1.69015757e-03f, 1.45985547e-03f,
+  1.25601853e-03f, 1.07642985e-03f, 9.18922771e-04f, 7.81404320e-04f, 6.61875238e-04f, 5.58444473e-04f,
+  4.69339808e-04f, 3.92914750e-04f, 3.27652000e-04f, 2.72164092e-04f, 2.41667572e-02f, 2.41196025e-02f,
+  2.39786897e-02f, 2.37456635e-02f, 2.34232247e-02f, 2.30150856e-02f, 2.25258954e-02f, 2.19611488e-02f,
+  2.13270877e-02f, 2.06305888e-02f, 1.98790319e-02f, 1.90801769e-02f, 1.82420257e-02f, 1.73726976e-02f,
+  1.64802969e-02f, 1.55727863e-02f, 1.46578792e-02f, 1.37429349e-02f, 1.28348675e-02f, 1.19400695e-02f,
+  1.10643478e-02f, 1.02128824e-02f, 9.39019024e-03f, 8.60010926e-03f, 7.84579758e-03f, 7.12974090e-03f,
+  6.45377673e-03f, 5.81912510e-03f, 5.22642769e-03f, 4.67579812e-03f, 4.16687131e-03f, 3.69886076e-03f,
+  3.27061489e-03f, 2.88067572e-03f, 2.52733543e-03f, 2.20869062e-03f, 1.92269532e-03f, 1.66720722e-03f,
+  1.44003227e-03f, 1.23896322e-03f, 1.06181321e-03f, 9.06444853e-04f, 7.70793704e-04f, 6.52887742e-04f,
+  5.50861412e-04f, 4.62966709e-04f, 3.87579435e-04f, 3.23202868e-04f, 2.68468430e-04f, 2.37456635e-02f,
+  2.36993302e-02f, 2.35608723e-02f, 2.33319066e-02f, 2.30150856e-02f, 2.26140581e-02f, 2.21333914e-02f,
+  2.15784851e-02f, 2.09554732e-02f, 2.02711113e-02f, 1.95326488e-02f, 1.87477134e-02f, 1.79241672e-02f,
+  1.70699861e-02f, 1.61931347e-02f, 1.53014371e-02f, 1.44024724e-02f, 1.35034714e-02f, 1.26112262e-02f,
+  1.17320195e-02f, 1.08715566e-02f, 1.00349281e-02f, 9.22656991e-03f, 8.45025666e-03f, 7.70908827e-03f,
+  7.00550852e-03f, 6.34132279e-03f, 5.71772922e-03f, 5.13535971e-03f, 4.59432462e-03f, 4.09426587e-03f,
+  3.63440998e-03f, 3.21362610e-03f, 2.83048139e-03f, 2.48329761e-03f, 2.17020535e-03f, 1.88919331e-03f,
+  1.63815694e-03f, 1.41494034e-03f, 1.21737481e-03f, 1.04331167e-03f, 8.90650437e-04f, 7.57362985e-04f,
+  6.41511462e-04f, 5.41262911e-04f, 4.54899739e-04f, 3.80826037e-04f, 3.17571190e-04f, 2.63790484e-04f,
+  2.32409425e-02f, 2.31955945e-02f, 2.30600815e-02f, 2.28359811e-02f, 2.25258954e-02f, 2.21333914e-02f,
+  2.16629412e-02f, 2.11198293e-02f, 2.05100607e-02f, 1.98402442e-02f, 1.91174783e-02f, 1.83492266e-02f,
+  1.75431836e-02f, 1.67071596e-02f, 1.58489458e-02f, 1.49762016e-02f, 1.40963448e-02f, 1.32164517e-02f,
+  1.23431720e-02f, 1.14826523e-02f, 1.06404796e-02f, 9.82163288e-03f, 9.03045759e-03f, 8.27064458e-03f,
+  7.54522951e-03f, 6.85660494e-03f, 6.20653667e-03f, 5.59619768e-03f, 5.02620637e-03f, 4.49667126e-03f,
+  4.00724122e-03f, 3.55715980e-03f, 3.14531964e-03f, 2.77031888e-03f, 2.43051467e-03f, 2.12407717e-03f,
+  1.84903806e-03f, 1.60333747e-03f, 1.38486549e-03f, 1.19149929e-03f, 1.02113583e-03f, 8.71719501e-04f,
+  7.41265074e-04f, 6.27875968e-04f, 5.29758283e-04f, 4.45230748e-04f, 3.72731505e-04f, 3.10821168e-04f,
+  2.58183572e-04f, 2.26582699e-02f, 2.26140581e-02f, 2.24819425e-02f, 2.22634599e-02f, 2.19611488e-02f,
+  2.15784851e-02f, 2.11198293e-02f, 2.05903351e-02f, 1.99958533e-02f, 1.93428285e-02f, 1.86381843e-02f,
+  1.78891923e-02f, 1.71033591e-02f, 1.62882954e-02f, 1.54515980e-02f, 1.46007333e-02f, 1.37429349e-02f,
+  1.28851021e-02f, 1.20337158e-02f, 1.11947712e-02f, 1.03737116e-02f, 9.57539491e-03f, 8.80405493e-03f,
+  8.06329120e-03f, 7.35606300e-03f, 6.68470282e-03f, 6.05093269e-03f, 5.45589533e-03f, 4.90019470e-03f,
+  4.38393513e-03f, 3.90677573e-03f, 3.46797821e-03f, 3.06646340e-03f, 2.70086410e-03f, 2.36957916e-03f,
+  2.07082438e-03f, 1.80268078e-03f, 1.56314019e-03f, 1.35014555e-03f, 1.16162724e-03f, 9.95534938e-04f,
+  8.49864620e-04f, 7.22680823e-04f, 6.12134521e-04f, 5.16476692e-04f, 4.34068381e-04f, 3.63386731e-04f,
+  3.03028559e-04f, 2.51710648e-04f, 2.20040828e-02f, 2.19611488e-02f, 2.18328461e-02f, 2.16206722e-02f,
+  2.13270877e-02f, 2.09554732e-02f, 2.05100607e-02f, 1.99958533e-02f, 1.94185358e-02f, 1.87843647e-02f,
+  1.81000642e-02f, 1.73726976e-02f, 1.66095532e-02f, 1.58180222e-02f, 1.50054805e-02f, 1.41791832e-02f,
+  1.33461505e-02f, 1.25130853e-02f, 1.16862804e-02f, 1.08715566e-02f, 1.00742029e-02f, 9.29893553e-03f,
+  8.54986534e-03f, 7.83048850e-03f, 7.14368001e-03f, 6.49170298e-03f, 5.87623054e-03f, 5.29837376e-03f,
+  4.75871656e-03f, 4.25736280e-03f, 3.79397976e-03f, 3.36785126e-03f, 2.97792885e-03f, 2.62288516e-03f,
+  2.30116490e-03f, 2.01103580e-03f, 1.75063405e-03f, 1.51800946e-03f, 1.31116435e-03f, 1.12808880e-03f,
+  9.66791937e-04f, 8.25327414e-04f, 7.01815705e-04f, 5.94461046e-04f, 5.01565053e-04f, 4.21536010e-04f,
+  3.52895091e-04f, 2.94279540e-04f, 2.44443276e-04f, 2.12854743e-02f, 2.12439429e-02f, 2.11198293e-02f,
+  2.09145844e-02f, 2.06305888e-02f, 2.02711113e-02f, 1.98402442e-02f, 1.93428285e-02f, 1.87843647e-02f,
+  1.81709062e-02f, 1.75089538e-02f, 1.68053415e-02f, 1.60671193e-02f, 1.53014371e-02f, 1.45154325e-02f,
+  1.37161203e-02f, 1.29102934e-02f, 1.21044330e-02f, 1.13046300e-02f, 1.05165141e-02f, 9.74520016e-03f,
+  8.99525080e-03f, 8.27064458e-03f, 7.57476082e-03f, 6.91038184e-03f, 6.27969718e-03f, 5.68432501e-03f,
+  5.12533961e-03f, 4.60330676e-03f, 4.11832612e-03f, 3.67007614e-03f, 3.25786392e-03f, 2.88067572e-03f,
+  2.53722700e-03f, 2.22601369e-03f, 1.94535952e-03f, 1.69346191e-03f, 1.46843435e-03f, 1.26834435e-03f,
+  1.09124777e-03f, 9.35218472e-04f, 7.98373891e-04f, 6.78895798e-04f, 5.75047161e-04f, 4.85184952e-04f,
+  4.07769490e-04f, 3.41370265e-04f, 2.84668989e-04f, 2.36460270e-04f, 2.05100607e-02f, 2.04700418e-02f,
+  2.03504506e-02f, 2.01526824e-02f, 1.98790319e-02f, 1.95326488e-02f, 1.91174783e-02f, 1.86381843e-02f,
+  1.81000642e-02f, 1.75089538e-02f, 1.68711152e-02f, 1.61931347e-02f, 1.54818064e-02f, 1.47440173e-02f,
+  1.39866462e-02f, 1.32164517e-02f, 1.24399802e-02f, 1.16634779e-02f, 1.08928112e-02f, 1.01334052e-02f,
+  9.39019024e-03f, 8.66756029e-03f, 7.96935055e-03f, 7.29881786e-03f, 6.65864162e-03f, 6.05093269e-03f,
+  5.47724916e-03f, 4.93862713e-03f, 4.43561189e-03f, 3.96829844e-03f, 3.53637803e-03f, 3.13918246e-03f,
+  2.77573476e-03f, 2.44479766e-03f, 2.14492157e-03f, 1.87449146e-03f, 1.63177028e-03f, 1.41494034e-03f,
+  1.22213946e-03f, 1.05149439e-03f, 9.01149178e-04f, 7.69289734e-04f, 6.54164120e-04f, 5.54098631e-04f,
+  4.67510021e-04f, 3.92914750e-04f, 3.28934402e-04f, 2.74298713e-04f, 2.27846191e-04f, 1.96858458e-02f,
+  1.96474344e-02f, 1.95326488e-02f, 1.93428285e-02f, 1.90801769e-02f, 1.87477134e-02f, 1.83492266e-02f,
+  1.78891923e-02f, 1.73726976e-02f, 1.68053415e-02f, 1.61931347e-02f, 1.55424001e-02f, 1.48596559e-02f,
+  1.41515164e-02f, 1.34245809e-02f, 1.26853371e-02f, 1.19400695e-02f, 1.11947712e-02f, 1.04550738e-02f,
+  9.72618535e-03f, 9.01283696e-03f, 8.31924751e-03f, 7.64909526e-03f, 7.00550852e-03f, 6.39105868e-03f,
+  5.80777042e-03f, 5.25714131e-03f, 4.74016415e-03f, 4.25736280e-03f, 3.80882900e-03f, 3.39426543e-03f,
+  3.01303179e-03f, 2.66418955e-03f, 2.34655151e-03f, 2.05872604e-03f, 1.79916341e-03f, 1.56619621e-03f,
+  1.35807972e-03f, 1.17302674e-03f, 1.00923923e-03f, 8.64935690e-04f, 7.38375180e-04f, 6.27875968e-04f,
+  5.31831698e-04f, 4.48722742e-04f, 3.77125136e-04f, 3.15715879e-04f, 2.63275782e-04f, 2.18689995e-04f,
+  1.88210886e-02f, 1.87843647e-02f, 1.86746232e-02f, 1.84931401e-02f, 1.82420257e-02f, 1.79241672e-02f,
+  1.75431836e-02f, 1.71033591e-02f, 1.66095532e-02f, 1.60671193e-02f, 1.54818064e-02f, 1.48596559e-02f,
+  1.42069040e-02f, 1.35298707e-02f, 1.28348675e-02f, 1.21280979e-02f, 1.14155682e-02f, 1.07030086e-02f,
+  9.99580510e-03f, 9.29893553e-03f, 8.61692242e-03f, 7.95380119e-03f, 7.31308712e-03f, 6.69777161e-03f,
+  6.11031335e-03f, 5.55264764e-03f, 5.02620637e-03f, 4.53193905e-03f, 4.07034624e-03f, 3.64151527e-03f,
+  3.24516278e-03f, 2.88067572e-03f, 2.54715746e-03f, 2.24347250e-03f, 1.96829066e-03f, 1.72013009e-03f,
+  1.49739662e-03f, 1.29842223e-03f, 1.12149830e-03f, 9.64905485e-04f, 8.26940988e-04f, 7.05939950e-04f,
+  6.00294734e-04f, 5.08469471e-04f, 4.29011328e-04f, 3.60558857e-04f, 3.01847176e-04f, 2.51710648e-04f,
+  2.09083417e-04f, 1.79241672e-02f, 1.78891923e-02f, 1.77846793e-02f, 1.76118463e-02f, 1.73726976e-02f,
+  1.70699861e-02f, 1.67071596e-02f, 1.62882954e-02f, 1.58180222e-02f, 1.53014371e-02f, 1.47440173e-02f,
+  1.41515164e-02f, 1.35298707e-02f, 1.28851021e-02f, 1.22232195e-02f, 1.15501313e-02f, 1.08715566e-02f,
+  1.01929549e-02f, 9.51945316e-03f, 8.85579269e-03f, 8.20628181e-03f, 7.57476082e-03f, 6.96458062e-03f,
+  6.37858827e-03f, 5.81912510e-03f, 5.28803514e-03f, 4.78668185e-03f, 4.31596860e-03f, 3.87637294e-03f,
+  3.46797821e-03f, 3.09051387e-03f, 2.74339668e-03f, 2.42577214e-03f, 2.13655946e-03f, 1.87449146e-03f,
+  1.63815694e-03f, 1.42603787e-03f, 1.23654574e-03f, 1.06805307e-03f, 9.18922771e-04f, 7.87532947e-04f,
+  6.72298251e-04f, 5.71687589e-04f, 4.84238262e-04f, 4.08566702e-04f, 3.43376334e-04f, 2.87462579e-04f,
+  2.39715315e-04f, 1.99119502e-04f, 1.70034375e-02f, 1.69702601e-02f, 1.68711152e-02f, 1.67071596e-02f,
+  1.64802969e-02f, 1.61931347e-02f, 1.58489458e-02f, 1.54515980e-02f, 1.50054805e-02f, 1.45154325e-02f,
+  1.39866462e-02f, 1.34245809e-02f, 1.28348675e-02f, 1.22232195e-02f, 1.15953367e-02f, 1.09568229e-02f,
+  1.03131058e-02f, 9.66936257e-03f, 9.03045759e-03f, 8.40088818e-03f, 7.78474100e-03f, 7.18566030e-03f,
+  6.60682376e-03f, 6.05093269e-03f, 5.52020781e-03f, 5.01639908e-03f, 4.54079919e-03f, 4.09426587e-03f,
+  3.67725128e-03f, 3.28983506e-03f, 2.93176039e-03f, 2.60247360e-03f, 2.30116490e-03f, 2.02680845e-03f,
+  1.77820248e-03f, 1.55400799e-03f, 1.35278516e-03f, 1.17302674e-03f, 1.01318920e-03f, 8.71719501e-04f,
+  7.47078913e-04f, 6.37763587e-04f, 5.42321126e-04f, 4.59363888e-04f, 3.87579435e-04f, 3.25737783e-04f,
+  2.72696197e-04f, 2.27401615e-04f, 1.88891121e-04f, 1.60671193e-02f, 1.60357691e-02f, 1.59420837e-02f,
+  1.57871563e-02f, 1.55727863e-02f, 1.53014371e-02f, 1.49762016e-02f, 1.46007333e-02f, 1.41791832e-02f,
+  1.37161203e-02f, 1.32164517e-02f, 1.26853371e-02f, 1.21280979e-02f, 1.15501313e-02f, 1.09568229e-02f,
+  1.03534702e-02f, 9.74520016e-03f, 9.13690589e-03f, 8.53318255e-03f, 7.93828070e-03f, 7.35606300e-03f,
+  6.78997161e-03f, 6.24300959e-03f, 5.71772922e-03f, 5.21622971e-03f, 4.74016415e-03f, 4.29075351e-03f,
+  3.86880920e-03f, 3.47475824e-03f, 3.10867559e-03f, 2.77031888e-03f, 2.45916471e-03f, 2.17444822e-03f,
+  1.91519945e-03f, 1.68028323e-03f, 1.46843435e-03f, 1.27829215e-03f, 1.10843242e-03f, 9.57396580e-04f,
+  8.23717040e-04f, 7.05939950e-04f, 6.02644228e-04f, 5.12457453e-04f, 4.34068381e-04f, 3.66236811e-04f,
+  3.07800568e-04f, 2.57679785e-04f, 2.14879430e-04f, 1.78489572e-04f, 1.51231699e-02f, 1.50936618e-02f,
+  1.50054805e-02f, 1.48596559e-02f, 1.46578792e-02f, 1.44024724e-02f, 1.40963448e-02f, 1.37429349e-02f,
+  1.33461505e-02f, 1.29102934e-02f, 1.24399802e-02f, 1.19400695e-02f, 1.14155682e-02f, 1.08715566e-02f,
+  1.03131058e-02f, 9.74520016e-03f, 9.17266682e-03f, 8.60010926e-03f, 8.03185534e-03f, 7.47190416e-03f,
+  6.92389207e-03f, 6.39105868e-03f, 5.87623054e-03f, 5.38181094e-03f, 4.90977475e-03f, 4.46167774e-03f,
+  4.03867057e-03f, 3.64151527e-03f, 3.27061489e-03f, 2.92603974e-03f, 2.60756165e-03f, 2.31468794e-03f,
+  2.04669847e-03f, 1.80268078e-03f, 1.58156606e-03f, 1.38216338e-03f, 1.20319205e-03f, 1.04331167e-03f,
+  9.01149178e-04f, 7.75323366e-04f, 6.64465711e-04f, 5.67238661e-04f, 4.82350384e-04f, 4.08566702e-04f,
+  3.44720291e-04f, 2.89717165e-04f, 2.42541006e-04f, 2.02255178e-04f, 1.68003244e-04f, 1.41791832e-02f,
+  1.41515164e-02f, 1.40688401e-02f, 1.39321173e-02f, 1.37429349e-02f, 1.35034714e-02f, 1.32164517e-02f,
+  1.28851021e-02f, 1.25130853e-02f, 1.21044330e-02f, 1.16634779e-02f, 1.11947712e-02f, 1.07030086e-02f,
+  1.01929549e-02f, 9.66936257e-03f, 9.13690589e-03f, 8.60010926e-03f, 8.06329120e-03f, 7.53050717e-03f,
+  7.00550852e-03f, 6.49170298e-03f, 5.99212898e-03f, 5.50943660e-03f, 5.04587870e-03f, 4.60330676e-03f,
+  4.18318016e-03f, 3.78657691e-03f, 3.41421226e-03f, 3.06646340e-03f, 2.74339668e-03f, 2.44479766e-03f,
+  2.17020535e-03f, 1.91894372e-03f, 1.69015757e-03f, 1.48284482e-03f, 1.29588880e-03f, 1.12808880e-03f,
+  9.78188124e-04f, 8.44899507e-04f, 7.26927712e-04f, 6.22989843e-04f, 5.31831698e-04f, 4.52242122e-04f,
+  3.83063976e-04f, 3.23202868e-04f, 2.71633035e-04f, 2.27401615e-04f, 1.89630431e-04f, 1.57516493e-04f,
+  1.32422904e-02f, 1.32164517e-02f, 1.31392376e-02f, 1.30115496e-02f, 1.28348675e-02f, 1.26112262e-02f,
+  1.23431720e-02f, 1.20337158e-02f, 1.16862804e-02f, 1.13046300e-02f, 1.08928112e-02f, 1.04550738e-02f,
+  9.99580510e-03f, 9.51945316e-03f, 9.03045759e-03f, 8.53318255e-03f, 8.03185534e-03f, 7.53050717e-03f,
+  7.03292713e-03f, 6.54261792e-03f, 6.06276235e-03f, 5.59619768e-03f, 5.14539937e-03f, 4.71247081e-03f,
+  4.29914240e-03f, 3.90677573e-03f, 3.53637803e-03f, 3.18861729e-03f, 2.86384602e-03f, 2.56212614e-03f,
+  2.28325720e-03f, 2.02680845e-03f, 1.79214915e-03f, 1.57848001e-03f, 1.38486549e-03f, 1.21026265e-03f,
+  1.05355016e-03f, 9.13554162e-04f, 7.89072597e-04f, 6.78895798e-04f, 5.81825618e-04f, 4.96690802e-04f,
+  4.22360114e-04f, 3.57752957e-04f, 3.01847176e-04f, 2.53684819e-04f, 2.12376006e-04f, 1.77100548e-04f,
+  1.47108556e-04f, 1.23190880e-02f, 1.22950505e-02f, 1.22232195e-02f, 1.21044330e-02f, 1.19400695e-02f,
+  1.17320195e-02f, 1.14826523e-02f, 1.11947712e-02f, 1.08715566e-02f, 1.05165141e-02f, 1.01334052e-02f,
+  9.72618535e-03f, 9.29893553e-03f, 8.85579269e-03f, 8.40088818e-03f, 7.93828070e-03f, 7.47190416e-03f,
+  7.00550852e-03f, 6.54261792e-03f, 6.08649151e-03f, 5.64008951e-03f, 5.20605175e-03f, 4.78668185e-03f,
+  4.38393513e-03f, 3.99942230e-03f, 3.63440998e-03f, 3.28983506e-03f, 2.96631898e-03f, 2.66418955e-03f,
+  2.38350430e-03f, 2.12407717e-03f, 1.88550702e-03f, 1.66720722e-03f, 1.46843435e-03f, 1.28831784e-03f,
+  1.12588773e-03f, 9.80100594e-04f, 8.49864620e-04f, 7.34061410e-04f, 6.31565752e-04f, 5.41262911e-04f,
+  4.62063384e-04f, 3.92914750e-04f, 3.32811760e-04f, 2.80803506e-04f, 2.35998872e-04f, 1.97569942e-04f,
+  1.64753772e-04f, 1.36852701e-04f, 1.14155682e-02f, 1.13932937e-02f, 1.13267312e-02f, 1.12166572e-02f,
+  1.10643478e-02f, 1.08715566e-02f, 1.06404796e-02f, 1.03737116e-02f, 1.00742029e-02f, 9.74520016e-03f,
+  9.39019024e-03f, 9.01283696e-03f, 8.61692242e-03f, 8.20628181e-03f, 7.78474100e-03f, 7.35606300e-03f,
+  6.92389207e-03f, 6.49170298e-03f, 6.06276235e-03f, 5.64008951e-03f, 5.22642769e-03f, 4.82422393e-03f,
+  4.43561189e-03f, 4.06240392e-03f, 3.70609225e-03f, 3.36785126e-03f, 3.04854824e-03f, 2.74875993e-03f,
+  2.46878969e-03f, 2.20869062e-03f, 1.96829066e-03f, 1.74721819e-03f, 1.54492911e-03f, 1.36073492e-03f,
+  1.19382865e-03f, 1.04331167e-03f, 9.08216985e-04f, 7.87532947e-04f, 6.80223107e-04f, 5.85244794e-04f,
+  5.01565053e-04f, 4.28174215e-04f, 3.64097185e-04f, 3.08402319e-04f, 2.60208530e-04f, 2.18689995e-04f,
+  1.83079552e-04f, 1.52670225e-04f, 1.26815503e-04f, 1.05370739e-02f, 1.05165141e-02f, 1.04550738e-02f,
+  1.03534702e-02f, 1.02128824e-02f, 1.00349281e-02f, 9.82163288e-03f, 9.57539491e-03f, 9.29893553e-03f,
+  8.99525080e-03f, 8.66756029e-03f, 8.31924751e-03f, 7.95380119e-03f, 7.57476082e-03f, 7.18566030e-03f,
+  6.78997161e-03f, 6.39105868e-03f, 5.99212898e-03f, 5.59619768e-03f, 5.20605175e-03f, 4.82422393e-03f,
+  4.45297221e-03f, 4.09426587e-03f, 3.74977849e-03f, 3.42088705e-03f, 3.10867559e-03f, 2.81394506e-03f,
+  2.53722700e-03f, 2.27880199e-03f, 2.03871913e-03f, 1.81681942e-03f, 1.61275966e-03f, 1.42603787e-03f,
+  1.25601853e-03f, 1.10195670e-03f, 9.63022758e-04f, 8.38324428e-04f, 7.26927712e-04f, 6.27875968e-04f,
+  5.40206791e-04f, 4.62966709e-04f, 3.95223760e-04f, 3.36077792e-04f, 2.84668989e-04f, 2.40183974e-04f,
+  2.01860545e-04f, 1.68990533e-04f, 1.40921373e-04f, 1.17056319e-04f, 9.68826655e-03f, 9.66936257e-03f,
+  9.61287227e-03f, 9.51945316e-03f, 9.39019024e-03f, 9.22656991e-03f, 9.03045759e-03f, 8.80405493e-03f,
+  8.54986534e-03f, 8.27064458e-03f, 7.96935055e-03f, 7.64909526e-03f, 7.31308712e-03f, 6.96458062e-03f,
+  6.60682376e-03f, 6.24300959e-03f, 5.87623054e-03f, 5.50943660e-03f, 5.14539937e-03f, 4.78668185e-03f,
+  4.43561189e-03f, 4.09426587e-03f, 3.76445474e-03f, 3.44771752e-03f, 3.14531964e-03f, 2.85825809e-03f,
+  2.58726929e-03f, 2.33284221e-03f, 2.09523458e-03f, 1.87449146e-03f, 1.67046662e-03f, 1.48284482e-03f,
+  1.31116435e-03f, 1.15484069e-03f, 1.01318920e-03f, 8.85447080e-04f, 7.70793704e-04f, 6.68370514e-04f,
+  5.77297818e-04f, 4.96690802e-04f, 4.25672741e-04f, 3.63386731e-04f, 3.09005263e-04f, 2.61737645e-04f,
+  2.20836097e-04f, 1.85599783e-04f, 1.55377609e-04f, 1.29569540e-04f, 1.07626918e-04f, 8.87310598e-03f,
+  8.85579269e-03f, 8.80405493e-03f, 8.71849619e-03f, 8.60010926e-03f, 8.45025666e-03f, 8.27064458e-03f,
+  8.06329120e-03f, 7.83048850e-03f, 7.57476082e-03f, 7.29881786e-03f, 7.00550852e-03f, 6.69777161e-03f,
+  6.37858827e-03f, 6.05093269e-03f, 5.71772922e-03f, 5.38181094e-03f, 5.04587870e-03f, 4.71247081e-03f,
+  4.38393513e-03f, 4.06240392e-03f, 3.74977849e-03f, 3.44771752e-03f, 3.15763010e-03f, 2.88067572e-03f,
+  2.61776731e-03f, 2.36957916e-03f, 2.13655946e-03f, 1.91894372e-03f, 1.71677372e-03f, 1.52991537e-03f,
+  1.35807972e-03f, 1.20084430e-03f, 1.05767359e-03f, 9.27940535e-04f, 8.10946454e-04f, 7.05939950e-04f,
+  6.12134521e-04f, 5.28724573e-04f, 4.54899739e-04f, 3.89857072e-04f, 3.32811760e-04f, 2.83005880e-04f,
+  2.39715315e-04f, 2.02255178e-04f, 1.69983614e-04f, 1.42304300e-04f, 1.18667689e-04f, 9.85713050e-05f,
+  8.09485000e-03f, 8.07905477e-03f, 8.03185534e-03f, 7.95380119e-03f, 7.84579758e-03f, 7.70908827e-03f,
+  7.54522951e-03f, 7.35606300e-03f, 7.14368001e-03f, 6.91038184e-03f, 6.65864162e-03f, 6.39105868e-03f,
+  6.11031335e-03f, 5.81912510e-03f, 5.52020781e-03f, 5.21622971e-03f, 4.90977475e-03f, 4.60330676e-03f,
+  4.29914240e-03f, 3.99942230e-03f, 3.70609225e-03f, 3.42088705e-03f, 3.14531964e-03f, 2.88067572e-03f,
+  2.62801303e-03f, 2.38816417e-03f, 2.16174452e-03f, 1.94916269e-03f, 1.75063405e-03f, 1.56619621e-03f,
+  1.39572716e-03f, 1.23896322e-03f, 1.09551882e-03f, 9.64905485e-04f, 8.46551324e-04f, 7.39818730e-04f,
+  6.44022250e-04f, 5.58444473e-04f, 4.82350384e-04f, 4.15000686e-04f, 3.55662865e-04f, 3.03620996e-04f,
+  2.58183572e-04f, 2.18689995e-04f, 1.84515462e-04f, 1.55074420e-04f, 1.29822845e-04f, 1.08259395e-04f,
+  8.99256556e-05f, 7.35606300e-03f, 7.34170992e-03f, 7.29881786e-03f, 7.22788740e-03f, 7.12974090e-03f,
+  7.00550852e-03f, 6.85660494e-03f, 6.68470282e-03f, 6.49170298e-03f, 6.27969718e-03f, 6.05093269e-03f,
+  5.80777042e-03f, 5.55264764e-03f, 5.28803514e-03f, 5.01639908e-03f, 4.74016415e-03f, 4.46167774e-03f,
+  4.18318016e-03f, 3.90677573e-03f, 3.63440998e-03f, 3.36785126e-03f, 3.10867559e-03f, 2.85825809e-03f,
+  2.61776731e-03f, 2.38816417e-03f, 2.17020535e-03f, 1.96445012e-03f, 1.77126995e-03f, 1.59086019e-03f,
+  1.42325542e-03f, 1.26834435e-03f, 1.12588773e-03f, 9.95534938e-04f, 8.76842183e-04f, 7.69289734e-04f,
+  6.72298251e-04f, 5.85244794e-04f, 5.07477322e-04f, 4.38328076e-04f, 3.77125136e-04f, 3.23202868e-04f,
+  2.75910628e-04f, 2.34620122e-04f, 1.98730981e-04f, 1.67675433e-04f, 1.40921373e-04f, 1.17974399e-04f,
+  9.83789723e-05f, 8.17184773e-05f, 6.65864162e-03f, 6.64564921e-03f, 6.60682376e-03f, 6.54261792e-03f,
+  6.45377673e-03f, 6.34132279e-03f, 6.20653667e-03f, 6.05093269e-03f, 5.87623054e-03f, 5.68432501e-03f,
+  5.47724916e-03f, 5.25714131e-03f, 5.02620637e-03f, 4.78668185e-03f, 4.54079919e-03f, 4.29075351e-03f,
+  4.03867057e-03f, 3.78657691e-03f, 3.53637803e-03f, 3.28983506e-03f, 3.04854824e-03f, 2.81394506e-03f,
+  2.58726929e-03f, 2.36957916e-03f, 2.16174452e-03f, 1.96445012e-03f, 1.77820248e-03f, 1.60333747e-03f,
+  1.44003227e-03f, 1.28831784e-03f, 1.14809384e-03f, 1.01914338e-03f, 9.01149178e-04f, 7.93709594e-04f,
+  6.96354080e-04f, 6.08558301e-04f, 5.29758283e-04f, 4.59363888e-04f, 3.96770600e-04f, 3.41370265e-04f,
+  2.92560289e-04f, 2.49751814e-04f, 2.12376006e-04f, 1.79889481e-04f, 1.51778280e-04f, 1.27560750e-04f,
+  1.06789361e-04f, 8.90517549e-05f, 7.39708266e-05f, 6.00384362e-03f, 5.99212898e-03f, 5.95712150e-03f,
+  5.89922955e-03f, 5.81912510e-03f, 5.71772922e-03f, 5.59619768e-03f, 5.45589533e-03f, 5.29837376e-03f,
+  5.12533961e-03f, 4.93862713e-03f, 4.74016415e-03f, 4.53193905e-03f, 4.31596860e-03f, 4.09426587e-03f,
+  3.86880920e-03f, 3.64151527e-03f, 3.41421226e-03f, 3.18861729e-03f, 2.96631898e-03f, 2.74875993e-03f,
+  2.53722700e-03f, 2.33284221e-03f, 2.13655946e-03f, 1.94916269e-03f, 1.77126995e-03f, 1.60333747e-03f,
+  1.44566840e-03f, 1.29842223e-03f, 1.16162724e-03f, 1.03519252e-03f, 9.18922771e-04f, 8.12531915e-04f,
+  7.15657778e-04f, 6.27875968e-04f, 5.48713841e-04f, 4.77662863e-04f, 4.14190930e-04f, 3.57752957e-04f,
+  3.07800568e-04f, 2.63790484e-04f, 2.25191703e-04f, 1.91491359e-04f, 1.62199503e-04f, 1.36852701e-04f,
+  1.15016664e-04f, 9.62878985e-05f, 8.02945724e-05f, 6.66966807e-05f, 5.39233256e-03f, 5.38181094e-03f,
+  5.35036903e-03f, 5.29837376e-03f, 5.22642769e-03f, 5.13535971e-03f, 5.02620637e-03f, 4.90019470e-03f,
+  4.75871656e-03f, 4.60330676e-03f, 4.43561189e-03f, 4.25736280e-03f, 4.07034624e-03f, 3.87637294e-03f,
+  3.67725128e-03f, 3.47475824e-03f, 3.27061489e-03f, 3.06646340e-03f, 2.86384602e-03f, 2.66418955e-03f,
+  2.46878969e-03f, 2.27880199e-03f, 2.09523458e-03f, 1.91894372e-03f, 1.75063405e-03f, 1.59086019e-03f,
+  1.44003227e-03f, 1.29842223e-03f, 1.16617372e-03f, 1.04331167e-03f, 9.29754693e-04f, 8.25327414e-04f,
+  7.29772844e-04f, 6.42765663e-04f, 5.63924725e-04f, 4.92825522e-04f, 4.29011328e-04f, 3.72004200e-04f,
+  3.21314641e-04f, 2.76450068e-04f, 2.36922555e-04f, 2.02255178e-04f, 1.71987325e-04f, 1.45678947e-04f,
+  1.22913800e-04f, 1.03301842e-04f, 8.64806570e-05f, 7.21163087e-05f, 5.99034029e-05f, 4.82422393e-03f,
+  4.81481105e-03f, 4.78668185e-03f, 4.74016415e-03f, 4.67579812e-03f, 4.59432462e-03f, 4.49667126e-03f,
+  4.38393513e-03f, 4.25736280e-03f, 4.11832612e-03f, 3.96829844e-03f, 3.80882900e-03f, 3.64151527e-03f,
+  3.46797821e-03f, 3.28983506e-03f, 3.10867559e-03f, 2.92603974e-03f, 2.74339668e-03f, 2.56212614e-03f,
+  2.38350430e-03f, 2.20869062e-03f, 2.03871913e-03f, 1.87449146e-03f, 1.71677372e-03f, 1.56619621e-03f,
+  1.42325542e-03f, 1.28831784e-03f, 1.16162724e-03f, 1.04331167e-03f, 9.33393661e-04f, 8.31800513e-04f,
+  7.38375180e-04f, 6.52887742e-04f, 5.75047161e-04f, 5.04512514e-04f, 4.40903939e-04f, 3.83812905e-04f,
+  3.32811760e-04f, 2.87462579e-04f, 2.47324700e-04f, 2.11961611e-04f, 1.80946619e-04f, 1.53867630e-04f,
+  1.30330955e-04f, 1.09964232e-04f, 9.24184860e-05f, 7.73694992e-05f, 6.45185064e-05f, 5.35922882e-05f,
+  4.29914240e-03f, 4.29075351e-03f, 4.26568603e-03f, 4.22423193e-03f, 4.16687131e-03f, 4.09426587e-03f,
+  4.00724122e-03f, 3.90677573e-03f, 3.79397976e-03f, 3.67007614e-03f, 3.53637803e-03f, 3.39426543e-03f,
+  3.24516278e-03f, 3.09051387e-03f, 2.93176039e-03f, 2.77031888e-03f, 2.60756165e-03f, 2.44479766e-03f,
+  2.28325720e-03f, 2.12407717e-03f, 1.96829066e-03f, 1.81681942e-03f, 1.67046662e-03f, 1.52991537e-03f,
+  1.39572716e-03f, 1.26834435e-03f, 1.14809384e-03f, 1.03519252e-03f, 9.29754693e-04f, 8.31800513e-04f,
+  7.41265074e-04f, 6.58008386e-04f, 5.81825618e-04f, 5.12457453e-04f, 4.49599989e-04f, 3.92914750e-04f,
+  3.42037645e-04f, 2.96587619e-04f, 2.56174360e-04f, 2.20405200e-04f, 1.88891121e-04f, 1.61251897e-04f,
+  1.37120252e-04f, 1.16145377e-04f, 9.79954275e-05f, 8.23594091e-05f, 6.89483932e-05f, 5.74961305e-05f,
+  4.77591566e-05f, 3.81627539e-03f, 3.80882900e-03f, 3.78657691e-03f, 3.74977849e-03f, 3.69886076e-03f,
+  3.63440998e-03f, 3.55715980e-03f, 3.46797821e-03f, 3.36785126e-03f, 3.25786392e-03f, 3.13918246e-03f,
+  3.01303179e-03f, 2.88067572e-03f, 2.74339668e-03f, 2.60247360e-03f, 2.45916471e-03f, 2.31468794e-03f,
+  2.17020535e-03f, 2.02680845e-03f, 1.88550702e-03f, 1.74721819e-03f, 1.61275966e-03f, 1.48284482e-03f,
+  1.35807972e-03f, 1.23896322e-03f, 1.12588773e-03f, 1.01914338e-03f, 9.18922771e-04f, 8.25327414e-04f,
+  7.38375180e-04f, 6.58008386e-04f, 5.84102818e-04f, 5.16476692e-04f, 4.54899739e-04f, 3.99102253e-04f,
+  3.48783738e-04f, 3.03620996e-04f, 2.63275782e-04f, 2.27401615e-04f, 1.95649947e-04f, 1.67675433e-04f,
+  1.43140554e-04f, 1.21719313e-04f, 1.03100276e-04f, 8.69888681e-05f, 7.31090404e-05f, 6.12043150e-05f,
+  5.10383361e-05f, 4.23949896e-05f, 3.37443547e-03f, 3.36785126e-03f, 3.34817544e-03f, 3.31563735e-03f,
+  3.27061489e-03f, 3.21362610e-03f, 3.14531964e-03f, 3.06646340e-03f, 2.97792885e-03f, 2.88067572e-03f,
+  2.77573476e-03f, 2.66418955e-03f, 2.54715746e-03f, 2.42577214e-03f, 2.30116490e-03f, 2.17444822e-03f,
+  2.04669847e-03f, 1.91894372e-03f, 1.79214915e-03f, 1.66720722e-03f, 1.54492911e-03f, 1.42603787e-03f,
+  1.31116435e-03f, 1.20084430e-03f, 1.09551882e-03f, 9.95534938e-04f, 9.01149178e-04f, 8.12531915e-04f,
+  7.29772844e-04f, 6.52887742e-04f, 5.81825618e-04f, 5.16476692e-04f, 4.56680165e-04f, 4.02232457e-04f,
+  3.52895091e-04f, 3.08402319e-04f, 2.68468430e-04f, 2.32794293e-04f, 2.01073562e-04f, 1.72998029e-04f,
+  1.48262348e-04f, 1.26568062e-04f, 1.07626918e-04f, 9.11635507e-05f, 7.69174876e-05f, 6.46446424e-05f,
+  5.41182126e-05f, 4.51292326e-05f, 3.74865922e-05f, 2.97211809e-03f, 2.96631898e-03f, 2.94898893e-03f,
+  2.92033050e-03f, 2.88067572e-03f, 2.83048139e-03f, 2.77031888e-03f, 2.70086410e-03f, 2.62288516e-03f,
+  2.53722700e-03f, 2.44479766e-03f, 2.34655151e-03f, 2.24347250e-03f, 2.13655946e-03f, 2.02680845e-03f,
+  1.91519945e-03f, 1.80268078e-03f, 1.69015757e-03f, 1.57848001e-03f, 1.46843435e-03f, 1.36073492e-03f,
+  1.25601853e-03f, 1.15484069e-03f, 1.05767359e-03f, 9.64905485e-04f, 8.76842183e-04f, 7.93709594e-04f,
+  7.15657778e-04f, 6.42765663e-04f, 5.75047161e-04f, 5.12457453e-04f, 4.54899739e-04f, 4.02232457e-04f,
+  3.54276272e-04f, 3.10821168e-04f, 2.71633035e-04f, 2.36460270e-04f, 2.05039381e-04f, 1.77100548e-04f,
+  1.52372333e-04f, 1.30585759e-04f, 1.11477973e-04f, 9.47950975e-05f, 8.02945724e-05f, 6.77470016e-05f,
+  5.69373806e-05f, 4.76659661e-05f, 3.97486983e-05f, 3.30172516e-05f, 2.60756165e-03f, 2.60247360e-03f,
+  2.58726929e-03f, 2.56212614e-03f, 2.52733543e-03f, 2.48329761e-03f, 2.43051467e-03f, 2.36957916e-03f,
+  2.30116490e-03f, 2.22601369e-03f, 2.14492157e-03f, 2.05872604e-03f, 1.96829066e-03f, 1.87449146e-03f,
+  1.77820248e-03f, 1.68028323e-03f, 1.58156606e-03f, 1.48284482e-03f, 1.38486549e-03f, 1.28831784e-03f,
+  1.19382865e-03f, 1.10195670e-03f, 1.01318920e-03f, 9.27940535e-04f, 8.46551324e-04f, 7.69289734e-04f,
+  6.96354080e-04f, 6.27875968e-04f, 5.63924725e-04f, 5.04512514e-04f, 4.49599989e-04f, 3.99102253e-04f,
+  3.52895091e-04f, 3.10821168e-04f, 2.72696197e-04f, 2.38314838e-04f, 2.07456324e-04f, 1.79889481e-04f,
+  1.55377609e-04f, 1.33682508e-04f, 1.14568262e-04f, 9.78042153e-05f, 8.31676371e-05f, 7.04457343e-05f,
+  5.94372286e-05f, 4.99535054e-05f, 4.18193158e-05f, 3.48731664e-05f, 2.89673917e-05f, 2.27880199e-03f,
+  2.27435562e-03f, 2.26106821e-03f, 2.23909505e-03f, 2.20869062e-03f, 2.17020535e-03f, 2.12407717e-03f,
+  2.07082438e-03f, 2.01103580e-03f, 1.94535952e-03f, 1.87449146e-03f, 1.79916341e-03f, 1.72013009e-03f,
+  1.63815694e-03f, 1.55400799e-03f, 1.46843435e-03f, 1.38216338e-03f, 1.29588880e-03f, 1.21026265e-03f,
+  1.12588773e-03f, 1.04331167e-03f, 9.63022758e-04f, 8.85447080e-04f, 8.10946454e-04f, 7.39818730e-04f,
+  6.72298251e-04f, 6.08558301e-04f, 5.48713841e-04f, 4.92825522e-04f, 4.40903939e-04f, 3.92914750e-04f,
+  3.48783738e-04f, 3.08402319e-04f, 2.71633035e-04f, 2.38314838e-04f, 2.08268277e-04f, 1.81300376e-04f,
+  1.57209142e-04f, 1.35787704e-04f, 1.16827920e-04f, 1.00123572e-04f, 8.54731261e-05f, 7.26819198e-05f,
+  6.15639874e-05f, 5.19434252e-05f, 4.36554037e-05f, 3.65467640e-05f, 3.04763835e-05f, 2.53152048e-05f,
+  1.98372826e-03f, 1.97985745e-03f, 1.96829066e-03f, 1.94916269e-03f, 1.92269532e-03f, 1.88919331e-03f,
+  1.84903806e-03f, 1.80268078e-03f, 1.75063405e-03f, 1.69346191e-03f, 1.63177028e-03f, 1.56619621e-03f,
+  1.49739662e-03f, 1.42603787e-03f, 1.35278516e-03f, 1.27829215e-03f, 1.20319205e-03f, 1.12808880e-03f,
+  1.05355016e-03f, 9.80100594e-04f, 9.08216985e-04f, 8.38324428e-04f, 7.70793704e-04f, 7.05939950e-04f,
+  6.44022250e-04f, 5.85244794e-04f, 5.29758283e-04f, 4.77662863e-04f, 4.29011328e-04f, 3.83812905e-04f,
+  3.42037645e-04f, 3.03620996e-04f, 2.68468430e-04f, 2.36460270e-04f, 2.07456324e-04f, 1.81300376e-04f,
+  1.57824441e-04f, 1.36852701e-04f, 1.18205047e-04f, 1.01700294e-04f, 8.71589364e-05f, 7.44055214e-05f,
+  6.32705996e-05f, 5.35922882e-05f, 4.52174609e-05f, 3.80026213e-05f, 3.18144557e-05f, 2.65301060e-05f,
+  2.20372294e-05f, 1.72013009e-03f, 1.71677372e-03f, 1.70674385e-03f, 1.69015757e-03f, 1.66720722e-03f,
+  1.63815694e-03f, 1.60333747e-03f, 1.56314019e-03f, 1.51800946e-03f, 1.46843435e-03f, 1.41494034e-03f,
+  1.35807972e-03f, 1.29842223e-03f, 1.23654574e-03f, 1.17302674e-03f, 1.10843242e-03f, 1.04331167e-03f,
+  9.78188124e-04f, 9.13554162e-04f, 8.49864620e-04f, 7.87532947e-04f, 7.26927712e-04f, 6.68370514e-04f,
+  6.12134521e-04f, 5.58444473e-04f, 5.07477322e-04f, 4.59363888e-04f, 4.14190930e-04f, 3.72004200e-04f,
+  3.32811760e-04f, 2.96587619e-04f, 2.63275782e-04f, 2.32794293e-04f, 2.05039381e-04f, 1.79889481e-04f,
+  1.57209142e-04f, 1.36852701e-04f, 1.18667689e-04f, 1.02497936e-04f, 8.81863380e-05f, 7.55772417e-05f,
+  6.45185064e-05f, 5.48631942e-05f, 4.64709337e-05f, 3.92089569e-05f, 3.29528266e-05f, 2.75869461e-05f,
+  2.30047808e-05f, 1.91089184e-05f, 1.48574379e-03f, 1.48284482e-03f, 1.47418166e-03f, 1.45985547e-03f,
+  1.44003227e-03f, 1.41494034e-03f, 1.38486549e-03f, 1.35014555e-03f, 1.31116435e-03f, 1.26834435e-03f,
+  1.22213946e-03f, 1.17302674e-03f, 1.12149830e-03f, 1.06805307e-03f, 1.01318920e-03f, 9.57396580e-04f,
+  9.01149178e-04f, 8.44899507e-04f, 7.89072597e-04f, 7.34061410e-04f, 6.80223107e-04f, 6.27875968e-04f,
+  5.77297818e-04f, 5.28724573e-04f, 4.82350384e-04f, 4.38328076e-04f, 3.96770600e-04f, 3.57752957e-04f,
+  3.21314641e-04f, 2.87462579e-04f, 2.56174360e-04f, 2.27401615e-04f, 2.01073562e-04f, 1.77100548e-04f,
+  1.55377609e-04f, 1.35787704e-04f, 1.18205047e-04f, 1.02497936e-04f, 8.85314876e-05f, 7.61699994e-05f,
+  6.52790259e-05f, 5.57271633e-05f, 4.73874898e-05f, 4.01387697e-05f, 3.38663122e-05f, 2.84626494e-05f,
+  2.38279263e-05f, 1.98701309e-05f, 1.65051224e-05f, 1.27829215e-03f, 1.27579784e-03f, 1.26834435e-03f,
+  1.25601853e-03f, 1.23896322e-03f, 1.21737481e-03f, 1.19149929e-03f, 1.16162724e-03f, 1.12808880e-03f,
+  1.09124777e-03f, 1.05149439e-03f, 1.00923923e-03f, 9.64905485e-04f, 9.18922771e-04f, 8.71719501e-04f,
+  8.23717040e-04f, 7.75323366e-04f, 7.26927712e-04f, 6.78895798e-04f, 6.31565752e-04f, 5.85244794e-04f,
+  5.40206791e-04f, 4.96690802e-04f, 4.54899739e-04f, 4.15000686e-04f, 3.77125136e-04f, 3.41370265e-04f,
+  3.07800568e-04f, 2.76450068e-04f, 2.47324700e-04f, 2.20405200e-04f, 1.95649947e-04f, 1.72998029e-04f,
+  1.52372333e-04f, 1.33682508e-04f, 1.16827920e-04f, 1.01700294e-04f, 8.81863380e-05f, 7.61699994e-05f,
+  6.55345211e-05f, 5.61642373e-05f, 4.79460796e-05f, 4.07708612e-05f, 3.45342669e-05f, 2.91376218e-05f,
+  2.44884613e-05f, 2.05008764e-05f, 1.70957010e-05f, 1.42005429e-05f, 1.09551882e-03f, 1.09338120e-03f,
+  1.08699338e-03f, 1.07642985e-03f, 1.06181321e-03f, 1.04331167e-03f, 1.02113583e-03f, 9.95534938e-04f,
+  9.66791937e-04f, 9.35218472e-04f, 9.01149178e-04f, 8.64935690e-04f, 8.26940988e-04f, 7.87532947e-04f,
+  7.47078913e-04f, 7.05939950e-04f, 6.64465711e-04f, 6.22989843e-04f, 5.81825618e-04f, 5.41262911e-04f,
+  5.01565053e-04f, 4.62966709e-04f, 4.25672741e-04f, 3.89857072e-04f, 3.55662865e-04f, 3.23202868e-04f,
+  2.92560289e-04f, 2.63790484e-04f, 2.36922555e-04f, 2.11961611e-04f, 1.88891121e-04f, 1.67675433e-04f,
+  1.48262348e-04f, 1.30585759e-04f, 1.14568262e-04f, 1.00123572e-04f, 8.71589364e-05f, 7.55772417e-05f,
+  6.52790259e-05f, 5.61642373e-05f, 4.81337374e-05f, 4.10906323e-05f, 3.49413458e-05f, 2.95964728e-05f,
+  2.49714540e-05f, 2.09870414e-05f, 1.75696114e-05f, 1.46513166e-05f, 1.21701141e-05f, 9.35218472e-04f,
+  9.33393661e-04f, 9.27940535e-04f, 9.18922771e-04f, 9.06444853e-04f, 8.90650437e-04f, 8.71719501e-04f,
+  8.49864620e-04f, 8.25327414e-04f, 7.98373891e-04f, 7.69289734e-04f, 7.38375180e-04f, 7.05939950e-04f,
+  6.72298251e-04f, 6.37763587e-04f, 6.02644228e-04f, 5.67238661e-04f, 5.31831698e-04f, 4.96690802e-04f,
+  4.62063384e-04f, 4.28174215e-04f, 3.95223760e-04f, 3.63386731e-04f, 3.32811760e-04f, 3.03620996e-04f,
+  2.75910628e-04f, 2.49751814e-04f, 2.25191703e-04f, 2.02255178e-04f, 1.80946619e-04f, 1.61251897e-04f,
+  1.43140554e-04f, 1.26568062e-04f, 1.11477973e-04f, 9.78042153e-05f, 8.54731261e-05f, 7.44055214e-05f,
+  6.45185064e-05f, 5.57271633e-05f, 4.79460796e-05f, 4.10906323e-05f, 3.50781011e-05f, 2.98285995e-05f,
+  2.52658083e-05f, 2.13175390e-05f, 1.79161416e-05f, 1.49987618e-05f, 1.25074821e-05f, 1.03893390e-05f,
+  7.95261352e-04f, 7.93709594e-04f, 7.89072597e-04f, 7.81404320e-04f, 7.70793704e-04f, 7.57362985e-04f,
+  7.41265074e-04f, 7.22680823e-04f, 7.01815705e-04f, 6.78895798e-04f, 6.54164120e-04f, 6.27875968e-04f,
+  6.00294734e-04f, 5.71687589e-04f, 5.42321126e-04f, 5.12457453e-04f, 4.82350384e-04f, 4.52242122e-04f,
+  4.22360114e-04f, 3.92914750e-04f, 3.64097185e-04f, 3.36077792e-04f, 3.09005263e-04f, 2.83005880e-04f,
+  2.58183572e-04f, 2.34620122e-04f, 2.12376006e-04f, 1.91491359e-04f, 1.71987325e-04f, 1.53867630e-04f,
+  1.37120252e-04f, 1.21719313e-04f, 1.07626918e-04f, 9.47950975e-05f, 8.31676371e-05f, 7.26819198e-05f,
+  6.32705996e-05f, 5.48631942e-05f, 4.73874898e-05f, 4.07708612e-05f, 3.49413458e-05f, 2.98285995e-05f,
+  2.53646958e-05f, 2.14847350e-05f, 1.81273317e-05f, 1.52349585e-05f, 1.27541707e-05f, 1.06357147e-05f,
+  8.83455596e-06f, 6.73612580e-04f, 6.72298251e-04f, 6.68370514e-04f, 6.61875238e-04f, 6.52887742e-04f,
+  6.41511462e-04f, 6.27875968e-04f, 6.12134521e-04f, 5.94461046e-04f, 5.75047161e-04f, 5.54098631e-04f,
+  5.31831698e-04f, 5.08469471e-04f, 4.84238262e-04f, 4.59363888e-04f, 4.34068381e-04f, 4.08566702e-04f,
+  3.83063976e-04f, 3.57752957e-04f, 3.32811760e-04f, 3.08402319e-04f, 2.84668989e-04f, 2.61737645e-04f,
+  2.39715315e-04f, 2.18689995e-04f, 1.98730981e-04f, 1.79889481e-04f, 1.62199503e-04f, 1.45678947e-04f,
+  1.30330955e-04f, 1.16145377e-04f, 1.03100276e-04f, 9.11635507e-05f, 8.02945724e-05f, 7.04457343e-05f,
+  6.15639874e-05f, 5.35922882e-05f, 4.64709337e-05f, 4.01387697e-05f, 3.45342669e-05f, 2.95964728e-05f,
+  2.52658083e-05f, 2.14847350e-05f, 1.81982796e-05f, 1.53544479e-05f, 1.29045120e-05f, 1.08032027e-05f,
+  9.00880150e-06f, 7.48316006e-06f, 5.68347634e-04f, 5.67238661e-04f, 5.63924725e-04f, 5.58444473e-04f,
+  5.50861412e-04f, 5.41262911e-04f, 5.29758283e-04f, 5.16476692e-04f, 5.01565053e-04f, 4.85184952e-04f,
+  4.67510021e-04f, 4.48722742e-04f, 4.29011328e-04f, 4.08566702e-04f, 3.87579435e-04f, 3.66236811e-04f,
+  3.44720291e-04f, 3.23202868e-04f, 3.01847176e-04f, 2.80803506e-04f, 2.60208530e-04f, 2.40183974e-04f,
+  2.20836097e-04f, 2.02255178e-04f, 1.84515462e-04f, 1.67675433e-04f, 1.51778280e-04f, 1.36852701e-04f,
+  1.22913800e-04f, 1.09964232e-04f, 9.79954275e-05f, 8.69888681e-05f, 7.69174876e-05f, 6.77470016e-05f,
+  5.94372286e-05f, 5.19434252e-05f, 4.52174609e-05f, 3.92089569e-05f, 3.38663122e-05f, 2.91376218e-05f,
+  2.49714540e-05f, 2.13175390e-05f, 1.81273317e-05f, 1.53544479e-05f, 1.29550190e-05f, 1.08879340e-05f,
+  9.11499410e-06f, 7.60100284e-06f, 6.31377225e-06f, 4.77662863e-04f, 4.76730842e-04f, 4.73945664e-04f,
+  4.69339808e-04f, 4.62966709e-04f, 4.54899739e-04f, 4.45230748e-04f, 4.34068381e-04f, 4.21536010e-04f,
+  4.07769490e-04f, 3.92914750e-04f, 3.77125136e-04f, 3.60558857e-04f, 3.43376334e-04f, 3.25737783e-04f,
+  3.07800568e-04f, 2.89717165e-04f, 2.71633035e-04f, 2.53684819e-04f, 2.35998872e-04f, 2.18689995e-04f,
+  2.01860545e-04f, 1.85599783e-04f, 1.69983614e-04f, 1.55074420e-04f, 1.40921373e-04f, 1.27560750e-04f,
+  1.15016664e-04f, 1.03301842e-04f, 9.24184860e-05f, 8.23594091e-05f, 7.31090404e-05f, 6.46446424e-05f,
+  5.69373806e-05f, 4.99535054e-05f, 4.36554037e-05f, 3.80026213e-05f, 3.29528266e-05f, 2.84626494e-05f,
+  2.44884613e-05f, 2.09870414e-05f, 1.79161416e-05f, 1.52349585e-05f, 1.29045120e-05f, 1.08879340e-05f,
+  9.15066994e-06f, 7.66061839e-06f, 6.38819711e-06f, 5.30635498e-06f, 3.99882527e-04f, 3.99102253e-04f,
+  3.96770600e-04f, 3.92914750e-04f, 3.87579435e-04f, 3.80826037e-04f, 3.72731505e-04f, 3.63386731e-04f,
+  3.52895091e-04f, 3.41370265e-04f, 3.28934402e-04f, 3.15715879e-04f, 3.01847176e-04f, 2.87462579e-04f,
+  2.72696197e-04f, 2.57679785e-04f, 2.42541006e-04f, 2.27401615e-04f, 2.12376006e-04f, 1.97569942e-04f,
+  1.83079552e-04f, 1.68990533e-04f, 1.55377609e-04f, 1.42304300e-04f, 1.29822845e-04f, 1.17974399e-04f,
+  1.06789361e-04f, 9.62878985e-05f, 8.64806570e-05f, 7.73694992e-05f, 6.89483932e-05f, 6.12043150e-05f,
+  5.41182126e-05f, 4.76659661e-05f, 4.18193158e-05f, 3.65467640e-05f, 3.18144557e-05f, 2.75869461e-05f,
+  2.38279263e-05f, 2.05008764e-05f, 1.75696114e-05f, 1.49987618e-05f, 1.27541707e-05f, 1.08032027e-05f,
+  9.11499410e-06f, 7.66061839e-06f, 6.41319957e-06f, 5.34797346e-06f, 4.44229363e-06f, 3.33462434e-04f,
+  3.32811760e-04f, 3.30867391e-04f, 3.27652000e-04f, 3.23202868e-04f, 3.17571190e-04f, 3.10821168e-04f,
+  3.03028559e-04f, 2.94279540e-04f, 2.84668989e-04f, 2.74298713e-04f, 2.63275782e-04f, 2.51710648e-04f,
+  2.39715315e-04f, 2.27401615e-04f, 2.14879430e-04f, 2.02255178e-04f, 1.89630431e-04f, 1.77100548e-04f,
+  1.64753772e-04f, 1.52670225e-04f, 1.40921373e-04f, 1.29569540e-04f, 1.18667689e-04f, 1.08259395e-04f,
+  9.83789723e-05f, 8.90517549e-05f, 8.02945724e-05f, 7.21163087e-05f, 6.45185064e-05f, 5.74961305e-05f,
+  5.10383361e-05f, 4.51292326e-05f, 3.97486983e-05f, 3.48731664e-05f, 3.04763835e-05f, 2.65301060e-05f,
+  2.30047808e-05f, 1.98701309e-05f, 1.70957010e-05f, 1.46513166e-05f, 1.25074821e-05f, 1.06357147e-05f,
+  9.00880150e-06f, 7.60100284e-06f, 6.38819711e-06f, 5.34797346e-06f, 4.45967999e-06f, 3.70443286e-06f,
+  2.76990526e-04f, 2.76450068e-04f, 2.74834980e-04f, 2.72164092e-04f, 2.68468430e-04f, 2.63790484e-04f,
+  2.58183572e-04f, 2.51710648e-04f, 2.44443276e-04f, 2.36460270e-04f, 2.27846191e-04f, 2.18689995e-04f,
+  2.09083417e-04f, 1.99119502e-04f, 1.88891121e-04f, 1.78489572e-04f, 1.68003244e-04f, 1.57516493e-04f,
+  1.47108556e-04f, 1.36852701e-04f, 1.26815503e-04f, 1.17056319e-04f, 1.07626918e-04f, 9.85713050e-05f,
+  8.99256556e-05f, 8.17184773e-05f, 7.39708266e-05f, 6.66966807e-05f, 5.99034029e-05f, 5.35922882e-05f,
+  4.77591566e-05f, 4.23949896e-05f, 3.74865922e-05f, 3.30172516e-05f, 2.89673917e-05f, 2.53152048e-05f,
+  2.20372294e-05f, 1.91089184e-05f, 1.65051224e-05f, 1.42005429e-05f, 1.21701141e-05f, 1.03893390e-05f,
+  8.83455596e-06f, 7.48316006e-06f, 6.31377225e-06f, 5.30635498e-06f, 4.44229363e-06f, 3.70443286e-06f,
+  3.07708683e-06f
+};
+static const float kern_row_16[] = {
+  2.77665647e-04f, 3.34275188e-04f, 4.00857185e-04f, 4.78827104e-04f, 5.69732918e-04f, 6.75254443e-04f,
+  7.97199726e-04f, 9.37498000e-04f, 1.09818904e-03f, 1.28140778e-03f, 1.48936512e-03f, 1.72432268e-03f,
+  1.98856345e-03f, 2.28435639e-03f, 2.61391723e-03f, 2.97936238e-03f, 3.38266022e-03f, 3.82557698e-03f,
+  4.30962071e-03f, 4.83598234e-03f, 5.40547539e-03f, 6.01847749e-03f, 6.67487131e-03f, 7.37399282e-03f,
+  8.11458007e-03f, 8.89473315e-03f, 9.71188024e-03f, 1.05627570e-02f, 1.14433924e-02f, 1.23491138e-02f,
+  1.32745672e-02f, 1.42137427e-02f, 1.51600316e-02f, 1.61062814e-02f, 1.70448814e-02f, 1.79678556e-02f,
+  1.88669637e-02f, 1.97338276e-02f, 2.05600522e-02f, 2.13373564e-02f, 2.20577158e-02f, 2.27134973e-02f,
+  2.32975911e-02f, 2.38035396e-02f, 2.42256615e-02f, 2.45591458e-02f, 2.48001553e-02f, 2.49458961e-02f,
+  2.49946658e-02f, 2.49458961e-02f, 2.48001553e-02f, 2.45591458e-02f, 2.42256615e-02f, 2.38035396e-02f,
+  2.32975911e-02f, 2.27134973e-02f, 2.20577158e-02f, 2.13373564e-02f, 2.05600522e-02f, 1.97338276e-02f,
+  1.88669637e-02f, 1.79678556e-02f, 1.70448814e-02f, 1.61062814e-02f, 1.51600316e-02f, 1.42137427e-02f,
+  1.32745672e-02f, 1.23491138e-02f, 1.14433924e-02f, 1.05627570e-02f, 9.71188024e-03f, 8.89473315e-03f,
+  8.11458007e-03f, 7.37399282e-03f, 6.67487131e-03f, 6.01847749e-03f, 5.40547539e-03f, 4.83598234e-03f,
+  4.30962071e-03f, 3.82557698e-03f, 3.38266022e-03f, 2.97936238e-03f, 2.61391723e-03f, 2.28435639e-03f,
+  1.98856345e-03f, 1.72432268e-03f, 1.48936512e-03f, 1.28140778e-03f, 1.09818904e-03f, 9.37498000e-04f,
+  7.97199726e-04f, 6.75254443e-04f, 5.69732918e-04f, 4.78827104e-04f, 4.00857185e-04f, 3.34275188e-04f,
+  2.77665647e-04f
+};
+static const int kern_half_fixed_16[] = {
+  10481, 10461, 10400, 10299, 10159, 9982, 9770, 9525, 9250, 8948, 8622, 8275,
+  7912, 7535, 7148, 6754, 6357, 5960, 5567, 5178, 4799, 4429, 4073, 3730,
+  3403, 3092, 2799, 2524, 2267, 2028, 1807, 1604, 1418, 1249, 1096, 958,
+  834, 723, 625, 537, 461, 393, 334, 283, 239, 201, 168, 140,
+  116, 10461, 10440, 10379, 10279, 10139, 9962, 9751, 9506, 9232, 8930, 8605,
+  8259, 7896, 7520, 7134, 6741, 6345, 5949, 5556, 5168, 4789, 4421, 4065,
+  3723, 3396, 3086, 2794, 2519, 2262, 2024, 1804, 1601, 1416, 1247, 1094,
+  956, 832, 722, 623, 536, 460, 392, 334, 283, 238, 200, 168,
+  140, 116, 10400, 10379, 10319, 10218, 10080, 9904, 9694, 9451, 9178, 8878,
+  8555, 8211, 7850, 7476, 7092, 6701, 6308, 5914, 5523, 5138, 4761, 4395,
+  4041, 3701, 3376, 3068, 2777, 2504, 2249, 2012, 1793, 1592, 1407, 1240,
+  1088, 950, 827, 717, 620, 533, 457, 390, 332, 281, 237, 199,
+  167, 139, 116, 10299, 10279, 10218, 10119, 9982, 9808, 9599, 9359, 9089,
+  8792, 8471, 8131, 7774, 7403, 7023, 6636, 6246, 5857, 5470, 5088, 4715,
+  4352, 4002, 3665, 3343, 3038, 2750, 2480, 2227, 1993, 1776, 1576, 1394,
+  1228, 1077, 941, 819, 710, 614, 528, 452, 386, 328, 278, 235,
+  197, 165, 138, 114, 10159, 10139, 10080, 9982, 9846, 9675, 9469, 9232,
+  8965, 8672, 8356, 8021, 7668, 7303, 6928, 6546, 6162, 5777, 5395, 5019,
+  4651, 4293, 3947, 3615, 3298, 2997, 2713, 2446, 2197, 1966, 1752, 1555,
+  1375, 1211, 1062, 928, 808, 701, 605, 521, 446, 381, 324, 274,
+  232, 195, 163, 136, 113, 9982, 9962, 9904, 9808, 9675, 9506, 9304,
+  9071, 8809, 8521, 8211, 7881, 7535, 7176, 6807, 6432, 6054, 5676, 5301,
+  4932, 4570, 4218, 3878, 3552, 3241, 2945, 2666, 2404, 2159, 1931, 1721,
+  1528, 1351, 1190, 1044, 912, 794, 689, 595, 512, 439, 374, 318,
+  270, 228, 191, 160, 133, 111, 9770, 9751, 9694, 9599, 9469, 9304,
+  9106, 8878, 8622, 8340, 8036, 7713, 7374, 7023, 6662, 6295, 5926, 5556,
+  5189, 4827, 4473, 4129, 3796, 3477, 3172, 2882, 2609, 2352, 2113, 1890,
+  1684, 1495, 1322, 1165, 1022, 893, 777, 674, 582, 501, 429, 366,
+  312, 264, 223, 187, 157, 131, 109, 9525, 9506, 9451, 9359, 9232,
+  9071, 8878, 8655, 8405, 8131, 7835, 7520, 7190, 6847, 6495, 6138, 5777,
+  5416, 5059, 4706, 4361, 4025, 3701, 3389, 3092, 2810, 2544, 2293, 2060,
+  1843, 1642, 1458, 1289, 1135, 996, 870, 758, 657, 568, 488, 418,
+  357, 304, 257, 217, 182, 153, 127, 106, 9250, 9232, 9178, 9089,
+  8965, 8809, 8622, 8405, 8163, 7896, 7609, 7303, 6982, 6649, 6308, 5960,
+  5610, 5260, 4912, 4570, 4235, 3909, 3594, 3292, 3003, 2729, 2470, 2227,
+  2000, 1790, 1595, 1416, 1252, 1103, 967, 845, 736, 638, 551, 474,
+  406, 347, 295, 250, 211, 177, 148, 124, 103, 8948, 8930, 8878,
+  8792, 8672, 8521, 8340, 8131, 7896, 7638, 7360, 7064, 6754, 6432, 6102,
+  5766, 5427, 5088, 4752, 4421, 4097, 3781, 3477, 3184, 2905, 2640, 2389,
+  2154, 1935, 1731, 1543, 1369, 1211, 1067, 936, 818, 712, 617, 533,
+  459, 393, 336, 285, 242, 204, 171, 143, 120, 99, 8622, 8605,
+  8555, 8471, 8356, 8211, 8036, 7835, 7609, 7360, 7092, 6807, 6508, 6198,
+  5879, 5556, 5229, 4903, 4579, 4260, 3947, 3644, 3350, 3068, 2799, 2544,
+  2302, 2076, 1865, 1668, 1487, 1320, 1167, 1028, 902, 788, 686, 595,
+  514, 442, 379, 323, 275, 233, 197, 165, 138, 115, 96, 8275,
+  8259, 8211, 8131, 8021, 7881, 7713, 7520, 7303, 7064, 6807, 6533, 6246,
+  5949, 5643, 5332, 5019, 4706, 4395, 4089, 3789, 3497, 3215, 2945, 2687,
+  2441, 2210, 1993, 1790, 1601, 1427, 1267, 1120, 986, 865, 756, 658,
+  571, 493, 424, 364, 310, 264, 224, 189, 159, 133, 111, 92,
+  7912, 7896, 7850, 7774, 7668, 7535, 7374, 7190, 6982, 6754, 6508, 6246,
+  5972, 5687, 5395, 5098, 4799, 4499, 4202, 3909, 3622, 3343, 3074, 2815,
+  2569, 2334, 2113, 1905, 1711, 1531, 1364, 1211, 1071, 943, 827, 723,
+  629, 546, 471, 406, 348, 297, 252, 214, 180, 152, 127, 106,
+  88, 7535, 7520, 7476, 7403, 7303, 7176, 7023, 6847, 6649, 6432, 6198,
+  5949, 5687, 5416, 5138, 4855, 4570, 4285, 4002, 3723, 3450, 3184, 2928,
+  2681, 2446, 2223, 2012, 1814, 1629, 1458, 1299, 1153, 1020, 898, 788,
+  689, 599, 520, 449, 386, 331, 283, 240, 204, 172, 144, 121,
+  101, 84, 7148, 7134, 7092, 7023, 6928, 6807, 6662, 6495, 6308, 6102,
+  5879, 5643, 5395, 5138, 4874, 4606, 4335, 4065, 3796, 3531, 3272, 3021,
+  2777, 2544, 2320, 2109, 1909, 1721, 1546, 1383, 1232, 1094, 967, 852,
+  747, 653, 569, 493, 426, 366, 314, 268, 228, 193, 163, 137,
+  115, 96, 79, 6754, 6741, 6701, 6636, 6546, 6432, 6295, 6138, 5960,
+  5766, 5556, 5332, 5098, 4855, 4606, 4352, 4097, 3841, 3587, 3337, 3092,
+  2854, 2624, 2404, 2193, 1993, 1804, 1626, 1461, 1307, 1165, 1034, 914,
+  805, 706, 617, 537, 466, 402, 346, 297, 253, 215, 182, 154,
+  129, 108, 90, 75, 6357, 6345, 6308, 6246, 6162, 6054, 5926, 5777,
+  5610, 5427, 5229, 5019, 4799, 4570, 4335, 4097, 3856, 3615, 3376, 3141,
+  2911, 2687, 2470, 2262, 2064, 1876, 1698, 1531, 1375, 1230, 1096, 973,
+  860, 758, 665, 581, 506, 439, 379, 326, 279, 238, 203, 172,
+  145, 122, 102, 85, 71, 5960, 5949, 5914, 5857, 5777, 5676, 5556,
+  5416, 5260, 5088, 4903, 4706, 4499, 4285, 4065, 3841, 3615, 3389, 3166,
+  2945, 2729, 2519, 2316, 2121, 1935, 1758, 1592, 1435, 1289, 1153, 1028,
+  912, 807, 710, 623, 545, 474, 411, 355, 306, 262, 224, 190,
+  161, 136, 114, 96, 80, 66, 5567, 5556, 5523, 5470, 5395, 5301,
+  5189, 5059, 4912, 4752, 4579, 4395, 4202, 4002, 3796, 3587, 3376, 3166,
+  2956, 2750, 2549, 2352, 2163, 1981, 1807, 1642, 1487, 1340, 1204, 1077,
+  960, 852, 753, 664, 582, 509, 443, 384, 332, 285, 245, 209,
+  178, 150, 127, 107, 89, 74, 62, 5178, 5168, 5138, 5088, 5019,
+  4932, 4827, 4706, 4570, 4421, 4260, 4089, 3909, 3723, 3531, 3337, 3141,
+  2945, 2750, 2559, 2371, 2188, 2012, 1843, 1681, 1528, 1383, 1247, 1120,
+  1002, 893, 793, 701, 617, 542, 473, 412, 357, 309, 265, 228,
+  194, 165, 140, 118, 99, 83, 69, 58, 4799, 4789, 4761, 4715,
+  4651, 4570, 4473, 4361, 4235, 4097, 3947, 3789, 3622, 3450, 3272, 3092,
+  2911, 2729, 2549, 2371, 2197, 2028, 1865, 1708, 1558, 1416, 1281, 1155,
+  1038, 928, 827, 734, 649, 572, 502, 439, 382, 331, 286, 246,
+  211, 180, 153, 130, 109, 92, 77, 64, 53, 4429, 4421, 4395,
+  4352, 4293, 4218, 4129, 4025, 3909, 3781, 3644, 3497, 3343, 3184, 3021,
+  2854, 2687, 2519, 2352, 2188, 2028, 1872, 1721, 1576, 1438, 1307, 1183,
+  1067, 958, 857, 764, 678, 599, 528, 463, 405, 352, 306, 264,
+  227, 195, 166, 141, 120, 101, 85, 71, 59, 49, 4073, 4065,
+  4041, 4002, 3947, 3878, 3796, 3701, 3594, 3477, 3350, 3215, 3074, 2928,
+  2777, 2624, 2470, 2316, 2163, 2012, 1865, 1721, 1582, 1449, 1322, 1202,
+  1088, 981, 881, 788, 702, 623, 551, 485, 426, 372, 324, 281,
+  243, 209, 179, 153, 130, 110, 93, 78, 65, 54, 45, 3730,
+  3723, 3701, 3665, 3615, 3552, 3477, 3389, 3292, 3184, 3068, 2945, 2815,
+  2681, 2544, 2404, 2262, 2121, 1981, 1843, 1708, 1576, 1449, 1327, 1211,
+  1100, 996, 898, 807, 722, 643, 571, 505, 445, 390, 341, 297,
+  257, 222, 191, 164, 140, 119, 101, 85, 71, 60, 50, 41,
+  3403, 3396, 3376, 3343, 3298, 3241, 3172, 3092, 3003, 2905, 2799, 2687,
+  2569, 2446, 2320, 2193, 2064, 1935, 1807, 1681, 1558, 1438, 1322, 1211,
+  1105, 1004, 909, 819, 736, 658, 587, 521, 461, 406, 356, 311,
+  271, 235, 203, 174, 150, 128, 109, 92, 78, 65, 55, 46,
+  38, 3092, 3086, 3068, 3038, 2997, 2945, 2882, 2810, 2729, 2640, 2544,
+  2441, 2334, 2223, 2109, 1993, 1876, 1758, 1642, 1528, 1416, 1307, 1202,
+  1100, 1004, 912, 826, 745, 669, 598, 533, 473, 418, 369, 323,
+  283, 246, 213, 184, 159, 136, 116, 99, 84, 70, 59, 50,
+  41, 34, 2799, 2794, 2777, 2750, 2713, 2666, 2609, 2544, 2470, 2389,
+  2302, 2210, 2113, 2012, 1909, 1804, 1698, 1592, 1487, 1383, 1281, 1183,
+  1088, 996, 909, 826, 747, 674, 605, 542, 483, 428, 379, 334,
+  293, 256, 223, 193, 167, 143, 123, 105, 89, 76, 64, 54,
+  45, 37, 31, 2524, 2519, 2504, 2480, 2446, 2404, 2352, 2293, 2227,
+  2154, 2076, 1993, 1905, 1814, 1721, 1626, 1531, 1435, 1340, 1247, 1155,
+  1067, 981, 898, 819, 745, 674, 608, 546, 488, 435, 386, 342,
+  301, 264, 231, 201, 174, 150, 129, 111, 95, 80, 68, 58,
+  48, 40, 34, 28, 2267, 2262, 2249, 2227, 2197, 2159, 2113, 2060,
+  2000, 1935, 1865, 1790, 1711, 1629, 1546, 1461, 1375, 1289, 1204, 1120,
+  1038, 958, 881, 807, 736, 669, 605, 546, 490, 439, 391, 347,
+  307, 270, 237, 207, 180, 156, 135, 116, 100, 85, 72, 61,
+  52, 43, 36, 30, 25, 2028, 2024, 2012, 1993, 1966, 1931, 1890,
+  1843, 1790, 1731, 1668, 1601, 1531, 1458, 1383, 1307, 1230, 1153, 1077,
+  1002, 928, 857, 788, 722, 658, 598, 542, 488, 439, 392, 350,
+  310, 274, 242, 212, 185, 161, 140, 121, 104, 89, 76, 65,
+  55, 46, 39, 33, 27, 23, 1807, 1804, 1793, 1776, 1752, 1721,
+  1684, 1642, 1595, 1543, 1487, 1427, 1364, 1299, 1232, 1165, 1096, 1028,
+  960, 893, 827, 764, 702, 643, 587, 533, 483, 435, 391, 350,
+  312, 277, 245, 215, 189, 165, 144, 125, 108, 93, 79, 68,
+  58, 49, 41, 35, 29, 24, 20, 1604, 1601, 1592, 1576, 1555,
+  1528, 1495, 1458, 1416, 1369, 1320, 1267, 1211, 1153, 1094, 1034, 973,
+  912, 852, 793, 734, 678, 623, 571, 521, 473, 428, 386, 347,
+  310, 277, 246, 217, 191, 168, 147, 128, 111, 96, 82, 70,
+  60, 51, 43, 37, 31, 26, 21, 18, 1418, 1416, 1407, 1394,
+  1375, 1351, 1322, 1289, 1252, 1211, 1167, 1120, 1071, 1020, 967, 914,
+  860, 807, 753, 701, 649, 599, 551, 505, 461, 418, 379, 342,
+  307, 274, 245, 217, 192, 169, 148, 130, 113, 98, 85, 73,
+  62, 53, 45, 38, 32, 27, 23, 19, 16, 1249, 1247, 1240,
+  1228, 1211, 1190, 1165, 1135, 1103, 1067, 1028, 986, 943, 898, 852,
+  805, 758, 710, 664, 617, 572, 528, 485, 445, 406, 369, 334,
+  301, 270, 242, 215, 191, 169, 149, 131, 114, 99, 86, 74,
+  64, 55, 47, 40, 34, 28, 24, 20, 17, 14, 1096, 1094,
+  1088, 1077, 1062, 1044, 1022, 996, 967, 936, 902, 865, 827, 788,
+  747, 706, 665, 623, 582, 542, 502, 463, 426, 390, 356, 323,
+  293, 264, 237, 212, 189, 168, 148, 131, 115, 100, 87, 76,
+  65, 56, 48, 41, 35, 30, 25, 21, 18, 15, 12, 958,
+  956, 950, 941, 928, 912, 893, 870, 845, 818, 788, 756, 723,
+  689, 653, 617, 581, 545, 509, 473, 439, 405, 372, 341, 311,
+  283, 256, 231, 207, 185, 165, 147, 130, 114, 100, 88, 76,
+  66, 57, 49, 42, 36, 31, 26, 22, 18, 15, 13, 11,
+  834, 832, 827, 819, 808, 794, 777, 758, 736, 712, 686, 658,
+  629, 599, 569, 537, 506, 474, 443, 412, 382, 352, 324, 297,
+  271, 246, 223, 201, 180, 161, 144, 128, 113, 99, 87, 76,
+  66, 58, 50, 43, 37, 31, 27, 23, 19, 16, 13, 11,
+  9, 723, 722, 717, 710, 701, 689, 674, 657, 638, 617, 595,
+  571, 546, 520, 493, 466, 439, 411, 384, 357, 331, 306, 281,
+  257, 235, 213, 193, 174, 156, 140, 125, 111, 98, 86, 76,
+  66, 58, 50, 43, 37, 32, 27, 23, 20, 16, 14, 12,
+  10, 8, 625, 623, 620, 614, 605, 595, 582, 568, 551, 533,
+  514, 493, 471, 449, 426, 402, 379, 355, 332, 309, 286, 264,
+  243, 222, 203, 184, 167, 150, 135, 121, 108, 96, 85, 74,
+  65, 57, 50, 43, 37, 32, 27, 23, 20, 17, 14, 12,
+  10, 8, 7, 537, 536, 533, 528, 521, 512, 501, 488, 474,
+  459, 442, 424, 406, 386, 366, 346, 326, 306, 285, 265, 246,
+  227, 209, 191, 174, 159, 143, 129, 116, 104, 93, 82, 73,
+  64, 56, 49, 43, 37, 32, 28, 24, 20, 17, 15, 12,
+  10, 9, 7, 6, 461, 460, 457, 452, 446, 439, 429, 418,
+  406, 393, 379, 364, 348, 331, 314, 297, 279, 262, 245, 228,
+  211, 195, 179, 164, 150, 136, 123, 111, 100, 89, 79, 70,
+  62, 55, 48, 42, 37, 32, 27, 24, 20, 17, 15, 12,
+  10, 9, 7, 6, 5, 393, 392, 390, 386, 381, 374, 366,
+  357, 347, 336, 323, 310, 297, 283, 268, 253, 238, 224, 209,
+  194, 180, 166, 153, 140, 128, 116, 105, 95, 85, 76, 68,
+  60, 53, 47, 41, 36, 31, 27, 23, 20, 17, 15, 13,
+  11, 9, 8, 6, 5, 4, 334, 334, 332, 328, 324, 318,
+  312, 304, 295, 285, 275, 264, 252, 240, 228, 215, 203, 190,
+  178, 165, 153, 141, 130, 119, 109, 99, 89, 80, 72, 65,
+  58, 51, 45, 40, 35, 31, 27, 23, 20, 17, 15, 13,
+  11, 9, 8, 6, 5, 4, 4, 283, 283, 281, 278, 274,
+  270, 264, 257, 250, 242, 233, 224, 214, 204, 193, 182, 172,
+  161, 150, 140, 130, 120, 110, 101, 92, 84, 76, 68, 61,
+  55, 49, 43, 38, 34, 30, 26, 23, 20, 17, 15, 12,
+  11, 9, 8, 6, 5, 5, 4, 3, 239, 238, 237, 235,
+  232, 228, 223, 217, 211, 204, 197, 189, 180, 172, 163, 154,
+  145, 136, 127, 118, 109, 101, 93, 85, 78, 70, 64, 58,
+  52, 46, 41, 37, 32, 28, 25, 22, 19, 16, 14, 12,
+  10, 9, 8, 6, 5, 5, 4, 3, 3, 201, 200, 199,
+  197, 195, 191, 187, 182, 177, 171, 165, 159, 152, 144, 137,
+  129, 122, 114, 107, 99, 92, 85, 78, 71, 65, 59, 54,
+  48, 43, 39, 35, 31, 27, 24, 21, 18, 16, 14, 12,
+  10, 9, 8, 6, 5, 5, 4, 3, 3, 2, 168, 168,
+  167, 165, 163, 160, 157, 153, 148, 143, 138, 133, 127, 121,
+  115, 108, 102, 96, 89, 83, 77, 71, 65, 60, 55, 50,
+  45, 40, 36, 33, 29, 26, 23, 20, 18, 15, 13, 12,
+  10, 9, 7, 6, 5, 5, 4, 3, 3, 2, 2, 140,
+  140, 139, 138, 136, 133, 131, 127, 124, 120, 115, 111, 106,
+  101, 96, 90, 85, 80, 74, 69, 64, 59, 54, 50, 46,
+  41, 37, 34, 30, 27, 24, 21, 19, 17, 15, 13, 11,
+  10, 8, 7, 6, 5, 4, 4, 3, 3, 2, 2, 2,
+  116, 116, 116, 114, 113, 111, 109, 106, 103, 99, 96, 92,
+  88, 84, 79, 75, 71, 66, 62, 58, 53, 49, 45, 41,
+  38, 34, 31, 28, 25, 23, 20, 18, 16, 14, 12, 11,
+  9, 8, 7, 6, 5, 4, 4, 3, 3, 2, 2, 2,
+  1
+};
+static const int kern_row_fixed_16[] = {
+  4658, 5608, 6725, 8033, 9559, 11329, 13375, 15729, 18425, 21498, 24987, 28929,
+  33363, 38325, 43854, 49985, 56752, 64183, 72303, 81134, 90689, 100973, 111986, 123715,
+  136140, 149229, 162938, 177214, 191988, 207184, 222710, 238467, 254343, 270219, 285966, 301451,
+  316535, 331079, 344940, 357981, 370067, 381069, 390869, 399357, 406439, 412034, 416078, 418523,
+  419341, 418523, 416078, 412034, 406439, 399357, 390869, 381069, 370067, 357981, 344940, 331079,
+  316535, 301451, 285966, 270219, 254343, 238467, 222710, 207184, 191988, 177214, 162938, 149229,
+  136140, 123715, 111986, 100973, 90689, 81134, 72303, 64183, 56752, 49985, 43854, 38325,
+  33363, 28929, 24987, 21498, 18425, 15729, 13375, 11329, 9559, 8033, 6725, 5608,
+  4658
+};
+
+static const float kern_half_17[] = {
+  2.34671924e-02f, 2.34266277e-02f, 2.33053509e-02f, 2.31046174e-02f, 2.28264909e-02f, 2.24738140e-02f,
+  2.20501553e-02f, 2.15597544e-02f, 2.10074428e-02f, 2.03985739e-02f, 1.97389331e-02f, 1.90346465e-02f,
+  1.82920843e-02f, 1.75177716e-02f, 1.67182852e-02f, 1.59001742e-02f, 1.50698619e-02f, 1.42335724e-02f,
+  1.33972540e-02f, 1.25665171e-02f, 1.17465770e-02f, 1.09422086e-02f, 1.01577118e-02f, 9.39688738e-03f,
+  8.66302196e-03f, 7.95888156e-03f, 7.28671812e-03f, 6.64827693e-03f, 6.04482181e-03f, 5.47715649e-03f,
+  4.94565768e-03f, 4.45030956e-03f, 3.99074191e-03f, 3.56627046e-03f, 3.17593920e-03f, 2.81856046e-03f,
+  2.49275588e-03f, 2.19699671e-03f, 1.92964007e-03f, 1.68896432e-03f, 1.47320062e-03f, 1.28056179e-03f,
+  1.10926793e-03f, 9.57568001e-04f, 8.23758775e-04f, 7.06199964e-04f, 6.03326829e-04f, 5.13658859e-04f,
+  4.35807015e-04f, 3.68477427e-04f, 3.10473697e-04f, 2.60696979e-04f, 2.34266277e-02f, 2.33861320e-02f,
+  2.32650656e-02f, 2.30646785e-02f, 2.27870326e-02f, 2.24349648e-02f, 2.20120400e-02f, 2.15224847e-02f,
+  2.09711287e-02f, 2.03633122e-02f, 1.97048131e-02f, 1.90017428e-02f, 1.82604659e-02f, 1.74874905e-02f,
+  1.66893862e-02f, 1.58726890e-02f, 1.50438119e-02f, 1.42089678e-02f, 1.33740958e-02f, 1.25447949e-02f,
+  1.17262714e-02f, 1.09232934e-02f, 1.01401526e-02f, 9.38064326e-03f, 8.64804722e-03f, 7.94512406e-03f,
+  7.27412198e-03f, 6.63678488e-03f, 6.03437284e-03f, 5.46768866e-03f, 4.93710861e-03f, 4.44261683e-03f,
+  3.98384314e-03f, 3.56010580e-03f, 3.17044929e-03f, 2.81368825e-03f, 2.48844689e-03f, 2.19319900e-03f,
+  1.92630454e-03f, 1.68604474e-03f, 1.47065404e-03f, 1.27834827e-03f, 1.10735046e-03f, 9.55912750e-04f,
+  8.22334783e-04f, 7.04979233e-04f, 6.02283922e-04f, 5.12770959e-04f, 4.35053662e-04f, 3.67840461e-04f,
+  3.09936993e-04f, 2.60246336e-04f, 2.33053509e-02f, 2.32650656e-02f, 2.31446251e-02f, 2.29452755e-02f,
+  2.26690676e-02f, 2.23188233e-02f, 2.18980871e-02f, 2.14110669e-02f, 2.08625644e-02f, 2.02578939e-02f,
+  1.96028035e-02f, 1.89033747e-02f, 1.81659330e-02f, 1.73969585e-02f, 1.66029874e-02f, 1.57905184e-02f,
+  1.49659319e-02f, 1.41354101e-02f, 1.33048594e-02f, 1.24798520e-02f, 1.16655668e-02f, 1.08667454e-02f,
+  1.00876587e-02f, 9.33208130e-03f, 8.60327668e-03f, 7.90399313e-03f, 7.23646488e-03f, 6.60242699e-03f,
+  6.00313349e-03f, 5.43938344e-03f, 4.91154986e-03f, 4.41961782e-03f, 3.96321947e-03f, 3.54167563e-03f,
+  3.15403636e-03f, 2.79912213e-03f, 2.47556460e-03f, 2.18184502e-03f, 1.91633229e-03f, 1.67731638e-03f,
+  1.46304059e-03f, 1.27173041e-03f, 1.10161782e-03f, 9.50964110e-04f, 8.18077708e-04f, 7.01329671e-04f,
+  5.99165971e-04f, 5.10116399e-04f, 4.32801462e-04f, 3.65936197e-04f, 3.08332499e-04f, 2.58899061e-04f,
+  2.31046174e-02f, 2.30646785e-02f, 2.29452755e-02f, 2.27476433e-02f, 2.24738140e-02f, 2.21265852e-02f,
+  2.17094738e-02f, 2.12266482e-02f, 2.06828695e-02f, 2.00834088e-02f, 1.94339603e-02f, 1.87405553e-02f,
+  1.80094671e-02f, 1.72471162e-02f, 1.64599828e-02f, 1.56545117e-02f, 1.48370275e-02f, 1.40136583e-02f,
+  1.31902620e-02f, 1.23723606e-02f, 1.15650883e-02f, 1.07731475e-02f, 1.00007709e-02f, 9.25170258e-03f,
+  8.52917507e-03f, 7.83591438e-03f, 7.17413565e-03f, 6.54555904e-03f, 5.95142739e-03f, 5.39253280e-03f,
+  4.86924592e-03f, 4.38155094e-03f, 3.92908324e-03f, 3.51117039e-03f, 3.12686991e-03f, 2.77501275e-03f,
+  2.45424197e-03f, 2.16305233e-03f, 1.89982646e-03f, 1.66286924e-03f, 1.45043910e-03f, 1.26077665e-03f,
+  1.09212939e-03f, 9.42773244e-04f, 8.11031379e-04f, 6.95288938e-04f, 5.94005222e-04f, 5.05722652e-04f,
+  4.29073640e-04f, 3.62784311e-04f, 3.05676775e-04f, 2.56669096e-04f, 2.28264909e-02f, 2.27870326e-02f,
+  2.26690676e-02f, 2.24738140e-02f, 2.22032815e-02f, 2.18602326e-02f, 2.14481410e-02f, 2.09711287e-02f,
+  2.04338953e-02f, 1.98416505e-02f, 1.92000214e-02f, 1.85149629e-02f, 1.77926738e-02f, 1.70395002e-02f,
+  1.62618421e-02f, 1.54660670e-02f, 1.46584241e-02f, 1.38449669e-02f, 1.30314818e-02f, 1.22234263e-02f,
+  1.14258714e-02f, 1.06434636e-02f, 9.88038536e-03f, 9.14033316e-03f, 8.42650421e-03f, 7.74158817e-03f,
+  7.08777551e-03f, 6.46676542e-03f, 5.87978587e-03f, 5.32761915e-03f, 4.81063128e-03f, 4.32880688e-03f,
+  3.88178625e-03f, 3.46890395e-03f, 3.08922958e-03f, 2.74160784e-03f, 2.42469856e-03f, 2.13701418e-03f,
+  1.87695702e-03f, 1.64285221e-03f, 1.43297925e-03f, 1.24559982e-03f, 1.07898272e-03f, 9.31424438e-04f,
+  8.01268441e-04f, 6.86919317e-04f, 5.86854760e-04f, 4.99634945e-04f, 4.23908583e-04f, 3.58417252e-04f,
+  3.01997119e-04f, 2.53579405e-04f, 2.24738140e-02f, 2.24349648e-02f, 2.23188233e-02f, 2.21265852e-02f,
+  2.18602326e-02f, 2.15224847e-02f, 2.11167615e-02f, 2.06471179e-02f, 2.01181863e-02f, 1.95350908e-02f,
+  1.89033747e-02f, 1.82288997e-02f, 1.75177716e-02f, 1.67762339e-02f, 1.60105918e-02f, 1.52271111e-02f,
+  1.44319460e-02f, 1.36310570e-02f, 1.28301410e-02f, 1.20345699e-02f, 1.12493383e-02f, 1.04790190e-02f,
+  9.72772948e-03f, 8.99911206e-03f, 8.29631183e-03f, 7.62197794e-03f, 6.97826734e-03f, 6.36685174e-03f,
+  5.78894140e-03f, 5.24530560e-03f, 4.73630521e-03f, 4.26192535e-03f, 3.82181141e-03f, 3.41530819e-03f,
+  3.04149999e-03f, 2.69924919e-03f, 2.38723611e-03f, 2.10399670e-03f, 1.84795738e-03f, 1.61746959e-03f,
+  1.41083926e-03f, 1.22635497e-03f, 1.06231205e-03f, 9.17033642e-04f, 7.88888603e-04f, 6.76306139e-04f,
+  5.77787636e-04f, 4.91915387e-04f, 4.17359057e-04f, 3.52879579e-04f, 2.97331164e-04f, 2.49661534e-04f,
+  2.20501553e-02f, 2.20120400e-02f, 2.18980871e-02f, 2.17094738e-02f, 2.14481410e-02f, 2.11167615e-02f,
+  2.07186844e-02f, 2.02578939e-02f, 1.97389331e-02f, 1.91668309e-02f, 1.85470227e-02f, 1.78852640e-02f,
+  1.71875395e-02f, 1.64599828e-02f, 1.57087725e-02f, 1.49400616e-02f, 1.41598871e-02f, 1.33740958e-02f,
+  1.25882775e-02f, 1.18077043e-02f, 1.10372743e-02f, 1.02814762e-02f, 9.54435021e-03f, 8.82946793e-03f,
+  8.13991576e-03f, 7.47829489e-03f, 6.84671849e-03f, 6.24682894e-03f, 5.67981275e-03f, 5.14642522e-03f,
+  4.64702025e-03f, 4.18158295e-03f, 3.74976569e-03f, 3.35092563e-03f, 2.98416405e-03f, 2.64836499e-03f,
+  2.34223390e-03f, 2.06433376e-03f, 1.81312114e-03f, 1.58697832e-03f, 1.38424325e-03f, 1.20323664e-03f,
+  1.04228617e-03f, 8.99746432e-04f, 7.74017128e-04f, 6.63556973e-04f, 5.66895702e-04f, 4.82642208e-04f,
+  4.09491360e-04f, 3.46227374e-04f, 2.91726115e-04f, 2.44955096e-04f, 2.15597544e-02f, 2.15224847e-02f,
+  2.14110669e-02f, 2.12266482e-02f, 2.09711287e-02f, 2.06471179e-02f, 2.02578939e-02f, 1.98073536e-02f,
+  1.92999337e-02f, 1.87405553e-02f, 1.81345306e-02f, 1.74874905e-02f, 1.68052837e-02f, 1.60939079e-02f,
+  1.53594045e-02f, 1.46077899e-02f, 1.38449669e-02f, 1.30766518e-02f, 1.23083107e-02f, 1.15450965e-02f,
+  1.07918018e-02f, 1.00528132e-02f, 9.33208130e-03f, 8.63309763e-03f, 7.95888156e-03f, 7.31197512e-03f,
+  6.69444539e-03f, 6.10789750e-03f, 5.55349188e-03f, 5.03196707e-03f, 4.54366906e-03f, 4.08858340e-03f,
+  3.66636971e-03f, 3.27640004e-03f, 2.91779544e-03f, 2.58946465e-03f, 2.29014200e-03f, 2.01842235e-03f,
+  1.77279685e-03f, 1.55168341e-03f, 1.35345722e-03f, 1.17647636e-03f, 1.01910543e-03f, 8.79735802e-04f,
+  7.56802736e-04f, 6.48799294e-04f, 5.54287748e-04f, 4.71908104e-04f, 4.00384131e-04f, 3.38527170e-04f,
+  2.85238057e-04f, 2.39507222e-04f, 2.10074428e-02f, 2.09711287e-02f, 2.08625644e-02f, 2.06828695e-02f,
+  2.04338953e-02f, 2.01181863e-02f, 1.97389331e-02f, 1.92999337e-02f, 1.88055132e-02f, 1.82604659e-02f,
+  1.76699664e-02f, 1.70395002e-02f, 1.63747706e-02f, 1.56816188e-02f, 1.49659319e-02f, 1.42335724e-02f,
+  1.34902904e-02f, 1.27416579e-02f, 1.19929994e-02f, 1.12493383e-02f, 1.05153406e-02f, 9.79528297e-03f,
+  9.09301452e-03f, 8.41193739e-03f, 7.75499362e-03f, 7.12465914e-03f, 6.52294885e-03f, 5.95142739e-03f,
+  5.41122444e-03f, 4.90305992e-03f, 4.42727096e-03f, 3.98384314e-03f, 3.57244583e-03f, 3.19246622e-03f,
+  2.84304819e-03f, 2.52312841e-03f, 2.23147380e-03f, 1.96671509e-03f, 1.72738184e-03f, 1.51193282e-03f,
+  1.31878478e-03f, 1.14633772e-03f, 9.92998248e-04f, 8.57199018e-04f, 7.37415161e-04f, 6.32178504e-04f,
+  5.40088164e-04f, 4.59818897e-04f, 3.90127214e-04f, 3.29854869e-04f, 2.77930900e-04f, 2.33371597e-04f,
+  2.03985739e-02f, 2.03633122e-02f, 2.02578939e-02f, 2.00834088e-02f, 1.98416505e-02f, 1.95350908e-02f,
+  1.91668309e-02f, 1.87405553e-02f, 1.82604659e-02f, 1.77312139e-02f, 1.71578303e-02f, 1.65456366e-02f,
+  1.59001742e-02f, 1.52271111e-02f, 1.45321675e-02f, 1.38210338e-02f, 1.30992951e-02f, 1.23723606e-02f,
+  1.16454009e-02f, 1.09232934e-02f, 1.02105699e-02f, 9.51138232e-03f, 8.82946793e-03f, 8.16813111e-03f,
+  7.53022730e-03f, 6.91816211e-03f, 6.33389130e-03f, 5.77893434e-03f, 5.25438832e-03f, 4.76095220e-03f,
+  4.29895334e-03f, 3.86837777e-03f, 3.46890395e-03f, 3.09993746e-03f, 2.76064686e-03f, 2.44999956e-03f,
+  2.16679787e-03f, 1.90971280e-03f, 1.67731638e-03f, 1.46811188e-03f, 1.28056179e-03f, 1.11311290e-03f,
+  9.64217761e-04f, 8.32354417e-04f, 7.16042356e-04f, 6.13855838e-04f, 5.24434552e-04f, 4.46491758e-04f,
+  3.78819968e-04f, 3.20294552e-04f, 2.69875512e-04f, 2.26607692e-04f, 1.97389331e-02f, 1.97048131e-02f,
+  1.96028035e-02f, 1.94339603e-02f, 1.92000214e-02f, 1.89033747e-02f, 1.85470227e-02f, 1.81345306e-02f,
+  1.76699664e-02f, 1.71578303e-02f, 1.66029874e-02f, 1.60105918e-02f, 1.53860012e-02f, 1.47347031e-02f,
+  1.40622323e-02f, 1.33740958e-02f, 1.26756961e-02f, 1.19722681e-02f, 1.12688178e-02f, 1.05700605e-02f,
+  9.88038536e-03f, 9.20380745e-03f, 8.54394399e-03f, 7.90399313e-03f, 7.28671812e-03f, 6.69444539e-03f,
+  6.12906879e-03f, 5.59205795e-03f, 5.08447411e-03f, 4.60699480e-03f, 4.15993575e-03f, 3.74328392e-03f,
+  3.35672800e-03f, 2.99969316e-03f, 2.67137424e-03f, 2.37077242e-03f, 2.09672889e-03f, 1.84795738e-03f,
+  1.62307604e-03f, 1.42063666e-03f, 1.23915158e-03f, 1.07711751e-03f, 9.33037314e-04f, 8.05438089e-04f,
+  6.92887290e-04f, 5.94005222e-04f, 5.07475634e-04f, 4.32053319e-04f, 3.66569875e-04f, 3.09936993e-04f,
+  2.61148380e-04f, 2.19279755e-04f, 1.90346465e-02f, 1.90017428e-02f, 1.89033747e-02f, 1.87405553e-02f,
+  1.85149629e-02f, 1.82288997e-02f, 1.78852640e-02f, 1.74874905e-02f, 1.70395002e-02f, 1.65456366e-02f,
+  1.60105918e-02f, 1.54393325e-02f, 1.48370275e-02f, 1.42089678e-02f, 1.35604907e-02f, 1.28969066e-02f,
+  1.22234263e-02f, 1.15450965e-02f, 1.08667454e-02f, 1.01929205e-02f, 9.52785183e-03f, 8.87541473e-03f,
+  8.23909603e-03f, 7.62197794e-03f, 7.02672731e-03f, 6.45558722e-03f, 5.91038307e-03f, 5.39253280e-03f,
+  4.90305992e-03f, 4.44261683e-03f, 4.01150854e-03f, 3.60972318e-03f, 3.23695969e-03f, 2.89266370e-03f,
+  2.57605943e-03f, 2.28618318e-03f, 2.02191737e-03f, 1.78202207e-03f, 1.56516454e-03f, 1.36994827e-03f,
+  1.19493855e-03f, 1.03868591e-03f, 8.99746432e-04f, 7.76699977e-04f, 6.68164983e-04f, 5.72811055e-04f,
+  4.89368860e-04f, 4.16637602e-04f, 3.53490614e-04f, 2.98878411e-04f, 2.51830585e-04f, 2.11455830e-04f,
+  1.82920843e-02f, 1.82604659e-02f, 1.81659330e-02f, 1.80094671e-02f, 1.77926738e-02f, 1.75177716e-02f,
+  1.71875395e-02f, 1.68052837e-02f, 1.63747706e-02f, 1.59001742e-02f, 1.53860012e-02f, 1.48370275e-02f,
+  1.42582189e-02f, 1.36546604e-02f, 1.30314818e-02f, 1.23937847e-02f, 1.17465770e-02f, 1.10947108e-02f,
+  1.04428213e-02f, 9.79528297e-03f, 9.15616006e-03f, 8.52917507e-03f, 7.91767985e-03f, 7.32463645e-03f,
+  6.75260695e-03f, 6.20374782e-03f, 5.67981275e-03f, 5.18216426e-03f, 4.71178629e-03f, 4.26930562e-03f,
+  3.85501562e-03f, 3.46890395e-03f, 3.11068259e-03f, 2.77981791e-03f, 2.47556460e-03f, 2.19699671e-03f,
+  1.94304029e-03f, 1.71250349e-03f, 1.50410575e-03f, 1.31650514e-03f, 1.14832271e-03f, 9.98165691e-04f,
+  8.64646398e-04f, 7.46400096e-04f, 6.42099185e-04f, 5.50465076e-04f, 4.70278028e-04f, 4.00384131e-04f,
+  3.39700578e-04f, 2.87218863e-04f, 2.42006412e-04f, 2.03206713e-04f, 1.75177716e-02f, 1.74874905e-02f,
+  1.73969585e-02f, 1.72471162e-02f, 1.70395002e-02f, 1.67762339e-02f, 1.64599828e-02f, 1.60939079e-02f,
+  1.56816188e-02f, 1.52271111e-02f, 1.47347031e-02f, 1.42089678e-02f, 1.36546604e-02f, 1.30766518e-02f,
+  1.24798520e-02f, 1.18691493e-02f, 1.12493383e-02f, 1.06250653e-02f, 1.00007709e-02f, 9.38064326e-03f,
+  8.76857527e-03f, 8.16813111e-03f, 7.58252013e-03f, 7.01458054e-03f, 6.46676542e-03f, 5.94113953e-03f,
+  5.43938344e-03f, 4.96280054e-03f, 4.51233378e-03f, 4.08858340e-03f, 3.69183067e-03f, 3.32206348e-03f,
+  2.97900569e-03f, 2.66214670e-03f, 2.37077242e-03f, 2.10399670e-03f, 1.86079042e-03f, 1.64001225e-03f,
+  1.44043611e-03f, 1.26077665e-03f, 1.09971361e-03f, 9.55912750e-04f, 8.28045420e-04f, 7.14804570e-04f,
+  6.14918768e-04f, 5.27163618e-04f, 4.50370921e-04f, 3.83435661e-04f, 3.25320871e-04f, 2.75060738e-04f,
+  2.31762155e-04f, 1.94604858e-04f, 1.67182852e-02f, 1.66893862e-02f, 1.66029874e-02f, 1.64599828e-02f,
+  1.62618421e-02f, 1.60105918e-02f, 1.57087725e-02f, 1.53594045e-02f, 1.49659319e-02f, 1.45321675e-02f,
+  1.40622323e-02f, 1.35604907e-02f, 1.30314818e-02f, 1.24798520e-02f, 1.19102895e-02f, 1.13274585e-02f,
+  1.07359346e-02f, 1.01401526e-02f, 9.54435021e-03f, 8.95252451e-03f, 8.36839061e-03f, 7.79534923e-03f,
+  7.23646488e-03f, 6.69444539e-03f, 6.17163163e-03f, 5.66999475e-03f, 5.19113755e-03f, 4.73630521e-03f,
+  4.30639740e-03f, 3.90198641e-03f, 3.52334091e-03f, 3.17044929e-03f, 2.84304819e-03f, 2.54065008e-03f,
+  2.26257392e-03f, 2.00797338e-03f, 1.77586661e-03f, 1.56516454e-03f, 1.37469673e-03f, 1.20323664e-03f,
+  1.04952429e-03f, 9.12286283e-04f, 7.90254620e-04f, 6.82181912e-04f, 5.86854760e-04f, 5.03104588e-04f,
+  4.29816631e-04f, 3.65936197e-04f, 3.10473697e-04f, 2.62507354e-04f, 2.21184862e-04f, 1.85723373e-04f,
+  1.59001742e-02f, 1.58726890e-02f, 1.57905184e-02f, 1.56545117e-02f, 1.54660670e-02f, 1.52271111e-02f,
+  1.49400616e-02f, 1.46077899e-02f, 1.42335724e-02f, 1.38210338e-02f, 1.33740958e-02f, 1.28969066e-02f,
+  1.23937847e-02f, 1.18691493e-02f, 1.13274585e-02f, 1.07731475e-02f, 1.02105699e-02f, 9.64394305e-03f,
+  9.07729659e-03f, 8.51443131e-03f, 7.95888156e-03f, 7.41388276e-03f, 6.88234763e-03f, 6.36685174e-03f,
+  5.86962188e-03f, 5.39253280e-03f, 4.93710861e-03f, 4.50453348e-03f, 4.09566332e-03f, 3.71104223e-03f,
+  3.35092563e-03f, 3.01530282e-03f, 2.70392327e-03f, 2.41632317e-03f, 2.15185457e-03f, 1.90971280e-03f,
+  1.68896432e-03f, 1.48857303e-03f, 1.30742579e-03f, 1.14435609e-03f, 9.98165691e-04f, 8.67643394e-04f,
+  7.51583430e-04f, 6.48799294e-04f, 5.58136962e-04f, 4.78485133e-04f, 4.08783497e-04f, 3.48029076e-04f,
+  2.95280624e-04f, 2.49661534e-04f, 2.10361148e-04f, 1.76634974e-04f, 1.50698619e-02f, 1.50438119e-02f,
+  1.49659319e-02f, 1.48370275e-02f, 1.46584241e-02f, 1.44319460e-02f, 1.41598871e-02f, 1.38449669e-02f,
+  1.34902904e-02f, 1.30992951e-02f, 1.26756961e-02f, 1.22234263e-02f, 1.17465770e-02f, 1.12493383e-02f,
+  1.07359346e-02f, 1.02105699e-02f, 9.67737101e-03f, 9.14033316e-03f, 8.60327668e-03f, 8.06980487e-03f,
+  7.54326629e-03f, 7.02672731e-03f, 6.52294885e-03f, 6.03437284e-03f, 5.56310872e-03f, 5.11093298e-03f,
+  4.67929104e-03f, 4.26930562e-03f, 3.88178625e-03f, 3.51725030e-03f, 3.17593920e-03f, 2.85784272e-03f,
+  2.56272336e-03f, 2.29014200e-03f, 2.03948398e-03f, 1.80998701e-03f, 1.60076609e-03f, 1.41083926e-03f,
+  1.23915158e-03f, 1.08459743e-03f, 9.46041080e-04f, 8.22334783e-04f, 7.12335517e-04f, 6.14918768e-04f,
+  5.28990873e-04f, 4.53498476e-04f, 3.87436681e-04f, 3.29854869e-04f, 2.79860978e-04f, 2.36624110e-04f,
+  1.99376023e-04f, 1.67411039e-04f, 1.42335724e-02f, 1.42089678e-02f, 1.41354101e-02f, 1.40136583e-02f,
+  1.38449669e-02f, 1.36310570e-02f, 1.33740958e-02f, 1.30766518e-02f, 1.27416579e-02f, 1.23723606e-02f,
+  1.19722681e-02f, 1.15450965e-02f, 1.10947108e-02f, 1.06250653e-02f, 1.01401526e-02f, 9.64394305e-03f,
+  9.14033316e-03f, 8.63309763e-03f, 8.12584534e-03f, 7.62197794e-03f, 7.12465914e-03f, 6.63678488e-03f,
+  6.16096333e-03f, 5.69949998e-03f, 5.25438832e-03f, 4.82730567e-03f, 4.41961782e-03f, 4.03238367e-03f,
+  3.66636971e-03f, 3.32206348e-03f, 2.99969316e-03f, 2.69924919e-03f, 2.42050714e-03f, 2.16305233e-03f,
+  1.92630454e-03f, 1.70954328e-03f, 1.51193282e-03f, 1.33254589e-03f, 1.17038586e-03f, 1.02440862e-03f,
+  8.93541321e-04f, 7.76699977e-04f, 6.72805007e-04f, 5.80794353e-04f, 4.99634945e-04f, 4.28331958e-04f,
+  3.65936197e-04f, 3.11549840e-04f, 2.64330301e-04f, 2.23492854e-04f, 1.88311809e-04f, 1.58120703e-04f,
+  1.33972540e-02f, 1.33740958e-02f, 1.33048594e-02f, 1.31902620e-02f, 1.30314818e-02f, 1.28301410e-02f,
+  1.25882775e-02f, 1.23083107e-02f, 1.19929994e-02f, 1.16454009e-02f, 1.12688178e-02f, 1.08667454e-02f,
+  1.04428213e-02f, 1.00007709e-02f, 9.54435021e-03f, 9.07729659e-03f, 8.60327668e-03f, 8.12584534e-03f,
+  7.64839724e-03f, 7.17413565e-03f, 6.70603756e-03f, 6.24682894e-03f, 5.79896523e-03f, 5.36461640e-03f,
+  4.94565768e-03f, 4.54366906e-03f, 4.15993575e-03f, 3.79545428e-03f, 3.45094595e-03f, 3.12686991e-03f,
+  2.82344106e-03f, 2.54065008e-03f, 2.27828603e-03f, 2.03595846e-03f, 1.81312114e-03f, 1.60909607e-03f,
+  1.42309663e-03f, 1.25424983e-03f, 1.10161782e-03f, 9.64217761e-04f, 8.41039757e-04f, 7.31063657e-04f,
+  6.33273215e-04f, 5.46668773e-04f, 4.70278028e-04f, 4.03164566e-04f, 3.44434986e-04f, 2.93244200e-04f,
+  2.48799130e-04f, 2.10361148e-04f, 1.77247231e-04f, 1.48830048e-04f, 1.25665171e-02f, 1.25447949e-02f,
+  1.24798520e-02f, 1.23723606e-02f, 1.22234263e-02f, 1.20345699e-02f, 1.18077043e-02f, 1.15450965e-02f,
+  1.12493383e-02f, 1.09232934e-02f, 1.05700605e-02f, 1.01929205e-02f, 9.79528297e-03f, 9.38064326e-03f,
+  8.95252451e-03f, 8.51443131e-03f, 8.06980487e-03f, 7.62197794e-03f, 7.17413565e-03f, 6.72928197e-03f,
+  6.29020948e-03f, 5.85947605e-03f, 5.43938344e-03f, 5.03196707e-03f, 4.63898759e-03f, 4.26192535e-03f,
+  3.90198641e-03f, 3.56010580e-03f, 3.23695969e-03f, 2.93297903e-03f, 2.64836499e-03f, 2.38310965e-03f,
+  2.13701418e-03f, 1.90971280e-03f, 1.70069316e-03f, 1.50931929e-03f, 1.33485324e-03f, 1.17647636e-03f,
+  1.03330880e-03f, 9.04428540e-04f, 7.88888603e-04f, 6.85731880e-04f, 5.94005222e-04f, 5.12770959e-04f,
+  4.41117038e-04f, 3.78165161e-04f, 3.23077285e-04f, 2.75060738e-04f, 2.33371597e-04f, 1.97317073e-04f,
+  1.66256490e-04f, 1.39601398e-04f, 1.17465770e-02f, 1.17262714e-02f, 1.16655668e-02f, 1.15650883e-02f,
+  1.14258714e-02f, 1.12493383e-02f, 1.10372743e-02f, 1.07918018e-02f, 1.05153406e-02f, 1.02105699e-02f,
+  9.88038536e-03f, 9.52785183e-03f, 9.15616006e-03f, 8.76857527e-03f, 8.36839061e-03f, 7.95888156e-03f,
+  7.54326629e-03f, 7.12465914e-03f, 6.70603756e-03f, 6.29020948e-03f, 5.87978587e-03f, 5.47715649e-03f,
+  5.08447411e-03f, 4.70364140e-03f, 4.33630263e-03f, 3.98384314e-03f, 3.64738959e-03f, 3.32781579e-03f,
+  3.02575459e-03f, 2.74160784e-03f, 2.47556460e-03f, 2.22761626e-03f, 1.99757819e-03f, 1.78510789e-03f,
+  1.58972631e-03f, 1.41083926e-03f, 1.24775677e-03f, 1.09971361e-03f, 9.65887390e-04f, 8.45416391e-04f,
+  7.37415161e-04f, 6.40989223e-04f, 5.55247534e-04f, 4.79313661e-04f, 4.12335037e-04f, 3.53490614e-04f,
+  3.01997119e-04f, 2.57113570e-04f, 2.18144560e-04f, 1.84442528e-04f, 1.55408576e-04f, 1.30492685e-04f,
+  1.09422086e-02f, 1.09232934e-02f, 1.08667454e-02f, 1.07731475e-02f, 1.06434636e-02f, 1.04790190e-02f,
+  1.02814762e-02f, 1.00528132e-02f, 9.79528297e-03f, 9.51138232e-03f, 9.20380745e-03f, 8.87541473e-03f,
+  8.52917507e-03f, 8.16813111e-03f, 7.79534923e-03f, 7.41388276e-03f, 7.02672731e-03f, 6.63678488e-03f,
+  6.24682894e-03f, 5.85947605e-03f, 5.47715649e-03f, 5.10209799e-03f, 4.73630521e-03f, 4.38155094e-03f,
+  4.03936626e-03f, 3.71104223e-03f, 3.39762773e-03f, 3.09993746e-03f, 2.81856046e-03f, 2.55387113e-03f,
+  2.30604550e-03f, 2.07507610e-03f, 1.86079042e-03f, 1.66286924e-03f, 1.48086681e-03f, 1.31422933e-03f,
+  1.16231432e-03f, 1.02440862e-03f, 8.99746432e-04f, 7.87524914e-04f, 6.86919317e-04f, 5.97096281e-04f,
+  5.17225941e-04f, 4.46491758e-04f, 3.84099607e-04f, 3.29284696e-04f, 2.81317305e-04f, 2.39507222e-04f,
+  2.03206713e-04f, 1.71812484e-04f, 1.44766687e-04f, 1.21556950e-04f, 1.01577118e-02f, 1.01401526e-02f,
+  1.00876587e-02f, 1.00007709e-02f, 9.88038536e-03f, 9.72772948e-03f, 9.54435021e-03f, 9.33208130e-03f,
+  9.09301452e-03f, 8.82946793e-03f, 8.54394399e-03f, 8.23909603e-03f, 7.91767985e-03f, 7.58252013e-03f,
+  7.23646488e-03f, 6.88234763e-03f, 6.52294885e-03f, 6.16096333e-03f, 5.79896523e-03f, 5.43938344e-03f,
+  5.08447411e-03f, 4.73630521e-03f, 4.39673802e-03f, 4.06741723e-03f, 3.74976569e-03f, 3.44498060e-03f,
+  3.15403636e-03f, 2.87768873e-03f, 2.61648488e-03f, 2.37077242e-03f, 2.14071479e-03f, 1.92630454e-03f,
+  1.72738184e-03f, 1.54365052e-03f, 1.37469673e-03f, 1.22000626e-03f, 1.07898272e-03f, 9.50964110e-04f,
+  8.35239538e-04f, 7.31063657e-04f, 6.37670921e-04f, 5.54287748e-04f, 4.80143644e-04f, 4.14480746e-04f,
+  3.56561766e-04f, 3.05676775e-04f, 2.61148380e-04f, 2.22335861e-04f, 1.88637889e-04f, 1.59494462e-04f,
+  1.34387708e-04f, 1.12841983e-04f, 9.39688738e-03f, 9.38064326e-03f, 9.33208130e-03f, 9.25170258e-03f,
+  9.14033316e-03f, 8.99911206e-03f, 8.82946793e-03f, 8.63309763e-03f, 8.41193739e-03f, 8.16813111e-03f,
+  7.90399313e-03f, 7.62197794e-03f, 7.32463645e-03f, 7.01458054e-03f, 6.69444539e-03f, 6.36685174e-03f,
+  6.03437284e-03f, 5.69949998e-03f, 5.36461640e-03f, 5.03196707e-03f, 4.70364140e-03f, 4.38155094e-03f,
+  4.06741723e-03f, 3.76276323e-03f, 3.46890395e-03f, 3.18694767e-03f, 2.91779544e-03f, 2.66214670e-03f,
+  2.42050714e-03f, 2.19319900e-03f, 1.98037270e-03f, 1.78202207e-03f, 1.59799890e-03f, 1.42802938e-03f,
+  1.27173041e-03f, 1.12862641e-03f, 9.98165691e-04f, 8.79735802e-04f, 7.72679108e-04f, 6.76306139e-04f,
+  5.89908625e-04f, 5.12770959e-04f, 4.44180332e-04f, 3.83435661e-04f, 3.29854869e-04f, 2.82781228e-04f,
+  2.41588074e-04f, 2.05682649e-04f, 1.74508707e-04f, 1.47548140e-04f, 1.24321916e-04f, 1.04389990e-04f,
+  8.66302196e-03f, 8.64804722e-03f, 8.60327668e-03f, 8.52917507e-03f, 8.42650421e-03f, 8.29631183e-03f,
+  8.13991576e-03f, 7.95888156e-03f, 7.75499362e-03f, 7.53022730e-03f, 7.28671812e-03f, 7.02672731e-03f,
+  6.75260695e-03f, 6.46676542e-03f, 6.17163163e-03f, 5.86962188e-03f, 5.56310872e-03f, 5.25438832e-03f,
+  4.94565768e-03f, 4.63898759e-03f, 4.33630263e-03f, 4.03936626e-03f, 3.74976569e-03f, 3.46890395e-03f,
+  3.19799432e-03f, 2.93805776e-03f, 2.68992526e-03f, 2.45424197e-03f, 2.23147380e-03f, 2.02191737e-03f,
+  1.82571227e-03f, 1.64285221e-03f, 1.47320062e-03f, 1.31650514e-03f, 1.17241254e-03f, 1.04048452e-03f,
+  9.20212246e-04f, 8.11031379e-04f, 7.12335517e-04f, 6.23488915e-04f, 5.43838774e-04f, 4.72725282e-04f,
+  4.09491360e-04f, 3.53490614e-04f, 3.04094312e-04f, 2.60696979e-04f, 2.22720861e-04f, 1.89619532e-04f,
+  1.60880154e-04f, 1.36025134e-04f, 1.14612783e-04f, 9.62374834e-05f, 7.95888156e-03f, 7.94512406e-03f,
+  7.90399313e-03f, 7.83591438e-03f, 7.74158817e-03f, 7.62197794e-03f, 7.47829489e-03f, 7.31197512e-03f,
+  7.12465914e-03f, 6.91816211e-03f, 6.69444539e-03f, 6.45558722e-03f, 6.20374782e-03f, 5.94113953e-03f,
+  5.66999475e-03f, 5.39253280e-03f, 5.11093298e-03f, 4.82730567e-03f, 4.54366906e-03f, 4.26192535e-03f,
+  3.98384314e-03f, 3.71104223e-03f, 3.44498060e-03f, 3.18694767e-03f, 2.93805776e-03f, 2.69924919e-03f,
+  2.47128517e-03f, 2.25475850e-03f, 2.05009710e-03f, 1.85757375e-03f, 1.67731638e-03f, 1.50931929e-03f,
+  1.35345722e-03f, 1.20949815e-03f, 1.07711751e-03f, 9.55912750e-04f, 8.45416391e-04f, 7.45109865e-04f,
+  6.54436066e-04f, 5.72811055e-04f, 4.99634945e-04f, 4.34301648e-04f, 3.76207434e-04f, 3.24758497e-04f,
+  2.79377186e-04f, 2.39507222e-04f, 2.04617856e-04f, 1.74207045e-04f, 1.47803643e-04f, 1.24968850e-04f,
+  1.05296931e-04f, 8.84151887e-05f, 7.28671812e-03f, 7.27412198e-03f, 7.23646488e-03f, 7.17413565e-03f,
+  7.08777551e-03f, 6.97826734e-03f, 6.84671849e-03f, 6.69444539e-03f, 6.52294885e-03f, 6.33389130e-03f,
+  6.12906879e-03f, 5.91038307e-03f, 5.67981275e-03f, 5.43938344e-03f, 5.19113755e-03f, 4.93710861e-03f,
+  4.67929104e-03f, 4.41961782e-03f, 4.15993575e-03f, 3.90198641e-03f, 3.64738959e-03f, 3.39762773e-03f,
+  3.15403636e-03f, 2.91779544e-03f, 2.68992526e-03f, 2.47128517e-03f, 2.26257392e-03f, 2.06433376e-03f,
+  1.87695702e-03f, 1.70069316e-03f, 1.53565931e-03f, 1.38185045e-03f, 1.23915158e-03f, 1.10735046e-03f,
+  9.86150000e-04f, 8.75181518e-04f, 7.74017128e-04f, 6.82181912e-04f, 5.99165971e-04f, 5.24434552e-04f,
+  4.57438495e-04f, 3.97622876e-04f, 3.44434986e-04f, 2.97331164e-04f, 2.55782506e-04f, 2.19279755e-04f,
+  1.87336947e-04f, 1.59494462e-04f, 1.35320952e-04f, 1.14414666e-04f, 9.64041246e-05f, 8.09481207e-05f,
+  6.64827693e-03f, 6.63678488e-03f, 6.60242699e-03f, 6.54555904e-03f, 6.46676542e-03f, 6.36685174e-03f,
+  6.24682894e-03f, 6.10789750e-03f, 5.95142739e-03f, 5.77893434e-03f, 5.59205795e-03f, 5.39253280e-03f,
+  5.18216426e-03f, 4.96280054e-03f, 4.73630521e-03f, 4.50453348e-03f, 4.26930562e-03f, 4.03238367e-03f,
+  3.79545428e-03f, 3.56010580e-03f, 3.32781579e-03f, 3.09993746e-03f, 2.87768873e-03f, 2.66214670e-03f,
+  2.45424197e-03f, 2.25475850e-03f, 2.06433376e-03f, 1.88346289e-03f, 1.71250349e-03f, 1.55168341e-03f,
+  1.40110939e-03f, 1.26077665e-03f, 1.13058079e-03f, 1.01032760e-03f, 8.99746432e-04f, 7.98500725e-04f,
+  7.06199964e-04f, 6.22411142e-04f, 5.46668773e-04f, 4.78485133e-04f, 4.17359057e-04f, 3.62784311e-04f,
+  3.14256613e-04f, 2.71279889e-04f, 2.33371597e-04f, 2.00067094e-04f, 1.70923027e-04f, 1.45520025e-04f,
+  1.23464517e-04f, 1.04389990e-04f, 8.79574800e-05f, 7.38556846e-05f, 6.04482181e-03f, 6.03437284e-03f,
+  6.00313349e-03f, 5.95142739e-03f, 5.87978587e-03f, 5.78894140e-03f, 5.67981275e-03f, 5.55349188e-03f,
+  5.41122444e-03f, 5.25438832e-03f, 5.08447411e-03f, 4.90305992e-03f, 4.71178629e-03f, 4.51233378e-03f,
+  4.30639740e-03f, 4.09566332e-03f, 3.88178625e-03f, 3.66636971e-03f, 3.45094595e-03f, 3.23695969e-03f,
+  3.02575459e-03f, 2.81856046e-03f, 2.61648488e-03f, 2.42050714e-03f, 2.23147380e-03f, 2.05009710e-03f,
+  1.87695702e-03f, 1.71250349e-03f, 1.55706191e-03f, 1.41083926e-03f, 1.27393252e-03f, 1.14633772e-03f,
+  1.02795940e-03f, 9.18621547e-04f, 8.18077708e-04f, 7.26021884e-04f, 6.42099185e-04f, 5.65915718e-04f,
+  4.97048371e-04f, 4.35053662e-04f, 3.79475940e-04f, 3.29854869e-04f, 2.85731978e-04f, 2.46656185e-04f,
+  2.12188781e-04f, 1.81907279e-04f, 1.55408576e-04f, 1.32311368e-04f, 1.12257811e-04f, 9.49146488e-05f,
+  7.99736954e-05f, 6.71519083e-05f, 5.47715649e-03f, 5.46768866e-03f, 5.43938344e-03f, 5.39253280e-03f,
+  5.32761915e-03f, 5.24530560e-03f, 5.14642522e-03f, 5.03196707e-03f, 4.90305992e-03f, 4.76095220e-03f,
+  4.60699480e-03f, 4.44261683e-03f, 4.26930562e-03f, 4.08858340e-03f, 3.90198641e-03f, 3.71104223e-03f,
+  3.51725030e-03f, 3.32206348e-03f, 3.12686991e-03f, 2.93297903e-03f, 2.74160784e-03f, 2.55387113e-03f,
+  2.37077242e-03f, 2.19319900e-03f, 2.02191737e-03f, 1.85757375e-03f, 1.70069316e-03f, 1.55168341e-03f,
+  1.41083926e-03f, 1.27834827e-03f, 1.15429831e-03f, 1.03868591e-03f, 9.31424438e-04f, 8.32354417e-04f,
+  7.41252559e-04f, 6.57841621e-04f, 5.81800065e-04f, 5.12770959e-04f, 4.50370921e-04f, 3.94198054e-04f,
+  3.43839609e-04f, 2.98878411e-04f, 2.58899061e-04f, 2.23492854e-04f, 1.92262261e-04f, 1.64824480e-04f,
+  1.40814256e-04f, 1.19886092e-04f, 1.01715756e-04f, 8.60012733e-05f, 7.24634156e-05f, 6.08457121e-05f,
+  4.94565768e-03f, 4.93710861e-03f, 4.91154986e-03f, 4.86924592e-03f, 4.81063128e-03f, 4.73630521e-03f,
+  4.64702025e-03f, 4.54366906e-03f, 4.42727096e-03f, 4.29895334e-03f, 4.15993575e-03f, 4.01150854e-03f,
+  3.85501562e-03f, 3.69183067e-03f, 3.52334091e-03f, 3.35092563e-03f, 3.17593920e-03f, 2.99969316e-03f,
+  2.82344106e-03f, 2.64836499e-03f, 2.47556460e-03f, 2.30604550e-03f, 2.14071479e-03f, 1.98037270e-03f,
+  1.82571227e-03f, 1.67731638e-03f, 1.53565931e-03f, 1.40110939e-03f, 1.27393252e-03f, 1.15429831e-03f,
+  1.04228617e-03f, 9.37892648e-04f, 8.41039757e-04f, 7.51583430e-04f, 6.69321977e-04f, 5.94005222e-04f,
+  5.25342650e-04f, 4.63012082e-04f, 4.06667270e-04f, 3.55945405e-04f, 3.10473697e-04f, 2.69875512e-04f,
+  2.33775703e-04f, 2.01805291e-04f, 1.73605295e-04f, 1.48830048e-04f, 1.27149760e-04f, 1.08252447e-04f,
+  9.18453443e-05f, 7.76557790e-05f, 6.54316245e-05f, 5.49412944e-05f, 4.45030956e-03f, 4.44261683e-03f,
+  4.41961782e-03f, 4.38155094e-03f, 4.32880688e-03f, 4.26192535e-03f, 4.18158295e-03f, 4.08858340e-03f,
+  3.98384314e-03f, 3.86837777e-03f, 3.74328392e-03f, 3.60972318e-03f, 3.46890395e-03f, 3.32206348e-03f,
+  3.17044929e-03f, 3.01530282e-03f, 2.85784272e-03f, 2.69924919e-03f, 2.54065008e-03f, 2.38310965e-03f,
+  2.22761626e-03f, 2.07507610e-03f, 1.92630454e-03f, 1.78202207e-03f, 1.64285221e-03f, 1.50931929e-03f,
+  1.38185045e-03f, 1.26077665e-03f, 1.14633772e-03f, 1.03868591e-03f, 9.37892648e-04f, 8.43954971e-04f,
+  7.56802736e-04f, 6.76306139e-04f, 6.02283922e-04f, 5.34510706e-04f, 4.72725282e-04f, 4.16637602e-04f,
+  3.65936197e-04f, 3.20294552e-04f, 2.79377186e-04f, 2.42845257e-04f, 2.10361148e-04f, 1.81592826e-04f,
+  1.56217298e-04f, 1.33923502e-04f, 1.14414666e-04f, 9.74100694e-05f, 8.26462783e-05f, 6.98779186e-05f,
+  5.88781113e-05f, 4.94384731e-05f, 3.99074191e-03f, 3.98384314e-03f, 3.96321947e-03f, 3.92908324e-03f,
+  3.88178625e-03f, 3.82181141e-03f, 3.74976569e-03f, 3.66636971e-03f, 3.57244583e-03f, 3.46890395e-03f,
+  3.35672800e-03f, 3.23695969e-03f, 3.11068259e-03f, 2.97900569e-03f, 2.84304819e-03f, 2.70392327e-03f,
+  2.56272336e-03f, 2.42050714e-03f, 2.27828603e-03f, 2.13701418e-03f, 1.99757819e-03f, 1.86079042e-03f,
+  1.72738184e-03f, 1.59799890e-03f, 1.47320062e-03f, 1.35345722e-03f, 1.23915158e-03f, 1.13058079e-03f,
+  1.02795940e-03f, 9.31424438e-04f, 8.41039757e-04f, 7.56802736e-04f, 6.78650395e-04f, 6.06466434e-04f,
+  5.40088164e-04f, 4.79313661e-04f, 4.23908583e-04f, 3.73612915e-04f, 3.28147260e-04f, 2.87218863e-04f,
+  2.50526908e-04f, 2.17767476e-04f, 1.88637889e-04f, 1.62840384e-04f, 1.40085278e-04f, 1.20093689e-04f,
+  1.02599464e-04f, 8.73508761e-05f, 7.41116819e-05f, 6.26618712e-05f, 5.27979755e-05f, 4.43331373e-05f,
+  3.56627046e-03f, 3.56010580e-03f, 3.54167563e-03f, 3.51117039e-03f, 3.46890395e-03f, 3.41530819e-03f,
+  3.35092563e-03f, 3.27640004e-03f, 3.19246622e-03f, 3.09993746e-03f, 2.99969316e-03f, 2.89266370e-03f,
+  2.77981791e-03f, 2.66214670e-03f, 2.54065008e-03f, 2.41632317e-03f, 2.29014200e-03f, 2.16305233e-03f,
+  2.03595846e-03f, 1.90971280e-03f, 1.78510789e-03f, 1.66286924e-03f, 1.54365052e-03f, 1.42802938e-03f,
+  1.31650514e-03f, 1.20949815e-03f, 1.10735046e-03f, 1.01032760e-03f, 9.18621547e-04f, 8.32354417e-04f,
+  7.51583430e-04f, 6.76306139e-04f, 6.06466434e-04f, 5.41960238e-04f, 4.82642208e-04f, 4.28331958e-04f,
+  3.78819968e-04f, 3.33873963e-04f, 2.93244200e-04f, 2.56669096e-04f, 2.23879848e-04f, 1.94604858e-04f,
+  1.68573606e-04f, 1.45520025e-04f, 1.25185252e-04f, 1.07320040e-04f, 9.16865756e-05f, 7.80598857e-05f,
+  6.62288730e-05f, 5.59969048e-05f, 4.71821731e-05f, 3.96176874e-05f, 3.17593920e-03f, 3.17044929e-03f,
+  3.15403636e-03f, 3.12686991e-03f, 3.08922958e-03f, 3.04149999e-03f, 2.98416405e-03f, 2.91779544e-03f,
+  2.84304819e-03f, 2.76064686e-03f, 2.67137424e-03f, 2.57605943e-03f, 2.47556460e-03f, 2.37077242e-03f,
+  2.26257392e-03f, 2.15185457e-03f, 2.03948398e-03f, 1.92630454e-03f, 1.81312114e-03f, 1.70069316e-03f,
+  1.58972631e-03f, 1.48086681e-03f, 1.37469673e-03f, 1.27173041e-03f, 1.17241254e-03f, 1.07711751e-03f,
+  9.86150000e-04f, 8.99746432e-04f, 8.18077708e-04f, 7.41252559e-04f, 6.69321977e-04f, 6.02283922e-04f,
+  5.40088164e-04f, 4.82642208e-04f, 4.29816631e-04f, 3.81450664e-04f, 3.37357807e-04f, 2.97331164e-04f,
+  2.61148380e-04f, 2.28576464e-04f, 1.99376023e-04f, 1.73305190e-04f, 1.50123087e-04f, 1.29592736e-04f,
+  1.11483627e-04f, 9.55737778e-05f, 8.16514075e-05f, 6.95161725e-05f, 5.89800657e-05f, 4.98679947e-05f,
+  4.20180440e-05f, 3.52814968e-05f, 2.81856046e-03f, 2.81368825e-03f, 2.79912213e-03f, 2.77501275e-03f,
+  2.74160784e-03f, 2.69924919e-03f, 2.64836499e-03f, 2.58946465e-03f, 2.52312841e-03f, 2.44999956e-03f,
+  2.37077242e-03f, 2.28618318e-03f, 2.19699671e-03f, 2.10399670e-03f, 2.00797338e-03f, 1.90971280e-03f,
+  1.80998701e-03f, 1.70954328e-03f, 1.60909607e-03f, 1.50931929e-03f, 1.41083926e-03f, 1.31422933e-03f,
+  1.22000626e-03f, 1.12862641e-03f, 1.04048452e-03f, 9.55912750e-04f, 8.75181518e-04f, 7.98500725e-04f,
+  7.26021884e-04f, 6.57841621e-04f, 5.94005222e-04f, 5.34510706e-04f, 4.79313661e-04f, 4.28331958e-04f,
+  3.81450664e-04f, 3.38527170e-04f, 2.99395964e-04f, 2.63873400e-04f, 2.31762155e-04f, 2.02855445e-04f,
+  1.76940841e-04f, 1.53803689e-04f, 1.33230191e-04f, 1.15010058e-04f, 9.89387117e-05f, 8.48191485e-05f,
+  7.24634156e-05f, 6.16937250e-05f, 5.23432172e-05f, 4.42564997e-05f, 3.72898794e-05f, 3.13113778e-05f,
+  2.49275588e-03f, 2.48844689e-03f, 2.47556460e-03f, 2.45424197e-03f, 2.42469856e-03f, 2.38723611e-03f,
+  2.34223390e-03f, 2.29014200e-03f, 2.23147380e-03f, 2.16679787e-03f, 2.09672889e-03f, 2.02191737e-03f,
+  1.94304029e-03f, 1.86079042e-03f, 1.77586661e-03f, 1.68896432e-03f, 1.60076609e-03f, 1.51193282e-03f,
+  1.42309663e-03f, 1.33485324e-03f, 1.24775677e-03f, 1.16231432e-03f, 1.07898272e-03f, 9.98165691e-04f,
+  9.20212246e-04f, 8.45416391e-04f, 7.74017128e-04f, 7.06199964e-04f, 6.42099185e-04f, 5.81800065e-04f,
+  5.25342650e-04f, 4.72725282e-04f, 4.23908583e-04f, 3.78819968e-04f, 3.37357807e-04f, 2.99395964e-04f,
+  2.64788017e-04f, 2.33371597e-04f, 2.04972181e-04f, 1.79406867e-04f, 1.56487804e-04f, 1.36025134e-04f,
+  1.17829783e-04f, 1.01715756e-04f, 8.75021360e-05f, 7.50146864e-05f, 6.40871876e-05f, 5.45623916e-05f,
+  4.62927310e-05f, 3.91407812e-05f, 3.29794493e-05f, 2.76920164e-05f, 2.19699671e-03f, 2.19319900e-03f,
+  2.18184502e-03f, 2.16305233e-03f, 2.13701418e-03f, 2.10399670e-03f, 2.06433376e-03f, 2.01842235e-03f,
+  1.96671509e-03f, 1.90971280e-03f, 1.84795738e-03f, 1.78202207e-03f, 1.71250349e-03f, 1.64001225e-03f,
+  1.56516454e-03f, 1.48857303e-03f, 1.41083926e-03f, 1.33254589e-03f, 1.25424983e-03f, 1.17647636e-03f,
+  1.09971361e-03f, 1.02440862e-03f, 9.50964110e-04f, 8.79735802e-04f, 8.11031379e-04f, 7.45109865e-04f,
+  6.82181912e-04f, 6.22411142e-04f, 5.65915718e-04f, 5.12770959e-04f, 4.63012082e-04f, 4.16637602e-04f,
+  3.73612915e-04f, 3.33873963e-04f, 2.97331164e-04f, 2.63873400e-04f, 2.33371597e-04f, 2.05682649e-04f,
+  1.80652743e-04f, 1.58120703e-04f, 1.37920913e-04f, 1.19886092e-04f, 1.03849576e-04f, 8.96474376e-05f,
+  7.71202249e-05f, 6.61143858e-05f, 5.64834081e-05f, 4.80887029e-05f, 4.08002161e-05f, 3.44968248e-05f,
+  2.90665212e-05f, 2.44064286e-05f, 1.92964007e-03f, 1.92630454e-03f, 1.91633229e-03f, 1.89982646e-03f,
+  1.87695702e-03f, 1.84795738e-03f, 1.81312114e-03f, 1.77279685e-03f, 1.72738184e-03f, 1.67731638e-03f,
+  1.62307604e-03f, 1.56516454e-03f, 1.50410575e-03f, 1.44043611e-03f, 1.37469673e-03f, 1.30742579e-03f,
+  1.23915158e-03f, 1.17038586e-03f, 1.10161782e-03f, 1.03330880e-03f, 9.65887390e-04f, 8.99746432e-04f,
+  8.35239538e-04f, 7.72679108e-04f, 7.12335517e-04f, 6.54436066e-04f, 5.99165971e-04f, 5.46668773e-04f,
+  4.97048371e-04f, 4.50370921e-04f, 4.06667270e-04f, 3.65936197e-04f, 3.28147260e-04f, 2.93244200e-04f,
+  2.61148380e-04f, 2.31762155e-04f, 2.04972181e-04f, 1.80652743e-04f, 1.58668787e-04f, 1.38878706e-04f,
+  1.21137069e-04f, 1.05296931e-04f, 9.12119285e-05f, 7.87380777e-05f, 6.77353237e-05f, 5.80688029e-05f,
+  4.96098364e-05f, 4.22366975e-05f, 3.58351645e-05f, 3.02988428e-05f, 2.55293635e-05f, 2.14363645e-05f,
+  1.68896432e-03f, 1.68604474e-03f, 1.67731638e-03f, 1.66286924e-03f, 1.64285221e-03f, 1.61746959e-03f,
+  1.58697832e-03f, 1.55168341e-03f, 1.51193282e-03f, 1.46811188e-03f, 1.42063666e-03f, 1.36994827e-03f,
+  1.31650514e-03f, 1.26077665e-03f, 1.20323664e-03f, 1.14435609e-03f, 1.08459743e-03f, 1.02440862e-03f,
+  9.64217761e-04f, 9.04428540e-04f, 8.45416391e-04f, 7.87524914e-04f, 7.31063657e-04f, 6.76306139e-04f,
+  6.23488915e-04f, 5.72811055e-04f, 5.24434552e-04f, 4.78485133e-04f, 4.35053662e-04f, 3.94198054e-04f,
+  3.55945405e-04f, 3.20294552e-04f, 2.87218863e-04f, 2.56669096e-04f, 2.28576464e-04f, 2.02855445e-04f,
+  1.79406867e-04f, 1.58120703e-04f, 1.38878706e-04f, 1.21556950e-04f, 1.06028157e-04f, 9.21636965e-05f,
+  7.98354522e-05f, 6.89174121e-05f, 5.92869874e-05f, 5.08261292e-05f, 4.34222129e-05f, 3.69686968e-05f,
+  3.13655946e-05f, 2.65197978e-05f, 2.23451934e-05f, 1.87626993e-05f, 1.47320062e-03f, 1.47065404e-03f,
+  1.46304059e-03f, 1.45043910e-03f, 1.43297925e-03f, 1.41083926e-03f, 1.38424325e-03f, 1.35345722e-03f,
+  1.31878478e-03f, 1.28056179e-03f, 1.23915158e-03f, 1.19493855e-03f, 1.14832271e-03f, 1.09971361e-03f,
+  1.04952429e-03f, 9.98165691e-04f, 9.46041080e-04f, 8.93541321e-04f, 8.41039757e-04f, 7.88888603e-04f,
+  7.37415161e-04f, 6.86919317e-04f, 6.37670921e-04f, 5.89908625e-04f, 5.43838774e-04f, 4.99634945e-04f,
+  4.57438495e-04f, 4.17359057e-04f, 3.79475940e-04f, 3.43839609e-04f, 3.10473697e-04f, 2.79377186e-04f,
+  2.50526908e-04f, 2.23879848e-04f, 1.99376023e-04f, 1.76940841e-04f, 1.56487804e-04f, 1.37920913e-04f,
+  1.21137069e-04f, 1.06028157e-04f, 9.24831547e-05f, 8.03898656e-05f, 6.96365460e-05f, 6.01132706e-05f,
+  5.17131266e-05f, 4.43331373e-05f, 3.78750628e-05f, 3.22459782e-05f, 2.73586684e-05f, 2.31319173e-05f,
+  1.94906152e-05f, 1.63657805e-05f, 1.28056179e-03f, 1.27834827e-03f, 1.27173041e-03f, 1.26077665e-03f,
+  1.24559982e-03f, 1.22635497e-03f, 1.20323664e-03f, 1.17647636e-03f, 1.14633772e-03f, 1.11311290e-03f,
+  1.07711751e-03f, 1.03868591e-03f, 9.98165691e-04f, 9.55912750e-04f, 9.12286283e-04f, 8.67643394e-04f,
+  8.22334783e-04f, 7.76699977e-04f, 7.31063657e-04f, 6.85731880e-04f, 6.40989223e-04f, 5.97096281e-04f,
+  5.54287748e-04f, 5.12770959e-04f, 4.72725282e-04f, 4.34301648e-04f, 3.97622876e-04f, 3.62784311e-04f,
+  3.29854869e-04f, 2.98878411e-04f, 2.69875512e-04f, 2.42845257e-04f, 2.17767476e-04f, 1.94604858e-04f,
+  1.73305190e-04f, 1.53803689e-04f, 1.36025134e-04f, 1.19886092e-04f, 1.05296931e-04f, 9.21636965e-05f,
+  8.03898656e-05f, 6.98779186e-05f, 6.05307250e-05f, 5.22527371e-05f, 4.49510080e-05f, 3.85360436e-05f,
+  3.29224422e-05f, 2.80294262e-05f, 2.37811928e-05f, 2.01071398e-05f, 1.69419818e-05f, 1.42257568e-05f,
+  1.10926793e-03f, 1.10735046e-03f, 1.10161782e-03f, 1.09212939e-03f, 1.07898272e-03f, 1.06231205e-03f,
+  1.04228617e-03f, 1.01910543e-03f, 9.92998248e-04f, 9.64217761e-04f, 9.33037314e-04f, 8.99746432e-04f,
+  8.64646398e-04f, 8.28045420e-04f, 7.90254620e-04f, 7.51583430e-04f, 7.12335517e-04f, 6.72805007e-04f,
+  6.33273215e-04f, 5.94005222e-04f, 5.55247534e-04f, 5.17225941e-04f, 4.80143644e-04f, 4.44180332e-04f,
+  4.09491360e-04f, 3.76207434e-04f, 3.44434986e-04f, 3.14256613e-04f, 2.85731978e-04f, 2.58899061e-04f,
+  2.33775703e-04f, 2.10361148e-04f, 1.88637889e-04f, 1.68573606e-04f, 1.50123087e-04f, 1.33230191e-04f,
+  1.17829783e-04f, 1.03849576e-04f, 9.12119285e-05f, 7.98354522e-05f, 6.96365460e-05f, 6.05307250e-05f,
+  5.24338539e-05f, 4.52631684e-05f, 3.89381530e-05f, 3.33812823e-05f, 2.85185833e-05f, 2.42800797e-05f,
+  2.06001096e-05f, 1.74175148e-05f, 1.46757438e-05f, 1.23228538e-05f, 9.57568001e-04f, 9.55912750e-04f,
+  9.50964110e-04f, 9.42773244e-04f, 9.31424438e-04f, 9.17033642e-04f, 8.99746432e-04f, 8.79735802e-04f,
+  8.57199018e-04f, 8.32354417e-04f, 8.05438089e-04f, 7.76699977e-04f, 7.46400096e-04f, 7.14804570e-04f,
+  6.82181912e-04f, 6.48799294e-04f, 6.14918768e-04f, 5.80794353e-04f, 5.46668773e-04f, 5.12770959e-04f,
+  4.79313661e-04f, 4.46491758e-04f, 4.14480746e-04f, 3.83435661e-04f, 3.53490614e-04f, 3.24758497e-04f,
+  2.97331164e-04f, 2.71279889e-04f, 2.46656185e-04f, 2.23492854e-04f, 2.01805291e-04f, 1.81592826e-04f,
+  1.62840384e-04f, 1.45520025e-04f, 1.29592736e-04f, 1.15010058e-04f, 1.01715756e-04f, 8.96474376e-05f,
+  7.87380777e-05f, 6.89174121e-05f, 6.01132706e-05f, 5.22527371e-05f, 4.52631684e-05f, 3.90731220e-05f,
+  3.36130979e-05f, 2.88161664e-05f, 2.46184736e-05f, 2.09596146e-05f, 1.77829043e-05f, 1.50355518e-05f,
+  1.26687364e-05f, 1.06376201e-05f, 8.23758775e-04f, 8.22334783e-04f, 8.18077708e-04f, 8.11031379e-04f,
+  8.01268441e-04f, 7.88888603e-04f, 7.74017128e-04f, 7.56802736e-04f, 7.37415161e-04f, 7.16042356e-04f,
+  6.92887290e-04f, 6.68164983e-04f, 6.42099185e-04f, 6.14918768e-04f, 5.86854760e-04f, 5.58136962e-04f,
+  5.28990873e-04f, 4.99634945e-04f, 4.70278028e-04f, 4.41117038e-04f, 4.12335037e-04f, 3.84099607e-04f,
+  3.56561766e-04f, 3.29854869e-04f, 3.04094312e-04f, 2.79377186e-04f, 2.55782506e-04f, 2.33371597e-04f,
+  2.12188781e-04f, 1.92262261e-04f, 1.73605295e-04f, 1.56217298e-04f, 1.40085278e-04f, 1.25185252e-04f,
+  1.11483627e-04f, 9.89387117e-05f, 8.75021360e-05f, 7.71202249e-05f, 6.77353237e-05f, 5.92869874e-05f,
+  5.17131266e-05f, 4.49510080e-05f, 3.89381530e-05f, 3.36130979e-05f, 2.89160489e-05f, 2.47894332e-05f,
+  2.11783208e-05f, 1.80307452e-05f, 1.52979464e-05f, 1.29345044e-05f, 1.08984241e-05f, 9.15113287e-06f,
+  7.06199964e-04f, 7.04979233e-04f, 7.01329671e-04f, 6.95288938e-04f, 6.86919317e-04f, 6.76306139e-04f,
+  6.63556973e-04f, 6.48799294e-04f, 6.32178504e-04f, 6.13855838e-04f, 5.94005222e-04f, 5.72811055e-04f,
+  5.50465076e-04f, 5.27163618e-04f, 5.03104588e-04f, 4.78485133e-04f, 4.53498476e-04f, 4.28331958e-04f,
+  4.03164566e-04f, 3.78165161e-04f, 3.53490614e-04f, 3.29284696e-04f, 3.05676775e-04f, 2.82781228e-04f,
+  2.60696979e-04f, 2.39507222e-04f, 2.19279755e-04f, 2.00067094e-04f, 1.81907279e-04f, 1.64824480e-04f,
+  1.48830048e-04f, 1.33923502e-04f, 1.20093689e-04f, 1.07320040e-04f, 9.55737778e-05f, 8.48191485e-05f,
+  7.50146864e-05f, 6.61143858e-05f, 5.80688029e-05f, 5.08261292e-05f, 4.43331373e-05f, 3.85360436e-05f,
+  3.33812823e-05f, 2.88161664e-05f, 2.47894332e-05f, 2.12517298e-05f, 1.81559590e-05f, 1.54575755e-05f,
+  1.31147726e-05f, 1.10886185e-05f, 9.34310810e-06f, 7.84517306e-06f, 6.03326829e-04f, 6.02283922e-04f,
+  5.99165971e-04f, 5.94005222e-04f, 5.86854760e-04f, 5.77787636e-04f, 5.66895702e-04f, 5.54287748e-04f,
+  5.40088164e-04f, 5.24434552e-04f, 5.07475634e-04f, 4.89368860e-04f, 4.70278028e-04f, 4.50370921e-04f,
+  4.29816631e-04f, 4.08783497e-04f, 3.87436681e-04f, 3.65936197e-04f, 3.44434986e-04f, 3.23077285e-04f,
+  3.01997119e-04f, 2.81317305e-04f, 2.61148380e-04f, 2.41588074e-04f, 2.22720861e-04f, 2.04617856e-04f,
+  1.87336947e-04f, 1.70923027e-04f, 1.55408576e-04f, 1.40814256e-04f, 1.27149760e-04f, 1.14414666e-04f,
+  1.02599464e-04f, 9.16865756e-05f, 8.16514075e-05f, 7.24634156e-05f, 6.40871876e-05f, 5.64834081e-05f,
+  4.96098364e-05f, 4.34222129e-05f, 3.78750628e-05f, 3.29224422e-05f, 2.85185833e-05f, 2.46184736e-05f,
+  2.11783208e-05f, 1.81559590e-05f, 1.55111538e-05f, 1.32058476e-05f, 1.12043253e-05f, 9.47332319e-06f,
+  7.98208384e-06f, 6.70235568e-06f, 5.13658859e-04f, 5.12770959e-04f, 5.10116399e-04f, 5.05722652e-04f,
+  4.99634945e-04f, 4.91915387e-04f, 4.82642208e-04f, 4.71908104e-04f, 4.59818897e-04f, 4.46491758e-04f,
+  4.32053319e-04f, 4.16637602e-04f, 4.00384131e-04f, 3.83435661e-04f, 3.65936197e-04f, 3.48029076e-04f,
+  3.29854869e-04f, 3.11549840e-04f, 2.93244200e-04f, 2.75060738e-04f, 2.57113570e-04f, 2.39507222e-04f,
+  2.22335861e-04f, 2.05682649e-04f, 1.89619532e-04f, 1.74207045e-04f, 1.59494462e-04f, 1.45520025e-04f,
+  1.32311368e-04f, 1.19886092e-04f, 1.08252447e-04f, 9.74100694e-05f, 8.73508761e-05f, 7.80598857e-05f,
+  6.95161725e-05f, 6.16937250e-05f, 5.45623916e-05f, 4.80887029e-05f, 4.22366975e-05f, 3.69686968e-05f,
+  3.22459782e-05f, 2.80294262e-05f, 2.42800797e-05f, 2.09596146e-05f, 1.80307452e-05f, 1.54575755e-05f,
+  1.32058476e-05f, 1.12431617e-05f, 9.53911058e-06f, 8.06537446e-06f, 6.79576669e-06f, 5.70623479e-06f,
+  4.35807015e-04f, 4.35053662e-04f, 4.32801462e-04f, 4.29073640e-04f, 4.23908583e-04f, 4.17359057e-04f,
+  4.09491360e-04f, 4.00384131e-04f, 3.90127214e-04f, 3.78819968e-04f, 3.66569875e-04f, 3.53490614e-04f,
+  3.39700578e-04f, 3.25320871e-04f, 3.10473697e-04f, 2.95280624e-04f, 2.79860978e-04f, 2.64330301e-04f,
+  2.48799130e-04f, 2.33371597e-04f, 2.18144560e-04f, 2.03206713e-04f, 1.88637889e-04f, 1.74508707e-04f,
+  1.60880154e-04f, 1.47803643e-04f, 1.35320952e-04f, 1.23464517e-04f, 1.12257811e-04f, 1.01715756e-04f,
+  9.18453443e-05f, 8.26462783e-05f, 7.41116819e-05f, 6.62288730e-05f, 5.89800657e-05f, 5.23432172e-05f,
+  4.62927310e-05f, 4.08002161e-05f, 3.58351645e-05f, 3.13655946e-05f, 2.73586684e-05f, 2.37811928e-05f,
+  2.06001096e-05f, 1.77829043e-05f, 1.52979464e-05f, 1.31147726e-05f, 1.12043253e-05f, 9.53911058e-06f,
+  8.09333051e-06f, 6.84295901e-06f, 5.76577759e-06f, 4.84137854e-06f, 3.68477427e-04f, 3.67840461e-04f,
+  3.65936197e-04f, 3.62784311e-04f, 3.58417252e-04f, 3.52879579e-04f, 3.46227374e-04f, 3.38527170e-04f,
+  3.29854869e-04f, 3.20294552e-04f, 3.09936993e-04f, 2.98878411e-04f, 2.87218863e-04f, 2.75060738e-04f,
+  2.62507354e-04f, 2.49661534e-04f, 2.36624110e-04f, 2.23492854e-04f, 2.10361148e-04f, 1.97317073e-04f,
+  1.84442528e-04f, 1.71812484e-04f, 1.59494462e-04f, 1.47548140e-04f, 1.36025134e-04f, 1.24968850e-04f,
+  1.14414666e-04f, 1.04389990e-04f, 9.49146488e-05f, 8.60012733e-05f, 7.76557790e-05f, 6.98779186e-05f,
+  6.26618712e-05f, 5.59969048e-05f, 4.98679947e-05f, 4.42564997e-05f, 3.91407812e-05f, 3.44968248e-05f,
+  3.02988428e-05f, 2.65197978e-05f, 2.31319173e-05f, 2.01071398e-05f, 1.74175148e-05f, 1.50355518e-05f,
+  1.29345044e-05f, 1.10886185e-05f, 9.47332319e-06f, 8.06537446e-06f, 6.84295901e-06f, 5.78576282e-06f,
+  4.87499892e-06f, 4.09341419e-06f, 3.10473697e-04f, 3.09936993e-04f, 3.08332499e-04f, 3.05676775e-04f,
+  3.01997119e-04f, 2.97331164e-04f, 2.91726115e-04f, 2.85238057e-04f, 2.77930900e-04f, 2.69875512e-04f,
+  2.61148380e-04f, 2.51830585e-04f, 2.42006412e-04f, 2.31762155e-04f, 2.21184862e-04f, 2.10361148e-04f,
+  1.99376023e-04f, 1.88311809e-04f, 1.77247231e-04f, 1.66256490e-04f, 1.55408576e-04f, 1.44766687e-04f,
+  1.34387708e-04f, 1.24321916e-04f, 1.14612783e-04f, 1.05296931e-04f, 9.64041246e-05f, 8.79574800e-05f,
+  7.99736954e-05f, 7.24634156e-05f, 6.54316245e-05f, 5.88781113e-05f, 5.27979755e-05f, 4.71821731e-05f,
+  4.20180440e-05f, 3.72898794e-05f, 3.29794493e-05f, 2.90665212e-05f, 2.55293635e-05f, 2.23451934e-05f,
+  1.94906152e-05f, 1.69419818e-05f, 1.46757438e-05f, 1.26687364e-05f, 1.08984241e-05f, 9.34310810e-06f,
+  7.98208384e-06f, 6.79576669e-06f, 5.76577759e-06f, 4.87499892e-06f, 4.10760322e-06f, 3.44905106e-06f,
+  2.60696979e-04f, 2.60246336e-04f, 2.58899061e-04f, 2.56669096e-04f, 2.53579405e-04f, 2.49661534e-04f,
+  2.44955096e-04f, 2.39507222e-04f, 2.33371597e-04f, 2.26607692e-04f, 2.19279755e-04f, 2.11455830e-04f,
+  2.03206713e-04f, 1.94604858e-04f, 1.85723373e-04f, 1.76634974e-04f, 1.67411039e-04f, 1.58120703e-04f,
+  1.48830048e-04f, 1.39601398e-04f, 1.30492685e-04f, 1.21556950e-04f, 1.12841983e-04f, 1.04389990e-04f,
+  9.62374834e-05f, 8.84151887e-05f, 8.09481207e-05f, 7.38556846e-05f, 6.71519083e-05f, 6.08457121e-05f,
+  5.49412944e-05f, 4.94384731e-05f, 4.43331373e-05f, 3.96176874e-05f, 3.52814968e-05f, 3.13113778e-05f,
+  2.76920164e-05f, 2.44064286e-05f, 2.14363645e-05f, 1.87626993e-05f, 1.63657805e-05f, 1.42257568e-05f,
+  1.23228538e-05f, 1.06376201e-05f, 9.15113287e-06f, 7.84517306e-06f, 6.70235568e-06f, 5.70623479e-06f,
+  4.84137854e-06f, 4.09341419e-06f, 3.44905106e-06f, 2.89608170e-06f
+};
+static const float kern_row_17[] = {
+  2.61336390e-04f, 3.11235199e-04f, 3.69381218e-04f, 4.36875940e-04f, 5.14918764e-04f, 6.04806643e-04f,
+  7.07932108e-04f, 8.25779221e-04f, 9.59916681e-04f, 1.11198868e-03f, 1.28370279e-03f, 1.47681404e-03f,
+  1.69310695e-03f, 1.93437305e-03f, 2.20238534e-03f, 2.49887002e-03f, 2.82547367e-03f, 3.18372902e-03f,
+  3.57501768e-03f, 4.00053011e-03f, 4.46122512e-03f, 4.95778816e-03f, 5.49059082e-03f, 6.05964847e-03f,
+  6.66458346e-03f, 7.30459066e-03f, 7.97840301e-03f, 8.68427008e-03f, 9.41993576e-03f, 1.01826256e-02f,
+  1.09690465e-02f, 1.17753884e-02f, 1.25973402e-02f, 1.34301148e-02f, 1.42684840e-02f, 1.51068242e-02f,
+  1.59391724e-02f, 1.67592913e-02f, 1.75607372e-02f, 1.83369517e-02f, 1.90813337e-02f, 1.97873488e-02f,
+  2.04486065e-02f, 2.10589692e-02f, 2.16126349e-02f, 2.21042391e-02f, 2.25289371e-02f, 2.28824783e-02f,
+  2.31612865e-02f, 2.33625136e-02f, 2.34840866e-02f, 2.35247519e-02f, 2.34840866e-02f, 2.33625136e-02f,
+  2.31612865e-02f, 2.28824783e-02f, 2.25289371e-02f, 2.21042391e-02f, 2.16126349e-02f, 2.10589692e-02f,
+  2.04486065e-02f, 1.97873488e-02f, 1.90813337e-02f, 1.83369517e-02f, 1.75607372e-02f, 1.67592913e-02f,
+  1.59391724e-02f, 1.51068242e-02f, 1.42684840e-02f, 1.34301148e-02f, 1.25973402e-02f, 1.17753884e-02f,
+  1.09690465e-02f, 1.01826256e-02f, 9.41993576e-03f, 8.68427008e-03f, 7.97840301e-03f, 7.30459066e-03f,
+  6.66458346e-03f, 6.05964847e-03f, 5.49059082e-03f, 4.95778816e-03f, 4.46122512e-03f, 4.00053011e-03f,
+  3.57501768e-03f, 3.18372902e-03f, 2.82547367e-03f, 2.49887002e-03f, 2.20238534e-03f, 1.93437305e-03f,
+  1.69310695e-03f, 1.47681404e-03f, 1.28370279e-03f, 1.11198868e-03f, 9.59916681e-04f, 8.25779221e-04f,
+  7.07932108e-04f, 6.04806643e-04f, 5.14918764e-04f, 4.36875940e-04f, 3.69381218e-04f, 3.11235199e-04f,
+  2.61336390e-04f
+};
+static const int kern_half_fixed_17[] = {
+  9285, 9269, 9221, 9141, 9031, 8892, 8724, 8530, 8312, 8071, 7810, 7531,
+  7237, 6931, 6615, 6291, 5962, 5631, 5301, 4972, 4648, 4329, 4019, 3718,
+  3428, 3149, 2883, 2630, 2392, 2167, 1957, 1761, 1579, 1411, 1257, 1115,
+  986, 869, 763, 668, 583, 507, 439, 379, 326, 279, 239, 203,
+  172, 146, 123, 103, 9269, 9253, 9205, 9126, 9016, 8876, 8709, 8515,
+  8297, 8057, 7796, 7518, 7225, 6919, 6603, 6280, 5952, 5622, 5291, 4963,
+  4639, 4322, 4012, 3711, 3422, 3143, 2878, 2626, 2387, 2163, 1953, 1758,
+  1576, 1409, 1254, 1113, 985, 868, 762, 667, 582, 506, 438, 378,
+  325, 279, 238, 203, 172, 146, 123, 103, 9221, 9205, 9157, 9078,
+  8969, 8830, 8664, 8471, 8254, 8015, 7756, 7479, 7187, 6883, 6569, 6247,
+  5921, 5593, 5264, 4938, 4615, 4299, 3991, 3692, 3404, 3127, 2863, 2612,
+  2375, 2152, 1943, 1749, 1568, 1401, 1248, 1107, 979, 863, 758, 664,
+  579, 503, 436, 376, 324, 277, 237, 202, 171, 145, 122, 102,
+  9141, 9126, 9078, 9000, 8892, 8754, 8589, 8398, 8183, 7946, 7689, 7415,
+  7125, 6824, 6512, 6194, 5870, 5544, 5219, 4895, 4576, 4262, 3957, 3660,
+  3375, 3100, 2838, 2590, 2355, 2134, 1927, 1734, 1555, 1389, 1237, 1098,
+  971, 856, 752, 658, 574, 499, 432, 373, 321, 275, 235, 200,
+  170, 144, 121, 102, 9031, 9016, 8969, 8892, 8785, 8649, 8486, 8297,
+  8085, 7850, 7596, 7325, 7040, 6742, 6434, 6119, 5800, 5478, 5156, 4836,
+  4521, 4211, 3909, 3616, 3334, 3063, 2804, 2559, 2326, 2108, 1903, 1713,
+  1536, 1372, 1222, 1085, 959, 846, 743, 650, 567, 493, 427, 369,
+  317, 272, 232, 198, 168, 142, 119, 100, 8892, 8876, 8830, 8754,
+  8649, 8515, 8355, 8169, 7960, 7729, 7479, 7212, 6931, 6637, 6335, 6025,
+  5710, 5393, 5076, 4761, 4451, 4146, 3849, 3560, 3282, 3016, 2761, 2519,
+  2290, 2075, 1874, 1686, 1512, 1351, 1203, 1068, 945, 832, 731, 640,
+  558, 485, 420, 363, 312, 268, 229, 195, 165, 140, 118, 99,
+  8724, 8709, 8664, 8589, 8486, 8355, 8197, 8015, 7810, 7583, 7338, 7076,
+  6800, 6512, 6215, 5911, 5602, 5291, 4981, 4672, 4367, 4068, 3776, 3493,
+  3221, 2959, 2709, 2472, 2247, 2036, 1839, 1654, 1484, 1326, 1181, 1048,
+  927, 817, 717, 628, 548, 476, 412, 356, 306, 263, 224, 191,
+  162, 137, 115, 97, 8530, 8515, 8471, 8398, 8297, 8169, 8015, 7837,
+  7636, 7415, 7175, 6919, 6649, 6368, 6077, 5780, 5478, 5174, 4870, 4568,
+  4270, 3977, 3692, 3416, 3149, 2893, 2649, 2417, 2197, 1991, 1798, 1618,
+  1451, 1296, 1154, 1025, 906, 799, 701, 614, 535, 465, 403, 348,
+  299, 257, 219, 187, 158, 134, 113, 95, 8312, 8297, 8254, 8183,
+  8085, 7960, 7810, 7636, 7440, 7225, 6991, 6742, 6479, 6204, 5921, 5631,
+  5337, 5041, 4745, 4451, 4160, 3875, 3598, 3328, 3068, 2819, 2581, 2355,
+  2141, 1940, 1752, 1576, 1413, 1263, 1125, 998, 883, 778, 683, 598,
+  522, 454, 393, 339, 292, 250, 214, 182, 154, 131, 110, 92,
+  8071, 8057, 8015, 7946, 7850, 7729, 7583, 7415, 7225, 7015, 6788, 6546,
+  6291, 6025, 5750, 5468, 5183, 4895, 4607, 4322, 4040, 3763, 3493, 3232,
+  2979, 2737, 2506, 2286, 2079, 1884, 1701, 1531, 1372, 1226, 1092, 969,
+  857, 756, 664, 581, 507, 440, 381, 329, 283, 243, 207, 177,
+  150, 127, 107, 90, 7810, 7796, 7756, 7689, 7596, 7479, 7338, 7175,
+  6991, 6788, 6569, 6335, 6087, 5830, 5564, 5291, 5015, 4737, 4458, 4182,
+  3909, 3641, 3380, 3127, 2883, 2649, 2425, 2212, 2012, 1823, 1646, 1481,
+  1328, 1187, 1057, 938, 830, 731, 642, 562, 490, 426, 369, 319,
+  274, 235, 201, 171, 145, 123, 103, 87, 7531, 7518, 7479, 7415,
+  7325, 7212, 7076, 6919, 6742, 6546, 6335, 6109, 5870, 5622, 5365, 5103,
+  4836, 4568, 4299, 4033, 3770, 3512, 3260, 3016, 2780, 2554, 2338, 2134,
+  1940, 1758, 1587, 1428, 1281, 1144, 1019, 905, 800, 705, 619, 542,
+  473, 411, 356, 307, 264, 227, 194, 165, 140, 118, 100, 84,
+  7237, 7225, 7187, 7125, 7040, 6931, 6800, 6649, 6479, 6291, 6087, 5870,
+  5641, 5402, 5156, 4904, 4648, 4390, 4132, 3875, 3623, 3375, 3133, 2898,
+  2672, 2455, 2247, 2050, 1864, 1689, 1525, 1372, 1231, 1100, 979, 869,
+  769, 678, 595, 521, 454, 395, 342, 295, 254, 218, 186, 158,
+  134, 114, 96, 80, 6931, 6919, 6883, 6824, 6742, 6637, 6512, 6368,
+  6204, 6025, 5830, 5622, 5402, 5174, 4938, 4696, 4451, 4204, 3957, 3711,
+  3469, 3232, 3000, 2775, 2559, 2351, 2152, 1964, 1785, 1618, 1461, 1314,
+  1179, 1053, 938, 832, 736, 649, 570, 499, 435, 378, 328, 283,
+  243, 209, 178, 152, 129, 109, 92, 77, 6615, 6603, 6569, 6512,
+  6434, 6335, 6215, 6077, 5921, 5750, 5564, 5365, 5156, 4938, 4712, 4482,
+  4248, 4012, 3776, 3542, 3311, 3084, 2863, 2649, 2442, 2243, 2054, 1874,
+  1704, 1544, 1394, 1254, 1125, 1005, 895, 794, 703, 619, 544, 476,
+  415, 361, 313, 270, 232, 199, 170, 145, 123, 104, 88, 73,
+  6291, 6280, 6247, 6194, 6119, 6025, 5911, 5780, 5631, 5468, 5291, 5103,
+  4904, 4696, 4482, 4262, 4040, 3816, 3591, 3369, 3149, 2933, 2723, 2519,
+  2322, 2134, 1953, 1782, 1620, 1468, 1326, 1193, 1070, 956, 851, 756,
+  668, 589, 517, 453, 395, 343, 297, 257, 221, 189, 162, 138,
+  117, 99, 83, 70, 5962, 5952, 5921, 5870, 5800, 5710, 5602, 5478,
+  5337, 5183, 5015, 4836, 4648, 4451, 4248, 4040, 3829, 3616, 3404, 3193,
+  2984, 2780, 2581, 2387, 2201, 2022, 1851, 1689, 1536, 1392, 1257, 1131,
+  1014, 906, 807, 716, 633, 558, 490, 429, 374, 325, 282, 243,
+  209, 179, 153, 131, 111, 94, 79, 66, 5631, 5622, 5593, 5544,
+  5478, 5393, 5291, 5174, 5041, 4895, 4737, 4568, 4390, 4204, 4012, 3816,
+  3616, 3416, 3215, 3016, 2819, 2626, 2438, 2255, 2079, 1910, 1749, 1595,
+  1451, 1314, 1187, 1068, 958, 856, 762, 676, 598, 527, 463, 405,
+  354, 307, 266, 230, 198, 169, 145, 123, 105, 88, 75, 63,
+  5301, 5291, 5264, 5219, 5156, 5076, 4981, 4870, 4745, 4607, 4458, 4299,
+  4132, 3957, 3776, 3591, 3404, 3215, 3026, 2838, 2653, 2472, 2294, 2123,
+  1957, 1798, 1646, 1502, 1365, 1237, 1117, 1005, 901, 806, 717, 637,
+  563, 496, 436, 381, 333, 289, 251, 216, 186, 160, 136, 116,
+  98, 83, 70, 59, 4972, 4963, 4938, 4895, 4836, 4761, 4672, 4568,
+  4451, 4322, 4182, 4033, 3875, 3711, 3542, 3369, 3193, 3016, 2838, 2662,
+  2489, 2318, 2152, 1991, 1835, 1686, 1544, 1409, 1281, 1160, 1048, 943,
+  846, 756, 673, 597, 528, 465, 409, 358, 312, 271, 235, 203,
+  175, 150, 128, 109, 92, 78, 66, 55, 4648, 4639, 4615, 4576,
+  4521, 4451, 4367, 4270, 4160, 4040, 3909, 3770, 3623, 3469, 3311, 3149,
+  2984, 2819, 2653, 2489, 2326, 2167, 2012, 1861, 1716, 1576, 1443, 1317,
+  1197, 1085, 979, 881, 790, 706, 629, 558, 494, 435, 382, 334,
+  292, 254, 220, 190, 163, 140, 119, 102, 86, 73, 61, 52,
+  4329, 4322, 4299, 4262, 4211, 4146, 4068, 3977, 3875, 3763, 3641, 3512,
+  3375, 3232, 3084, 2933, 2780, 2626, 2472, 2318, 2167, 2019, 1874, 1734,
+  1598, 1468, 1344, 1226, 1115, 1010, 912, 821, 736, 658, 586, 520,
+  460, 405, 356, 312, 272, 236, 205, 177, 152, 130, 111, 95,
+  80, 68, 57, 48, 4019, 4012, 3991, 3957, 3909, 3849, 3776, 3692,
+  3598, 3493, 3380, 3260, 3133, 3000, 2863, 2723, 2581, 2438, 2294, 2152,
+  2012, 1874, 1740, 1609, 1484, 1363, 1248, 1139, 1035, 938, 847, 762,
+  683, 611, 544, 483, 427, 376, 330, 289, 252, 219, 190, 164,
+  141, 121, 103, 88, 75, 63, 53, 45, 3718, 3711, 3692, 3660,
+  3616, 3560, 3493, 3416, 3328, 3232, 3127, 3016, 2898, 2775, 2649, 2519,
+  2387, 2255, 2123, 1991, 1861, 1734, 1609, 1489, 1372, 1261, 1154, 1053,
+  958, 868, 784, 705, 632, 565, 503, 447, 395, 348, 306, 268,
+  233, 203, 176, 152, 131, 112, 96, 81, 69, 58, 49, 41,
+  3428, 3422, 3404, 3375, 3334, 3282, 3221, 3149, 3068, 2979, 2883, 2780,
+  2672, 2559, 2442, 2322, 2201, 2079, 1957, 1835, 1716, 1598, 1484, 1372,
+  1265, 1162, 1064, 971, 883, 800, 722, 650, 583, 521, 464, 412,
+  364, 321, 282, 247, 215, 187, 162, 140, 120, 103, 88, 75,
+  64, 54, 45, 38, 3149, 3143, 3127, 3100, 3063, 3016, 2959, 2893,
+  2819, 2737, 2649, 2554, 2455, 2351, 2243, 2134, 2022, 1910, 1798, 1686,
+  1576, 1468, 1363, 1261, 1162, 1068, 978, 892, 811, 735, 664, 597,
+  535, 479, 426, 378, 334, 295, 259, 227, 198, 172, 149, 128,
+  111, 95, 81, 69, 58, 49, 42, 35, 2883, 2878, 2863, 2838,
+  2804, 2761, 2709, 2649, 2581, 2506, 2425, 2338, 2247, 2152, 2054, 1953,
+  1851, 1749, 1646, 1544, 1443, 1344, 1248, 1154, 1064, 978, 895, 817,
+  743, 673, 608, 547, 490, 438, 390, 346, 306, 270, 237, 207,
+  181, 157, 136, 118, 101, 87, 74, 63, 54, 45, 38, 32,
+  2630, 2626, 2612, 2590, 2559, 2519, 2472, 2417, 2355, 2286, 2212, 2134,
+  2050, 1964, 1874, 1782, 1689, 1595, 1502, 1409, 1317, 1226, 1139, 1053,
+  971, 892, 817, 745, 678, 614, 554, 499, 447, 400, 356, 316,
+  279, 246, 216, 189, 165, 144, 124, 107, 92, 79, 68, 58,
+  49, 41, 35, 29, 2392, 2387, 2375, 2355, 2326, 2290, 2247, 2197,
+  2141, 2079, 2012, 1940, 1864, 1785, 1704, 1620, 1536, 1451, 1365, 1281,
+  1197, 1115, 1035, 958, 883, 811, 743, 678, 616, 558, 504, 454,
+  407, 363, 324, 287, 254, 224, 197, 172, 150, 131, 113, 98,
+  84, 72, 61, 52, 44, 38, 32, 27, 2167, 2163, 2152, 2134,
+  2108, 2075, 2036, 1991, 1940, 1884, 1823, 1758, 1689, 1618, 1544, 1468,
+  1392, 1314, 1237, 1160, 1085, 1010, 938, 868, 800, 735, 673, 614,
+  558, 506, 457, 411, 369, 329, 293, 260, 230, 203, 178, 156,
+  136, 118, 102, 88, 76, 65, 56, 47, 40, 34, 29, 24,
+  1957, 1953, 1943, 1927, 1903, 1874, 1839, 1798, 1752, 1701, 1646, 1587,
+  1525, 1461, 1394, 1326, 1257, 1187, 1117, 1048, 979, 912, 847, 784,
+  722, 664, 608, 554, 504, 457, 412, 371, 333, 297, 265, 235,
+  208, 183, 161, 141, 123, 107, 92, 80, 69, 59, 50, 43,
+  36, 31, 26, 22, 1761, 1758, 1749, 1734, 1713, 1686, 1654, 1618,
+  1576, 1531, 1481, 1428, 1372, 1314, 1254, 1193, 1131, 1068, 1005, 943,
+  881, 821, 762, 705, 650, 597, 547, 499, 454, 411, 371, 334,
+  299, 268, 238, 211, 187, 165, 145, 127, 111, 96, 83, 72,
+  62, 53, 45, 39, 33, 28, 23, 20, 1579, 1576, 1568, 1555,
+  1536, 1512, 1484, 1451, 1413, 1372, 1328, 1281, 1231, 1179, 1125, 1070,
+  1014, 958, 901, 846, 790, 736, 683, 632, 583, 535, 490, 447,
+  407, 369, 333, 299, 269, 240, 214, 190, 168, 148, 130, 114,
+  99, 86, 75, 64, 55, 48, 41, 35, 29, 25, 21, 18,
+  1411, 1409, 1401, 1389, 1372, 1351, 1326, 1296, 1263, 1226, 1187, 1144,
+  1100, 1053, 1005, 956, 906, 856, 806, 756, 706, 658, 611, 565,
+  521, 479, 438, 400, 363, 329, 297, 268, 240, 214, 191, 169,
+  150, 132, 116, 102, 89, 77, 67, 58, 50, 42, 36, 31,
+  26, 22, 19, 16, 1257, 1254, 1248, 1237, 1222, 1203, 1181, 1154,
+  1125, 1092, 1057, 1019, 979, 938, 895, 851, 807, 762, 717, 673,
+  629, 586, 544, 503, 464, 426, 390, 356, 324, 293, 265, 238,
+  214, 191, 170, 151, 133, 118, 103, 90, 79, 69, 59, 51,
+  44, 38, 32, 28, 23, 20, 17, 14, 1115, 1113, 1107, 1098,
+  1085, 1068, 1048, 1025, 998, 969, 938, 905, 869, 832, 794, 756,
+  716, 676, 637, 597, 558, 520, 483, 447, 412, 378, 346, 316,
+  287, 260, 235, 211, 190, 169, 151, 134, 118, 104, 92, 80,
+  70, 61, 53, 46, 39, 34, 29, 24, 21, 18, 15, 12,
+  986, 985, 979, 971, 959, 945, 927, 906, 883, 857, 830, 800,
+  769, 736, 703, 668, 633, 598, 563, 528, 494, 460, 427, 395,
+  364, 334, 306, 279, 254, 230, 208, 187, 168, 150, 133, 118,
+  105, 92, 81, 71, 62, 54, 47, 40, 35, 30, 25, 22,
+  18, 15, 13, 11, 869, 868, 863, 856, 846, 832, 817, 799,
+  778, 756, 731, 705, 678, 649, 619, 589, 558, 527, 496, 465,
+  435, 405, 376, 348, 321, 295, 270, 246, 224, 203, 183, 165,
+  148, 132, 118, 104, 92, 81, 71, 63, 55, 47, 41, 35,
+  31, 26, 22, 19, 16, 14, 12, 10, 763, 762, 758, 752,
+  743, 731, 717, 701, 683, 664, 642, 619, 595, 570, 544, 517,
+  490, 463, 436, 409, 382, 356, 330, 306, 282, 259, 237, 216,
+  197, 178, 161, 145, 130, 116, 103, 92, 81, 71, 63, 55,
+  48, 42, 36, 31, 27, 23, 20, 17, 14, 12, 10, 8,
+  668, 667, 664, 658, 650, 640, 628, 614, 598, 581, 562, 542,
+  521, 499, 476, 453, 429, 405, 381, 358, 334, 312, 289, 268,
+  247, 227, 207, 189, 172, 156, 141, 127, 114, 102, 90, 80,
+  71, 63, 55, 48, 42, 36, 32, 27, 23, 20, 17, 15,
+  12, 10, 9, 7, 583, 582, 579, 574, 567, 558, 548, 535,
+  522, 507, 490, 473, 454, 435, 415, 395, 374, 354, 333, 312,
+  292, 272, 252, 233, 215, 198, 181, 165, 150, 136, 123, 111,
+  99, 89, 79, 70, 62, 55, 48, 42, 37, 32, 28, 24,
+  20, 18, 15, 13, 11, 9, 8, 6, 507, 506, 503, 499,
+  493, 485, 476, 465, 454, 440, 426, 411, 395, 378, 361, 343,
+  325, 307, 289, 271, 254, 236, 219, 203, 187, 172, 157, 144,
+  131, 118, 107, 96, 86, 77, 69, 61, 54, 47, 42, 36,
+  32, 28, 24, 21, 18, 15, 13, 11, 9, 8, 7, 6,
+  439, 438, 436, 432, 427, 420, 412, 403, 393, 381, 369, 356,
+  342, 328, 313, 297, 282, 266, 251, 235, 220, 205, 190, 176,
+  162, 149, 136, 124, 113, 102, 92, 83, 75, 67, 59, 53,
+  47, 41, 36, 32, 28, 24, 21, 18, 15, 13, 11, 10,
+  8, 7, 6, 5, 379, 378, 376, 373, 369, 363, 356, 348,
+  339, 329, 319, 307, 295, 283, 270, 257, 243, 230, 216, 203,
+  190, 177, 164, 152, 140, 128, 118, 107, 98, 88, 80, 72,
+  64, 58, 51, 46, 40, 35, 31, 27, 24, 21, 18, 15,
+  13, 11, 10, 8, 7, 6, 5, 4, 326, 325, 324, 321,
+  317, 312, 306, 299, 292, 283, 274, 264, 254, 243, 232, 221,
+  209, 198, 186, 175, 163, 152, 141, 131, 120, 111, 101, 92,
+  84, 76, 69, 62, 55, 50, 44, 39, 35, 31, 27, 23,
+  20, 18, 15, 13, 11, 10, 8, 7, 6, 5, 4, 4,
+  279, 279, 277, 275, 272, 268, 263, 257, 250, 243, 235, 227,
+  218, 209, 199, 189, 179, 169, 160, 150, 140, 130, 121, 112,
+  103, 95, 87, 79, 72, 65, 59, 53, 48, 42, 38, 34,
+  30, 26, 23, 20, 18, 15, 13, 11, 10, 8, 7, 6,
+  5, 4, 4, 3, 239, 238, 237, 235, 232, 229, 224, 219,
+  214, 207, 201, 194, 186, 178, 170, 162, 153, 145, 136, 128,
+  119, 111, 103, 96, 88, 81, 74, 68, 61, 56, 50, 45,
+  41, 36, 32, 29, 25, 22, 20, 17, 15, 13, 11, 10,
+  8, 7, 6, 5, 4, 4, 3, 3, 203, 203, 202, 200,
+  198, 195, 191, 187, 182, 177, 171, 165, 158, 152, 145, 138,
+  131, 123, 116, 109, 102, 95, 88, 81, 75, 69, 63, 58,
+  52, 47, 43, 39, 35, 31, 28, 24, 22, 19, 17, 15,
+  13, 11, 10, 8, 7, 6, 5, 4, 4, 3, 3, 2,
+  172, 172, 171, 170, 168, 165, 162, 158, 154, 150, 145, 140,
+  134, 129, 123, 117, 111, 105, 98, 92, 86, 80, 75, 69,
+  64, 58, 54, 49, 44, 40, 36, 33, 29, 26, 23, 21,
+  18, 16, 14, 12, 11, 9, 8, 7, 6, 5, 4, 4,
+  3, 3, 2, 2, 146, 146, 145, 144, 142, 140, 137, 134,
+  131, 127, 123, 118, 114, 109, 104, 99, 94, 88, 83, 78,
+  73, 68, 63, 58, 54, 49, 45, 41, 38, 34, 31, 28,
+  25, 22, 20, 18, 15, 14, 12, 10, 9, 8, 7, 6,
+  5, 4, 4, 3, 3, 2, 2, 2, 123, 123, 122, 121,
+  119, 118, 115, 113, 110, 107, 103, 100, 96, 92, 88, 83,
+  79, 75, 70, 66, 61, 57, 53, 49, 45, 42, 38, 35,
+  32, 29, 26, 23, 21, 19, 17, 15, 13, 12, 10, 9,
+  8, 7, 6, 5, 4, 4, 3, 3, 2, 2, 2, 1,
+  103, 103, 102, 102, 100, 99, 97, 95, 92, 90, 87, 84,
+  80, 77, 73, 70, 66, 63, 59, 55, 52, 48, 45, 41,
+  38, 35, 32, 29, 27, 24, 22, 20, 18, 16, 14, 12,
+  11, 10, 8, 7, 6, 6, 5, 4, 4, 3, 3, 2,
+  2, 2, 1, 1
+};
+static const int kern_row_fixed_17[] = {
+  4384, 5222, 6197, 7330, 8639, 10147, 11877, 13854, 16105, 18656, 21537, 24777,
+  28406, 32453, 36950, 41924, 47404, 53414, 59979, 67118, 74847, 83178, 92117, 101664,
+  111813, 122551, 133855, 145698, 158040, 170836, 184030, 197558, 211348, 225320, 239385, 253450,
+  267415, 281174, 294620, 307643, 320132, 331977, 343071, 353311, 362600, 370848, 377973, 383904,
+  388582, 391958, 393998, 394680, 393998, 391958, 388582, 383904, 377973, 370848, 362600, 353311,
+  343071, 331977, 320132, 307643, 294620, 281174, 267415, 253450, 239385, 225320, 211348, 197558,
+  184030, 170836, 158040, 145698, 133855, 122551, 111813, 101664, 92117, 83178, 74847, 67118,
+  59979, 53414, 47404, 41924, 36950, 32453, 28406, 24777, 21537, 18656, 16105, 13854,
+  11877, 10147, 8639, 7330, 6197, 5222, 4384
+};
+
+static const float kern_half_18[] = {
+  2.21634600e-02f, 2.21292842e-02f, 2.20270697e-02f, 2.18577627e-02f, 2.16229148e-02f, 2.13246718e-02f,
+  2.09657345e-02f, 2.05493178e-02f, 2.00791024e-02f, 1.95591841e-02f, 1.89940166e-02f, 1.83883365e-02f,
+  1.77471116e-02f, 1.70754623e-02f, 1.63786039e-02f, 1.56617705e-02f, 1.49301589e-02f, 1.41888624e-02f,
+  1.34428181e-02f, 1.26967523e-02f, 1.19551364e-02f, 1.12221492e-02f, 1.05016399e-02f, 9.79710557e-03f,
+  9.11167078e-03f, 8.44807643e-03f, 7.80867366e-03f, 7.19542196e-03f, 6.60989946e-03f, 6.05331175e-03f,
+  5.52650774e-03f, 5.03000151e-03f, 4.56399377e-03f, 4.12839791e-03f, 3.72286816e-03f, 3.34682758e-03f,
+  2.99949804e-03f, 2.67993007e-03f, 2.38703005e-03f, 2.11959030e-03f, 1.87631394e-03f, 1.65584125e-03f,
+  1.45677163e-03f, 1.27768505e-03f, 1.11716101e-03f, 9.73794493e-04f, 8.46210518e-04f, 7.33076187e-04f,
+  6.33110350e-04f, 5.45091345e-04f, 4.67863021e-04f, 4.00338875e-04f, 3.41504463e-04f, 2.90418713e-04f,
+  2.46213807e-04f, 2.21292842e-02f, 2.20951606e-02f, 2.19931044e-02f, 2.18240563e-02f, 2.15895716e-02f,
+  2.12917887e-02f, 2.09334046e-02f, 2.05176286e-02f, 2.00481396e-02f, 1.95290241e-02f, 1.89647265e-02f,
+  1.83599815e-02f, 1.77197456e-02f, 1.70491319e-02f, 1.63533483e-02f, 1.56376194e-02f, 1.49071366e-02f,
+  1.41669828e-02f, 1.34220887e-02f, 1.26771731e-02f, 1.19367018e-02f, 1.12048443e-02f, 1.04854461e-02f,
+  9.78199765e-03f, 9.09762084e-03f, 8.43505003e-03f, 7.79663259e-03f, 7.18432665e-03f, 6.59970706e-03f,
+  6.04397710e-03f, 5.51798567e-03f, 5.02224499e-03f, 4.55695624e-03f, 4.12203185e-03f, 3.71712749e-03f,
+  3.34166666e-03f, 2.99487286e-03f, 2.67579756e-03f, 2.38334923e-03f, 2.11632182e-03f, 1.87342067e-03f,
+  1.65328791e-03f, 1.45452528e-03f, 1.27571484e-03f, 1.11543830e-03f, 9.72292852e-04f, 8.44905619e-04f,
+  7.31945795e-04f, 6.32134092e-04f, 5.44250768e-04f, 4.67141566e-04f, 3.99721554e-04f, 3.40977858e-04f,
+  2.89970892e-04f, 2.45834148e-04f, 2.20270697e-02f, 2.19931044e-02f, 2.18915194e-02f, 2.17232537e-02f,
+  2.14898512e-02f, 2.11934447e-02f, 2.08367147e-02f, 2.04228610e-02f, 1.99555382e-02f, 1.94388218e-02f,
+  1.88771300e-02f, 1.82751790e-02f, 1.76378991e-02f, 1.69703830e-02f, 1.62778124e-02f, 1.55653907e-02f,
+  1.48382811e-02f, 1.41015472e-02f, 1.33600933e-02f, 1.26186181e-02f, 1.18815666e-02f, 1.11530898e-02f,
+  1.04370145e-02f, 9.73681547e-03f, 9.05559957e-03f, 8.39608908e-03f, 7.76062021e-03f, 7.15114269e-03f,
+  6.56922348e-03f, 6.01606071e-03f, 5.49249863e-03f, 4.99904761e-03f, 4.53590788e-03f, 4.10299236e-03f,
+  3.69995832e-03f, 3.32623161e-03f, 2.98103970e-03f, 2.66343821e-03f, 2.37234076e-03f, 2.10654666e-03f,
+  1.86476740e-03f, 1.64565153e-03f, 1.44780695e-03f, 1.26982247e-03f, 1.11028622e-03f, 9.67801898e-04f,
+  8.41003086e-04f, 7.28564977e-04f, 6.29214279e-04f, 5.41736954e-04f, 4.64983867e-04f, 3.97875265e-04f,
+  3.39402905e-04f, 2.88631534e-04f, 2.44698633e-04f, 2.18577627e-02f, 2.18240563e-02f, 2.17232537e-02f,
+  2.15562806e-02f, 2.13246718e-02f, 2.10305434e-02f, 2.06765570e-02f, 2.02658828e-02f, 1.98021531e-02f,
+  1.92894079e-02f, 1.87320337e-02f, 1.81347094e-02f, 1.75023284e-02f, 1.68399438e-02f, 1.61526967e-02f,
+  1.54457502e-02f, 1.47242295e-02f, 1.39931571e-02f, 1.32574029e-02f, 1.25216274e-02f, 1.17902411e-02f,
+  1.10673634e-02f, 1.03567922e-02f, 9.66197532e-03f, 8.98599438e-03f, 8.33155308e-03f, 7.70096947e-03f,
+  7.09617650e-03f, 6.51872996e-03f, 5.96981868e-03f, 5.45028131e-03f, 4.96062357e-03f, 4.50104335e-03f,
+  4.07145545e-03f, 3.67151899e-03f, 3.30066518e-03f, 2.95812637e-03f, 2.64296611e-03f, 2.35410593e-03f,
+  2.09035492e-03f, 1.85043411e-03f, 1.63300242e-03f, 1.43667858e-03f, 1.26006210e-03f, 1.10175216e-03f,
+  9.60363017e-04f, 8.34538834e-04f, 7.22964935e-04f, 6.24377921e-04f, 5.37572952e-04f, 4.61409858e-04f,
+  3.94817034e-04f, 3.36794124e-04f, 2.86413007e-04f, 2.42817798e-04f, 2.16229148e-02f, 2.15895716e-02f,
+  2.14898512e-02f, 2.13246718e-02f, 2.10955534e-02f, 2.08045840e-02f, 2.04544012e-02f, 2.00481396e-02f,
+  1.95893925e-02f, 1.90821551e-02f, 1.85307711e-02f, 1.79398637e-02f, 1.73142776e-02f, 1.66590083e-02f,
+  1.59791466e-02f, 1.52797960e-02f, 1.45660266e-02f, 1.38428099e-02f, 1.31149609e-02f, 1.23870904e-02f,
+  1.16635626e-02f, 1.09484522e-02f, 1.02455150e-02f, 9.55816358e-03f, 8.88944604e-03f, 8.24203622e-03f,
+  7.61822751e-03f, 7.01993285e-03f, 6.44869031e-03f, 5.90567710e-03f, 5.39172161e-03f, 4.90732491e-03f,
+  4.45268257e-03f, 4.02771030e-03f, 3.63207096e-03f, 3.26520158e-03f, 2.92634335e-03f, 2.61456915e-03f,
+  2.32881261e-03f, 2.06789537e-03f, 1.83055247e-03f, 1.61545689e-03f, 1.42124237e-03f, 1.24652358e-03f,
+  1.08991459e-03f, 9.50044603e-04f, 8.25572293e-04f, 7.15197180e-04f, 6.17669371e-04f, 5.31797064e-04f,
+  4.56452311e-04f, 3.90575005e-04f, 3.33175500e-04f, 2.83335685e-04f, 2.40208887e-04f, 2.13246718e-02f,
+  2.12917887e-02f, 2.11934447e-02f, 2.10305434e-02f, 2.08045840e-02f, 2.05176286e-02f, 2.01722756e-02f,
+  1.97716169e-02f, 1.93191972e-02f, 1.88189577e-02f, 1.82751790e-02f, 1.76924206e-02f, 1.70754623e-02f,
+  1.64292343e-02f, 1.57587472e-02f, 1.50690433e-02f, 1.43651199e-02f, 1.36518776e-02f, 1.29340673e-02f,
+  1.22162374e-02f, 1.15026888e-02f, 1.07974410e-02f, 1.01041999e-02f, 9.42632928e-03f, 8.76683462e-03f,
+  8.12835526e-03f, 7.51315057e-03f, 6.92310743e-03f, 6.35974435e-03f, 5.82422083e-03f, 5.31735411e-03f,
+  4.83963871e-03f, 4.39126696e-03f, 3.97215644e-03f, 3.58197419e-03f, 3.22016515e-03f, 2.88598053e-03f,
+  2.57850671e-03f, 2.29669176e-03f, 2.03937315e-03f, 1.80530385e-03f, 1.59317511e-03f, 1.40163931e-03f,
+  1.22933043e-03f, 1.07488153e-03f, 9.36940720e-04f, 8.14185245e-04f, 7.05332553e-04f, 6.09149924e-04f,
+  5.24462084e-04f, 4.50156513e-04f, 3.85187857e-04f, 3.28580063e-04f, 2.79427681e-04f, 2.36895721e-04f,
+  2.09657345e-02f, 2.09334046e-02f, 2.08367147e-02f, 2.06765570e-02f, 2.04544012e-02f, 2.01722756e-02f,
+  1.98327359e-02f, 1.94388218e-02f, 1.89940166e-02f, 1.85021963e-02f, 1.79675687e-02f, 1.73946209e-02f,
+  1.67880487e-02f, 1.61526967e-02f, 1.54934954e-02f, 1.48154004e-02f, 1.41233252e-02f, 1.34220887e-02f,
+  1.27163613e-02f, 1.20106125e-02f, 1.13090752e-02f, 1.06156981e-02f, 9.93412547e-03f, 9.26766451e-03f,
+  8.61927122e-03f, 7.99153838e-03f, 7.38668861e-03f, 6.80657756e-03f, 6.25269720e-03f, 5.72618749e-03f,
+  5.22785215e-03f, 4.75817779e-03f, 4.31735301e-03f, 3.90529726e-03f, 3.52168246e-03f, 3.16596311e-03f,
+  2.83740368e-03f, 2.53510522e-03f, 2.25803372e-03f, 2.00504647e-03f, 1.77491689e-03f, 1.56635873e-03f,
+  1.37804693e-03f, 1.20863831e-03f, 1.05678907e-03f, 9.21170111e-04f, 8.00480833e-04f, 6.93460344e-04f,
+  5.98896702e-04f, 5.15634310e-04f, 4.42579447e-04f, 3.78704339e-04f, 3.23049375e-04f, 2.74724327e-04f,
+  2.32908278e-04f, 2.05493178e-02f, 2.05176286e-02f, 2.04228610e-02f, 2.02658828e-02f, 2.00481396e-02f,
+  1.97716169e-02f, 1.94388218e-02f, 1.90527309e-02f, 1.86167601e-02f, 1.81347094e-02f, 1.76107008e-02f,
+  1.70491319e-02f, 1.64546072e-02f, 1.58318747e-02f, 1.51857669e-02f, 1.45211397e-02f, 1.38428099e-02f,
+  1.31555013e-02f, 1.24637904e-02f, 1.17720598e-02f, 1.10844560e-02f, 1.04048513e-02f, 9.73681547e-03f,
+  9.08359140e-03f, 8.44807643e-03f, 7.83281121e-03f, 7.23997550e-03f, 6.67138631e-03f, 6.12850720e-03f,
+  5.61245484e-03f, 5.12401760e-03f, 4.66367137e-03f, 4.23160242e-03f, 3.82773089e-03f, 3.45173525e-03f,
+  3.10308137e-03f, 2.78104772e-03f, 2.48475326e-03f, 2.21318495e-03f, 1.96522241e-03f, 1.73966389e-03f,
+  1.53524801e-03f, 1.35067641e-03f, 1.18463254e-03f, 1.03579927e-03f, 9.02873988e-04f, 7.84581818e-04f,
+  6.79686957e-04f, 5.87001559e-04f, 5.05392847e-04f, 4.33789013e-04f, 3.71182599e-04f, 3.16633028e-04f,
+  2.69267795e-04f, 2.28282297e-04f, 2.00791024e-02f, 2.00481396e-02f, 1.99555382e-02f, 1.98021531e-02f,
+  1.95893925e-02f, 1.93191972e-02f, 1.89940166e-02f, 1.86167601e-02f, 1.81907658e-02f, 1.77197456e-02f,
+  1.72077268e-02f, 1.66590083e-02f, 1.60780884e-02f, 1.54696042e-02f, 1.48382811e-02f, 1.41888624e-02f,
+  1.35260550e-02f, 1.28544737e-02f, 1.21785905e-02f, 1.15026888e-02f, 1.08308177e-02f, 1.01667643e-02f,
+  9.51401517e-03f, 8.87573883e-03f, 8.25476553e-03f, 7.65357912e-03f, 7.07430858e-03f, 6.51872996e-03f,
+  5.98827284e-03f, 5.48402919e-03f, 5.00676828e-03f, 4.55695624e-03f, 4.13477374e-03f, 3.74014350e-03f,
+  3.37275164e-03f, 3.03207571e-03f, 2.71741091e-03f, 2.42789648e-03f, 2.16254219e-03f, 1.92025374e-03f,
+  1.69985637e-03f, 1.50011794e-03f, 1.31976977e-03f, 1.15752546e-03f, 1.01209781e-03f, 8.82214168e-04f,
+  7.66628829e-04f, 6.64134161e-04f, 5.73569618e-04f, 4.93828324e-04f, 4.23862948e-04f, 3.62689083e-04f,
+  3.09387746e-04f, 2.63106340e-04f, 2.23058669e-04f, 1.95591841e-02f, 1.95290241e-02f, 1.94388218e-02f,
+  1.92894079e-02f, 1.90821551e-02f, 1.88189577e-02f, 1.85021963e-02f, 1.81347094e-02f, 1.77197456e-02f,
+  1.72609203e-02f, 1.67621598e-02f, 1.62276495e-02f, 1.56617705e-02f, 1.50690433e-02f, 1.44540677e-02f,
+  1.38214640e-02f, 1.31758191e-02f, 1.25216274e-02f, 1.18632456e-02f, 1.12048443e-02f, 1.05503714e-02f,
+  9.90351196e-03f, 9.26766451e-03f, 8.64591543e-03f, 8.04102141e-03f, 7.45540159e-03f, 6.89113000e-03f,
+  6.34993752e-03f, 5.83321601e-03f, 5.34202857e-03f, 4.87712584e-03f, 4.43896092e-03f, 4.02771030e-03f,
+  3.64329852e-03f, 3.28541966e-03f, 2.95356498e-03f, 2.64704786e-03f, 2.36502988e-03f, 2.10654666e-03f,
+  1.87053182e-03f, 1.65584125e-03f, 1.46127481e-03f, 1.28559640e-03f, 1.12755317e-03f, 9.85891093e-04f,
+  8.59370630e-04f, 7.46778154e-04f, 6.46937464e-04f, 5.58717933e-04f, 4.81041410e-04f, 4.12887661e-04f,
+  3.53297830e-04f, 3.01376625e-04f, 2.56293628e-04f, 2.17282912e-04f, 1.89940166e-02f, 1.89647265e-02f,
+  1.88771300e-02f, 1.87320337e-02f, 1.85307711e-02f, 1.82751790e-02f, 1.79675687e-02f, 1.76107008e-02f,
+  1.72077268e-02f, 1.67621598e-02f, 1.62778124e-02f, 1.57587472e-02f, 1.52092194e-02f, 1.46336183e-02f,
+  1.40364124e-02f, 1.34220887e-02f, 1.27951000e-02f, 1.21598113e-02f, 1.15204528e-02f, 1.08810775e-02f,
+  1.02455150e-02f, 9.61734727e-03f, 8.99987295e-03f, 8.39608908e-03f, 7.80867366e-03f, 7.23997550e-03f,
+  6.69200905e-03f, 6.16645440e-03f, 5.66466339e-03f, 5.18766930e-03f, 4.73619998e-03f, 4.31069592e-03f,
+  3.91132850e-03f, 3.53802415e-03f, 3.19048646e-03f, 2.86822068e-03f, 2.57056067e-03f, 2.29669176e-03f,
+  2.04567728e-03f, 1.81648217e-03f, 1.60799525e-03f, 1.41905085e-03f, 1.24844874e-03f, 1.09497213e-03f,
+  9.57403507e-04f, 8.34538834e-04f, 7.25199759e-04f, 6.28244015e-04f, 5.42573573e-04f, 4.67141566e-04f,
+  4.00957157e-04f, 3.43089167e-04f, 2.92668265e-04f, 2.48887925e-04f, 2.11004459e-04f, 1.83883365e-02f,
+  1.83599815e-02f, 1.82751790e-02f, 1.81347094e-02f, 1.79398637e-02f, 1.76924206e-02f, 1.73946209e-02f,
+  1.70491319e-02f, 1.66590083e-02f, 1.62276495e-02f, 1.57587472e-02f, 1.52562335e-02f, 1.47242295e-02f,
+  1.41669828e-02f, 1.35888206e-02f, 1.29940864e-02f, 1.23870904e-02f, 1.17720598e-02f, 1.11530898e-02f,
+  1.05341021e-02f, 9.91880707e-03f, 9.31067020e-03f, 8.71288497e-03f, 8.12835526e-03f, 7.55967107e-03f,
+  7.00910762e-03f, 6.47861464e-03f, 5.96981868e-03f, 5.48402919e-03f, 5.02224499e-03f, 4.58517252e-03f,
+  4.17323643e-03f, 3.78660439e-03f, 3.42520396e-03f, 3.08874855e-03f, 2.77675921e-03f, 2.48859078e-03f,
+  2.22345488e-03f, 1.98044488e-03f, 1.75855833e-03f, 1.55671965e-03f, 1.37380022e-03f, 1.20863831e-03f,
+  1.06005580e-03f, 9.26873938e-04f, 8.07927107e-04f, 7.02074671e-04f, 6.08210627e-04f, 5.25272044e-04f,
+  4.52245411e-04f, 3.88171466e-04f, 3.32148775e-04f, 2.83335685e-04f, 2.40951413e-04f, 2.04275973e-04f,
+  1.77471116e-02f, 1.77197456e-02f, 1.76378991e-02f, 1.75023284e-02f, 1.73142776e-02f, 1.70754623e-02f,
+  1.67880487e-02f, 1.64546072e-02f, 1.60780884e-02f, 1.56617705e-02f, 1.52092194e-02f, 1.47242295e-02f,
+  1.42107755e-02f, 1.36729619e-02f, 1.31149609e-02f, 1.25409653e-02f, 1.19551364e-02f, 1.13615533e-02f,
+  1.07641676e-02f, 1.01667643e-02f, 9.57292505e-03f, 8.98599438e-03f, 8.40905588e-03f, 7.84490909e-03f,
+  7.29605556e-03f, 6.76469086e-03f, 6.25269720e-03f, 5.76164341e-03f, 5.29279374e-03f, 4.84711304e-03f,
+  4.42528166e-03f, 4.02771030e-03f, 3.65456054e-03f, 3.30576277e-03f, 2.98103970e-03f, 2.67993007e-03f,
+  2.40181037e-03f, 2.14592018e-03f, 1.91138417e-03f, 1.69723516e-03f, 1.50243472e-03f, 1.32589403e-03f,
+  1.16649154e-03f, 1.02309021e-03f, 8.94552621e-04f, 7.79753667e-04f, 6.77592412e-04f, 5.87001559e-04f,
+  5.06955141e-04f, 4.36475006e-04f, 3.74635420e-04f, 3.20566323e-04f, 2.73455400e-04f, 2.32549122e-04f,
+  1.97152593e-04f, 1.70754623e-02f, 1.70491319e-02f, 1.69703830e-02f, 1.68399438e-02f, 1.66590083e-02f,
+  1.64292343e-02f, 1.61526967e-02f, 1.58318747e-02f, 1.54696042e-02f, 1.50690433e-02f, 1.46336183e-02f,
+  1.41669828e-02f, 1.36729619e-02f, 1.31555013e-02f, 1.26186181e-02f, 1.20663466e-02f, 1.15026888e-02f,
+  1.09315692e-02f, 1.03567922e-02f, 9.78199765e-03f, 9.21063311e-03f, 8.64591543e-03f, 8.09081085e-03f,
+  7.54801417e-03f, 7.01993285e-03f, 6.50867773e-03f, 6.01606071e-03f, 5.54359099e-03f, 5.09248534e-03f,
+  4.66367137e-03f, 4.25780425e-03f, 3.87527957e-03f, 3.51625192e-03f, 3.18065449e-03f, 2.86822068e-03f,
+  2.57850671e-03f, 2.31091259e-03f, 2.06470676e-03f, 1.83904695e-03f, 1.63300242e-03f, 1.44557434e-03f,
+  1.27571484e-03f, 1.12234510e-03f, 9.84370825e-04f, 8.60697823e-04f, 7.50243489e-04f, 6.51948561e-04f,
+  5.64786140e-04f, 4.87769139e-04f, 4.19956399e-04f, 3.60457168e-04f, 3.08434304e-04f, 2.63106340e-04f,
+  2.23748182e-04f, 1.89691258e-04f, 1.63786039e-02f, 1.63533483e-02f, 1.62778124e-02f, 1.61526967e-02f,
+  1.59791466e-02f, 1.57587472e-02f, 1.54934954e-02f, 1.51857669e-02f, 1.48382811e-02f, 1.44540677e-02f,
+  1.40364124e-02f, 1.35888206e-02f, 1.31149609e-02f, 1.26186181e-02f, 1.21036461e-02f, 1.15739126e-02f,
+  1.10332575e-02f, 1.04854461e-02f, 9.93412547e-03f, 9.38278902e-03f, 8.83474201e-03f, 8.29307083e-03f,
+  7.76062021e-03f, 7.23997550e-03f, 6.73344545e-03f, 6.24305522e-03f, 5.77054173e-03f, 5.31735411e-03f,
+  4.88465838e-03f, 4.47334442e-03f, 4.08404088e-03f, 3.71712749e-03f, 3.37275164e-03f, 3.05085024e-03f,
+  2.75116717e-03f, 2.47327634e-03f, 2.21660291e-03f, 1.98044488e-03f, 1.76399446e-03f, 1.56635873e-03f,
+  1.38657971e-03f, 1.22365227e-03f, 1.07654149e-03f, 9.44198167e-04f, 8.25572293e-04f, 7.19625619e-04f,
+  6.25342189e-04f, 5.41736954e-04f, 4.67863021e-04f, 4.02817735e-04f, 3.45746696e-04f, 2.95846956e-04f,
+  2.52368831e-04f, 2.14616899e-04f, 1.81949858e-04f, 1.56617705e-02f, 1.56376194e-02f, 1.55653907e-02f,
+  1.54457502e-02f, 1.52797960e-02f, 1.50690433e-02f, 1.48154004e-02f, 1.45211397e-02f, 1.41888624e-02f,
+  1.38214640e-02f, 1.34220887e-02f, 1.29940864e-02f, 1.25409653e-02f, 1.20663466e-02f, 1.15739126e-02f,
+  1.10673634e-02f, 1.05503714e-02f, 1.00265350e-02f, 9.49934404e-03f, 8.97213817e-03f, 8.44807643e-03f,
+  7.93011207e-03f, 7.42096547e-03f, 6.92310743e-03f, 6.43874658e-03f, 5.96981868e-03f, 5.51798567e-03f,
+  5.08463243e-03f, 4.67087422e-03f, 4.27756226e-03f, 3.90529726e-03f, 3.55444197e-03f, 3.22513841e-03f,
+  2.91732536e-03f, 2.63075833e-03f, 2.36502988e-03f, 2.11959030e-03f, 1.89376785e-03f, 1.68679061e-03f,
+  1.49780477e-03f, 1.32589403e-03f, 1.17009738e-03f, 1.02942518e-03f, 9.02873988e-04f, 7.89439888e-04f,
+  6.88130211e-04f, 5.97973180e-04f, 5.18027053e-04f, 4.47386323e-04f, 3.85187857e-04f, 3.30614595e-04f,
+  2.82898778e-04f, 2.41323549e-04f, 2.05223885e-04f, 1.73986555e-04f, 1.49301589e-02f, 1.49071366e-02f,
+  1.48382811e-02f, 1.47242295e-02f, 1.45660266e-02f, 1.43651199e-02f, 1.41233252e-02f, 1.38428099e-02f,
+  1.35260550e-02f, 1.31758191e-02f, 1.27951000e-02f, 1.23870904e-02f, 1.19551364e-02f, 1.15026888e-02f,
+  1.10332575e-02f, 1.05503714e-02f, 1.00575294e-02f, 9.55816358e-03f, 9.05559957e-03f, 8.55302066e-03f,
+  8.05343967e-03f, 7.55967107e-03f, 7.07430858e-03f, 6.59970706e-03f, 6.13797177e-03f, 5.69094950e-03f,
+  5.26022259e-03f, 4.84711304e-03f, 4.45268257e-03f, 4.07774327e-03f, 3.72286816e-03f, 3.38840252e-03f,
+  3.07448185e-03f, 2.78104772e-03f, 2.50786706e-03f, 2.25455174e-03f, 2.02057720e-03f, 1.80530385e-03f,
+  1.60799525e-03f, 1.42783741e-03f, 1.26395724e-03f, 1.11543830e-03f, 9.81337391e-04f, 8.60697823e-04f,
+  7.52562599e-04f, 6.55985379e-04f, 5.70039963e-04f, 4.93828324e-04f, 4.26487473e-04f, 3.67194472e-04f,
+  3.15170531e-04f, 2.69683660e-04f, 2.30050544e-04f, 1.95637214e-04f, 1.65859077e-04f, 1.41888624e-02f,
+  1.41669828e-02f, 1.41015472e-02f, 1.39931571e-02f, 1.38428099e-02f, 1.36518776e-02f, 1.34220887e-02f,
+  1.31555013e-02f, 1.28544737e-02f, 1.25216274e-02f, 1.21598113e-02f, 1.17720598e-02f, 1.13615533e-02f,
+  1.09315692e-02f, 1.04854461e-02f, 1.00265350e-02f, 9.55816358e-03f, 9.08359140e-03f, 8.60598031e-03f,
+  8.12835526e-03f, 7.65357912e-03f, 7.18432665e-03f, 6.72306214e-03f, 6.27202541e-03f, 5.83321601e-03f,
+  5.40838856e-03f, 4.99904761e-03f, 4.60644905e-03f, 4.23160242e-03f, 3.87527957e-03f, 3.53802415e-03f,
+  3.22016515e-03f, 2.92183086e-03f, 2.64296611e-03f, 2.38334923e-03f, 2.14261119e-03f, 1.92025374e-03f,
+  1.71566883e-03f, 1.52815680e-03f, 1.35694398e-03f, 1.20120053e-03f, 1.06005580e-03f, 9.32613038e-04f,
+  8.17963388e-04f, 7.15197180e-04f, 6.23415108e-04f, 5.41736954e-04f, 4.69309278e-04f, 4.05311963e-04f,
+  3.48962931e-04f, 2.99522013e-04f, 2.56293628e-04f, 2.18628324e-04f, 1.85923636e-04f, 1.57624032e-04f,
+  1.34428181e-02f, 1.34220887e-02f, 1.33600933e-02f, 1.32574029e-02f, 1.31149609e-02f, 1.29340673e-02f,
+  1.27163613e-02f, 1.24637904e-02f, 1.21785905e-02f, 1.18632456e-02f, 1.15204528e-02f, 1.11530898e-02f,
+  1.07641676e-02f, 1.03567922e-02f, 9.93412547e-03f, 9.49934404e-03f, 9.05559957e-03f, 8.60598031e-03f,
+  8.15348141e-03f, 7.70096947e-03f, 7.25115696e-03f, 6.80657756e-03f, 6.36956654e-03f, 5.94224455e-03f,
+  5.52650774e-03f, 5.12401760e-03f, 4.73619998e-03f, 4.36424417e-03f, 4.00910666e-03f, 3.67151899e-03f,
+  3.35199642e-03f, 3.05085024e-03f, 2.76820222e-03f, 2.50399997e-03f, 2.25803372e-03f, 2.02995352e-03f,
+  1.81928754e-03f, 1.62545964e-03f, 1.44780695e-03f, 1.28559640e-03f, 1.13804196e-03f, 1.00431847e-03f,
+  8.83576635e-04f, 7.74955202e-04f, 6.77592412e-04f, 5.90636220e-04f, 5.13252628e-04f, 4.44633188e-04f,
+  3.84000828e-04f, 3.30614595e-04f, 2.83773261e-04f, 2.42817798e-04f, 2.07132936e-04f, 1.76147849e-04f,
+  1.49336222e-04f, 1.26967523e-02f, 1.26771731e-02f, 1.26186181e-02f, 1.25216274e-02f, 1.23870904e-02f,
+  1.22162374e-02f, 1.20106125e-02f, 1.17720598e-02f, 1.15026888e-02f, 1.12048443e-02f, 1.08810775e-02f,
+  1.05341021e-02f, 1.01667643e-02f, 9.78199765e-03f, 9.38278902e-03f, 8.97213817e-03f, 8.55302066e-03f,
+  8.12835526e-03f, 7.70096947e-03f, 7.27357157e-03f, 6.84872363e-03f, 6.42881775e-03f, 6.01606071e-03f,
+  5.61245484e-03f, 5.21979062e-03f, 4.83963871e-03f, 4.47334442e-03f, 4.12203185e-03f, 3.78660439e-03f,
+  3.46775260e-03f, 3.16596311e-03f, 2.88153044e-03f, 2.61456915e-03f, 2.36502988e-03f, 2.13271449e-03f,
+  1.91729271e-03f, 1.71831856e-03f, 1.53524801e-03f, 1.36745477e-03f, 1.21424685e-03f, 1.07488153e-03f,
+  9.48579574e-04f, 8.34538834e-04f, 7.31945795e-04f, 6.39986538e-04f, 5.57856343e-04f, 4.84767515e-04f,
+  4.19956399e-04f, 3.62689083e-04f, 3.12265736e-04f, 2.68024072e-04f, 2.29341604e-04f, 1.95637214e-04f,
+  1.66371785e-04f, 1.41048178e-04f, 1.19551364e-02f, 1.19367018e-02f, 1.18815666e-02f, 1.17902411e-02f,
+  1.16635626e-02f, 1.15026888e-02f, 1.13090752e-02f, 1.10844560e-02f, 1.08308177e-02f, 1.05503714e-02f,
+  1.02455150e-02f, 9.91880707e-03f, 9.57292505e-03f, 9.21063311e-03f, 8.83474201e-03f, 8.44807643e-03f,
+  8.05343967e-03f, 7.65357912e-03f, 7.25115696e-03f, 6.84872363e-03f, 6.44869031e-03f, 6.05331175e-03f,
+  5.66466339e-03f, 5.28463209e-03f, 4.91490355e-03f, 4.55695624e-03f, 4.21205722e-03f, 3.88126471e-03f,
+  3.56542948e-03f, 3.26520158e-03f, 2.98103970e-03f, 2.71322066e-03f, 2.46185251e-03f, 2.22688890e-03f,
+  2.00814311e-03f, 1.80530385e-03f, 1.61795178e-03f, 1.44557434e-03f, 1.28758186e-03f, 1.14332291e-03f,
+  1.01209781e-03f, 8.93173215e-04f, 7.85793527e-04f, 6.89192908e-04f, 6.02605054e-04f, 5.25272044e-04f,
+  4.56452311e-04f, 3.95426818e-04f, 3.41504463e-04f, 2.94026366e-04f, 2.52368831e-04f, 2.15945794e-04f,
+  1.84210076e-04f, 1.56654030e-04f, 1.32809568e-04f, 1.12221492e-02f, 1.12048443e-02f, 1.11530898e-02f,
+  1.10673634e-02f, 1.09484522e-02f, 1.07974410e-02f, 1.06156981e-02f, 1.04048513e-02f, 1.01667643e-02f,
+  9.90351196e-03f, 9.61734727e-03f, 9.31067020e-03f, 8.98599438e-03f, 8.64591543e-03f, 8.29307083e-03f,
+  7.93011207e-03f, 7.55967107e-03f, 7.18432665e-03f, 6.80657756e-03f, 6.42881775e-03f, 6.05331175e-03f,
+  5.68217365e-03f, 5.31735411e-03f, 4.96062357e-03f, 4.61356342e-03f, 4.27756226e-03f, 3.95380938e-03f,
+  3.64329852e-03f, 3.34682758e-03f, 3.06500727e-03f, 2.79826764e-03f, 2.54686899e-03f, 2.31091259e-03f,
+  2.09035492e-03f, 1.88502076e-03f, 1.69461803e-03f, 1.51875278e-03f, 1.35694398e-03f, 1.20863831e-03f,
+  1.07322400e-03f, 9.50044603e-04f, 8.38411390e-04f, 7.37615337e-04f, 6.46937464e-04f, 5.65658440e-04f,
+  4.93066851e-04f, 4.28466534e-04f, 3.71182599e-04f, 3.20566323e-04f, 2.75999162e-04f, 2.36895721e-04f,
+  2.02705836e-04f, 1.72915868e-04f, 1.47049344e-04f, 1.24666811e-04f, 1.05016399e-02f, 1.04854461e-02f,
+  1.04370145e-02f, 1.03567922e-02f, 1.02455150e-02f, 1.01041999e-02f, 9.93412547e-03f, 9.73681547e-03f,
+  9.51401517e-03f, 9.26766451e-03f, 8.99987295e-03f, 8.71288497e-03f, 8.40905588e-03f, 8.09081085e-03f,
+  7.76062021e-03f, 7.42096547e-03f, 7.07430858e-03f, 6.72306214e-03f, 6.36956654e-03f, 6.01606071e-03f,
+  5.66466339e-03f, 5.31735411e-03f, 4.97595780e-03f, 4.64213034e-03f, 4.31735301e-03f, 4.00292454e-03f,
+  3.69995832e-03f, 3.40938335e-03f, 3.13194701e-03f, 2.86822068e-03f, 2.61860713e-03f, 2.38334923e-03f,
+  2.16254219e-03f, 1.95614528e-03f, 1.76399446e-03f, 1.58581638e-03f, 1.42124237e-03f, 1.26982247e-03f,
+  1.13103865e-03f, 1.00431847e-03f, 8.89047689e-04f, 7.84581818e-04f, 6.90257351e-04f, 6.05401350e-04f,
+  5.29340759e-04f, 4.61409858e-04f, 4.00957157e-04f, 3.47351102e-04f, 2.99984589e-04f, 2.58278829e-04f,
+  2.21686001e-04f, 1.89691258e-04f, 1.61813950e-04f, 1.37608149e-04f, 1.16662683e-04f, 9.79710557e-03f,
+  9.78199765e-03f, 9.73681547e-03f, 9.66197532e-03f, 9.55816358e-03f, 9.42632928e-03f, 9.26766451e-03f,
+  9.08359140e-03f, 8.87573883e-03f, 8.64591543e-03f, 8.39608908e-03f, 8.12835526e-03f, 7.84490909e-03f,
+  7.54801417e-03f, 7.23997550e-03f, 6.92310743e-03f, 6.59970706e-03f, 6.27202541e-03f, 5.94224455e-03f,
+  5.61245484e-03f, 5.28463209e-03f, 4.96062357e-03f, 4.64213034e-03f, 4.33069887e-03f, 4.02771030e-03f,
+  3.73437628e-03f, 3.45173525e-03f, 3.18065449e-03f, 2.92183086e-03f, 2.67579756e-03f, 2.44292989e-03f,
+  2.22345488e-03f, 2.01746146e-03f, 1.82491133e-03f, 1.64565153e-03f, 1.47942698e-03f, 1.32589403e-03f,
+  1.18463254e-03f, 1.05515949e-03f, 9.36940720e-04f, 8.29403230e-04f, 7.31945795e-04f, 6.43949315e-04f,
+  5.64786140e-04f, 4.93828324e-04f, 4.30454762e-04f, 3.74057738e-04f, 3.24047985e-04f, 2.79859232e-04f,
+  2.40951413e-04f, 2.06813522e-04f, 1.76965244e-04f, 1.50958163e-04f, 1.28376283e-04f, 1.08836008e-04f,
+  9.11167078e-03f, 9.09762084e-03f, 9.05559957e-03f, 8.98599438e-03f, 8.88944604e-03f, 8.76683462e-03f,
+  8.61927122e-03f, 8.44807643e-03f, 8.25476553e-03f, 8.04102141e-03f, 7.80867366e-03f, 7.55967107e-03f,
+  7.29605556e-03f, 7.01993285e-03f, 6.73344545e-03f, 6.43874658e-03f, 6.13797177e-03f, 5.83321601e-03f,
+  5.52650774e-03f, 5.21979062e-03f, 4.91490355e-03f, 4.61356342e-03f, 4.31735301e-03f, 4.02771030e-03f,
+  3.74591979e-03f, 3.47310817e-03f, 3.21024167e-03f, 2.95812637e-03f, 2.71741091e-03f, 2.48859078e-03f,
+  2.27201520e-03f, 2.06789537e-03f, 1.87631394e-03f, 1.69723516e-03f, 1.53051689e-03f, 1.37592189e-03f,
+  1.23313058e-03f, 1.10175216e-03f, 9.81337391e-04f, 8.71389580e-04f, 7.71375722e-04f, 6.80736674e-04f,
+  5.98896702e-04f, 5.25272044e-04f, 4.59278614e-04f, 4.00338875e-04f, 3.47887544e-04f, 3.01376625e-04f,
+  2.60279427e-04f, 2.24093747e-04f, 1.92344247e-04f, 1.64584228e-04f, 1.40396689e-04f, 1.19394703e-04f,
+  1.01221522e-04f, 8.44807643e-03f, 8.43505003e-03f, 8.39608908e-03f, 8.33155308e-03f, 8.24203622e-03f,
+  8.12835526e-03f, 7.99153838e-03f, 7.83281121e-03f, 7.65357912e-03f, 7.45540159e-03f, 7.23997550e-03f,
+  7.00910762e-03f, 6.76469086e-03f, 6.50867773e-03f, 6.24305522e-03f, 5.96981868e-03f, 5.69094950e-03f,
+  5.40838856e-03f, 5.12401760e-03f, 4.83963871e-03f, 4.55695624e-03f, 4.27756226e-03f, 4.00292454e-03f,
+  3.73437628e-03f, 3.47310817e-03f, 3.22016515e-03f, 2.97644292e-03f, 2.74268887e-03f, 2.51950463e-03f,
+  2.30734912e-03f, 2.10654666e-03f, 1.91729271e-03f, 1.73966389e-03f, 1.57362723e-03f, 1.41905085e-03f,
+  1.27571484e-03f, 1.14332291e-03f, 1.02151267e-03f, 9.09867522e-04f, 8.07927107e-04f, 7.15197180e-04f,
+  6.31159288e-04f, 5.55279665e-04f, 4.87017009e-04f, 4.25829814e-04f, 3.71182599e-04f, 3.22551234e-04f,
+  2.79427681e-04f, 2.41323549e-04f, 2.07773221e-04f, 1.78335991e-04f, 1.52597728e-04f, 1.30171728e-04f,
+  1.10699300e-04f, 9.38496523e-05f, 7.80867366e-03f, 7.79663259e-03f, 7.76062021e-03f, 7.70096947e-03f,
+  7.61822751e-03f, 7.51315057e-03f, 7.38668861e-03f, 7.23997550e-03f, 7.07430858e-03f, 6.89113000e-03f,
+  6.69200905e-03f, 6.47861464e-03f, 6.25269720e-03f, 6.01606071e-03f, 5.77054173e-03f, 5.51798567e-03f,
+  5.26022259e-03f, 4.99904761e-03f, 4.73619998e-03f, 4.47334442e-03f, 4.21205722e-03f, 3.95380938e-03f,
+  3.69995832e-03f, 3.45173525e-03f, 3.21024167e-03f, 2.97644292e-03f, 2.75116717e-03f, 2.53510522e-03f,
+  2.32881261e-03f, 2.13271449e-03f, 1.94711005e-03f, 1.77217997e-03f, 1.60799525e-03f, 1.45452528e-03f,
+  1.31164817e-03f, 1.17916078e-03f, 1.05678907e-03f, 9.44198167e-04f, 8.41003086e-04f, 7.46778154e-04f,
+  6.61066617e-04f, 5.83389250e-04f, 5.13252628e-04f, 4.50156513e-04f, 3.93600349e-04f, 3.43089167e-04f,
+  2.98138533e-04f, 2.58278829e-04f, 2.23058669e-04f, 1.92047635e-04f, 1.64838420e-04f, 1.41048178e-04f,
+  1.20319521e-04f, 1.02320890e-04f, 8.67465278e-05f, 7.19542196e-03f, 7.18432665e-03f, 7.15114269e-03f,
+  7.09617650e-03f, 7.01993285e-03f, 6.92310743e-03f, 6.80657756e-03f, 6.67138631e-03f, 6.51872996e-03f,
+  6.34993752e-03f, 6.16645440e-03f, 5.96981868e-03f, 5.76164341e-03f, 5.54359099e-03f, 5.31735411e-03f,
+  5.08463243e-03f, 4.84711304e-03f, 4.60644905e-03f, 4.36424417e-03f, 4.12203185e-03f, 3.88126471e-03f,
+  3.64329852e-03f, 3.40938335e-03f, 3.18065449e-03f, 2.95812637e-03f, 2.74268887e-03f, 2.53510522e-03f,
+  2.33601150e-03f, 2.14592018e-03f, 1.96522241e-03f, 1.79419434e-03f, 1.63300242e-03f, 1.48171186e-03f,
+  1.34029461e-03f, 1.20863831e-03f, 1.08655577e-03f, 9.73794493e-04f, 8.70045857e-04f, 7.74955202e-04f,
+  6.88130211e-04f, 6.09149924e-04f, 5.37572952e-04f, 4.72944492e-04f, 4.14803624e-04f, 3.62689083e-04f,
+  3.16144782e-04f, 2.74724327e-04f, 2.37995002e-04f, 2.05540826e-04f, 1.76965244e-04f, 1.51892891e-04f,
+  1.29970998e-04f, 1.10870271e-04f, 9.42851548e-05f, 7.99339177e-05f, 6.60989946e-03f, 6.59970706e-03f,
+  6.56922348e-03f, 6.51872996e-03f, 6.44869031e-03f, 6.35974435e-03f, 6.25269720e-03f, 6.12850720e-03f,
+  5.98827284e-03f, 5.83321601e-03f, 5.66466339e-03f, 5.48402919e-03f, 5.29279374e-03f, 5.09248534e-03f,
+  4.88465838e-03f, 4.67087422e-03f, 4.45268257e-03f, 4.23160242e-03f, 4.00910666e-03f, 3.78660439e-03f,
+  3.56542948e-03f, 3.34682758e-03f, 3.13194701e-03f, 2.92183086e-03f, 2.71741091e-03f, 2.51950463e-03f,
+  2.32881261e-03f, 2.14592018e-03f, 1.97129743e-03f, 1.80530385e-03f, 1.64819299e-03f, 1.50011794e-03f,
+  1.36113854e-03f, 1.23122905e-03f, 1.11028622e-03f, 9.98138101e-04f, 8.94552621e-04f, 7.99246482e-04f,
+  7.11893721e-04f, 6.32134092e-04f, 5.59580803e-04f, 4.93828324e-04f, 4.34458954e-04f, 3.81049264e-04f,
+  3.33175500e-04f, 2.90418713e-04f, 2.52368831e-04f, 2.18628324e-04f, 1.88815087e-04f, 1.62564815e-04f,
+  1.39532713e-04f, 1.19394703e-04f, 1.01848273e-04f, 8.66127593e-05f, 7.34293499e-05f, 6.05331175e-03f,
+  6.04397710e-03f, 6.01606071e-03f, 5.96981868e-03f, 5.90567710e-03f, 5.82422083e-03f, 5.72618749e-03f,
+  5.61245484e-03f, 5.48402919e-03f, 5.34202857e-03f, 5.18766930e-03f, 5.02224499e-03f, 4.84711304e-03f,
+  4.66367137e-03f, 4.47334442e-03f, 4.27756226e-03f, 4.07774327e-03f, 3.87527957e-03f, 3.67151899e-03f,
+  3.46775260e-03f, 3.26520158e-03f, 3.06500727e-03f, 2.86822068e-03f, 2.67579756e-03f, 2.48859078e-03f,
+  2.30734912e-03f, 2.13271449e-03f, 1.96522241e-03f, 1.80530385e-03f, 1.65328791e-03f, 1.50940660e-03f,
+  1.37380022e-03f, 1.24652358e-03f, 1.12755317e-03f, 1.01679435e-03f, 9.14089673e-04f, 8.19226610e-04f,
+  7.31945795e-04f, 6.51948561e-04f, 5.78905107e-04f, 5.12461178e-04f, 4.52245411e-04f, 3.97875265e-04f,
+  3.48962931e-04f, 3.05120397e-04f, 2.65963958e-04f, 2.31118058e-04f, 2.00218681e-04f, 1.72915868e-04f,
+  1.48876017e-04f, 1.27783322e-04f, 1.09341046e-04f, 9.32721232e-05f, 7.93195140e-05f, 6.72462193e-05f,
+  5.52650774e-03f, 5.51798567e-03f, 5.49249863e-03f, 5.45028131e-03f, 5.39172161e-03f, 5.31735411e-03f,
+  5.22785215e-03f, 5.12401760e-03f, 5.00676828e-03f, 4.87712584e-03f, 4.73619998e-03f, 4.58517252e-03f,
+  4.42528166e-03f, 4.25780425e-03f, 4.08404088e-03f, 3.90529726e-03f, 3.72286816e-03f, 3.53802415e-03f,
+  3.35199642e-03f, 3.16596311e-03f, 2.98103970e-03f, 2.79826764e-03f, 2.61860713e-03f, 2.44292989e-03f,
+  2.27201520e-03f, 2.10654666e-03f, 1.94711005e-03f, 1.79419434e-03f, 1.64819299e-03f, 1.50940660e-03f,
+  1.37804693e-03f, 1.25424203e-03f, 1.13804196e-03f, 1.02942518e-03f, 9.28305381e-04f, 8.34538834e-04f,
+  7.47931481e-04f, 6.68246474e-04f, 5.95211226e-04f, 5.28524513e-04f, 4.67863021e-04f, 4.12887661e-04f,
+  3.63249215e-04f, 3.18593608e-04f, 2.78566557e-04f, 2.42817798e-04f, 2.11004459e-04f, 1.82794174e-04f,
+  1.57867456e-04f, 1.35919719e-04f, 1.16662683e-04f, 9.98253818e-05f, 8.51548903e-05f, 7.24165511e-05f,
+  6.13939555e-05f, 5.03000151e-03f, 5.02224499e-03f, 4.99904761e-03f, 4.96062357e-03f, 4.90732491e-03f,
+  4.83963871e-03f, 4.75817779e-03f, 4.66367137e-03f, 4.55695624e-03f, 4.43896092e-03f, 4.31069592e-03f,
+  4.17323643e-03f, 4.02771030e-03f, 3.87527957e-03f, 3.71712749e-03f, 3.55444197e-03f, 3.38840252e-03f,
+  3.22016515e-03f, 3.05085024e-03f, 2.88153044e-03f, 2.71322066e-03f, 2.54686899e-03f, 2.38334923e-03f,
+  2.22345488e-03f, 2.06789537e-03f, 1.91729271e-03f, 1.77217997e-03f, 1.63300242e-03f, 1.50011794e-03f,
+  1.37380022e-03f, 1.25424203e-03f, 1.14155980e-03f, 1.03579927e-03f, 9.36940720e-04f, 8.44905619e-04f,
+  7.59563176e-04f, 6.80736674e-04f, 6.08210627e-04f, 5.41736954e-04f, 4.81041410e-04f, 4.25829814e-04f,
+  3.75793490e-04f, 3.30614595e-04f, 2.89970892e-04f, 2.53539911e-04f, 2.21002847e-04f, 1.92047635e-04f,
+  1.66371785e-04f, 1.43684520e-04f, 1.23708582e-04f, 1.06181607e-04f, 9.08569855e-05f, 7.75045046e-05f,
+  6.59105863e-05f, 5.58782704e-05f, 4.56399377e-03f, 4.55695624e-03f, 4.53590788e-03f, 4.50104335e-03f,
+  4.45268257e-03f, 4.39126696e-03f, 4.31735301e-03f, 4.23160242e-03f, 4.13477374e-03f, 4.02771030e-03f,
+  3.91132850e-03f, 3.78660439e-03f, 3.65456054e-03f, 3.51625192e-03f, 3.37275164e-03f, 3.22513841e-03f,
+  3.07448185e-03f, 2.92183086e-03f, 2.76820222e-03f, 2.61456915e-03f, 2.46185251e-03f, 2.31091259e-03f,
+  2.16254219e-03f, 2.01746146e-03f, 1.87631394e-03f, 1.73966389e-03f, 1.60799525e-03f, 1.48171186e-03f,
+  1.36113854e-03f, 1.24652358e-03f, 1.13804196e-03f, 1.03579927e-03f, 9.39836958e-04f, 8.50137265e-04f,
+  7.66628829e-04f, 6.89192908e-04f, 6.17669371e-04f, 5.51862584e-04f, 4.91547340e-04f, 4.36475006e-04f,
+  3.86378524e-04f, 3.40977858e-04f, 2.99984589e-04f, 2.63106340e-04f, 2.30050544e-04f, 2.00527895e-04f,
+  1.74255270e-04f, 1.50958163e-04f, 1.30372762e-04f, 1.12247522e-04f, 9.63443381e-05f, 8.24394810e-05f,
+  7.03240512e-05f, 5.98042534e-05f, 5.07013901e-05f, 4.12839791e-03f, 4.12203185e-03f, 4.10299236e-03f,
+  4.07145545e-03f, 4.02771030e-03f, 3.97215644e-03f, 3.90529726e-03f, 3.82773089e-03f, 3.74014350e-03f,
+  3.64329852e-03f, 3.53802415e-03f, 3.42520396e-03f, 3.30576277e-03f, 3.18065449e-03f, 3.05085024e-03f,
+  2.91732536e-03f, 2.78104772e-03f, 2.64296611e-03f, 2.50399997e-03f, 2.36502988e-03f, 2.22688890e-03f,
+  2.09035492e-03f, 1.95614528e-03f, 1.82491133e-03f, 1.69723516e-03f, 1.57362723e-03f, 1.45452528e-03f,
+  1.34029461e-03f, 1.23122905e-03f, 1.12755317e-03f, 1.02942518e-03f, 9.36940720e-04f, 8.50137265e-04f,
+  7.68998580e-04f, 6.93460344e-04f, 6.23415108e-04f, 5.58717933e-04f, 4.99191810e-04f, 4.44633188e-04f,
+  3.94817034e-04f, 3.49501875e-04f, 3.08434304e-04f, 2.71353521e-04f, 2.37995002e-04f, 2.08094105e-04f,
+  1.81389143e-04f, 1.57624032e-04f, 1.36550443e-04f, 1.17929754e-04f, 1.01534417e-04f, 8.71490629e-05f,
+  7.45713114e-05f, 6.36121986e-05f, 5.40964284e-05f, 4.58623581e-05f, 3.72286816e-03f, 3.71712749e-03f,
+  3.69995832e-03f, 3.67151899e-03f, 3.63207096e-03f, 3.58197419e-03f, 3.52168246e-03f, 3.45173525e-03f,
+  3.37275164e-03f, 3.28541966e-03f, 3.19048646e-03f, 3.08874855e-03f, 2.98103970e-03f, 2.86822068e-03f,
+  2.75116717e-03f, 2.63075833e-03f, 2.50786706e-03f, 2.38334923e-03f, 2.25803372e-03f, 2.13271449e-03f,
+  2.00814311e-03f, 1.88502076e-03f, 1.76399446e-03f, 1.64565153e-03f, 1.53051689e-03f, 1.41905085e-03f,
+  1.31164817e-03f, 1.20863831e-03f, 1.11028622e-03f, 1.01679435e-03f, 9.28305381e-04f, 8.44905619e-04f,
+  7.66628829e-04f, 6.93460344e-04f, 6.25342189e-04f, 5.62177447e-04f, 5.03835385e-04f, 4.50156513e-04f,
+  4.00957157e-04f, 3.56034434e-04f, 3.15170531e-04f, 2.78137013e-04f, 2.44698633e-04f, 2.14616899e-04f,
+  1.87653146e-04f, 1.63571414e-04f, 1.42140721e-04f, 1.23137186e-04f, 1.06345593e-04f, 9.15607525e-05f,
+  7.85884695e-05f, 6.72462193e-05f, 5.73636098e-05f, 4.87825710e-05f, 4.13573289e-05f, 3.34682758e-03f,
+  3.34166666e-03f, 3.32623161e-03f, 3.30066518e-03f, 3.26520158e-03f, 3.22016515e-03f, 3.16596311e-03f,
+  3.10308137e-03f, 3.03207571e-03f, 2.95356498e-03f, 2.86822068e-03f, 2.77675921e-03f, 2.67993007e-03f,
+  2.57850671e-03f, 2.47327634e-03f, 2.36502988e-03f, 2.25455174e-03f, 2.14261119e-03f, 2.02995352e-03f,
+  1.91729271e-03f, 1.80530385e-03f, 1.69461803e-03f, 1.58581638e-03f, 1.47942698e-03f, 1.37592189e-03f,
+  1.27571484e-03f, 1.17916078e-03f, 1.08655577e-03f, 9.98138101e-04f, 9.14089673e-04f, 8.34538834e-04f,
+  7.59563176e-04f, 6.89192908e-04f, 6.23415108e-04f, 5.62177447e-04f, 5.05392847e-04f, 4.52943845e-04f,
+  4.04686958e-04f, 3.60457168e-04f, 3.20071995e-04f, 2.83335685e-04f, 2.50042853e-04f, 2.19982045e-04f,
+  1.92938809e-04f, 1.68698622e-04f, 1.47049344e-04f, 1.27783322e-04f, 1.10699300e-04f, 9.56038057e-05f,
+  8.23123555e-05f, 7.06503779e-05f, 6.04537890e-05f, 5.15694082e-05f, 4.38551251e-05f, 3.71798960e-05f,
+  2.99949804e-03f, 2.99487286e-03f, 2.98103970e-03f, 2.95812637e-03f, 2.92634335e-03f, 2.88598053e-03f,
+  2.83740368e-03f, 2.78104772e-03f, 2.71741091e-03f, 2.64704786e-03f, 2.57056067e-03f, 2.48859078e-03f,
+  2.40181037e-03f, 2.31091259e-03f, 2.21660291e-03f, 2.11959030e-03f, 2.02057720e-03f, 1.92025374e-03f,
+  1.81928754e-03f, 1.71831856e-03f, 1.61795178e-03f, 1.51875278e-03f, 1.42124237e-03f, 1.32589403e-03f,
+  1.23313058e-03f, 1.14332291e-03f, 1.05678907e-03f, 9.73794493e-04f, 8.94552621e-04f, 8.19226610e-04f,
+  7.47931481e-04f, 6.80736674e-04f, 6.17669371e-04f, 5.58717933e-04f, 5.03835385e-04f, 4.52943845e-04f,
+  4.05937928e-04f, 3.62689083e-04f, 3.23049375e-04f, 2.86855327e-04f, 2.53931474e-04f, 2.24093747e-04f,
+  1.97152593e-04f, 1.72915868e-04f, 1.51191300e-04f, 1.31788751e-04f, 1.14522139e-04f, 9.92110727e-05f,
+  8.56821644e-05f, 7.37700902e-05f, 6.33183736e-05f, 5.41799745e-05f, 4.62176031e-05f, 3.93038972e-05f,
+  3.33214157e-05f, 2.67993007e-03f, 2.67579756e-03f, 2.66343821e-03f, 2.64296611e-03f, 2.61456915e-03f,
+  2.57850671e-03f, 2.53510522e-03f, 2.48475326e-03f, 2.42789648e-03f, 2.36502988e-03f, 2.29669176e-03f,
+  2.22345488e-03f, 2.14592018e-03f, 2.06470676e-03f, 1.98044488e-03f, 1.89376785e-03f, 1.80530385e-03f,
+  1.71566883e-03f, 1.62545964e-03f, 1.53524801e-03f, 1.44557434e-03f, 1.35694398e-03f, 1.26982247e-03f,
+  1.18463254e-03f, 1.10175216e-03f, 1.02151267e-03f, 9.44198167e-04f, 8.70045857e-04f, 7.99246482e-04f,
+  7.31945795e-04f, 6.68246474e-04f, 6.08210627e-04f, 5.51862584e-04f, 4.99191810e-04f, 4.50156513e-04f,
+  4.04686958e-04f, 3.62689083e-04f, 3.24047985e-04f, 2.88631534e-04f, 2.56293628e-04f, 2.26877484e-04f,
+  2.00218681e-04f, 1.76147849e-04f, 1.54493318e-04f, 1.35083304e-04f, 1.17747906e-04f, 1.02320890e-04f,
+  8.86410708e-05f, 7.65535442e-05f, 6.59105863e-05f, 5.65724004e-05f, 4.84076118e-05f, 4.12935551e-05f,
+  3.51164417e-05f, 2.97713323e-05f, 2.38703005e-03f, 2.38334923e-03f, 2.37234076e-03f, 2.35410593e-03f,
+  2.32881261e-03f, 2.29669176e-03f, 2.25803372e-03f, 2.21318495e-03f, 2.16254219e-03f, 2.10654666e-03f,
+  2.04567728e-03f, 1.98044488e-03f, 1.91138417e-03f, 1.83904695e-03f, 1.76399446e-03f, 1.68679061e-03f,
+  1.60799525e-03f, 1.52815680e-03f, 1.44780695e-03f, 1.36745477e-03f, 1.28758186e-03f, 1.20863831e-03f,
+  1.13103865e-03f, 1.05515949e-03f, 9.81337391e-04f, 9.09867522e-04f, 8.41003086e-04f, 7.74955202e-04f,
+  7.11893721e-04f, 6.51948561e-04f, 5.95211226e-04f, 5.41736954e-04f, 4.91547340e-04f, 4.44633188e-04f,
+  4.00957157e-04f, 3.60457168e-04f, 3.23049375e-04f, 2.88631534e-04f, 2.57085863e-04f, 2.28282297e-04f,
+  2.02081166e-04f, 1.78335991e-04f, 1.56895971e-04f, 1.37608149e-04f, 1.20319521e-04f, 1.04878782e-04f,
+  9.11378447e-05f, 7.89531477e-05f, 6.81867095e-05f, 5.87069590e-05f, 5.03893825e-05f, 4.31169537e-05f,
+  3.67804205e-05f, 3.12784287e-05f, 2.65175076e-05f, 2.11959030e-03f, 2.11632182e-03f, 2.10654666e-03f,
+  2.09035492e-03f, 2.06789537e-03f, 2.03937315e-03f, 2.00504647e-03f, 1.96522241e-03f, 1.92025374e-03f,
+  1.87053182e-03f, 1.81648217e-03f, 1.75855833e-03f, 1.69723516e-03f, 1.63300242e-03f, 1.56635873e-03f,
+  1.49780477e-03f, 1.42783741e-03f, 1.35694398e-03f, 1.28559640e-03f, 1.21424685e-03f, 1.14332291e-03f,
+  1.07322400e-03f, 1.00431847e-03f, 9.36940720e-04f, 8.71389580e-04f, 8.07927107e-04f, 7.46778154e-04f,
+  6.88130211e-04f, 6.32134092e-04f, 5.78905107e-04f, 5.28524513e-04f, 4.81041410e-04f, 4.36475006e-04f,
+  3.94817034e-04f, 3.56034434e-04f, 3.20071995e-04f, 2.86855327e-04f, 2.56293628e-04f, 2.28282297e-04f,
+  2.02705836e-04f, 1.79440249e-04f, 1.58355455e-04f, 1.39317548e-04f, 1.22190700e-04f, 1.06839077e-04f,
+  9.31282921e-05f, 8.09268749e-05f, 7.01073368e-05f, 6.05471541e-05f, 5.21295078e-05f, 4.47438215e-05f,
+  3.82861872e-05f, 3.26595909e-05f, 2.77740328e-05f, 2.35465195e-05f, 1.87631394e-03f, 1.87342067e-03f,
+  1.86476740e-03f, 1.85043411e-03f, 1.83055247e-03f, 1.80530385e-03f, 1.77491689e-03f, 1.73966389e-03f,
+  1.69985637e-03f, 1.65584125e-03f, 1.60799525e-03f, 1.55671965e-03f, 1.50243472e-03f, 1.44557434e-03f,
+  1.38657971e-03f, 1.32589403e-03f, 1.26395724e-03f, 1.20120053e-03f, 1.13804196e-03f, 1.07488153e-03f,
+  1.01209781e-03f, 9.50044603e-04f, 8.89047689e-04f, 8.29403230e-04f, 7.71375722e-04f, 7.15197180e-04f,
+  6.61066617e-04f, 6.09149924e-04f, 5.59580803e-04f, 5.12461178e-04f, 4.67863021e-04f, 4.25829814e-04f,
+  3.86378524e-04f, 3.49501875e-04f, 3.15170531e-04f, 2.83335685e-04f, 2.53931474e-04f, 2.26877484e-04f,
+  2.02081166e-04f, 1.79440249e-04f, 1.58844967e-04f, 1.40180186e-04f, 1.23327351e-04f, 1.08166249e-04f,
+  9.45766078e-05f, 8.24394810e-05f, 7.16384820e-05f, 6.20607534e-05f, 5.35978470e-05f, 4.61463351e-05f,
+  3.96083415e-05f, 3.38918835e-05f, 2.89110812e-05f, 2.45862648e-05f, 2.08439651e-05f, 1.65584125e-03f,
+  1.65328791e-03f, 1.64565153e-03f, 1.63300242e-03f, 1.61545689e-03f, 1.59317511e-03f, 1.56635873e-03f,
+  1.53524801e-03f, 1.50011794e-03f, 1.46127481e-03f, 1.41905085e-03f, 1.37380022e-03f, 1.32589403e-03f,
+  1.27571484e-03f, 1.22365227e-03f, 1.17009738e-03f, 1.11543830e-03f, 1.06005580e-03f, 1.00431847e-03f,
+  9.48579574e-04f, 8.93173215e-04f, 8.38411390e-04f, 7.84581818e-04f, 7.31945795e-04f, 6.80736674e-04f,
+  6.31159288e-04f, 5.83389250e-04f, 5.37572952e-04f, 4.93828324e-04f, 4.52245411e-04f, 4.12887661e-04f,
+  3.75793490e-04f, 3.40977858e-04f, 3.08434304e-04f, 2.78137013e-04f, 2.50042853e-04f, 2.24093747e-04f,
+  2.00218681e-04f, 1.78335991e-04f, 1.58355455e-04f, 1.40180186e-04f, 1.23708582e-04f, 1.08836008e-04f,
+  9.54563802e-05f, 8.34635575e-05f, 7.27525839e-05f, 6.32207375e-05f, 5.47684249e-05f, 4.72999345e-05f,
+  4.07239968e-05f, 3.49542388e-05f, 2.99094827e-05f, 2.55139403e-05f, 2.16973021e-05f, 1.83947341e-05f,
+  1.45677163e-03f, 1.45452528e-03f, 1.44780695e-03f, 1.43667858e-03f, 1.42124237e-03f, 1.40163931e-03f,
+  1.37804693e-03f, 1.35067641e-03f, 1.31976977e-03f, 1.28559640e-03f, 1.24844874e-03f, 1.20863831e-03f,
+  1.16649154e-03f, 1.12234510e-03f, 1.07654149e-03f, 1.02942518e-03f, 9.81337391e-04f, 9.32613038e-04f,
+  8.83576635e-04f, 8.34538834e-04f, 7.85793527e-04f, 7.37615337e-04f, 6.90257351e-04f, 6.43949315e-04f,
+  5.98896702e-04f, 5.55279665e-04f, 5.13252628e-04f, 4.72944492e-04f, 4.34458954e-04f, 3.97875265e-04f,
+  3.63249215e-04f, 3.30614595e-04f, 2.99984589e-04f, 2.71353521e-04f, 2.44698633e-04f, 2.19982045e-04f,
+  1.97152593e-04f, 1.76147849e-04f, 1.56895971e-04f, 1.39317548e-04f, 1.23327351e-04f, 1.08836008e-04f,
+  9.57514567e-05f, 8.39803615e-05f, 7.34293499e-05f, 6.40060753e-05f, 5.56201740e-05f, 4.81840216e-05f,
+  4.16134098e-05f, 3.58280522e-05f, 3.07519476e-05f, 2.63136844e-05f, 2.24465857e-05f, 1.90887949e-05f,
+  1.61832704e-05f, 1.27768505e-03f, 1.27571484e-03f, 1.26982247e-03f, 1.26006210e-03f, 1.24652358e-03f,
+  1.22933043e-03f, 1.20863831e-03f, 1.18463254e-03f, 1.15752546e-03f, 1.12755317e-03f, 1.09497213e-03f,
+  1.06005580e-03f, 1.02309021e-03f, 9.84370825e-04f, 9.44198167e-04f, 9.02873988e-04f, 8.60697823e-04f,
+  8.17963388e-04f, 7.74955202e-04f, 7.31945795e-04f, 6.89192908e-04f, 6.46937464e-04f, 6.05401350e-04f,
+  5.64786140e-04f, 5.25272044e-04f, 4.87017009e-04f, 4.50156513e-04f, 4.14803624e-04f, 3.81049264e-04f,
+  3.48962931e-04f, 3.18593608e-04f, 2.89970892e-04f, 2.63106340e-04f, 2.37995002e-04f, 2.14616899e-04f,
+  1.92938809e-04f, 1.72915868e-04f, 1.54493318e-04f, 1.37608149e-04f, 1.22190700e-04f, 1.08166249e-04f,
+  9.54563802e-05f, 8.39803615e-05f, 7.36563306e-05f, 6.44023967e-05f, 5.61375673e-05f, 4.87825710e-05f,
+  4.22605735e-05f, 3.64977132e-05f, 3.14235731e-05f, 2.69714928e-05f, 2.30788428e-05f, 1.96871406e-05f,
+  1.67421367e-05f, 1.41937990e-05f, 1.11716101e-03f, 1.11543830e-03f, 1.11028622e-03f, 1.10175216e-03f,
+  1.08991459e-03f, 1.07488153e-03f, 1.05678907e-03f, 1.03579927e-03f, 1.01209781e-03f, 9.85891093e-04f,
+  9.57403507e-04f, 9.26873938e-04f, 8.94552621e-04f, 8.60697823e-04f, 8.25572293e-04f, 7.89439888e-04f,
+  7.52562599e-04f, 7.15197180e-04f, 6.77592412e-04f, 6.39986538e-04f, 6.02605054e-04f, 5.65658440e-04f,
+  5.29340759e-04f, 4.93828324e-04f, 4.59278614e-04f, 4.25829814e-04f, 3.93600349e-04f, 3.62689083e-04f,
+  3.33175500e-04f, 3.05120397e-04f, 2.78566557e-04f, 2.53539911e-04f, 2.30050544e-04f, 2.08094105e-04f,
+  1.87653146e-04f, 1.68698622e-04f, 1.51191300e-04f, 1.35083304e-04f, 1.20319521e-04f, 1.06839077e-04f,
+  9.45766078e-05f, 8.34635575e-05f, 7.34293499e-05f, 6.44023967e-05f, 5.63110989e-05f, 4.90846287e-05f,
+  4.26536935e-05f, 3.69510963e-05f, 3.19122628e-05f, 2.74756185e-05f, 2.35828848e-05f, 2.01792955e-05f,
+  1.72137152e-05f, 1.46387101e-05f, 1.24105381e-05f, 9.73794493e-04f, 9.72292852e-04f, 9.67801898e-04f,
+  9.60363017e-04f, 9.50044603e-04f, 9.36940720e-04f, 9.21170111e-04f, 9.02873988e-04f, 8.82214168e-04f,
+  8.59370630e-04f, 8.34538834e-04f, 8.07927107e-04f, 7.79753667e-04f, 7.50243489e-04f, 7.19625619e-04f,
+  6.88130211e-04f, 6.55985379e-04f, 6.23415108e-04f, 5.90636220e-04f, 5.57856343e-04f, 5.25272044e-04f,
+  4.93066851e-04f, 4.61409858e-04f, 4.30454762e-04f, 4.00338875e-04f, 3.71182599e-04f, 3.43089167e-04f,
+  3.16144782e-04f, 2.90418713e-04f, 2.65963958e-04f, 2.42817798e-04f, 2.21002847e-04f, 2.00527895e-04f,
+  1.81389143e-04f, 1.63571414e-04f, 1.47049344e-04f, 1.31788751e-04f, 1.17747906e-04f, 1.04878782e-04f,
+  9.31282921e-05f, 8.24394810e-05f, 7.27525839e-05f, 6.40060753e-05f, 5.61375673e-05f, 4.90846287e-05f,
+  4.27855448e-05f, 3.71798960e-05f, 3.22091219e-05f, 2.78169264e-05f, 2.39496421e-05f, 2.05564666e-05f,
+  1.75896621e-05f, 1.50046590e-05f, 1.27601079e-05f, 1.08178792e-05f, 8.46210518e-04f, 8.44905619e-04f,
+  8.41003086e-04f, 8.34538834e-04f, 8.25572293e-04f, 8.14185245e-04f, 8.00480833e-04f, 7.84581818e-04f,
+  7.66628829e-04f, 7.46778154e-04f, 7.25199759e-04f, 7.02074671e-04f, 6.77592412e-04f, 6.51948561e-04f,
+  6.25342189e-04f, 5.97973180e-04f, 5.70039963e-04f, 5.41736954e-04f, 5.13252628e-04f, 4.84767515e-04f,
+  4.56452311e-04f, 4.28466534e-04f, 4.00957157e-04f, 3.74057738e-04f, 3.47887544e-04f, 3.22551234e-04f,
+  2.98138533e-04f, 2.74724327e-04f, 2.52368831e-04f, 2.31118058e-04f, 2.11004459e-04f, 1.92047635e-04f,
+  1.74255270e-04f, 1.57624032e-04f, 1.42140721e-04f, 1.27783322e-04f, 1.14522139e-04f, 1.02320890e-04f,
+  9.11378447e-05f, 8.09268749e-05f, 7.16384820e-05f, 6.32207375e-05f, 5.56201740e-05f, 4.87825710e-05f,
+  4.26536935e-05f, 3.71798960e-05f, 3.23086861e-05f, 2.79891665e-05f, 2.41724265e-05f, 2.08118236e-05f,
+  1.78632126e-05f, 1.52851117e-05f, 1.30387889e-05f, 1.10883129e-05f, 9.40054997e-06f, 7.33076187e-04f,
+  7.31945795e-04f, 7.28564977e-04f, 7.22964935e-04f, 7.15197180e-04f, 7.05332553e-04f, 6.93460344e-04f,
+  6.79686957e-04f, 6.64134161e-04f, 6.46937464e-04f, 6.28244015e-04f, 6.08210627e-04f, 5.87001559e-04f,
+  5.64786140e-04f, 5.41736954e-04f, 5.18027053e-04f, 4.93828324e-04f, 4.69309278e-04f, 4.44633188e-04f,
+  4.19956399e-04f, 3.95426818e-04f, 3.71182599e-04f, 3.47351102e-04f, 3.24047985e-04f, 3.01376625e-04f,
+  2.79427681e-04f, 2.58278829e-04f, 2.37995002e-04f, 2.18628324e-04f, 2.00218681e-04f, 1.82794174e-04f,
+  1.66371785e-04f, 1.50958163e-04f, 1.36550443e-04f, 1.23137186e-04f, 1.10699300e-04f, 9.92110727e-05f,
+  8.86410708e-05f, 7.89531477e-05f, 7.01073368e-05f, 6.20607534e-05f, 5.47684249e-05f, 4.81840216e-05f,
+  4.22605735e-05f, 3.69510963e-05f, 3.22091219e-05f, 2.79891665e-05f, 2.42471488e-05f, 2.09406880e-05f,
+  1.80293810e-05f, 1.54749869e-05f, 1.32415653e-05f, 1.12955649e-05f, 9.60585749e-06f, 8.14374107e-06f,
+  6.33110350e-04f, 6.32134092e-04f, 6.29214279e-04f, 6.24377921e-04f, 6.17669371e-04f, 6.09149924e-04f,
+  5.98896702e-04f, 5.87001559e-04f, 5.73569618e-04f, 5.58717933e-04f, 5.42573573e-04f, 5.25272044e-04f,
+  5.06955141e-04f, 4.87769139e-04f, 4.67863021e-04f, 4.47386323e-04f, 4.26487473e-04f, 4.05311963e-04f,
+  3.84000828e-04f, 3.62689083e-04f, 3.41504463e-04f, 3.20566323e-04f, 2.99984589e-04f, 2.79859232e-04f,
+  2.60279427e-04f, 2.41323549e-04f, 2.23058669e-04f, 2.05540826e-04f, 1.88815087e-04f, 1.72915868e-04f,
+  1.57867456e-04f, 1.43684520e-04f, 1.30372762e-04f, 1.17929754e-04f, 1.06345593e-04f, 9.56038057e-05f,
+  8.56821644e-05f, 7.65535442e-05f, 6.81867095e-05f, 6.05471541e-05f, 5.35978470e-05f, 4.72999345e-05f,
+  4.16134098e-05f, 3.64977132e-05f, 3.19122628e-05f, 2.78169264e-05f, 2.41724265e-05f, 2.09406880e-05f,
+  1.80851130e-05f, 1.55708076e-05f, 1.33647418e-05f, 1.14358809e-05f, 9.75524654e-06f, 8.29595592e-06f,
+  7.03322030e-06f, 5.45091345e-04f, 5.44250768e-04f, 5.41736954e-04f, 5.37572952e-04f, 5.31797064e-04f,
+  5.24462084e-04f, 5.15634310e-04f, 5.05392847e-04f, 4.93828324e-04f, 4.81041410e-04f, 4.67141566e-04f,
+  4.52245411e-04f, 4.36475006e-04f, 4.19956399e-04f, 4.02817735e-04f, 3.85187857e-04f, 3.67194472e-04f,
+  3.48962931e-04f, 3.30614595e-04f, 3.12265736e-04f, 2.94026366e-04f, 2.75999162e-04f, 2.58278829e-04f,
+  2.40951413e-04f, 2.24093747e-04f, 2.07773221e-04f, 1.92047635e-04f, 1.76965244e-04f, 1.62564815e-04f,
+  1.48876017e-04f, 1.35919719e-04f, 1.23708582e-04f, 1.12247522e-04f, 1.01534417e-04f, 9.15607525e-05f,
+  8.23123555e-05f, 7.37700902e-05f, 6.59105863e-05f, 5.87069590e-05f, 5.21295078e-05f, 4.61463351e-05f,
+  4.07239968e-05f, 3.58280522e-05f, 3.14235731e-05f, 2.74756185e-05f, 2.39496421e-05f, 2.08118236e-05f,
+  1.80293810e-05f, 1.55708076e-05f, 1.34060547e-05f, 1.15066905e-05f, 9.84599228e-06f, 8.39900986e-06f,
+  7.14259977e-06f, 6.05541754e-06f, 4.67863021e-04f, 4.67141566e-04f, 4.64983867e-04f, 4.61409858e-04f,
+  4.56452311e-04f, 4.50156513e-04f, 4.42579447e-04f, 4.33789013e-04f, 4.23862948e-04f, 4.12887661e-04f,
+  4.00957157e-04f, 3.88171466e-04f, 3.74635420e-04f, 3.60457168e-04f, 3.45746696e-04f, 3.30614595e-04f,
+  3.15170531e-04f, 2.99522013e-04f, 2.83773261e-04f, 2.68024072e-04f, 2.52368831e-04f, 2.36895721e-04f,
+  2.21686001e-04f, 2.06813522e-04f, 1.92344247e-04f, 1.78335991e-04f, 1.64838420e-04f, 1.51892891e-04f,
+  1.39532713e-04f, 1.27783322e-04f, 1.16662683e-04f, 1.06181607e-04f, 9.63443381e-05f, 8.71490629e-05f,
+  7.85884695e-05f, 7.06503779e-05f, 6.33183736e-05f, 5.65724004e-05f, 5.03893825e-05f, 4.47438215e-05f,
+  3.96083415e-05f, 3.49542388e-05f, 3.07519476e-05f, 2.69714928e-05f, 2.35828848e-05f, 2.05564666e-05f,
+  1.78632126e-05f, 1.54749869e-05f, 1.33647418e-05f, 1.15066905e-05f, 9.87642761e-06f, 8.45101658e-06f,
+  7.20904200e-06f, 6.13063912e-06f, 5.19748892e-06f, 4.00338875e-04f, 3.99721554e-04f, 3.97875265e-04f,
+  3.94817034e-04f, 3.90575005e-04f, 3.85187857e-04f, 3.78704339e-04f, 3.71182599e-04f, 3.62689083e-04f,
+  3.53297830e-04f, 3.43089167e-04f, 3.32148775e-04f, 3.20566323e-04f, 3.08434304e-04f, 2.95846956e-04f,
+  2.82898778e-04f, 2.69683660e-04f, 2.56293628e-04f, 2.42817798e-04f, 2.29341604e-04f, 2.15945794e-04f,
+  2.02705836e-04f, 1.89691258e-04f, 1.76965244e-04f, 1.64584228e-04f, 1.52597728e-04f, 1.41048178e-04f,
+  1.29970998e-04f, 1.19394703e-04f, 1.09341046e-04f, 9.98253818e-05f, 9.08569855e-05f, 8.24394810e-05f,
+  7.45713114e-05f, 6.72462193e-05f, 6.04537890e-05f, 5.41799745e-05f, 4.84076118e-05f, 4.31169537e-05f,
+  3.82861872e-05f, 3.38918835e-05f, 2.99094827e-05f, 2.63136844e-05f, 2.30788428e-05f, 2.01792955e-05f,
+  1.75896621e-05f, 1.52851117e-05f, 1.32415653e-05f, 1.14358809e-05f, 9.84599228e-06f, 8.45101658e-06f,
+  7.23132644e-06f, 6.16859961e-06f, 5.24583720e-06f, 4.44736315e-06f, 3.41504463e-04f, 3.40977858e-04f,
+  3.39402905e-04f, 3.36794124e-04f, 3.33175500e-04f, 3.28580063e-04f, 3.23049375e-04f, 3.16633028e-04f,
+  3.09387746e-04f, 3.01376625e-04f, 2.92668265e-04f, 2.83335685e-04f, 2.73455400e-04f, 2.63106340e-04f,
+  2.52368831e-04f, 2.41323549e-04f, 2.30050544e-04f, 2.18628324e-04f, 2.07132936e-04f, 1.95637214e-04f,
+  1.84210076e-04f, 1.72915868e-04f, 1.61813950e-04f, 1.50958163e-04f, 1.40396689e-04f, 1.30171728e-04f,
+  1.20319521e-04f, 1.10870271e-04f, 1.01848273e-04f, 9.32721232e-05f, 8.51548903e-05f, 7.75045046e-05f,
+  7.03240512e-05f, 6.36121986e-05f, 5.73636098e-05f, 5.15694082e-05f, 4.62176031e-05f, 4.12935551e-05f,
+  3.67804205e-05f, 3.26595909e-05f, 2.89110812e-05f, 2.55139403e-05f, 2.24465857e-05f, 1.96871406e-05f,
+  1.72137152e-05f, 1.50046590e-05f, 1.30387889e-05f, 1.12955649e-05f, 9.75524654e-06f, 8.39900986e-06f,
+  7.20904200e-06f, 6.16859961e-06f, 5.26205304e-06f, 4.47490083e-06f, 3.79377184e-06f, 2.90418713e-04f,
+  2.89970892e-04f, 2.88631534e-04f, 2.86413007e-04f, 2.83335685e-04f, 2.79427681e-04f, 2.74724327e-04f,
+  2.69267795e-04f, 2.63106340e-04f, 2.56293628e-04f, 2.48887925e-04f, 2.40951413e-04f, 2.32549122e-04f,
+  2.23748182e-04f, 2.14616899e-04f, 2.05223885e-04f, 1.95637214e-04f, 1.85923636e-04f, 1.76147849e-04f,
+  1.66371785e-04f, 1.56654030e-04f, 1.47049344e-04f, 1.37608149e-04f, 1.28376283e-04f, 1.19394703e-04f,
+  1.10699300e-04f, 1.02320890e-04f, 9.42851548e-05f, 8.66127593e-05f, 7.93195140e-05f, 7.24165511e-05f,
+  6.59105863e-05f, 5.98042534e-05f, 5.40964284e-05f, 4.87825710e-05f, 4.38551251e-05f, 3.93038972e-05f,
+  3.51164417e-05f, 3.12784287e-05f, 2.77740328e-05f, 2.45862648e-05f, 2.16973021e-05f, 1.90887949e-05f,
+  1.67421367e-05f, 1.46387101e-05f, 1.27601079e-05f, 1.10883129e-05f, 9.60585749e-06f, 8.29595592e-06f,
+  7.14259977e-06f, 6.13063912e-06f, 5.24583720e-06f, 4.47490083e-06f, 3.80549932e-06f, 3.22626056e-06f,
+  2.46213807e-04f, 2.45834148e-04f, 2.44698633e-04f, 2.42817798e-04f, 2.40208887e-04f, 2.36895721e-04f,
+  2.32908278e-04f, 2.28282297e-04f, 2.23058669e-04f, 2.17282912e-04f, 2.11004459e-04f, 2.04275973e-04f,
+  1.97152593e-04f, 1.89691258e-04f, 1.81949858e-04f, 1.73986555e-04f, 1.65859077e-04f, 1.57624032e-04f,
+  1.49336222e-04f, 1.41048178e-04f, 1.32809568e-04f, 1.24666811e-04f, 1.16662683e-04f, 1.08836008e-04f,
+  1.01221522e-04f, 9.38496523e-05f, 8.67465278e-05f, 7.99339177e-05f, 7.34293499e-05f, 6.72462193e-05f,
+  6.13939555e-05f, 5.58782704e-05f, 5.07013901e-05f, 4.58623581e-05f, 4.13573289e-05f, 3.71798960e-05f,
+  3.33214157e-05f, 2.97713323e-05f, 2.65175076e-05f, 2.35465195e-05f, 2.08439651e-05f, 1.83947341e-05f,
+  1.61832704e-05f, 1.41937990e-05f, 1.24105381e-05f, 1.08178792e-05f, 9.40054997e-06f, 8.14374107e-06f,
+  7.03322030e-06f, 6.05541754e-06f, 5.19748892e-06f, 4.44736315e-06f, 3.79377184e-06f, 3.22626056e-06f,
+  2.73518822e-06f
+};
+static const float kern_row_18[] = {
+  2.46821088e-04f, 2.91135017e-04f, 3.42346786e-04f, 4.01326310e-04f, 4.69017017e-04f, 5.46435767e-04f,
+  6.34671887e-04f, 7.34884350e-04f, 8.48297670e-04f, 9.76196316e-04f, 1.11991644e-03f, 1.28083653e-03f,
+  1.46036467e-03f, 1.65992533e-03f, 1.88094180e-03f, 2.12481804e-03f, 2.39291764e-03f, 2.68653990e-03f,
+  3.00689647e-03f, 3.35508236e-03f, 3.73205054e-03f, 4.13858052e-03f, 4.57525067e-03f, 5.04240813e-03f,
+  5.54013858e-03f, 6.06824178e-03f, 6.62620272e-03f, 7.21316924e-03f, 7.82793388e-03f, 8.46891385e-03f,
+  9.13414452e-03f, 9.82126966e-03f, 1.05275419e-02f, 1.12498282e-02f, 1.19846240e-02f, 1.27280680e-02f,
+  1.34759750e-02f, 1.42238596e-02f, 1.49669843e-02f, 1.57003999e-02f, 1.64190009e-02f, 1.71175785e-02f,
+  1.77908838e-02f, 1.84336919e-02f, 1.90408640e-02f, 1.96074266e-02f, 2.01286264e-02f, 2.06000023e-02f,
+  2.10174471e-02f, 2.13772692e-02f, 2.16762479e-02f, 2.19116732e-02f, 2.20813993e-02f, 2.21838653e-02f,
+  2.22181268e-02f, 2.21838653e-02f, 2.20813993e-02f, 2.19116732e-02f, 2.16762479e-02f, 2.13772692e-02f,
+  2.10174471e-02f, 2.06000023e-02f, 2.01286264e-02f, 1.96074266e-02f, 1.90408640e-02f, 1.84336919e-02f,
+  1.77908838e-02f, 1.71175785e-02f, 1.64190009e-02f, 1.57003999e-02f, 1.49669843e-02f, 1.42238596e-02f,
+  1.34759750e-02f, 1.27280680e-02f, 1.19846240e-02f, 1.12498282e-02f, 1.05275419e-02f, 9.82126966e-03f,
+  9.13414452e-03f, 8.46891385e-03f, 7.82793388e-03f, 7.21316924e-03f, 6.62620272e-03f, 6.06824178e-03f,
+  5.54013858e-03f, 5.04240813e-03f, 4.57525067e-03f, 4.13858052e-03f, 3.73205054e-03f, 3.35508236e-03f,
+  3.00689647e-03f, 2.68653990e-03f, 2.39291764e-03f, 2.12481804e-03f, 1.88094180e-03f, 1.65992533e-03f,
+  1.46036467e-03f, 1.28083653e-03f, 1.11991644e-03f, 9.76196316e-04f, 8.48297670e-04f, 7.34884350e-04f,
+  6.34671887e-04f, 5.46435767e-04f, 4.69017017e-04f, 4.01326310e-04f, 3.42346786e-04f, 2.91135017e-04f,
+  2.46821088e-04f
+};
+static const int kern_half_fixed_18[] = {
+  8282, 8269, 8231, 8168, 8080, 7969, 7834, 7679, 7503, 7309, 7098, 6871,
+  6632, 6381, 6120, 5852, 5579, 5302, 5023, 4744, 4467, 4193, 3924, 3661,
+  3405, 3157, 2918, 2689, 2470, 2262, 2065, 1880, 1705, 1543, 1391, 1251,
+  1121, 1001, 892, 792, 701, 619, 544, 477, 417, 364, 316, 274,
+  237, 204, 175, 150, 128, 109, 92, 8269, 8256, 8218, 8155, 8068,
+  7956, 7822, 7667, 7492, 7298, 7087, 6861, 6621, 6371, 6111, 5843, 5570,
+  5294, 5016, 4737, 4460, 4187, 3918, 3655, 3400, 3152, 2913, 2685, 2466,
+  2258, 2062, 1877, 1703, 1540, 1389, 1249, 1119, 1000, 891, 791, 700,
+  618, 544, 477, 417, 363, 316, 274, 236, 203, 175, 149, 127,
+  108, 92, 8231, 8218, 8180, 8117, 8030, 7920, 7786, 7632, 7457, 7264,
+  7054, 6829, 6591, 6341, 6083, 5816, 5545, 5269, 4992, 4715, 4440, 4168,
+  3900, 3638, 3384, 3137, 2900, 2672, 2455, 2248, 2052, 1868, 1695, 1533,
+  1383, 1243, 1114, 995, 886, 787, 697, 615, 541, 475, 415, 362,
+  314, 272, 235, 202, 174, 149, 127, 108, 91, 8168, 8155, 8117,
+  8055, 7969, 7859, 7726, 7573, 7400, 7208, 7000, 6777, 6540, 6293, 6036,
+  5772, 5502, 5229, 4954, 4679, 4406, 4136, 3870, 3610, 3358, 3113, 2878,
+  2652, 2436, 2231, 2037, 1854, 1682, 1521, 1372, 1233, 1105, 988, 880,
+  781, 691, 610, 537, 471, 412, 359, 312, 270, 233, 201, 172,
+  148, 126, 107, 91, 8080, 8068, 8030, 7969, 7883, 7774, 7643, 7492,
+  7320, 7131, 6925, 6704, 6470, 6225, 5971, 5710, 5443, 5173, 4901, 4629,
+  4358, 4091, 3829, 3572, 3322, 3080, 2847, 2623, 2410, 2207, 2015, 1834,
+  1664, 1505, 1357, 1220, 1094, 977, 870, 773, 684, 604, 531, 466,
+  407, 355, 308, 267, 231, 199, 171, 146, 125, 106, 90, 7969,
+  7956, 7920, 7859, 7774, 7667, 7538, 7388, 7219, 7032, 6829, 6611, 6381,
+  6139, 5889, 5631, 5368, 5101, 4833, 4565, 4298, 4035, 3776, 3522, 3276,
+  3037, 2807, 2587, 2376, 2176, 1987, 1808, 1641, 1484, 1339, 1203, 1078,
+  964, 858, 762, 675, 595, 524, 459, 402, 350, 304, 264, 228,
+  196, 168, 144, 123, 104, 89, 7834, 7822, 7786, 7726, 7643, 7538,
+  7411, 7264, 7098, 6914, 6714, 6500, 6273, 6036, 5790, 5536, 5278, 5016,
+  4752, 4488, 4226, 3967, 3712, 3463, 3221, 2986, 2760, 2543, 2336, 2140,
+  1954, 1778, 1613, 1459, 1316, 1183, 1060, 947, 844, 749, 663, 585,
+  515, 452, 395, 344, 299, 259, 224, 193, 165, 142, 121, 103,
+  87, 7679, 7667, 7632, 7573, 7492, 7388, 7264, 7120, 6957, 6777, 6581,
+  6371, 6149, 5916, 5675, 5426, 5173, 4916, 4657, 4399, 4142, 3888, 3638,
+  3394, 3157, 2927, 2705, 2493, 2290, 2097, 1915, 1743, 1581, 1430, 1290,
+  1160, 1039, 928, 827, 734, 650, 574, 505, 443, 387, 337, 293,
+  254, 219, 189, 162, 139, 118, 101, 85, 7503, 7492, 7457, 7400,
+  7320, 7219, 7098, 6957, 6797, 6621, 6430, 6225, 6008, 5781, 5545, 5302,
+  5054, 4803, 4551, 4298, 4047, 3799, 3555, 3317, 3085, 2860, 2644, 2436,
+  2238, 2049, 1871, 1703, 1545, 1398, 1260, 1133, 1015, 907, 808, 718,
+  635, 561, 493, 433, 378, 330, 286, 248, 214, 185, 158, 136,
+  116, 98, 83, 7309, 7298, 7264, 7208, 7131, 7032, 6914, 6777, 6621,
+  6450, 6264, 6064, 5852, 5631, 5401, 5165, 4924, 4679, 4433, 4187, 3942,
+  3701, 3463, 3231, 3005, 2786, 2575, 2373, 2180, 1996, 1822, 1659, 1505,
+  1361, 1228, 1104, 989, 884, 787, 699, 619, 546, 480, 421, 368,
+  321, 279, 242, 209, 180, 154, 132, 113, 96, 81, 7098, 7087,
+  7054, 7000, 6925, 6829, 6714, 6581, 6430, 6264, 6083, 5889, 5683, 5468,
+  5245, 5016, 4781, 4544, 4305, 4066, 3829, 3594, 3363, 3137, 2918, 2705,
+  2501, 2304, 2117, 1939, 1770, 1611, 1462, 1322, 1192, 1072, 961, 858,
+  764, 679, 601, 530, 467, 409, 358, 312, 271, 235, 203, 175,
+  150, 128, 109, 93, 79, 6871, 6861, 6829, 6777, 6704, 6611, 6500,
+  6371, 6225, 6064, 5889, 5701, 5502, 5294, 5078, 4856, 4629, 4399, 4168,
+  3936, 3706, 3479, 3256, 3037, 2825, 2619, 2421, 2231, 2049, 1877, 1713,
+  1559, 1415, 1280, 1154, 1038, 930, 831, 740, 657, 582, 513, 452,
+  396, 346, 302, 262, 227, 196, 169, 145, 124, 106, 90, 76,
+  6632, 6621, 6591, 6540, 6470, 6381, 6273, 6149, 6008, 5852, 5683, 5502,
+  5310, 5109, 4901, 4686, 4467, 4246, 4022, 3799, 3577, 3358, 3142, 2931,
+  2726, 2528, 2336, 2153, 1978, 1811, 1654, 1505, 1366, 1235, 1114, 1001,
+  898, 802, 714, 634, 561, 495, 436, 382, 334, 291, 253, 219,
+  189, 163, 140, 120, 102, 87, 74, 6381, 6371, 6341, 6293, 6225,
+  6139, 6036, 5916, 5781, 5631, 5468, 5294, 5109, 4916, 4715, 4509, 4298,
+  4085, 3870, 3655, 3442, 3231, 3023, 2821, 2623, 2432, 2248, 2072, 1903,
+  1743, 1591, 1448, 1314, 1189, 1072, 964, 864, 772, 687, 610, 540,
+  477, 419, 368, 322, 280, 244, 211, 182, 157, 135, 115, 98,
+  84, 71, 6120, 6111, 6083, 6036, 5971, 5889, 5790, 5675, 5545, 5401,
+  5245, 5078, 4901, 4715, 4523, 4325, 4123, 3918, 3712, 3506, 3301, 3099,
+  2900, 2705, 2516, 2333, 2156, 1987, 1825, 1672, 1526, 1389, 1260, 1140,
+  1028, 924, 828, 740, 659, 585, 518, 457, 402, 353, 308, 269,
+  234, 202, 175, 151, 129, 111, 94, 80, 68, 5852, 5843, 5816,
+  5772, 5710, 5631, 5536, 5426, 5302, 5165, 5016, 4856, 4686, 4509, 4325,
+  4136, 3942, 3747, 3550, 3353, 3157, 2963, 2773, 2587, 2406, 2231, 2062,
+  1900, 1745, 1598, 1459, 1328, 1205, 1090, 983, 884, 792, 708, 630,
+  560, 495, 437, 385, 337, 295, 257, 223, 194, 167, 144, 124,
+  106, 90, 77, 65, 5579, 5570, 5545, 5502, 5443, 5368, 5278, 5173,
+  5054, 4924, 4781, 4629, 4467, 4298, 4123, 3942, 3758, 3572, 3384, 3196,
+  3009, 2825, 2644, 2466, 2294, 2127, 1966, 1811, 1664, 1524, 1391, 1266,
+  1149, 1039, 937, 842, 755, 675, 601, 534, 472, 417, 367, 322,
+  281, 245, 213, 185, 159, 137, 118, 101, 86, 73, 62, 5302,
+  5294, 5269, 5229, 5173, 5101, 5016, 4916, 4803, 4679, 4544, 4399, 4246,
+  4085, 3918, 3747, 3572, 3394, 3216, 3037, 2860, 2685, 2512, 2344, 2180,
+  2021, 1868, 1721, 1581, 1448, 1322, 1203, 1092, 988, 891, 801, 718,
+  641, 571, 507, 449, 396, 348, 306, 267, 233, 202, 175, 151,
+  130, 112, 96, 82, 69, 59, 5023, 5016, 4992, 4954, 4901, 4833,
+  4752, 4657, 4551, 4433, 4305, 4168, 4022, 3870, 3712, 3550, 3384, 3216,
+  3047, 2878, 2710, 2543, 2380, 2220, 2065, 1915, 1770, 1631, 1498, 1372,
+  1253, 1140, 1034, 936, 844, 759, 680, 607, 541, 480, 425, 375,
+  330, 290, 253, 221, 192, 166, 143, 124, 106, 91, 77, 66,
+  56, 4744, 4737, 4715, 4679, 4629, 4565, 4488, 4399, 4298, 4187, 4066,
+  3936, 3799, 3655, 3506, 3353, 3196, 3037, 2878, 2718, 2559, 2402, 2248,
+  2097, 1951, 1808, 1672, 1540, 1415, 1296, 1183, 1077, 977, 884, 797,
+  716, 642, 574, 511, 454, 402, 354, 312, 274, 239, 208, 181,
+  157, 136, 117, 100, 86, 73, 62, 53, 4467, 4460, 4440, 4406,
+  4358, 4298, 4226, 4142, 4047, 3942, 3829, 3706, 3577, 3442, 3301, 3157,
+  3009, 2860, 2710, 2559, 2410, 2262, 2117, 1975, 1837, 1703, 1574, 1450,
+  1332, 1220, 1114, 1014, 920, 832, 750, 675, 605, 540, 481, 427,
+  378, 334, 294, 258, 225, 196, 171, 148, 128, 110, 94, 81,
+  69, 59, 50, 4193, 4187, 4168, 4136, 4091, 4035, 3967, 3888, 3799,
+  3701, 3594, 3479, 3358, 3231, 3099, 2963, 2825, 2685, 2543, 2402, 2262,
+  2123, 1987, 1854, 1724, 1598, 1477, 1361, 1251, 1145, 1046, 952, 864,
+  781, 704, 633, 568, 507, 452, 401, 355, 313, 276, 242, 211,
+  184, 160, 139, 120, 103, 89, 76, 65, 55, 47, 3924, 3918,
+  3900, 3870, 3829, 3776, 3712, 3638, 3555, 3463, 3363, 3256, 3142, 3023,
+  2900, 2773, 2644, 2512, 2380, 2248, 2117, 1987, 1859, 1735, 1613, 1496,
+  1383, 1274, 1170, 1072, 979, 891, 808, 731, 659, 593, 531, 475,
+  423, 375, 332, 293, 258, 226, 198, 172, 150, 130, 112, 97,
+  83, 71, 60, 51, 44, 3661, 3655, 3638, 3610, 3572, 3522, 3463,
+  3394, 3317, 3231, 3137, 3037, 2931, 2821, 2705, 2587, 2466, 2344, 2220,
+  2097, 1975, 1854, 1735, 1618, 1505, 1395, 1290, 1189, 1092, 1000, 913,
+  831, 754, 682, 615, 553, 495, 443, 394, 350, 310, 274, 241,
+  211, 185, 161, 140, 121, 105, 90, 77, 66, 56, 48, 41,
+  3405, 3400, 3384, 3358, 3322, 3276, 3221, 3157, 3085, 3005, 2918, 2825,
+  2726, 2623, 2516, 2406, 2294, 2180, 2065, 1951, 1837, 1724, 1613, 1505,
+  1400, 1298, 1200, 1105, 1015, 930, 849, 773, 701, 634, 572, 514,
+  461, 412, 367, 326, 288, 254, 224, 196, 172, 150, 130, 113,
+  97, 84, 72, 62, 52, 45, 38, 3157, 3152, 3137, 3113, 3080,
+  3037, 2986, 2927, 2860, 2786, 2705, 2619, 2528, 2432, 2333, 2231, 2127,
+  2021, 1915, 1808, 1703, 1598, 1496, 1395, 1298, 1203, 1112, 1025, 941,
+  862, 787, 716, 650, 588, 530, 477, 427, 382, 340, 302, 267,
+  236, 207, 182, 159, 139, 121, 104, 90, 78, 67, 57, 49,
+  41, 35, 2918, 2913, 2900, 2878, 2847, 2807, 2760, 2705, 2644, 2575,
+  2501, 2421, 2336, 2248, 2156, 2062, 1966, 1868, 1770, 1672, 1574, 1477,
+  1383, 1290, 1200, 1112, 1028, 947, 870, 797, 728, 662, 601, 544,
+  490, 441, 395, 353, 314, 279, 247, 218, 192, 168, 147, 128,
+  111, 97, 83, 72, 62, 53, 45, 38, 32, 2689, 2685, 2672,
+  2652, 2623, 2587, 2543, 2493, 2436, 2373, 2304, 2231, 2153, 2072, 1987,
+  1900, 1811, 1721, 1631, 1540, 1450, 1361, 1274, 1189, 1105, 1025, 947,
+  873, 802, 734, 670, 610, 554, 501, 452, 406, 364, 325, 290,
+  257, 228, 201, 177, 155, 136, 118, 103, 89, 77, 66, 57,
+  49, 41, 35, 30, 2470, 2466, 2455, 2436, 2410, 2376, 2336, 2290,
+  2238, 2180, 2117, 2049, 1978, 1903, 1825, 1745, 1664, 1581, 1498, 1415,
+  1332, 1251, 1170, 1092, 1015, 941, 870, 802, 737, 675, 616, 561,
+  509, 460, 415, 373, 334, 299, 266, 236, 209, 185, 162, 142,
+  125, 109, 94, 82, 71, 61, 52, 45, 38, 32, 27, 2262,
+  2258, 2248, 2231, 2207, 2176, 2140, 2097, 2049, 1996, 1939, 1877, 1811,
+  1743, 1672, 1598, 1524, 1448, 1372, 1296, 1220, 1145, 1072, 1000, 930,
+  862, 797, 734, 675, 618, 564, 513, 466, 421, 380, 342, 306,
+  274, 244, 216, 191, 169, 149, 130, 114, 99, 86, 75, 65,
+  56, 48, 41, 35, 30, 25, 2065, 2062, 2052, 2037, 2015, 1987,
+  1954, 1915, 1871, 1822, 1770, 1713, 1654, 1591, 1526, 1459, 1391, 1322,
+  1253, 1183, 1114, 1046, 979, 913, 849, 787, 728, 670, 616, 564,
+  515, 469, 425, 385, 347, 312, 279, 250, 222, 197, 175, 154,
+  136, 119, 104, 91, 79, 68, 59, 51, 44, 37, 32, 27,
+  23, 1880, 1877, 1868, 1854, 1834, 1808, 1778, 1743, 1703, 1659, 1611,
+  1559, 1505, 1448, 1389, 1328, 1266, 1203, 1140, 1077, 1014, 952, 891,
+  831, 773, 716, 662, 610, 561, 513, 469, 427, 387, 350, 316,
+  284, 254, 227, 202, 180, 159, 140, 124, 108, 95, 83, 72,
+  62, 54, 46, 40, 34, 29, 25, 21, 1705, 1703, 1695, 1682,
+  1664, 1641, 1613, 1581, 1545, 1505, 1462, 1415, 1366, 1314, 1260, 1205,
+  1149, 1092, 1034, 977, 920, 864, 808, 754, 701, 650, 601, 554,
+  509, 466, 425, 387, 351, 318, 286, 258, 231, 206, 184, 163,
+  144, 127, 112, 98, 86, 75, 65, 56, 49, 42, 36, 31,
+  26, 22, 19, 1543, 1540, 1533, 1521, 1505, 1484, 1459, 1430, 1398,
+  1361, 1322, 1280, 1235, 1189, 1140, 1090, 1039, 988, 936, 884, 832,
+  781, 731, 682, 634, 588, 544, 501, 460, 421, 385, 350, 318,
+  287, 259, 233, 209, 187, 166, 148, 131, 115, 101, 89, 78,
+  68, 59, 51, 44, 38, 33, 28, 24, 20, 17, 1391, 1389,
+  1383, 1372, 1357, 1339, 1316, 1290, 1260, 1228, 1192, 1154, 1114, 1072,
+  1028, 983, 937, 891, 844, 797, 750, 704, 659, 615, 572, 530,
+  490, 452, 415, 380, 347, 316, 286, 259, 234, 210, 188, 168,
+  150, 133, 118, 104, 91, 80, 70, 61, 53, 46, 40, 34,
+  29, 25, 21, 18, 15, 1251, 1249, 1243, 1233, 1220, 1203, 1183,
+  1160, 1133, 1104, 1072, 1038, 1001, 964, 924, 884, 842, 801, 759,
+  716, 675, 633, 593, 553, 514, 477, 441, 406, 373, 342, 312,
+  284, 258, 233, 210, 189, 169, 151, 135, 120, 106, 93, 82,
+  72, 63, 55, 48, 41, 36, 31, 26, 23, 19, 16, 14,
+  1121, 1119, 1114, 1105, 1094, 1078, 1060, 1039, 1015, 989, 961, 930,
+  898, 864, 828, 792, 755, 718, 680, 642, 605, 568, 531, 495,
+  461, 427, 395, 364, 334, 306, 279, 254, 231, 209, 188, 169,
+  152, 136, 121, 107, 95, 84, 74, 65, 56, 49, 43, 37,
+  32, 28, 24, 20, 17, 15, 12, 1001, 1000, 995, 988, 977,
+  964, 947, 928, 907, 884, 858, 831, 802, 772, 740, 708, 675,
+  641, 607, 574, 540, 507, 475, 443, 412, 382, 353, 325, 299,
+  274, 250, 227, 206, 187, 168, 151, 136, 121, 108, 96, 85,
+  75, 66, 58, 50, 44, 38, 33, 29, 25, 21, 18, 15,
+  13, 11, 892, 891, 886, 880, 870, 858, 844, 827, 808, 787,
+  764, 740, 714, 687, 659, 630, 601, 571, 541, 511, 481, 452,
+  423, 394, 367, 340, 314, 290, 266, 244, 222, 202, 184, 166,
+  150, 135, 121, 108, 96, 85, 76, 67, 59, 51, 45, 39,
+  34, 30, 25, 22, 19, 16, 14, 12, 10, 792, 791, 787,
+  781, 773, 762, 749, 734, 718, 699, 679, 657, 634, 610, 585,
+  560, 534, 507, 480, 454, 427, 401, 375, 350, 326, 302, 279,
+  257, 236, 216, 197, 180, 163, 148, 133, 120, 107, 96, 85,
+  76, 67, 59, 52, 46, 40, 35, 30, 26, 23, 19, 17,
+  14, 12, 10, 9, 701, 700, 697, 691, 684, 675, 663, 650,
+  635, 619, 601, 582, 561, 540, 518, 495, 472, 449, 425, 402,
+  378, 355, 332, 310, 288, 267, 247, 228, 209, 191, 175, 159,
+  144, 131, 118, 106, 95, 85, 76, 67, 59, 52, 46, 40,
+  35, 31, 27, 23, 20, 17, 15, 13, 11, 9, 8, 619,
+  618, 615, 610, 604, 595, 585, 574, 561, 546, 530, 513, 495,
+  477, 457, 437, 417, 396, 375, 354, 334, 313, 293, 274, 254,
+  236, 218, 201, 185, 169, 154, 140, 127, 115, 104, 93, 84,
+  75, 67, 59, 52, 46, 41, 36, 31, 27, 24, 20, 18,
+  15, 13, 11, 10, 8, 7, 544, 544, 541, 537, 531, 524,
+  515, 505, 493, 480, 467, 452, 436, 419, 402, 385, 367, 348,
+  330, 312, 294, 276, 258, 241, 224, 207, 192, 177, 162, 149,
+  136, 124, 112, 101, 91, 82, 74, 66, 59, 52, 46, 41,
+  36, 31, 27, 24, 21, 18, 16, 13, 11, 10, 8, 7,
+  6, 477, 477, 475, 471, 466, 459, 452, 443, 433, 421, 409,
+  396, 382, 368, 353, 337, 322, 306, 290, 274, 258, 242, 226,
+  211, 196, 182, 168, 155, 142, 130, 119, 108, 98, 89, 80,
+  72, 65, 58, 51, 46, 40, 36, 31, 28, 24, 21, 18,
+  16, 14, 12, 10, 9, 7, 6, 5, 417, 417, 415, 412,
+  407, 402, 395, 387, 378, 368, 358, 346, 334, 322, 308, 295,
+  281, 267, 253, 239, 225, 211, 198, 185, 172, 159, 147, 136,
+  125, 114, 104, 95, 86, 78, 70, 63, 56, 50, 45, 40,
+  35, 31, 27, 24, 21, 18, 16, 14, 12, 10, 9, 8,
+  6, 5, 5, 364, 363, 362, 359, 355, 350, 344, 337, 330,
+  321, 312, 302, 291, 280, 269, 257, 245, 233, 221, 208, 196,
+  184, 172, 161, 150, 139, 128, 118, 109, 99, 91, 83, 75,
+  68, 61, 55, 49, 44, 39, 35, 31, 27, 24, 21, 18,
+  16, 14, 12, 10, 9, 8, 7, 6, 5, 4, 316, 316,
+  314, 312, 308, 304, 299, 293, 286, 279, 271, 262, 253, 244,
+  234, 223, 213, 202, 192, 181, 171, 160, 150, 140, 130, 121,
+  111, 103, 94, 86, 79, 72, 65, 59, 53, 48, 43, 38,
+  34, 30, 27, 24, 21, 18, 16, 14, 12, 10, 9, 8,
+  7, 6, 5, 4, 4, 274, 274, 272, 270, 267, 264, 259,
+  254, 248, 242, 235, 227, 219, 211, 202, 194, 185, 175, 166,
+  157, 148, 139, 130, 121, 113, 104, 97, 89, 82, 75, 68,
+  62, 56, 51, 46, 41, 37, 33, 30, 26, 23, 20, 18,
+  16, 14, 12, 10, 9, 8, 7, 6, 5, 4, 4, 3,
+  237, 236, 235, 233, 231, 228, 224, 219, 214, 209, 203, 196,
+  189, 182, 175, 167, 159, 151, 143, 136, 128, 120, 112, 105,
+  97, 90, 83, 77, 71, 65, 59, 54, 49, 44, 40, 36,
+  32, 29, 25, 23, 20, 18, 16, 14, 12, 10, 9, 8,
+  7, 6, 5, 4, 4, 3, 3, 204, 203, 202, 201, 199,
+  196, 193, 189, 185, 180, 175, 169, 163, 157, 151, 144, 137,
+  130, 124, 117, 110, 103, 97, 90, 84, 78, 72, 66, 61,
+  56, 51, 46, 42, 38, 34, 31, 28, 25, 22, 19, 17,
+  15, 13, 12, 10, 9, 8, 7, 6, 5, 4, 4, 3,
+  3, 2, 175, 175, 174, 172, 171, 168, 165, 162, 158, 154,
+  150, 145, 140, 135, 129, 124, 118, 112, 106, 100, 94, 89,
+  83, 77, 72, 67, 62, 57, 52, 48, 44, 40, 36, 33,
+  29, 26, 24, 21, 19, 17, 15, 13, 11, 10, 9, 8,
+  7, 6, 5, 4, 4, 3, 3, 2, 2, 150, 149, 149,
+  148, 146, 144, 142, 139, 136, 132, 128, 124, 120, 115, 111,
+  106, 101, 96, 91, 86, 81, 76, 71, 66, 62, 57, 53,
+  49, 45, 41, 37, 34, 31, 28, 25, 23, 20, 18, 16,
+  14, 13, 11, 10, 9, 8, 7, 6, 5, 4, 4, 3,
+  3, 2, 2, 2, 128, 127, 127, 126, 125, 123, 121, 118,
+  116, 113, 109, 106, 102, 98, 94, 90, 86, 82, 77, 73,
+  69, 65, 60, 56, 52, 49, 45, 41, 38, 35, 32, 29,
+  26, 24, 21, 19, 17, 15, 14, 12, 11, 10, 8, 7,
+  6, 6, 5, 4, 4, 3, 3, 2, 2, 2, 1, 109,
+  108, 108, 107, 106, 104, 103, 101, 98, 96, 93, 90, 87,
+  84, 80, 77, 73, 69, 66, 62, 59, 55, 51, 48, 45,
+  41, 38, 35, 32, 30, 27, 25, 22, 20, 18, 16, 15,
+  13, 12, 10, 9, 8, 7, 6, 5, 5, 4, 4, 3,
+  3, 2, 2, 2, 1, 1, 92, 92, 91, 91, 90, 89,
+  87, 85, 83, 81, 79, 76, 74, 71, 68, 65, 62, 59,
+  56, 53, 50, 47, 44, 41, 38, 35, 32, 30, 27, 25,
+  23, 21, 19, 17, 15, 14, 12, 11, 10, 9, 8, 7,
+  6, 5, 5, 4, 4, 3, 3, 2, 2, 2, 1, 1,
+  1
+};
+static const int kern_row_fixed_18[] = {
+  4141, 4884, 5744, 6733, 7869, 9168, 10648, 12329, 14232, 16378, 18789, 21489,
+  24501, 27849, 31557, 35649, 40146, 45073, 50447, 56289, 62613, 69434, 76760, 84598,
+  92948, 101808, 111169, 121017, 131331, 142085, 153246, 164774, 176623, 188741, 201069, 213542,
+  226089, 238637, 251104, 263409, 275465, 287185, 298482, 309266, 319453, 328958, 337702, 345611,
+  352614, 358651, 363667, 367617, 370464, 372184, 372758, 372184, 370464, 367617, 363667, 358651,
+  352614, 345611, 337702, 328958, 319453, 309266, 298482, 287185, 275465, 263409, 251104, 238637,
+  226089, 213542, 201069, 188741, 176623, 164774, 153246, 142085, 131331, 121017, 111169, 101808,
+  92948, 84598, 76760, 69434, 62613, 56289, 50447, 45073, 40146, 35649, 31557, 27849,
+  24501, 21489, 18789, 16378, 14232, 12329, 10648, 9168, 7869, 6733, 5744, 4884,
+  4141
+};
+
+static const float kern_half_19[] = {
+  2.09969617e-02f, 2.09679008e-02f, 2.08809562e-02f, 2.07368508e-02f, 2.05367729e-02f, 2.02823635e-02f,
+  1.99756939e-02f, 1.96192395e-02f, 1.92158427e-02f, 1.87686775e-02f, 1.82812065e-02f, 1.77571401e-02f,
+  1.72003862e-02f, 1.66149978e-02f, 1.60051361e-02f, 1.53750097e-02f, 1.47288349e-02f, 1.40707865e-02f,
+  1.34049533e-02f, 1.27353016e-02f, 1.20656332e-02f, 1.13995560e-02f, 1.07404571e-02f, 1.00914724e-02f,
+  9.45547409e-03f, 8.83505028e-03f, 8.23249947e-03f, 7.64982263e-03f, 7.08872266e-03f, 6.55060774e-03f,
+  6.03659637e-03f, 5.54753048e-03f, 5.08398423e-03f, 4.64628264e-03f, 4.23451886e-03f, 3.84857086e-03f,
+  3.48812342e-03f, 3.15268943e-03f, 2.84162979e-03f, 2.55417568e-03f, 2.28944933e-03f, 2.04648334e-03f,
+  1.82424183e-03f, 1.62163668e-03f, 1.43754575e-03f, 1.27082795e-03f, 1.12033740e-03f, 9.84935556e-04f,
+  8.63502966e-04f, 7.54947541e-04f, 6.58213394e-04f, 5.72286604e-04f, 4.96200810e-04f, 4.29040490e-04f,
+  3.69944086e-04f, 3.18105274e-04f, 2.72773759e-04f, 2.33255181e-04f, 2.09679008e-02f, 2.09388789e-02f,
+  2.08520554e-02f, 2.07081493e-02f, 2.05083489e-02f, 2.02542916e-02f, 1.99480467e-02f, 1.95920859e-02f,
+  1.91892460e-02f, 1.87427010e-02f, 1.82559043e-02f, 1.77325644e-02f, 1.71765778e-02f, 1.65920015e-02f,
+  1.59829836e-02f, 1.53537290e-02f, 1.47084491e-02f, 1.40513116e-02f, 1.33863995e-02f, 1.27176745e-02f,
+  1.20489327e-02f, 1.13837784e-02f, 1.07255913e-02f, 1.00775054e-02f, 9.44238715e-03f, 8.82282201e-03f,
+  8.22110474e-03f, 7.63923489e-03f, 7.07891164e-03f, 6.54154131e-03f, 6.02824148e-03f, 5.53985219e-03f,
+  5.07694762e-03f, 4.63985186e-03f, 4.22865804e-03f, 3.84324417e-03f, 3.48329567e-03f, 3.14832595e-03f,
+  2.83769681e-03f, 2.55064061e-03f, 2.28628051e-03f, 2.04365095e-03f, 1.82171690e-03f, 1.61939219e-03f,
+  1.43555610e-03f, 1.26906903e-03f, 1.11878675e-03f, 9.83572332e-04f, 8.62307788e-04f, 7.53902656e-04f,
+  6.57302386e-04f, 5.71494515e-04f, 4.95514018e-04f, 4.28446685e-04f, 3.69432062e-04f, 3.17664992e-04f,
+  2.72396224e-04f, 2.32932332e-04f, 2.08809562e-02f, 2.08520554e-02f, 2.07655933e-02f, 2.06222832e-02f,
+  2.04233117e-02f, 2.01703068e-02f, 1.98653322e-02f, 1.95108466e-02f, 1.91096794e-02f, 1.86649840e-02f,
+  1.81802064e-02f, 1.76590346e-02f, 1.71053559e-02f, 1.65232029e-02f, 1.59167089e-02f, 1.52900647e-02f,
+  1.46474605e-02f, 1.39930472e-02f, 1.33308936e-02f, 1.26649411e-02f, 1.19989719e-02f, 1.13365753e-02f,
+  1.06811179e-02f, 1.00357188e-02f, 9.40323435e-03f, 8.78623780e-03f, 8.18701647e-03f, 7.60755874e-03f,
+  7.04955868e-03f, 6.51441654e-03f, 6.00324525e-03f, 5.51688112e-03f, 5.05589601e-03f, 4.62061306e-03f,
+  4.21112403e-03f, 3.82730807e-03f, 3.46885226e-03f, 3.13527137e-03f, 2.82593025e-03f, 2.54006428e-03f,
+  2.27680034e-03f, 2.03517685e-03f, 1.81416317e-03f, 1.61267736e-03f, 1.42960355e-03f, 1.26380683e-03f,
+  1.11414760e-03f, 9.79493954e-04f, 8.58732208e-04f, 7.50776555e-04f, 6.54576870e-04f, 5.69124823e-04f,
+  4.93459345e-04f, 4.26670129e-04f, 3.67900211e-04f, 3.16347781e-04f, 2.71266734e-04f, 2.31966478e-04f,
+  2.07368508e-02f, 2.07081493e-02f, 2.06222832e-02f, 2.04799641e-02f, 2.02823635e-02f, 2.00311057e-02f,
+  1.97282359e-02f, 1.93761978e-02f, 1.89777967e-02f, 1.85361709e-02f, 1.80547405e-02f, 1.75371654e-02f,
+  1.69873070e-02f, 1.64091699e-02f, 1.58068631e-02f, 1.51845440e-02f, 1.45463739e-02f, 1.38964774e-02f,
+  1.32388929e-02f, 1.25775365e-02f, 1.19161634e-02f, 1.12583386e-02f, 1.06074046e-02f, 9.96645913e-03f,
+  9.33833979e-03f, 8.72560125e-03f, 8.13051499e-03f, 7.55505683e-03f, 7.00090779e-03f, 6.46945881e-03f,
+  5.96181536e-03f, 5.47880726e-03f, 5.02100354e-03f, 4.58872458e-03f, 4.18206165e-03f, 3.80089483e-03f,
+  3.44491261e-03f, 3.11363395e-03f, 2.80642766e-03f, 2.52253469e-03f, 2.26108753e-03f, 2.02113157e-03f,
+  1.80164317e-03f, 1.60154782e-03f, 1.41973747e-03f, 1.25508499e-03f, 1.10645860e-03f, 9.72734240e-04f,
+  8.52805853e-04f, 7.45595258e-04f, 6.50059432e-04f, 5.65197144e-04f, 4.90053848e-04f, 4.23725549e-04f,
+  3.65361222e-04f, 3.14164587e-04f, 2.69394630e-04f, 2.30365607e-04f, 2.05367729e-02f, 2.05083489e-02f,
+  2.04233117e-02f, 2.02823635e-02f, 2.00866703e-02f, 1.98378377e-02f, 1.95378885e-02f, 1.91892460e-02f,
+  1.87946912e-02f, 1.83573253e-02f, 1.78805403e-02f, 1.73679590e-02f, 1.68234054e-02f, 1.62508469e-02f,
+  1.56543516e-02f, 1.50380367e-02f, 1.44060245e-02f, 1.37623977e-02f, 1.31111583e-02f, 1.24561824e-02f,
+  1.18011916e-02f, 1.11497128e-02f, 1.05050597e-02f, 9.87029914e-03f, 9.24823899e-03f, 8.64141341e-03f,
+  8.05206876e-03f, 7.48216221e-03f, 6.93335989e-03f, 6.40703831e-03f, 5.90429315e-03f, 5.42594539e-03f,
+  4.97255893e-03f, 4.54445044e-03f, 4.14171116e-03f, 3.76422191e-03f, 3.41167464e-03f, 3.08359228e-03f,
+  2.77935015e-03f, 2.49819597e-03f, 2.23927153e-03f, 2.00163084e-03f, 1.78426004e-03f, 1.58609543e-03f,
+  1.40603923e-03f, 1.24297536e-03f, 1.09578297e-03f, 9.63348837e-04f, 8.44577618e-04f, 7.38401432e-04f,
+  6.43787382e-04f, 5.59743843e-04f, 4.85325610e-04f, 4.19637247e-04f, 3.61836050e-04f, 3.11133364e-04f,
+  2.66795396e-04f, 2.28142948e-04f, 2.02823635e-02f, 2.02542916e-02f, 2.01703068e-02f, 2.00311057e-02f,
+  1.98378377e-02f, 1.95920859e-02f, 1.92958545e-02f, 1.89515296e-02f, 1.85618624e-02f, 1.81299150e-02f,
+  1.76590346e-02f, 1.71528049e-02f, 1.66149978e-02f, 1.60495322e-02f, 1.54604260e-02f, 1.48517452e-02f,
+  1.42275626e-02f, 1.35919098e-02f, 1.29487375e-02f, 1.23018753e-02f, 1.16549982e-02f, 1.10115902e-02f,
+  1.03749223e-02f, 9.74802580e-03f, 9.13367234e-03f, 8.53436347e-03f, 7.95231946e-03f, 7.38947326e-03f,
+  6.84746960e-03f, 6.32766820e-03f, 5.83115034e-03f, 5.35872905e-03f, 4.91095893e-03f, 4.48815385e-03f,
+  4.09040367e-03f, 3.71759082e-03f, 3.36941076e-03f, 3.04539269e-03f, 2.74491939e-03f, 2.46724836e-03f,
+  2.21153139e-03f, 1.97683461e-03f, 1.76215661e-03f, 1.56644685e-03f, 1.38862117e-03f, 1.22757733e-03f,
+  1.08220847e-03f, 9.51414870e-04f, 8.34114966e-04f, 7.29254098e-04f, 6.35812117e-04f, 5.52809739e-04f,
+  4.79313399e-04f, 4.14438779e-04f, 3.57353623e-04f, 3.07279057e-04f, 2.63490336e-04f, 2.25316704e-04f,
+  1.99756939e-02f, 1.99480467e-02f, 1.98653322e-02f, 1.97282359e-02f, 1.95378885e-02f, 1.92958545e-02f,
+  1.90041009e-02f, 1.86649840e-02f, 1.82812065e-02f, 1.78557914e-02f, 1.73920318e-02f, 1.68934539e-02f,
+  1.63637791e-02f, 1.58068631e-02f, 1.52266640e-02f, 1.46271866e-02f, 1.40124420e-02f, 1.33863995e-02f,
+  1.27529521e-02f, 1.21158715e-02f, 1.14787742e-02f, 1.08450959e-02f, 1.02180541e-02f, 9.60063562e-03f,
+  8.99557117e-03f, 8.40532407e-03f, 7.83208013e-03f, 7.27774436e-03f, 6.74393587e-03f, 6.23199390e-03f,
+  5.74298343e-03f, 5.27770491e-03f, 4.83670505e-03f, 4.42029303e-03f, 4.02855687e-03f, 3.66138085e-03f,
+  3.31846531e-03f, 2.99934647e-03f, 2.70341639e-03f, 2.42994376e-03f, 2.17809319e-03f, 1.94694486e-03f,
+  1.73551287e-03f, 1.54276215e-03f, 1.36762520e-03f, 1.20901642e-03f, 1.06584548e-03f, 9.37029487e-04f,
+  8.21503170e-04f, 7.18227820e-04f, 6.26198656e-04f, 5.44451294e-04f, 4.72066196e-04f, 4.08172491e-04f,
+  3.51950439e-04f, 3.02633009e-04f, 2.59506371e-04f, 2.21909926e-04f, 1.96192395e-02f, 1.95920859e-02f,
+  1.95108466e-02f, 1.93761978e-02f, 1.91892460e-02f, 1.89515296e-02f, 1.86649840e-02f, 1.83319189e-02f,
+  1.79549903e-02f, 1.75371654e-02f, 1.70816798e-02f, 1.65920015e-02f, 1.60717778e-02f, 1.55247990e-02f,
+  1.49549535e-02f, 1.43661732e-02f, 1.37623977e-02f, 1.31475274e-02f, 1.25253834e-02f, 1.18996706e-02f,
+  1.12739429e-02f, 1.06515707e-02f, 1.00357188e-02f, 9.42931790e-03f, 8.83505028e-03f, 8.25533550e-03f,
+  7.69232167e-03f, 7.14787748e-03f, 6.62359409e-03f, 6.12078747e-03f, 5.64050348e-03f, 5.18352725e-03f,
+  4.75039706e-03f, 4.34141560e-03f, 3.95666994e-03f, 3.59604578e-03f, 3.25924926e-03f, 2.94582476e-03f,
+  2.65517551e-03f, 2.38658278e-03f, 2.13922630e-03f, 1.91220280e-03f, 1.70454371e-03f, 1.51523249e-03f,
+  1.34322082e-03f, 1.18744222e-03f, 1.04682613e-03f, 9.20308754e-04f, 8.06843920e-04f, 7.05411425e-04f,
+  6.15024532e-04f, 5.34735853e-04f, 4.63642442e-04f, 4.00888879e-04f, 3.45670094e-04f, 2.97232706e-04f,
+  2.54875631e-04f, 2.17950073e-04f, 1.92158427e-02f, 1.91892460e-02f, 1.91096794e-02f, 1.89777967e-02f,
+  1.87946912e-02f, 1.85618624e-02f, 1.82812065e-02f, 1.79549903e-02f, 1.75858121e-02f, 1.71765778e-02f,
+  1.67304594e-02f, 1.62508469e-02f, 1.57413203e-02f, 1.52055891e-02f, 1.46474605e-02f, 1.40707865e-02f,
+  1.34794256e-02f, 1.28771970e-02f, 1.22678457e-02f, 1.16549982e-02f, 1.10421358e-02f, 1.04325609e-02f,
+  9.82937124e-03f, 9.23543889e-03f, 8.65339022e-03f, 8.08559544e-03f, 7.53415748e-03f, 7.00090779e-03f,
+  6.48740446e-03f, 5.99493645e-03f, 5.52452728e-03f, 5.07694762e-03f, 4.65272274e-03f, 4.25215065e-03f,
+  3.87531542e-03f, 3.52210645e-03f, 3.19223478e-03f, 2.88525480e-03f, 2.60058162e-03f, 2.33751163e-03f,
+  2.09524110e-03f, 1.87288539e-03f, 1.66949607e-03f, 1.48407742e-03f, 1.31560245e-03f, 1.16302690e-03f,
+  1.02530199e-03f, 9.01386025e-04f, 7.90254213e-04f, 6.90907298e-04f, 6.02378801e-04f, 5.23741008e-04f,
+  4.54109366e-04f, 3.92646092e-04f, 3.38562677e-04f, 2.91121192e-04f, 2.49635050e-04f, 2.13468738e-04f,
+  1.87686775e-02f, 1.87427010e-02f, 1.86649840e-02f, 1.85361709e-02f, 1.83573253e-02f, 1.81299150e-02f,
+  1.78557914e-02f, 1.75371654e-02f, 1.71765778e-02f, 1.67768672e-02f, 1.63411293e-02f, 1.58726797e-02f,
+  1.53750097e-02f, 1.48517452e-02f, 1.43066039e-02f, 1.37433494e-02f, 1.31657496e-02f, 1.25775365e-02f,
+  1.19823646e-02f, 1.13837784e-02f, 1.07851783e-02f, 1.01897884e-02f, 9.60063562e-03f, 9.02052410e-03f,
+  8.45201965e-03f, 7.89743848e-03f, 7.35883275e-03f, 6.83799200e-03f, 6.33643847e-03f, 5.85542992e-03f,
+  5.39596798e-03f, 4.95880330e-03f, 4.54445044e-03f, 4.15319996e-03f, 3.78513429e-03f, 3.44014447e-03f,
+  3.11794947e-03f, 2.81811296e-03f, 2.54006428e-03f, 2.28311610e-03f, 2.04648334e-03f, 1.82930217e-03f,
+  1.63064571e-03f, 1.44954189e-03f, 1.28498743e-03f, 1.13596243e-03f, 1.00144255e-03f, 8.80410138e-04f,
+  7.71864434e-04f, 6.74829411e-04f, 5.88361057e-04f, 5.11553197e-04f, 4.43541910e-04f, 3.83508945e-04f,
+  3.30684095e-04f, 2.84346606e-04f, 2.43825882e-04f, 2.08501180e-04f, 1.82812065e-02f, 1.82559043e-02f,
+  1.81802064e-02f, 1.80547405e-02f, 1.78805403e-02f, 1.76590346e-02f, 1.73920318e-02f, 1.70816798e-02f,
+  1.67304594e-02f, 1.63411293e-02f, 1.59167089e-02f, 1.54604260e-02f, 1.49756810e-02f, 1.44660072e-02f,
+  1.39350249e-02f, 1.33863995e-02f, 1.28238024e-02f, 1.22508658e-02f, 1.16711520e-02f, 1.10881124e-02f,
+  1.05050597e-02f, 9.92513355e-03f, 9.35128238e-03f, 8.78623780e-03f, 8.23249947e-03f, 7.69232167e-03f,
+  7.16770487e-03f, 6.66039204e-03f, 6.17186492e-03f, 5.70334960e-03f, 5.25582116e-03f, 4.83001070e-03f,
+  4.42641973e-03f, 4.04533092e-03f, 3.68682481e-03f, 3.35079525e-03f, 3.03696841e-03f, 2.74491939e-03f,
+  2.47409241e-03f, 2.22381763e-03f, 1.99333113e-03f, 1.78179052e-03f, 1.58829370e-03f, 1.41189364e-03f,
+  1.25161302e-03f, 1.10645860e-03f, 9.75432515e-04f, 8.57543666e-04f, 7.51817133e-04f, 6.57302386e-04f,
+  5.73079800e-04f, 4.98266891e-04f, 4.32022003e-04f, 3.73548246e-04f, 3.22095380e-04f, 2.76961422e-04f,
+  2.37493106e-04f, 2.03085874e-04f, 1.77571401e-02f, 1.77325644e-02f, 1.76590346e-02f, 1.75371654e-02f,
+  1.73679590e-02f, 1.71528049e-02f, 1.68934539e-02f, 1.65920015e-02f, 1.62508469e-02f, 1.58726797e-02f,
+  1.54604260e-02f, 1.50172226e-02f, 1.45463739e-02f, 1.40513116e-02f, 1.35355508e-02f, 1.30026527e-02f,
+  1.24561824e-02f, 1.18996706e-02f, 1.13365753e-02f, 1.07702501e-02f, 1.02039110e-02f, 9.64060985e-03f,
+  9.08320956e-03f, 8.53436347e-03f, 7.99649861e-03f, 7.47180637e-03f, 6.96222857e-03f, 6.46945881e-03f,
+  5.99493645e-03f, 5.53985219e-03f, 5.10515273e-03f, 4.69154911e-03f, 4.29952797e-03f, 3.92936356e-03f,
+  3.58113460e-03f, 3.25473817e-03f, 2.94990768e-03f, 2.66623101e-03f, 2.40316777e-03f, 2.16006767e-03f,
+  1.93618832e-03f, 1.73071201e-03f, 1.54276215e-03f, 1.37141894e-03f, 1.21573312e-03f, 1.07473985e-03f,
+  9.47469845e-04f, 8.32960533e-04f, 7.30264874e-04f, 6.38459518e-04f, 5.56651386e-04f, 4.83983080e-04f,
+  4.19637247e-04f, 3.62839754e-04f, 3.12861899e-04f, 2.69021781e-04f, 2.30684906e-04f, 1.97264017e-04f,
+  1.72003862e-02f, 1.71765778e-02f, 1.71053559e-02f, 1.69873070e-02f, 1.68234054e-02f, 1.66149978e-02f,
+  1.63637791e-02f, 1.60717778e-02f, 1.57413203e-02f, 1.53750097e-02f, 1.49756810e-02f, 1.45463739e-02f,
+  1.40902884e-02f, 1.36107476e-02f, 1.31111583e-02f, 1.25949690e-02f, 1.20656332e-02f, 1.15265697e-02f,
+  1.09811295e-02f, 1.04325609e-02f, 9.88397934e-03f, 9.33833979e-03f, 8.79841577e-03f, 8.26677773e-03f,
+  7.74577726e-03f, 7.23753590e-03f, 6.74393587e-03f, 6.26661582e-03f, 5.80697181e-03f, 5.36615588e-03f,
+  4.94508632e-03f, 4.54445044e-03f, 4.16472089e-03f, 3.80616286e-03f, 3.46885226e-03f, 3.15268943e-03f,
+  2.85741664e-03f, 2.58263433e-03f, 2.32781912e-03f, 2.09234119e-03f, 1.87548122e-03f, 1.67644746e-03f,
+  1.49439054e-03f, 1.32841954e-03f, 1.17761514e-03f, 1.04104250e-03f, 9.17762984e-04f, 8.06843920e-04f,
+  7.07368192e-04f, 6.18441321e-04f, 5.39198169e-04f, 4.68808314e-04f, 4.06479987e-04f, 3.51463328e-04f,
+  3.03052453e-04f, 2.60586879e-04f, 2.23452036e-04f, 1.91079016e-04f, 1.66149978e-02f, 1.65920015e-02f,
+  1.65232029e-02f, 1.64091699e-02f, 1.62508469e-02f, 1.60495322e-02f, 1.58068631e-02f, 1.55247990e-02f,
+  1.52055891e-02f, 1.48517452e-02f, 1.44660072e-02f, 1.40513116e-02f, 1.36107476e-02f, 1.31475274e-02f,
+  1.26649411e-02f, 1.21663194e-02f, 1.16549982e-02f, 1.11342808e-02f, 1.06074046e-02f, 1.00775054e-02f,
+  9.54759307e-03f, 9.02052410e-03f, 8.49897601e-03f, 7.98543077e-03f, 7.48216221e-03f, 6.99121784e-03f,
+  6.51441654e-03f, 6.05334155e-03f, 5.60934050e-03f, 5.18352725e-03f, 4.77678794e-03f, 4.38978756e-03f,
+  4.02298104e-03f, 3.67662613e-03f, 3.35079525e-03f, 3.04539269e-03f, 2.76016886e-03f, 2.49473844e-03f,
+  2.24859547e-03f, 2.02113157e-03f, 1.81165221e-03f, 1.61939219e-03f, 1.44353136e-03f, 1.28320896e-03f,
+  1.13753683e-03f, 1.00561231e-03f, 8.86528345e-04f, 7.79384281e-04f, 6.83294027e-04f, 5.97393664e-04f,
+  5.20847447e-04f, 4.52853157e-04f, 3.92646092e-04f, 3.39501828e-04f, 2.92738550e-04f, 2.51718244e-04f,
+  2.15847191e-04f, 1.84575954e-04f, 1.60051361e-02f, 1.59829836e-02f, 1.59167089e-02f, 1.58068631e-02f,
+  1.56543516e-02f, 1.54604260e-02f, 1.52266640e-02f, 1.49549535e-02f, 1.46474605e-02f, 1.43066039e-02f,
+  1.39350249e-02f, 1.35355508e-02f, 1.31111583e-02f, 1.26649411e-02f, 1.22000678e-02f, 1.17197474e-02f,
+  1.12271952e-02f, 1.07255913e-02f, 1.02180541e-02f, 9.70760547e-03f, 9.19714384e-03f, 8.68942123e-03f,
+  8.18701647e-03f, 7.69232167e-03f, 7.20752543e-03f, 6.73460169e-03f, 6.27530133e-03f, 5.83115034e-03f,
+  5.40344696e-03f, 4.99326317e-03f, 4.60145343e-03f, 4.22865804e-03f, 3.87531542e-03f, 3.54167353e-03f,
+  3.22780269e-03f, 2.93361000e-03f, 2.65885540e-03f, 2.40316777e-03f, 2.16605957e-03f, 1.94694486e-03f,
+  1.74515462e-03f, 1.55995158e-03f, 1.39054575e-03f, 1.23610813e-03f, 1.09578297e-03f, 9.68700740e-04f,
+  8.53987876e-04f, 7.50776555e-04f, 6.58213394e-04f, 5.75465965e-04f, 5.01729432e-04f, 4.36230970e-04f,
+  3.78233817e-04f, 3.27040238e-04f, 2.81993416e-04f, 2.42478782e-04f, 2.07924415e-04f, 1.77800990e-04f,
+  1.53750097e-02f, 1.53537290e-02f, 1.52900647e-02f, 1.51845440e-02f, 1.50380367e-02f, 1.48517452e-02f,
+  1.46271866e-02f, 1.43661732e-02f, 1.40707865e-02f, 1.37433494e-02f, 1.33863995e-02f, 1.30026527e-02f,
+  1.25949690e-02f, 1.21663194e-02f, 1.17197474e-02f, 1.12583386e-02f, 1.07851783e-02f, 1.03033222e-02f,
+  9.81576648e-03f, 9.32541490e-03f, 8.83505028e-03f, 8.34731665e-03f, 7.86469132e-03f, 7.38947326e-03f,
+  6.92376355e-03f, 6.46945881e-03f, 6.02824148e-03f, 5.60157700e-03f, 5.19071193e-03f, 4.79667727e-03f,
+  4.42029303e-03f, 4.06217482e-03f, 3.72274336e-03f, 3.40223708e-03f, 3.10072326e-03f, 2.81811296e-03f,
+  2.55417568e-03f, 2.30855448e-03f, 2.08078115e-03f, 1.87029317e-03f, 1.67644746e-03f, 1.49853586e-03f,
+  1.33579969e-03f, 1.18744222e-03f, 1.05264178e-03f, 9.30562790e-04f, 8.20366142e-04f, 7.21218355e-04f,
+  6.32299343e-04f, 5.52809739e-04f, 4.81976254e-04f, 4.19056450e-04f, 3.63342668e-04f, 3.14164587e-04f,
+  2.70891265e-04f, 2.32932332e-04f, 1.99738381e-04f, 1.70800922e-04f, 1.47288349e-02f, 1.47084491e-02f,
+  1.46474605e-02f, 1.45463739e-02f, 1.44060245e-02f, 1.42275626e-02f, 1.40124420e-02f, 1.37623977e-02f,
+  1.34794256e-02f, 1.31657496e-02f, 1.28238024e-02f, 1.24561824e-02f, 1.20656332e-02f, 1.16549982e-02f,
+  1.12271952e-02f, 1.07851783e-02f, 1.03319027e-02f, 9.87029914e-03f, 9.40323435e-03f, 8.93349014e-03f,
+  8.46373476e-03f, 7.99649861e-03f, 7.53415748e-03f, 7.07891164e-03f, 6.63277460e-03f, 6.19756291e-03f,
+  5.77488914e-03f, 5.36615588e-03f, 4.97255893e-03f, 4.59508458e-03f, 4.23451886e-03f, 3.89145128e-03f,
+  3.56628560e-03f, 3.25924926e-03f, 2.97040725e-03f, 2.69967457e-03f, 2.44683004e-03f, 2.21153139e-03f,
+  1.99333113e-03f, 1.79168931e-03f, 1.60599046e-03f, 1.43555610e-03f, 1.27965922e-03f, 1.13753683e-03f,
+  1.00840174e-03f, 8.91453470e-04f, 7.85888173e-04f, 6.90907298e-04f, 6.05725334e-04f, 5.29576500e-04f,
+  4.61719959e-04f, 4.01444529e-04f, 3.48072237e-04f, 3.00960994e-04f, 2.59506371e-04f, 2.23142750e-04f,
+  1.91343861e-04f, 1.63622579e-04f, 1.40707865e-02f, 1.40513116e-02f, 1.39930472e-02f, 1.38964774e-02f,
+  1.37623977e-02f, 1.35919098e-02f, 1.33863995e-02f, 1.31475274e-02f, 1.28771970e-02f, 1.25775365e-02f,
+  1.22508658e-02f, 1.18996706e-02f, 1.15265697e-02f, 1.11342808e-02f, 1.07255913e-02f, 1.03033222e-02f,
+  9.87029914e-03f, 9.42931790e-03f, 8.98312032e-03f, 8.53436347e-03f, 8.08559544e-03f, 7.63923489e-03f,
+  7.19754957e-03f, 6.76264288e-03f, 6.33643847e-03f, 5.92067093e-03f, 5.51688112e-03f, 5.12640923e-03f,
+  4.75039706e-03f, 4.38978756e-03f, 4.04533092e-03f, 3.71759082e-03f, 3.40695260e-03f, 3.11363395e-03f,
+  2.83769681e-03f, 2.57905968e-03f, 2.33751163e-03f, 2.11272552e-03f, 1.90427387e-03f, 1.71164097e-03f,
+  1.53423869e-03f, 1.37141894e-03f, 1.22248719e-03f, 1.08671456e-03f, 9.63348837e-04f, 8.51625518e-04f,
+  7.50776555e-04f, 6.60039193e-04f, 5.78663021e-04f, 5.05916309e-04f, 4.41091426e-04f, 3.83508945e-04f,
+  3.32521216e-04f, 2.87514791e-04f, 2.47912249e-04f, 2.13173276e-04f, 1.82795076e-04f, 1.56312322e-04f,
+  1.34049533e-02f, 1.33863995e-02f, 1.33308936e-02f, 1.32388929e-02f, 1.31111583e-02f, 1.29487375e-02f,
+  1.27529521e-02f, 1.25253834e-02f, 1.22678457e-02f, 1.19823646e-02f, 1.16711520e-02f, 1.13365753e-02f,
+  1.09811295e-02f, 1.06074046e-02f, 1.02180541e-02f, 9.81576648e-03f, 9.40323435e-03f, 8.98312032e-03f,
+  8.55803676e-03f, 8.13051499e-03f, 7.70298298e-03f, 7.27774436e-03f, 6.85695978e-03f, 6.44263299e-03f,
+  6.03659637e-03f, 5.64050348e-03f, 5.25582116e-03f, 4.88382624e-03f, 4.52560699e-03f, 4.18206165e-03f,
+  3.85390501e-03f, 3.54167353e-03f, 3.24573484e-03f, 2.96629616e-03f, 2.70341639e-03f, 2.45701801e-03f,
+  2.22689984e-03f, 2.01275107e-03f, 1.81416317e-03f, 1.63064571e-03f, 1.46163814e-03f, 1.30652310e-03f,
+  1.16463879e-03f, 1.03529089e-03f, 9.17762984e-04f, 8.11326376e-04f, 7.15249684e-04f, 6.28806010e-04f,
+  5.51280566e-04f, 4.81976254e-04f, 4.20218887e-04f, 3.65361222e-04f, 3.16786231e-04f, 2.73909536e-04f,
+  2.36180989e-04f, 2.03085874e-04f, 1.74145171e-04f, 1.48915584e-04f, 1.27353016e-02f, 1.27176745e-02f,
+  1.26649411e-02f, 1.25775365e-02f, 1.24561824e-02f, 1.23018753e-02f, 1.21158715e-02f, 1.18996706e-02f,
+  1.16549982e-02f, 1.13837784e-02f, 1.10881124e-02f, 1.07702501e-02f, 1.04325609e-02f, 1.00775054e-02f,
+  9.70760547e-03f, 9.32541490e-03f, 8.93349014e-03f, 8.53436347e-03f, 8.13051499e-03f, 7.72435078e-03f,
+  7.31817633e-03f, 6.91418024e-03f, 6.51441654e-03f, 6.12078747e-03f, 5.73503505e-03f, 5.35872905e-03f,
+  4.99326317e-03f, 4.63985186e-03f, 4.29952797e-03f, 3.97314457e-03f, 3.66138085e-03f, 3.36474716e-03f,
+  3.08359228e-03f, 2.81811296e-03f, 2.56836554e-03f, 2.33427621e-03f, 2.11565383e-03f, 1.91220280e-03f,
+  1.72353559e-03f, 1.54918595e-03f, 1.38862117e-03f, 1.24125497e-03f, 1.10645860e-03f, 9.83572332e-04f,
+  8.71915603e-04f, 7.70796149e-04f, 6.79518969e-04f, 5.97393664e-04f, 5.23741008e-04f, 4.57898830e-04f,
+  3.99226585e-04f, 3.47109395e-04f, 3.00960994e-04f, 2.60226225e-04f, 2.24382427e-04f, 1.92940599e-04f,
+  1.65445643e-04f, 1.41476412e-04f, 1.20656332e-02f, 1.20489327e-02f, 1.19989719e-02f, 1.19161634e-02f,
+  1.18011916e-02f, 1.16549982e-02f, 1.14787742e-02f, 1.12739429e-02f, 1.10421358e-02f, 1.07851783e-02f,
+  1.05050597e-02f, 1.02039110e-02f, 9.88397934e-03f, 9.54759307e-03f, 9.19714384e-03f, 8.83505028e-03f,
+  8.46373476e-03f, 8.08559544e-03f, 7.70298298e-03f, 7.31817633e-03f, 6.93335989e-03f, 6.55060774e-03f,
+  6.17186492e-03f, 5.79893449e-03f, 5.43346582e-03f, 5.07694762e-03f, 4.73069958e-03f, 4.39587189e-03f,
+  4.07344289e-03f, 3.76422191e-03f, 3.46885226e-03f, 3.18781659e-03f, 2.92144576e-03f, 2.66992627e-03f,
+  2.43331166e-03f, 2.21153139e-03f, 2.00440502e-03f, 1.81165221e-03f, 1.63290580e-03f, 1.46772410e-03f,
+  1.31560245e-03f, 1.17598521e-03f, 1.04827702e-03f, 9.31852555e-04f, 8.26067058e-04f, 7.30264874e-04f,
+  6.43787382e-04f, 5.65980503e-04f, 4.96200810e-04f, 4.33820853e-04f, 3.78233817e-04f, 3.28857102e-04f,
+  2.85135378e-04f, 2.46542564e-04f, 2.12583589e-04f, 1.82795076e-04f, 1.56745911e-04f, 1.34037080e-04f,
+  1.13995560e-02f, 1.13837784e-02f, 1.13365753e-02f, 1.12583386e-02f, 1.11497128e-02f, 1.10115902e-02f,
+  1.08450959e-02f, 1.06515707e-02f, 1.04325609e-02f, 1.01897884e-02f, 9.92513355e-03f, 9.64060985e-03f,
+  9.33833979e-03f, 9.02052410e-03f, 8.68942123e-03f, 8.34731665e-03f, 7.99649861e-03f, 7.63923489e-03f,
+  7.27774436e-03f, 6.91418024e-03f, 6.55060774e-03f, 6.18898496e-03f, 5.83115034e-03f, 5.47880726e-03f,
+  5.13351429e-03f, 4.79667727e-03f, 4.46954370e-03f, 4.15319996e-03f, 3.84857086e-03f, 3.55642033e-03f,
+  3.27735604e-03f, 3.01183504e-03f, 2.76016886e-03f, 2.52253469e-03f, 2.29898188e-03f, 2.08944501e-03f,
+  1.89375307e-03f, 1.71164097e-03f, 1.54276215e-03f, 1.38669915e-03f, 1.24297536e-03f, 1.11106562e-03f,
+  9.90407425e-04f, 8.80410138e-04f, 7.80464499e-04f, 6.89951004e-04f, 6.08247472e-04f, 5.34735853e-04f,
+  4.68808314e-04f, 4.09872009e-04f, 3.57353623e-04f, 3.10702744e-04f, 2.69394630e-04f, 2.32932332e-04f,
+  2.00848037e-04f, 1.72703978e-04f, 1.48092848e-04f, 1.26637635e-04f, 1.07404571e-02f, 1.07255913e-02f,
+  1.06811179e-02f, 1.06074046e-02f, 1.05050597e-02f, 1.03749223e-02f, 1.02180541e-02f, 1.00357188e-02f,
+  9.82937124e-03f, 9.60063562e-03f, 9.35128238e-03f, 9.08320956e-03f, 8.79841577e-03f, 8.49897601e-03f,
+  8.18701647e-03f, 7.86469132e-03f, 7.53415748e-03f, 7.19754957e-03f, 6.85695978e-03f, 6.51441654e-03f,
+  6.17186492e-03f, 5.83115034e-03f, 5.49400505e-03f, 5.16203372e-03f, 4.83670505e-03f, 4.51934338e-03f,
+  4.21112403e-03f, 3.91307054e-03f, 3.62605439e-03f, 3.35079525e-03f, 3.08786612e-03f, 2.83769681e-03f,
+  2.60058162e-03f, 2.37668678e-03f, 2.16605957e-03f, 1.96863757e-03f, 1.78426004e-03f, 1.61267736e-03f,
+  1.45356276e-03f, 1.30652310e-03f, 1.17110903e-03f, 1.04682613e-03f, 9.33144125e-04f, 8.29506607e-04f,
+  7.35339650e-04f, 6.50059432e-04f, 5.73079800e-04f, 5.03818505e-04f, 4.41702781e-04f, 3.86174041e-04f,
+  3.36692174e-04f, 2.92738550e-04f, 2.53818784e-04f, 2.19464666e-04f, 1.89235405e-04f, 1.62718585e-04f,
+  1.39530413e-04f, 1.19315700e-04f, 1.00914724e-02f, 1.00775054e-02f, 1.00357188e-02f, 9.96645913e-03f,
+  9.87029914e-03f, 9.74802580e-03f, 9.60063562e-03f, 9.42931790e-03f, 9.23543889e-03f, 9.02052410e-03f,
+  8.78623780e-03f, 8.53436347e-03f, 8.26677773e-03f, 7.98543077e-03f, 7.69232167e-03f, 7.38947326e-03f,
+  7.07891164e-03f, 6.76264288e-03f, 6.44263299e-03f, 6.12078747e-03f, 5.79893449e-03f, 5.47880726e-03f,
+  5.16203372e-03f, 4.85012168e-03f, 4.54445044e-03f, 4.24626516e-03f, 3.95666994e-03f, 3.67662613e-03f,
+  3.40695260e-03f, 3.14832595e-03f, 2.90128402e-03f, 2.66623101e-03f, 2.44344329e-03f, 2.23307707e-03f,
+  2.03517685e-03f, 1.84968417e-03f, 1.67644746e-03f, 1.51523249e-03f, 1.36573229e-03f, 1.22757733e-03f,
+  1.10034563e-03f, 9.83572332e-04f, 8.76759528e-04f, 7.79384281e-04f, 6.90907298e-04f, 6.10780029e-04f,
+  5.38451888e-04f, 4.73375665e-04f, 4.15013201e-04f, 3.62839754e-04f, 3.16347781e-04f, 2.75050028e-04f,
+  2.38481967e-04f, 2.06203666e-04f, 1.77800990e-04f, 1.52886438e-04f, 1.31099398e-04f, 1.12106136e-04f,
+  9.45547409e-03f, 9.44238715e-03f, 9.40323435e-03f, 9.33833979e-03f, 9.24823899e-03f, 9.13367234e-03f,
+  8.99557117e-03f, 8.83505028e-03f, 8.65339022e-03f, 8.45201965e-03f, 8.23249947e-03f, 7.99649861e-03f,
+  7.74577726e-03f, 7.48216221e-03f, 7.20752543e-03f, 6.92376355e-03f, 6.63277460e-03f, 6.33643847e-03f,
+  6.03659637e-03f, 5.73503505e-03f, 5.43346582e-03f, 5.13351429e-03f, 4.83670505e-03f, 4.54445044e-03f,
+  4.25804406e-03f, 3.97865102e-03f, 3.70730693e-03f, 3.44491261e-03f, 3.19223478e-03f, 2.94990768e-03f,
+  2.71843513e-03f, 2.49819597e-03f, 2.28944933e-03f, 2.09234119e-03f, 1.90691324e-03f, 1.73311075e-03f,
+  1.57079205e-03f, 1.41973747e-03f, 1.27965922e-03f, 1.15021132e-03f, 1.03099807e-03f, 9.21584317e-04f,
+  8.21503170e-04f, 7.30264874e-04f, 6.47363951e-04f, 5.72286604e-04f, 5.04516822e-04f, 4.43541910e-04f,
+  3.88857676e-04f, 3.39972379e-04f, 2.96410464e-04f, 2.57715437e-04f, 2.23452036e-04f, 1.93208019e-04f,
+  1.66595375e-04f, 1.43251018e-04f, 1.22837067e-04f, 1.05040825e-04f, 8.83505028e-03f, 8.82282201e-03f,
+  8.78623780e-03f, 8.72560125e-03f, 8.64141341e-03f, 8.53436347e-03f, 8.40532407e-03f, 8.25533550e-03f,
+  8.08559544e-03f, 7.89743848e-03f, 7.69232167e-03f, 7.47180637e-03f, 7.23753590e-03f, 6.99121784e-03f,
+  6.73460169e-03f, 6.46945881e-03f, 6.19756291e-03f, 5.92067093e-03f, 5.64050348e-03f, 5.35872905e-03f,
+  5.07694762e-03f, 4.79667727e-03f, 4.51934338e-03f, 4.24626516e-03f, 3.97865102e-03f, 3.71759082e-03f,
+  3.46405106e-03f, 3.21887364e-03f, 2.98277545e-03f, 2.75634858e-03f, 2.54006428e-03f, 2.33427621e-03f,
+  2.13922630e-03f, 1.95505144e-03f, 1.78179052e-03f, 1.61939219e-03f, 1.46772410e-03f, 1.32658100e-03f,
+  1.19569409e-03f, 1.07473985e-03f, 9.63348837e-04f, 8.61114298e-04f, 7.67600024e-04f, 6.82348327e-04f,
+  6.04886969e-04f, 5.34735853e-04f, 4.71412815e-04f, 4.14438779e-04f, 3.63342668e-04f, 3.17664992e-04f,
+  2.76961422e-04f, 2.40805370e-04f, 2.08790152e-04f, 1.80530609e-04f, 1.55664166e-04f, 1.33851558e-04f,
+  1.14777074e-04f, 9.81485427e-05f, 8.23249947e-03f, 8.22110474e-03f, 8.18701647e-03f, 8.13051499e-03f,
+  8.05206876e-03f, 7.95231946e-03f, 7.83208013e-03f, 7.69232167e-03f, 7.53415748e-03f, 7.35883275e-03f,
+  7.16770487e-03f, 6.96222857e-03f, 6.74393587e-03f, 6.51441654e-03f, 6.27530133e-03f, 6.02824148e-03f,
+  5.77488914e-03f, 5.51688112e-03f, 5.25582116e-03f, 4.99326317e-03f, 4.73069958e-03f, 4.46954370e-03f,
+  4.21112403e-03f, 3.95666994e-03f, 3.70730693e-03f, 3.46405106e-03f, 3.22780269e-03f, 2.99934647e-03f,
+  2.77935015e-03f, 2.56836554e-03f, 2.36683176e-03f, 2.17507849e-03f, 1.99333113e-03f, 1.82171690e-03f,
+  1.66027236e-03f, 1.50894956e-03f, 1.36762520e-03f, 1.23610813e-03f, 1.11414760e-03f, 1.00144255e-03f,
+  8.97648395e-04f, 8.02386261e-04f, 7.15249684e-04f, 6.35812117e-04f, 5.63633686e-04f, 4.98266891e-04f,
+  4.39262425e-04f, 3.86174041e-04f, 3.38562677e-04f, 2.96000217e-04f, 2.58072629e-04f, 2.24382427e-04f,
+  1.94550666e-04f, 1.68218423e-04f, 1.45047859e-04f, 1.24722879e-04f, 1.06949272e-04f, 9.14548073e-05f,
+  7.64982263e-03f, 7.63923489e-03f, 7.60755874e-03f, 7.55505683e-03f, 7.48216221e-03f, 7.38947326e-03f,
+  7.27774436e-03f, 7.14787748e-03f, 7.00090779e-03f, 6.83799200e-03f, 6.66039204e-03f, 6.46945881e-03f,
+  6.26661582e-03f, 6.05334155e-03f, 5.83115034e-03f, 5.60157700e-03f, 5.36615588e-03f, 5.12640923e-03f,
+  4.88382624e-03f, 4.63985186e-03f, 4.39587189e-03f, 4.15319996e-03f, 3.91307054e-03f, 3.67662613e-03f,
+  3.44491261e-03f, 3.21887364e-03f, 2.99934647e-03f, 2.78705964e-03f, 2.58263433e-03f, 2.38658278e-03f,
+  2.19931314e-03f, 2.02113157e-03f, 1.85224775e-03f, 1.69278018e-03f, 1.54276215e-03f, 1.40214968e-03f,
+  1.27082795e-03f, 1.14861922e-03f, 1.03529089e-03f, 9.30562790e-04f, 8.34114966e-04f, 7.45595258e-04f,
+  6.64626015e-04f, 5.90810843e-04f, 5.23741008e-04f, 4.63000732e-04f, 4.08172491e-04f, 3.58841557e-04f,
+  3.14600009e-04f, 2.75050028e-04f, 2.39806861e-04f, 2.08501180e-04f, 1.80780829e-04f, 1.56312322e-04f,
+  1.34781716e-04f, 1.15895287e-04f, 9.93796566e-05f, 8.49818534e-05f, 7.08872266e-03f, 7.07891164e-03f,
+  7.04955868e-03f, 7.00090779e-03f, 6.93335989e-03f, 6.84746960e-03f, 6.74393587e-03f, 6.62359409e-03f,
+  6.48740446e-03f, 6.33643847e-03f, 6.17186492e-03f, 5.99493645e-03f, 5.80697181e-03f, 5.60934050e-03f,
+  5.40344696e-03f, 5.19071193e-03f, 4.97255893e-03f, 4.75039706e-03f, 4.52560699e-03f, 4.29952797e-03f,
+  4.07344289e-03f, 3.84857086e-03f, 3.62605439e-03f, 3.40695260e-03f, 3.19223478e-03f, 2.98277545e-03f,
+  2.77935015e-03f, 2.58263433e-03f, 2.39320286e-03f, 2.21153139e-03f, 2.03799759e-03f, 1.87288539e-03f,
+  1.71638897e-03f, 1.56861800e-03f, 1.42960355e-03f, 1.29930477e-03f, 1.17761514e-03f, 1.06437027e-03f,
+  9.59354336e-04f, 8.62307788e-04f, 7.72934232e-04f, 6.90907298e-04f, 6.15876925e-04f, 5.47475996e-04f,
+  4.85325610e-04f, 4.29040490e-04f, 3.78233817e-04f, 3.32521216e-04f, 2.91524688e-04f, 2.54875631e-04f,
+  2.22217495e-04f, 1.93208019e-04f, 1.67520906e-04f, 1.44847101e-04f, 1.24895741e-04f, 1.07394590e-04f,
+  9.20903476e-05f, 7.87485988e-05f, 6.55060774e-03f, 6.54154131e-03f, 6.51441654e-03f, 6.46945881e-03f,
+  6.40703831e-03f, 6.32766820e-03f, 6.23199390e-03f, 6.12078747e-03f, 5.99493645e-03f, 5.85542992e-03f,
+  5.70334960e-03f, 5.53985219e-03f, 5.36615588e-03f, 5.18352725e-03f, 4.99326317e-03f, 4.79667727e-03f,
+  4.59508458e-03f, 4.38978756e-03f, 4.18206165e-03f, 3.97314457e-03f, 3.76422191e-03f, 3.55642033e-03f,
+  3.35079525e-03f, 3.14832595e-03f, 2.94990768e-03f, 2.75634858e-03f, 2.56836554e-03f, 2.38658278e-03f,
+  2.21153139e-03f, 2.04365095e-03f, 1.88329036e-03f, 1.73071201e-03f, 1.58609543e-03f, 1.44954189e-03f,
+  1.32108026e-03f, 1.20067259e-03f, 1.08822074e-03f, 9.83572332e-04f, 8.86528345e-04f, 7.96848733e-04f,
+  7.14259688e-04f, 6.38459518e-04f, 5.69124823e-04f, 5.05916309e-04f, 4.48483857e-04f, 3.96471412e-04f,
+  3.49521550e-04f, 3.07279057e-04f, 2.69394630e-04f, 2.35527652e-04f, 2.05348639e-04f, 1.78541319e-04f,
+  1.54804147e-04f, 1.33851558e-04f, 1.15414725e-04f, 9.92421119e-05f, 8.50996366e-05f, 7.27706793e-05f,
+  6.03659637e-03f, 6.02824148e-03f, 6.00324525e-03f, 5.96181536e-03f, 5.90429315e-03f, 5.83115034e-03f,
+  5.74298343e-03f, 5.64050348e-03f, 5.52452728e-03f, 5.39596798e-03f, 5.25582116e-03f, 5.10515273e-03f,
+  4.94508632e-03f, 4.77678794e-03f, 4.60145343e-03f, 4.42029303e-03f, 4.23451886e-03f, 4.04533092e-03f,
+  3.85390501e-03f, 3.66138085e-03f, 3.46885226e-03f, 3.27735604e-03f, 3.08786612e-03f, 2.90128402e-03f,
+  2.71843513e-03f, 2.54006428e-03f, 2.36683176e-03f, 2.19931314e-03f, 2.03799759e-03f, 1.88329036e-03f,
+  1.73551287e-03f, 1.59490702e-03f, 1.46163814e-03f, 1.33579969e-03f, 1.21741812e-03f, 1.10645860e-03f,
+  1.00283057e-03f, 9.06393689e-04f, 8.16964486e-04f, 7.34321889e-04f, 6.58213394e-04f, 5.88361057e-04f,
+  5.24466916e-04f, 4.66218218e-04f, 4.13292350e-04f, 3.65361222e-04f, 3.22095380e-04f, 2.83167581e-04f,
+  2.48255848e-04f, 2.17046341e-04f, 1.89235405e-04f, 1.64531593e-04f, 1.42657023e-04f, 1.23348524e-04f,
+  1.06358399e-04f, 9.14548073e-05f, 7.84220683e-05f, 6.70605295e-05f, 5.54753048e-03f, 5.53985219e-03f,
+  5.51688112e-03f, 5.47880726e-03f, 5.42594539e-03f, 5.35872905e-03f, 5.27770491e-03f, 5.18352725e-03f,
+  5.07694762e-03f, 4.95880330e-03f, 4.83001070e-03f, 4.69154911e-03f, 4.54445044e-03f, 4.38978756e-03f,
+  4.22865804e-03f, 4.06217482e-03f, 3.89145128e-03f, 3.71759082e-03f, 3.54167353e-03f, 3.36474716e-03f,
+  3.18781659e-03f, 3.01183504e-03f, 2.83769681e-03f, 2.66623101e-03f, 2.49819597e-03f, 2.33427621e-03f,
+  2.17507849e-03f, 2.02113157e-03f, 1.87288539e-03f, 1.73071201e-03f, 1.59490702e-03f, 1.46569265e-03f,
+  1.34322082e-03f, 1.22757733e-03f, 1.11878675e-03f, 1.01681682e-03f, 9.21584317e-04f, 8.32960533e-04f,
+  7.50776555e-04f, 6.74829411e-04f, 6.04886969e-04f, 5.40693873e-04f, 4.81976254e-04f, 4.28446685e-04f,
+  3.79808684e-04f, 3.35760793e-04f, 2.96000217e-04f, 2.60226225e-04f, 2.28142948e-04f, 1.99461923e-04f,
+  1.73904147e-04f, 1.51201748e-04f, 1.31099398e-04f, 1.13355214e-04f, 9.77415693e-05f, 8.40454231e-05f,
+  7.20685566e-05f, 6.16274920e-05f, 5.08398423e-03f, 5.07694762e-03f, 5.05589601e-03f, 5.02100354e-03f,
+  4.97255893e-03f, 4.91095893e-03f, 4.83670505e-03f, 4.75039706e-03f, 4.65272274e-03f, 4.54445044e-03f,
+  4.42641973e-03f, 4.29952797e-03f, 4.16472089e-03f, 4.02298104e-03f, 3.87531542e-03f, 3.72274336e-03f,
+  3.56628560e-03f, 3.40695260e-03f, 3.24573484e-03f, 3.08359228e-03f, 2.92144576e-03f, 2.76016886e-03f,
+  2.60058162e-03f, 2.44344329e-03f, 2.28944933e-03f, 2.13922630e-03f, 1.99333113e-03f, 1.85224775e-03f,
+  1.71638897e-03f, 1.58609543e-03f, 1.46163814e-03f, 1.34322082e-03f, 1.23098260e-03f, 1.12500216e-03f,
+  1.02530199e-03f, 9.31852555e-04f, 8.44577618e-04f, 7.63359130e-04f, 6.88042433e-04f, 6.18441321e-04f,
+  5.54343220e-04f, 4.95514018e-04f, 4.41702781e-04f, 3.92646092e-04f, 3.48072237e-04f, 3.07704933e-04f,
+  2.71266734e-04f, 2.38481967e-04f, 2.09079546e-04f, 1.82795076e-04f, 1.59372881e-04f, 1.38567484e-04f,
+  1.20144854e-04f, 1.03883365e-04f, 8.95743797e-05f, 7.70226688e-05f, 6.60465739e-05f, 5.64779621e-05f,
+  4.64628264e-03f, 4.63985186e-03f, 4.62061306e-03f, 4.58872458e-03f, 4.54445044e-03f, 4.48815385e-03f,
+  4.42029303e-03f, 4.34141560e-03f, 4.25215065e-03f, 4.15319996e-03f, 4.04533092e-03f, 3.92936356e-03f,
+  3.80616286e-03f, 3.67662613e-03f, 3.54167353e-03f, 3.40223708e-03f, 3.25924926e-03f, 3.11363395e-03f,
+  2.96629616e-03f, 2.81811296e-03f, 2.66992627e-03f, 2.52253469e-03f, 2.37668678e-03f, 2.23307707e-03f,
+  2.09234119e-03f, 1.95505144e-03f, 1.82171690e-03f, 1.69278018e-03f, 1.56861800e-03f, 1.44954189e-03f,
+  1.33579969e-03f, 1.22757733e-03f, 1.12500216e-03f, 1.02814613e-03f, 9.37029487e-04f, 8.51625518e-04f,
+  7.71864434e-04f, 6.97638374e-04f, 6.28806010e-04f, 5.65197144e-04f, 5.06617536e-04f, 4.52853157e-04f,
+  4.03674756e-04f, 3.58841557e-04f, 3.18105274e-04f, 2.81213346e-04f, 2.47912249e-04f, 2.17950073e-04f,
+  1.91079016e-04f, 1.67057500e-04f, 1.45651808e-04f, 1.26637635e-04f, 1.09801091e-04f, 9.49396199e-05f,
+  8.18625485e-05f, 7.03914702e-05f, 6.03603548e-05f, 5.16155415e-05f, 4.23451886e-03f, 4.22865804e-03f,
+  4.21112403e-03f, 4.18206165e-03f, 4.14171116e-03f, 4.09040367e-03f, 4.02855687e-03f, 3.95666994e-03f,
+  3.87531542e-03f, 3.78513429e-03f, 3.68682481e-03f, 3.58113460e-03f, 3.46885226e-03f, 3.35079525e-03f,
+  3.22780269e-03f, 3.10072326e-03f, 2.97040725e-03f, 2.83769681e-03f, 2.70341639e-03f, 2.56836554e-03f,
+  2.43331166e-03f, 2.29898188e-03f, 2.16605957e-03f, 2.03517685e-03f, 1.90691324e-03f, 1.78179052e-03f,
+  1.66027236e-03f, 1.54276215e-03f, 1.42960355e-03f, 1.32108026e-03f, 1.21741812e-03f, 1.11878675e-03f,
+  1.02530199e-03f, 9.37029487e-04f, 8.53987876e-04f, 7.76152592e-04f, 7.03460129e-04f, 6.35812117e-04f,
+  5.73079800e-04f, 5.15108113e-04f, 4.61719959e-04f, 4.12720314e-04f, 3.67900211e-04f, 3.27040238e-04f,
+  2.89914082e-04f, 2.56291591e-04f, 2.25941723e-04f, 1.98634851e-04f, 1.74145171e-04f, 1.52252484e-04f,
+  1.32743822e-04f, 1.15414725e-04f, 1.00070269e-04f, 8.65258553e-05f, 7.46077130e-05f, 6.41532242e-05f,
+  5.50110854e-05f, 4.70412560e-05f, 3.84857086e-03f, 3.84324417e-03f, 3.82730807e-03f, 3.80089483e-03f,
+  3.76422191e-03f, 3.71759082e-03f, 3.66138085e-03f, 3.59604578e-03f, 3.52210645e-03f, 3.44014447e-03f,
+  3.35079525e-03f, 3.25473817e-03f, 3.15268943e-03f, 3.04539269e-03f, 2.93361000e-03f, 2.81811296e-03f,
+  2.69967457e-03f, 2.57905968e-03f, 2.45701801e-03f, 2.33427621e-03f, 2.21153139e-03f, 2.08944501e-03f,
+  1.96863757e-03f, 1.84968417e-03f, 1.73311075e-03f, 1.61939219e-03f, 1.50894956e-03f, 1.40214968e-03f,
+  1.29930477e-03f, 1.20067259e-03f, 1.10645860e-03f, 1.01681682e-03f, 9.31852555e-04f, 8.51625518e-04f,
+  7.76152592e-04f, 7.05411425e-04f, 6.39344391e-04f, 5.77862083e-04f, 5.20847447e-04f, 4.68159444e-04f,
+  4.19637247e-04f, 3.75103613e-04f, 3.34368553e-04f, 2.97232706e-04f, 2.63490336e-04f, 2.32932332e-04f,
+  2.05348639e-04f, 1.80530609e-04f, 1.58273004e-04f, 1.38375690e-04f, 1.20645112e-04f, 1.04895444e-04f,
+  9.09495357e-05f, 7.86396049e-05f, 6.78077122e-05f, 5.83060828e-05f, 4.99971902e-05f, 4.27537598e-05f,
+  3.48812342e-03f, 3.48329567e-03f, 3.46885226e-03f, 3.44491261e-03f, 3.41167464e-03f, 3.36941076e-03f,
+  3.31846531e-03f, 3.25924926e-03f, 3.19223478e-03f, 3.11794947e-03f, 3.03696841e-03f, 2.94990768e-03f,
+  2.85741664e-03f, 2.76016886e-03f, 2.65885540e-03f, 2.55417568e-03f, 2.44683004e-03f, 2.33751163e-03f,
+  2.22689984e-03f, 2.11565383e-03f, 2.00440502e-03f, 1.89375307e-03f, 1.78426004e-03f, 1.67644746e-03f,
+  1.57079205e-03f, 1.46772410e-03f, 1.36762520e-03f, 1.27082795e-03f, 1.17761514e-03f, 1.08822074e-03f,
+  1.00283057e-03f, 9.21584317e-04f, 8.44577618e-04f, 7.71864434e-04f, 7.03460129e-04f, 6.39344391e-04f,
+  5.79465064e-04f, 5.23741008e-04f, 4.72066196e-04f, 4.24312835e-04f, 3.80335114e-04f, 3.39972379e-04f,
+  3.03052453e-04f, 2.69394630e-04f, 2.38812499e-04f, 2.11116494e-04f, 1.86116216e-04f, 1.63622579e-04f,
+  1.43449564e-04f, 1.25415783e-04f, 1.09345798e-04f, 9.50712056e-05f, 8.24314338e-05f, 7.12744222e-05f,
+  6.14570163e-05f, 5.28452838e-05f, 4.53145840e-05f, 3.87495529e-05f, 3.15268943e-03f, 3.14832595e-03f,
+  3.13527137e-03f, 3.11363395e-03f, 3.08359228e-03f, 3.04539269e-03f, 2.99934647e-03f, 2.94582476e-03f,
+  2.88525480e-03f, 2.81811296e-03f, 2.74491939e-03f, 2.66623101e-03f, 2.58263433e-03f, 2.49473844e-03f,
+  2.40316777e-03f, 2.30855448e-03f, 2.21153139e-03f, 2.11272552e-03f, 2.01275107e-03f, 1.91220280e-03f,
+  1.81165221e-03f, 1.71164097e-03f, 1.61267736e-03f, 1.51523249e-03f, 1.41973747e-03f, 1.32658100e-03f,
+  1.23610813e-03f, 1.14861922e-03f, 1.06437027e-03f, 9.83572332e-04f, 9.06393689e-04f, 8.32960533e-04f,
+  7.63359130e-04f, 6.97638374e-04f, 6.35812117e-04f, 5.77862083e-04f, 5.23741008e-04f, 4.73375665e-04f,
+  4.26670129e-04f, 3.83508945e-04f, 3.43760330e-04f, 3.07279057e-04f, 2.73909536e-04f, 2.43488408e-04f,
+  2.15847191e-04f, 1.90814550e-04f, 1.68218423e-04f, 1.47887869e-04f, 1.29654785e-04f, 1.13355214e-04f,
+  9.88305983e-05f, 8.59287175e-05f, 7.45044454e-05f, 6.44203392e-05f, 5.55470288e-05f, 4.77634385e-05f,
+  4.09569220e-05f, 3.50232149e-05f, 2.84162979e-03f, 2.83769681e-03f, 2.82593025e-03f, 2.80642766e-03f,
+  2.77935015e-03f, 2.74491939e-03f, 2.70341639e-03f, 2.65517551e-03f, 2.60058162e-03f, 2.54006428e-03f,
+  2.47409241e-03f, 2.40316777e-03f, 2.32781912e-03f, 2.24859547e-03f, 2.16605957e-03f, 2.08078115e-03f,
+  1.99333113e-03f, 1.90427387e-03f, 1.81416317e-03f, 1.72353559e-03f, 1.63290580e-03f, 1.54276215e-03f,
+  1.45356276e-03f, 1.36573229e-03f, 1.27965922e-03f, 1.19569409e-03f, 1.11414760e-03f, 1.03529089e-03f,
+  9.59354336e-04f, 8.86528345e-04f, 8.16964486e-04f, 7.50776555e-04f, 6.88042433e-04f, 6.28806010e-04f,
+  5.73079800e-04f, 5.20847447e-04f, 4.72066196e-04f, 4.26670129e-04f, 3.84572777e-04f, 3.45670094e-04f,
+  3.09843250e-04f, 2.76961422e-04f, 2.46884272e-04f, 2.19464666e-04f, 1.94550666e-04f, 1.71987864e-04f,
+  1.51621178e-04f, 1.33296533e-04f, 1.16862415e-04f, 1.02171041e-04f, 8.90794909e-05f, 7.74505752e-05f,
+  6.71534799e-05f, 5.80643173e-05f, 5.00664864e-05f, 4.30508662e-05f, 3.69159134e-05f, 3.15676552e-05f,
+  2.55417568e-03f, 2.55064061e-03f, 2.54006428e-03f, 2.52253469e-03f, 2.49819597e-03f, 2.46724836e-03f,
+  2.42994376e-03f, 2.38658278e-03f, 2.33751163e-03f, 2.28311610e-03f, 2.22381763e-03f, 2.16006767e-03f,
+  2.09234119e-03f, 2.02113157e-03f, 1.94694486e-03f, 1.87029317e-03f, 1.79168931e-03f, 1.71164097e-03f,
+  1.63064571e-03f, 1.54918595e-03f, 1.46772410e-03f, 1.38669915e-03f, 1.30652310e-03f, 1.22757733e-03f,
+  1.15021132e-03f, 1.07473985e-03f, 1.00144255e-03f, 9.30562790e-04f, 8.62307788e-04f, 7.96848733e-04f,
+  7.34321889e-04f, 6.74829411e-04f, 6.18441321e-04f, 5.65197144e-04f, 5.15108113e-04f, 4.68159444e-04f,
+  4.24312835e-04f, 3.83508945e-04f, 3.45670094e-04f, 3.10702744e-04f, 2.78500083e-04f, 2.48944503e-04f,
+  2.21909926e-04f, 1.97264017e-04f, 1.74870278e-04f, 1.54589885e-04f, 1.36283459e-04f, 1.19812503e-04f,
+  1.05040825e-04f, 9.18356091e-05f, 8.00683774e-05f, 6.96158168e-05f, 6.03603548e-05f, 5.21906368e-05f,
+  4.50018524e-05f, 3.86959182e-05f, 3.31815681e-05f, 2.83743302e-05f, 2.28944933e-03f, 2.28628051e-03f,
+  2.27680034e-03f, 2.26108753e-03f, 2.23927153e-03f, 2.21153139e-03f, 2.17809319e-03f, 2.13922630e-03f,
+  2.09524110e-03f, 2.04648334e-03f, 1.99333113e-03f, 1.93618832e-03f, 1.87548122e-03f, 1.81165221e-03f,
+  1.74515462e-03f, 1.67644746e-03f, 1.60599046e-03f, 1.53423869e-03f, 1.46163814e-03f, 1.38862117e-03f,
+  1.31560245e-03f, 1.24297536e-03f, 1.17110903e-03f, 1.10034563e-03f, 1.03099807e-03f, 9.63348837e-04f,
+  8.97648395e-04f, 8.34114966e-04f, 7.72934232e-04f, 7.14259688e-04f, 6.58213394e-04f, 6.04886969e-04f,
+  5.54343220e-04f, 5.06617536e-04f, 4.61719959e-04f, 4.19637247e-04f, 3.80335114e-04f, 3.43760330e-04f,
+  3.09843250e-04f, 2.78500083e-04f, 2.49635050e-04f, 2.23142750e-04f, 1.98910158e-04f, 1.76818663e-04f,
+  1.56745911e-04f, 1.38567484e-04f, 1.22158410e-04f, 1.07394590e-04f, 9.41539110e-05f, 8.23173395e-05f,
+  7.17697185e-05f, 6.24005115e-05f, 5.41043300e-05f, 4.67813588e-05f, 4.03376544e-05f, 3.46852976e-05f,
+  2.97424776e-05f, 2.54334846e-05f, 2.04648334e-03f, 2.04365095e-03f, 2.03517685e-03f, 2.02113157e-03f,
+  2.00163084e-03f, 1.97683461e-03f, 1.94694486e-03f, 1.91220280e-03f, 1.87288539e-03f, 1.82930217e-03f,
+  1.78179052e-03f, 1.73071201e-03f, 1.67644746e-03f, 1.61939219e-03f, 1.55995158e-03f, 1.49853586e-03f,
+  1.43555610e-03f, 1.37141894e-03f, 1.30652310e-03f, 1.24125497e-03f, 1.17598521e-03f, 1.11106562e-03f,
+  1.04682613e-03f, 9.83572332e-04f, 9.21584317e-04f, 8.61114298e-04f, 8.02386261e-04f, 7.45595258e-04f,
+  6.90907298e-04f, 6.38459518e-04f, 5.88361057e-04f, 5.40693873e-04f, 4.95514018e-04f, 4.52853157e-04f,
+  4.12720314e-04f, 3.75103613e-04f, 3.39972379e-04f, 3.07279057e-04f, 2.76961422e-04f, 2.48944503e-04f,
+  2.23142750e-04f, 1.99461923e-04f, 1.77800990e-04f, 1.58053939e-04f, 1.40111384e-04f, 1.23862119e-04f,
+  1.09194450e-04f, 9.59974277e-05f, 8.41619112e-05f, 7.35814829e-05f, 6.41532242e-05f, 5.57783133e-05f,
+  4.83625554e-05f, 4.18167292e-05f, 3.60568556e-05f, 3.10043506e-05f, 2.65860835e-05f, 2.27343771e-05f,
+  1.82424183e-03f, 1.82171690e-03f, 1.81416317e-03f, 1.80164317e-03f, 1.78426004e-03f, 1.76215661e-03f,
+  1.73551287e-03f, 1.70454371e-03f, 1.66949607e-03f, 1.63064571e-03f, 1.58829370e-03f, 1.54276215e-03f,
+  1.49439054e-03f, 1.44353136e-03f, 1.39054575e-03f, 1.33579969e-03f, 1.27965922e-03f, 1.22248719e-03f,
+  1.16463879e-03f, 1.10645860e-03f, 1.04827702e-03f, 9.90407425e-04f, 9.33144125e-04f, 8.76759528e-04f,
+  8.21503170e-04f, 7.67600024e-04f, 7.15249684e-04f, 6.64626015e-04f, 6.15876925e-04f, 5.69124823e-04f,
+  5.24466916e-04f, 4.81976254e-04f, 4.41702781e-04f, 4.03674756e-04f, 3.67900211e-04f, 3.34368553e-04f,
+  3.03052453e-04f, 2.73909536e-04f, 2.46884272e-04f, 2.21909926e-04f, 1.98910158e-04f, 1.77800990e-04f,
+  1.58492374e-04f, 1.40889781e-04f, 1.24895741e-04f, 1.10411092e-04f, 9.73362839e-05f, 8.55724138e-05f,
+  7.50221952e-05f, 6.55907716e-05f, 5.71863857e-05f, 4.97209658e-05f, 4.31105364e-05f, 3.72755640e-05f,
+  3.21411972e-05f, 2.76373758e-05f, 2.36989199e-05f, 2.02654956e-05f, 1.62163668e-03f, 1.61939219e-03f,
+  1.61267736e-03f, 1.60154782e-03f, 1.58609543e-03f, 1.56644685e-03f, 1.54276215e-03f, 1.51523249e-03f,
+  1.48407742e-03f, 1.44954189e-03f, 1.41189364e-03f, 1.37141894e-03f, 1.32841954e-03f, 1.28320896e-03f,
+  1.23610813e-03f, 1.18744222e-03f, 1.13753683e-03f, 1.08671456e-03f, 1.03529089e-03f, 9.83572332e-04f,
+  9.31852555e-04f, 8.80410138e-04f, 8.29506607e-04f, 7.79384281e-04f, 7.30264874e-04f, 6.82348327e-04f,
+  6.35812117e-04f, 5.90810843e-04f, 5.47475996e-04f, 5.05916309e-04f, 4.66218218e-04f, 4.28446685e-04f,
+  3.92646092e-04f, 3.58841557e-04f, 3.27040238e-04f, 2.97232706e-04f, 2.69394630e-04f, 2.43488408e-04f,
+  2.19464666e-04f, 1.97264017e-04f, 1.76818663e-04f, 1.58053939e-04f, 1.40889781e-04f, 1.25242193e-04f,
+  1.11024485e-04f, 9.81485427e-05f, 8.65258553e-05f, 7.60685143e-05f, 6.66900305e-05f, 5.83060828e-05f,
+  5.08351150e-05f, 4.41988232e-05f, 3.83225633e-05f, 3.31356423e-05f, 2.85715105e-05f, 2.45678948e-05f,
+  2.10668550e-05f, 1.80147563e-05f, 1.43754575e-03f, 1.43555610e-03f, 1.42960355e-03f, 1.41973747e-03f,
+  1.40603923e-03f, 1.38862117e-03f, 1.36762520e-03f, 1.34322082e-03f, 1.31560245e-03f, 1.28498743e-03f,
+  1.25161302e-03f, 1.21573312e-03f, 1.17761514e-03f, 1.13753683e-03f, 1.09578297e-03f, 1.05264178e-03f,
+  1.00840174e-03f, 9.63348837e-04f, 9.17762984e-04f, 8.71915603e-04f, 8.26067058e-04f, 7.80464499e-04f,
+  7.35339650e-04f, 6.90907298e-04f, 6.47363951e-04f, 6.04886969e-04f, 5.63633686e-04f, 5.23741008e-04f,
+  4.85325610e-04f, 4.48483857e-04f, 4.13292350e-04f, 3.79808684e-04f, 3.48072237e-04f, 3.18105274e-04f,
+  2.89914082e-04f, 2.63490336e-04f, 2.38812499e-04f, 2.15847191e-04f, 1.94550666e-04f, 1.74870278e-04f,
+  1.56745911e-04f, 1.40111384e-04f, 1.24895741e-04f, 1.11024485e-04f, 9.84208018e-05f, 8.70065560e-05f,
+  7.67032980e-05f, 6.74330877e-05f, 5.91192656e-05f, 5.16870787e-05f, 4.50642256e-05f, 3.91812973e-05f,
+  3.39721228e-05f, 2.93740286e-05f, 2.53280232e-05f, 2.17789056e-05f, 1.86753095e-05f, 1.59696901e-05f,
+  1.27082795e-03f, 1.26906903e-03f, 1.26380683e-03f, 1.25508499e-03f, 1.24297536e-03f, 1.22757733e-03f,
+  1.20901642e-03f, 1.18744222e-03f, 1.16302690e-03f, 1.13596243e-03f, 1.10645860e-03f, 1.07473985e-03f,
+  1.04104250e-03f, 1.00561231e-03f, 9.68700740e-04f, 9.30562790e-04f, 8.91453470e-04f, 8.51625518e-04f,
+  8.11326376e-04f, 7.70796149e-04f, 7.30264874e-04f, 6.89951004e-04f, 6.50059432e-04f, 6.10780029e-04f,
+  5.72286604e-04f, 5.34735853e-04f, 4.98266891e-04f, 4.63000732e-04f, 4.29040490e-04f, 3.96471412e-04f,
+  3.65361222e-04f, 3.35760793e-04f, 3.07704933e-04f, 2.81213346e-04f, 2.56291591e-04f, 2.32932332e-04f,
+  2.11116494e-04f, 1.90814550e-04f, 1.71987864e-04f, 1.54589885e-04f, 1.38567484e-04f, 1.23862119e-04f,
+  1.10411092e-04f, 9.81485427e-05f, 8.70065560e-05f, 7.69160615e-05f, 6.78077122e-05f, 5.96126083e-05f,
+  5.22629744e-05f, 4.56927264e-05f, 3.98379525e-05f, 3.46372908e-05f, 3.00322426e-05f, 2.59674071e-05f,
+  2.23906336e-05f, 1.92531224e-05f, 1.65094607e-05f, 1.41176233e-05f, 1.12033740e-03f, 1.11878675e-03f,
+  1.11414760e-03f, 1.10645860e-03f, 1.09578297e-03f, 1.08220847e-03f, 1.06584548e-03f, 1.04682613e-03f,
+  1.02530199e-03f, 1.00144255e-03f, 9.75432515e-04f, 9.47469845e-04f, 9.17762984e-04f, 8.86528345e-04f,
+  8.53987876e-04f, 8.20366142e-04f, 7.85888173e-04f, 7.50776555e-04f, 7.15249684e-04f, 6.79518969e-04f,
+  6.43787382e-04f, 6.08247472e-04f, 5.73079800e-04f, 5.38451888e-04f, 5.04516822e-04f, 4.71412815e-04f,
+  4.39262425e-04f, 4.08172491e-04f, 3.78233817e-04f, 3.49521550e-04f, 3.22095380e-04f, 2.96000217e-04f,
+  2.71266734e-04f, 2.47912249e-04f, 2.25941723e-04f, 2.05348639e-04f, 1.86116216e-04f, 1.68218423e-04f,
+  1.51621178e-04f, 1.36283459e-04f, 1.22158410e-04f, 1.09194450e-04f, 9.73362839e-05f, 8.65258553e-05f,
+  7.67032980e-05f, 6.78077122e-05f, 5.97779690e-05f, 5.25533251e-05f, 4.60740266e-05f, 4.02818259e-05f,
+  3.51203671e-05f, 3.05355643e-05f, 2.64758437e-05f, 2.28923636e-05f, 1.97391491e-05f, 1.69731793e-05f,
+  1.45544209e-05f, 1.24458238e-05f, 9.84935556e-04f, 9.83572332e-04f, 9.79493954e-04f, 9.72734240e-04f,
+  9.63348837e-04f, 9.51414870e-04f, 9.37029487e-04f, 9.20308754e-04f, 9.01386025e-04f, 8.80410138e-04f,
+  8.57543666e-04f, 8.32960533e-04f, 8.06843920e-04f, 7.79384281e-04f, 7.50776555e-04f, 7.21218355e-04f,
+  6.90907298e-04f, 6.60039193e-04f, 6.28806010e-04f, 5.97393664e-04f, 5.65980503e-04f, 5.34735853e-04f,
+  5.03818505e-04f, 4.73375665e-04f, 4.43541910e-04f, 4.14438779e-04f, 3.86174041e-04f, 3.58841557e-04f,
+  3.32521216e-04f, 3.07279057e-04f, 2.83167581e-04f, 2.60226225e-04f, 2.38481967e-04f, 2.17950073e-04f,
+  1.98634851e-04f, 1.80530609e-04f, 1.63622579e-04f, 1.47887869e-04f, 1.33296533e-04f, 1.19812503e-04f,
+  1.07394590e-04f, 9.59974277e-05f, 8.55724138e-05f, 7.60685143e-05f, 6.74330877e-05f, 5.96126083e-05f,
+  5.25533251e-05f, 4.62018324e-05f, 4.05056126e-05f, 3.54134427e-05f, 3.08757917e-05f, 2.68450967e-05f,
+  2.32760267e-05f, 2.01256389e-05f, 1.73535154e-05f, 1.49218349e-05f, 1.27954027e-05f, 1.09416460e-05f,
+  8.63502966e-04f, 8.62307788e-04f, 8.58732208e-04f, 8.52805853e-04f, 8.44577618e-04f, 8.34114966e-04f,
+  8.21503170e-04f, 8.06843920e-04f, 7.90254213e-04f, 7.71864434e-04f, 7.51817133e-04f, 7.30264874e-04f,
+  7.07368192e-04f, 6.83294027e-04f, 6.58213394e-04f, 6.32299343e-04f, 6.05725334e-04f, 5.78663021e-04f,
+  5.51280566e-04f, 5.23741008e-04f, 4.96200810e-04f, 4.68808314e-04f, 4.41702781e-04f, 4.15013201e-04f,
+  3.88857676e-04f, 3.63342668e-04f, 3.38562677e-04f, 3.14600009e-04f, 2.91524688e-04f, 2.69394630e-04f,
+  2.48255848e-04f, 2.28142948e-04f, 2.09079546e-04f, 1.91079016e-04f, 1.74145171e-04f, 1.58273004e-04f,
+  1.43449564e-04f, 1.29654785e-04f, 1.16862415e-04f, 1.05040825e-04f, 9.41539110e-05f, 8.41619112e-05f,
+  7.50221952e-05f, 6.66900305e-05f, 5.91192656e-05f, 5.22629744e-05f, 4.60740266e-05f, 4.05056126e-05f,
+  3.55116754e-05f, 3.10473224e-05f, 2.70691162e-05f, 2.35353655e-05f, 2.04063253e-05f, 1.76443500e-05f,
+  1.52140010e-05f, 1.30821227e-05f, 1.12178586e-05f, 9.59265162e-06f, 7.54947541e-04f, 7.53902656e-04f,
+  7.50776555e-04f, 7.45595258e-04f, 7.38401432e-04f, 7.29254098e-04f, 7.18227820e-04f, 7.05411425e-04f,
+  6.90907298e-04f, 6.74829411e-04f, 6.57302386e-04f, 6.38459518e-04f, 6.18441321e-04f, 5.97393664e-04f,
+  5.75465965e-04f, 5.52809739e-04f, 5.29576500e-04f, 5.05916309e-04f, 4.81976254e-04f, 4.57898830e-04f,
+  4.33820853e-04f, 4.09872009e-04f, 3.86174041e-04f, 3.62839754e-04f, 3.39972379e-04f, 3.17664992e-04f,
+  2.96000217e-04f, 2.75050028e-04f, 2.54875631e-04f, 2.35527652e-04f, 2.17046341e-04f, 1.99461923e-04f,
+  1.82795076e-04f, 1.67057500e-04f, 1.52252484e-04f, 1.38375690e-04f, 1.25415783e-04f, 1.13355214e-04f,
+  1.02171041e-04f, 9.18356091e-05f, 8.23173395e-05f, 7.35814829e-05f, 6.55907716e-05f, 5.83060828e-05f,
+  5.16870787e-05f, 4.56927264e-05f, 4.02818259e-05f, 3.54134427e-05f, 3.10473224e-05f, 2.71442041e-05f,
+  2.36661181e-05f, 2.05766137e-05f, 1.78409427e-05f, 1.54261870e-05f, 1.33013709e-05f, 1.14375016e-05f,
+  9.80760342e-06f, 8.38670985e-06f, 6.58213394e-04f, 6.57302386e-04f, 6.54576870e-04f, 6.50059432e-04f,
+  6.43787382e-04f, 6.35812117e-04f, 6.26198656e-04f, 6.15024532e-04f, 6.02378801e-04f, 5.88361057e-04f,
+  5.73079800e-04f, 5.56651386e-04f, 5.39198169e-04f, 5.20847447e-04f, 5.01729432e-04f, 4.81976254e-04f,
+  4.61719959e-04f, 4.41091426e-04f, 4.20218887e-04f, 3.99226585e-04f, 3.78233817e-04f, 3.57353623e-04f,
+  3.36692174e-04f, 3.16347781e-04f, 2.96410464e-04f, 2.76961422e-04f, 2.58072629e-04f, 2.39806861e-04f,
+  2.22217495e-04f, 2.05348639e-04f, 1.89235405e-04f, 1.73904147e-04f, 1.59372881e-04f, 1.45651808e-04f,
+  1.32743822e-04f, 1.20645112e-04f, 1.09345798e-04f, 9.88305983e-05f, 8.90794909e-05f, 8.00683774e-05f,
+  7.17697185e-05f, 6.41532242e-05f, 5.71863857e-05f, 5.08351150e-05f, 4.50642256e-05f, 3.98379525e-05f,
+  3.51203671e-05f, 3.08757917e-05f, 2.70691162e-05f, 2.36661181e-05f, 2.06336917e-05f, 1.79400577e-05f,
+  1.55549169e-05f, 1.34495740e-05f, 1.15970179e-05f, 9.97197276e-06f, 8.55092003e-06f, 7.31209002e-06f,
+  5.72286604e-04f, 5.71494515e-04f, 5.69124823e-04f, 5.65197144e-04f, 5.59743843e-04f, 5.52809739e-04f,
+  5.44451294e-04f, 5.34735853e-04f, 5.23741008e-04f, 5.11553197e-04f, 4.98266891e-04f, 4.83983080e-04f,
+  4.68808314e-04f, 4.52853157e-04f, 4.36230970e-04f, 4.19056450e-04f, 4.01444529e-04f, 3.83508945e-04f,
+  3.65361222e-04f, 3.47109395e-04f, 3.28857102e-04f, 3.10702744e-04f, 2.92738550e-04f, 2.75050028e-04f,
+  2.57715437e-04f, 2.40805370e-04f, 2.24382427e-04f, 2.08501180e-04f, 1.93208019e-04f, 1.78541319e-04f,
+  1.64531593e-04f, 1.51201748e-04f, 1.38567484e-04f, 1.26637635e-04f, 1.15414725e-04f, 1.04895444e-04f,
+  9.50712056e-05f, 8.59287175e-05f, 7.74505752e-05f, 6.96158168e-05f, 6.24005115e-05f, 5.57783133e-05f,
+  4.97209658e-05f, 4.41988232e-05f, 3.91812973e-05f, 3.46372908e-05f, 3.05355643e-05f, 2.68450967e-05f,
+  2.35353655e-05f, 2.05766137e-05f, 1.79400577e-05f, 1.55980651e-05f, 1.35242935e-05f, 1.16937936e-05f,
+  1.00830803e-05f, 8.67017752e-06f, 7.43463625e-06f, 6.35753031e-06f, 4.96200810e-04f, 4.95514018e-04f,
+  4.93459345e-04f, 4.90053848e-04f, 4.85325610e-04f, 4.79313399e-04f, 4.72066196e-04f, 4.63642442e-04f,
+  4.54109366e-04f, 4.43541910e-04f, 4.32022003e-04f, 4.19637247e-04f, 4.06479987e-04f, 3.92646092e-04f,
+  3.78233817e-04f, 3.63342668e-04f, 3.48072237e-04f, 3.32521216e-04f, 3.16786231e-04f, 3.00960994e-04f,
+  2.85135378e-04f, 2.69394630e-04f, 2.53818784e-04f, 2.38481967e-04f, 2.23452036e-04f, 2.08790152e-04f,
+  1.94550666e-04f, 1.80780829e-04f, 1.67520906e-04f, 1.54804147e-04f, 1.42657023e-04f, 1.31099398e-04f,
+  1.20144854e-04f, 1.09801091e-04f, 1.00070269e-04f, 9.09495357e-05f, 8.24314338e-05f, 7.45044454e-05f,
+  6.71534799e-05f, 6.03603548e-05f, 5.41043300e-05f, 4.83625554e-05f, 4.31105364e-05f, 3.83225633e-05f,
+  3.39721228e-05f, 3.00322426e-05f, 2.64758437e-05f, 2.32760267e-05f, 2.04063253e-05f, 1.78409427e-05f,
+  1.55549169e-05f, 1.35242935e-05f, 1.17262316e-05f, 1.01390970e-05f, 8.74252873e-06f, 7.51747257e-06f,
+  6.44619740e-06f, 5.51229323e-06f, 4.29040490e-04f, 4.28446685e-04f, 4.26670129e-04f, 4.23725549e-04f,
+  4.19637247e-04f, 4.14438779e-04f, 4.08172491e-04f, 4.00888879e-04f, 3.92646092e-04f, 3.83508945e-04f,
+  3.73548246e-04f, 3.62839754e-04f, 3.51463328e-04f, 3.39501828e-04f, 3.27040238e-04f, 3.14164587e-04f,
+  3.00960994e-04f, 2.87514791e-04f, 2.73909536e-04f, 2.60226225e-04f, 2.46542564e-04f, 2.32932332e-04f,
+  2.19464666e-04f, 2.06203666e-04f, 1.93208019e-04f, 1.80530609e-04f, 1.68218423e-04f, 1.56312322e-04f,
+  1.44847101e-04f, 1.33851558e-04f, 1.23348524e-04f, 1.13355214e-04f, 1.03883365e-04f, 9.49396199e-05f,
+  8.65258553e-05f, 7.86396049e-05f, 7.12744222e-05f, 6.44203392e-05f, 5.80643173e-05f, 5.21906368e-05f,
+  4.67813588e-05f, 4.18167292e-05f, 3.72755640e-05f, 3.31356423e-05f, 2.93740286e-05f, 2.59674071e-05f,
+  2.28923636e-05f, 2.01256389e-05f, 1.76443500e-05f, 1.54261870e-05f, 1.34495740e-05f, 1.16937936e-05f,
+  1.01390970e-05f, 8.76678041e-06f, 7.55923611e-06f, 6.49998992e-06f, 5.57371050e-06f, 4.76620926e-06f,
+  3.69944086e-04f, 3.69432062e-04f, 3.67900211e-04f, 3.65361222e-04f, 3.61836050e-04f, 3.57353623e-04f,
+  3.51950439e-04f, 3.45670094e-04f, 3.38562677e-04f, 3.30684095e-04f, 3.22095380e-04f, 3.12861899e-04f,
+  3.03052453e-04f, 2.92738550e-04f, 2.81993416e-04f, 2.70891265e-04f, 2.59506371e-04f, 2.47912249e-04f,
+  2.36180989e-04f, 2.24382427e-04f, 2.12583589e-04f, 2.00848037e-04f, 1.89235405e-04f, 1.77800990e-04f,
+  1.66595375e-04f, 1.55664166e-04f, 1.45047859e-04f, 1.34781716e-04f, 1.24895741e-04f, 1.15414725e-04f,
+  1.06358399e-04f, 9.77415693e-05f, 8.95743797e-05f, 8.18625485e-05f, 7.46077130e-05f, 6.78077122e-05f,
+  6.14570163e-05f, 5.55470288e-05f, 5.00664864e-05f, 4.50018524e-05f, 4.03376544e-05f, 3.60568556e-05f,
+  3.21411972e-05f, 2.85715105e-05f, 2.53280232e-05f, 2.23906336e-05f, 1.97391491e-05f, 1.73535154e-05f,
+  1.52140010e-05f, 1.33013709e-05f, 1.15970179e-05f, 1.00830803e-05f, 8.74252873e-06f, 7.55923611e-06f,
+  6.51802065e-06f, 5.60467561e-06f, 4.80598283e-06f, 4.10970779e-06f, 3.18105274e-04f, 3.17664992e-04f,
+  3.16347781e-04f, 3.14164587e-04f, 3.11133364e-04f, 3.07279057e-04f, 3.02633009e-04f, 2.97232706e-04f,
+  2.91121192e-04f, 2.84346606e-04f, 2.76961422e-04f, 2.69021781e-04f, 2.60586879e-04f, 2.51718244e-04f,
+  2.42478782e-04f, 2.32932332e-04f, 2.23142750e-04f, 2.13173276e-04f, 2.03085874e-04f, 1.92940599e-04f,
+  1.82795076e-04f, 1.72703978e-04f, 1.62718585e-04f, 1.52886438e-04f, 1.43251018e-04f, 1.33851558e-04f,
+  1.24722879e-04f, 1.15895287e-04f, 1.07394590e-04f, 9.92421119e-05f, 9.14548073e-05f, 8.40454231e-05f,
+  7.70226688e-05f, 7.03914702e-05f, 6.41532242e-05f, 5.83060828e-05f, 5.28452838e-05f, 4.77634385e-05f,
+  4.30508662e-05f, 3.86959182e-05f, 3.46852976e-05f, 3.10043506e-05f, 2.76373758e-05f, 2.45678948e-05f,
+  2.17789056e-05f, 1.92531224e-05f, 1.69731793e-05f, 1.49218349e-05f, 1.30821227e-05f, 1.14375016e-05f,
+  9.97197276e-06f, 8.67017752e-06f, 7.51747257e-06f, 6.49998992e-06f, 5.60467561e-06f, 4.81931420e-06f,
+  4.13253929e-06f, 3.53383030e-06f, 2.72773759e-04f, 2.72396224e-04f, 2.71266734e-04f, 2.69394630e-04f,
+  2.66795396e-04f, 2.63490336e-04f, 2.59506371e-04f, 2.54875631e-04f, 2.49635050e-04f, 2.43825882e-04f,
+  2.37493106e-04f, 2.30684906e-04f, 2.23452036e-04f, 2.15847191e-04f, 2.07924415e-04f, 1.99738381e-04f,
+  1.91343861e-04f, 1.82795076e-04f, 1.74145171e-04f, 1.65445643e-04f, 1.56745911e-04f, 1.48092848e-04f,
+  1.39530413e-04f, 1.31099398e-04f, 1.22837067e-04f, 1.14777074e-04f, 1.06949272e-04f, 9.93796566e-05f,
+  9.20903476e-05f, 8.50996366e-05f, 7.84220683e-05f, 7.20685566e-05f, 6.60465739e-05f, 6.03603548e-05f,
+  5.50110854e-05f, 4.99971902e-05f, 4.53145840e-05f, 4.09569220e-05f, 3.69159134e-05f, 3.31815681e-05f,
+  2.97424776e-05f, 2.65860835e-05f, 2.36989199e-05f, 2.10668550e-05f, 1.86753095e-05f, 1.65094607e-05f,
+  1.45544209e-05f, 1.27954027e-05f, 1.12178586e-05f, 9.80760342e-06f, 8.55092003e-06f, 7.43463625e-06f,
+  6.44619740e-06f, 5.57371050e-06f, 4.80598283e-06f, 4.13253929e-06f, 3.54363283e-06f, 3.03024285e-06f,
+  2.33255181e-04f, 2.32932332e-04f, 2.31966478e-04f, 2.30365607e-04f, 2.28142948e-04f, 2.25316704e-04f,
+  2.21909926e-04f, 2.17950073e-04f, 2.13468738e-04f, 2.08501180e-04f, 2.03085874e-04f, 1.97264017e-04f,
+  1.91079016e-04f, 1.84575954e-04f, 1.77800990e-04f, 1.70800922e-04f, 1.63622579e-04f, 1.56312322e-04f,
+  1.48915584e-04f, 1.41476412e-04f, 1.34037080e-04f, 1.26637635e-04f, 1.19315700e-04f, 1.12106136e-04f,
+  1.05040825e-04f, 9.81485427e-05f, 9.14548073e-05f, 8.49818534e-05f, 7.87485988e-05f, 7.27706793e-05f,
+  6.70605295e-05f, 6.16274920e-05f, 5.64779621e-05f, 5.16155415e-05f, 4.70412560e-05f, 4.27537598e-05f,
+  3.87495529e-05f, 3.50232149e-05f, 3.15676552e-05f, 2.83743302e-05f, 2.54334846e-05f, 2.27343771e-05f,
+  2.02654956e-05f, 1.80147563e-05f, 1.59696901e-05f, 1.41176233e-05f, 1.24458238e-05f, 1.09416460e-05f,
+  9.59265162e-06f, 8.38670985e-06f, 7.31209002e-06f, 6.35753031e-06f, 5.51229323e-06f, 4.76620926e-06f,
+  4.10970779e-06f, 3.53383030e-06f, 3.03024285e-06f, 2.59123090e-06f
+};
+static const float kern_row_19[] = {
+  2.33833372e-04f, 2.73449928e-04f, 3.18893784e-04f, 3.70861118e-04f, 4.30104003e-04f, 4.97430796e-04f,
+  5.73705242e-04f, 6.59844954e-04f, 7.56818918e-04f, 8.65643378e-04f, 9.87377018e-04f, 1.12311449e-03f,
+  1.27397815e-03f, 1.44110911e-03f, 1.62565638e-03f, 1.82876375e-03f, 2.05155625e-03f, 2.29512434e-03f,
+  2.56050704e-03f, 2.84867361e-03f, 3.16050439e-03f, 3.49676982e-03f, 3.85811063e-03f, 4.24501533e-03f,
+  4.65780031e-03f, 5.09658642e-03f, 5.56128146e-03f, 6.05155993e-03f, 6.56684535e-03f, 7.10629439e-03f,
+  7.66878529e-03f, 8.25290661e-03f, 8.85695033e-03f, 9.47891269e-03f, 1.01164877e-02f, 1.07670808e-02f,
+  1.14278141e-02f, 1.20955408e-02f, 1.27668697e-02f, 1.34381820e-02f, 1.41056655e-02f, 1.47653446e-02f,
+  1.54131213e-02f, 1.60448086e-02f, 1.66561827e-02f, 1.72430221e-02f, 1.78011581e-02f, 1.83265228e-02f,
+  1.88152008e-02f, 1.92634761e-02f, 1.96678732e-02f, 2.00252105e-02f, 2.03326400e-02f, 2.05876809e-02f,
+  2.07882542e-02f, 2.09327172e-02f, 2.10198760e-02f, 2.10490096e-02f, 2.10198760e-02f, 2.09327172e-02f,
+  2.07882542e-02f, 2.05876809e-02f, 2.03326400e-02f, 2.00252105e-02f, 1.96678732e-02f, 1.92634761e-02f,
+  1.88152008e-02f, 1.83265228e-02f, 1.78011581e-02f, 1.72430221e-02f, 1.66561827e-02f, 1.60448086e-02f,
+  1.54131213e-02f, 1.47653446e-02f, 1.41056655e-02f, 1.34381820e-02f, 1.27668697e-02f, 1.20955408e-02f,
+  1.14278141e-02f, 1.07670808e-02f, 1.01164877e-02f, 9.47891269e-03f, 8.85695033e-03f, 8.25290661e-03f,
+  7.66878529e-03f, 7.10629439e-03f, 6.56684535e-03f, 6.05155993e-03f, 5.56128146e-03f, 5.09658642e-03f,
+  4.65780031e-03f, 4.24501533e-03f, 3.85811063e-03f, 3.49676982e-03f, 3.16050439e-03f, 2.84867361e-03f,
+  2.56050704e-03f, 2.29512434e-03f, 2.05155625e-03f, 1.82876375e-03f, 1.62565638e-03f, 1.44110911e-03f,
+  1.27397815e-03f, 1.12311449e-03f, 9.87377018e-04f, 8.65643378e-04f, 7.56818918e-04f, 6.59844954e-04f,
+  5.73705242e-04f, 4.97430796e-04f, 4.30104003e-04f, 3.70861118e-04f, 3.18893784e-04f, 2.73449928e-04f,
+  2.33833372e-04f
+};
+static const int kern_half_fixed_19[] = {
+  7433, 7423, 7392, 7341, 7270, 7180, 7072, 6946, 6803, 6644, 6472, 6286,
+  6089, 5882, 5666, 5443, 5214, 4981, 4746, 4509, 4271, 4036, 3802, 3573,
+  3347, 3128, 2914, 2708, 2510, 2319, 2137, 1964, 1800, 1645, 1499, 1362,
+  1235, 1116, 1006, 904, 811, 724, 646, 574, 509, 450, 397, 349,
+  306, 267, 233, 203, 176, 152, 131, 113, 97, 83, 7423, 7413,
+  7382, 7331, 7260, 7170, 7062, 6936, 6793, 6635, 6463, 6278, 6081, 5874,
+  5658, 5435, 5207, 4974, 4739, 4502, 4266, 4030, 3797, 3568, 3343, 3123,
+  2910, 2704, 2506, 2316, 2134, 1961, 1797, 1643, 1497, 1361, 1233, 1115,
+  1005, 903, 809, 723, 645, 573, 508, 449, 396, 348, 305, 267,
+  233, 202, 175, 152, 131, 112, 96, 82, 7392, 7382, 7351, 7301,
+  7230, 7141, 7033, 6907, 6765, 6608, 6436, 6252, 6056, 5849, 5635, 5413,
+  5185, 4954, 4719, 4484, 4248, 4013, 3781, 3553, 3329, 3110, 2898, 2693,
+  2496, 2306, 2125, 1953, 1790, 1636, 1491, 1355, 1228, 1110, 1000, 899,
+  806, 720, 642, 571, 506, 447, 394, 347, 304, 266, 232, 201,
+  175, 151, 130, 112, 96, 82, 7341, 7331, 7301, 7250, 7180, 7091,
+  6984, 6859, 6718, 6562, 6392, 6208, 6014, 5809, 5596, 5376, 5150, 4920,
+  4687, 4453, 4219, 3986, 3755, 3528, 3306, 3089, 2878, 2675, 2478, 2290,
+  2111, 1940, 1778, 1624, 1481, 1346, 1220, 1102, 994, 893, 800, 716,
+  638, 567, 503, 444, 392, 344, 302, 264, 230, 200, 173, 150,
+  129, 111, 95, 82, 7270, 7260, 7230, 7180, 7111, 7023, 6917, 6793,
+  6654, 6499, 6330, 6149, 5956, 5753, 5542, 5324, 5100, 4872, 4642, 4410,
+  4178, 3947, 3719, 3494, 3274, 3059, 2851, 2649, 2455, 2268, 2090, 1921,
+  1760, 1609, 1466, 1333, 1208, 1092, 984, 884, 793, 709, 632, 562,
+  498, 440, 388, 341, 299, 261, 228, 198, 172, 149, 128, 110,
+  94, 81, 7180, 7170, 7141, 7091, 7023, 6936, 6831, 6709, 6571, 6418,
+  6252, 6072, 5882, 5682, 5473, 5258, 5037, 4812, 4584, 4355, 4126, 3898,
+  3673, 3451, 3233, 3021, 2815, 2616, 2424, 2240, 2064, 1897, 1739, 1589,
+  1448, 1316, 1193, 1078, 972, 873, 783, 700, 624, 555, 492, 435,
+  383, 337, 295, 258, 225, 196, 170, 147, 127, 109, 93, 80,
+  7072, 7062, 7033, 6984, 6917, 6831, 6728, 6608, 6472, 6321, 6157, 5981,
+  5793, 5596, 5390, 5178, 4961, 4739, 4515, 4289, 4064, 3839, 3617, 3399,
+  3185, 2976, 2773, 2576, 2387, 2206, 2033, 1868, 1712, 1565, 1426, 1296,
+  1175, 1062, 957, 860, 771, 689, 614, 546, 484, 428, 377, 332,
+  291, 254, 222, 193, 167, 144, 125, 107, 92, 79, 6946, 6936,
+  6907, 6859, 6793, 6709, 6608, 6490, 6356, 6208, 6047, 5874, 5690, 5496,
+  5294, 5086, 4872, 4654, 4434, 4213, 3991, 3771, 3553, 3338, 3128, 2923,
+  2723, 2530, 2345, 2167, 1997, 1835, 1682, 1537, 1401, 1273, 1154, 1043,
+  940, 845, 757, 677, 603, 536, 476, 420, 371, 326, 286, 250,
+  218, 189, 164, 142, 122, 105, 90, 77, 6803, 6793, 6765, 6718,
+  6654, 6571, 6472, 6356, 6226, 6081, 5923, 5753, 5573, 5383, 5185, 4981,
+  4772, 4559, 4343, 4126, 3909, 3693, 3480, 3270, 3063, 2862, 2667, 2478,
+  2297, 2122, 1956, 1797, 1647, 1505, 1372, 1247, 1130, 1021, 921, 828,
+  742, 663, 591, 525, 466, 412, 363, 319, 280, 245, 213, 185,
+  161, 139, 120, 103, 88, 76, 6644, 6635, 6608, 6562, 6499, 6418,
+  6321, 6208, 6081, 5939, 5785, 5619, 5443, 5258, 5065, 4865, 4661, 4453,
+  4242, 4030, 3818, 3607, 3399, 3193, 2992, 2796, 2605, 2421, 2243, 2073,
+  1910, 1755, 1609, 1470, 1340, 1218, 1104, 998, 899, 808, 724, 648,
+  577, 513, 455, 402, 355, 312, 273, 239, 208, 181, 157, 136,
+  117, 101, 86, 74, 6472, 6463, 6436, 6392, 6330, 6252, 6157, 6047,
+  5923, 5785, 5635, 5473, 5302, 5121, 4933, 4739, 4540, 4337, 4132, 3925,
+  3719, 3514, 3311, 3110, 2914, 2723, 2537, 2358, 2185, 2019, 1861, 1710,
+  1567, 1432, 1305, 1186, 1075, 972, 876, 787, 706, 631, 562, 500,
+  443, 392, 345, 304, 266, 233, 203, 176, 153, 132, 114, 98,
+  84, 72, 6286, 6278, 6252, 6208, 6149, 6072, 5981, 5874, 5753, 5619,
+  5473, 5316, 5150, 4974, 4792, 4603, 4410, 4213, 4013, 3813, 3612, 3413,
+  3216, 3021, 2831, 2645, 2465, 2290, 2122, 1961, 1807, 1661, 1522, 1391,
+  1268, 1152, 1044, 944, 851, 765, 685, 613, 546, 486, 430, 380,
+  335, 295, 259, 226, 197, 171, 149, 128, 111, 95, 82, 70,
+  6089, 6081, 6056, 6014, 5956, 5882, 5793, 5690, 5573, 5443, 5302, 5150,
+  4988, 4818, 4642, 4459, 4271, 4081, 3888, 3693, 3499, 3306, 3115, 2927,
+  2742, 2562, 2387, 2218, 2056, 1900, 1751, 1609, 1474, 1347, 1228, 1116,
+  1012, 914, 824, 741, 664, 593, 529, 470, 417, 369, 325, 286,
+  250, 219, 191, 166, 144, 124, 107, 92, 79, 68, 5882, 5874,
+  5849, 5809, 5753, 5682, 5596, 5496, 5383, 5258, 5121, 4974, 4818, 4654,
+  4484, 4307, 4126, 3942, 3755, 3568, 3380, 3193, 3009, 2827, 2649, 2475,
+  2306, 2143, 1986, 1835, 1691, 1554, 1424, 1302, 1186, 1078, 977, 883,
+  796, 716, 641, 573, 511, 454, 403, 356, 314, 276, 242, 211,
+  184, 160, 139, 120, 104, 89, 76, 65, 5666, 5658, 5635, 5596,
+  5542, 5473, 5390, 5294, 5185, 5065, 4933, 4792, 4642, 4484, 4319, 4149,
+  3975, 3797, 3617, 3437, 3256, 3076, 2898, 2723, 2552, 2384, 2222, 2064,
+  1913, 1768, 1629, 1497, 1372, 1254, 1143, 1039, 941, 851, 767, 689,
+  618, 552, 492, 438, 388, 343, 302, 266, 233, 204, 178, 154,
+  134, 116, 100, 86, 74, 63, 5443, 5435, 5413, 5376, 5324, 5258,
+  5178, 5086, 4981, 4865, 4739, 4603, 4459, 4307, 4149, 3986, 3818, 3648,
+  3475, 3301, 3128, 2955, 2784, 2616, 2451, 2290, 2134, 1983, 1838, 1698,
+  1565, 1438, 1318, 1204, 1098, 998, 904, 817, 737, 662, 593, 531,
+  473, 420, 373, 329, 290, 255, 224, 196, 171, 148, 129, 111,
+  96, 82, 71, 60, 5214, 5207, 5185, 5150, 5100, 5037, 4961, 4872,
+  4772, 4661, 4540, 4410, 4271, 4126, 3975, 3818, 3658, 3494, 3329, 3163,
+  2996, 2831, 2667, 2506, 2348, 2194, 2044, 1900, 1760, 1627, 1499, 1378,
+  1263, 1154, 1052, 956, 866, 783, 706, 634, 569, 508, 453, 403,
+  357, 316, 278, 245, 214, 187, 163, 142, 123, 107, 92, 79,
+  68, 58, 4981, 4974, 4954, 4920, 4872, 4812, 4739, 4654, 4559, 4453,
+  4337, 4213, 4081, 3942, 3797, 3648, 3494, 3338, 3180, 3021, 2862, 2704,
+  2548, 2394, 2243, 2096, 1953, 1815, 1682, 1554, 1432, 1316, 1206, 1102,
+  1005, 913, 828, 748, 674, 606, 543, 486, 433, 385, 341, 301,
+  266, 234, 205, 179, 156, 136, 118, 102, 88, 75, 65, 55,
+  4746, 4739, 4719, 4687, 4642, 4584, 4515, 4434, 4343, 4242, 4132, 4013,
+  3888, 3755, 3617, 3475, 3329, 3180, 3030, 2878, 2727, 2576, 2427, 2281,
+  2137, 1997, 1861, 1729, 1602, 1481, 1364, 1254, 1149, 1050, 957, 870,
+  788, 713, 642, 577, 517, 463, 412, 367, 325, 287, 253, 223,
+  195, 171, 149, 129, 112, 97, 84, 72, 62, 53, 4509, 4502,
+  4484, 4453, 4410, 4355, 4289, 4213, 4126, 4030, 3925, 3813, 3693, 3568,
+  3437, 3301, 3163, 3021, 2878, 2735, 2591, 2448, 2306, 2167, 2030, 1897,
+  1768, 1643, 1522, 1407, 1296, 1191, 1092, 998, 909, 826, 749, 677,
+  610, 548, 492, 439, 392, 348, 309, 273, 241, 211, 185, 162,
+  141, 123, 107, 92, 79, 68, 59, 50, 4271, 4266, 4248, 4219,
+  4178, 4126, 4064, 3991, 3909, 3818, 3719, 3612, 3499, 3380, 3256, 3128,
+  2996, 2862, 2727, 2591, 2455, 2319, 2185, 2053, 1924, 1797, 1675, 1556,
+  1442, 1333, 1228, 1129, 1034, 945, 861, 783, 710, 641, 578, 520,
+  466, 416, 371, 330, 292, 259, 228, 200, 176, 154, 134, 116,
+  101, 87, 75, 65, 55, 47, 4036, 4030, 4013, 3986, 3947, 3898,
+  3839, 3771, 3693, 3607, 3514, 3413, 3306, 3193, 3076, 2955, 2831, 2704,
+  2576, 2448, 2319, 2191, 2064, 1940, 1817, 1698, 1582, 1470, 1362, 1259,
+  1160, 1066, 977, 893, 814, 740, 670, 606, 546, 491, 440, 393,
+  351, 312, 276, 244, 215, 189, 166, 145, 127, 110, 95, 82,
+  71, 61, 52, 45, 3802, 3797, 3781, 3755, 3719, 3673, 3617, 3553,
+  3480, 3399, 3311, 3216, 3115, 3009, 2898, 2784, 2667, 2548, 2427, 2306,
+  2185, 2064, 1945, 1827, 1712, 1600, 1491, 1385, 1284, 1186, 1093, 1005,
+  921, 841, 767, 697, 632, 571, 515, 463, 415, 371, 330, 294,
+  260, 230, 203, 178, 156, 137, 119, 104, 90, 78, 67, 58,
+  49, 42, 3573, 3568, 3553, 3528, 3494, 3451, 3399, 3338, 3270, 3193,
+  3110, 3021, 2927, 2827, 2723, 2616, 2506, 2394, 2281, 2167, 2053, 1940,
+  1827, 1717, 1609, 1503, 1401, 1302, 1206, 1115, 1027, 944, 865, 791,
+  720, 655, 593, 536, 483, 435, 390, 348, 310, 276, 245, 216,
+  191, 168, 147, 128, 112, 97, 84, 73, 63, 54, 46, 40,
+  3347, 3343, 3329, 3306, 3274, 3233, 3185, 3128, 3063, 2992, 2914, 2831,
+  2742, 2649, 2552, 2451, 2348, 2243, 2137, 2030, 1924, 1817, 1712, 1609,
+  1507, 1409, 1312, 1220, 1130, 1044, 962, 884, 811, 741, 675, 614,
+  556, 503, 453, 407, 365, 326, 291, 259, 229, 203, 179, 157,
+  138, 120, 105, 91, 79, 68, 59, 51, 43, 37, 3128, 3123,
+  3110, 3089, 3059, 3021, 2976, 2923, 2862, 2796, 2723, 2645, 2562, 2475,
+  2384, 2290, 2194, 2096, 1997, 1897, 1797, 1698, 1600, 1503, 1409, 1316,
+  1226, 1140, 1056, 976, 899, 826, 757, 692, 631, 573, 520, 470,
+  423, 380, 341, 305, 272, 242, 214, 189, 167, 147, 129, 112,
+  98, 85, 74, 64, 55, 47, 41, 35, 2914, 2910, 2898, 2878,
+  2851, 2815, 2773, 2723, 2667, 2605, 2537, 2465, 2387, 2306, 2222, 2134,
+  2044, 1953, 1861, 1768, 1675, 1582, 1491, 1401, 1312, 1226, 1143, 1062,
+  984, 909, 838, 770, 706, 645, 588, 534, 484, 438, 394, 355,
+  318, 284, 253, 225, 200, 176, 156, 137, 120, 105, 91, 79,
+  69, 60, 51, 44, 38, 32, 2708, 2704, 2693, 2675, 2649, 2616,
+  2576, 2530, 2478, 2421, 2358, 2290, 2218, 2143, 2064, 1983, 1900, 1815,
+  1729, 1643, 1556, 1470, 1385, 1302, 1220, 1140, 1062, 987, 914, 845,
+  779, 716, 656, 599, 546, 496, 450, 407, 367, 329, 295, 264,
+  235, 209, 185, 164, 144, 127, 111, 97, 85, 74, 64, 55,
+  48, 41, 35, 30, 2510, 2506, 2496, 2478, 2455, 2424, 2387, 2345,
+  2297, 2243, 2185, 2122, 2056, 1986, 1913, 1838, 1760, 1682, 1602, 1522,
+  1442, 1362, 1284, 1206, 1130, 1056, 984, 914, 847, 783, 721, 663,
+  608, 555, 506, 460, 417, 377, 340, 305, 274, 245, 218, 194,
+  172, 152, 134, 118, 103, 90, 79, 68, 59, 51, 44, 38,
+  33, 28, 2319, 2316, 2306, 2290, 2268, 2240, 2206, 2167, 2122, 2073,
+  2019, 1961, 1900, 1835, 1768, 1698, 1627, 1554, 1481, 1407, 1333, 1259,
+  1186, 1115, 1044, 976, 909, 845, 783, 723, 667, 613, 562, 513,
+  468, 425, 385, 348, 314, 282, 253, 226, 201, 179, 159, 140,
+  124, 109, 95, 83, 73, 63, 55, 47, 41, 35, 30, 26,
+  2137, 2134, 2125, 2111, 2090, 2064, 2033, 1997, 1956, 1910, 1861, 1807,
+  1751, 1691, 1629, 1565, 1499, 1432, 1364, 1296, 1228, 1160, 1093, 1027,
+  962, 899, 838, 779, 721, 667, 614, 565, 517, 473, 431, 392,
+  355, 321, 289, 260, 233, 208, 186, 165, 146, 129, 114, 100,
+  88, 77, 67, 58, 51, 44, 38, 32, 28, 24, 1964, 1961,
+  1953, 1940, 1921, 1897, 1868, 1835, 1797, 1755, 1710, 1661, 1609, 1554,
+  1497, 1438, 1378, 1316, 1254, 1191, 1129, 1066, 1005, 944, 884, 826,
+  770, 716, 663, 613, 565, 519, 476, 435, 396, 360, 326, 295,
+  266, 239, 214, 191, 171, 152, 134, 119, 105, 92, 81, 71,
+  62, 54, 46, 40, 35, 30, 26, 22, 1800, 1797, 1790, 1778,
+  1760, 1739, 1712, 1682, 1647, 1609, 1567, 1522, 1474, 1424, 1372, 1318,
+  1263, 1206, 1149, 1092, 1034, 977, 921, 865, 811, 757, 706, 656,
+  608, 562, 517, 476, 436, 398, 363, 330, 299, 270, 244, 219,
+  196, 175, 156, 139, 123, 109, 96, 84, 74, 65, 56, 49,
+  43, 37, 32, 27, 23, 20, 1645, 1643, 1636, 1624, 1609, 1589,
+  1565, 1537, 1505, 1470, 1432, 1391, 1347, 1302, 1254, 1204, 1154, 1102,
+  1050, 998, 945, 893, 841, 791, 741, 692, 645, 599, 555, 513,
+  473, 435, 398, 364, 332, 301, 273, 247, 223, 200, 179, 160,
+  143, 127, 113, 100, 88, 77, 68, 59, 52, 45, 39, 34,
+  29, 25, 21, 18, 1499, 1497, 1491, 1481, 1466, 1448, 1426, 1401,
+  1372, 1340, 1305, 1268, 1228, 1186, 1143, 1098, 1052, 1005, 957, 909,
+  861, 814, 767, 720, 675, 631, 588, 546, 506, 468, 431, 396,
+  363, 332, 302, 275, 249, 225, 203, 182, 163, 146, 130, 116,
+  103, 91, 80, 70, 62, 54, 47, 41, 35, 31, 26, 23,
+  19, 17, 1362, 1361, 1355, 1346, 1333, 1316, 1296, 1273, 1247, 1218,
+  1186, 1152, 1116, 1078, 1039, 998, 956, 913, 870, 826, 783, 740,
+  697, 655, 614, 573, 534, 496, 460, 425, 392, 360, 330, 301,
+  275, 250, 226, 205, 184, 166, 149, 133, 118, 105, 93, 82,
+  73, 64, 56, 49, 43, 37, 32, 28, 24, 21, 18, 15,
+  1235, 1233, 1228, 1220, 1208, 1193, 1175, 1154, 1130, 1104, 1075, 1044,
+  1012, 977, 941, 904, 866, 828, 788, 749, 710, 670, 632, 593,
+  556, 520, 484, 450, 417, 385, 355, 326, 299, 273, 249, 226,
+  205, 185, 167, 150, 135, 120, 107, 95, 85, 75, 66, 58,
+  51, 44, 39, 34, 29, 25, 22, 19, 16, 14, 1116, 1115,
+  1110, 1102, 1092, 1078, 1062, 1043, 1021, 998, 972, 944, 914, 883,
+  851, 817, 783, 748, 713, 677, 641, 606, 571, 536, 503, 470,
+  438, 407, 377, 348, 321, 295, 270, 247, 225, 205, 185, 168,
+  151, 136, 122, 109, 97, 86, 76, 68, 60, 52, 46, 40,
+  35, 30, 26, 23, 20, 17, 14, 12, 1006, 1005, 1000, 994,
+  984, 972, 957, 940, 921, 899, 876, 851, 824, 796, 767, 737,
+  706, 674, 642, 610, 578, 546, 515, 483, 453, 423, 394, 367,
+  340, 314, 289, 266, 244, 223, 203, 184, 167, 151, 136, 122,
+  110, 98, 87, 78, 69, 61, 54, 47, 41, 36, 32, 27,
+  24, 21, 18, 15, 13, 11, 904, 903, 899, 893, 884, 873,
+  860, 845, 828, 808, 787, 765, 741, 716, 689, 662, 634, 606,
+  577, 548, 520, 491, 463, 435, 407, 380, 355, 329, 305, 282,
+  260, 239, 219, 200, 182, 166, 150, 136, 122, 110, 99, 88,
+  79, 70, 62, 55, 48, 42, 37, 33, 28, 25, 21, 18,
+  16, 14, 12, 10, 811, 809, 806, 800, 793, 783, 771, 757,
+  742, 724, 706, 685, 664, 641, 618, 593, 569, 543, 517, 492,
+  466, 440, 415, 390, 365, 341, 318, 295, 274, 253, 233, 214,
+  196, 179, 163, 149, 135, 122, 110, 99, 88, 79, 70, 63,
+  55, 49, 43, 38, 33, 29, 25, 22, 19, 17, 14, 12,
+  11, 9, 724, 723, 720, 716, 709, 700, 689, 677, 663, 648,
+  631, 613, 593, 573, 552, 531, 508, 486, 463, 439, 416, 393,
+  371, 348, 326, 305, 284, 264, 245, 226, 208, 191, 175, 160,
+  146, 133, 120, 109, 98, 88, 79, 71, 63, 56, 50, 44,
+  39, 34, 30, 26, 23, 20, 17, 15, 13, 11, 9, 8,
+  646, 645, 642, 638, 632, 624, 614, 603, 591, 577, 562, 546,
+  529, 511, 492, 473, 453, 433, 412, 392, 371, 351, 330, 310,
+  291, 272, 253, 235, 218, 201, 186, 171, 156, 143, 130, 118,
+  107, 97, 87, 79, 70, 63, 56, 50, 44, 39, 34, 30,
+  27, 23, 20, 18, 15, 13, 11, 10, 8, 7, 574, 573,
+  571, 567, 562, 555, 546, 536, 525, 513, 500, 486, 470, 454,
+  438, 420, 403, 385, 367, 348, 330, 312, 294, 276, 259, 242,
+  225, 209, 194, 179, 165, 152, 139, 127, 116, 105, 95, 86,
+  78, 70, 63, 56, 50, 44, 39, 35, 31, 27, 24, 21,
+  18, 16, 14, 12, 10, 9, 7, 6, 509, 508, 506, 503,
+  498, 492, 484, 476, 466, 455, 443, 430, 417, 403, 388, 373,
+  357, 341, 325, 309, 292, 276, 260, 245, 229, 214, 200, 185,
+  172, 159, 146, 134, 123, 113, 103, 93, 85, 76, 69, 62,
+  55, 50, 44, 39, 35, 31, 27, 24, 21, 18, 16, 14,
+  12, 10, 9, 8, 7, 6, 450, 449, 447, 444, 440, 435,
+  428, 420, 412, 402, 392, 380, 369, 356, 343, 329, 316, 301,
+  287, 273, 259, 244, 230, 216, 203, 189, 176, 164, 152, 140,
+  129, 119, 109, 100, 91, 82, 75, 68, 61, 55, 49, 44,
+  39, 35, 31, 27, 24, 21, 19, 16, 14, 12, 11, 9,
+  8, 7, 6, 5, 397, 396, 394, 392, 388, 383, 377, 371,
+  363, 355, 345, 335, 325, 314, 302, 290, 278, 266, 253, 241,
+  228, 215, 203, 191, 179, 167, 156, 144, 134, 124, 114, 105,
+  96, 88, 80, 73, 66, 60, 54, 48, 43, 39, 34, 31,
+  27, 24, 21, 19, 16, 14, 12, 11, 9, 8, 7, 6,
+  5, 4, 349, 348, 347, 344, 341, 337, 332, 326, 319, 312,
+  304, 295, 286, 276, 266, 255, 245, 234, 223, 211, 200, 189,
+  178, 168, 157, 147, 137, 127, 118, 109, 100, 92, 84, 77,
+  70, 64, 58, 52, 47, 42, 38, 34, 30, 27, 24, 21,
+  19, 16, 14, 13, 11, 10, 8, 7, 6, 5, 5, 4,
+  306, 305, 304, 302, 299, 295, 291, 286, 280, 273, 266, 259,
+  250, 242, 233, 224, 214, 205, 195, 185, 176, 166, 156, 147,
+  138, 129, 120, 111, 103, 95, 88, 81, 74, 68, 62, 56,
+  51, 46, 41, 37, 33, 30, 27, 24, 21, 19, 16, 14,
+  13, 11, 10, 8, 7, 6, 5, 5, 4, 3, 267, 267,
+  266, 264, 261, 258, 254, 250, 245, 239, 233, 226, 219, 211,
+  204, 196, 187, 179, 171, 162, 154, 145, 137, 128, 120, 112,
+  105, 97, 90, 83, 77, 71, 65, 59, 54, 49, 44, 40,
+  36, 33, 29, 26, 23, 21, 18, 16, 14, 13, 11, 10,
+  8, 7, 6, 5, 5, 4, 3, 3, 233, 233, 232, 230,
+  228, 225, 222, 218, 213, 208, 203, 197, 191, 184, 178, 171,
+  163, 156, 149, 141, 134, 127, 119, 112, 105, 98, 91, 85,
+  79, 73, 67, 62, 56, 52, 47, 43, 39, 35, 32, 28,
+  25, 23, 20, 18, 16, 14, 12, 11, 10, 8, 7, 6,
+  6, 5, 4, 4, 3, 3, 203, 202, 201, 200, 198, 196,
+  193, 189, 185, 181, 176, 171, 166, 160, 154, 148, 142, 136,
+  129, 123, 116, 110, 104, 97, 91, 85, 79, 74, 68, 63,
+  58, 54, 49, 45, 41, 37, 34, 30, 27, 25, 22, 20,
+  18, 16, 14, 12, 11, 10, 8, 7, 6, 6, 5, 4,
+  4, 3, 3, 2, 176, 175, 175, 173, 172, 170, 167, 164,
+  161, 157, 153, 149, 144, 139, 134, 129, 123, 118, 112, 107,
+  101, 95, 90, 84, 79, 74, 69, 64, 59, 55, 51, 46,
+  43, 39, 35, 32, 29, 26, 24, 21, 19, 17, 15, 14,
+  12, 11, 9, 8, 7, 6, 6, 5, 4, 4, 3, 3,
+  2, 2, 152, 152, 151, 150, 149, 147, 144, 142, 139, 136,
+  132, 128, 124, 120, 116, 111, 107, 102, 97, 92, 87, 82,
+  78, 73, 68, 64, 60, 55, 51, 47, 44, 40, 37, 34,
+  31, 28, 25, 23, 21, 18, 17, 15, 13, 12, 10, 9,
+  8, 7, 6, 5, 5, 4, 4, 3, 3, 2, 2, 2,
+  131, 131, 130, 129, 128, 127, 125, 122, 120, 117, 114, 111,
+  107, 104, 100, 96, 92, 88, 84, 79, 75, 71, 67, 63,
+  59, 55, 51, 48, 44, 41, 38, 35, 32, 29, 26, 24,
+  22, 20, 18, 16, 14, 13, 11, 10, 9, 8, 7, 6,
+  5, 5, 4, 4, 3, 3, 2, 2, 2, 1, 113, 112,
+  112, 111, 110, 109, 107, 105, 103, 101, 98, 95, 92, 89,
+  86, 82, 79, 75, 72, 68, 65, 61, 58, 54, 51, 47,
+  44, 41, 38, 35, 32, 30, 27, 25, 23, 21, 19, 17,
+  15, 14, 12, 11, 10, 9, 8, 7, 6, 5, 5, 4,
+  4, 3, 3, 2, 2, 2, 1, 1, 97, 96, 96, 95,
+  94, 93, 92, 90, 88, 86, 84, 82, 79, 76, 74, 71,
+  68, 65, 62, 59, 55, 52, 49, 46, 43, 41, 38, 35,
+  33, 30, 28, 26, 23, 21, 19, 18, 16, 14, 13, 12,
+  11, 9, 8, 7, 7, 6, 5, 5, 4, 3, 3, 3,
+  2, 2, 2, 1, 1, 1, 83, 82, 82, 82, 81, 80,
+  79, 77, 76, 74, 72, 70, 68, 65, 63, 60, 58, 55,
+  53, 50, 47, 45, 42, 40, 37, 35, 32, 30, 28, 26,
+  24, 22, 20, 18, 17, 15, 14, 12, 11, 10, 9, 8,
+  7, 6, 6, 5, 4, 4, 3, 3, 3, 2, 2, 2,
+  1, 1, 1, 1
+};
+static const int kern_row_fixed_19[] = {
+  3923, 4588, 5350, 6222, 7216, 8346, 9625, 11070, 12697, 14523, 16565, 18843,
+  21374, 24178, 27274, 30682, 34419, 38506, 42958, 47793, 53024, 58666, 64728, 71220,
+  78145, 85507, 93303, 101528, 110173, 119224, 128661, 138461, 148595, 159030, 169727, 180642,
+  191727, 202930, 214193, 225455, 236654, 247721, 258589, 269187, 279444, 289290, 298654, 307468,
+  315667, 323188, 329972, 335967, 341125, 345404, 348769, 351193, 352655, 353144, 352655, 351193,
+  348769, 345404, 341125, 335967, 329972, 323188, 315667, 307468, 298654, 289290, 279444, 269187,
+  258589, 247721, 236654, 225455, 214193, 202930, 191727, 180642, 169727, 159030, 148595, 138461,
+  128661, 119224, 110173, 101528, 93303, 85507, 78145, 71220, 64728, 58666, 53024, 47793,
+  42958, 38506, 34419, 30682, 27274, 24178, 21374, 18843, 16565, 14523, 12697, 11070,
+  9625, 8346, 7216, 6222, 5350, 4588, 3923
+};
+
+static const float kern_half_20[] = {
+  1.99471135e-02f, 1.99221950e-02f, 1.98476277e-02f, 1.97239667e-02f, 1.95521340e-02f, 1.93334054e-02f,
+  1.90693904e-02f, 1.87620167e-02f, 1.84135064e-02f, 1.80263482e-02f, 1.76032670e-02f, 1.71471927e-02f,
+  1.66612305e-02f, 1.61486175e-02f, 1.56126963e-02f, 1.50568718e-02f, 1.44845778e-02f, 1.38992444e-02f,
+  1.33042624e-02f, 1.27029531e-02f, 1.20985359e-02f, 1.14941066e-02f, 1.08926091e-02f, 1.02968132e-02f,
+  9.70930234e-03f, 9.13245417e-03f, 8.56842939e-03f, 8.01916607e-03f, 7.48637319e-03f, 6.97152829e-03f,
+  6.47587981e-03f, 6.00044988e-03f, 5.54604176e-03f, 5.11324639e-03f, 4.70245397e-03f, 4.31386614e-03f,
+  3.94750806e-03f, 3.60324373e-03f, 3.28079076e-03f, 2.97973538e-03f, 2.69954838e-03f, 2.43960088e-03f,
+  2.19917973e-03f, 1.97750214e-03f, 1.77372969e-03f, 1.58698263e-03f, 1.41635188e-03f, 1.26091100e-03f,
+  1.11972657e-03f, 9.91867739e-04f, 8.76414997e-04f, 7.72467349e-04f, 6.79148478e-04f, 5.95612160e-04f,
+  5.21046750e-04f, 4.54678113e-04f, 3.95772571e-04f, 3.43638327e-04f, 2.97626626e-04f, 2.57132051e-04f,
+  2.21592418e-04f, 1.99221950e-02f, 1.98973082e-02f, 1.98228341e-02f, 1.96993276e-02f, 1.95277091e-02f,
+  1.93092544e-02f, 1.90455690e-02f, 1.87385790e-02f, 1.83905046e-02f, 1.80038288e-02f, 1.75812766e-02f,
+  1.71257723e-02f, 1.66404173e-02f, 1.61284450e-02f, 1.55931925e-02f, 1.50380619e-02f, 1.44664831e-02f,
+  1.38818808e-02f, 1.32876430e-02f, 1.26870843e-02f, 1.20834224e-02f, 1.14797484e-02f, 1.08790016e-02f,
+  1.02839507e-02f, 9.69717372e-03f, 9.12104547e-03f, 8.55772570e-03f, 8.00914876e-03f, 7.47702131e-03f,
+  6.96281949e-03f, 6.46778988e-03f, 5.99295413e-03f, 5.53911366e-03f, 5.10685844e-03f, 4.69657965e-03f,
+  4.30847704e-03f, 3.94257670e-03f, 3.59874242e-03f, 3.27669224e-03f, 2.97601288e-03f, 2.69617606e-03f,
+  2.43655336e-03f, 2.19643256e-03f, 1.97503180e-03f, 1.77151384e-03f, 1.58500008e-03f, 1.41458260e-03f,
+  1.25933590e-03f, 1.11832772e-03f, 9.90628614e-04f, 8.75320169e-04f, 7.71502382e-04f, 6.78300043e-04f,
+  5.94868150e-04f, 5.20395814e-04f, 4.54110123e-04f, 3.95278184e-04f, 3.43209045e-04f, 2.97254825e-04f,
+  2.56810832e-04f, 2.21315597e-04f, 1.98476277e-02f, 1.98228341e-02f, 1.97486375e-02f, 1.96255930e-02f,
+  1.94546189e-02f, 1.92369800e-02f, 1.89742818e-02f, 1.86684411e-02f, 1.83216687e-02f, 1.79364420e-02f,
+  1.75154693e-02f, 1.70616712e-02f, 1.65781323e-02f, 1.60680767e-02f, 1.55348284e-02f, 1.49817755e-02f,
+  1.44123351e-02f, 1.38299214e-02f, 1.32379076e-02f, 1.26395961e-02f, 1.20381946e-02f, 1.14367800e-02f,
+  1.08382814e-02f, 1.02454582e-02f, 9.66087729e-03f, 9.08690598e-03f, 8.52569472e-03f, 7.97917042e-03f,
+  7.44903507e-03f, 6.93675783e-03f, 6.44358108e-03f, 5.97052276e-03f, 5.51838055e-03f, 5.08774398e-03f,
+  4.67900047e-03f, 4.29235026e-03f, 3.92781943e-03f, 3.58527247e-03f, 3.26442765e-03f, 2.96487380e-03f,
+  2.68608425e-03f, 2.42743338e-03f, 2.18821131e-03f, 1.96763920e-03f, 1.76488317e-03f, 1.57906744e-03f,
+  1.40928780e-03f, 1.25462213e-03f, 1.11414189e-03f, 9.86920786e-04f, 8.72043893e-04f, 7.68614642e-04f,
+  6.75761199e-04f, 5.92641532e-04f, 5.18448011e-04f, 4.52410401e-04f, 3.93798662e-04f, 3.41924431e-04f,
+  2.96142214e-04f, 2.55849591e-04f, 2.20487229e-04f, 1.97239667e-02f, 1.96993276e-02f, 1.96255930e-02f,
+  1.95033159e-02f, 1.93334054e-02f, 1.91171244e-02f, 1.88560616e-02f, 1.85521282e-02f, 1.82075165e-02f,
+  1.78246889e-02f, 1.74063388e-02f, 1.69553682e-02f, 1.64748412e-02f, 1.59679633e-02f, 1.54380379e-02f,
+  1.48884309e-02f, 1.43225389e-02f, 1.37437545e-02f, 1.31554287e-02f, 1.25608454e-02f, 1.19631905e-02f,
+  1.13655226e-02f, 1.07707540e-02f, 1.01816235e-02f, 9.60068498e-03f, 9.03028995e-03f, 8.47257487e-03f,
+  7.92945642e-03f, 7.40262354e-03f, 6.89353794e-03f, 6.40343456e-03f, 5.93332341e-03f, 5.48399845e-03f,
+  5.05604455e-03f, 4.64984775e-03f, 4.26560687e-03f, 3.90334730e-03f, 3.56293446e-03f, 3.24408873e-03f,
+  2.94640125e-03f, 2.66934861e-03f, 2.41230917e-03f, 2.17457768e-03f, 1.95537996e-03f, 1.75388705e-03f,
+  1.56922906e-03f, 1.40050717e-03f, 1.24680519e-03f, 1.10720017e-03f, 9.80771729e-04f, 8.66610615e-04f,
+  7.63825781e-04f, 6.71550864e-04f, 5.88949071e-04f, 5.15217835e-04f, 4.49591666e-04f, 3.91345093e-04f,
+  3.39794060e-04f, 2.94297090e-04f, 2.54255516e-04f, 2.19113470e-04f, 1.95521340e-02f, 1.95277091e-02f,
+  1.94546189e-02f, 1.93334054e-02f, 1.91649757e-02f, 1.89505778e-02f, 1.86917912e-02f, 1.83905046e-02f,
+  1.80488955e-02f, 1.76694021e-02f, 1.72546990e-02f, 1.68076549e-02f, 1.63313150e-02f, 1.58288535e-02f,
+  1.53035447e-02f, 1.47587257e-02f, 1.41977640e-02f, 1.36240209e-02f, 1.30408201e-02f, 1.24514177e-02f,
+  1.18589690e-02f, 1.12665081e-02f, 1.06769204e-02f, 1.00929225e-02f, 9.51704569e-03f, 8.95161927e-03f,
+  8.39876290e-03f, 7.86037650e-03f, 7.33813317e-03f, 6.83348300e-03f, 6.34764880e-03f, 5.88163314e-03f,
+  5.43622253e-03f, 5.01199719e-03f, 4.60933894e-03f, 4.22844570e-03f, 3.86934192e-03f, 3.53189465e-03f,
+  3.21582681e-03f, 2.92073260e-03f, 2.64609372e-03f, 2.39129364e-03f, 2.15563318e-03f, 1.93834491e-03f,
+  1.73860742e-03f, 1.55555818e-03f, 1.38830626e-03f, 1.23594329e-03f, 1.09755446e-03f, 9.72227426e-04f,
+  8.59060849e-04f, 7.57171481e-04f, 6.65700412e-04f, 5.83818241e-04f, 5.10729325e-04f, 4.45674901e-04f,
+  3.87935754e-04f, 3.36833851e-04f, 2.91733217e-04f, 2.52040481e-04f, 2.17204593e-04f, 1.93334054e-02f,
+  1.93092544e-02f, 1.92369800e-02f, 1.91171244e-02f, 1.89505778e-02f, 1.87385790e-02f, 1.84826870e-02f,
+  1.81847699e-02f, 1.78469829e-02f, 1.74717363e-02f, 1.70616712e-02f, 1.66196283e-02f, 1.61486175e-02f,
+  1.56517774e-02f, 1.51323443e-02f, 1.45936208e-02f, 1.40389344e-02f, 1.34716099e-02f, 1.28949331e-02f,
+  1.23121245e-02f, 1.17263030e-02f, 1.11404704e-02f, 1.05574783e-02f, 9.98001359e-03f, 9.41057876e-03f,
+  8.85147788e-03f, 8.30480643e-03f, 7.77244242e-03f, 7.25604175e-03f, 6.75703678e-03f, 6.27663778e-03f,
+  5.81583567e-03f, 5.37540810e-03f, 4.95592831e-03f, 4.55777440e-03f, 4.18114243e-03f, 3.82605591e-03f,
+  3.49238352e-03f, 3.17985145e-03f, 2.88805855e-03f, 2.61649187e-03f, 2.36454234e-03f, 2.13151821e-03f,
+  1.91666069e-03f, 1.71915768e-03f, 1.53815630e-03f, 1.37277530e-03f, 1.22211687e-03f, 1.08527613e-03f,
+  9.61351150e-04f, 8.49450589e-04f, 7.48701044e-04f, 6.58253266e-04f, 5.77287108e-04f, 5.05015836e-04f,
+  4.40689153e-04f, 3.83595936e-04f, 3.33065691e-04f, 2.88469600e-04f, 2.49220931e-04f, 2.14774744e-04f,
+  1.90693904e-02f, 1.90455690e-02f, 1.89742818e-02f, 1.88560616e-02f, 1.86917912e-02f, 1.84826870e-02f,
+  1.82302892e-02f, 1.79364420e-02f, 1.76032670e-02f, 1.72331426e-02f, 1.68286785e-02f, 1.63926724e-02f,
+  1.59280933e-02f, 1.54380379e-02f, 1.49256987e-02f, 1.43943317e-02f, 1.38472198e-02f, 1.32876430e-02f,
+  1.27188414e-02f, 1.21439910e-02f, 1.15661705e-02f, 1.09883370e-02f, 1.04133068e-02f, 9.84372757e-03f,
+  9.28206928e-03f, 8.73060338e-03f, 8.19139741e-03f, 7.66630284e-03f, 7.15695415e-03f, 6.66476367e-03f,
+  6.19092491e-03f, 5.73641527e-03f, 5.30200172e-03f, 4.88825049e-03f, 4.49553411e-03f, 4.12404491e-03f,
+  3.77380755e-03f, 3.44469189e-03f, 3.13642761e-03f, 2.84861936e-03f, 2.58076144e-03f, 2.33225245e-03f,
+  2.10241042e-03f, 1.89048704e-03f, 1.69568101e-03f, 1.51715137e-03f, 1.35402882e-03f, 1.20542769e-03f,
+  1.07045576e-03f, 9.48223053e-04f, 8.37850559e-04f, 7.38476869e-04f, 6.49264199e-04f, 5.69403754e-04f,
+  4.98119392e-04f, 4.34671150e-04f, 3.78357596e-04f, 3.28517373e-04f, 2.84530310e-04f, 2.45817588e-04f,
+  2.11841791e-04f, 1.87620167e-02f, 1.87385790e-02f, 1.86684411e-02f, 1.85521282e-02f, 1.83905046e-02f,
+  1.81847699e-02f, 1.79364420e-02f, 1.76473297e-02f, 1.73195247e-02f, 1.69553682e-02f, 1.65574215e-02f,
+  1.61284450e-02f, 1.56713538e-02f, 1.51891969e-02f, 1.46851158e-02f, 1.41623141e-02f, 1.36240209e-02f,
+  1.30734630e-02f, 1.25138303e-02f, 1.19482456e-02f, 1.13797383e-02f, 1.08112199e-02f, 1.02454582e-02f,
+  9.68506001e-03f, 9.13245417e-03f, 8.58987775e-03f, 8.05936288e-03f, 7.54273217e-03f, 7.04159355e-03f,
+  6.55733654e-03f, 6.09113509e-03f, 5.64395171e-03f, 5.21654077e-03f, 4.80945827e-03f, 4.42307210e-03f,
+  4.05757083e-03f, 3.71297891e-03f, 3.38916807e-03f, 3.08587262e-03f, 2.80270353e-03f, 2.53916299e-03f,
+  2.29465961e-03f, 2.06852215e-03f, 1.86001486e-03f, 1.66834891e-03f, 1.49269693e-03f, 1.33220362e-03f,
+  1.18599785e-03f, 1.05320138e-03f, 9.32938943e-04f, 8.24345509e-04f, 7.26573577e-04f, 6.38798927e-04f,
+  5.60225686e-04f, 4.90090344e-04f, 4.27664811e-04f, 3.72258975e-04f, 3.23222106e-04f, 2.79944041e-04f,
+  2.41855334e-04f, 2.08427184e-04f, 1.84135064e-02f, 1.83905046e-02f, 1.83216687e-02f, 1.82075165e-02f,
+  1.80488955e-02f, 1.78469829e-02f, 1.76032670e-02f, 1.73195247e-02f, 1.69978086e-02f, 1.66404173e-02f,
+  1.62498634e-02f, 1.58288535e-02f, 1.53802540e-02f, 1.49070537e-02f, 1.44123351e-02f, 1.38992444e-02f,
+  1.33709507e-02f, 1.28306197e-02f, 1.22813825e-02f, 1.17263030e-02f, 1.11683570e-02f, 1.06103979e-02f,
+  1.00551452e-02f, 9.50515643e-03f, 8.96281563e-03f, 8.43031798e-03f, 7.90965743e-03f, 7.40262354e-03f,
+  6.91079348e-03f, 6.43553166e-03f, 5.97799057e-03f, 5.53911366e-03f, 5.11964178e-03f, 4.72012116e-03f,
+  4.34091222e-03f, 3.98220029e-03f, 3.64400912e-03f, 3.32621322e-03f, 3.02855158e-03f, 2.75064236e-03f,
+  2.49199709e-03f, 2.25203554e-03f, 2.03009881e-03f, 1.82546454e-03f, 1.63735880e-03f, 1.46496959e-03f,
+  1.30745757e-03f, 1.16396754e-03f, 1.03363791e-03f, 9.15609300e-04f, 8.09033052e-04f, 7.13077257e-04f,
+  6.26933062e-04f, 5.49819320e-04f, 4.80986753e-04f, 4.19720804e-04f, 3.65344138e-04f, 3.17218160e-04f,
+  2.74744001e-04f, 2.37362794e-04f, 2.04555588e-04f, 1.80263482e-02f, 1.80038288e-02f, 1.79364420e-02f,
+  1.78246889e-02f, 1.76694021e-02f, 1.74717363e-02f, 1.72331426e-02f, 1.69553682e-02f, 1.66404173e-02f,
+  1.62905380e-02f, 1.59081966e-02f, 1.54960398e-02f, 1.50568718e-02f, 1.45936208e-02f, 1.41093042e-02f,
+  1.36070019e-02f, 1.30898152e-02f, 1.25608454e-02f, 1.20231565e-02f, 1.14797484e-02f, 1.09335324e-02f,
+  1.03873061e-02f, 9.84372757e-03f, 9.30530299e-03f, 8.77436530e-03f, 8.25306401e-03f, 7.74335070e-03f,
+  7.24697718e-03f, 6.76548854e-03f, 6.30021933e-03f, 5.85229835e-03f, 5.42264897e-03f, 5.01199719e-03f,
+  4.62087663e-03f, 4.24964074e-03f, 3.89847113e-03f, 3.56739084e-03f, 3.25627695e-03f, 2.96487380e-03f,
+  2.69280793e-03f, 2.43960088e-03f, 2.20468454e-03f, 1.98741443e-03f, 1.78708264e-03f, 1.60293200e-03f,
+  1.43416738e-03f, 1.27996725e-03f, 1.13949424e-03f, 1.01190479e-03f, 8.96357873e-04f, 7.92022445e-04f,
+  6.98084245e-04f, 6.13751297e-04f, 5.38258930e-04f, 4.70873638e-04f, 4.10895853e-04f, 3.57662473e-04f,
+  3.10548407e-04f, 2.68967298e-04f, 2.32372055e-04f, 2.00254639e-04f, 1.76032670e-02f, 1.75812766e-02f,
+  1.75154693e-02f, 1.74063388e-02f, 1.72546990e-02f, 1.70616712e-02f, 1.68286785e-02f, 1.65574215e-02f,
+  1.62498634e-02f, 1.59081966e-02f, 1.55348284e-02f, 1.51323443e-02f, 1.47034843e-02f, 1.42511055e-02f,
+  1.37781566e-02f, 1.32876430e-02f, 1.27825951e-02f, 1.22660398e-02f, 1.17409704e-02f, 1.12103168e-02f,
+  1.06769204e-02f, 1.01435138e-02f, 9.61269345e-03f, 9.08690598e-03f, 8.56842939e-03f, 8.05936288e-03f,
+  7.56161241e-03f, 7.07688928e-03f, 6.60670130e-03f, 6.15235232e-03f, 5.71494363e-03f, 5.29537862e-03f,
+  4.89436463e-03f, 4.51242412e-03f, 4.14990075e-03f, 3.80697334e-03f, 3.48366355e-03f, 3.17985145e-03f,
+  2.89528770e-03f, 2.62960722e-03f, 2.38234294e-03f, 2.15294026e-03f, 1.94076938e-03f, 1.74513948e-03f,
+  1.56531087e-03f, 1.40050717e-03f, 1.24992616e-03f, 1.11275003e-03f, 9.88155138e-04f, 8.75320169e-04f,
+  7.73433538e-04f, 6.81700069e-04f, 5.99346415e-04f, 5.25625888e-04f, 4.59822128e-04f, 4.01252037e-04f,
+  3.49268084e-04f, 3.03259760e-04f, 2.62654561e-04f, 2.26918230e-04f, 1.95554618e-04f, 1.71471927e-02f,
+  1.71257723e-02f, 1.70616712e-02f, 1.69553682e-02f, 1.68076549e-02f, 1.66196283e-02f, 1.63926724e-02f,
+  1.61284450e-02f, 1.58288535e-02f, 1.54960398e-02f, 1.51323443e-02f, 1.47402883e-02f, 1.43225389e-02f,
+  1.38818808e-02f, 1.34211853e-02f, 1.29433805e-02f, 1.24514177e-02f, 1.19482456e-02f, 1.14367800e-02f,
+  1.09198745e-02f, 1.04002981e-02f, 9.88071132e-03f, 9.36364383e-03f, 8.85147788e-03f, 8.34643468e-03f,
+  7.85055663e-03f, 7.36570265e-03f, 6.89353794e-03f, 6.43553166e-03f, 5.99295413e-03f, 5.56687824e-03f,
+  5.15818363e-03f, 4.76755900e-03f, 4.39551380e-03f, 4.04238328e-03f, 3.70834046e-03f, 3.39340721e-03f,
+  3.09746643e-03f, 2.82027526e-03f, 2.56147818e-03f, 2.32062023e-03f, 2.09716079e-03f, 1.89048704e-03f,
+  1.69992563e-03f, 1.52475608e-03f, 1.36422226e-03f, 1.21754245e-03f, 1.08392036e-03f, 9.62553604e-04f,
+  8.52641999e-04f, 7.53395085e-04f, 6.64038234e-04f, 5.83818241e-04f, 5.12007740e-04f, 4.47908853e-04f,
+  3.90856207e-04f, 3.40219063e-04f, 2.95402773e-04f, 2.55849591e-04f, 2.21039125e-04f, 1.90488106e-04f,
+  1.66612305e-02f, 1.66404173e-02f, 1.65781323e-02f, 1.64748412e-02f, 1.63313150e-02f, 1.61486175e-02f,
+  1.59280933e-02f, 1.56713538e-02f, 1.53802540e-02f, 1.50568718e-02f, 1.47034843e-02f, 1.43225389e-02f,
+  1.39166294e-02f, 1.34884594e-02f, 1.30408201e-02f, 1.25765568e-02f, 1.20985359e-02f, 1.16096251e-02f,
+  1.11126546e-02f, 1.06103979e-02f, 1.01055466e-02f, 9.60068498e-03f, 9.09827184e-03f, 8.60062148e-03f,
+  8.10989179e-03f, 7.62806693e-03f, 7.15695415e-03f, 6.69817068e-03f, 6.25314470e-03f, 5.82310976e-03f,
+  5.40910941e-03f, 5.01199719e-03f, 4.63244366e-03f, 4.27094242e-03f, 3.92781943e-03f, 3.60324373e-03f,
+  3.29723582e-03f, 3.00968206e-03f, 2.74034683e-03f, 2.48888414e-03f, 2.25485233e-03f, 2.03772588e-03f,
+  1.83690933e-03f, 1.65174855e-03f, 1.48154353e-03f, 1.32555934e-03f, 1.18303648e-03f, 1.05320138e-03f,
+  9.35274176e-04f, 8.28477554e-04f, 7.32043351e-04f, 6.45218999e-04f, 5.67272480e-04f, 4.97497094e-04f,
+  4.35214810e-04f, 3.79779085e-04f, 3.30577051e-04f, 2.87030853e-04f, 2.48598662e-04f, 2.14774744e-04f,
+  1.85089550e-04f, 1.61486175e-02f, 1.61284450e-02f, 1.60680767e-02f, 1.59679633e-02f, 1.58288535e-02f,
+  1.56517774e-02f, 1.54380379e-02f, 1.51891969e-02f, 1.49070537e-02f, 1.45936208e-02f, 1.42511055e-02f,
+  1.38818808e-02f, 1.34884594e-02f, 1.30734630e-02f, 1.26395961e-02f, 1.21896164e-02f, 1.17263030e-02f,
+  1.12524340e-02f, 1.07707540e-02f, 1.02839507e-02f, 9.79463197e-03f, 9.30530299e-03f, 8.81834701e-03f,
+  8.33600853e-03f, 7.86037650e-03f, 7.39337597e-03f, 6.93675783e-03f, 6.49208995e-03f, 6.06075535e-03f,
+  5.64395171e-03f, 5.24268858e-03f, 4.85779438e-03f, 4.48991824e-03f, 4.13953932e-03f, 3.80697334e-03f,
+  3.49238352e-03f, 3.19579057e-03f, 2.91708391e-03f, 2.65603513e-03f, 2.41230917e-03f, 2.18547788e-03f,
+  1.97503180e-03f, 1.78039365e-03f, 1.60092965e-03f, 1.43596123e-03f, 1.28477614e-03f, 1.14663830e-03f,
+  1.02079776e-03f, 9.06498812e-04f, 8.02988012e-04f, 7.09520769e-04f, 6.25367684e-04f, 5.49819320e-04f,
+  4.82190721e-04f, 4.21824661e-04f, 3.68094508e-04f, 3.20406252e-04f, 2.78199848e-04f, 2.40950074e-04f,
+  2.08166821e-04f, 1.79394934e-04f, 1.56126963e-02f, 1.55931925e-02f, 1.55348284e-02f, 1.54380379e-02f,
+  1.53035447e-02f, 1.51323443e-02f, 1.49256987e-02f, 1.46851158e-02f, 1.44123351e-02f, 1.41093042e-02f,
+  1.37781566e-02f, 1.34211853e-02f, 1.30408201e-02f, 1.26395961e-02f, 1.22201284e-02f, 1.17850816e-02f,
+  1.13371443e-02f, 1.08790016e-02f, 1.04133068e-02f, 9.94265918e-03f, 9.46957897e-03f, 8.99648946e-03f,
+  8.52569472e-03f, 8.05936288e-03f, 7.59951537e-03f, 7.14801345e-03f, 6.70654885e-03f, 6.27663778e-03f,
+  5.85961854e-03f, 5.45664690e-03f, 5.06870029e-03f, 4.69657965e-03f, 4.34091222e-03f, 4.00216086e-03f,
+  3.68063198e-03f, 3.37648252e-03f, 3.08973226e-03f, 2.82027526e-03f, 2.56788987e-03f, 2.33225245e-03f,
+  2.11294880e-03f, 1.90948672e-03f, 1.72130798e-03f, 1.54779979e-03f, 1.38830626e-03f, 1.24213845e-03f,
+  1.10858504e-03f, 9.86920786e-04f, 8.76414997e-04f, 7.76339381e-04f, 6.85974024e-04f, 6.04613684e-04f,
+  5.31572558e-04f, 4.66188358e-04f, 4.07825661e-04f, 3.55878641e-04f, 3.09772993e-04f, 2.68967298e-04f,
+  2.32953709e-04f, 2.01258415e-04f, 1.73441396e-04f, 1.50568718e-02f, 1.50380619e-02f, 1.49817755e-02f,
+  1.48884309e-02f, 1.47587257e-02f, 1.45936208e-02f, 1.43943317e-02f, 1.41623141e-02f, 1.38992444e-02f,
+  1.36070019e-02f, 1.32876430e-02f, 1.29433805e-02f, 1.25765568e-02f, 1.21896164e-02f, 1.17850816e-02f,
+  1.13655226e-02f, 1.09335324e-02f, 1.04916999e-02f, 1.00425845e-02f, 9.58869141e-03f, 9.13245417e-03f,
+  8.67620762e-03f, 8.22217297e-03f, 7.77244242e-03f, 7.32896617e-03f, 6.89353794e-03f, 6.46778988e-03f,
+  6.05318416e-03f, 5.65101113e-03f, 5.26238559e-03f, 4.88825049e-03f, 4.52937745e-03f, 4.18637181e-03f,
+  3.85968084e-03f, 3.54959839e-03f, 3.25627695e-03f, 2.97973538e-03f, 2.71987100e-03f, 2.47647078e-03f,
+  2.24922225e-03f, 2.03772588e-03f, 1.84150739e-03f, 1.66002801e-03f, 1.49269693e-03f, 1.33888132e-03f,
+  1.19791727e-03f, 1.06911850e-03f, 9.51785536e-04f, 8.45213945e-04f, 7.48701044e-04f, 6.61552767e-04f,
+  5.83088957e-04f, 5.12648141e-04f, 4.49591666e-04f, 3.93306720e-04f, 3.43209045e-04f, 2.98744824e-04f,
+  2.59391818e-04f, 2.24660354e-04f, 1.94093445e-04f, 1.67266728e-04f, 1.44845778e-02f, 1.44664831e-02f,
+  1.44123351e-02f, 1.43225389e-02f, 1.41977640e-02f, 1.40389344e-02f, 1.38472198e-02f, 1.36240209e-02f,
+  1.33709507e-02f, 1.30898152e-02f, 1.27825951e-02f, 1.24514177e-02f, 1.20985359e-02f, 1.17263030e-02f,
+  1.13371443e-02f, 1.09335324e-02f, 1.05179623e-02f, 1.00929225e-02f, 9.66087729e-03f, 9.22423694e-03f,
+  8.78534000e-03f, 8.34643468e-03f, 7.90965743e-03f, 7.47702131e-03f, 7.05040107e-03f, 6.63152291e-03f,
+  6.22195704e-03f, 5.82310976e-03f, 5.43622253e-03f, 5.06236870e-03f, 4.70245397e-03f, 4.35722107e-03f,
+  4.02725302e-03f, 3.71297891e-03f, 3.41468235e-03f, 3.13250953e-03f, 2.86647910e-03f, 2.61649187e-03f,
+  2.38234294e-03f, 2.16373196e-03f, 1.96027453e-03f, 1.77151384e-03f, 1.59693230e-03f, 1.43596123e-03f,
+  1.28799211e-03f, 1.15238584e-03f, 1.02848257e-03f, 9.15609300e-04f, 8.13088322e-04f, 7.20243785e-04f,
+  6.36407931e-04f, 5.60926448e-04f, 4.93163010e-04f, 4.32503206e-04f, 3.78357596e-04f, 3.30164097e-04f,
+  2.87389877e-04f, 2.49532633e-04f, 2.16121291e-04f, 1.86716192e-04f, 1.60909127e-04f, 1.38992444e-02f,
+  1.38818808e-02f, 1.38299214e-02f, 1.37437545e-02f, 1.36240209e-02f, 1.34716099e-02f, 1.32876430e-02f,
+  1.30734630e-02f, 1.28306197e-02f, 1.25608454e-02f, 1.22660398e-02f, 1.19482456e-02f, 1.16096251e-02f,
+  1.12524340e-02f, 1.08790016e-02f, 1.04916999e-02f, 1.00929225e-02f, 9.68506001e-03f, 9.27047338e-03f,
+  8.85147788e-03f, 8.43031798e-03f, 8.00914876e-03f, 7.59002194e-03f, 7.17486860e-03f, 6.76548854e-03f,
+  6.36353763e-03f, 5.97052276e-03f, 5.58779342e-03f, 5.21654077e-03f, 4.85779438e-03f, 4.51242412e-03f,
+  4.18114243e-03f, 3.86450836e-03f, 3.56293446e-03f, 3.27669224e-03f, 3.00592231e-03f, 2.75064236e-03f,
+  2.51075742e-03f, 2.28607072e-03f, 2.07629381e-03f, 1.88105821e-03f, 1.69992563e-03f, 1.53239898e-03f,
+  1.37793284e-03f, 1.23594329e-03f, 1.10581703e-03f, 9.86920786e-04f, 8.78608786e-04f, 7.80230795e-04f,
+  6.91138150e-04f, 6.10690156e-04f, 5.38258930e-04f, 4.73233900e-04f, 4.15025424e-04f, 3.63067869e-04f,
+  3.16821883e-04f, 2.75776227e-04f, 2.39448826e-04f, 2.07387653e-04f, 1.79170835e-04f, 1.54406662e-04f,
+  1.33042624e-02f, 1.32876430e-02f, 1.32379076e-02f, 1.31554287e-02f, 1.30408201e-02f, 1.28949331e-02f,
+  1.27188414e-02f, 1.25138303e-02f, 1.22813825e-02f, 1.20231565e-02f, 1.17409704e-02f, 1.14367800e-02f,
+  1.11126546e-02f, 1.07707540e-02f, 1.04133068e-02f, 1.00425845e-02f, 9.66087729e-03f, 9.27047338e-03f,
+  8.87363497e-03f, 8.47257487e-03f, 8.06944352e-03f, 7.66630284e-03f, 7.26511749e-03f, 6.86773565e-03f,
+  6.47587981e-03f, 6.09113509e-03f, 5.71494363e-03f, 5.34859812e-03f, 4.99323756e-03f, 4.64984775e-03f,
+  4.31926176e-03f, 4.00216086e-03f, 3.69908125e-03f, 3.41041666e-03f, 3.13642761e-03f, 2.87724845e-03f,
+  2.63289618e-03f, 2.40328000e-03f, 2.18821131e-03f, 1.98741443e-03f, 1.80053618e-03f, 1.62715721e-03f,
+  1.46680197e-03f, 1.31894799e-03f, 1.18303648e-03f, 1.05848059e-03f, 9.44673840e-04f, 8.40998371e-04f,
+  7.46831647e-04f, 6.61552767e-04f, 5.84548514e-04f, 5.15217835e-04f, 4.52976266e-04f, 3.97259515e-04f,
+  3.47526104e-04f, 3.03259760e-04f, 2.63971131e-04f, 2.29198806e-04f, 1.98510053e-04f, 1.71501117e-04f,
+  1.47797007e-04f, 1.27029531e-02f, 1.26870843e-02f, 1.26395961e-02f, 1.25608454e-02f, 1.24514177e-02f,
+  1.23121245e-02f, 1.21439910e-02f, 1.19482456e-02f, 1.17263030e-02f, 1.14797484e-02f, 1.12103168e-02f,
+  1.09198745e-02f, 1.06103979e-02f, 1.02839507e-02f, 9.94265918e-03f, 9.58869141e-03f, 9.22423694e-03f,
+  8.85147788e-03f, 8.47257487e-03f, 8.08964204e-03f, 7.70473015e-03f, 7.31981080e-03f, 6.93675783e-03f,
+  6.55733654e-03f, 6.18319074e-03f, 5.81583567e-03f, 5.45664690e-03f, 5.10685844e-03f, 4.76755900e-03f,
+  4.43968968e-03f, 4.12404491e-03f, 3.82127636e-03f, 3.53189465e-03f, 3.25627695e-03f, 2.99467123e-03f,
+  2.74720625e-03f, 2.51389784e-03f, 2.29465961e-03f, 2.08931137e-03f, 1.89758965e-03f, 1.71915768e-03f,
+  1.55361497e-03f, 1.40050717e-03f, 1.25933590e-03f, 1.12956716e-03f, 1.01064064e-03f, 9.01977648e-04f,
+  8.02988012e-04f, 7.13077257e-04f, 6.31652714e-04f, 5.58128813e-04f, 4.91931627e-04f, 4.32503206e-04f,
+  3.79304664e-04f, 3.31819028e-04f, 2.89553398e-04f, 2.52040481e-04f, 2.18839748e-04f, 1.89538041e-04f,
+  1.63749821e-04f, 1.41117052e-04f, 1.20985359e-02f, 1.20834224e-02f, 1.20381946e-02f, 1.19631905e-02f,
+  1.18589690e-02f, 1.17263030e-02f, 1.15661705e-02f, 1.13797383e-02f, 1.11683570e-02f, 1.09335324e-02f,
+  1.06769204e-02f, 1.04002981e-02f, 1.01055466e-02f, 9.79463197e-03f, 9.46957897e-03f, 9.13245417e-03f,
+  8.78534000e-03f, 8.43031798e-03f, 8.06944352e-03f, 7.70473015e-03f, 7.33813317e-03f, 6.97152829e-03f,
+  6.60670130e-03f, 6.24533324e-03f, 5.88898966e-03f, 5.53911366e-03f, 5.19701513e-03f, 4.86387033e-03f,
+  4.54071490e-03f, 4.22844570e-03f, 3.92781943e-03f, 3.63945682e-03f, 3.36384424e-03f, 3.10134050e-03f,
+  2.85218237e-03f, 2.61649187e-03f, 2.39428459e-03f, 2.18547788e-03f, 1.98990013e-03f, 1.80730084e-03f,
+  1.63735880e-03f, 1.47969276e-03f, 1.33386999e-03f, 1.19941565e-03f, 1.07582146e-03f, 9.62553604e-04f,
+  8.59060849e-04f, 7.64781202e-04f, 6.79148478e-04f, 6.01598178e-04f, 5.31572558e-04f, 4.68525133e-04f,
+  4.11924353e-04f, 3.61257058e-04f, 3.16030812e-04f, 2.75776227e-04f, 2.40048204e-04f, 2.08427184e-04f,
+  1.80519666e-04f, 1.55958463e-04f, 1.34402595e-04f, 1.14941066e-02f, 1.14797484e-02f, 1.14367800e-02f,
+  1.13655226e-02f, 1.12665081e-02f, 1.11404704e-02f, 1.09883370e-02f, 1.08112199e-02f, 1.06103979e-02f,
+  1.03873061e-02f, 1.01435138e-02f, 9.88071132e-03f, 9.60068498e-03f, 9.30530299e-03f, 8.99648946e-03f,
+  8.67620762e-03f, 8.34643468e-03f, 8.00914876e-03f, 7.66630284e-03f, 7.31981080e-03f, 6.97152829e-03f,
+  6.62323879e-03f, 6.27663778e-03f, 5.93332341e-03f, 5.59478253e-03f, 5.26238559e-03f, 4.93737822e-03f,
+  4.62087663e-03f, 4.31386614e-03f, 4.01719753e-03f, 3.73159023e-03f, 3.45763378e-03f, 3.19579057e-03f,
+  2.94640125e-03f, 2.70969071e-03f, 2.48577492e-03f, 2.27466878e-03f, 2.07629381e-03f, 1.89048704e-03f,
+  1.71701016e-03f, 1.55555818e-03f, 1.40576903e-03f, 1.26723130e-03f, 1.13949424e-03f, 1.02207460e-03f,
+  9.14465520e-04f, 8.16143118e-04f, 7.26573577e-04f, 6.45218999e-04f, 5.71543002e-04f, 5.05015836e-04f,
+  4.45118145e-04f, 3.91345093e-04f, 3.43209045e-04f, 3.00242275e-04f, 2.61998764e-04f, 2.28055666e-04f,
+  1.98014401e-04f, 1.71501117e-04f, 1.48166961e-04f, 1.27687992e-04f, 1.08926091e-02f, 1.08790016e-02f,
+  1.08382814e-02f, 1.07707540e-02f, 1.06769204e-02f, 1.05574783e-02f, 1.04133068e-02f, 1.02454582e-02f,
+  1.00551452e-02f, 9.84372757e-03f, 9.61269345e-03f, 9.36364383e-03f, 9.09827184e-03f, 8.81834701e-03f,
+  8.52569472e-03f, 8.22217297e-03f, 7.90965743e-03f, 7.59002194e-03f, 7.26511749e-03f, 6.93675783e-03f,
+  6.60670130e-03f, 6.27663778e-03f, 5.94817521e-03f, 5.62282652e-03f, 5.30200172e-03f, 4.98699956e-03f,
+  4.67900047e-03f, 4.37906152e-03f, 4.08811681e-03f, 3.80697334e-03f, 3.53631238e-03f, 3.27669224e-03f,
+  3.02855158e-03f, 2.79221311e-03f, 2.56788987e-03f, 2.35569198e-03f, 2.15563318e-03f, 1.96763920e-03f,
+  1.79155590e-03f, 1.62715721e-03f, 1.47415430e-03f, 1.33220362e-03f, 1.20091590e-03f, 1.07986329e-03f,
+  9.68588400e-04f, 8.66610615e-04f, 7.73433538e-04f, 6.88551227e-04f, 6.11454016e-04f, 5.41633577e-04f,
+  4.78587841e-04f, 4.21824661e-04f, 3.70865600e-04f, 3.25248577e-04f, 2.84530310e-04f, 2.48288095e-04f,
+  2.16121291e-04f, 1.87652113e-04f, 1.62526281e-04f, 1.40413234e-04f, 1.21005956e-04f, 1.02968132e-02f,
+  1.02839507e-02f, 1.02454582e-02f, 1.01816235e-02f, 1.00929225e-02f, 9.98001359e-03f, 9.84372757e-03f,
+  9.68506001e-03f, 9.50515643e-03f, 9.30530299e-03f, 9.08690598e-03f, 8.85147788e-03f, 8.60062148e-03f,
+  8.33600853e-03f, 8.05936288e-03f, 7.77244242e-03f, 7.47702131e-03f, 7.17486860e-03f, 6.86773565e-03f,
+  6.55733654e-03f, 6.24533324e-03f, 5.93332341e-03f, 5.62282652e-03f, 5.31527353e-03f, 5.01199719e-03f,
+  4.71422449e-03f, 4.42307210e-03f, 4.13953932e-03f, 3.86450836e-03f, 3.59874242e-03f, 3.34288599e-03f,
+  3.09746643e-03f, 2.86289817e-03f, 2.63948669e-03f, 2.42743338e-03f, 2.22684210e-03f, 2.03772588e-03f,
+  1.86001486e-03f, 1.69356284e-03f, 1.53815630e-03f, 1.39352214e-03f, 1.25933590e-03f, 1.13522913e-03f,
+  1.02079776e-03f, 9.15609300e-04f, 8.19209439e-04f, 7.31128908e-04f, 6.50889415e-04f, 5.78009174e-04f,
+  5.12007740e-04f, 4.52410401e-04f, 3.98752047e-04f, 3.50580289e-04f, 3.07458395e-04f, 2.68967298e-04f,
+  2.34707433e-04f, 2.04300057e-04f, 1.77388065e-04f, 1.53636545e-04f, 1.32733025e-04f, 1.14387265e-04f,
+  9.70930234e-03f, 9.69717372e-03f, 9.66087729e-03f, 9.60068498e-03f, 9.51704569e-03f, 9.41057876e-03f,
+  9.28206928e-03f, 9.13245417e-03f, 8.96281563e-03f, 8.77436530e-03f, 8.56842939e-03f, 8.34643468e-03f,
+  8.10989179e-03f, 7.86037650e-03f, 7.59951537e-03f, 7.32896617e-03f, 7.05040107e-03f, 6.76548854e-03f,
+  6.47587981e-03f, 6.18319074e-03f, 5.88898966e-03f, 5.59478253e-03f, 5.30200172e-03f, 5.01199719e-03f,
+  4.72602481e-03f, 4.44524270e-03f, 4.17070230e-03f, 3.90334730e-03f, 3.64400912e-03f, 3.39340721e-03f,
+  3.15214903e-03f, 2.92073260e-03f, 2.69954838e-03f, 2.48888414e-03f, 2.28893012e-03f, 2.09978409e-03f,
+  1.92145840e-03f, 1.75388705e-03f, 1.59693230e-03f, 1.45039288e-03f, 1.31401129e-03f, 1.18748122e-03f,
+  1.07045576e-03f, 9.62553604e-04f, 8.63366877e-04f, 7.72467349e-04f, 6.89412467e-04f, 6.13751297e-04f,
+  5.45029412e-04f, 4.82793839e-04f, 4.26596991e-04f, 3.76000215e-04f, 3.30577051e-04f, 2.89915566e-04f,
+  2.53620674e-04f, 2.21315597e-04f, 1.92643201e-04f, 1.67266728e-04f, 1.44870428e-04f, 1.25159597e-04f,
+  1.07860607e-04f, 9.13245417e-03f, 9.12104547e-03f, 9.08690598e-03f, 9.03028995e-03f, 8.95161927e-03f,
+  8.85147788e-03f, 8.73060338e-03f, 8.58987775e-03f, 8.43031798e-03f, 8.25306401e-03f, 8.05936288e-03f,
+  7.85055663e-03f, 7.62806693e-03f, 7.39337597e-03f, 7.14801345e-03f, 6.89353794e-03f, 6.63152291e-03f,
+  6.36353763e-03f, 6.09113509e-03f, 5.81583567e-03f, 5.53911366e-03f, 5.26238559e-03f, 4.98699956e-03f,
+  4.71422449e-03f, 4.44524270e-03f, 4.18114243e-03f, 3.92291276e-03f, 3.67144193e-03f, 3.42751155e-03f,
+  3.19179823e-03f, 2.96487380e-03f, 2.74720625e-03f, 2.53916299e-03f, 2.34101480e-03f, 2.15294026e-03f,
+  1.97503180e-03f, 1.80730084e-03f, 1.64968520e-03f, 1.50205544e-03f, 1.36422226e-03f, 1.23594329e-03f,
+  1.11693074e-03f, 1.00685784e-03f, 9.05366440e-04f, 8.12072598e-04f, 7.26573577e-04f, 6.48453133e-04f,
+  5.77287108e-04f, 5.12648141e-04f, 4.54110123e-04f, 4.01252037e-04f, 3.53661337e-04f, 3.10936826e-04f,
+  2.72691133e-04f, 2.38552588e-04f, 2.08166821e-04f, 1.81197887e-04f, 1.57329094e-04f, 1.36263392e-04f,
+  1.17723626e-04f, 1.01452402e-04f, 8.56842939e-03f, 8.55772570e-03f, 8.52569472e-03f, 8.47257487e-03f,
+  8.39876290e-03f, 8.30480643e-03f, 8.19139741e-03f, 8.05936288e-03f, 7.90965743e-03f, 7.74335070e-03f,
+  7.56161241e-03f, 7.36570265e-03f, 7.15695415e-03f, 6.93675783e-03f, 6.70654885e-03f, 6.46778988e-03f,
+  6.22195704e-03f, 5.97052276e-03f, 5.71494363e-03f, 5.45664690e-03f, 5.19701513e-03f, 4.93737822e-03f,
+  4.67900047e-03f, 4.42307210e-03f, 4.17070230e-03f, 3.92291276e-03f, 3.68063198e-03f, 3.44469189e-03f,
+  3.21582681e-03f, 2.99467123e-03f, 2.78176181e-03f, 2.57753744e-03f, 2.38234294e-03f, 2.19643256e-03f,
+  2.01997370e-03f, 1.85305288e-03f, 1.69568101e-03f, 1.54779979e-03f, 1.40928780e-03f, 1.27996725e-03f,
+  1.15961081e-03f, 1.04794849e-03f, 9.44673840e-04f, 8.49450589e-04f, 7.61918607e-04f, 6.81700069e-04f,
+  6.08404400e-04f, 5.41633577e-04f, 4.80986753e-04f, 4.26064071e-04f, 3.76470533e-04f, 3.31819028e-04f,
+  2.91733217e-04f, 2.55849591e-04f, 2.23819457e-04f, 1.95310335e-04f, 1.70007028e-04f, 1.47612373e-04f,
+  1.27847699e-04f, 1.10452966e-04f, 9.51866532e-05f, 8.01916607e-03f, 8.00914876e-03f, 7.97917042e-03f,
+  7.92945642e-03f, 7.86037650e-03f, 7.77244242e-03f, 7.66630284e-03f, 7.54273217e-03f, 7.40262354e-03f,
+  7.24697718e-03f, 7.07688928e-03f, 6.89353794e-03f, 6.69817068e-03f, 6.49208995e-03f, 6.27663778e-03f,
+  6.05318416e-03f, 5.82310976e-03f, 5.58779342e-03f, 5.34859812e-03f, 5.10685844e-03f, 4.86387033e-03f,
+  4.62087663e-03f, 4.37906152e-03f, 4.13953932e-03f, 3.90334730e-03f, 3.67144193e-03f, 3.44469189e-03f,
+  3.22387647e-03f, 3.00968206e-03f, 2.80270353e-03f, 2.60344218e-03f, 2.41230917e-03f, 2.22962745e-03f,
+  2.05563428e-03f, 1.89048704e-03f, 1.73426641e-03f, 1.58698263e-03f, 1.44858100e-03f, 1.31894799e-03f,
+  1.19791727e-03f, 1.08527613e-03f, 9.80771729e-04f, 8.84117326e-04f, 7.94998137e-04f, 7.13077257e-04f,
+  6.38000958e-04f, 5.69403754e-04f, 5.06913173e-04f, 4.50154010e-04f, 3.98752047e-04f, 3.52337578e-04f,
+  3.10548407e-04f, 2.73032201e-04f, 2.39448826e-04f, 2.09471938e-04f, 1.82790332e-04f, 1.59109040e-04f,
+  1.38149961e-04f, 1.19652264e-04f, 1.03372578e-04f, 8.90848896e-05f, 7.48637319e-03f, 7.47702131e-03f,
+  7.44903507e-03f, 7.40262354e-03f, 7.33813317e-03f, 7.25604175e-03f, 7.15695415e-03f, 7.04159355e-03f,
+  6.91079348e-03f, 6.76548854e-03f, 6.60670130e-03f, 6.43553166e-03f, 6.25314470e-03f, 6.06075535e-03f,
+  5.85961854e-03f, 5.65101113e-03f, 5.43622253e-03f, 5.21654077e-03f, 4.99323756e-03f, 4.76755900e-03f,
+  4.54071490e-03f, 4.31386614e-03f, 4.08811681e-03f, 3.86450836e-03f, 3.64400912e-03f, 3.42751155e-03f,
+  3.21582681e-03f, 3.00968206e-03f, 2.80971895e-03f, 2.61649187e-03f, 2.43046950e-03f, 2.25203554e-03f,
+  2.08149105e-03f, 1.91905804e-03f, 1.76488317e-03f, 1.61904178e-03f, 1.48154353e-03f, 1.35233731e-03f,
+  1.23131718e-03f, 1.11832772e-03f, 1.01317046e-03f, 9.15609300e-04f, 8.25376599e-04f, 7.42178468e-04f,
+  6.65700412e-04f, 5.95612160e-04f, 5.31572558e-04f, 4.73233900e-04f, 4.20245779e-04f, 3.72258975e-04f,
+  3.28928290e-04f, 2.89915566e-04f, 2.54891958e-04f, 2.23539857e-04f, 1.95554618e-04f, 1.70645741e-04f,
+  1.48537845e-04f, 1.28971282e-04f, 1.11702575e-04f, 9.65045110e-05f, 8.31660946e-05f, 6.97152829e-03f,
+  6.96281949e-03f, 6.93675783e-03f, 6.89353794e-03f, 6.83348300e-03f, 6.75703678e-03f, 6.66476367e-03f,
+  6.55733654e-03f, 6.43553166e-03f, 6.30021933e-03f, 6.15235232e-03f, 5.99295413e-03f, 5.82310976e-03f,
+  5.64395171e-03f, 5.45664690e-03f, 5.26238559e-03f, 5.06236870e-03f, 4.85779438e-03f, 4.64984775e-03f,
+  4.43968968e-03f, 4.22844570e-03f, 4.01719753e-03f, 3.80697334e-03f, 3.59874242e-03f, 3.39340721e-03f,
+  3.19179823e-03f, 2.99467123e-03f, 2.80270353e-03f, 2.61649187e-03f, 2.43655336e-03f, 2.26332387e-03f,
+  2.09716079e-03f, 1.93834491e-03f, 1.78708264e-03f, 1.64351042e-03f, 1.50769879e-03f, 1.37965637e-03f,
+  1.25933590e-03f, 1.14663830e-03f, 1.04141922e-03f, 9.43493738e-04f, 8.52641999e-04f, 7.68614642e-04f,
+  6.91138150e-04f, 6.19919563e-04f, 5.54651371e-04f, 4.95015818e-04f, 4.40689153e-04f, 3.91345093e-04f,
+  3.46658373e-04f, 3.06307571e-04f, 2.69977812e-04f, 2.37362794e-04f, 2.08166821e-04f, 1.82106145e-04f,
+  1.58910276e-04f, 1.38322750e-04f, 1.20101802e-04f, 1.04020684e-04f, 8.98678045e-05f, 7.74466826e-05f,
+  6.47587981e-03f, 6.46778988e-03f, 6.44358108e-03f, 6.40343456e-03f, 6.34764880e-03f, 6.27663778e-03f,
+  6.19092491e-03f, 6.09113509e-03f, 5.97799057e-03f, 5.85229835e-03f, 5.71494363e-03f, 5.56687824e-03f,
+  5.40910941e-03f, 5.24268858e-03f, 5.06870029e-03f, 4.88825049e-03f, 4.70245397e-03f, 4.51242412e-03f,
+  4.31926176e-03f, 4.12404491e-03f, 3.92781943e-03f, 3.73159023e-03f, 3.53631238e-03f, 3.34288599e-03f,
+  3.15214903e-03f, 2.96487380e-03f, 2.78176181e-03f, 2.60344218e-03f, 2.43046950e-03f, 2.26332387e-03f,
+  2.10241042e-03f, 1.94806093e-03f, 1.80053618e-03f, 1.66002801e-03f, 1.52666320e-03f, 1.40050717e-03f,
+  1.28156820e-03f, 1.16980192e-03f, 1.06511684e-03f, 9.67378437e-04f, 8.76414997e-04f, 7.92022445e-04f,
+  7.13969173e-04f, 6.42000930e-04f, 5.75845712e-04f, 5.15217835e-04f, 4.59822128e-04f, 4.09357861e-04f,
+  3.63521976e-04f, 3.22012289e-04f, 2.84530310e-04f, 2.50783429e-04f, 2.20487229e-04f, 1.93366970e-04f,
+  1.69159117e-04f, 1.47612373e-04f, 1.28488551e-04f, 1.11563037e-04f, 9.66252192e-05f, 8.34785533e-05f,
+  7.19405289e-05f, 6.00044988e-03f, 5.99295413e-03f, 5.97052276e-03f, 5.93332341e-03f, 5.88163314e-03f,
+  5.81583567e-03f, 5.73641527e-03f, 5.64395171e-03f, 5.53911366e-03f, 5.42264897e-03f, 5.29537862e-03f,
+  5.15818363e-03f, 5.01199719e-03f, 4.85779438e-03f, 4.69657965e-03f, 4.52937745e-03f, 4.35722107e-03f,
+  4.18114243e-03f, 4.00216086e-03f, 3.82127636e-03f, 3.63945682e-03f, 3.45763378e-03f, 3.27669224e-03f,
+  3.09746643e-03f, 2.92073260e-03f, 2.74720625e-03f, 2.57753744e-03f, 2.41230917e-03f, 2.25203554e-03f,
+  2.09716079e-03f, 1.94806093e-03f, 1.80504308e-03f, 1.66834891e-03f, 1.53815630e-03f, 1.41458260e-03f,
+  1.29768834e-03f, 1.18748122e-03f, 1.08392036e-03f, 9.86920786e-04f, 8.96357873e-04f, 8.12072598e-04f,
+  7.33875786e-04f, 6.61552767e-04f, 5.94868150e-04f, 5.33569721e-04f, 4.77392867e-04f, 4.26064071e-04f,
+  3.79304664e-04f, 3.36833851e-04f, 2.98371626e-04f, 2.63641385e-04f, 2.32372055e-04f, 2.04300057e-04f,
+  1.79170835e-04f, 1.56740221e-04f, 1.36775343e-04f, 1.19055498e-04f, 1.03372578e-04f, 8.95314297e-05f,
+  7.73499341e-05f, 6.66589767e-05f, 5.54604176e-03f, 5.53911366e-03f, 5.51838055e-03f, 5.48399845e-03f,
+  5.43622253e-03f, 5.37540810e-03f, 5.30200172e-03f, 5.21654077e-03f, 5.11964178e-03f, 5.01199719e-03f,
+  4.89436463e-03f, 4.76755900e-03f, 4.63244366e-03f, 4.48991824e-03f, 4.34091222e-03f, 4.18637181e-03f,
+  4.02725302e-03f, 3.86450836e-03f, 3.69908125e-03f, 3.53189465e-03f, 3.36384424e-03f, 3.19579057e-03f,
+  3.02855158e-03f, 2.86289817e-03f, 2.69954838e-03f, 2.53916299e-03f, 2.38234294e-03f, 2.22962745e-03f,
+  2.08149105e-03f, 1.93834491e-03f, 1.80053618e-03f, 1.66834891e-03f, 1.54200650e-03f, 1.42167322e-03f,
+  1.30745757e-03f, 1.19941565e-03f, 1.09755446e-03f, 1.00183615e-03f, 9.12182208e-04f, 8.28477554e-04f,
+  7.50575156e-04f, 6.78300043e-04f, 6.11454016e-04f, 5.49819320e-04f, 4.93163010e-04f, 4.41240350e-04f,
+  3.93798662e-04f, 3.50580289e-04f, 3.11325741e-04f, 2.75776227e-04f, 2.43676070e-04f, 2.14774744e-04f,
+  1.88828606e-04f, 1.65602396e-04f, 1.44870428e-04f, 1.26417479e-04f, 1.10039538e-04f, 9.55442738e-05f,
+  8.27512995e-05f, 7.14923008e-05f, 6.16109610e-05f, 5.11324639e-03f, 5.10685844e-03f, 5.08774398e-03f,
+  5.05604455e-03f, 5.01199719e-03f, 4.95592831e-03f, 4.88825049e-03f, 4.80945827e-03f, 4.72012116e-03f,
+  4.62087663e-03f, 4.51242412e-03f, 4.39551380e-03f, 4.27094242e-03f, 4.13953932e-03f, 4.00216086e-03f,
+  3.85968084e-03f, 3.71297891e-03f, 3.56293446e-03f, 3.41041666e-03f, 3.25627695e-03f, 3.10134050e-03f,
+  2.94640125e-03f, 2.79221311e-03f, 2.63948669e-03f, 2.48888414e-03f, 2.34101480e-03f, 2.19643256e-03f,
+  2.05563428e-03f, 1.91905804e-03f, 1.78708264e-03f, 1.66002801e-03f, 1.53815630e-03f, 1.42167322e-03f,
+  1.31073035e-03f, 1.20542769e-03f, 1.10581703e-03f, 1.01190479e-03f, 9.23656044e-04f, 8.40998371e-04f,
+  7.63825781e-04f, 6.92002650e-04f, 6.25367684e-04f, 5.63738111e-04f, 5.06913173e-04f, 4.54678113e-04f,
+  4.06807347e-04f, 3.63067869e-04f, 3.23222106e-04f, 2.87030853e-04f, 2.54255516e-04f, 2.24660354e-04f,
+  1.98014401e-04f, 1.74093017e-04f, 1.52679320e-04f, 1.33565205e-04f, 1.16552263e-04f, 1.01452402e-04f,
+  8.80883017e-05f, 7.62936543e-05f, 6.59132711e-05f, 5.68030337e-05f, 4.70245397e-03f, 4.69657965e-03f,
+  4.67900047e-03f, 4.64984775e-03f, 4.60933894e-03f, 4.55777440e-03f, 4.49553411e-03f, 4.42307210e-03f,
+  4.34091222e-03f, 4.24964074e-03f, 4.14990075e-03f, 4.04238328e-03f, 3.92781943e-03f, 3.80697334e-03f,
+  3.68063198e-03f, 3.54959839e-03f, 3.41468235e-03f, 3.27669224e-03f, 3.13642761e-03f, 2.99467123e-03f,
+  2.85218237e-03f, 2.70969071e-03f, 2.56788987e-03f, 2.42743338e-03f, 2.28893012e-03f, 2.15294026e-03f,
+  2.01997370e-03f, 1.89048704e-03f, 1.76488317e-03f, 1.64351042e-03f, 1.52666320e-03f, 1.41458260e-03f,
+  1.30745757e-03f, 1.20542769e-03f, 1.10858504e-03f, 1.01697701e-03f, 9.30609531e-04f, 8.49450589e-04f,
+  7.73433538e-04f, 7.02460879e-04f, 6.36407931e-04f, 5.75126323e-04f, 5.18448011e-04f, 4.66188358e-04f,
+  4.18149808e-04f, 3.74124909e-04f, 3.33899399e-04f, 2.97254825e-04f, 2.63971131e-04f, 2.33828920e-04f,
+  2.06611410e-04f, 1.82106145e-04f, 1.60106589e-04f, 1.40413234e-04f, 1.22834725e-04f, 1.07188585e-04f,
+  9.33018309e-05f, 8.10113925e-05f, 7.01643075e-05f, 6.06178728e-05f, 5.22395421e-05f, 4.31386614e-03f,
+  4.30847704e-03f, 4.29235026e-03f, 4.26560687e-03f, 4.22844570e-03f, 4.18114243e-03f, 4.12404491e-03f,
+  4.05757083e-03f, 3.98220029e-03f, 3.89847113e-03f, 3.80697334e-03f, 3.70834046e-03f, 3.60324373e-03f,
+  3.49238352e-03f, 3.37648252e-03f, 3.25627695e-03f, 3.13250953e-03f, 3.00592231e-03f, 2.87724845e-03f,
+  2.74720625e-03f, 2.61649187e-03f, 2.48577492e-03f, 2.35569198e-03f, 2.22684210e-03f, 2.09978409e-03f,
+  1.97503180e-03f, 1.85305288e-03f, 1.73426641e-03f, 1.61904178e-03f, 1.50769879e-03f, 1.40050717e-03f,
+  1.29768834e-03f, 1.19941565e-03f, 1.10581703e-03f, 1.01697701e-03f, 9.32938943e-04f, 8.53708480e-04f,
+  7.79256108e-04f, 7.09520769e-04f, 6.44412939e-04f, 5.83818241e-04f, 5.27600700e-04f, 4.75605979e-04f,
+  4.27664811e-04f, 3.83595936e-04f, 3.43209045e-04f, 3.06307571e-04f, 2.72691133e-04f, 2.42157839e-04f,
+  2.14506435e-04f, 1.89538041e-04f, 1.67057777e-04f, 1.46876162e-04f, 1.28810163e-04f, 1.12684262e-04f,
+  9.83310383e-05f, 8.55918261e-05f, 7.43170021e-05f, 6.43662715e-05f, 5.56087034e-05f, 4.79227201e-05f,
+  3.94750806e-03f, 3.94257670e-03f, 3.92781943e-03f, 3.90334730e-03f, 3.86934192e-03f, 3.82605591e-03f,
+  3.77380755e-03f, 3.71297891e-03f, 3.64400912e-03f, 3.56739084e-03f, 3.48366355e-03f, 3.39340721e-03f,
+  3.29723582e-03f, 3.19579057e-03f, 3.08973226e-03f, 2.97973538e-03f, 2.86647910e-03f, 2.75064236e-03f,
+  2.63289618e-03f, 2.51389784e-03f, 2.39428459e-03f, 2.27466878e-03f, 2.15563318e-03f, 2.03772588e-03f,
+  1.92145840e-03f, 1.80730084e-03f, 1.69568101e-03f, 1.58698263e-03f, 1.48154353e-03f, 1.37965637e-03f,
+  1.28156820e-03f, 1.18748122e-03f, 1.09755446e-03f, 1.01190479e-03f, 9.30609531e-04f, 8.53708480e-04f,
+  7.81206705e-04f, 7.13077257e-04f, 6.49264199e-04f, 5.89685747e-04f, 5.34237130e-04f, 4.82793839e-04f,
+  4.35214810e-04f, 3.91345093e-04f, 3.51018796e-04f, 3.14061792e-04f, 2.80294189e-04f, 2.49532633e-04f,
+  2.21592418e-04f, 1.96289329e-04f, 1.73441396e-04f, 1.52870285e-04f, 1.34402595e-04f, 1.17870877e-04f,
+  1.03114471e-04f, 8.99802108e-05f, 7.83228752e-05f, 6.80055819e-05f, 5.88999210e-05f, 5.08860976e-05f,
+  4.38528514e-05f, 3.60324373e-03f, 3.59874242e-03f, 3.58527247e-03f, 3.56293446e-03f, 3.53189465e-03f,
+  3.49238352e-03f, 3.44469189e-03f, 3.38916807e-03f, 3.32621322e-03f, 3.25627695e-03f, 3.17985145e-03f,
+  3.09746643e-03f, 3.00968206e-03f, 2.91708391e-03f, 2.82027526e-03f, 2.71987100e-03f, 2.61649187e-03f,
+  2.51075742e-03f, 2.40328000e-03f, 2.29465961e-03f, 2.18547788e-03f, 2.07629381e-03f, 1.96763920e-03f,
+  1.86001486e-03f, 1.75388705e-03f, 1.64968520e-03f, 1.54779979e-03f, 1.44858100e-03f, 1.35233731e-03f,
+  1.25933590e-03f, 1.16980192e-03f, 1.08392036e-03f, 1.00183615e-03f, 9.23656044e-04f, 8.49450589e-04f,
+  7.79256108e-04f, 7.13077257e-04f, 6.50889415e-04f, 5.92641532e-04f, 5.38258930e-04f, 4.87646001e-04f,
+  4.40689153e-04f, 3.97259515e-04f, 3.57215671e-04f, 3.20406252e-04f, 2.86672293e-04f, 2.55849591e-04f,
+  2.27770768e-04f, 2.02267227e-04f, 1.79170835e-04f, 1.58315481e-04f, 1.39538388e-04f, 1.22681275e-04f,
+  1.07591295e-04f, 9.41218095e-05f, 8.21329886e-05f, 7.14923008e-05f, 6.20747742e-05f, 5.37632295e-05f,
+  4.64482946e-05f, 4.00284225e-05f, 3.28079076e-03f, 3.27669224e-03f, 3.26442765e-03f, 3.24408873e-03f,
+  3.21582681e-03f, 3.17985145e-03f, 3.13642761e-03f, 3.08587262e-03f, 3.02855158e-03f, 2.96487380e-03f,
+  2.89528770e-03f, 2.82027526e-03f, 2.74034683e-03f, 2.65603513e-03f, 2.56788987e-03f, 2.47647078e-03f,
+  2.38234294e-03f, 2.28607072e-03f, 2.18821131e-03f, 2.08931137e-03f, 1.98990013e-03f, 1.89048704e-03f,
+  1.79155590e-03f, 1.69356284e-03f, 1.59693230e-03f, 1.50205544e-03f, 1.40928780e-03f, 1.31894799e-03f,
+  1.23131718e-03f, 1.14663830e-03f, 1.06511684e-03f, 9.86920786e-04f, 9.12182208e-04f, 8.40998371e-04f,
+  7.73433538e-04f, 7.09520769e-04f, 6.49264199e-04f, 5.92641532e-04f, 5.39606262e-04f, 4.90090344e-04f,
+  4.44006757e-04f, 4.01252037e-04f, 3.61708895e-04f, 3.25248577e-04f, 2.91733217e-04f, 2.61018111e-04f,
+  2.32953709e-04f, 2.07387653e-04f, 1.84166405e-04f, 1.63136909e-04f, 1.44147882e-04f, 1.27051142e-04f,
+  1.11702575e-04f, 9.79629913e-05f, 8.56988772e-05f, 7.47829399e-05f, 6.50944785e-05f, 5.65197297e-05f,
+  4.89519771e-05f, 4.22916528e-05f, 3.64462940e-05f, 2.97973538e-03f, 2.97601288e-03f, 2.96487380e-03f,
+  2.94640125e-03f, 2.92073260e-03f, 2.88805855e-03f, 2.84861936e-03f, 2.80270353e-03f, 2.75064236e-03f,
+  2.69280793e-03f, 2.62960722e-03f, 2.56147818e-03f, 2.48888414e-03f, 2.41230917e-03f, 2.33225245e-03f,
+  2.24922225e-03f, 2.16373196e-03f, 2.07629381e-03f, 1.98741443e-03f, 1.89758965e-03f, 1.80730084e-03f,
+  1.71701016e-03f, 1.62715721e-03f, 1.53815630e-03f, 1.45039288e-03f, 1.36422226e-03f, 1.27996725e-03f,
+  1.19791727e-03f, 1.11832772e-03f, 1.04141922e-03f, 9.67378437e-04f, 8.96357873e-04f, 8.28477554e-04f,
+  7.63825781e-04f, 7.02460879e-04f, 6.44412939e-04f, 5.89685747e-04f, 5.38258930e-04f, 4.90090344e-04f,
+  4.45118145e-04f, 4.03263315e-04f, 3.64431908e-04f, 3.28517373e-04f, 2.95402773e-04f, 2.64962873e-04f,
+  2.37066270e-04f, 2.11577164e-04f, 1.88357124e-04f, 1.67266728e-04f, 1.48166961e-04f, 1.30920438e-04f,
+  1.15392548e-04f, 1.01452402e-04f, 8.89736039e-05f, 7.78348840e-05f, 6.79206278e-05f, 5.91212120e-05f,
+  5.13333034e-05f, 4.44599937e-05f, 3.84108425e-05f, 3.31018709e-05f, 2.69954838e-03f, 2.69617606e-03f,
+  2.68608425e-03f, 2.66934861e-03f, 2.64609372e-03f, 2.61649187e-03f, 2.58076144e-03f, 2.53916299e-03f,
+  2.49199709e-03f, 2.43960088e-03f, 2.38234294e-03f, 2.32062023e-03f, 2.25485233e-03f, 2.18547788e-03f,
+  2.11294880e-03f, 2.03772588e-03f, 1.96027453e-03f, 1.88105821e-03f, 1.80053618e-03f, 1.71915768e-03f,
+  1.63735880e-03f, 1.55555818e-03f, 1.47415430e-03f, 1.39352214e-03f, 1.31401129e-03f, 1.23594329e-03f,
+  1.15961081e-03f, 1.08527613e-03f, 1.01317046e-03f, 9.43493738e-04f, 8.76414997e-04f, 8.12072598e-04f,
+  7.50575156e-04f, 6.92002650e-04f, 6.36407931e-04f, 5.83818241e-04f, 5.34237130e-04f, 4.87646001e-04f,
+  4.44006757e-04f, 4.03263315e-04f, 3.65344138e-04f, 3.30164097e-04f, 2.97626626e-04f, 2.67625815e-04f,
+  2.40048204e-04f, 2.14774744e-04f, 1.91682382e-04f, 1.70645741e-04f, 1.51538508e-04f, 1.34234695e-04f,
+  1.18609874e-04f, 1.04542087e-04f, 9.19127488e-05f, 8.06073440e-05f, 7.05160055e-05f, 6.15339959e-05f,
+  5.35619947e-05f, 4.65063931e-05f, 4.02793848e-05f, 3.47990390e-05f, 2.99892727e-05f, 2.43960088e-03f,
+  2.43655336e-03f, 2.42743338e-03f, 2.41230917e-03f, 2.39129364e-03f, 2.36454234e-03f, 2.33225245e-03f,
+  2.29465961e-03f, 2.25203554e-03f, 2.20468454e-03f, 2.15294026e-03f, 2.09716079e-03f, 2.03772588e-03f,
+  1.97503180e-03f, 1.90948672e-03f, 1.84150739e-03f, 1.77151384e-03f, 1.69992563e-03f, 1.62715721e-03f,
+  1.55361497e-03f, 1.47969276e-03f, 1.40576903e-03f, 1.33220362e-03f, 1.25933590e-03f, 1.18748122e-03f,
+  1.11693074e-03f, 1.04794849e-03f, 9.80771729e-04f, 9.15609300e-04f, 8.52641999e-04f, 7.92022445e-04f,
+  7.33875786e-04f, 6.78300043e-04f, 6.25367684e-04f, 5.75126323e-04f, 5.27600700e-04f, 4.82793839e-04f,
+  4.40689153e-04f, 4.01252037e-04f, 3.64431908e-04f, 3.30164097e-04f, 2.98371626e-04f, 2.68967298e-04f,
+  2.41855334e-04f, 2.16933258e-04f, 1.94093445e-04f, 1.73224733e-04f, 1.54213776e-04f, 1.36946415e-04f,
+  1.21308847e-04f, 1.07188585e-04f, 9.44754283e-05f, 8.30622012e-05f, 7.28454252e-05f, 6.37258127e-05f,
+  5.56087034e-05f, 4.84043521e-05f, 4.20281540e-05f, 3.64007647e-05f, 3.14481367e-05f, 2.71015178e-05f,
+  2.19917973e-03f, 2.19643256e-03f, 2.18821131e-03f, 2.17457768e-03f, 2.15563318e-03f, 2.13151821e-03f,
+  2.10241042e-03f, 2.06852215e-03f, 2.03009881e-03f, 1.98741443e-03f, 1.94076938e-03f, 1.89048704e-03f,
+  1.83690933e-03f, 1.78039365e-03f, 1.72130798e-03f, 1.66002801e-03f, 1.59693230e-03f, 1.53239898e-03f,
+  1.46680197e-03f, 1.40050717e-03f, 1.33386999e-03f, 1.26723130e-03f, 1.20091590e-03f, 1.13522913e-03f,
+  1.07045576e-03f, 1.00685784e-03f, 9.44673840e-04f, 8.84117326e-04f, 8.25376599e-04f, 7.68614642e-04f,
+  7.13969173e-04f, 6.61552767e-04f, 6.11454016e-04f, 5.63738111e-04f, 5.18448011e-04f, 4.75605979e-04f,
+  4.35214810e-04f, 3.97259515e-04f, 3.61708895e-04f, 3.28517373e-04f, 2.97626626e-04f, 2.68967298e-04f,
+  2.42460723e-04f, 2.18020650e-04f, 1.95554618e-04f, 1.74965666e-04f, 1.56153546e-04f, 1.39016105e-04f,
+  1.23450431e-04f, 1.09353939e-04f, 9.66252192e-05f, 8.51649311e-05f, 7.48764724e-05f, 6.56665579e-05f,
+  5.74456753e-05f, 5.01285031e-05f, 4.36341361e-05f, 3.78863078e-05f, 3.28134920e-05f, 2.83489426e-05f,
+  2.44306812e-05f, 1.97750214e-03f, 1.97503180e-03f, 1.96763920e-03f, 1.95537996e-03f, 1.93834491e-03f,
+  1.91666069e-03f, 1.89048704e-03f, 1.86001486e-03f, 1.82546454e-03f, 1.78708264e-03f, 1.74513948e-03f,
+  1.69992563e-03f, 1.65174855e-03f, 1.60092965e-03f, 1.54779979e-03f, 1.49269693e-03f, 1.43596123e-03f,
+  1.37793284e-03f, 1.31894799e-03f, 1.25933590e-03f, 1.19941565e-03f, 1.13949424e-03f, 1.07986329e-03f,
+  1.02079776e-03f, 9.62553604e-04f, 9.05366440e-04f, 8.49450589e-04f, 7.94998137e-04f, 7.42178468e-04f,
+  6.91138150e-04f, 6.42000930e-04f, 5.94868150e-04f, 5.49819320e-04f, 5.06913173e-04f, 4.66188358e-04f,
+  4.27664811e-04f, 3.91345093e-04f, 3.57215671e-04f, 3.25248577e-04f, 2.95402773e-04f, 2.67625815e-04f,
+  2.41855334e-04f, 2.18020650e-04f, 1.96044130e-04f, 1.75842681e-04f, 1.57329094e-04f, 1.40413234e-04f,
+  1.25003251e-04f, 1.11006608e-04f, 9.83310383e-05f, 8.68853749e-05f, 7.65802906e-05f, 6.73289105e-05f,
+  5.90473537e-05f, 5.16551409e-05f, 4.50755397e-05f, 3.92358052e-05f, 3.40673614e-05f, 2.95058853e-05f,
+  2.54913648e-05f, 2.19680642e-05f, 1.77372969e-03f, 1.77151384e-03f, 1.76488317e-03f, 1.75388705e-03f,
+  1.73860742e-03f, 1.71915768e-03f, 1.69568101e-03f, 1.66834891e-03f, 1.63735880e-03f, 1.60293200e-03f,
+  1.56531087e-03f, 1.52475608e-03f, 1.48154353e-03f, 1.43596123e-03f, 1.38830626e-03f, 1.33888132e-03f,
+  1.28799211e-03f, 1.23594329e-03f, 1.18303648e-03f, 1.12956716e-03f, 1.07582146e-03f, 1.02207460e-03f,
+  9.68588400e-04f, 9.15609300e-04f, 8.63366877e-04f, 8.12072598e-04f, 7.61918607e-04f, 7.13077257e-04f,
+  6.65700412e-04f, 6.19919563e-04f, 5.75845712e-04f, 5.33569721e-04f, 4.93163010e-04f, 4.54678113e-04f,
+  4.18149808e-04f, 3.83595936e-04f, 3.51018796e-04f, 3.20406252e-04f, 2.91733217e-04f, 2.64962873e-04f,
+  2.40048204e-04f, 2.16933258e-04f, 1.95554618e-04f, 1.75842681e-04f, 1.57722912e-04f, 1.41117052e-04f,
+  1.25944294e-04f, 1.12122245e-04f, 9.95678929e-05f, 8.81984815e-05f, 7.79322436e-05f, 6.86890489e-05f,
+  6.03909793e-05f, 5.29627978e-05f, 4.63323195e-05f, 4.04307139e-05f, 3.51927374e-05f, 3.05568756e-05f,
+  2.64654409e-05f, 2.28645968e-05f, 1.97043573e-05f, 1.58698263e-03f, 1.58500008e-03f, 1.57906744e-03f,
+  1.56922906e-03f, 1.55555818e-03f, 1.53815630e-03f, 1.51715137e-03f, 1.49269693e-03f, 1.46496959e-03f,
+  1.43416738e-03f, 1.40050717e-03f, 1.36422226e-03f, 1.32555934e-03f, 1.28477614e-03f, 1.24213845e-03f,
+  1.19791727e-03f, 1.15238584e-03f, 1.10581703e-03f, 1.05848059e-03f, 1.01064064e-03f, 9.62553604e-04f,
+  9.14465520e-04f, 8.66610615e-04f, 8.19209439e-04f, 7.72467349e-04f, 7.26573577e-04f, 6.81700069e-04f,
+  6.38000958e-04f, 5.95612160e-04f, 5.54651371e-04f, 5.15217835e-04f, 4.77392867e-04f, 4.41240350e-04f,
+  4.06807347e-04f, 3.74124909e-04f, 3.43209045e-04f, 3.14061792e-04f, 2.86672293e-04f, 2.61018111e-04f,
+  2.37066270e-04f, 2.14774744e-04f, 1.94093445e-04f, 1.74965666e-04f, 1.57329094e-04f, 1.41117052e-04f,
+  1.26259562e-04f, 1.12684262e-04f, 1.00317462e-04f, 8.90848896e-05f, 7.89125115e-05f, 6.97271462e-05f,
+  6.14571254e-05f, 5.40327164e-05f, 4.73866130e-05f, 4.14542228e-05f, 3.61739694e-05f, 3.14874706e-05f,
+  2.73396963e-05f, 2.36790274e-05f, 2.04572989e-05f, 1.76297835e-05f, 1.41635188e-03f, 1.41458260e-03f,
+  1.40928780e-03f, 1.40050717e-03f, 1.38830626e-03f, 1.37277530e-03f, 1.35402882e-03f, 1.33220362e-03f,
+  1.30745757e-03f, 1.27996725e-03f, 1.24992616e-03f, 1.21754245e-03f, 1.18303648e-03f, 1.14663830e-03f,
+  1.10858504e-03f, 1.06911850e-03f, 1.02848257e-03f, 9.86920786e-04f, 9.44673840e-04f, 9.01977648e-04f,
+  8.59060849e-04f, 8.16143118e-04f, 7.73433538e-04f, 7.31128908e-04f, 6.89412467e-04f, 6.48453133e-04f,
+  6.08404400e-04f, 5.69403754e-04f, 5.31572558e-04f, 4.95015818e-04f, 4.59822128e-04f, 4.26064071e-04f,
+  3.93798662e-04f, 3.63067869e-04f, 3.33899399e-04f, 3.06307571e-04f, 2.80294189e-04f, 2.55849591e-04f,
+  2.32953709e-04f, 2.11577164e-04f, 1.91682382e-04f, 1.73224733e-04f, 1.56153546e-04f, 1.40413234e-04f,
+  1.25944294e-04f, 1.12684262e-04f, 1.00568570e-04f, 8.95314297e-05f, 7.95065789e-05f, 7.04279155e-05f,
+  6.22301595e-05f, 5.48493190e-05f, 4.82231771e-05f, 4.22916528e-05f, 3.69971094e-05f, 3.22845808e-05f,
+  2.81019711e-05f, 2.44001621e-05f, 2.11330844e-05f, 1.82577514e-05f, 1.57342474e-05f, 1.26091100e-03f,
+  1.25933590e-03f, 1.25462213e-03f, 1.24680519e-03f, 1.23594329e-03f, 1.22211687e-03f, 1.20542769e-03f,
+  1.18599785e-03f, 1.16396754e-03f, 1.13949424e-03f, 1.11275003e-03f, 1.08392036e-03f, 1.05320138e-03f,
+  1.02079776e-03f, 9.86920786e-04f, 9.51785536e-04f, 9.15609300e-04f, 8.78608786e-04f, 8.40998371e-04f,
+  8.02988012e-04f, 7.64781202e-04f, 7.26573577e-04f, 6.88551227e-04f, 6.50889415e-04f, 6.13751297e-04f,
+  5.77287108e-04f, 5.41633577e-04f, 5.06913173e-04f, 4.73233900e-04f, 4.40689153e-04f, 4.09357861e-04f,
+  3.79304664e-04f, 3.50580289e-04f, 3.23222106e-04f, 2.97254825e-04f, 2.72691133e-04f, 2.49532633e-04f,
+  2.27770768e-04f, 2.07387653e-04f, 1.88357124e-04f, 1.70645741e-04f, 1.54213776e-04f, 1.39016105e-04f,
+  1.25003251e-04f, 1.12122245e-04f, 1.00317462e-04f, 8.95314297e-05f, 7.97055909e-05f, 7.07809377e-05f,
+  6.26986366e-05f, 5.54005637e-05f, 4.88297483e-05f, 4.29308093e-05f, 3.76502576e-05f, 3.29367722e-05f,
+  2.87414332e-05f, 2.50178546e-05f, 2.17223078e-05f, 1.88137838e-05f, 1.62540109e-05f, 1.40074562e-05f,
+  1.11972657e-03f, 1.11832772e-03f, 1.11414189e-03f, 1.10720017e-03f, 1.09755446e-03f, 1.08527613e-03f,
+  1.07045576e-03f, 1.05320138e-03f, 1.03363791e-03f, 1.01190479e-03f, 9.88155138e-04f, 9.62553604e-04f,
+  9.35274176e-04f, 9.06498812e-04f, 8.76414997e-04f, 8.45213945e-04f, 8.13088322e-04f, 7.80230795e-04f,
+  7.46831647e-04f, 7.13077257e-04f, 6.79148478e-04f, 6.45218999e-04f, 6.11454016e-04f, 5.78009174e-04f,
+  5.45029412e-04f, 5.12648141e-04f, 4.80986753e-04f, 4.50154010e-04f, 4.20245779e-04f, 3.91345093e-04f,
+  3.63521976e-04f, 3.36833851e-04f, 3.11325741e-04f, 2.87030853e-04f, 2.63971131e-04f, 2.42157839e-04f,
+  2.21592418e-04f, 2.02267227e-04f, 1.84166405e-04f, 1.67266728e-04f, 1.51538508e-04f, 1.36946415e-04f,
+  1.23450431e-04f, 1.11006608e-04f, 9.95678929e-05f, 8.90848896e-05f, 7.95065789e-05f, 7.07809377e-05f,
+  6.28555790e-05f, 5.56782579e-05f, 4.91973478e-05f, 4.33622736e-05f, 3.81238387e-05f, 3.34345496e-05f,
+  2.92488348e-05f, 2.55232480e-05f, 2.22166000e-05f, 1.92900570e-05f, 1.67071994e-05f, 1.44340465e-05f,
+  1.24390381e-05f, 9.91867739e-04f, 9.90628614e-04f, 9.86920786e-04f, 9.80771729e-04f, 9.72227426e-04f,
+  9.61351150e-04f, 9.48223053e-04f, 9.32938943e-04f, 9.15609300e-04f, 8.96357873e-04f, 8.75320169e-04f,
+  8.52641999e-04f, 8.28477554e-04f, 8.02988012e-04f, 7.76339381e-04f, 7.48701044e-04f, 7.20243785e-04f,
+  6.91138150e-04f, 6.61552767e-04f, 6.31652714e-04f, 6.01598178e-04f, 5.71543002e-04f, 5.41633577e-04f,
+  5.12007740e-04f, 4.82793839e-04f, 4.54110123e-04f, 4.26064071e-04f, 3.98752047e-04f, 3.72258975e-04f,
+  3.46658373e-04f, 3.22012289e-04f, 2.98371626e-04f, 2.75776227e-04f, 2.54255516e-04f, 2.33828920e-04f,
+  2.14506435e-04f, 1.96289329e-04f, 1.79170835e-04f, 1.63136909e-04f, 1.48166961e-04f, 1.34234695e-04f,
+  1.21308847e-04f, 1.09353939e-04f, 9.83310383e-05f, 8.81984815e-05f, 7.89125115e-05f, 7.04279155e-05f,
+  6.26986366e-05f, 5.56782579e-05f, 4.93204971e-05f, 4.35796246e-05f, 3.84108425e-05f, 3.37705715e-05f,
+  2.96167400e-05f, 2.59089829e-05f, 2.26088123e-05f, 1.96797409e-05f, 1.70873718e-05f, 1.47994460e-05f,
+  1.27858584e-05f, 1.10186547e-05f, 8.76414997e-04f, 8.75320169e-04f, 8.72043893e-04f, 8.66610615e-04f,
+  8.59060849e-04f, 8.49450589e-04f, 8.37850559e-04f, 8.24345509e-04f, 8.09033052e-04f, 7.92022445e-04f,
+  7.73433538e-04f, 7.53395085e-04f, 7.32043351e-04f, 7.09520769e-04f, 6.85974024e-04f, 6.61552767e-04f,
+  6.36407931e-04f, 6.10690156e-04f, 5.84548514e-04f, 5.58128813e-04f, 5.31572558e-04f, 5.05015836e-04f,
+  4.78587841e-04f, 4.52410401e-04f, 4.26596991e-04f, 4.01252037e-04f, 3.76470533e-04f, 3.52337578e-04f,
+  3.28928290e-04f, 3.06307571e-04f, 2.84530310e-04f, 2.63641385e-04f, 2.43676070e-04f, 2.24660354e-04f,
+  2.06611410e-04f, 1.89538041e-04f, 1.73441396e-04f, 1.58315481e-04f, 1.44147882e-04f, 1.30920438e-04f,
+  1.18609874e-04f, 1.07188585e-04f, 9.66252192e-05f, 8.68853749e-05f, 7.79322436e-05f, 6.97271462e-05f,
+  6.22301595e-05f, 5.54005637e-05f, 4.91973478e-05f, 4.35796246e-05f, 3.85069870e-05f, 3.39398466e-05f,
+  2.98397008e-05f, 2.61693731e-05f, 2.28931967e-05f, 1.99771621e-05f, 1.73890330e-05f, 1.50984151e-05f,
+  1.30768012e-05f, 1.12975940e-05f, 9.73609167e-06f, 7.72467349e-04f, 7.71502382e-04f, 7.68614642e-04f,
+  7.63825781e-04f, 7.57171481e-04f, 7.48701044e-04f, 7.38476869e-04f, 7.26573577e-04f, 7.13077257e-04f,
+  6.98084245e-04f, 6.81700069e-04f, 6.64038234e-04f, 6.45218999e-04f, 6.25367684e-04f, 6.04613684e-04f,
+  5.83088957e-04f, 5.60926448e-04f, 5.38258930e-04f, 5.15217835e-04f, 4.91931627e-04f, 4.68525133e-04f,
+  4.45118145e-04f, 4.21824661e-04f, 3.98752047e-04f, 3.76000215e-04f, 3.53661337e-04f, 3.31819028e-04f,
+  3.10548407e-04f, 2.89915566e-04f, 2.69977812e-04f, 2.50783429e-04f, 2.32372055e-04f, 2.14774744e-04f,
+  1.98014401e-04f, 1.82106145e-04f, 1.67057777e-04f, 1.52870285e-04f, 1.39538388e-04f, 1.27051142e-04f,
+  1.15392548e-04f, 1.04542087e-04f, 9.44754283e-05f, 8.51649311e-05f, 7.65802906e-05f, 6.86890489e-05f,
+  6.14571254e-05f, 5.48493190e-05f, 4.88297483e-05f, 4.33622736e-05f, 3.84108425e-05f, 3.39398466e-05f,
+  2.99143940e-05f, 2.63005477e-05f, 2.30655405e-05f, 2.01779367e-05f, 1.76077610e-05f, 1.53265973e-05f,
+  1.33076592e-05f, 1.15258199e-05f, 9.95763639e-06f, 8.58133717e-06f, 6.79148478e-04f, 6.78300043e-04f,
+  6.75761199e-04f, 6.71550864e-04f, 6.65700412e-04f, 6.58253266e-04f, 6.49264199e-04f, 6.38798927e-04f,
+  6.26933062e-04f, 6.13751297e-04f, 5.99346415e-04f, 5.83818241e-04f, 5.67272480e-04f, 5.49819320e-04f,
+  5.31572558e-04f, 5.12648141e-04f, 4.93163010e-04f, 4.73233900e-04f, 4.52976266e-04f, 4.32503206e-04f,
+  4.11924353e-04f, 3.91345093e-04f, 3.70865600e-04f, 3.50580289e-04f, 3.30577051e-04f, 3.10936826e-04f,
+  2.91733217e-04f, 2.73032201e-04f, 2.54891958e-04f, 2.37362794e-04f, 2.20487229e-04f, 2.04300057e-04f,
+  1.88828606e-04f, 1.74093017e-04f, 1.60106589e-04f, 1.46876162e-04f, 1.34402595e-04f, 1.22681275e-04f,
+  1.11702575e-04f, 1.01452402e-04f, 9.19127488e-05f, 8.30622012e-05f, 7.48764724e-05f, 6.73289105e-05f,
+  6.03909793e-05f, 5.40327164e-05f, 4.82231771e-05f, 4.29308093e-05f, 3.81238387e-05f, 3.37705715e-05f,
+  2.98397008e-05f, 2.63005477e-05f, 2.31232771e-05f, 2.02790779e-05f, 1.77403144e-05f, 1.54806330e-05f,
+  1.34750489e-05f, 1.17000109e-05f, 1.01334290e-05f, 8.75469141e-06f, 7.54465782e-06f, 5.95612160e-04f,
+  5.94868150e-04f, 5.92641532e-04f, 5.88949071e-04f, 5.83818241e-04f, 5.77287108e-04f, 5.69403754e-04f,
+  5.60225686e-04f, 5.49819320e-04f, 5.38258930e-04f, 5.25625888e-04f, 5.12007740e-04f, 4.97497094e-04f,
+  4.82190721e-04f, 4.66188358e-04f, 4.49591666e-04f, 4.32503206e-04f, 4.15025424e-04f, 3.97259515e-04f,
+  3.79304664e-04f, 3.61257058e-04f, 3.43209045e-04f, 3.25248577e-04f, 3.07458395e-04f, 2.89915566e-04f,
+  2.72691133e-04f, 2.55849591e-04f, 2.39448826e-04f, 2.23539857e-04f, 2.08166821e-04f, 1.93366970e-04f,
+  1.79170835e-04f, 1.65602396e-04f, 1.52679320e-04f, 1.40413234e-04f, 1.28810163e-04f, 1.17870877e-04f,
+  1.07591295e-04f, 9.79629913e-05f, 8.89736039e-05f, 8.06073440e-05f, 7.28454252e-05f, 6.56665579e-05f,
+  5.90473537e-05f, 5.29627978e-05f, 4.73866130e-05f, 4.22916528e-05f, 3.76502576e-05f, 3.34345496e-05f,
+  2.96167400e-05f, 2.61693731e-05f, 2.30655405e-05f, 2.02790779e-05f, 1.77847214e-05f, 1.55582293e-05f,
+  1.35764922e-05f, 1.18175976e-05f, 1.02608919e-05f, 8.88700197e-06f, 7.67785150e-06f, 6.61665354e-06f,
+  5.21046750e-04f, 5.20395814e-04f, 5.18448011e-04f, 5.15217835e-04f, 5.10729325e-04f, 5.05015836e-04f,
+  4.98119392e-04f, 4.90090344e-04f, 4.80986753e-04f, 4.70873638e-04f, 4.59822128e-04f, 4.47908853e-04f,
+  4.35214810e-04f, 4.21824661e-04f, 4.07825661e-04f, 3.93306720e-04f, 3.78357596e-04f, 3.63067869e-04f,
+  3.47526104e-04f, 3.31819028e-04f, 3.16030812e-04f, 3.00242275e-04f, 2.84530310e-04f, 2.68967298e-04f,
+  2.53620674e-04f, 2.38552588e-04f, 2.23819457e-04f, 2.09471938e-04f, 1.95554618e-04f, 1.82106145e-04f,
+  1.69159117e-04f, 1.56740221e-04f, 1.44870428e-04f, 1.33565205e-04f, 1.22834725e-04f, 1.12684262e-04f,
+  1.03114471e-04f, 9.41218095e-05f, 8.56988772e-05f, 7.78348840e-05f, 7.05160055e-05f, 6.37258127e-05f,
+  5.74456753e-05f, 5.16551409e-05f, 4.63323195e-05f, 4.14542228e-05f, 3.69971094e-05f, 3.29367722e-05f,
+  2.92488348e-05f, 2.59089829e-05f, 2.28931967e-05f, 2.01779367e-05f, 1.77403144e-05f, 1.55582293e-05f,
+  1.36104754e-05f, 1.18768339e-05f, 1.03381381e-05f, 8.97631799e-06f, 7.77442710e-06f, 6.71665157e-06f,
+  5.78830623e-06f, 4.54678113e-04f, 4.54110123e-04f, 4.52410401e-04f, 4.49591666e-04f, 4.45674901e-04f,
+  4.40689153e-04f, 4.34671150e-04f, 4.27664811e-04f, 4.19720804e-04f, 4.10895853e-04f, 4.01252037e-04f,
+  3.90856207e-04f, 3.79779085e-04f, 3.68094508e-04f, 3.55878641e-04f, 3.43209045e-04f, 3.30164097e-04f,
+  3.16821883e-04f, 3.03259760e-04f, 2.89553398e-04f, 2.75776227e-04f, 2.61998764e-04f, 2.48288095e-04f,
+  2.34707433e-04f, 2.21315597e-04f, 2.08166821e-04f, 1.95310335e-04f, 1.82790332e-04f, 1.70645741e-04f,
+  1.58910276e-04f, 1.47612373e-04f, 1.36775343e-04f, 1.26417479e-04f, 1.16552263e-04f, 1.07188585e-04f,
+  9.83310383e-05f, 8.99802108e-05f, 8.21329886e-05f, 7.47829399e-05f, 6.79206278e-05f, 6.15339959e-05f,
+  5.56087034e-05f, 5.01285031e-05f, 4.50755397e-05f, 4.04307139e-05f, 3.61739694e-05f, 3.22845808e-05f,
+  2.87414332e-05f, 2.55232480e-05f, 2.26088123e-05f, 1.99771621e-05f, 1.76077610e-05f, 1.54806330e-05f,
+  1.35764922e-05f, 1.18768339e-05f, 1.03640150e-05f, 9.02131160e-06f, 7.83295400e-06f, 6.78415518e-06f,
+  5.86111446e-06f, 5.05101752e-06f, 3.95772571e-04f, 3.95278184e-04f, 3.93798662e-04f, 3.91345093e-04f,
+  3.87935754e-04f, 3.83595936e-04f, 3.78357596e-04f, 3.72258975e-04f, 3.65344138e-04f, 3.57662473e-04f,
+  3.49268084e-04f, 3.40219063e-04f, 3.30577051e-04f, 3.20406252e-04f, 3.09772993e-04f, 2.98744824e-04f,
+  2.87389877e-04f, 2.75776227e-04f, 2.63971131e-04f, 2.52040481e-04f, 2.40048204e-04f, 2.28055666e-04f,
+  2.16121291e-04f, 2.04300057e-04f, 1.92643201e-04f, 1.81197887e-04f, 1.70007028e-04f, 1.59109040e-04f,
+  1.48537845e-04f, 1.38322750e-04f, 1.28488551e-04f, 1.19055498e-04f, 1.10039538e-04f, 1.01452402e-04f,
+  9.33018309e-05f, 8.55918261e-05f, 7.83228752e-05f, 7.14923008e-05f, 6.50944785e-05f, 5.91212120e-05f,
+  5.35619947e-05f, 4.84043521e-05f, 4.36341361e-05f, 3.92358052e-05f, 3.51927374e-05f, 3.14874706e-05f,
+  2.81019711e-05f, 2.50178546e-05f, 2.22166000e-05f, 1.96797409e-05f, 1.73890330e-05f, 1.53265973e-05f,
+  1.34750489e-05f, 1.18175976e-05f, 1.03381381e-05f, 9.02131160e-06f, 7.85256088e-06f, 6.81816073e-06f,
+  5.90523814e-06f, 5.10178143e-06f, 4.39663609e-06f, 3.43638327e-04f, 3.43209045e-04f, 3.41924431e-04f,
+  3.39794060e-04f, 3.36833851e-04f, 3.33065691e-04f, 3.28517373e-04f, 3.23222106e-04f, 3.17218160e-04f,
+  3.10548407e-04f, 3.03259760e-04f, 2.95402773e-04f, 2.87030853e-04f, 2.78199848e-04f, 2.68967298e-04f,
+  2.59391818e-04f, 2.49532633e-04f, 2.39448826e-04f, 2.29198806e-04f, 2.18839748e-04f, 2.08427184e-04f,
+  1.98014401e-04f, 1.87652113e-04f, 1.77388065e-04f, 1.67266728e-04f, 1.57329094e-04f, 1.47612373e-04f,
+  1.38149961e-04f, 1.28971282e-04f, 1.20101802e-04f, 1.11563037e-04f, 1.03372578e-04f, 9.55442738e-05f,
+  8.80883017e-05f, 8.10113925e-05f, 7.43170021e-05f, 6.80055819e-05f, 6.20747742e-05f, 5.65197297e-05f,
+  5.13333034e-05f, 4.65063931e-05f, 4.20281540e-05f, 3.78863078e-05f, 3.40673614e-05f, 3.05568756e-05f,
+  2.73396963e-05f, 2.44001621e-05f, 2.17223078e-05f, 1.92900570e-05f, 1.70873718e-05f, 1.50984151e-05f,
+  1.33076592e-05f, 1.17000109e-05f, 1.02608919e-05f, 8.97631799e-06f, 7.83295400e-06f, 6.81816073e-06f,
+  5.92001970e-06f, 5.12735414e-06f, 4.42973487e-06f, 3.81747714e-06f, 2.97626626e-04f, 2.97254825e-04f,
+  2.96142214e-04f, 2.94297090e-04f, 2.91733217e-04f, 2.88469600e-04f, 2.84530310e-04f, 2.79944041e-04f,
+  2.74744001e-04f, 2.68967298e-04f, 2.62654561e-04f, 2.55849591e-04f, 2.48598662e-04f, 2.40950074e-04f,
+  2.32953709e-04f, 2.24660354e-04f, 2.16121291e-04f, 2.07387653e-04f, 1.98510053e-04f, 1.89538041e-04f,
+  1.80519666e-04f, 1.71501117e-04f, 1.62526281e-04f, 1.53636545e-04f, 1.44870428e-04f, 1.36263392e-04f,
+  1.27847699e-04f, 1.19652264e-04f, 1.11702575e-04f, 1.04020684e-04f, 9.66252192e-05f, 8.95314297e-05f,
+  8.27512995e-05f, 7.62936543e-05f, 7.01643075e-05f, 6.43662715e-05f, 5.88999210e-05f, 5.37632295e-05f,
+  4.89519771e-05f, 4.44599937e-05f, 4.02793848e-05f, 3.64007647e-05f, 3.28134920e-05f, 2.95058853e-05f,
+  2.64654409e-05f, 2.36790274e-05f, 2.11330844e-05f, 1.88137838e-05f, 1.67071994e-05f, 1.47994460e-05f,
+  1.30768012e-05f, 1.15258199e-05f, 1.01334290e-05f, 8.88700197e-06f, 7.77442710e-06f, 6.78415518e-06f,
+  5.90523814e-06f, 5.12735414e-06f, 4.44082298e-06f, 3.83661245e-06f, 3.30633316e-06f, 2.57132051e-04f,
+  2.56810832e-04f, 2.55849591e-04f, 2.54255516e-04f, 2.52040481e-04f, 2.49220931e-04f, 2.45817588e-04f,
+  2.41855334e-04f, 2.37362794e-04f, 2.32372055e-04f, 2.26918230e-04f, 2.21039125e-04f, 2.14774744e-04f,
+  2.08166821e-04f, 2.01258415e-04f, 1.94093445e-04f, 1.86716192e-04f, 1.79170835e-04f, 1.71501117e-04f,
+  1.63749821e-04f, 1.55958463e-04f, 1.48166961e-04f, 1.40413234e-04f, 1.32733025e-04f, 1.25159597e-04f,
+  1.17723626e-04f, 1.10452966e-04f, 1.03372578e-04f, 9.65045110e-05f, 8.98678045e-05f, 8.34785533e-05f,
+  7.73499341e-05f, 7.14923008e-05f, 6.59132711e-05f, 6.06178728e-05f, 5.56087034e-05f, 5.08860976e-05f,
+  4.64482946e-05f, 4.22916528e-05f, 3.84108425e-05f, 3.47990390e-05f, 3.14481367e-05f, 2.83489426e-05f,
+  2.54913648e-05f, 2.28645968e-05f, 2.04572989e-05f, 1.82577514e-05f, 1.62540109e-05f, 1.44340465e-05f,
+  1.27858584e-05f, 1.12975940e-05f, 9.95763639e-06f, 8.75469141e-06f, 7.67785150e-06f, 6.71665157e-06f,
+  5.86111446e-06f, 5.10178143e-06f, 4.42973487e-06f, 3.83661245e-06f, 3.31460933e-06f, 2.85647911e-06f,
+  2.21592418e-04f, 2.21315597e-04f, 2.20487229e-04f, 2.19113470e-04f, 2.17204593e-04f, 2.14774744e-04f,
+  2.11841791e-04f, 2.08427184e-04f, 2.04555588e-04f, 2.00254639e-04f, 1.95554618e-04f, 1.90488106e-04f,
+  1.85089550e-04f, 1.79394934e-04f, 1.73441396e-04f, 1.67266728e-04f, 1.60909127e-04f, 1.54406662e-04f,
+  1.47797007e-04f, 1.41117052e-04f, 1.34402595e-04f, 1.27687992e-04f, 1.21005956e-04f, 1.14387265e-04f,
+  1.07860607e-04f, 1.01452402e-04f, 9.51866532e-05f, 8.90848896e-05f, 8.31660946e-05f, 7.74466826e-05f,
+  7.19405289e-05f, 6.66589767e-05f, 6.16109610e-05f, 5.68030337e-05f, 5.22395421e-05f, 4.79227201e-05f,
+  4.38528514e-05f, 4.00284225e-05f, 3.64462940e-05f, 3.31018709e-05f, 2.99892727e-05f, 2.71015178e-05f,
+  2.44306812e-05f, 2.19680642e-05f, 1.97043573e-05f, 1.76297835e-05f, 1.57342474e-05f, 1.40074562e-05f,
+  1.24390381e-05f, 1.10186547e-05f, 9.73609167e-06f, 8.58133717e-06f, 7.54465782e-06f, 6.61665354e-06f,
+  5.78830623e-06f, 5.05101752e-06f, 4.39663609e-06f, 3.81747714e-06f, 3.30633316e-06f, 2.85647911e-06f,
+  2.46166951e-06f
+};
+static const float kern_row_20[] = {
+  2.22144168e-04f, 2.57772277e-04f, 2.98367697e-04f, 3.44493979e-04f, 3.96758027e-04f, 4.55810252e-04f,
+  5.22344082e-04f, 5.97095233e-04f, 6.80839468e-04f, 7.74390763e-04f, 8.78597260e-04f, 9.94337373e-04f,
+  1.12251460e-03f, 1.26405060e-03f, 1.41987845e-03f, 1.59093412e-03f, 1.77814614e-03f, 1.98242581e-03f,
+  2.20465567e-03f, 2.44567543e-03f, 2.70626997e-03f, 2.98715453e-03f, 3.28895962e-03f, 3.61221563e-03f,
+  3.95733677e-03f, 4.32460709e-03f, 4.71416255e-03f, 5.12597803e-03f, 5.55985095e-03f, 6.01539062e-03f,
+  6.49200426e-03f, 6.98888674e-03f, 7.50501361e-03f, 8.03913362e-03f, 8.58976413e-03f, 9.15519334e-03f,
+  9.73347854e-03f, 1.03224516e-02f, 1.09197311e-02f, 1.15227262e-02f, 1.21286605e-02f, 1.27345826e-02f,
+  1.33373896e-02f, 1.39338523e-02f, 1.45206433e-02f, 1.50943622e-02f, 1.56515706e-02f, 1.61888264e-02f,
+  1.67027153e-02f, 1.71898883e-02f, 1.76470969e-02f, 1.80712324e-02f, 1.84593555e-02f, 1.88087337e-02f,
+  1.91168729e-02f, 1.93815455e-02f, 1.96008179e-02f, 1.97730772e-02f, 1.98970474e-02f, 1.99718010e-02f,
+  1.99967809e-02f, 1.99718010e-02f, 1.98970474e-02f, 1.97730772e-02f, 1.96008179e-02f, 1.93815455e-02f,
+  1.91168729e-02f, 1.88087337e-02f, 1.84593555e-02f, 1.80712324e-02f, 1.76470969e-02f, 1.71898883e-02f,
+  1.67027153e-02f, 1.61888264e-02f, 1.56515706e-02f, 1.50943622e-02f, 1.45206433e-02f, 1.39338523e-02f,
+  1.33373896e-02f, 1.27345826e-02f, 1.21286605e-02f, 1.15227262e-02f, 1.09197311e-02f, 1.03224516e-02f,
+  9.73347854e-03f, 9.15519334e-03f, 8.58976413e-03f, 8.03913362e-03f, 7.50501361e-03f, 6.98888674e-03f,
+  6.49200426e-03f, 6.01539062e-03f, 5.55985095e-03f, 5.12597803e-03f, 4.71416255e-03f, 4.32460709e-03f,
+  3.95733677e-03f, 3.61221563e-03f, 3.28895962e-03f, 2.98715453e-03f, 2.70626997e-03f, 2.44567543e-03f,
+  2.20465567e-03f, 1.98242581e-03f, 1.77814614e-03f, 1.59093412e-03f, 1.41987845e-03f, 1.26405060e-03f,
+  1.12251460e-03f, 9.94337373e-04f, 8.78597260e-04f, 7.74390763e-04f, 6.80839468e-04f, 5.97095233e-04f,
+  5.22344082e-04f, 4.55810252e-04f, 3.96758027e-04f, 3.44493979e-04f, 2.98367697e-04f, 2.57772277e-04f,
+  2.22144168e-04f
+};
+static const int kern_half_fixed_20[] = {
+  6709, 6700, 6675, 6634, 6576, 6502, 6413, 6310, 6193, 6063, 5920, 5767,
+  5604, 5431, 5251, 5064, 4871, 4675, 4475, 4272, 4069, 3866, 3663, 3463,
+  3265, 3071, 2882, 2697, 2518, 2345, 2178, 2018, 1865, 1720, 1582, 1451,
+  1328, 1212, 1103, 1002, 908, 820, 740, 665, 597, 534, 476, 424,
+  377, 334, 295, 260, 228, 200, 175, 153, 133, 116, 100, 86,
+  75, 6700, 6692, 6667, 6625, 6568, 6494, 6405, 6302, 6185, 6055, 5913,
+  5760, 5597, 5424, 5244, 5058, 4865, 4669, 4469, 4267, 4064, 3861, 3659,
+  3459, 3261, 3068, 2878, 2694, 2515, 2342, 2175, 2016, 1863, 1718, 1580,
+  1449, 1326, 1210, 1102, 1001, 907, 819, 739, 664, 596, 533, 476,
+  424, 376, 333, 294, 259, 228, 200, 175, 153, 133, 115, 100,
+  86, 74, 6675, 6667, 6642, 6601, 6543, 6470, 6381, 6279, 6162, 6032,
+  5891, 5738, 5576, 5404, 5225, 5039, 4847, 4651, 4452, 4251, 4049, 3846,
+  3645, 3446, 3249, 3056, 2867, 2684, 2505, 2333, 2167, 2008, 1856, 1711,
+  1574, 1444, 1321, 1206, 1098, 997, 903, 816, 736, 662, 594, 531,
+  474, 422, 375, 332, 293, 259, 227, 199, 174, 152, 132, 115,
+  100, 86, 74, 6634, 6625, 6601, 6559, 6502, 6430, 6342, 6240, 6124,
+  5995, 5854, 5702, 5541, 5370, 5192, 5007, 4817, 4622, 4424, 4225, 4023,
+  3822, 3622, 3424, 3229, 3037, 2850, 2667, 2490, 2318, 2154, 1996, 1844,
+  1700, 1564, 1435, 1313, 1198, 1091, 991, 898, 811, 731, 658, 590,
+  528, 471, 419, 372, 330, 291, 257, 226, 198, 173, 151, 132,
+  114, 99, 86, 74, 6576, 6568, 6543, 6502, 6446, 6374, 6286, 6185,
+  6070, 5943, 5803, 5653, 5493, 5324, 5147, 4964, 4775, 4582, 4386, 4188,
+  3988, 3789, 3591, 3394, 3201, 3011, 2825, 2644, 2468, 2298, 2135, 1978,
+  1828, 1686, 1550, 1422, 1301, 1188, 1082, 982, 890, 804, 725, 652,
+  585, 523, 467, 416, 369, 327, 289, 255, 224, 196, 172, 150,
+  130, 113, 98, 85, 73, 6502, 6494, 6470, 6430, 6374, 6302, 6216,
+  6116, 6002, 5876, 5738, 5590, 5431, 5264, 5089, 4908, 4722, 4531, 4337,
+  4141, 3944, 3747, 3551, 3357, 3165, 2977, 2793, 2614, 2440, 2273, 2111,
+  1956, 1808, 1667, 1533, 1406, 1287, 1175, 1069, 971, 880, 795, 717,
+  645, 578, 517, 462, 411, 365, 323, 286, 252, 221, 194, 170,
+  148, 129, 112, 97, 84, 72, 6413, 6405, 6381, 6342, 6286, 6216,
+  6131, 6032, 5920, 5796, 5660, 5513, 5357, 5192, 5020, 4841, 4657, 4469,
+  4278, 4084, 3890, 3696, 3502, 3311, 3122, 2936, 2755, 2578, 2407, 2242,
+  2082, 1929, 1783, 1644, 1512, 1387, 1269, 1159, 1055, 958, 868, 784,
+  707, 636, 570, 510, 455, 405, 360, 319, 282, 248, 218, 192,
+  168, 146, 127, 110, 96, 83, 71, 6310, 6302, 6279, 6240, 6185,
+  6116, 6032, 5935, 5825, 5702, 5569, 5424, 5271, 5108, 4939, 4763, 4582,
+  4397, 4209, 4018, 3827, 3636, 3446, 3257, 3071, 2889, 2711, 2537, 2368,
+  2205, 2049, 1898, 1754, 1618, 1488, 1365, 1249, 1140, 1038, 943, 854,
+  772, 696, 626, 561, 502, 448, 399, 354, 314, 277, 244, 215,
+  188, 165, 144, 125, 109, 94, 81, 70, 6193, 6185, 6162, 6124,
+  6070, 6002, 5920, 5825, 5717, 5597, 5465, 5324, 5173, 5014, 4847, 4675,
+  4497, 4315, 4131, 3944, 3756, 3569, 3382, 3197, 3014, 2835, 2660, 2490,
+  2324, 2164, 2011, 1863, 1722, 1587, 1460, 1339, 1226, 1119, 1019, 925,
+  838, 757, 683, 614, 551, 493, 440, 391, 348, 308, 272, 240,
+  211, 185, 162, 141, 123, 107, 92, 80, 69, 6063, 6055, 6032,
+  5995, 5943, 5876, 5796, 5702, 5597, 5479, 5350, 5212, 5064, 4908, 4745,
+  4576, 4402, 4225, 4044, 3861, 3677, 3493, 3311, 3130, 2951, 2776, 2604,
+  2437, 2275, 2119, 1968, 1824, 1686, 1554, 1429, 1311, 1200, 1095, 997,
+  906, 820, 741, 668, 601, 539, 482, 430, 383, 340, 301, 266,
+  235, 206, 181, 158, 138, 120, 104, 90, 78, 67, 5920, 5913,
+  5891, 5854, 5803, 5738, 5660, 5569, 5465, 5350, 5225, 5089, 4945, 4793,
+  4634, 4469, 4299, 4125, 3949, 3770, 3591, 3411, 3233, 3056, 2882, 2711,
+  2543, 2380, 2222, 2069, 1922, 1781, 1646, 1518, 1396, 1280, 1172, 1069,
+  974, 884, 801, 724, 653, 587, 526, 471, 420, 374, 332, 294,
+  260, 229, 202, 177, 155, 135, 117, 102, 88, 76, 66, 5767,
+  5760, 5738, 5702, 5653, 5590, 5513, 5424, 5324, 5212, 5089, 4957, 4817,
+  4669, 4514, 4353, 4188, 4018, 3846, 3673, 3498, 3323, 3149, 2977, 2807,
+  2640, 2477, 2318, 2164, 2016, 1872, 1735, 1603, 1478, 1360, 1247, 1141,
+  1042, 949, 861, 780, 705, 636, 572, 513, 459, 409, 365, 324,
+  287, 253, 223, 196, 172, 151, 131, 114, 99, 86, 74, 64,
+  5604, 5597, 5576, 5541, 5493, 5431, 5357, 5271, 5173, 5064, 4945, 4817,
+  4680, 4536, 4386, 4230, 4069, 3905, 3737, 3569, 3399, 3229, 3060, 2893,
+  2728, 2565, 2407, 2253, 2103, 1958, 1819, 1686, 1558, 1436, 1321, 1212,
+  1109, 1012, 922, 837, 758, 685, 618, 556, 498, 446, 398, 354,
+  315, 279, 246, 217, 191, 167, 146, 128, 111, 97, 84, 72,
+  62, 5431, 5424, 5404, 5370, 5324, 5264, 5192, 5108, 5014, 4908, 4793,
+  4669, 4536, 4397, 4251, 4100, 3944, 3784, 3622, 3459, 3294, 3130, 2966,
+  2804, 2644, 2487, 2333, 2183, 2038, 1898, 1763, 1634, 1510, 1392, 1280,
+  1175, 1075, 981, 893, 811, 735, 664, 599, 538, 483, 432, 386,
+  343, 305, 270, 239, 210, 185, 162, 142, 124, 108, 94, 81,
+  70, 60, 5251, 5244, 5225, 5192, 5147, 5089, 5020, 4939, 4847, 4745,
+  4634, 4514, 4386, 4251, 4110, 3964, 3813, 3659, 3502, 3344, 3185, 3026,
+  2867, 2711, 2556, 2404, 2256, 2111, 1971, 1835, 1705, 1580, 1460, 1346,
+  1238, 1136, 1039, 949, 864, 784, 711, 642, 579, 521, 467, 418,
+  373, 332, 295, 261, 231, 203, 179, 157, 137, 120, 104, 90,
+  78, 68, 58, 5064, 5058, 5039, 5007, 4964, 4908, 4841, 4763, 4675,
+  4576, 4469, 4353, 4230, 4100, 3964, 3822, 3677, 3529, 3378, 3225, 3071,
+  2918, 2765, 2614, 2465, 2318, 2175, 2036, 1901, 1770, 1644, 1523, 1408,
+  1298, 1194, 1095, 1002, 915, 833, 756, 685, 619, 558, 502, 450,
+  403, 360, 320, 284, 252, 222, 196, 172, 151, 132, 115, 100,
+  87, 76, 65, 56, 4871, 4865, 4847, 4817, 4775, 4722, 4657, 4582,
+  4497, 4402, 4299, 4188, 4069, 3944, 3813, 3677, 3537, 3394, 3249, 3102,
+  2955, 2807, 2660, 2515, 2371, 2230, 2093, 1958, 1828, 1703, 1582, 1465,
+  1354, 1249, 1148, 1054, 964, 880, 801, 728, 659, 596, 537, 483,
+  433, 388, 346, 308, 273, 242, 214, 189, 166, 145, 127, 111,
+  97, 84, 73, 63, 54, 4675, 4669, 4651, 4622, 4582, 4531, 4469,
+  4397, 4315, 4225, 4125, 4018, 3905, 3784, 3659, 3529, 3394, 3257, 3118,
+  2977, 2835, 2694, 2553, 2413, 2275, 2140, 2008, 1879, 1754, 1634, 1518,
+  1406, 1300, 1198, 1102, 1011, 925, 844, 769, 698, 633, 572, 515,
+  463, 416, 372, 332, 295, 262, 232, 205, 181, 159, 140, 122,
+  107, 93, 81, 70, 60, 52, 4475, 4469, 4452, 4424, 4386, 4337,
+  4278, 4209, 4131, 4044, 3949, 3846, 3737, 3622, 3502, 3378, 3249, 3118,
+  2984, 2850, 2714, 2578, 2443, 2310, 2178, 2049, 1922, 1799, 1679, 1564,
+  1453, 1346, 1244, 1147, 1055, 968, 886, 808, 736, 668, 606, 547,
+  493, 444, 398, 356, 318, 283, 251, 222, 197, 173, 152, 134,
+  117, 102, 89, 77, 67, 58, 50, 4272, 4267, 4251, 4225, 4188,
+  4141, 4084, 4018, 3944, 3861, 3770, 3673, 3569, 3459, 3344, 3225, 3102,
+  2977, 2850, 2721, 2591, 2462, 2333, 2205, 2080, 1956, 1835, 1718, 1603,
+  1493, 1387, 1285, 1188, 1095, 1007, 924, 845, 772, 703, 638, 578,
+  523, 471, 424, 380, 340, 303, 270, 240, 212, 188, 165, 145,
+  128, 112, 97, 85, 74, 64, 55, 47, 4069, 4064, 4049, 4023,
+  3988, 3944, 3890, 3827, 3756, 3677, 3591, 3498, 3399, 3294, 3185, 3071,
+  2955, 2835, 2714, 2591, 2468, 2345, 2222, 2100, 1981, 1863, 1748, 1636,
+  1527, 1422, 1321, 1224, 1131, 1043, 959, 880, 805, 735, 669, 608,
+  551, 498, 449, 403, 362, 324, 289, 257, 228, 202, 179, 158,
+  139, 121, 106, 93, 81, 70, 61, 52, 45, 3866, 3861, 3846,
+  3822, 3789, 3747, 3696, 3636, 3569, 3493, 3411, 3323, 3229, 3130, 3026,
+  2918, 2807, 2694, 2578, 2462, 2345, 2228, 2111, 1996, 1882, 1770, 1661,
+  1554, 1451, 1351, 1255, 1163, 1075, 991, 911, 836, 765, 698, 636,
+  577, 523, 473, 426, 383, 344, 308, 274, 244, 217, 192, 170,
+  150, 132, 115, 101, 88, 77, 67, 58, 50, 43, 3663, 3659,
+  3645, 3622, 3591, 3551, 3502, 3446, 3382, 3311, 3233, 3149, 3060, 2966,
+  2867, 2765, 2660, 2553, 2443, 2333, 2222, 2111, 2001, 1891, 1783, 1677,
+  1574, 1473, 1375, 1280, 1189, 1102, 1019, 939, 864, 792, 725, 662,
+  603, 547, 496, 448, 404, 363, 326, 291, 260, 232, 206, 182,
+  161, 142, 125, 109, 96, 84, 73, 63, 55, 47, 41, 3463,
+  3459, 3446, 3424, 3394, 3357, 3311, 3257, 3197, 3130, 3056, 2977, 2893,
+  2804, 2711, 2614, 2515, 2413, 2310, 2205, 2100, 1996, 1891, 1788, 1686,
+  1586, 1488, 1392, 1300, 1210, 1124, 1042, 963, 888, 816, 749, 685,
+  626, 570, 517, 469, 424, 382, 343, 308, 276, 246, 219, 194,
+  172, 152, 134, 118, 103, 90, 79, 69, 60, 52, 45, 38,
+  3265, 3261, 3249, 3229, 3201, 3165, 3122, 3071, 3014, 2951, 2882, 2807,
+  2728, 2644, 2556, 2465, 2371, 2275, 2178, 2080, 1981, 1882, 1783, 1686,
+  1589, 1495, 1403, 1313, 1226, 1141, 1060, 982, 908, 837, 770, 706,
+  646, 590, 537, 488, 442, 399, 360, 324, 290, 260, 232, 206,
+  183, 162, 143, 126, 111, 98, 85, 74, 65, 56, 49, 42,
+  36, 3071, 3068, 3056, 3037, 3011, 2977, 2936, 2889, 2835, 2776, 2711,
+  2640, 2565, 2487, 2404, 2318, 2230, 2140, 2049, 1956, 1863, 1770, 1677,
+  1586, 1495, 1406, 1319, 1235, 1153, 1073, 997, 924, 854, 787, 724,
+  664, 608, 555, 505, 459, 416, 376, 339, 304, 273, 244, 218,
+  194, 172, 153, 135, 119, 105, 92, 80, 70, 61, 53, 46,
+  40, 34, 2882, 2878, 2867, 2850, 2825, 2793, 2755, 2711, 2660, 2604,
+  2543, 2477, 2407, 2333, 2256, 2175, 2093, 2008, 1922, 1835, 1748, 1661,
+  1574, 1488, 1403, 1319, 1238, 1159, 1082, 1007, 936, 867, 801, 739,
+  679, 623, 570, 521, 474, 430, 390, 352, 318, 286, 256, 229,
+  205, 182, 162, 143, 127, 112, 98, 86, 75, 66, 57, 50,
+  43, 37, 32, 2697, 2694, 2684, 2667, 2644, 2614, 2578, 2537, 2490,
+  2437, 2380, 2318, 2253, 2183, 2111, 2036, 1958, 1879, 1799, 1718, 1636,
+  1554, 1473, 1392, 1313, 1235, 1159, 1084, 1012, 943, 876, 811, 750,
+  691, 636, 583, 534, 487, 444, 403, 365, 330, 297, 267, 240,
+  215, 192, 170, 151, 134, 118, 104, 92, 81, 70, 61, 54,
+  46, 40, 35, 30, 2518, 2515, 2505, 2490, 2468, 2440, 2407, 2368,
+  2324, 2275, 2222, 2164, 2103, 2038, 1971, 1901, 1828, 1754, 1679, 1603,
+  1527, 1451, 1375, 1300, 1226, 1153, 1082, 1012, 945, 880, 817, 757,
+  700, 645, 594, 545, 498, 455, 414, 376, 341, 308, 278, 250,
+  224, 200, 179, 159, 141, 125, 111, 98, 86, 75, 66, 57,
+  50, 43, 38, 32, 28, 2345, 2342, 2333, 2318, 2298, 2273, 2242,
+  2205, 2164, 2119, 2069, 2016, 1958, 1898, 1835, 1770, 1703, 1634, 1564,
+  1493, 1422, 1351, 1280, 1210, 1141, 1073, 1007, 943, 880, 819, 761,
+  705, 652, 601, 553, 507, 464, 424, 386, 350, 317, 287, 259,
+  232, 208, 187, 166, 148, 132, 117, 103, 91, 80, 70, 61,
+  53, 47, 40, 35, 30, 26, 2178, 2175, 2167, 2154, 2135, 2111,
+  2082, 2049, 2011, 1968, 1922, 1872, 1819, 1763, 1705, 1644, 1582, 1518,
+  1453, 1387, 1321, 1255, 1189, 1124, 1060, 997, 936, 876, 817, 761,
+  707, 655, 606, 558, 513, 471, 431, 393, 358, 325, 295, 266,
+  240, 216, 194, 173, 155, 138, 122, 108, 96, 84, 74, 65,
+  57, 50, 43, 38, 32, 28, 24, 2018, 2016, 2008, 1996, 1978,
+  1956, 1929, 1898, 1863, 1824, 1781, 1735, 1686, 1634, 1580, 1523, 1465,
+  1406, 1346, 1285, 1224, 1163, 1102, 1042, 982, 924, 867, 811, 757,
+  705, 655, 607, 561, 517, 476, 436, 399, 365, 332, 301, 273,
+  247, 222, 200, 179, 161, 143, 128, 113, 100, 89, 78, 69,
+  60, 53, 46, 40, 35, 30, 26, 22, 1865, 1863, 1856, 1844,
+  1828, 1808, 1783, 1754, 1722, 1686, 1646, 1603, 1558, 1510, 1460, 1408,
+  1354, 1300, 1244, 1188, 1131, 1075, 1019, 963, 908, 854, 801, 750,
+  700, 652, 606, 561, 519, 478, 440, 403, 369, 337, 307, 279,
+  252, 228, 206, 185, 166, 148, 132, 118, 105, 93, 82, 72,
+  64, 56, 49, 43, 37, 32, 28, 24, 21, 1720, 1718, 1711,
+  1700, 1686, 1667, 1644, 1618, 1587, 1554, 1518, 1478, 1436, 1392, 1346,
+  1298, 1249, 1198, 1147, 1095, 1043, 991, 939, 888, 837, 787, 739,
+  691, 645, 601, 558, 517, 478, 441, 405, 372, 340, 311, 283,
+  257, 233, 210, 190, 170, 153, 137, 122, 109, 97, 86, 76,
+  67, 59, 51, 45, 39, 34, 30, 26, 22, 19, 1582, 1580,
+  1574, 1564, 1550, 1533, 1512, 1488, 1460, 1429, 1396, 1360, 1321, 1280,
+  1238, 1194, 1148, 1102, 1055, 1007, 959, 911, 864, 816, 770, 724,
+  679, 636, 594, 553, 513, 476, 440, 405, 373, 342, 313, 286,
+  260, 236, 214, 193, 174, 157, 141, 126, 112, 100, 89, 79,
+  69, 61, 54, 47, 41, 36, 31, 27, 24, 20, 18, 1451,
+  1449, 1444, 1435, 1422, 1406, 1387, 1365, 1339, 1311, 1280, 1247, 1212,
+  1175, 1136, 1095, 1054, 1011, 968, 924, 880, 836, 792, 749, 706,
+  664, 623, 583, 545, 507, 471, 436, 403, 372, 342, 314, 287,
+  262, 239, 217, 196, 177, 160, 144, 129, 115, 103, 92, 81,
+  72, 64, 56, 49, 43, 38, 33, 29, 25, 22, 19, 16,
+  1328, 1326, 1321, 1313, 1301, 1287, 1269, 1249, 1226, 1200, 1172, 1141,
+  1109, 1075, 1039, 1002, 964, 925, 886, 845, 805, 765, 725, 685,
+  646, 608, 570, 534, 498, 464, 431, 399, 369, 340, 313, 287,
+  263, 240, 218, 198, 180, 162, 146, 132, 118, 106, 94, 84,
+  75, 66, 58, 51, 45, 40, 35, 30, 26, 23, 20, 17,
+  15, 1212, 1210, 1206, 1198, 1188, 1175, 1159, 1140, 1119, 1095, 1069,
+  1042, 1012, 981, 949, 915, 880, 844, 808, 772, 735, 698, 662,
+  626, 590, 555, 521, 487, 455, 424, 393, 365, 337, 311, 286,
+  262, 240, 219, 199, 181, 164, 148, 134, 120, 108, 96, 86,
+  77, 68, 60, 53, 47, 41, 36, 32, 28, 24, 21, 18,
+  16, 13, 1103, 1102, 1098, 1091, 1082, 1069, 1055, 1038, 1019, 997,
+  974, 949, 922, 893, 864, 833, 801, 769, 736, 703, 669, 636,
+  603, 570, 537, 505, 474, 444, 414, 386, 358, 332, 307, 283,
+  260, 239, 218, 199, 181, 165, 149, 135, 122, 109, 98, 88,
+  78, 70, 62, 55, 48, 43, 38, 33, 29, 25, 22, 19,
+  16, 14, 12, 1002, 1001, 997, 991, 982, 971, 958, 943, 925,
+  906, 884, 861, 837, 811, 784, 756, 728, 698, 668, 638, 608,
+  577, 547, 517, 488, 459, 430, 403, 376, 350, 325, 301, 279,
+  257, 236, 217, 198, 181, 165, 150, 136, 123, 110, 99, 89,
+  80, 71, 63, 56, 50, 44, 39, 34, 30, 26, 23, 20,
+  17, 15, 13, 11, 908, 907, 903, 898, 890, 880, 868, 854,
+  838, 820, 801, 780, 758, 735, 711, 685, 659, 633, 606, 578,
+  551, 523, 496, 469, 442, 416, 390, 365, 341, 317, 295, 273,
+  252, 233, 214, 196, 180, 164, 149, 136, 123, 111, 100, 90,
+  81, 72, 64, 57, 51, 45, 40, 35, 31, 27, 24, 21,
+  18, 16, 14, 12, 10, 820, 819, 816, 811, 804, 795, 784,
+  772, 757, 741, 724, 705, 685, 664, 642, 619, 596, 572, 547,
+  523, 498, 473, 448, 424, 399, 376, 352, 330, 308, 287, 266,
+  247, 228, 210, 193, 177, 162, 148, 135, 123, 111, 100, 90,
+  81, 73, 65, 58, 52, 46, 41, 36, 32, 28, 24, 21,
+  19, 16, 14, 12, 11, 9, 740, 739, 736, 731, 725, 717,
+  707, 696, 683, 668, 653, 636, 618, 599, 579, 558, 537, 515,
+  493, 471, 449, 426, 404, 382, 360, 339, 318, 297, 278, 259,
+  240, 222, 206, 190, 174, 160, 146, 134, 122, 110, 100, 90,
+  82, 73, 66, 59, 53, 47, 42, 37, 32, 29, 25, 22,
+  19, 17, 15, 13, 11, 10, 8, 665, 664, 662, 658, 652,
+  645, 636, 626, 614, 601, 587, 572, 556, 538, 521, 502, 483,
+  463, 444, 424, 403, 383, 363, 343, 324, 304, 286, 267, 250,
+  232, 216, 200, 185, 170, 157, 144, 132, 120, 109, 99, 90,
+  81, 73, 66, 59, 53, 47, 42, 37, 33, 29, 26, 23,
+  20, 17, 15, 13, 11, 10, 9, 7, 597, 596, 594, 590,
+  585, 578, 570, 561, 551, 539, 526, 513, 498, 483, 467, 450,
+  433, 416, 398, 380, 362, 344, 326, 308, 290, 273, 256, 240,
+  224, 208, 194, 179, 166, 153, 141, 129, 118, 108, 98, 89,
+  81, 73, 66, 59, 53, 47, 42, 38, 33, 30, 26, 23,
+  20, 18, 16, 14, 12, 10, 9, 8, 7, 534, 533, 531,
+  528, 523, 517, 510, 502, 493, 482, 471, 459, 446, 432, 418,
+  403, 388, 372, 356, 340, 324, 308, 291, 276, 260, 244, 229,
+  215, 200, 187, 173, 161, 148, 137, 126, 115, 106, 96, 88,
+  80, 72, 65, 59, 53, 47, 42, 38, 34, 30, 27, 23,
+  21, 18, 16, 14, 12, 11, 9, 8, 7, 6, 476, 476,
+  474, 471, 467, 462, 455, 448, 440, 430, 420, 409, 398, 386,
+  373, 360, 346, 332, 318, 303, 289, 274, 260, 246, 232, 218,
+  205, 192, 179, 166, 155, 143, 132, 122, 112, 103, 94, 86,
+  78, 71, 64, 58, 53, 47, 42, 38, 34, 30, 27, 24,
+  21, 18, 16, 14, 12, 11, 9, 8, 7, 6, 5, 424,
+  424, 422, 419, 416, 411, 405, 399, 391, 383, 374, 365, 354,
+  343, 332, 320, 308, 295, 283, 270, 257, 244, 232, 219, 206,
+  194, 182, 170, 159, 148, 138, 128, 118, 109, 100, 92, 84,
+  77, 70, 63, 57, 52, 47, 42, 38, 34, 30, 27, 24,
+  21, 19, 16, 14, 13, 11, 10, 8, 7, 6, 5, 5,
+  377, 376, 375, 372, 369, 365, 360, 354, 348, 340, 332, 324,
+  315, 305, 295, 284, 273, 262, 251, 240, 228, 217, 206, 194,
+  183, 172, 162, 151, 141, 132, 122, 113, 105, 97, 89, 81,
+  75, 68, 62, 56, 51, 46, 42, 37, 33, 30, 27, 24,
+  21, 19, 17, 15, 13, 11, 10, 9, 7, 6, 6, 5,
+  4, 334, 333, 332, 330, 327, 323, 319, 314, 308, 301, 294,
+  287, 279, 270, 261, 252, 242, 232, 222, 212, 202, 192, 182,
+  172, 162, 153, 143, 134, 125, 117, 108, 100, 93, 86, 79,
+  72, 66, 60, 55, 50, 45, 41, 37, 33, 30, 27, 24,
+  21, 19, 17, 15, 13, 11, 10, 9, 8, 7, 6, 5,
+  4, 4, 295, 294, 293, 291, 289, 286, 282, 277, 272, 266,
+  260, 253, 246, 239, 231, 222, 214, 205, 197, 188, 179, 170,
+  161, 152, 143, 135, 127, 118, 111, 103, 96, 89, 82, 76,
+  69, 64, 58, 53, 48, 44, 40, 36, 32, 29, 26, 23,
+  21, 19, 17, 15, 13, 11, 10, 9, 8, 7, 6, 5,
+  4, 4, 3, 260, 259, 259, 257, 255, 252, 248, 244, 240,
+  235, 229, 223, 217, 210, 203, 196, 189, 181, 173, 165, 158,
+  150, 142, 134, 126, 119, 112, 104, 98, 91, 84, 78, 72,
+  67, 61, 56, 51, 47, 43, 39, 35, 32, 29, 26, 23,
+  21, 18, 16, 15, 13, 11, 10, 9, 8, 7, 6, 5,
+  4, 4, 3, 3, 228, 228, 227, 226, 224, 221, 218, 215,
+  211, 206, 202, 196, 191, 185, 179, 172, 166, 159, 152, 145,
+  139, 132, 125, 118, 111, 105, 98, 92, 86, 80, 74, 69,
+  64, 59, 54, 49, 45, 41, 38, 34, 31, 28, 25, 23,
+  20, 18, 16, 14, 13, 11, 10, 9, 8, 7, 6, 5,
+  5, 4, 3, 3, 3, 200, 200, 199, 198, 196, 194, 192,
+  188, 185, 181, 177, 172, 167, 162, 157, 151, 145, 140, 134,
+  128, 121, 115, 109, 103, 98, 92, 86, 81, 75, 70, 65,
+  60, 56, 51, 47, 43, 40, 36, 33, 30, 27, 24, 22,
+  20, 18, 16, 14, 13, 11, 10, 9, 8, 7, 6, 5,
+  5, 4, 3, 3, 3, 2, 175, 175, 174, 173, 172, 170,
+  168, 165, 162, 158, 155, 151, 146, 142, 137, 132, 127, 122,
+  117, 112, 106, 101, 96, 90, 85, 80, 75, 70, 66, 61,
+  57, 53, 49, 45, 41, 38, 35, 32, 29, 26, 24, 21,
+  19, 17, 16, 14, 12, 11, 10, 9, 8, 7, 6, 5,
+  5, 4, 3, 3, 3, 2, 2, 153, 153, 152, 151, 150,
+  148, 146, 144, 141, 138, 135, 131, 128, 124, 120, 115, 111,
+  107, 102, 97, 93, 88, 84, 79, 74, 70, 66, 61, 57,
+  53, 50, 46, 43, 39, 36, 33, 30, 28, 25, 23, 21,
+  19, 17, 15, 14, 12, 11, 10, 9, 8, 7, 6, 5,
+  5, 4, 3, 3, 3, 2, 2, 2, 133, 133, 132, 132,
+  130, 129, 127, 125, 123, 120, 117, 114, 111, 108, 104, 100,
+  97, 93, 89, 85, 81, 77, 73, 69, 65, 61, 57, 54,
+  50, 47, 43, 40, 37, 34, 31, 29, 26, 24, 22, 20,
+  18, 16, 15, 13, 12, 11, 9, 8, 7, 7, 6, 5,
+  5, 4, 3, 3, 3, 2, 2, 2, 1, 116, 115, 115,
+  114, 113, 112, 110, 109, 107, 104, 102, 99, 97, 94, 90,
+  87, 84, 81, 77, 74, 70, 67, 63, 60, 56, 53, 50,
+  46, 43, 40, 38, 35, 32, 30, 27, 25, 23, 21, 19,
+  17, 16, 14, 13, 11, 10, 9, 8, 7, 6, 6, 5,
+  4, 4, 3, 3, 3, 2, 2, 2, 1, 1, 100, 100,
+  100, 99, 98, 97, 96, 94, 92, 90, 88, 86, 84, 81,
+  78, 76, 73, 70, 67, 64, 61, 58, 55, 52, 49, 46,
+  43, 40, 38, 35, 32, 30, 28, 26, 24, 22, 20, 18,
+  16, 15, 14, 12, 11, 10, 9, 8, 7, 6, 6, 5,
+  4, 4, 3, 3, 3, 2, 2, 2, 1, 1, 1, 86,
+  86, 86, 86, 85, 84, 83, 81, 80, 78, 76, 74, 72,
+  70, 68, 65, 63, 60, 58, 55, 52, 50, 47, 45, 42,
+  40, 37, 35, 32, 30, 28, 26, 24, 22, 20, 19, 17,
+  16, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 5,
+  4, 4, 3, 3, 3, 2, 2, 2, 1, 1, 1, 1,
+  75, 74, 74, 74, 73, 72, 71, 70, 69, 67, 66, 64,
+  62, 60, 58, 56, 54, 52, 50, 47, 45, 43, 41, 38,
+  36, 34, 32, 30, 28, 26, 24, 22, 21, 19, 18, 16,
+  15, 13, 12, 11, 10, 9, 8, 7, 7, 6, 5, 5,
+  4, 4, 3, 3, 3, 2, 2, 2, 1, 1, 1, 1,
+  1
+};
+static const int kern_row_fixed_20[] = {
+  3727, 4325, 5006, 5780, 6656, 7647, 8763, 10018, 11423, 12992, 14740, 16682,
+  18833, 21207, 23822, 26691, 29832, 33260, 36988, 41032, 45404, 50116, 55180, 60603,
+  66393, 72555, 79091, 86000, 93279, 100922, 108918, 117254, 125913, 134874, 144112, 153599,
+  163301, 173182, 183203, 193319, 203485, 213651, 223764, 233771, 243616, 253241, 262590, 271603,
+  280225, 288398, 296069, 303185, 309697, 315558, 320728, 325168, 328847, 331737, 333817, 335071,
+  335490, 335071, 333817, 331737, 328847, 325168, 320728, 315558, 309697, 303185, 296069, 288398,
+  280225, 271603, 262590, 253241, 243616, 233771, 223764, 213651, 203485, 193319, 183203, 173182,
+  163301, 153599, 144112, 134874, 125913, 117254, 108918, 100922, 93279, 86000, 79091, 72555,
+  66393, 60603, 55180, 50116, 45404, 41032, 36988, 33260, 29832, 26691, 23822, 21207,
+  18833, 16682, 14740, 12992, 11423, 10018, 8763, 7647, 6656, 5780, 5006, 4325,
+  3727
+};
+
+static const KERN_ENTRY kern_table[] = {
+  { 6.38844360e+02f, kern_half_1, kern_row_1, kern_half_fixed_1, kern_row_fixed_1 },
+  { 1.27576355e+03f, kern_half_2, kern_row_2, kern_half_fixed_2, kern_row_fixed_2 },
+  { 1.91195227e+03f, kern_half_3, kern_row_3, kern_half_fixed_3, kern_row_fixed_3 },
+  { 2.54792432e+03f, kern_half_4, kern_row_4, kern_half_fixed_4, kern_row_fixed_4 },
+  { 3.18380737e+03f, kern_half_5, kern_row_5, kern_half_fixed_5, kern_row_fixed_5 },
+  { 3.81964258e+03f, kern_half_6, kern_row_6, kern_half_fixed_6, kern_row_fixed_6 },
+  { 4.45545020e+03f, kern_half_7, kern_row_7, kern_half_fixed_7, kern_row_fixed_7 },
+  { 5.09124463e+03f, kern_half_8, kern_row_8, kern_half_fixed_8, kern_row_fixed_8 },
+  { 5.72703467e+03f, kern_half_9, kern_row_9, kern_half_fixed_9, kern_row_fixed_9 },
+  { 6.36280762e+03f, kern_half_10, kern_row_10, kern_half_fixed_10, kern_row_fixed_10 },
+  { 6.99860352e+03f, kern_half_11, kern_row_11, kern_half_fixed_11, kern_row_fixed_11 },
+  { 7.63433252e+03f, kern_half_12, kern_row_12, kern_half_fixed_12, kern_row_fixed_12 },
+  { 8.27008984e+03f, kern_half_13, kern_row_13, kern_half_fixed_13, kern_row_fixed_13 },
+  { 8.90589844e+03f, kern_half_14, kern_row_14, kern_half_fixed_14, kern_row_fixed_14 },
+  { 9.54161426e+03f, kern_half_15, kern_row_15, kern_half_fixed_15, kern_row_fixed_15 },
+  { 1.01774023e+04f, kern_half_16, kern_row_16, kern_half_fixed_16, kern_row_fixed_16 },
+  { 1.08131025e+04f, kern_half_17, kern_row_17, kern_half_fixed_17, kern_row_fixed_17 },
+  { 1.14488926e+04f, kern_half_18, kern_row_18, kern_half_fixed_18, kern_row_fixed_18 },
+  { 1.20847090e+04f, kern_half_19, kern_row_19, kern_half_fixed_19, kern_row_fixed_19 },
+  { 1.27204766e+04f, kern_half_20, kern_row_20, kern_half_fixed_20, kern_row_fixed_20 }
+};
+
+#endif /* _KERN_TABLE_H_ */
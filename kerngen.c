@@ -0,0 +1,114 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "const.h"
+#include "kern.h"
+
+/*
+ * KERNGEN
+ * ------
+ *
+ * Generates kern_table.h: the weights of the gaussian kernel of every
+ * standard deviation from MIN_STDEV to MAX_STDEV, in the folded and one
+ * dimensional forms and in fixed point, so that create_kernel only has to
+ * look them up.  The weights are computed by create_kernel itself, built
+ * without the table (kern_gen.o), so a tabulated kernel is exactly the
+ * kernel that would otherwise be computed.
+ *
+ * compilation:
+ *   make kern_table.h (a dependency of kern.o, so built as needed)
+ *
+ * usage:
+ *   kerngen > kern_table.h
+ */
+
+/* Constants */
+#define KERNGEN_PER_LINE  6       /* Values per line of the table */
+
+/* print_floats
+ * ------
+ * Print an array of floats as a C definition, with enough digits to read
+ * back the same floats
+ *
+ * name:    name of the array
+ * stdev:   standard deviation, appended to the name
+ * values:  values
+ * n:       number of values
+ *
+ */
+static void print_floats(const char *name, int stdev, const float *values,
+  int n) {
+
+  int i;
+
+  printf("static const float %s_%d[] = {", name, stdev);
+  for (i = 0; i < n; i++) {
+    printf("%s%.8ef", i % KERNGEN_PER_LINE == 0 ? "\n  " : " ",
+      (double) values[i]);
+    if (i < n - 1) putchar(',');
+  }
+  printf("\n};\n");
+
+}
+
+/* print_ints
+ * ------
+ * Print an array of ints as a C definition
+ *
+ * name:    name of the array
+ * stdev:   standard deviation, appended to the name
+ * values:  values
+ * n:       number of values
+ *
+ */
+static void print_ints(const char *name, int stdev, const int *values,
+  int n) {
+
+  int i;
+
+  printf("static const int %s_%d[] = {", name, stdev);
+  for (i = 0; i < n; i++) {
+    printf("%s%d", i % (2 * KERNGEN_PER_LINE) == 0 ? "\n  " : " ",
+      values[i]);
+    if (i < n - 1) putchar(',');
+  }
+  printf("\n};\n");
+
+}
+
+int main(void) {
+
+  KERNEL *kern;
+  float colour_max[MAX_STDEV + 1];
+  int stdev, n;
+
+  printf("#ifndef _KERN_TABLE_H_\n#define _KERN_TABLE_H_\n\n");
+  printf("/*\n * kern_table.h\n * ------------\n");
+  printf(" * Gaussian kernels for standard deviations %d to %d, generated "
+    "by\n * kerngen (see kerngen.c): do not edit.\n *\n */\n\n", MIN_STDEV,
+    MAX_STDEV);
+  printf("#define KERN_TABLE_MIN %d\n#define KERN_TABLE_MAX %d\n",
+    MIN_STDEV, MAX_STDEV);
+
+  for (stdev = MIN_STDEV; stdev <= MAX_STDEV; stdev++) {
+    if ((kern = create_kernel(stdev)) == NULL) return EXIT_FAILURE;
+    n = (kern->orig + 1) * (kern->orig + 1);
+    printf("\n");
+    print_floats("kern_half", stdev, kern->half, n);
+    print_floats("kern_row", stdev, kern->row, kern->size);
+    print_ints("kern_half_fixed", stdev, kern->half_fixed, n);
+    print_ints("kern_row_fixed", stdev, kern->row_fixed, kern->size);
+    colour_max[stdev] = kern->colour_max;
+    free_kernel(kern);
+  }
+
+  printf("\nstatic const KERN_ENTRY kern_table[] = {\n");
+  for (stdev = MIN_STDEV; stdev <= MAX_STDEV; stdev++) {
+    printf("  { %.8ef, kern_half_%d, kern_row_%d, kern_half_fixed_%d, "
+      "kern_row_fixed_%d }%s\n", (double) colour_max[stdev], stdev, stdev,
+      stdev, stdev, stdev < MAX_STDEV ? "," : "");
+  }
+  printf("};\n\n#endif /* _KERN_TABLE_H_ */\n");
+
+  return fflush(stdout) == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+
+}
@@ -0,0 +1,183 @@
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "const.h"
+#include "counters.h"
+#include "gaussianLib.h"
+#include "init.h"
+#include "kern.h"
+#include "local.h"
+#include "qdbmp.h"
+#include "timing.h"
+#include "tune.h"
+
+/* State shared by the worker threads */
+struct local_ctx {
+  KERNEL *kern;               /* Of the coarsest level, given a pyramid */
+  int levels;                 /* Levels of pyramid (0 for none) */
+  int engine;
+  int edge;
+  UCHAR *src, *dst;
+  int width, height, stride, channels;
+  int band_rows, nband;
+  int next;                   /* Next band to claim */
+  int e;
+};
+
+/* local_main
+ * ------
+ * Worker thread: claim and blur bands until none remain
+ *
+ * arg:   shared state
+ *
+ */
+static void *local_main(void *arg) {
+
+  struct local_ctx *ctx;
+  int band, y0, y1;
+  double c[COUNTER_COUNT];
+
+  ctx = arg;
+  while ((band = __atomic_fetch_add(&ctx->next, 1, __ATOMIC_RELAXED))
+      < ctx->nband) {
+    y0 = band * ctx->band_rows;
+    y1 = y0 + ctx->band_rows < ctx->height ? y0 + ctx->band_rows
+      : ctx->height;
+    COUNTERS_START(c);
+    if (pyramidRows(ctx->engine, ctx->kern, ctx->levels, ctx->edge, ctx->src,
+          ctx->stride, ctx->dst, ctx->stride, ctx->width, ctx->height,
+          ctx->channels, y0, y1) != EXIT_SUCCESS) {
+      ctx->e = EXIT_FAILURE;
+    }
+    COUNTERS_STOP(PHASE_CONVOLVE, c, (double) (y1 - y0) * ctx->width,
+      (double) (y1 - y0) * ctx->stride);
+  }
+
+  return NULL;
+
+}
+
+/* do_local
+ * ------
+ * Blur a single image within this process
+ *
+ * opts:      job configuration
+ * threads:   number of threads (including the calling thread), which a
+ *            tuning profile may lower
+ *
+ * return: success or failure
+ *
+ */
+int do_local(JOB_OPTS *opts, int threads) {
+
+  struct local_ctx ctx;
+  pthread_t tids[threads];
+  BMP *src, *dest;
+  UINT width, height;
+  USHORT depth;
+  int f_out, started, i, coarse, span;
+  UINT calls;
+  double t;
+
+  if (init_bmp(opts->fn_in, &src, &width, &height, &depth) == EXIT_FAILURE) {
+    return EXIT_FAILURE;
+  }
+  if (init_out(opts->fn_out, opts->direct, &f_out) == EXIT_FAILURE) {
+    BMP_Free(src);
+    return EXIT_FAILURE;
+  }
+  dest = BMP_Create(width, height, depth);
+  if (BMP_CheckError(stderr) != BMP_OK) {
+    BMP_Free(src);
+    close(f_out);
+    return EXIT_FAILURE;
+  }
+
+  memset(&ctx, 0, sizeof(ctx));
+  coarse = opts->stdev;
+  if (opts->pyramid > 0 &&
+      planPyramid(opts->stdev, opts->pyramid, &ctx.levels, &coarse)
+      != EXIT_SUCCESS) {
+    BMP_Free(src);
+    BMP_Free(dest);
+    close(f_out);
+    return EXIT_FAILURE;
+  }
+  ctx.kern = create_kernel(coarse);
+  if (ctx.kern == NULL) {
+    BMP_Free(src);
+    BMP_Free(dest);
+    close(f_out);
+    return EXIT_FAILURE;
+  }
+  ctx.engine = tune_engine(opts, (width * height) >> (2 * ctx.levels),
+    coarse);
+  ctx.edge = opts->edge;
+  threads = tune_threads(opts, width * height, opts->stdev, threads);
+  ctx.src = BMP_GetData(src);
+  ctx.dst = BMP_GetData(dest);
+  ctx.width = width;
+  ctx.height = height;
+  ctx.stride = BMP_GetStride(src);
+  ctx.channels = depth >> 3;
+  ctx.e = EXIT_SUCCESS;
+
+  /* Bands no shorter than the kernel, so the halo each re-reads stays
+   * small next to the rows it produces */
+  ctx.band_rows = height / (threads * LOCAL_BANDS_PER_THREAD);
+  span = ctx.levels > 0 ? 2 * pyramidHalo(ctx.levels, coarse) + 1
+    : ctx.kern->size;
+  if (ctx.band_rows < span) ctx.band_rows = span;
+  ctx.nband = (height + ctx.band_rows - 1) / ctx.band_rows;
+  if (threads > ctx.nband) threads = ctx.nband;
+#ifdef TRACE
+  fprintf(stderr, "blurring %d bands of %d rows on %d threads\n", ctx.nband,
+    ctx.band_rows, threads);
+#endif
+
+  TIMING_START(t);
+  for (started = 1; started < threads; started++) {
+    if (pthread_create(&tids[started], NULL, local_main, &ctx) != 0) {
+      fprintf(stderr, EM_LOCAL_THREAD);
+      break;
+    }
+  }
+  local_main(&ctx);
+  for (i = 1; i < started; i++) pthread_join(tids[i], NULL);
+  TIMING_STOP(PHASE_CONVOLVE, t, BMP_GetDataSize(src));
+
+  free_kernel(ctx.kern);
+
+  /* The source header (resolution, palette) goes with the blurred pixels */
+  calls = BMP_GetWriteCalls();
+  if (ctx.e == EXIT_SUCCESS) {
+    TIMING_START(t);
+    BMP_WriteFileData(src, ctx.dst, f_out);
+    TIMING_STOP(PHASE_WRITE, t, BMP_GetDataSize(src));
+    if (BMP_CheckError(stderr) != BMP_OK) {
+      fprintf(stderr, EM_BMP_WRITE);
+      ctx.e = EXIT_FAILURE;
+    }
+  }
+  BMP_Free(src);
+  BMP_Free(dest);
+  BMP_DrainPool();
+  if (ctx.e != EXIT_SUCCESS) {
+    close(f_out);
+    return EXIT_FAILURE;
+  }
+  if (close(f_out) < 0) {
+    fprintf(stderr, EM_IO_CLOSE, strerror(errno));
+    return EXIT_FAILURE;
+  }
+#ifdef TRACE
+  fprintf(stderr, "wrote %s in %lu write calls\n", opts->fn_out,
+    BMP_GetWriteCalls() - calls);
+#endif
+
+  return EXIT_SUCCESS;
+
+}
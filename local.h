@@ -0,0 +1,26 @@
+#ifndef _LOCAL_H_
+#define _LOCAL_H_
+
+/*
+ * local.h
+ * -------
+ * Blurs an image within a single process.  The image is divided into bands
+ * of rows which a pool of threads claim one at a time, reading the source
+ * bitmap in place and writing straight into the destination bitmap, so no
+ * tile is ever copied.  Used by gaussianlocal, and by gaussianmpi when all
+ * of its ranks share a host.
+ *
+ */
+
+#include "init.h"
+
+/* Constants */
+#define LOCAL_BANDS_PER_THREAD  4     /* Bands per thread, for balance */
+
+/* Error messages */
+#define EM_LOCAL_THREAD   "Failed to start worker thread\n"
+#define EM_LOCAL_OPTION   "Option is only supported by gaussianmpi\n"
+
+int do_local(JOB_OPTS *opts, int threads);
+
+#endif /* _LOCAL_H_ */
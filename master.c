@@ -2,47 +2,67 @@
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
-#include "gaussianLib.h"
+#include "codec.h"
 #include "const.h"
+#include "counters.h"
+#include "gaussianLib.h"
 #include "init.h"
 #include "master.h"
 #include "mosaic.h"
 #include "mpi.h"
+#include "pipeline.h"
+#include "progress.h"
 #include "qdbmp.h"
+#include "timeline.h"
+#include "timing.h"
+#include "tune.h"
 
 /* do_master
  * ------
  * Main entry point for master node
  *
  * nslave:      number of slaves
- * kern_size:   size of the kernel
- * fn_in:       file name for input image
- * fn_out:      file name for output image
+ * kern_size:   size of the kernel (see init_extent)
+ * align:       multiple of pixels tiles start on (see init_extent)
+ * opts:        job configuration
+ * weights:     relative throughput of each slave (NULL to divide evenly)
  *
  * return: success or failure
  *
  */
-int do_master(int nslave, int kern_size, char *fn_in, char *fn_out) {
+int do_master(int nslave, int kern_size, int align, JOB_OPTS *opts,
+  double *weights) {
 
   USHORT depth;
   BMP *src, *dest;
   UINT width, height;
   struct mosaic_tile *head, *tile;
-  int f_out, overlap, max_data_size;
+  int f_out, ntile, overlap, max_data_size;
+  UINT calls;
+  double t, c[COUNTER_COUNT];
 
   dest = NULL;
 
   /* Initialize data source */
-  if (init_bmp(fn_in, &src, &height, &width, &depth) == EXIT_FAILURE) {
+  if (init_bmp(opts->fn_in, &src, &height, &width, &depth) == EXIT_FAILURE) {
     MPI_Abort(MPI_COMM_WORLD, MPI_ABORT_FAIL_CODE);
     return EXIT_FAILURE;
   }
-  if (init_out(fn_out, &f_out) == EXIT_FAILURE) {
+  /* Threaded receipt writes rows as they finish, which O_DIRECT won't take */
+  if (init_out(opts->fn_out, opts->direct && !opts->threaded, &f_out)
+      == EXIT_FAILURE) {
     BMP_Free(src);
     MPI_Abort(MPI_COMM_WORLD, MPI_ABORT_FAIL_CODE);
     return EXIT_FAILURE;
   }
-  head = create_tiles(src, nslave, kern_size, &overlap, &max_data_size);
+  opts->decomp = tune_decomp(opts, width * height, opts->stdev, nslave);
+  TIMING_START(t);
+  COUNTERS_START(c);
+  head = create_tiles(src, nslave, kern_size, opts->decomp,
+    opts->edge == EDGE_WRAP, align, weights, &ntile, &overlap,
+    &max_data_size);
+  COUNTERS_STOP(PHASE_TILE, c, (double) width * height, BMP_GetDataSize(src));
+  TIMING_STOP(PHASE_TILE, t, BMP_GetDataSize(src));
   tile = head;
   if (tile == NULL) {
     BMP_Free(src);
@@ -50,61 +70,121 @@ int do_master(int nslave, int kern_size, char *fn_in, char *fn_out) {
     MPI_Abort(MPI_COMM_WORLD, MPI_ABORT_FAIL_CODE);
     return EXIT_FAILURE;
   }
+  if (progress_on) {
+    fprintf(stderr, "dividing image into %d tiles for %d nodes\n", ntile,
+      nslave);
+  }
+
+  /* Image may be too small to give every slave a tile */
+  release_slaves(ntile + 1, nslave);
 
   /* Send payload and wait for all, or timeout */
-  if (send_payload(nslave, head, depth) != EXIT_SUCCESS) {
+  if (send_payload(ntile, head, depth, opts->stdev, opts->edge,
+        opts->codec) != EXIT_SUCCESS) {
     BMP_Free(src);
     MPI_Abort(MPI_COMM_WORLD, MPI_ABORT_FAIL_CODE);
     return EXIT_FAILURE;
   }
 
-  /* Receive processed results */
-  if (recv_results(nslave, src, depth, head, max_data_size) != EXIT_SUCCESS) {
-    MPI_Abort(MPI_COMM_WORLD, MPI_ABORT_FAIL_CODE);
-    return EXIT_FAILURE;
-  }
-  BMP_WriteFile(src, f_out);
-  if (BMP_CheckError(stderr) != BMP_OK) {
-    fprintf(stderr, EM_BMP_WRITE);
-    return EXIT_FAILURE;
+  /* Receive processed results, writing rows out as they complete */
+  calls = BMP_GetWriteCalls();
+  if (opts->threaded) {
+    if (pipe_results(ntile, src, depth, head, max_data_size, opts->codec,
+          f_out) != EXIT_SUCCESS) {
+      fprintf(stderr, EM_BMP_WRITE);
+      MPI_Abort(MPI_COMM_WORLD, MPI_ABORT_FAIL_CODE);
+      return EXIT_FAILURE;
+    }
+  } else {
+    if (recv_results(ntile, src, depth, head, max_data_size, opts->codec)
+        != EXIT_SUCCESS) {
+      MPI_Abort(MPI_COMM_WORLD, MPI_ABORT_FAIL_CODE);
+      return EXIT_FAILURE;
+    }
+    TIMING_START(t);
+    BMP_WriteFile(src, f_out);
+    if (BMP_CheckError(stderr) != BMP_OK) {
+      fprintf(stderr, EM_BMP_WRITE);
+      return EXIT_FAILURE;
+    }
+    TIMING_STOP(PHASE_WRITE, t, BMP_GetDataSize(src));
   }
   if (close(f_out) < 0) {
     fprintf(stderr, EM_IO_CLOSE, strerror(errno));
     return EXIT_FAILURE;
   }
+#ifdef TRACE
+  fprintf(stderr, "wrote %s in %lu write calls\n", opts->fn_out,
+    BMP_GetWriteCalls() - calls);
+#endif
+
+  /* All tiles are done */
+  release_slaves(1, ntile);
 
+  free_tiles(head);
   BMP_Free(dest);
 
   return EXIT_SUCCESS;
 }
 
+/* release_slaves
+ * ------
+ * Notify a range of slaves that there is no more work for them, by sending
+ * an empty tile size.
+ *
+ * first:   first slave to release
+ * last:    last slave to release (inclusive)
+ *
+ */
+void release_slaves(int first, int last) {
+
+  int i;
+  UINT none;
+
+  none = 0;
+  for (i = first; i <= last; i++) {
+#ifdef TRACE
+    fprintf(stderr, "rank id %d releasing rank %d\n", 0, i);
+#endif
+    MPI_Send(&none, 1, MPI_UNSIGNED_LONG, i, MPI_SIZE_TAG, MPI_COMM_WORLD);
+  }
+
+}
+
 /* recv_results
  * ------
  * Receive the results from all slave nodes, translate the processed tiles into
- * the destination bitmap.
+ * the destination bitmap.  Gives up once a slave falls behind the deadline
+ * its heartbeats set (see progress.h).
  *
  * nslave:        slave count
  * dest:          destination bitmap
  * depth:         bit depth of image
  * head:          head of linked list for all tiles
- * max_data_size: size of the largest tile in bytes
+ * max_data_size: size of the largest tile buffer in bytes
+ * codec:         transport codec the slaves encode results with
  *
  * return: success or failure
  *
  */
-int recv_results(int nslave, BMP *dest, int depth, struct mosaic_tile *head, int max_data_size) {
+int recv_results(int nslave, BMP *dest, int depth, struct mosaic_tile *head,
+  int max_data_size, int codec) {
 
   UCHAR **data;
   MPI_Status recv_stat;
+  MPI_Datatype type;
   struct mosaic_tile *tile;
   MPI_Request recv_reqs[nslave];
-  int expire, elapsed, complete, e, i;
+  int complete, e, i, count, buf_size;
+  double t, t_remap, bytes, c[COUNTER_COUNT];
 
   e = BMP_OK;
   tile = head;
-  elapsed = 0;
+  bytes = 0;
   complete = 0;
-  expire = TIMEOUT_PROCESS_S / SLEEP_S;
+
+  /* Encoded tiles may be (slightly) larger than the raw tile */
+  buf_size = codec == CODEC_NONE ? max_data_size : codec_bound(max_data_size);
 
   data = calloc(nslave, sizeof(UCHAR*));
   if (data == NULL) {
@@ -112,7 +192,7 @@ int recv_results(int nslave, BMP *dest, int depth, struct mosaic_tile *head, int
     return EXIT_FAILURE;
   }
   for (i = 0; i < nslave; i++) {
-    data[i] = malloc(max_data_size * sizeof(UCHAR));
+    data[i] = malloc(buf_size * sizeof(UCHAR));
     if (data[i] == NULL) {
       fprintf(stderr, EM_OUT_OF_MEMORY, OOM_TYPE_RECEIPT_ARRAY);
       return EXIT_FAILURE;
@@ -120,9 +200,17 @@ int recv_results(int nslave, BMP *dest, int depth, struct mosaic_tile *head, int
   }
 
   /* Pool the receipt of all other ranks */
+  TIMING_START(t);
   do {
-    MPI_Irecv(data[tile->id - 1], tile->size, MPI_UNSIGNED_CHAR, tile->id, MPI_DATA_TAG,
-      MPI_COMM_WORLD, &recv_reqs[tile->id - 1]);
+    if (codec == CODEC_NONE) {
+      type = tile_type(tile->size, tile->w, tile->h, depth);
+      MPI_Irecv(data[tile->id - 1], 1, type, tile->id, MPI_DATA_TAG,
+        MPI_COMM_WORLD, &recv_reqs[tile->id - 1]);
+      MPI_Type_free(&type);
+    } else {
+      MPI_Irecv(data[tile->id - 1], buf_size, MPI_UNSIGNED_CHAR, tile->id,
+        MPI_DATA_TAG, MPI_COMM_WORLD, &recv_reqs[tile->id - 1]);
+    }
   } while ((tile = tile->next) != NULL);
   tile = head;
 
@@ -137,6 +225,9 @@ int recv_results(int nslave, BMP *dest, int depth, struct mosaic_tile *head, int
 
       BMP *section;
 
+      TIMELINE_MARK(PHASE_RECV, test_index + 1);
+      progress_finish(test_index + 1);
+
       /* Lookup tile by node id (offset by one for zero indexing) */
       tile = head;
       do {
@@ -149,22 +240,39 @@ int recv_results(int nslave, BMP *dest, int depth, struct mosaic_tile *head, int
       }
 
       /* Load serialized data into new bitmap and translate the results */
+      TIMING_START(t_remap);
+      COUNTERS_START(c);
       section = BMP_Create(tile->w, tile->h, depth);
-      BMP_SetData(section, data[tile->id - 1]);
       if ((e = BMP_CheckError(stderr)) != BMP_OK) break;
+      if (codec == CODEC_NONE) {
+        BMP_SetData(section, data[tile->id - 1]);
+        bytes += tile->size;
+      } else {
+        MPI_Get_count(&recv_stat, MPI_UNSIGNED_CHAR, &count);
+        bytes += count;
+        if ((e = codec_decode(data[tile->id - 1], count, tile->w, tile->h,
+            depth, BMP_GetData(section))) != EXIT_SUCCESS) {
+          BMP_Free(section);
+          break;
+        }
+      }
       remap_tile(tile, section, dest);
       BMP_Free(section);
+      COUNTERS_STOP(PHASE_REMAP, c, (double) tile->w * tile->h, tile->size);
+      TIMING_STOP(PHASE_REMAP, t_remap, tile->size);
       
       /* Count completed */
       ++complete;
       #ifdef TRACE
-          fprintf(stdout, "processed %d/%d nodes\n", complete, nslave);
+          fprintf(stderr, "processed %d/%d nodes\n", complete, nslave);
       #endif
       if (complete == nslave) break;
 
     }
 
-  } while (elapsed++ <= expire);
+  } while (progress_poll() == 0);
+
+  TIMING_STOP(PHASE_RECV, t, bytes);
 
   if (data != NULL) {
     for (i = 0; i < nslave; i++) {
@@ -183,63 +291,168 @@ int recv_results(int nslave, BMP *dest, int depth, struct mosaic_tile *head, int
 
 }
 
+/* tile_type
+ * ------
+ * Datatype of a raw tile on the wire: each row as laid out in the file,
+ * taken from (or placed at) the padded row stride of the tile in memory, so
+ * that only the tile's size in bytes is transferred
+ *
+ * size:    size of the tile data in bytes (see BMP_GetDataSize)
+ * width:   width of the tile (pixels)
+ * height:  height of the tile (pixels)
+ * depth:   depth of the tile (bits)
+ *
+ * returns: committed datatype of one tile, to be freed by the caller
+ *
+ */
+MPI_Datatype tile_type(UINT size, UINT width, UINT height, USHORT depth) {
+
+  MPI_Datatype type;
+
+  MPI_Type_vector(height, size / height, BMP_RowStride(width, depth),
+    MPI_UNSIGNED_CHAR, &type);
+  MPI_Type_commit(&type);
+
+  return type;
+
+}
+
+/* post_tile
+ * non-blocking send of a single tile to the slave of the same id, whose
+ * heartbeats are awaited from then on (see progress.h)
+ * ------
+ * tile:          tile to send
+ * depth:         image depth in bits (must persist until sent)
+ * stdev:         standard deviation of the blur (must persist until sent)
+ * edge:          edge mode of the blur (must persist until sent)
+ * codec:         transport codec to encode the tile with
+ * reqs:          requests for the PAYLOAD_COUNT messages (out)
+ * wire:          encoded tile, to be freed once sent (out, NULL if none)
+ *
+ * returns:       success or failure code
+ *
+ */
+int post_tile(struct mosaic_tile *tile, USHORT *depth, int *stdev, int *edge,
+  int codec, MPI_Request *reqs, UCHAR **wire) {
+
+  MPI_Datatype type;
+  UCHAR *data;
+  UINT count;
+  double t;
+
+#ifdef TRACE
+  fprintf(stderr, "rank id %d sending payload to rank %d\n", 0, tile->id);
+#endif
+  TIMING_START(t);
+
+  data = BMP_GetData(tile->bmp);
+  count = tile->size;
+  *wire = NULL;
+
+  /* Encoded tiles are kept until all sends have completed */
+  if (codec != CODEC_NONE) {
+    *wire = malloc(codec_bound(tile->size));
+    if (*wire == NULL) {
+      fprintf(stderr, EM_OUT_OF_MEMORY, OOM_TYPE_WIRE_BUFFER);
+      return EXIT_FAILURE;
+    }
+    count = codec_encode(data, tile->w, tile->h, *depth, *wire);
+    if (count == 0) {
+      free(*wire);
+      *wire = NULL;
+      return EXIT_FAILURE;
+    }
+    data = *wire;
+  }
+
+  MPI_Isend(&tile->size, 1, MPI_UNSIGNED_LONG, tile->id, MPI_SIZE_TAG,
+      MPI_COMM_WORLD, reqs++);
+  MPI_Isend(&tile->w, 1, MPI_UNSIGNED_LONG, tile->id, MPI_WIDTH_TAG,
+      MPI_COMM_WORLD, reqs++);
+  MPI_Isend(&tile->h, 1, MPI_UNSIGNED_LONG, tile->id, MPI_HEIGHT_TAG,
+      MPI_COMM_WORLD, reqs++);
+  MPI_Isend(depth, 1, MPI_UNSIGNED_SHORT, tile->id, MPI_DEPTH_TAG,
+      MPI_COMM_WORLD, reqs++);
+  MPI_Isend(stdev, 1, MPI_INT, tile->id, MPI_STDEV_TAG,
+      MPI_COMM_WORLD, reqs++);
+  MPI_Isend(edge, 1, MPI_INT, tile->id, MPI_EDGE_TAG,
+      MPI_COMM_WORLD, reqs++);
+  if (codec == CODEC_NONE) {
+    type = tile_type(tile->size, tile->w, tile->h, *depth);
+    MPI_Isend(data, 1, type, tile->id, MPI_DATA_TAG, MPI_COMM_WORLD, reqs++);
+    MPI_Type_free(&type);
+  } else {
+    MPI_Isend(data, count, MPI_UNSIGNED_CHAR, tile->id, MPI_DATA_TAG,
+        MPI_COMM_WORLD, reqs++);
+  }
+  TIMING_STOP(PHASE_SEND, t, count);
+
+  return progress_start(tile->id, tile->w, tile->h, tile->size);
+
+}
+
 /* send_payload
  * non-blocking send of data required for slave nodes to process imagery
  * ------
  * nslave:        number of slave nodes
  * mosaic_tile:   linked list of tiles to process
  * depth:         image depth in bits
+ * stdev:         standard deviation of the blur
+ * edge:          edge mode of the blur
+ * codec:         transport codec to encode tiles with
  *
  * returns:       success or failure code
  *
  * NOTE: MPI will abort upon any errors encountered
  *
  */
-int send_payload(int nslave, struct mosaic_tile *head, USHORT depth) {
+int send_payload(int nslave, struct mosaic_tile *head, USHORT depth,
+  int stdev, int edge, int codec) {
 
-  UCHAR *data[nslave];
+  UCHAR *wire[nslave];
   struct mosaic_tile *tile;
   MPI_Request send_reqs[nslave * PAYLOAD_COUNT];
   MPI_Status send_stats[nslave * PAYLOAD_COUNT];
-  int elapsed, expire, req_index, send_flag;
+  int send_index[nslave * PAYLOAD_COUNT];
+  int req_index, pending, done, e, i;
+  double t, deadline;
 
   tile = head;
+  e = EXIT_SUCCESS;
+  for (i = 0; i < nslave; i++) wire[i] = NULL;
+  for (i = 0; i < nslave * PAYLOAD_COUNT; i++) {
+    send_reqs[i] = MPI_REQUEST_NULL;
+  }
 
   /* Pool the sending of all payload data */
   do {
 
-#ifdef TRACE
-    fprintf(stdout, "rank id %d sending payload to rank %d\n", 0, tile->id);
-#endif
-
     req_index = (tile->id - 1); /* Convert to zero based index */
     req_index *= PAYLOAD_COUNT; /* Offset index by iteration index */
 
-    data[tile->id - 1] = BMP_GetData(tile->bmp);
-
-    MPI_Isend(&tile->size, 1, MPI_UNSIGNED_LONG, tile->id, MPI_SIZE_TAG,
-        MPI_COMM_WORLD, &send_reqs[req_index++]);
-    MPI_Isend(&tile->w, 1, MPI_UNSIGNED_LONG, tile->id, MPI_WIDTH_TAG,
-        MPI_COMM_WORLD, &send_reqs[req_index++]);
-    MPI_Isend(&tile->h, 1, MPI_UNSIGNED_LONG, tile->id, MPI_HEIGHT_TAG,
-        MPI_COMM_WORLD, &send_reqs[req_index++]);
-    MPI_Isend(&depth, 1, MPI_UNSIGNED_SHORT, tile->id, MPI_DEPTH_TAG,
-        MPI_COMM_WORLD, &send_reqs[req_index++]);
-    MPI_Isend(data[tile->id - 1], tile->size, MPI_UNSIGNED_CHAR, tile->id,
-        MPI_DATA_TAG, MPI_COMM_WORLD, &send_reqs[req_index++]);
+    if (post_tile(tile, &depth, &stdev, &edge, codec,
+          &send_reqs[req_index], &wire[tile->id - 1]) != EXIT_SUCCESS) {
+      e = EXIT_FAILURE;
+      break;
+    }
 
   } while ((tile = tile->next) != NULL);
 
-  /* Wait for ALL slave nodes to respond */
-  expire = TIMEOUT_PAYLOAD_S / SLEEP_S;
-  elapsed = 0;
+  /* Wait for ALL slave nodes to respond, for as long as sends keep
+   * completing (after a failure, only the sends already posted are awaited
+   * so that their encoded tiles can be freed) */
+  TIMING_START(t);
+  pending = 0;
+  for (i = 0; i < nslave * PAYLOAD_COUNT; i++) {
+    if (send_reqs[i] != MPI_REQUEST_NULL) ++pending;
+  }
+  deadline = MPI_Wtime() + TIMEOUT_PAYLOAD_S;
   #ifdef TRACE
-    setbuf(stdout, NULL);
-    fprintf(stdout, "Master waiting for response");
+    fprintf(stderr, "Master waiting for response");
   #endif
   do {
 #ifdef TRACE
-    fprintf(stdout, ".");
+    fprintf(stderr, ".");
 #endif
     usleep(SLEEP_U);
     /*
@@ -251,21 +464,29 @@ int send_payload(int nslave, struct mosaic_tile *head, USHORT depth) {
      * errors manually
      *
      */
-    MPI_Testall(nslave * PAYLOAD_COUNT, send_reqs, &send_flag, send_stats);
-    if (send_flag) {
+    MPI_Testsome(nslave * PAYLOAD_COUNT, send_reqs, &done, send_index,
+      send_stats);
+    if (done > 0) {
+      pending -= done;
+      deadline = MPI_Wtime() + TIMEOUT_PAYLOAD_S;
+    }
+    if (pending == 0) {
 #ifdef TRACE
-      fprintf(stdout, "\nAll responses received\n");
+      fprintf(stderr, "\nAll responses received\n");
 #endif
       break;
     };
-  } while (elapsed++ < expire);
+  } while (MPI_Wtime() < deadline);
+  TIMING_STOP(PHASE_SEND, t, 0);
+
+  for (i = 0; i < nslave; i++) free(wire[i]);
 
   /* Check for timeout */
-  if (elapsed >= expire) {
+  if (pending > 0) {
     fprintf(stderr, EM_PAYLOAD_TIMEOUT);
     return EXIT_FAILURE;
   }
 
-  return EXIT_SUCCESS;
+  return e;
 
 }
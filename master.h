@@ -1,11 +1,20 @@
 #ifndef _MASTER_H_
 #define _MASTER_H_
 
+#include "init.h"
 #include "qdbmp.h"
 #include "mosaic.h"
+#include "mpi.h"
 
-int do_master(int nslave, int kern_size, char *fn_in, char *fn_out);
-int recv_results(int nslave, BMP *dest, int depth, struct mosaic_tile *head, int max_data_size);
-int send_payload(int nslave, struct mosaic_tile *head, USHORT depth);
+int do_master(int nslave, int kern_size, int align, JOB_OPTS *opts,
+  double *weights);
+void release_slaves(int first, int last);
+MPI_Datatype tile_type(UINT size, UINT width, UINT height, USHORT depth);
+int post_tile(struct mosaic_tile *tile, USHORT *depth, int *stdev, int *edge,
+  int codec, MPI_Request *reqs, UCHAR **wire);
+int recv_results(int nslave, BMP *dest, int depth, struct mosaic_tile *head,
+  int max_data_size, int codec);
+int send_payload(int nslave, struct mosaic_tile *head, USHORT depth,
+  int stdev, int edge, int codec);
 
 #endif /* _MASTER_H_ */
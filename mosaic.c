@@ -1,30 +1,197 @@
 #include <stdlib.h>
-#include "qdbmp.h"
+#include "const.h"
 #include "mosaic.h"
+#include "qdbmp.h"
+
+/*
+ * weigh_tiles:
+ * Divide the image rows between tiles in proportion to the given weights,
+ * keeping every tile at least min_h rows tall.
+ * -----
+ * ih:      image height (rows)
+ * num:     number of tiles
+ * min_h:   minimum tile height (rows)
+ * weights: relative weight of each tile
+ * bounds:  first row of each tile, plus the image height (out, num + 1)
+ *
+ * returns: success or failure
+ */
+static int weigh_tiles(UINT ih, int num, UINT min_h, double *weights,
+  UINT *bounds) {
+
+  int i, changed;
+  UINT row, rows, h[num];
+  double total;
+  char fixed[num];
+
+  if (ih < min_h * num) return EXIT_FAILURE;
+
+  for (i = 0; i < num; i++) {
+    if (weights[i] <= 0) return EXIT_FAILURE;
+    fixed[i] = 0;
+  }
+
+  /* Clamp undersized tiles and share the remaining rows amongst the rest
+   * until no further tiles fall below the minimum */
+  do {
+    changed = 0;
+    rows = ih;
+    total = 0;
+    for (i = 0; i < num; i++) {
+      if (fixed[i]) rows -= min_h;
+      else total += weights[i];
+    }
+    for (i = 0; i < num; i++) {
+      if (fixed[i]) {
+        h[i] = min_h;
+        continue;
+      }
+      h[i] = rows * (weights[i] / total);
+      if (h[i] < min_h) {
+        fixed[i] = 1;
+        changed = 1;
+      }
+    }
+  } while (changed);
+
+  /* Round down throughout and give any remainder to the last tile */
+  for (row = 0, i = 0; i < num; i++) {
+    bounds[i] = row;
+    row += h[i];
+  }
+  bounds[num] = ih;
+
+  return EXIT_SUCCESS;
+
+}
+
+/*
+ * plan_bands:
+ * Choose the row boundaries for a stack of horizontal bands, falling back to
+ * fewer bands while the bands would be shorter than the kernel.
+ * -----
+ * ih:        image height (rows)
+ * num:       maximum number of bands
+ * kern_size: diameter of the kernel
+ * weights:   relative throughput of the node for each band (or NULL)
+ * bounds:    first row of each band, plus the image height (out, num + 1)
+ *
+ * returns:   number of bands, or 0 where not even one band fits
+ */
+static int plan_bands(UINT ih, int num, int kern_size, double *weights,
+  UINT *bounds) {
+
+  int i, n;
+  UINT th;
+
+  for (n = num; n > 0; n--) {
+    if (weights != NULL) {
+      if (weigh_tiles(ih, n, kern_size, weights, bounds) == EXIT_SUCCESS)
+        return n;
+      continue;
+    }
+
+    /* Divide image into a number of tiles */
+    th = (ih / n - 1);
+    if (th < kern_size) continue;
+    for (i = 0; i < n; i++) bounds[i] = th * i;
+    bounds[n] = ih;
+    return n;
+  }
+
+  return 0;
+
+}
+
+/*
+ * plan_blocks:
+ * Choose a rows x columns grid of blocks for the given number of nodes that
+ * minimises the number of halo pixels shipped alongside the blocks.  Where no
+ * grid of num blocks is at least the kernel size in both dimensions, fewer
+ * blocks are used.
+ * -----
+ * ih:        image height (rows)
+ * iw:        image width (columns)
+ * num:       maximum number of blocks
+ * kern_size: diameter of the kernel
+ * rows:      rows in the grid (out)
+ * cols:      columns in the grid (out)
+ *
+ * returns:   number of blocks, or 0 where not even one block fits
+ */
+static int plan_blocks(UINT ih, UINT iw, int num, int kern_size, int *rows,
+  int *cols) {
+
+  int n, r, c;
+  double halo, best, rad;
+
+  rad = (kern_size - 1) / 2;
+
+  for (n = num; n > 0; n--) {
+    best = -1;
+    for (r = 1; r <= n; r++) {
+      if (n % r != 0) continue;
+      c = n / r;
+      if (ih / r < kern_size || iw / c < kern_size) continue;
+
+      /* Every interior edge is shipped twice, once to either neighbour */
+      halo = 2 * rad * iw * (r - 1) + 2 * rad * ih * (c - 1)
+        + 4 * rad * rad * (r - 1) * (c - 1);
+      if (best < 0 || halo < best) {
+        best = halo;
+        *rows = r;
+        *cols = c;
+      }
+    }
+    if (best >= 0) return n;
+  }
+
+  return 0;
+
+}
 
 /*
  * create_tiles:
- * Divide the given bitmap into a series of small horizontal tiles.
+ * Divide the given bitmap into a series of small tiles, either horizontal
+ * bands or a grid of blocks.  Where the image is too small to give every node
+ * a tile at least the size of the kernel, fewer tiles are created, down to a
+ * single tile of the whole image (which needs no halo, however large the
+ * kernel, e.g. the halo of a pyramid blur of a small image).  Tiles
+ * carry no halo along the edges of the image, unless wrapping: then the
+ * halo comes from the opposite edge, wherever the image is divided.  Tiles
+ * may be made to start on a multiple of pixels (for a pyramid blur): in
+ * memory order, i.e. counting rows from the bottom of the image.
  * -----
  * src:           source bitmap
- * num:           number of tiles
+ * num:           maximum number of tiles
  * kern_size:     diameter of the kernel
+ * decomp:        decomposition (DECOMP_BAND or DECOMP_BLOCK)
+ * wrap:          wrap halos around the edges of the image (for EDGE_WRAP)
+ * align:         multiple of pixels that every tile, halo included, starts
+ *                on (the halo must be a multiple too)
+ * weights:       relative throughput of the node for each tile, used to
+ *                size bands (NULL to divide evenly, ignored for blocks)
+ * ntile:         number of tiles created (out)
  * overlap:       overlap across tiles to account for kernel offset (out)
- * max_data_size: size of the largest tile (in bytes)
+ * max_data_size: size of the largest tile buffer, as held in memory (in
+ *                bytes)
  *
  * returns:       *mosaic_tile: linked list
  */
 struct mosaic_tile *create_tiles(BMP *src, int num, int kern_size,
-  int *overlap, int *max_data_size) {
+  int decomp, int wrap, int align, double *weights, int *ntile, int *overlap,
+  int *max_data_size) {
 
-  int e;
+  int e, n, rows, cols, x, y, wrap_x, wrap_y;
   UCHAR r, g, b;
   struct mosaic_tile *head;
-  UINT i, x, y, py, id, iw, ih, th, mds;
+  UINT i, px, py, id, iw, ih, mds;
+  UINT ybounds[num + 1], xbounds[num + 1];
 
   head = NULL;
   e = BMP_OK;
   mds = 0;
+  *ntile = 0;
 
   /* Get image dimensions */
   ih = BMP_GetHeight(src);
@@ -43,20 +210,43 @@ struct mosaic_tile *create_tiles(BMP *src, int num, int kern_size,
     return head;
   }
 
-  /* Divide image into a number of tiles */
-  th = (ih / num - 1);
-  if (th < kern_size) {
-    /* Tile height must be greater than the kernel size */
-    fprintf(stderr, EM_TILE_OVERFLOW);
-    return head;
+  /* Lay out the grid of tiles, leaving room to move the boundaries by up
+   * to align - 1 pixels */
+  if (decomp == DECOMP_BLOCK) {
+    n = plan_blocks(ih, iw, num, kern_size + align - 1, &rows, &cols);
+    for (i = 0; n > 0 && i <= rows; i++) ybounds[i] = ih * i / rows;
+    for (i = 0; n > 0 && i <= cols; i++) xbounds[i] = iw * i / cols;
+  } else {
+    n = plan_bands(ih, num, kern_size + align - 1, weights, ybounds);
+    rows = n;
+    cols = 1;
+    xbounds[0] = 0;
+    xbounds[1] = iw;
+  }
+  for (i = 1; n > 0 && i < rows; i++) {
+    ybounds[i] = ih - (ih - ybounds[i]) / align * align;
+  }
+  for (i = 1; n > 0 && i < cols; i++) {
+    xbounds[i] = xbounds[i] / align * align;
+  }
+  if (n == 0) {
+    /* Not even one tile holds the kernel: blur the image as one tile */
+    n = rows = cols = 1;
+    ybounds[0] = xbounds[0] = 0;
+    ybounds[1] = ih;
+    xbounds[1] = iw;
   }
-
   /* Tiles must overlap by the 'radius' of the kernel. */
   *overlap = (kern_size - 1) / 2;
 
+  /* A tile spanning the image wraps by itself (on the slave) */
+  wrap_y = wrap && rows > 1;
+  wrap_x = wrap && cols > 1;
+
   /* Create linked list of tiles (in reverse) */
-  for (i = 0; i < num; i++) {
+  for (i = 0; i < n; i++) {
     struct mosaic_tile *tile;
+    UINT row, col;
 
     tile = malloc(sizeof(*tile));
     if (tile == NULL) break;
@@ -65,38 +255,41 @@ struct mosaic_tile *create_tiles(BMP *src, int num, int kern_size,
     head = tile;
 
     /* Set tile dimensions */
-    tile->bot_over = i == 0 ? 0 : *overlap;
-    tile->top_over = i < num - 1 ? *overlap : 0;
+    row = i / cols;
+    col = i % cols;
+    tile->bot_over = row > 0 || wrap_y ? *overlap : 0;
+    tile->top_over = row < rows - 1 || wrap_y ? *overlap : 0;
+    tile->lft_over = col > 0 || wrap_x ? *overlap : 0;
+    tile->rgt_over = col < cols - 1 || wrap_x ? *overlap : 0;
     tile->id = i + 1;
-    tile->imaxy = (th * (i + 1)) + tile->top_over;
-    tile->iminy = (th * i) - tile->bot_over;
-
-    /* Check for any remainder and add it to the last tile */
-    if (ih - tile->imaxy < th) {
-      tile->imaxy = ih;
-      tile->top_over = 0;
-    }
+    tile->imaxy = (int) ybounds[row + 1] + tile->top_over;
+    tile->iminy = (int) ybounds[row] - tile->bot_over;
+    tile->imaxx = (int) xbounds[col + 1] + tile->rgt_over;
+    tile->iminx = (int) xbounds[col] - tile->lft_over;
 
     tile->h = tile->imaxy - tile->iminy;
-    tile->w = iw;
+    tile->w = tile->imaxx - tile->iminx;
 
     /* Create bmp to copy source pixels into */
-    tile->bmp = BMP_Create(iw, tile->h, id);
+    tile->bmp = BMP_Create(tile->w, tile->h, id);
     if ((e = BMP_CheckError(stderr)) != BMP_OK) break;
     tile->size = BMP_GetDataSize(tile->bmp);
     if ((e = BMP_CheckError(stderr)) != BMP_OK) break;
-    if (mds < tile->size) mds = tile->size;
+    if (mds < BMP_GetAllocSize(tile->bmp)) mds = BMP_GetAllocSize(tile->bmp);
+    ++*ntile;
 
     /* Scan the columns and rows into new bitmap */
-    /* Convert absolute to relative coordinates */
+    /* Convert absolute to relative coordinates (wrapped halos lie at most
+     * a tile beyond the image) */
     for (py = 0, y = tile->iminy; y < tile->imaxy; y++, py++) {
-      for (x = 0; x < iw; x++) {
+      for (px = 0, x = tile->iminx; x < tile->imaxx; x++, px++) {
         /* NOTE: We can most definitely speed this up by using memcpy
         and grabbing n lines at a time inclusive of the +n overlap lines
         required to accomodate the gaussian kernel */
-        BMP_GetPixelRGB(src, x, y, &r, &g, &b);
+        BMP_GetPixelRGB(src, (x + (int) iw) % iw, (y + (int) ih) % ih, &r,
+          &g, &b);
         if ((e = BMP_CheckError(stderr)) != BMP_OK) break;
-        BMP_SetPixelRGB(tile->bmp, x, py, r, g, b);
+        BMP_SetPixelRGB(tile->bmp, px, py, r, g, b);
         if ((e = BMP_CheckError(stderr)) != BMP_OK) break;
       }
       if ((e = BMP_CheckError(stderr)) != BMP_OK) break;
@@ -122,7 +315,7 @@ struct mosaic_tile *create_tiles(BMP *src, int num, int kern_size,
  */
 int remap_tile(struct mosaic_tile *tile, BMP *src, BMP *dest) {
 
-  int e, x, y, py;
+  int e, x, y, px, py;
   UCHAR r, g, b;
 
   e = BMP_OK;
@@ -130,12 +323,12 @@ int remap_tile(struct mosaic_tile *tile, BMP *src, BMP *dest) {
   /* Ignore the buffers on remapping the coordinates */
   for (y = 0 + tile->bot_over, py = tile->iminy + y;
       py < tile->imaxy - tile->top_over; y++, py++) {
-    /* No remapping required for x coordinates */
-    for (x = 0; x < tile->w; x++) {
+    for (x = 0 + tile->lft_over, px = tile->iminx + x;
+        px < tile->imaxx - tile->rgt_over; x++, px++) {
 
       BMP_GetPixelRGB(src, x, y, &r, &g, &b);
       if ((e = BMP_CheckError(stderr)) != BMP_OK) break;
-      BMP_SetPixelRGB(dest, x, py, r, g, b);
+      BMP_SetPixelRGB(dest, px, py, r, g, b);
       if ((e = BMP_CheckError(stderr)) != BMP_OK) break;
 
     }
@@ -145,3 +338,55 @@ int remap_tile(struct mosaic_tile *tile, BMP *src, BMP *dest) {
   return e;
 
 }
+
+/* whole_tile:
+ * Describe an entire image as a single tile, for processing on one node
+ * ------
+ * tile:    tile to fill in
+ * src:     source bitmap (shared, not copied)
+ * id:      node the tile is destined for
+ *
+ * output:  int: error code (relaying qdbmp.h error codes)
+ */
+int whole_tile(struct mosaic_tile *tile, BMP *src, int id) {
+
+  int e;
+
+  tile->id = id;
+  tile->w = BMP_GetWidth(src);
+  if ((e = BMP_CheckError(stderr)) != BMP_OK) return e;
+  tile->h = BMP_GetHeight(src);
+  if ((e = BMP_CheckError(stderr)) != BMP_OK) return e;
+  tile->size = BMP_GetDataSize(src);
+  if ((e = BMP_CheckError(stderr)) != BMP_OK) return e;
+
+  tile->iminy = 0;
+  tile->imaxy = tile->h;
+  tile->iminx = 0;
+  tile->imaxx = tile->w;
+  tile->bot_over = tile->top_over = 0;
+  tile->lft_over = tile->rgt_over = 0;
+  tile->bmp = src;
+  tile->processed = 0;
+  tile->next = NULL;
+
+  return BMP_OK;
+
+}
+
+/* free_tiles:
+ * Free a linked list of tiles created by create_tiles, with their bitmaps
+ * ------
+ * head:    head of the linked list (may be NULL)
+ */
+void free_tiles(struct mosaic_tile *head) {
+
+  struct mosaic_tile *next;
+
+  for (; head != NULL; head = next) {
+    next = head->next;
+    if (head->bmp != NULL) BMP_Free(head->bmp);
+    free(head);
+  }
+
+}
@@ -4,17 +4,21 @@
 /*
  * mosaic.h
  * --------
- * Utility functions for splitting bitmap images into smaller horizontal tiles
+ * Utility functions for splitting bitmap images into smaller tiles, either
+ * horizontal bands or a grid of blocks
  *
  */
 
 #include "qdbmp.h"
 
+/* Decompositions */
+#define DECOMP_BAND       0   /* Horizontal bands, halo above and below */
+#define DECOMP_BLOCK      1   /* Grid of blocks, halo on all four sides */
+
 /* Error messages */
 #define EM_BMP_DEPTH      "Failed to get source bitmap depth\n"
 #define EM_BMP_HEIGHT     "Failed to get source bitmap height\n"
 #define EM_BMP_WIDTH      "Failed to get source bitmap width\n"
-#define EM_TILE_OVERFLOW  "Tile grid smaller than kernel size\n"
 
 /*
  * Linked list for iterating through a sequence of bitmap tiles
@@ -22,7 +26,9 @@
 typedef struct mosaic_tile {
   int id;                    /* Sequence number of tile */
   int imaxy, iminy;          /* Reference pixels on source image */
+  int imaxx, iminx;
   int bot_over, top_over;    /* Margin excluded from tile mapping */
+  int lft_over, rgt_over;
   UINT h, w;                 /* Height and width of tile (pixels) */
   UINT size;                 /* Size of tile data in bytes */
   BMP *bmp;                  /* Tile image */
@@ -32,8 +38,13 @@ typedef struct mosaic_tile {
 
 
 struct mosaic_tile *create_tiles(BMP *src, int num, int kern_size,
-  int *overlap, int *max_data_size);
+  int decomp, int wrap, int align, double *weights, int *ntile, int *overlap,
+  int *max_data_size);
 
 int remap_tile(struct mosaic_tile *tile, BMP *src, BMP *dest);
 
+int whole_tile(struct mosaic_tile *tile, BMP *src, int id);
+
+void free_tiles(struct mosaic_tile *head);
+
 #endif /* _MOSAIC_H_ */
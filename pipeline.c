@@ -0,0 +1,331 @@
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "codec.h"
+#include "const.h"
+#include "counters.h"
+#include "master.h"
+#include "mosaic.h"
+#include "mpi.h"
+#include "pipeline.h"
+#include "progress.h"
+#include "qdbmp.h"
+#include "timeline.h"
+#include "timing.h"
+
+/* Tile received by the communication thread, awaiting remapping */
+struct pipe_tile {
+  struct mosaic_tile *tile;
+  UCHAR *data;
+  int count;
+};
+
+/* Rows of the destination image with w more columns remapped */
+struct pipe_rows {
+  UINT iminy, imaxy;
+  UINT w;
+};
+
+/* State shared by the pipeline threads */
+struct pipe_ctx {
+  BMP *dest;
+  int depth, codec, f_out;
+  UINT width, height;
+  RING to_remap;              /* struct pipe_tile, communication -> remap */
+  RING to_write;              /* struct pipe_rows, remap -> writer */
+  struct pipe_rows *rows;     /* Rows covered by each tile, by node id */
+  int e_remap, e_write;
+};
+
+/* Marks the end of the items in a ring */
+static char pipe_end;
+
+/* ring_push
+ * ------
+ * Append an item to a ring, yielding while the ring is full
+ *
+ * ring:  ring to append to
+ * item:  item to append
+ *
+ */
+static void ring_push(RING *ring, void *item) {
+
+  UINT tail;
+
+  tail = ring->tail;
+  while (tail - __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) == RING_SIZE) {
+    sched_yield();
+  }
+  ring->slot[tail & (RING_SIZE - 1)] = item;
+  __atomic_store_n(&ring->tail, tail + 1, __ATOMIC_RELEASE);
+
+}
+
+/* ring_pop
+ * ------
+ * Remove the oldest item from a ring, yielding while the ring is empty
+ *
+ * ring:  ring to remove from
+ *
+ * returns: the item
+ *
+ */
+static void *ring_pop(RING *ring) {
+
+  UINT head;
+  void *item;
+
+  head = ring->head;
+  while (__atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE) == head) {
+    sched_yield();
+  }
+  item = ring->slot[head & (RING_SIZE - 1)];
+  __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+
+  return item;
+
+}
+
+/* remap_main
+ * ------
+ * Remap thread: decode received tiles, translate them into the destination
+ * bitmap and tell the writer which rows were touched
+ *
+ * arg:   pipeline state
+ *
+ */
+static void *remap_main(void *arg) {
+
+  struct pipe_ctx *ctx;
+  struct pipe_tile *in;
+  struct pipe_rows *out;
+  struct mosaic_tile *tile;
+  BMP *section;
+  double t, c[COUNTER_COUNT];
+
+  ctx = arg;
+  while ((in = ring_pop(&ctx->to_remap)) != (void *) &pipe_end) {
+
+    /* Keep draining after a failure so the communication thread never
+     * blocks on a full ring */
+    if (ctx->e_remap != EXIT_SUCCESS) continue;
+
+    tile = in->tile;
+    TIMING_START(t);
+    COUNTERS_START(c);
+    section = BMP_Create(tile->w, tile->h, ctx->depth);
+    if (BMP_CheckError(stderr) != BMP_OK) {
+      ctx->e_remap = EXIT_FAILURE;
+      continue;
+    }
+    if (ctx->codec == CODEC_NONE) {
+      BMP_SetData(section, in->data);
+    } else if (codec_decode(in->data, in->count, tile->w, tile->h,
+          ctx->depth, BMP_GetData(section)) != EXIT_SUCCESS) {
+      ctx->e_remap = EXIT_FAILURE;
+      BMP_Free(section);
+      continue;
+    }
+    if (remap_tile(tile, section, ctx->dest) != BMP_OK) {
+      ctx->e_remap = EXIT_FAILURE;
+    }
+    BMP_Free(section);
+    COUNTERS_STOP(PHASE_REMAP, c, (double) tile->w * tile->h, tile->size);
+    TIMING_STOP(PHASE_REMAP, t, tile->size);
+
+    out = &ctx->rows[tile->id - 1];
+    out->iminy = tile->iminy + tile->bot_over;
+    out->imaxy = tile->imaxy - tile->top_over;
+    out->w = tile->w - tile->lft_over - tile->rgt_over;
+    ring_push(&ctx->to_write, out);
+
+  }
+  ring_push(&ctx->to_write, &pipe_end);
+
+  return NULL;
+
+}
+
+/* write_main
+ * ------
+ * Writer thread: track the columns remapped for every row and write each
+ * run of complete rows once every row beneath it (in file order) is written
+ *
+ * arg:   pipeline state
+ *
+ */
+static void *write_main(void *arg) {
+
+  struct pipe_ctx *ctx;
+  struct pipe_rows *in;
+  UINT *done, y, width, height, flushed, ready;
+  double t;
+
+  ctx = arg;
+  width = ctx->width;
+  height = ctx->height;
+
+  /* Columns remapped per row, indexed in file order (bottom row first) */
+  done = calloc(height, sizeof(UINT));
+  if (done == NULL) ctx->e_write = EXIT_FAILURE;
+
+  flushed = 0;
+  while ((in = ring_pop(&ctx->to_write)) != (void *) &pipe_end) {
+    if (ctx->e_write != EXIT_SUCCESS) continue;
+
+    for (y = in->iminy; y < in->imaxy; y++) done[height - y - 1] += in->w;
+    for (ready = flushed; ready < height && done[ready] == width; ready++);
+    if (ready == flushed) continue;
+
+    /* Rows go out strictly in file order, so the output may be a pipe */
+    TIMING_START(t);
+    if (!BMP_WriteRows(ctx->dest, flushed, ready - flushed, ctx->f_out)) {
+      fprintf(stderr, EM_PIPE_WRITE, strerror(errno));
+      ctx->e_write = EXIT_FAILURE;
+      continue;
+    }
+    TIMING_STOP(PHASE_WRITE, t,
+      (ready - flushed) * (BMP_GetDataSize(ctx->dest) / height));
+#ifdef TRACE
+    fprintf(stderr, "wrote rows %lu-%lu\n", flushed, ready - 1);
+#endif
+    flushed = ready;
+  }
+
+  if (flushed < height) ctx->e_write = EXIT_FAILURE;
+  free(done);
+
+  return NULL;
+
+}
+
+/* pipe_results
+ * ------
+ * Receive the results from all slave nodes while remapping and writing the
+ * finished rows on separate threads.  The output file is complete on return.
+ *
+ * nslave:        slave count
+ * dest:          destination bitmap
+ * depth:         bit depth of image
+ * head:          head of linked list for all tiles
+ * max_data_size: size of the largest tile buffer in bytes
+ * codec:         transport codec the slaves encode results with
+ * f_out:         output file handle (empty)
+ *
+ * return: success or failure
+ *
+ */
+int pipe_results(int nslave, BMP *dest, int depth, struct mosaic_tile *head,
+  int max_data_size, int codec, int f_out) {
+
+  struct pipe_ctx ctx;
+  struct pipe_tile items[nslave];
+  struct pipe_rows rows[nslave];
+  struct mosaic_tile *tile;
+  MPI_Request recv_reqs[nslave];
+  MPI_Status recv_stat;
+  MPI_Datatype type;
+  pthread_t remap_thread, write_thread;
+  int complete, i, buf_size, test_flag, test_index;
+  double t, bytes;
+
+  complete = 0;
+
+  memset(&ctx, 0, sizeof(ctx));
+  ctx.dest = dest;
+  ctx.depth = depth;
+  ctx.codec = codec;
+  ctx.f_out = f_out;
+  ctx.rows = rows;
+
+  /* Gathered up front as qdbmp's error status is not thread safe */
+  ctx.width = BMP_GetWidth(dest);
+  ctx.height = BMP_GetHeight(dest);
+  ctx.e_remap = EXIT_SUCCESS;
+  ctx.e_write = EXIT_SUCCESS;
+
+  /* The header goes first, so the writer only ever touches pixel rows */
+  BMP_WriteHeader(dest, f_out);
+  if (BMP_CheckError(stderr) != BMP_OK) return EXIT_FAILURE;
+
+  /* Encoded tiles may be (slightly) larger than the raw tile */
+  buf_size = codec == CODEC_NONE ? max_data_size : codec_bound(max_data_size);
+  for (i = 0; i < nslave; i++) {
+    items[i].data = malloc(buf_size * sizeof(UCHAR));
+    if (items[i].data == NULL) {
+      fprintf(stderr, EM_OUT_OF_MEMORY, OOM_TYPE_RECEIPT_ARRAY);
+      while (i-- > 0) free(items[i].data);
+      return EXIT_FAILURE;
+    }
+  }
+
+  /* Pool the receipt of all other ranks */
+  tile = head;
+  do {
+    items[tile->id - 1].tile = tile;
+    if (codec == CODEC_NONE) {
+      type = tile_type(tile->size, tile->w, tile->h, depth);
+      MPI_Irecv(items[tile->id - 1].data, 1, type, tile->id, MPI_DATA_TAG,
+        MPI_COMM_WORLD, &recv_reqs[tile->id - 1]);
+      MPI_Type_free(&type);
+    } else {
+      MPI_Irecv(items[tile->id - 1].data, buf_size, MPI_UNSIGNED_CHAR,
+        tile->id, MPI_DATA_TAG, MPI_COMM_WORLD, &recv_reqs[tile->id - 1]);
+    }
+  } while ((tile = tile->next) != NULL);
+
+  if (pthread_create(&remap_thread, NULL, remap_main, &ctx) != 0) {
+    fprintf(stderr, EM_PIPE_THREAD);
+    return EXIT_FAILURE;
+  }
+  if (pthread_create(&write_thread, NULL, write_main, &ctx) != 0) {
+    fprintf(stderr, EM_PIPE_THREAD);
+    ring_push(&ctx.to_remap, &pipe_end);
+    pthread_join(remap_thread, NULL);
+    return EXIT_FAILURE;
+  }
+
+  /* Hand each tile to the remap thread as soon as it arrives */
+  TIMING_START(t);
+  bytes = 0;
+  do {
+    MPI_Testany(nslave, recv_reqs, &test_index, &test_flag, &recv_stat);
+    if (!test_flag) {
+      usleep(SLEEP_U);
+      continue;
+    }
+    TIMELINE_MARK(PHASE_RECV, test_index + 1);
+    progress_finish(test_index + 1);
+    MPI_Get_count(&recv_stat, MPI_UNSIGNED_CHAR, &items[test_index].count);
+    ring_push(&ctx.to_remap, &items[test_index]);
+    bytes += items[test_index].count;
+
+    ++complete;
+#ifdef TRACE
+    fprintf(stderr, "received %d/%d nodes\n", complete, nslave);
+#endif
+    if (complete == nslave) break;
+  } while (progress_poll() == 0);
+  TIMING_STOP(PHASE_RECV, t, bytes);
+
+  ring_push(&ctx.to_remap, &pipe_end);
+  pthread_join(remap_thread, NULL);
+  pthread_join(write_thread, NULL);
+
+  for (i = 0; i < nslave; i++) free(items[i].data);
+
+  /* Check for completeness */
+  if (complete < nslave) {
+    fprintf(stderr, EM_TIMEOUT_RECV_SLAVE, (nslave) - complete, nslave);
+    return EXIT_FAILURE;
+  }
+  if (ctx.e_remap != EXIT_SUCCESS || ctx.e_write != EXIT_SUCCESS) {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+
+}
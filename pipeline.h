@@ -0,0 +1,40 @@
+#ifndef _PIPELINE_H_
+#define _PIPELINE_H_
+
+/*
+ * pipeline.h
+ * ----------
+ * Threaded receipt of results on the master.  The calling thread receives
+ * tiles from the slaves, a remap thread decodes and translates each tile into
+ * the destination bitmap, and a writer thread flushes rows to the output file
+ * as soon as a contiguous run of them (from the bottom of the image, in file
+ * order) is complete.  Threads are connected by single producer, single
+ * consumer rings.
+ *
+ * NOTE: Only the calling thread makes MPI calls.
+ *
+ */
+
+#include "mosaic.h"
+#include "qdbmp.h"
+
+/* Constants */
+#define RING_SIZE         64    /* Slots per ring (must be a power of two) */
+
+/* Error messages */
+#define EM_PIPE_THREAD    "Failed to start pipeline thread\n"
+#define EM_PIPE_WRITE     "Failed to write output rows: %s\n"
+
+/*
+ * Lock free ring for passing pointers from one thread to another
+ */
+typedef struct ring {
+  void *slot[RING_SIZE];
+  UINT head;                  /* Next slot to read (consumer only) */
+  UINT tail;                  /* Next slot to write (producer only) */
+} RING;
+
+int pipe_results(int nslave, BMP *dest, int depth, struct mosaic_tile *head,
+  int max_data_size, int codec, int f_out);
+
+#endif /* _PIPELINE_H_ */
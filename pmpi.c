@@ -0,0 +1,444 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "const.h"
+#include "mpi.h"
+
+/*
+ * pmpi.c
+ * ------
+ * Communication profile of a job, built in with "make PMPI=1".  The point
+ * to point calls gaussianmpi makes are interposed through the MPI profiling
+ * interface (each MPI_X here does its accounting and calls PMPI_X), and at
+ * MPI_Finalize the master prints, for the whole job:
+ *
+ *   - the messages and bytes each rank sent to each other rank,
+ *   - the messages and bytes sent with each tag (see MPI_DATA_TAG),
+ *   - the time each rank spent in sends, receives, tests and waits, and
+ *     the bandwidth it achieved over that time.
+ *
+ * Sends are counted when posted, receives when they complete (so a
+ * receive counts the bytes that actually arrived).  Collectives, used only
+ * for calibration and reports, are not counted.
+ *
+ * The profile goes to stderr, or to the file named by PMPI_PROFILE_ENV.
+ *
+ */
+
+/* Constants */
+#define PMPI_PROFILE_ENV  "GAUSSIAN_PMPI_PROFILE"
+#define PMPI_TAGS         10      /* Tags 1 to 9, with 0 for any other */
+#define PMPI_GROW         64      /* Pending receives allocated at a time */
+
+/* Kinds of call timed */
+#define PMPI_SEND         0
+#define PMPI_RECV         1
+#define PMPI_TEST         2
+#define PMPI_WAIT         3
+#define PMPI_KINDS        4
+
+/* Error messages */
+#define EM_PMPI_OOM       "Out of memory for the communication profile\n"
+
+/* Counts of one rank: messages and bytes sent to and received from each
+ * peer, messages and bytes sent per tag, then seconds per kind of call */
+#define SENT_MSGS(s, n)   ((s) + 0 * (n))
+#define SENT_BYTES(s, n)  ((s) + 1 * (n))
+#define RECV_MSGS(s, n)   ((s) + 2 * (n))
+#define RECV_BYTES(s, n)  ((s) + 3 * (n))
+#define TAG_MSGS(s, n)    ((s) + 4 * (n))
+#define TAG_BYTES(s, n)   ((s) + 4 * (n) + PMPI_TAGS)
+#define SECONDS(s, n)     ((s) + 4 * (n) + 2 * PMPI_TAGS)
+#define STAT_FIELDS(n)    (4 * (n) + 2 * PMPI_TAGS + PMPI_KINDS)
+
+static const char *tag_names[PMPI_TAGS] = {
+  "other", "data", "size", "height", "width", "depth", "stdev", "clock",
+  "progress", "edge"
+};
+static const char *kind_names[PMPI_KINDS] = { "send", "recv", "test", "wait" };
+
+static double *stats;
+static int nproc;
+
+/* Receives posted but not yet complete */
+static MPI_Request *pending;
+static int npending, max_pending;
+
+/* get_stats
+ * ------
+ * Counts of this rank, allocated on first use
+ *
+ * returns: the counts, or NULL if out of memory
+ *
+ */
+static double *get_stats(void) {
+
+  if (stats == NULL) {
+    PMPI_Comm_size(MPI_COMM_WORLD, &nproc);
+    stats = calloc(STAT_FIELDS(nproc), sizeof(double));
+    if (stats == NULL) fprintf(stderr, EM_PMPI_OOM);
+  }
+
+  return stats;
+
+}
+
+/* count_message
+ * ------
+ * Count a message sent to or received from a peer
+ *
+ * sent:    non zero if sent by this rank
+ * peer:    rank of the peer
+ * tag:     tag of the message
+ * bytes:   size of the message
+ *
+ */
+static void count_message(int sent, int peer, int tag, double bytes) {
+
+  double *s;
+
+  if ((s = get_stats()) == NULL || peer < 0 || peer >= nproc) return;
+  if (sent) {
+    SENT_MSGS(s, nproc)[peer] += 1;
+    SENT_BYTES(s, nproc)[peer] += bytes;
+    if (tag < 0 || tag >= PMPI_TAGS) tag = 0;
+    TAG_MSGS(s, nproc)[tag] += 1;
+    TAG_BYTES(s, nproc)[tag] += bytes;
+  } else {
+    RECV_MSGS(s, nproc)[peer] += 1;
+    RECV_BYTES(s, nproc)[peer] += bytes;
+  }
+
+}
+
+/* count_time
+ * ------
+ * Charge the time since start to a kind of call
+ *
+ * kind:    kind of call (see PMPI_SEND)
+ * start:   PMPI_Wtime when the call began
+ *
+ */
+static void count_time(int kind, double start) {
+
+  double *s;
+
+  if ((s = get_stats()) != NULL) {
+    SECONDS(s, nproc)[kind] += PMPI_Wtime() - start;
+  }
+
+}
+
+/* count_completion
+ * ------
+ * Count a completed request if it was a receive
+ *
+ * req:     request as it was before completing
+ * status:  status of the completed request
+ *
+ */
+static void count_completion(MPI_Request req, MPI_Status *status) {
+
+  int i, bytes;
+
+  for (i = 0; i < npending; i++) {
+    if (pending[i] != req) continue;
+    pending[i] = pending[--npending];
+    PMPI_Get_count(status, MPI_BYTE, &bytes);
+    count_message(0, status->MPI_SOURCE, status->MPI_TAG, bytes);
+    return;
+  }
+
+}
+
+int MPI_Send(const void *buf, int count, MPI_Datatype datatype, int dest,
+  int tag, MPI_Comm comm) {
+
+  double start;
+  int size, e;
+
+  start = PMPI_Wtime();
+  e = PMPI_Send(buf, count, datatype, dest, tag, comm);
+  count_time(PMPI_SEND, start);
+  if (comm == MPI_COMM_WORLD) {
+    PMPI_Type_size(datatype, &size);
+    count_message(1, dest, tag, (double) count * size);
+  }
+
+  return e;
+
+}
+
+int MPI_Isend(const void *buf, int count, MPI_Datatype datatype, int dest,
+  int tag, MPI_Comm comm, MPI_Request *request) {
+
+  double start;
+  int size, e;
+
+  start = PMPI_Wtime();
+  e = PMPI_Isend(buf, count, datatype, dest, tag, comm, request);
+  count_time(PMPI_SEND, start);
+  if (comm == MPI_COMM_WORLD) {
+    PMPI_Type_size(datatype, &size);
+    count_message(1, dest, tag, (double) count * size);
+  }
+
+  return e;
+
+}
+
+int MPI_Recv(void *buf, int count, MPI_Datatype datatype, int source,
+  int tag, MPI_Comm comm, MPI_Status *status) {
+
+  MPI_Status own;
+  double start;
+  int bytes, e;
+
+  if (status == MPI_STATUS_IGNORE) status = &own;
+  start = PMPI_Wtime();
+  e = PMPI_Recv(buf, count, datatype, source, tag, comm, status);
+  count_time(PMPI_RECV, start);
+  if (comm == MPI_COMM_WORLD) {
+    PMPI_Get_count(status, MPI_BYTE, &bytes);
+    count_message(0, status->MPI_SOURCE, status->MPI_TAG, bytes);
+  }
+
+  return e;
+
+}
+
+int MPI_Irecv(void *buf, int count, MPI_Datatype datatype, int source,
+  int tag, MPI_Comm comm, MPI_Request *request) {
+
+  MPI_Request *grown;
+  double start;
+  int e;
+
+  start = PMPI_Wtime();
+  e = PMPI_Irecv(buf, count, datatype, source, tag, comm, request);
+  count_time(PMPI_RECV, start);
+  if (comm != MPI_COMM_WORLD || e != MPI_SUCCESS) return e;
+
+  if (npending == max_pending) {
+    grown = realloc(pending, (max_pending + PMPI_GROW) * sizeof(*pending));
+    if (grown == NULL) {
+      fprintf(stderr, EM_PMPI_OOM);
+      return e;
+    }
+    pending = grown;
+    max_pending += PMPI_GROW;
+  }
+  pending[npending++] = *request;
+
+  return e;
+
+}
+
+int MPI_Test(MPI_Request *request, int *flag, MPI_Status *status) {
+
+  MPI_Request req;
+  MPI_Status own;
+  double start;
+  int e;
+
+  if (status == MPI_STATUS_IGNORE) status = &own;
+  req = *request;
+  start = PMPI_Wtime();
+  e = PMPI_Test(request, flag, status);
+  count_time(PMPI_TEST, start);
+  if (*flag) count_completion(req, status);
+
+  return e;
+
+}
+
+int MPI_Testany(int count, MPI_Request array_of_requests[], int *index,
+  int *flag, MPI_Status *status) {
+
+  MPI_Request reqs[count];
+  MPI_Status own;
+  double start;
+  int e;
+
+  if (status == MPI_STATUS_IGNORE) status = &own;
+  memcpy(reqs, array_of_requests, count * sizeof(MPI_Request));
+  start = PMPI_Wtime();
+  e = PMPI_Testany(count, array_of_requests, index, flag, status);
+  count_time(PMPI_TEST, start);
+  if (*flag && *index != MPI_UNDEFINED) {
+    count_completion(reqs[*index], status);
+  }
+
+  return e;
+
+}
+
+int MPI_Testall(int count, MPI_Request array_of_requests[], int *flag,
+  MPI_Status array_of_statuses[]) {
+
+  MPI_Request reqs[count];
+  MPI_Status own[count];
+  double start;
+  int e, i;
+
+  if (array_of_statuses == MPI_STATUSES_IGNORE) array_of_statuses = own;
+  memcpy(reqs, array_of_requests, count * sizeof(MPI_Request));
+  start = PMPI_Wtime();
+  e = PMPI_Testall(count, array_of_requests, flag, array_of_statuses);
+  count_time(PMPI_TEST, start);
+  if (*flag) {
+    for (i = 0; i < count; i++) {
+      count_completion(reqs[i], &array_of_statuses[i]);
+    }
+  }
+
+  return e;
+
+}
+
+int MPI_Wait(MPI_Request *request, MPI_Status *status) {
+
+  MPI_Request req;
+  MPI_Status own;
+  double start;
+  int e;
+
+  if (status == MPI_STATUS_IGNORE) status = &own;
+  req = *request;
+  start = PMPI_Wtime();
+  e = PMPI_Wait(request, status);
+  count_time(PMPI_WAIT, start);
+  count_completion(req, status);
+
+  return e;
+
+}
+
+int MPI_Waitall(int count, MPI_Request array_of_requests[],
+  MPI_Status *array_of_statuses) {
+
+  MPI_Request reqs[count];
+  MPI_Status own[count];
+  double start;
+  int e, i;
+
+  if (array_of_statuses == MPI_STATUSES_IGNORE) array_of_statuses = own;
+  memcpy(reqs, array_of_requests, count * sizeof(MPI_Request));
+  start = PMPI_Wtime();
+  e = PMPI_Waitall(count, array_of_requests, array_of_statuses);
+  count_time(PMPI_WAIT, start);
+  for (i = 0; i < count; i++) {
+    count_completion(reqs[i], &array_of_statuses[i]);
+  }
+
+  return e;
+
+}
+
+/* print_matrix
+ * ------
+ * Print one count per pair of ranks, senders down and receivers across
+ *
+ * f:       output
+ * title:   what is counted
+ * all:     counts of every rank
+ * field:   offset of the counts within the counts of a rank
+ *
+ */
+static void print_matrix(FILE *f, const char *title, double *all,
+  int field) {
+
+  int from, to;
+
+  fprintf(f, "pmpi: %s (row sends to column)\npmpi: %4s", title, "");
+  for (to = 0; to < nproc; to++) fprintf(f, " %12d", to);
+  fprintf(f, "\n");
+  for (from = 0; from < nproc; from++) {
+    fprintf(f, "pmpi: %4d", from);
+    for (to = 0; to < nproc; to++) {
+      fprintf(f, " %12.0f", all[from * STAT_FIELDS(nproc) + field + to]);
+    }
+    fprintf(f, "\n");
+  }
+
+}
+
+/* print_profile
+ * ------
+ * Print the communication profile of every rank
+ *
+ * f:       output
+ * all:     counts of every rank
+ *
+ */
+static void print_profile(FILE *f, double *all) {
+
+  double *s, tags[2 * PMPI_TAGS], bytes, busy;
+  int rank, i;
+
+  print_matrix(f, "messages", all, 0);
+  print_matrix(f, "bytes", all, nproc);
+
+  memset(tags, 0, sizeof(tags));
+  for (rank = 0; rank < nproc; rank++) {
+    s = all + rank * STAT_FIELDS(nproc);
+    for (i = 0; i < 2 * PMPI_TAGS; i++) tags[i] += TAG_MSGS(s, nproc)[i];
+  }
+  fprintf(f, "pmpi: %-8s %10s %14s\n", "tag", "messages", "bytes");
+  for (i = 0; i < PMPI_TAGS; i++) {
+    if (tags[i] == 0) continue;
+    fprintf(f, "pmpi: %-8s %10.0f %14.0f\n", tag_names[i], tags[i],
+      tags[PMPI_TAGS + i]);
+  }
+
+  fprintf(f, "pmpi: %4s", "rank");
+  for (i = 0; i < PMPI_KINDS; i++) fprintf(f, " %8s s", kind_names[i]);
+  fprintf(f, " %14s %10s\n", "bytes", "MB/s");
+  for (rank = 0; rank < nproc; rank++) {
+    s = all + rank * STAT_FIELDS(nproc);
+    fprintf(f, "pmpi: %4d", rank);
+    for (busy = 0, i = 0; i < PMPI_KINDS; i++) {
+      fprintf(f, " %10.4f", SECONDS(s, nproc)[i]);
+      busy += SECONDS(s, nproc)[i];
+    }
+    for (bytes = 0, i = 0; i < nproc; i++) {
+      bytes += SENT_BYTES(s, nproc)[i] + RECV_BYTES(s, nproc)[i];
+    }
+    fprintf(f, " %14.0f %10.1f\n", bytes, busy > 0 ? bytes / busy / 1e6 : 0);
+  }
+
+}
+
+int MPI_Finalize(void) {
+
+  double *all;
+  char *fn_profile;
+  FILE *f;
+  int me;
+
+  /* Every rank must take part in the gather */
+  PMPI_Comm_rank(MPI_COMM_WORLD, &me);
+  all = NULL;
+  if (get_stats() == NULL || (me == MPI_MASTER_NODE &&
+        (all = malloc(nproc * STAT_FIELDS(nproc) * sizeof(double)))
+        == NULL)) {
+    fprintf(stderr, EM_PMPI_OOM);
+    PMPI_Abort(MPI_COMM_WORLD, MPI_ABORT_FAIL_CODE);
+    return MPI_ERR_NO_MEM;
+  }
+  PMPI_Gather(stats, STAT_FIELDS(nproc), MPI_DOUBLE, all,
+    STAT_FIELDS(nproc), MPI_DOUBLE, MPI_MASTER_NODE, MPI_COMM_WORLD);
+
+  if (all != NULL) {
+    fn_profile = getenv(PMPI_PROFILE_ENV);
+    f = fn_profile != NULL ? fopen(fn_profile, "w") : NULL;
+    print_profile(f != NULL ? f : stderr, all);
+    if (f != NULL) fclose(f);
+    free(all);
+  }
+  free(stats);
+  free(pending);
+
+  return PMPI_Finalize();
+
+}
@@ -0,0 +1,242 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "const.h"
+#include "mpi.h"
+#include "progress.h"
+
+/* Tile in flight on a slave, as seen by the master */
+struct progress_tile {
+  int busy;
+  UINT seq;                   /* Tiles sent to the slave so far */
+  UINT width, height;
+  UINT done;                  /* Rows reported done */
+  double bytes;
+  double sent;                /* When the tile was posted */
+  double started;             /* When the slave began blurring (0 before) */
+  double deadline;
+};
+
+static struct progress_tile *tiles;   /* Indexed by rank */
+static int max_rank;
+static int nbusy;
+static double period_start;           /* When the slaves last became busy */
+static double reported;               /* Last live report */
+static double px_total, px_finished;  /* Pixels posted and returned since */
+
+int progress_on = 0;
+
+/* heard
+ * ------
+ * Take in a heartbeat, moving the deadline of the tile out by the time the
+ * next chunk should take at the rate seen so far.  Heartbeats of a tile
+ * that has since been returned are ignored.
+ *
+ * rank:    slave the heartbeat came from
+ * beat:    tile number, rows done and rows of the next chunk
+ *
+ */
+static void heard(int rank, UINT *beat) {
+
+  struct progress_tile *p;
+  double now;
+
+  if (rank >= max_rank || !tiles[rank].busy || beat[0] != tiles[rank].seq) {
+    return;
+  }
+  p = &tiles[rank];
+  now = MPI_Wtime();
+
+  if (beat[1] == 0) {
+    p->started = now;
+  } else if (p->started == 0) {
+    p->started = p->sent;
+  }
+  p->done = beat[1];
+  p->deadline = now + PROGRESS_GRACE_S + p->bytes / PROGRESS_MIN_BPS;
+  if (p->done > 0) {
+    p->deadline += PROGRESS_SLACK * beat[2] * (now - p->started) / p->done;
+  }
+
+}
+
+/* drain
+ * ------
+ * Take in every heartbeat that has arrived
+ *
+ * source:  rank to take them from, or MPI_ANY_SOURCE
+ *
+ */
+static void drain(int source) {
+
+  MPI_Status status;
+  UINT beat[3];
+  int flag;
+
+  while (1) {
+    MPI_Iprobe(source, MPI_PROGRESS_TAG, MPI_COMM_WORLD, &flag, &status);
+    if (!flag) break;
+    MPI_Recv(beat, 3, MPI_UNSIGNED_LONG, status.MPI_SOURCE, MPI_PROGRESS_TAG,
+      MPI_COMM_WORLD, &status);
+    heard(status.MPI_SOURCE, beat);
+  }
+
+}
+
+/* report
+ * ------
+ * Print the throughput of the slaves since they became busy and the time
+ * the tiles in flight should take to finish at that rate
+ *
+ * now:     MPI_Wtime
+ *
+ */
+static void report(double now) {
+
+  double px_done, rate;
+  int i;
+
+  px_done = px_finished;
+  for (i = 0; i < max_rank; i++) {
+    if (tiles[i].busy) px_done += (double) tiles[i].done * tiles[i].width;
+  }
+  rate = px_done / (now - period_start);
+
+  fprintf(stderr, "progress: %5.1f%% of %.1f Mpx, %.2f Mpx/s", 100.0 *
+    px_done / px_total, px_total / 1e6, rate / 1e6);
+  if (rate > 0) {
+    fprintf(stderr, ", eta %.1f s\n", (px_total - px_done) / rate);
+  } else {
+    fprintf(stderr, ", eta unknown\n");
+  }
+  reported = now;
+
+}
+
+/* progress_start
+ * ------
+ * Master: note a tile posted to a slave, which is given the grace and
+ * transfer allowance to start on it
+ *
+ * rank:    slave
+ * width:   width of the tile (pixels)
+ * height:  height of the tile (rows)
+ * bytes:   size of the tile
+ *
+ * returns: success, or failure if out of memory
+ *
+ */
+int progress_start(int rank, UINT width, UINT height, UINT bytes) {
+
+  struct progress_tile *grown, *p;
+  int n;
+
+  if (rank >= max_rank) {
+    n = (rank / PROGRESS_GROW + 1) * PROGRESS_GROW;
+    grown = realloc(tiles, n * sizeof(*tiles));
+    if (grown == NULL) {
+      fprintf(stderr, EM_PROGRESS_OOM, rank);
+      return EXIT_FAILURE;
+    }
+    for (; max_rank < n; max_rank++) {
+      grown[max_rank].busy = 0;
+      grown[max_rank].seq = 0;
+    }
+    tiles = grown;
+  }
+
+  p = &tiles[rank];
+  if (nbusy++ == 0) {
+    period_start = MPI_Wtime();
+    reported = period_start;
+    px_total = 0;
+    px_finished = 0;
+  }
+  px_total += (double) width * height;
+
+  p->busy = 1;
+  p->seq++;
+  p->width = width;
+  p->height = height;
+  p->done = 0;
+  p->bytes = bytes;
+  p->sent = MPI_Wtime();
+  p->started = 0;
+  p->deadline = p->sent + PROGRESS_GRACE_S + bytes / PROGRESS_MIN_BPS;
+
+  return EXIT_SUCCESS;
+
+}
+
+/* progress_finish
+ * ------
+ * Master: note the result of a slave received, taking in the heartbeats it
+ * sent before the result
+ *
+ * rank:    slave
+ *
+ */
+void progress_finish(int rank) {
+
+  if (rank >= max_rank || !tiles[rank].busy) return;
+
+  drain(rank);
+  tiles[rank].busy = 0;
+  --nbusy;
+  px_finished += (double) tiles[rank].width * tiles[rank].height;
+
+}
+
+/* progress_poll
+ * ------
+ * Master: take in the heartbeats that have arrived, print the live report
+ * when it is due (with --verbose) and check every tile in flight against
+ * its deadline
+ *
+ * returns: rank of a slave past its deadline, or 0 if none
+ *
+ */
+int progress_poll(void) {
+
+  double now;
+  int i;
+
+  drain(MPI_ANY_SOURCE);
+
+  now = MPI_Wtime();
+  if (progress_on && nbusy > 0 && now - reported >= PROGRESS_REPORT_S) {
+    report(now);
+  }
+
+  for (i = 0; i < max_rank; i++) {
+    if (tiles[i].busy && now > tiles[i].deadline) {
+      fprintf(stderr, EM_PROGRESS_LATE, i, tiles[i].done, tiles[i].height,
+        now - tiles[i].sent);
+      return i;
+    }
+  }
+
+  return 0;
+
+}
+
+/* progress_beat
+ * ------
+ * Slave: tell the master how many rows of the current tile are done, and
+ * how many it will blur before the next heartbeat
+ *
+ * tile:    number of the tile on this slave, from 1
+ * rows:    rows done
+ * next:    rows of the next chunk (0 after the last)
+ *
+ */
+void progress_beat(UINT tile, UINT rows, UINT next) {
+
+  UINT beat[3];
+
+  beat[0] = tile;
+  beat[1] = rows;
+  beat[2] = next;
+  MPI_Send(beat, 3, MPI_UNSIGNED_LONG, MPI_MASTER_NODE, MPI_PROGRESS_TAG,
+    MPI_COMM_WORLD);
+
+}
@@ -0,0 +1,59 @@
+#ifndef _PROGRESS_H_
+#define _PROGRESS_H_
+
+#include "qdbmp.h"
+
+/*
+ * progress.h
+ * ----------
+ * Heartbeats from the slaves and the deadlines the master derives from
+ * them.  A slave blurs each tile a chunk of rows at a time and, after each
+ * chunk, sends the master the rows it has done (three UINTs on
+ * MPI_PROGRESS_TAG: the number of the tile on that slave, counted from 1,
+ * the rows done and the rows of the next chunk).  The first heartbeat, with
+ * no rows done, is sent as soon as the tile has arrived.
+ *
+ * The master measures the rows per second of every tile from its
+ * heartbeats and expects the next heartbeat (or the result, after the
+ * last) within
+ *
+ *   PROGRESS_GRACE_S + PROGRESS_SLACK * next chunk / rows per second
+ *     + tile bytes / PROGRESS_MIN_BPS
+ *
+ * of the latest, so a large image is given the time it needs while a slave
+ * that dies or stalls is noticed within seconds whatever the image.  Until
+ * a tile has a rate, the grace and transfer allowance alone apply.
+ *
+ * With --verbose (progress_on), the master prints how many tiles each image
+ * is divided into and, while tiles are in flight, the aggregate throughput
+ * of the slaves and an estimate of the time left every PROGRESS_REPORT_S.
+ *
+ */
+
+/* Slave */
+#define PROGRESS_BEAT_S       0.5   /* Time between heartbeats, roughly */
+#define PROGRESS_FIRST_ROWS   2     /* Rows blurred before the first rate */
+#define PROGRESS_HALO_ROWS    8     /* Min chunk, in kernel widths, for the
+                                       separable and FFT engines (each chunk
+                                       redoes the row pass of its halo) */
+
+/* Master */
+#define PROGRESS_GRACE_S      5.0   /* Allowance for any tile on top */
+#define PROGRESS_SLACK        3.0   /* Factor on the expected chunk time */
+#define PROGRESS_MIN_BPS      4e6   /* Slowest transfer allowed (bytes/s) */
+#define PROGRESS_REPORT_S     2.0   /* Time between live reports */
+#define PROGRESS_GROW         16    /* Slaves allocated at a time */
+
+/* Error messages */
+#define EM_PROGRESS_LATE      \
+  "Rank %d stopped making progress (%lu/%lu rows after %.1f s)\n"
+#define EM_PROGRESS_OOM       "Out of memory tracking rank %d\n"
+
+extern int progress_on;
+
+int progress_start(int rank, UINT width, UINT height, UINT bytes);
+void progress_finish(int rank);
+int progress_poll(void);
+void progress_beat(UINT tile, UINT rows, UINT next);
+
+#endif /* _PROGRESS_H_ */
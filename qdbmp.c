@@ -1,7 +1,13 @@
+#define _GNU_SOURCE   /* O_DIRECT */
+#include <errno.h>
 #include <fcntl.h>
+#include <limits.h>
+#include <pthread.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
 #include "qdbmp.h"
 
 /* Bitmap header */
@@ -30,12 +36,16 @@ struct _BMP {
   BMP_Header Header;
   UCHAR *Palette;
   UCHAR *Data;
+  UINT Stride;        /* Bytes per row in memory, see BMP_GetStride */
 };
 
 
 /* Holds the last error code */
 static BMP_STATUS BMP_LAST_ERROR_CODE = 0;
 
+/* Counts the write system calls made, see BMP_GetWriteCalls */
+static UINT BMP_WRITE_CALLS = 0;
+
 
 /* Error description strings */
 static const char *BMP_ERROR_STRING[] =
@@ -55,19 +65,67 @@ static const char *BMP_ERROR_STRING[] =
 /* Size of the palette data for 8 BPP bitmaps */
 #define BMP_PALETTE_SIZE  ( 256 * 4 )
 
+/* Size of the file and info headers together, as stored */
+#define BMP_HEADER_SIZE   54
+
+/* Alignment, and size of the staging buffer, for O_DIRECT output */
+#define BMP_DIRECT_ALIGN  4096
+#define BMP_DIRECT_CHUNK  ( 1 << 20 )
+
+/* Pixel buffers: rows start on a cache line, buffers from
+BMP_HUGE_SIZE up are mapped on huge pages, and up to BMP_POOL_SLOTS
+freed buffers, of BMP_POOL_BYTES in all, are kept for reuse (see
+BMP_DrainPool) */
+#define BMP_HUGE_SIZE     ( 2 << 20 )
+#define BMP_POOL_SLOTS    8
+#define BMP_POOL_BYTES    ( 64 << 20 )
+
+#ifndef IOV_MAX
+#define IOV_MAX           1024
+#endif
+
+/* Freed pixel buffers kept for reuse, by allocated size */
+static struct {
+  UCHAR *Data;
+  UINT Size;
+} BMP_POOL[BMP_POOL_SLOTS];
+static size_t BMP_POOL_TOTAL = 0;
+static pthread_mutex_t BMP_POOL_LOCK = PTHREAD_MUTEX_INITIALIZER;
+
 
 /*********************************** Forward declarations **********************************/
-int ReadHeader(BMP *bmp, FILE *f);
+int ReadFully(int fh, UCHAR *buf, UINT len);
+
+int ReadVector(int fh, struct iovec *iov, int n);
+
+int RowVectors(BMP *bmp, const UCHAR *data, UINT first, UINT count,
+  struct iovec *iov);
+
+UINT FileStride(BMP *bmp);
+
+UINT PixelsSize(UINT size);
+
+UCHAR *AllocPixels(UINT size);
+
+void FreePixels(UCHAR *data, UINT size);
+
+void ReleasePixels(UCHAR *data, UINT size);
 
-int WriteHeader(BMP *bmp, int fh);
+void ParseHeader(BMP *bmp, const UCHAR *buf);
 
-int ReadUINT(UINT *x, FILE *f);
+void PackHeader(BMP *bmp, UCHAR *buf);
 
-int ReadUSHORT(USHORT *x, FILE *f);
+int WriteFully(int fh, struct iovec *iov, int n);
 
-int WriteUINT(UINT x, int fh);
+int WriteDirect(int fh, struct iovec *iov, int n);
 
-int WriteUSHORT(USHORT x, int fh);
+UINT GetUINT(const UCHAR *little);
+
+USHORT GetUSHORT(const UCHAR *little);
+
+void PutUINT(UINT x, UCHAR *little);
+
+void PutUSHORT(USHORT x, UCHAR *little);
 
 
 int BMP_CheckError(FILE *out) {
@@ -124,8 +182,8 @@ BMP *BMP_Create(UINT width, UINT height, USHORT depth) {
   bmp->Header.ColorsRequired = 0;
 
 
-  /* Calculate the number of bytes used to store a single image row. This is always
-  rounded up to the next multiple of 4. */
+  /* Calculate the number of bytes used to store a single image row in the
+  file. This is always rounded up to the next multiple of 4. */
   bytes_per_row = width * bytes_per_pixel;
   bytes_per_row += (bytes_per_row % 4 ? 4 - bytes_per_row % 4 : 0);
 
@@ -138,6 +196,7 @@ BMP *BMP_Create(UINT width, UINT height, USHORT depth) {
   bmp->Header.FileSize =
   bmp->Header.ImageDataSize + 54 + (depth == 8 ? BMP_PALETTE_SIZE : 0);
   bmp->Header.DataOffset = 54 + (depth == 8 ? BMP_PALETTE_SIZE : 0);
+  bmp->Stride = BMP_RowStride(width, depth);
 
 
   /* Allocate palette */
@@ -155,7 +214,7 @@ BMP *BMP_Create(UINT width, UINT height, USHORT depth) {
 
 
   /* Allocate pixels */
-  bmp->Data = (UCHAR *) calloc(bmp->Header.ImageDataSize, sizeof(UCHAR));
+  bmp->Data = AllocPixels(bmp->Stride * height);
 
   if (bmp->Data == NULL) {
     BMP_LAST_ERROR_CODE = BMP_OUT_OF_MEMORY;
@@ -185,7 +244,7 @@ void BMP_Free(BMP *bmp) {
   }
 
   if (bmp->Data != NULL) {
-    free(bmp->Data);
+    FreePixels(bmp->Data, bmp->Stride * bmp->Header.Height);
   }
 
   free(bmp);
@@ -199,7 +258,7 @@ void BMP_Free(BMP *bmp) {
 **************************************************************/
 BMP *BMP_ReadFile(const char *filename) {
   BMP *bmp;
-  FILE *f;
+  int fh;
 
   if (filename == NULL) {
     BMP_LAST_ERROR_CODE = BMP_INVALID_ARGUMENT;
@@ -207,6 +266,39 @@ BMP *BMP_ReadFile(const char *filename) {
   }
 
 
+  /* Open file */
+  fh = open(filename, O_RDONLY);
+  if (fh < 0) {
+    BMP_LAST_ERROR_CODE = BMP_FILE_NOT_FOUND;
+    return NULL;
+  }
+
+  bmp = BMP_ReadStream(fh);
+  close(fh);
+
+  return bmp;
+}
+
+
+/**************************************************************
+	Reads a BMP image from an open file handle, which may be a
+	pipe: the header is taken in a single read and the rest of
+	the image strictly in order, with no seeking.
+**************************************************************/
+BMP *BMP_ReadStream(int fh) {
+  BMP *bmp;
+  UCHAR header[BMP_HEADER_SIZE];
+  UCHAR skip[BMP_PALETTE_SIZE];
+  struct iovec *iov;
+  UINT offset, gap;
+  int n;
+
+  if (fh < 0) {
+    BMP_LAST_ERROR_CODE = BMP_INVALID_ARGUMENT;
+    return NULL;
+  }
+
+
   /* Allocate */
   bmp = calloc(1, sizeof(BMP));
   if (bmp == NULL) {
@@ -215,19 +307,15 @@ BMP *BMP_ReadFile(const char *filename) {
   }
 
 
-  /* Open file */
-  f = fopen(filename, "rb");
-  if (f == NULL) {
-    BMP_LAST_ERROR_CODE = BMP_FILE_NOT_FOUND;
+  /* Read header */
+  if (ReadFully(fh, header, BMP_HEADER_SIZE) != BMP_OK) {
+    BMP_LAST_ERROR_CODE = BMP_FILE_INVALID;
     free(bmp);
     return NULL;
   }
-
-
-  /* Read header */
-  if (ReadHeader(bmp, f) != BMP_OK || bmp->Header.Magic != 0x4D42) {
+  ParseHeader(bmp, header);
+  if (bmp->Header.Magic != 0x4D42) {
     BMP_LAST_ERROR_CODE = BMP_FILE_INVALID;
-    fclose(f);
     free(bmp);
     return NULL;
   }
@@ -238,7 +326,6 @@ BMP *BMP_ReadFile(const char *filename) {
        bmp->Header.BitsPerPixel != 8)
       || bmp->Header.CompressionType != 0 || bmp->Header.HeaderSize != 40) {
     BMP_LAST_ERROR_CODE = BMP_FILE_NOT_SUPPORTED;
-    fclose(f);
     free(bmp);
     return NULL;
   }
@@ -249,15 +336,12 @@ BMP *BMP_ReadFile(const char *filename) {
     bmp->Palette = (UCHAR *) malloc(BMP_PALETTE_SIZE * sizeof(UCHAR));
     if (bmp->Palette == NULL) {
       BMP_LAST_ERROR_CODE = BMP_OUT_OF_MEMORY;
-      fclose(f);
       free(bmp);
       return NULL;
     }
 
-    if (fread(bmp->Palette, sizeof(UCHAR), BMP_PALETTE_SIZE, f) !=
-        BMP_PALETTE_SIZE) {
+    if (ReadFully(fh, bmp->Palette, BMP_PALETTE_SIZE) != BMP_OK) {
       BMP_LAST_ERROR_CODE = BMP_FILE_INVALID;
-      fclose(f);
       free(bmp->Palette);
       free(bmp);
       return NULL;
@@ -269,30 +353,73 @@ BMP *BMP_ReadFile(const char *filename) {
   }
 
 
-  /* Allocate memory for image data */
-  bmp->Data = (UCHAR *) malloc(bmp->Header.ImageDataSize);
-  if (bmp->Data == NULL) {
-    BMP_LAST_ERROR_CODE = BMP_OUT_OF_MEMORY;
-    fclose(f);
-    free(bmp->Palette);
-    free(bmp);
-    return NULL;
+  /* Skip anything between the palette and the image data, as a stream
+  can't seek past it */
+  offset = BMP_HEADER_SIZE + (bmp->Palette ? BMP_PALETTE_SIZE : 0);
+  gap = 0;
+  if (bmp->Header.DataOffset > offset) {
+    /* The image is written back without it */
+    gap = bmp->Header.DataOffset - offset;
+    bmp->Header.FileSize -= gap;
+    bmp->Header.DataOffset = offset;
+  }
+  while (gap > 0) {
+    if (ReadFully(fh, skip, gap < sizeof(skip) ? gap : sizeof(skip))
+        != BMP_OK) {
+      BMP_LAST_ERROR_CODE = BMP_FILE_INVALID;
+      free(bmp->Palette);
+      free(bmp);
+      return NULL;
+    }
+    gap -= gap < sizeof(skip) ? gap : sizeof(skip);
   }
 
 
-  /* Read image data */
-  if (fread(bmp->Data, sizeof(UCHAR), bmp->Header.ImageDataSize, f) !=
-      bmp->Header.ImageDataSize) {
+  /* Allocate memory for image data, padding each row out to BMP_ROW_ALIGN */
+  if (bmp->Header.Width == 0 || bmp->Header.Height == 0 ||
+      bmp->Header.ImageDataSize < FileStride(bmp) * bmp->Header.Height) {
     BMP_LAST_ERROR_CODE = BMP_FILE_INVALID;
-    fclose(f);
-    free(bmp->Data);
     free(bmp->Palette);
     free(bmp);
     return NULL;
   }
+  bmp->Stride = BMP_RowStride(bmp->Header.Width, bmp->Header.BitsPerPixel);
+  bmp->Data = AllocPixels(bmp->Stride * bmp->Header.Height);
+  iov = malloc(bmp->Header.Height * sizeof(struct iovec));
+  if (bmp->Data == NULL || iov == NULL) {
+    free(iov);
+    BMP_Free(bmp);
+    BMP_LAST_ERROR_CODE = BMP_OUT_OF_MEMORY;
+    return NULL;
+  }
 
 
-  fclose(f);
+  /* Read image data, scattering the rows */
+  n = RowVectors(bmp, bmp->Data, 0, bmp->Header.Height, iov);
+  if (ReadVector(fh, iov, n) != BMP_OK) {
+    free(iov);
+    BMP_Free(bmp);
+    BMP_LAST_ERROR_CODE = BMP_FILE_INVALID;
+    return NULL;
+  }
+  free(iov);
+
+
+  /* Anything after the rows is dropped, and the image written back
+  without it */
+  gap = bmp->Header.ImageDataSize - FileStride(bmp) * bmp->Header.Height;
+  bmp->Header.ImageDataSize -= gap;
+  bmp->Header.FileSize -= gap;
+  while (gap > 0) {
+    if (ReadFully(fh, skip, gap < sizeof(skip) ? gap : sizeof(skip))
+        != BMP_OK) {
+      BMP_Free(bmp);
+      BMP_LAST_ERROR_CODE = BMP_FILE_INVALID;
+      return NULL;
+    }
+    gap -= gap < sizeof(skip) ? gap : sizeof(skip);
+  }
+
 
   BMP_LAST_ERROR_CODE = BMP_OK;
 
@@ -304,41 +431,143 @@ BMP *BMP_ReadFile(const char *filename) {
 	Writes the BMP image to the specified file.
 **************************************************************/
 void BMP_WriteFile(BMP *bmp, int fh) {
+  BMP_WriteFileData(bmp, bmp == NULL ? NULL : bmp->Data, fh);
+}
 
-  /* Open file */
-  //f = fopen(filename, "wb");
+
+/**************************************************************
+	Writes the BMP header and palette (if any) followed by the
+	given image data, which must be laid out as the BMP's own
+	(see BMP_GetStride).
+	The whole file goes out in a single vectored write, or
+	through an aligned buffer if the file handle was opened with
+	O_DIRECT.
+**************************************************************/
+void BMP_WriteFileData(BMP *bmp, const UCHAR *data, int fh) {
+  UCHAR header[BMP_HEADER_SIZE];
+  struct iovec *iov;
+  int n, flags;
+
+  if (bmp == NULL || data == NULL) {
+    BMP_LAST_ERROR_CODE = BMP_INVALID_ARGUMENT;
+    return;
+  }
   if (fh < 0) {
     BMP_LAST_ERROR_CODE = BMP_FILE_NOT_FOUND;
     return;
   }
 
-  /* Write header */
-  if (WriteHeader(bmp, fh) != BMP_OK) {
-    BMP_LAST_ERROR_CODE = BMP_IO_ERROR;
-    close(fh);
+  iov = malloc((bmp->Header.Height + 2) * sizeof(struct iovec));
+  if (iov == NULL) {
+    BMP_LAST_ERROR_CODE = BMP_OUT_OF_MEMORY;
     return;
   }
 
-
-  /* Write palette */
+  PackHeader(bmp, header);
+  n = 0;
+  iov[n].iov_base = header;
+  iov[n++].iov_len = BMP_HEADER_SIZE;
   if (bmp->Palette) {
-    if (write(fh, bmp->Palette, sizeof(UCHAR) * BMP_PALETTE_SIZE) != BMP_PALETTE_SIZE) {
-      BMP_LAST_ERROR_CODE = BMP_IO_ERROR;
-      close(fh);
-      return;
-    }
+    iov[n].iov_base = bmp->Palette;
+    iov[n++].iov_len = BMP_PALETTE_SIZE;
   }
+  n += RowVectors(bmp, data, 0, bmp->Header.Height, iov + n);
+
+  flags = fcntl(fh, F_GETFL);
+  if (flags >= 0 && (flags & O_DIRECT)) {
+    BMP_LAST_ERROR_CODE = WriteDirect(fh, iov, n);
+  } else {
+    BMP_LAST_ERROR_CODE = WriteFully(fh, iov, n);
+  }
+  free(iov);
+}
 
 
-  /* Write data */
-  if (write(fh, bmp->Data, sizeof(UCHAR) * bmp->Header.ImageDataSize) != bmp->Header.ImageDataSize) {
-    BMP_LAST_ERROR_CODE = BMP_IO_ERROR;
-    close(fh);
+/**************************************************************
+	Writes the BMP header and palette (if any) to the specified
+	file, leaving the image data to be written by the caller at
+	BMP_GetDataOffset.
+**************************************************************/
+void BMP_WriteHeader(BMP *bmp, int fh) {
+  UCHAR header[BMP_HEADER_SIZE];
+  struct iovec iov[2];
+  int n;
+
+  if (bmp == NULL) {
+    BMP_LAST_ERROR_CODE = BMP_INVALID_ARGUMENT;
+    return;
+  }
+  if (fh < 0) {
+    BMP_LAST_ERROR_CODE = BMP_FILE_NOT_FOUND;
     return;
   }
 
-  BMP_LAST_ERROR_CODE = BMP_OK;
+  PackHeader(bmp, header);
+  n = 0;
+  iov[n].iov_base = header;
+  iov[n++].iov_len = BMP_HEADER_SIZE;
+  if (bmp->Palette) {
+    iov[n].iov_base = bmp->Palette;
+    iov[n++].iov_len = BMP_PALETTE_SIZE;
+  }
 
+  BMP_LAST_ERROR_CODE = WriteFully(fh, iov, n);
+}
+
+
+/**************************************************************
+	Writes rows [first, first + count) of the image data, in
+	file order, at the current position of the file handle.
+	Unlike the rest of the API this leaves the error code alone,
+	so it may be called from a thread of its own.
+	Returns non-zero on success.
+**************************************************************/
+int BMP_WriteRows(BMP *bmp, UINT first, UINT count, int fh) {
+  struct iovec *iov;
+  int e;
+
+  if (bmp == NULL || fh < 0 || first + count > bmp->Header.Height) {
+    return 0;
+  }
+
+  iov = malloc(count * sizeof(struct iovec));
+  if (iov == NULL) {
+    return 0;
+  }
+  e = WriteFully(fh, iov, RowVectors(bmp, bmp->Data, first, count, iov));
+  free(iov);
+
+  return e == BMP_OK;
+}
+
+
+/**************************************************************
+	Returns every pixel buffer kept for reuse to the system, e.g.
+	once a process has finished with its bitmaps.  Bitmaps still
+	in use are unaffected.
+**************************************************************/
+void BMP_DrainPool() {
+  int i;
+
+  pthread_mutex_lock(&BMP_POOL_LOCK);
+  for (i = 0; i < BMP_POOL_SLOTS; i++) {
+    if (BMP_POOL[i].Data != NULL) {
+      ReleasePixels(BMP_POOL[i].Data, BMP_POOL[i].Size);
+      BMP_POOL[i].Data = NULL;
+    }
+  }
+  BMP_POOL_TOTAL = 0;
+  pthread_mutex_unlock(&BMP_POOL_LOCK);
+}
+
+
+/**************************************************************
+	Returns the number of write system calls made so far by the
+	functions above, to be compared before and after writing a
+	file.
+**************************************************************/
+UINT BMP_GetWriteCalls() {
+  return __atomic_load_n(&BMP_WRITE_CALLS, __ATOMIC_RELAXED);
 }
 
 
@@ -385,11 +614,39 @@ USHORT BMP_GetDepth(BMP *bmp) {
   return (bmp->Header.BitsPerPixel);
 }
 
-/* Returns the size of the underlying data in bytes */
+/* Returns the size of the pixel data in bytes, as held in the file */
 UINT BMP_GetDataSize(BMP *bmp) {
-  return bmp->Header.ImageDataSize;
+  return FileStride(bmp) * bmp->Header.Height;
+}
+
+/* Returns the size of the pixel buffer in bytes, as held in memory (with
+rows padded out to BMP_ROW_ALIGN bytes) */
+UINT BMP_GetAllocSize(BMP *bmp) {
+  return bmp->Stride * bmp->Header.Height;
+}
+
+/* Returns the offset of the image data from the start of the file */
+UINT BMP_GetDataOffset(BMP *bmp) {
+  return bmp->Header.DataOffset;
 }
 
+/* Returns the bytes from one row to the next in memory.  Rows are padded
+out to BMP_ROW_ALIGN bytes, and only converted to the file's 4 byte
+padding when read or written. */
+UINT BMP_GetStride(BMP *bmp) {
+  return bmp->Stride;
+}
+
+/* Returns the in memory row stride of an image of the given width and
+depth */
+UINT BMP_RowStride(UINT width, USHORT depth) {
+  UINT bytes_per_row;
+
+  bytes_per_row = width * (depth >> 3);
+  return (bytes_per_row + BMP_ROW_ALIGN - 1) & ~((UINT) BMP_ROW_ALIGN - 1);
+}
+
+
 /* Returns the underlying data of the bmp*/
 UCHAR *BMP_GetData(BMP *bmp) {
   return bmp->Data;
@@ -397,7 +654,7 @@ UCHAR *BMP_GetData(BMP *bmp) {
 
 /* Overrides the underlying data of the bmp */
 void BMP_SetData(BMP *bmp, UCHAR *data) {
-  memcpy(bmp->Data, data, bmp->Header.ImageDataSize);
+  memcpy(bmp->Data, data, bmp->Stride * bmp->Header.Height);
 }
 
 
@@ -420,8 +677,8 @@ void BMP_GetPixelRGB(BMP *bmp, UINT x, UINT y, UCHAR *r, UCHAR *g, UCHAR *b) {
 
     bytes_per_pixel = bmp->Header.BitsPerPixel >> 3;
 
-    /* Row's size is rounded up to the next multiple of 4 bytes */
-    bytes_per_row = bmp->Header.ImageDataSize / bmp->Header.Height;
+    /* Rows are padded out to BMP_ROW_ALIGN bytes in memory */
+    bytes_per_row = bmp->Stride;
 
     /* Calculate the location of the relevant pixel (rows are flipped) */
     pixel = bmp->Data + ((bmp->Header.Height - y - 1) * bytes_per_row +
@@ -463,8 +720,8 @@ void BMP_SetPixelRGB(BMP *bmp, UINT x, UINT y, UCHAR r, UCHAR g, UCHAR b) {
 
     bytes_per_pixel = bmp->Header.BitsPerPixel >> 3;
 
-    /* Row's size is rounded up to the next multiple of 4 bytes */
-    bytes_per_row = bmp->Header.ImageDataSize / bmp->Header.Height;
+    /* Rows are padded out to BMP_ROW_ALIGN bytes in memory */
+    bytes_per_row = bmp->Stride;
 
     /* Calculate the location of the relevant pixel (rows are flipped) */
     pixel = bmp->Data + ((bmp->Header.Height - y - 1) * bytes_per_row +
@@ -497,8 +754,8 @@ void BMP_GetPixelIndex(BMP *bmp, UINT x, UINT y, UCHAR *val) {
   else {
     BMP_LAST_ERROR_CODE = BMP_OK;
 
-    /* Row's size is rounded up to the next multiple of 4 bytes */
-    bytes_per_row = bmp->Header.ImageDataSize / bmp->Header.Height;
+    /* Rows are padded out to BMP_ROW_ALIGN bytes in memory */
+    bytes_per_row = bmp->Stride;
 
     /* Calculate the location of the relevant pixel */
     pixel = bmp->Data + ((bmp->Header.Height - y - 1) * bytes_per_row + x);
@@ -527,8 +784,8 @@ void BMP_SetPixelIndex(BMP *bmp, UINT x, UINT y, UCHAR val) {
   else {
     BMP_LAST_ERROR_CODE = BMP_OK;
 
-    /* Row's size is rounded up to the next multiple of 4 bytes */
-    bytes_per_row = bmp->Header.ImageDataSize / bmp->Header.Height;
+    /* Rows are padded out to BMP_ROW_ALIGN bytes in memory */
+    bytes_per_row = bmp->Stride;
 
     /* Calculate the location of the relevant pixel */
     pixel = bmp->Data + ((bmp->Header.Height - y - 1) * bytes_per_row + x);
@@ -610,138 +867,380 @@ const char *BMP_GetErrorDescription() {
 
 
 /**************************************************************
-	Reads the BMP file's header into the data structure.
+	Reads exactly len bytes from the file handle, retrying the
+	short reads a pipe or socket may return.
 	Returns BMP_OK on success.
 **************************************************************/
-int ReadHeader(BMP *bmp, FILE *f) {
-  if (bmp == NULL || f == NULL) {
-    return BMP_INVALID_ARGUMENT;
-  }
-
-  /* The header's fields are read one by one, and converted from the format's
-  little endian to the system's native representation. */
-  if (!ReadUSHORT(&(bmp->Header.Magic), f)) return BMP_IO_ERROR;
-  if (!ReadUINT(&(bmp->Header.FileSize), f)) return BMP_IO_ERROR;
-  if (!ReadUSHORT(&(bmp->Header.Reserved1), f)) return BMP_IO_ERROR;
-  if (!ReadUSHORT(&(bmp->Header.Reserved2), f)) return BMP_IO_ERROR;
-  if (!ReadUINT(&(bmp->Header.DataOffset), f)) return BMP_IO_ERROR;
-  if (!ReadUINT(&(bmp->Header.HeaderSize), f)) return BMP_IO_ERROR;
-  if (!ReadUINT(&(bmp->Header.Width), f)) return BMP_IO_ERROR;
-  if (!ReadUINT(&(bmp->Header.Height), f)) return BMP_IO_ERROR;
-  if (!ReadUSHORT(&(bmp->Header.Planes), f)) return BMP_IO_ERROR;
-  if (!ReadUSHORT(&(bmp->Header.BitsPerPixel), f)) return BMP_IO_ERROR;
-  if (!ReadUINT(&(bmp->Header.CompressionType), f)) return BMP_IO_ERROR;
-  if (!ReadUINT(&(bmp->Header.ImageDataSize), f)) return BMP_IO_ERROR;
-  if (!ReadUINT(&(bmp->Header.HPixelsPerMeter), f)) return BMP_IO_ERROR;
-  if (!ReadUINT(&(bmp->Header.VPixelsPerMeter), f)) return BMP_IO_ERROR;
-  if (!ReadUINT(&(bmp->Header.ColorsUsed), f)) return BMP_IO_ERROR;
-  if (!ReadUINT(&(bmp->Header.ColorsRequired), f)) return BMP_IO_ERROR;
+int ReadFully(int fh, UCHAR *buf, UINT len) {
+  ssize_t got;
+
+  while (len > 0) {
+    got = read(fh, buf, len);
+    if (got < 0 && errno == EINTR) continue;
+    if (got <= 0) return BMP_IO_ERROR;
+    buf += got;
+    len -= got;
+  }
 
   return BMP_OK;
 }
 
 
 /**************************************************************
-	Writes the BMP file's header into the data structure.
+	Reads into the buffers in order, resuming after short reads.
 	Returns BMP_OK on success.
 **************************************************************/
-int WriteHeader(BMP *bmp, int fh) {
-
-  if (bmp == NULL || fh < 0) {
-    return BMP_INVALID_ARGUMENT;
-  }
-
-  /* The header's fields are written one by one, and converted to the format's
-  little endian representation. */
-  if (!WriteUSHORT(bmp->Header.Magic, fh)) return BMP_IO_ERROR;
-  if (!WriteUINT(bmp->Header.FileSize, fh)) return BMP_IO_ERROR;
-  if (!WriteUSHORT(bmp->Header.Reserved1, fh)) return BMP_IO_ERROR;
-  if (!WriteUSHORT(bmp->Header.Reserved2, fh)) return BMP_IO_ERROR;
-  if (!WriteUINT(bmp->Header.DataOffset, fh)) return BMP_IO_ERROR;
-  if (!WriteUINT(bmp->Header.HeaderSize, fh)) return BMP_IO_ERROR;
-  if (!WriteUINT(bmp->Header.Width, fh)) return BMP_IO_ERROR;
-  if (!WriteUINT(bmp->Header.Height, fh)) return BMP_IO_ERROR;
-  if (!WriteUSHORT(bmp->Header.Planes, fh)) return BMP_IO_ERROR;
-  if (!WriteUSHORT(bmp->Header.BitsPerPixel, fh)) return BMP_IO_ERROR;
-  if (!WriteUINT(bmp->Header.CompressionType, fh)) return BMP_IO_ERROR;
-  if (!WriteUINT(bmp->Header.ImageDataSize, fh)) return BMP_IO_ERROR;
-  if (!WriteUINT(bmp->Header.HPixelsPerMeter, fh)) return BMP_IO_ERROR;
-  if (!WriteUINT(bmp->Header.VPixelsPerMeter, fh)) return BMP_IO_ERROR;
-  if (!WriteUINT(bmp->Header.ColorsUsed, fh)) return BMP_IO_ERROR;
-  if (!WriteUINT(bmp->Header.ColorsRequired, fh)) return BMP_IO_ERROR;
+int ReadVector(int fh, struct iovec *iov, int n) {
+  ssize_t got;
+
+  while (n > 0) {
+    got = readv(fh, iov, n < IOV_MAX ? n : IOV_MAX);
+    if (got < 0 && errno == EINTR) continue;
+    if (got <= 0) return BMP_IO_ERROR;
+
+    /* Skip what was read */
+    while (n > 0 && (size_t) got >= iov->iov_len) {
+      got -= iov->iov_len;
+      iov++;
+      n--;
+    }
+    if (n > 0) {
+      iov->iov_base = (UCHAR *) iov->iov_base + got;
+      iov->iov_len -= got;
+    }
+  }
 
   return BMP_OK;
+}
+
 
+/**************************************************************
+	Describes rows [first, first + count) of the pixel data as
+	they are stored in the file: one buffer if the memory and file
+	strides agree, otherwise one per row.
+	Returns the number of buffers filled in (at most count).
+**************************************************************/
+int RowVectors(BMP *bmp, const UCHAR *data, UINT first, UINT count,
+  struct iovec *iov) {
+  UINT file_stride, y;
+
+  file_stride = FileStride(bmp);
+  if (file_stride == bmp->Stride) {
+    iov->iov_base = (UCHAR *) data + first * bmp->Stride;
+    iov->iov_len = count * bmp->Stride;
+    return count > 0;
+  }
+
+  for (y = 0; y < count; y++) {
+    iov[y].iov_base = (UCHAR *) data + (first + y) * bmp->Stride;
+    iov[y].iov_len = file_stride;
+  }
+
+  return count;
 }
 
 
 /**************************************************************
-	Reads a little-endian unsigned int from the file.
-	Returns non-zero on success.
+	Returns the bytes per row in the file, which are rounded up
+	to the next multiple of 4.
 **************************************************************/
-int ReadUINT(UINT *x, FILE *f) {
-  UCHAR little[4];  /* BMPs use 32 bit ints */
+UINT FileStride(BMP *bmp) {
+  UINT bytes_per_row;
 
-  if (x == NULL || f == NULL) {
-    return 0;
+  bytes_per_row = bmp->Header.Width * (bmp->Header.BitsPerPixel >> 3);
+  return bytes_per_row + (bytes_per_row % 4 ? 4 - bytes_per_row % 4 : 0);
+}
+
+
+/**************************************************************
+	Returns the size actually allocated for a pixel buffer: whole
+	huge pages from BMP_HUGE_SIZE up, otherwise whole cache lines.
+**************************************************************/
+UINT PixelsSize(UINT size) {
+  if (size >= BMP_HUGE_SIZE) {
+    return (size + BMP_HUGE_SIZE - 1) & ~((UINT) BMP_HUGE_SIZE - 1);
   }
+  return (size + BMP_ROW_ALIGN - 1) & ~((UINT) BMP_ROW_ALIGN - 1);
+}
 
-  if (fread(little, 4, 1, f) != 1) {
-    return 0;
+
+/**************************************************************
+	Allocates a zeroed pixel buffer aligned to BMP_ROW_ALIGN,
+	reusing a pooled buffer of the same size if there is one.
+	Large buffers are mapped on huge pages: explicitly if the
+	system has some reserved, otherwise by asking for transparent
+	ones.
+	Returns NULL if out of memory.
+**************************************************************/
+UCHAR *AllocPixels(UINT size) {
+  UCHAR *data;
+  void *p;
+  int i;
+
+  size = PixelsSize(size);
+
+  data = NULL;
+  pthread_mutex_lock(&BMP_POOL_LOCK);
+  for (i = 0; i < BMP_POOL_SLOTS; i++) {
+    if (BMP_POOL[i].Data != NULL && BMP_POOL[i].Size == size) {
+      data = BMP_POOL[i].Data;
+      BMP_POOL[i].Data = NULL;
+      BMP_POOL_TOTAL -= size;
+      break;
+    }
+  }
+  pthread_mutex_unlock(&BMP_POOL_LOCK);
+  if (data != NULL) {
+    memset(data, 0, size);
+    return data;
   }
 
-  *x = (little[3] << 24 | little[2] << 16 | little[1] << 8 | little[0]);
+  if (size >= BMP_HUGE_SIZE) {
+    p = mmap(NULL, size, PROT_READ | PROT_WRITE,
+             MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    if (p == MAP_FAILED) {
+      p = mmap(NULL, size, PROT_READ | PROT_WRITE,
+               MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (p == MAP_FAILED) return NULL;
+      madvise(p, size, MADV_HUGEPAGE);
+    }
+    return p;
+  }
+
+  if (posix_memalign(&p, BMP_ROW_ALIGN, size) != 0) return NULL;
+  memset(p, 0, size);
 
-  return 1;
+  return p;
 }
 
 
 /**************************************************************
-	Reads a little-endian unsigned short int from the file.
-	Returns non-zero on success.
+	Returns a pixel buffer from AllocPixels to the pool, or to
+	the system if the pool has no slot or bytes to spare for it.
+**************************************************************/
+void FreePixels(UCHAR *data, UINT size) {
+  int i;
+
+  size = PixelsSize(size);
+
+  pthread_mutex_lock(&BMP_POOL_LOCK);
+  for (i = 0; i < BMP_POOL_SLOTS && size <= BMP_POOL_BYTES - BMP_POOL_TOTAL;
+       i++) {
+    if (BMP_POOL[i].Data == NULL) {
+      BMP_POOL[i].Data = data;
+      BMP_POOL[i].Size = size;
+      BMP_POOL_TOTAL += size;
+      data = NULL;
+      break;
+    }
+  }
+  pthread_mutex_unlock(&BMP_POOL_LOCK);
+  if (data != NULL) ReleasePixels(data, size);
+}
+
+
+/**************************************************************
+	Returns a pixel buffer of the size PixelsSize allocated to
+	the system.
+**************************************************************/
+void ReleasePixels(UCHAR *data, UINT size) {
+  if (size >= BMP_HUGE_SIZE) {
+    munmap(data, size);
+  } else {
+    free(data);
+  }
+}
+
+
+/**************************************************************
+	Parses the BMP file's header from its stored form into the
+	data structure.
 **************************************************************/
-int ReadUSHORT(USHORT *x, FILE *f) {
-  UCHAR little[2];  /* BMPs use 16 bit shorts */
+void ParseHeader(BMP *bmp, const UCHAR *buf) {
+
+  /* The header's fields are converted from the format's little endian to
+  the system's native representation. */
+  bmp->Header.Magic = GetUSHORT(buf + 0);
+  bmp->Header.FileSize = GetUINT(buf + 2);
+  bmp->Header.Reserved1 = GetUSHORT(buf + 6);
+  bmp->Header.Reserved2 = GetUSHORT(buf + 8);
+  bmp->Header.DataOffset = GetUINT(buf + 10);
+  bmp->Header.HeaderSize = GetUINT(buf + 14);
+  bmp->Header.Width = GetUINT(buf + 18);
+  bmp->Header.Height = GetUINT(buf + 22);
+  bmp->Header.Planes = GetUSHORT(buf + 26);
+  bmp->Header.BitsPerPixel = GetUSHORT(buf + 28);
+  bmp->Header.CompressionType = GetUINT(buf + 30);
+  bmp->Header.ImageDataSize = GetUINT(buf + 34);
+  bmp->Header.HPixelsPerMeter = GetUINT(buf + 38);
+  bmp->Header.VPixelsPerMeter = GetUINT(buf + 42);
+  bmp->Header.ColorsUsed = GetUINT(buf + 46);
+  bmp->Header.ColorsRequired = GetUINT(buf + 50);
+}
 
-  if (x == NULL || f == NULL) {
-    return 0;
+
+/**************************************************************
+	Packs the BMP file's header into its stored form, ready to be
+	written in one piece.
+**************************************************************/
+void PackHeader(BMP *bmp, UCHAR *buf) {
+
+  /* The header's fields are converted to the format's little endian
+  representation. */
+  PutUSHORT(bmp->Header.Magic, buf + 0);
+  PutUINT(bmp->Header.FileSize, buf + 2);
+  PutUSHORT(bmp->Header.Reserved1, buf + 6);
+  PutUSHORT(bmp->Header.Reserved2, buf + 8);
+  PutUINT(bmp->Header.DataOffset, buf + 10);
+  PutUINT(bmp->Header.HeaderSize, buf + 14);
+  PutUINT(bmp->Header.Width, buf + 18);
+  PutUINT(bmp->Header.Height, buf + 22);
+  PutUSHORT(bmp->Header.Planes, buf + 26);
+  PutUSHORT(bmp->Header.BitsPerPixel, buf + 28);
+  PutUINT(bmp->Header.CompressionType, buf + 30);
+  PutUINT(bmp->Header.ImageDataSize, buf + 34);
+  PutUINT(bmp->Header.HPixelsPerMeter, buf + 38);
+  PutUINT(bmp->Header.VPixelsPerMeter, buf + 42);
+  PutUINT(bmp->Header.ColorsUsed, buf + 46);
+  PutUINT(bmp->Header.ColorsRequired, buf + 50);
+}
+
+
+/**************************************************************
+	Writes the buffers in order with as few vectored writes as
+	the file handle allows, resuming after short writes.
+	Returns BMP_OK on success.
+**************************************************************/
+int WriteFully(int fh, struct iovec *iov, int n) {
+  ssize_t put;
+
+  while (n > 0) {
+    __atomic_add_fetch(&BMP_WRITE_CALLS, 1, __ATOMIC_RELAXED);
+    put = writev(fh, iov, n < IOV_MAX ? n : IOV_MAX);
+    if (put < 0 && errno == EINTR) continue;
+    if (put < 0) return BMP_IO_ERROR;
+
+    /* Skip what was written */
+    while (n > 0 && (size_t) put >= iov->iov_len) {
+      put -= iov->iov_len;
+      iov++;
+      n--;
+    }
+    if (n > 0) {
+      iov->iov_base = (UCHAR *) iov->iov_base + put;
+      iov->iov_len -= put;
+    }
   }
 
-  if (fread(little, 2, 1, f) != 1) {
-    return 0;
+  return BMP_OK;
+}
+
+
+/**************************************************************
+	Writes the buffers in order to a file handle opened with
+	O_DIRECT, which must be at offset 0.  They are staged through
+	an aligned buffer, the last block padded out and the file
+	then truncated back to its true length.  Should the file
+	system reject direct I/O (EINVAL) despite taking the flag,
+	O_DIRECT is cleared and the rest written buffered.
+	Returns BMP_OK on success.
+**************************************************************/
+int WriteDirect(int fh, struct iovec *iov, int n) {
+  UCHAR *stage;
+  size_t fill, take, len, total;
+  ssize_t put;
+  int e, flags;
+  struct iovec rest;
+
+  if (posix_memalign((void **) &stage, BMP_DIRECT_ALIGN, BMP_DIRECT_CHUNK)
+      != 0) {
+    return BMP_OUT_OF_MEMORY;
+  }
+
+  e = BMP_OK;
+  fill = 0;
+  total = 0;
+  while (e == BMP_OK && (n > 0 || fill > 0)) {
+
+    /* Fill the stage, or take whatever is left */
+    while (n > 0 && fill < BMP_DIRECT_CHUNK) {
+      take = BMP_DIRECT_CHUNK - fill < iov->iov_len ?
+        BMP_DIRECT_CHUNK - fill : iov->iov_len;
+      memcpy(stage + fill, iov->iov_base, take);
+      fill += take;
+      iov->iov_base = (UCHAR *) iov->iov_base + take;
+      if ((iov->iov_len -= take) == 0) {
+        iov++;
+        n--;
+      }
+    }
+
+    /* O_DIRECT only takes whole blocks */
+    len = (fill + BMP_DIRECT_ALIGN - 1) & ~((size_t) BMP_DIRECT_ALIGN - 1);
+    memset(stage + fill, 0, len - fill);
+    __atomic_add_fetch(&BMP_WRITE_CALLS, 1, __ATOMIC_RELAXED);
+    put = write(fh, stage, len);
+    if (put < 0 && errno == EINTR) continue;
+    if (put < 0 && errno == EINVAL && (flags = fcntl(fh, F_GETFL)) >= 0 &&
+        fcntl(fh, F_SETFL, flags & ~O_DIRECT) == 0) {
+      /* Only unpadded blocks went out before, so carry on from here */
+      rest.iov_base = stage;
+      rest.iov_len = fill;
+      e = WriteFully(fh, &rest, 1);
+      if (e == BMP_OK) e = WriteFully(fh, iov, n);
+      free(stage);
+      return e;
+    }
+    if (put != (ssize_t) len) {
+      e = BMP_IO_ERROR;
+      break;
+    }
+    total += fill;
+    fill = 0;
   }
 
-  *x = (little[1] << 8 | little[0]);
+  if (e == BMP_OK) {
+    __atomic_add_fetch(&BMP_WRITE_CALLS, 1, __ATOMIC_RELAXED);
+    if (ftruncate(fh, total) != 0) e = BMP_IO_ERROR;
+  }
+  free(stage);
 
-  return 1;
+  return e;
 }
 
 
 /**************************************************************
-	Writes a little-endian unsigned int to the file.
-	Returns non-zero on success.
+	Decodes a little-endian unsigned int from a buffer.
 **************************************************************/
-int WriteUINT(UINT x, int fh) {
-  UCHAR little[4];  /* BMPs use 32 bit ints */
+UINT GetUINT(const UCHAR *little) {
+  return ((UINT) little[3] << 24 | little[2] << 16 | little[1] << 8 |
+    little[0]);
+}
+
+
+/**************************************************************
+	Decodes a little-endian unsigned short int from a buffer.
+**************************************************************/
+USHORT GetUSHORT(const UCHAR *little) {
+  return (little[1] << 8 | little[0]);
+}
+
 
+/**************************************************************
+	Encodes a little-endian unsigned int into a buffer.
+**************************************************************/
+void PutUINT(UINT x, UCHAR *little) {
   little[3] = (UCHAR) ((x & 0xff000000) >> 24);
   little[2] = (UCHAR) ((x & 0x00ff0000) >> 16);
   little[1] = (UCHAR) ((x & 0x0000ff00) >> 8);
   little[0] = (UCHAR) ((x & 0x000000ff) >> 0);
-
-  return (fh && write(fh, little, 4) == 4);
 }
 
 
 /**************************************************************
-	Writes a little-endian unsigned short int to the file.
-	Returns non-zero on success.
+	Encodes a little-endian unsigned short int into a buffer.
 **************************************************************/
-int WriteUSHORT(USHORT x, int fh) {
-  UCHAR little[2];  /* BMPs use 16 bit shorts */
-
+void PutUSHORT(USHORT x, UCHAR *little) {
   little[1] = (UCHAR) ((x & 0xff00) >> 8);
   little[0] = (UCHAR) ((x & 0x00ff) >> 0);
-
-  return (fh && write(fh, little, 2) == 2);
 }
@@ -84,6 +84,10 @@ typedef enum
 typedef struct _BMP BMP;
 
 
+/* Alignment of each row of pixels in memory (bytes) */
+#define BMP_ROW_ALIGN	64
+
+
 
 
 /*********************************** Public methods **********************************/
@@ -93,11 +97,17 @@ typedef struct _BMP BMP;
 BMP*			BMP_Create					( UINT width, UINT height, USHORT depth );
 BMP*			BMP_Create2					( UINT width, UINT height, USHORT depth, UCHAR *data );
 void			BMP_Free					( BMP* bmp );
+void			BMP_DrainPool				();
 
 
 /* I/O */
 BMP*			BMP_ReadFile				( const char* filename );
+BMP*			BMP_ReadStream				( int fh );
 void			BMP_WriteFile				( BMP* bmp, int fh );
+void			BMP_WriteFileData			( BMP* bmp, const UCHAR* data, int fh );
+void			BMP_WriteHeader				( BMP* bmp, int fh );
+int				BMP_WriteRows				( BMP* bmp, UINT first, UINT count, int fh );
+UINT			BMP_GetWriteCalls			();
 
 
 /* Meta info */
@@ -105,6 +115,10 @@ UINT			BMP_GetWidth				( BMP* bmp );
 UINT			BMP_GetHeight				( BMP* bmp );
 USHORT		BMP_GetDepth				( BMP* bmp );
 UINT   		BMP_GetDataSize			( BMP *bmp );
+UINT   		BMP_GetAllocSize			( BMP *bmp );
+UINT   		BMP_GetStride				( BMP *bmp );
+UINT   		BMP_RowStride				( UINT width, USHORT depth );
+UINT   		BMP_GetDataOffset			( BMP *bmp );
 UCHAR			*BMP_GetData				( BMP *bmp );
 void	 		BMP_SetData				( BMP *bmp, UCHAR *data );
 
@@ -0,0 +1,176 @@
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "batch.h"
+#include "const.h"
+#include "init.h"
+#include "master.h"
+#include "mpi.h"
+#include "serve.h"
+
+/* open_socket
+ * ------
+ * Create a listening Unix domain socket, replacing any stale socket file.
+ * Anything else at the path is left alone, as outputs never overwrite.
+ *
+ * path:    socket path
+ *
+ * returns: socket handle, or -1 on failure
+ *
+ */
+static int open_socket(char *path) {
+
+  struct sockaddr_un addr;
+  struct stat st;
+  int fd;
+
+  memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  if (strlen(path) >= sizeof(addr.sun_path)) {
+    fprintf(stderr, EM_SERVE_PATH, (int) sizeof(addr.sun_path) - 1);
+    return -1;
+  }
+  strcpy(addr.sun_path, path);
+
+  if (lstat(path, &st) == 0) {
+    if (!S_ISSOCK(st.st_mode)) {
+      fprintf(stderr, EM_SERVE_EXISTS, path);
+      return -1;
+    }
+    unlink(path);
+  }
+
+  if ((fd = socket(AF_UNIX, SOCK_STREAM, 0)) < 0) {
+    fprintf(stderr, EM_SERVE_SOCKET, strerror(errno));
+    return -1;
+  }
+  if (bind(fd, (struct sockaddr *) &addr, sizeof(addr)) < 0 ||
+      listen(fd, SERVE_BACKLOG) < 0) {
+    fprintf(stderr, EM_SERVE_SOCKET, strerror(errno));
+    close(fd);
+    return -1;
+  }
+
+  return fd;
+
+}
+
+/* reply
+ * ------
+ * Send a status line to a client, ignoring clients that have gone away
+ *
+ * fd:      client handle
+ * ok:      whether the job succeeded
+ * seconds: time taken by the job
+ *
+ */
+static void reply(int fd, int ok, double seconds) {
+
+  char line[64];
+  int len;
+
+  len = snprintf(line, sizeof(line), "%s %.6f\n", ok ? "ok" : "error",
+    seconds);
+  send(fd, line, len, MSG_NOSIGNAL);
+
+}
+
+/* serve_client
+ * ------
+ * Run every job a client sends until it disconnects or asks to quit
+ *
+ * fd:      client handle (closed on return)
+ * nslave:  number of slaves
+ * opts:    job configuration
+ *
+ * returns: non zero if the client asked the service to quit
+ *
+ */
+static int serve_client(int fd, int nslave, JOB_OPTS *opts) {
+
+  FILE *in;
+  char line[BATCH_LINE_LEN];
+  struct batch_job job;
+  struct batch_stats stats;
+  double start;
+  int quit, e;
+
+  if ((in = fdopen(fd, "r")) == NULL) {
+    close(fd);
+    return 0;
+  }
+
+  quit = 0;
+  while (!quit && fgets(line, sizeof(line), in) != NULL) {
+    if (strncmp(line, "quit", 4) == 0 && strspn(line + 4, " \t\r\n") ==
+        strlen(line + 4)) {
+      reply(fd, 1, 0);
+      quit = 1;
+      continue;
+    }
+
+    start = MPI_Wtime();
+    if (parse_job(line, opts, &job) != EXIT_SUCCESS) {
+      reply(fd, 0, 0);
+      continue;
+    }
+    if (job.fn_in[0] == '\0') continue;
+
+#ifdef TRACE
+    fprintf(stderr, "serving %s -> %s\n", job.fn_in, job.fn_out);
+#endif
+    memset(&stats, 0, sizeof(stats));
+    e = run_batch(nslave, &job, 1, opts, &stats);
+    reply(fd, e == EXIT_SUCCESS, MPI_Wtime() - start);
+  }
+
+  fclose(in);
+
+  return quit;
+
+}
+
+/* do_serve
+ * ------
+ * Main entry point for the master node in service mode.  Slaves are only
+ * released once a client asks the service to quit.
+ *
+ * nslave:      number of slaves
+ * opts:        job configuration
+ *
+ * return: success or failure
+ *
+ */
+int do_serve(int nslave, JOB_OPTS *opts) {
+
+  int fd, client, quit;
+
+  if ((fd = open_socket(opts->fn_socket)) < 0) {
+    MPI_Abort(MPI_COMM_WORLD, MPI_ABORT_FAIL_CODE);
+    return EXIT_FAILURE;
+  }
+  fprintf(stderr, "serving on %s with %d slaves\n", opts->fn_socket, nslave);
+
+  quit = 0;
+  while (!quit) {
+    if ((client = accept(fd, NULL, NULL)) < 0) {
+      if (errno == EINTR) continue;
+      fprintf(stderr, EM_SERVE_SOCKET, strerror(errno));
+      break;
+    }
+    quit = serve_client(client, nslave, opts);
+  }
+
+  close(fd);
+  unlink(opts->fn_socket);
+  release_slaves(1, nslave);
+
+  return quit ? EXIT_SUCCESS : EXIT_FAILURE;
+
+}
@@ -0,0 +1,34 @@
+#ifndef _SERVE_H_
+#define _SERVE_H_
+
+/*
+ * serve.h
+ * -------
+ * Keeps the MPI job alive as a blur service.  The master accepts clients on
+ * a local Unix domain socket, one at a time.  A client sends one job per
+ * line, in the same form as a batch manifest line:
+ *
+ *   <input> <output> <stdev> [auto|whole|tiled]
+ *
+ * and receives one line per job once the output is written:
+ *
+ *   ok <seconds>         or         error <seconds>
+ *
+ * The line "quit" shuts the service down.  Slaves keep their kernels and
+ * buffers between jobs, so a job costs only the blur itself.
+ *
+ */
+
+#include "init.h"
+
+/* Constants */
+#define SERVE_BACKLOG     8       /* Clients queued while serving another */
+
+/* Error messages */
+#define EM_SERVE_SOCKET   "Failed to open service socket: %s\n"
+#define EM_SERVE_PATH     "Service socket path exceeds %d characters\n"
+#define EM_SERVE_EXISTS   "%s exists and is not a socket\n"
+
+int do_serve(int nslave, JOB_OPTS *opts);
+
+#endif /* _SERVE_H_ */
@@ -1,65 +1,280 @@
+#include "codec.h"
 #include "const.h"
+#include "counters.h"
 #include "gaussianLib.h"
+#include "init.h"
 #include "kern.h"
+#include "master.h"
 #include "mpi.h"
+#include "progress.h"
 #include "qdbmp.h"
+#include "slave.h"
+#include "timing.h"
+#include "tune.h"
 
-int do_slave(int me, int kern_size, int stdev, int kern_orig) {
+/* Kernels generated so far, indexed by standard deviation */
+static KERNEL *kern_cache[MAX_STDEV + 1];
 
-  float **kern_data, kernel_max, colour_max;
-  UINT size, width, height;
-  USHORT depth;
-  UCHAR *data;
-  BMP *bmp, *new_bmp;
-  MPI_Status status;
+/* get_kern
+ * ------
+ * Look up the kernel for a standard deviation, generating it on first use
+ *
+ * stdev:   standard deviation of the blur
+ *
+ * return: cached kernel, or NULL on failure
+ *
+ */
+static KERNEL *get_kern(int stdev) {
 
-  /* TODO: Non blocking would be better */
-  /* Receive payload for processing configuration */
-  MPI_Recv(&size, 1, MPI_UNSIGNED_LONG, MPI_MASTER_NODE, MPI_SIZE_TAG,
-    MPI_COMM_WORLD, &status);
-  MPI_Recv(&width, 1, MPI_UNSIGNED_LONG, MPI_MASTER_NODE, MPI_WIDTH_TAG,
-    MPI_COMM_WORLD, &status);
-  MPI_Recv(&height, 1, MPI_UNSIGNED_LONG, MPI_MASTER_NODE, MPI_HEIGHT_TAG,
-    MPI_COMM_WORLD, &status);
-  MPI_Recv(&depth, 1, MPI_UNSIGNED_SHORT, MPI_MASTER_NODE, MPI_DEPTH_TAG,
-    MPI_COMM_WORLD, &status);
-  data = calloc(size, sizeof(UCHAR));
-  MPI_Recv(data, size, MPI_UNSIGNED_CHAR, MPI_MASTER_NODE, MPI_DATA_TAG,
-    MPI_COMM_WORLD, &status);
-
-  /* Configure the kernel for gaussian distribution */
-  kern_data = init_kern_data(kern_size);
-  if (kern_data == NULL) {
-    MPI_Abort(MPI_COMM_WORLD, MPI_ABORT_FAIL_CODE);
-    return EXIT_FAILURE;
+  if (stdev < MIN_STDEV || stdev > MAX_STDEV) {
+    fprintf(stderr, EM_STDEV_RANGE, MIN_STDEV, MAX_STDEV);
+    return NULL;
   }
-  generateGaussianKernel(kern_data, kern_size, stdev, kern_orig, &kernel_max,
-    &colour_max);
 
-  /* Create a set of BMPs for reading/writing the augmentation */
-  bmp = BMP_Create(width, height, depth);
-  if (BMP_CheckError(stderr) != BMP_OK) {
-    MPI_Abort(MPI_COMM_WORLD, MPI_ABORT_FAIL_CODE);
-    return EXIT_FAILURE;
+  if (kern_cache[stdev] == NULL) kern_cache[stdev] = create_kernel(stdev);
+
+  return kern_cache[stdev];
+
+}
+
+/* reuse_bmp
+ * ------
+ * Reuse a bitmap for a tile of the given shape, recreating it only if the
+ * shape differs from the previous tile
+ *
+ * bmp:     bitmap to reuse (NULL on first use, updated)
+ * width:   width of the tile (pixels)
+ * height:  height of the tile (pixels)
+ * depth:   depth of the tile (bits)
+ *
+ * return: success or failure
+ *
+ */
+static int reuse_bmp(BMP **bmp, UINT width, UINT height, USHORT depth) {
+
+  if (*bmp != NULL && BMP_GetWidth(*bmp) == width &&
+      BMP_GetHeight(*bmp) == height && BMP_GetDepth(*bmp) == depth) {
+    return EXIT_SUCCESS;
   }
-  BMP_SetData(bmp, data);
-  new_bmp = BMP_Create(width, height, depth);
+  if (*bmp != NULL) BMP_Free(*bmp);
+
+  *bmp = BMP_Create(width, height, depth);
   if (BMP_CheckError(stderr) != BMP_OK) {
-    MPI_Abort(MPI_COMM_WORLD, MPI_ABORT_FAIL_CODE);
+    *bmp = NULL;
     return EXIT_FAILURE;
   }
 
-  /* Process the data */
-  applyConvolution(kern_data, kern_size, kern_orig, colour_max, bmp, new_bmp);
-  data = BMP_GetData(new_bmp);
+  return EXIT_SUCCESS;
+
+}
+
+/* convolve_tile
+ * ------
+ * Blur a tile a chunk of rows at a time, sending the master a heartbeat
+ * when the tile has arrived and after every chunk.  The first chunk is
+ * PROGRESS_FIRST_ROWS, so the master has a rate early on; later chunks are
+ * sized from the rate so far to take about PROGRESS_BEAT_S.
+ *
+ * engine:  convolution engine
+ * kern:    kernel (of the coarsest level, given a pyramid)
+ * levels:  levels of pyramid to blur through (0 for none)
+ * edge:    edge mode
+ * bmp:     tile to blur
+ * new_bmp: blurred tile (out)
+ * tile:    number of the tile on this slave, from 1
+ *
+ * return: success or failure
+ *
+ */
+static int convolve_tile(int engine, KERNEL *kern, int levels, int edge,
+  BMP *bmp, BMP *new_bmp, UINT tile) {
+
+  int width, height, stride, channels, min_rows, rows, y, y1;
+  double start, rate;
+
+  width = BMP_GetWidth(bmp);
+  height = BMP_GetHeight(bmp);
+  channels = BMP_GetDepth(bmp) >> 3;
+  stride = BMP_GetStride(bmp);
+  min_rows = engine != ENGINE_DIRECT ? PROGRESS_HALO_ROWS * kern->size : 1;
+  if (levels > 0) {
+    min_rows = PROGRESS_HALO_ROWS *
+      (2 * pyramidHalo(levels, kern->stdev) + 1);
+  }
+
+  rows = PROGRESS_FIRST_ROWS < height ? PROGRESS_FIRST_ROWS : height;
+  progress_beat(tile, 0, rows);
+  start = MPI_Wtime();
+  for (y = 0; y < height; y = y1) {
+    y1 = y + rows;
+    if (pyramidRows(engine, kern, levels, edge, BMP_GetData(bmp), stride,
+          BMP_GetData(new_bmp), stride, width, height, channels, y, y1)
+        != EXIT_SUCCESS) {
+      return EXIT_FAILURE;
+    }
+
+    /* Size the next chunk from the rate so far */
+    rate = y1 / (MPI_Wtime() - start);
+    rows = rate * PROGRESS_BEAT_S < height ? rate * PROGRESS_BEAT_S : height;
+    if (rows < min_rows) rows = min_rows;
+    if (rows > height - y1) rows = height - y1;
+    progress_beat(tile, y1, rows);
+  }
+
+  return EXIT_SUCCESS;
+
+}
+
+/* do_slave
+ * ------
+ * Main entry point for slave nodes: receive tiles, blur them and send them
+ * back until the master sends an empty tile.  Kernels and bitmaps are kept
+ * between tiles, so a run of similar tiles allocates nothing.
+ *
+ * me:          current rank
+ * opts:        job configuration
+ *
+ * return: success or failure
+ *
+ */
+int do_slave(int me, JOB_OPTS *opts) {
+
+  KERNEL *kern;
+  UINT size, width, height, enc_size, wire_size;
+  USHORT depth;
+  UCHAR *data, *wire;
+  BMP *bmp, *new_bmp;
+  MPI_Status status;
+  MPI_Datatype type;
+  int count, stdev, edge, ntile, levels, coarse;
+  double t, c[COUNTER_COUNT];
+
+  bmp = NULL;
+  new_bmp = NULL;
+  wire = NULL;
+  wire_size = 0;
+  ntile = 0;
 
-  /* Send the processed data */
   /* TODO: Non blocking would be better */
-  MPI_Send(data, size, MPI_UNSIGNED_CHAR, MPI_MASTER_NODE, MPI_DATA_TAG,
-    MPI_COMM_WORLD);
+  while (1) {
+
+    /* Receive payload for processing configuration (the wait for the
+     * master counts as receiving) */
+    TIMING_START(t);
+    MPI_Recv(&size, 1, MPI_UNSIGNED_LONG, MPI_MASTER_NODE, MPI_SIZE_TAG,
+      MPI_COMM_WORLD, &status);
+
+    /* An empty tile means there is no more work for this node */
+    if (size == 0) break;
 
-  if (new_bmp != NULL)
-    BMP_Free(new_bmp);  /* NOTE: 'data' will be freed from within new_bmp */
+    MPI_Recv(&width, 1, MPI_UNSIGNED_LONG, MPI_MASTER_NODE, MPI_WIDTH_TAG,
+      MPI_COMM_WORLD, &status);
+    MPI_Recv(&height, 1, MPI_UNSIGNED_LONG, MPI_MASTER_NODE, MPI_HEIGHT_TAG,
+      MPI_COMM_WORLD, &status);
+    MPI_Recv(&depth, 1, MPI_UNSIGNED_SHORT, MPI_MASTER_NODE, MPI_DEPTH_TAG,
+      MPI_COMM_WORLD, &status);
+    MPI_Recv(&stdev, 1, MPI_INT, MPI_MASTER_NODE, MPI_STDEV_TAG,
+      MPI_COMM_WORLD, &status);
+    MPI_Recv(&edge, 1, MPI_INT, MPI_MASTER_NODE, MPI_EDGE_TAG,
+      MPI_COMM_WORLD, &status);
+
+    if (reuse_bmp(&bmp, width, height, depth) != EXIT_SUCCESS ||
+        reuse_bmp(&new_bmp, width, height, depth) != EXIT_SUCCESS) {
+      MPI_Abort(MPI_COMM_WORLD, MPI_ABORT_FAIL_CODE);
+      return EXIT_FAILURE;
+    }
+
+    /* The wire buffer only ever grows */
+    if (opts->codec != CODEC_NONE && wire_size < codec_bound(size)) {
+      free(wire);
+      wire_size = codec_bound(size);
+      wire = malloc(wire_size);
+      if (wire == NULL) {
+        fprintf(stderr, EM_OUT_OF_MEMORY, OOM_TYPE_WIRE_BUFFER);
+        MPI_Abort(MPI_COMM_WORLD, MPI_ABORT_FAIL_CODE);
+        return EXIT_FAILURE;
+      }
+    }
+
+    data = BMP_GetData(bmp);
+    if (opts->codec == CODEC_NONE) {
+      type = tile_type(size, width, height, depth);
+      MPI_Recv(data, 1, type, MPI_MASTER_NODE, MPI_DATA_TAG, MPI_COMM_WORLD,
+        &status);
+      MPI_Type_free(&type);
+      TIMING_STOP(PHASE_RECV, t, size);
+    } else {
+      MPI_Recv(wire, wire_size, MPI_UNSIGNED_CHAR, MPI_MASTER_NODE,
+        MPI_DATA_TAG, MPI_COMM_WORLD, &status);
+      MPI_Get_count(&status, MPI_UNSIGNED_CHAR, &count);
+      TIMING_STOP(PHASE_RECV, t, count);
+      if (codec_decode(wire, count, width, height, depth, data)
+          != EXIT_SUCCESS) {
+        MPI_Abort(MPI_COMM_WORLD, MPI_ABORT_FAIL_CODE);
+        return EXIT_FAILURE;
+      }
+    }
+
+    /* Configure the kernel for gaussian distribution, at the coarsest
+     * level of a pyramid */
+    levels = 0;
+    coarse = stdev;
+    if (opts->pyramid > 0 &&
+        planPyramid(stdev, opts->pyramid, &levels, &coarse) != EXIT_SUCCESS) {
+      MPI_Abort(MPI_COMM_WORLD, MPI_ABORT_FAIL_CODE);
+      return EXIT_FAILURE;
+    }
+    if ((kern = get_kern(coarse)) == NULL) {
+      MPI_Abort(MPI_COMM_WORLD, MPI_ABORT_FAIL_CODE);
+      return EXIT_FAILURE;
+    }
+
+    /* Process the data */
+    TIMING_START(t);
+    COUNTERS_START(c);
+    if (convolve_tile(tune_engine(opts, (width * height) >> (2 * levels),
+          coarse), kern, levels, edge, bmp, new_bmp, ntile + 1)
+        != EXIT_SUCCESS) {
+      MPI_Abort(MPI_COMM_WORLD, MPI_ABORT_FAIL_CODE);
+      return EXIT_FAILURE;
+    }
+    COUNTERS_STOP(PHASE_CONVOLVE, c, (double) width * height, size);
+    TIMING_STOP(PHASE_CONVOLVE, t, size);
+    data = BMP_GetData(new_bmp);
+
+    /* Send the processed data */
+    /* TODO: Non blocking would be better */
+    TIMING_START(t);
+    if (opts->codec == CODEC_NONE) {
+      type = tile_type(size, width, height, depth);
+      MPI_Send(data, 1, type, MPI_MASTER_NODE, MPI_DATA_TAG, MPI_COMM_WORLD);
+      MPI_Type_free(&type);
+      TIMING_STOP(PHASE_SEND, t, size);
+    } else {
+      if ((enc_size = codec_encode(data, width, height, depth, wire)) == 0) {
+        MPI_Abort(MPI_COMM_WORLD, MPI_ABORT_FAIL_CODE);
+        return EXIT_FAILURE;
+      }
+      MPI_Send(wire, enc_size, MPI_UNSIGNED_CHAR, MPI_MASTER_NODE,
+        MPI_DATA_TAG, MPI_COMM_WORLD);
+      TIMING_STOP(PHASE_SEND, t, enc_size);
+    }
+
+    ++ntile;
+  }
+
+#ifdef TRACE
+  fprintf(stderr, "rank id %d released after %d tiles\n", me, ntile);
+#endif
+
+  if (bmp != NULL) BMP_Free(bmp);
+  if (new_bmp != NULL) BMP_Free(new_bmp);
+  BMP_DrainPool();
+  free(wire);
+  for (stdev = MIN_STDEV; stdev <= MAX_STDEV; stdev++) {
+    free_kernel(kern_cache[stdev]);
+    kern_cache[stdev] = NULL;
+  }
 
   return EXIT_SUCCESS;
 
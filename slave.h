@@ -1,6 +1,8 @@
 #ifndef _SLAVE_H_
 #define _SLAVE_H_
 
-int do_slave(int me, int kern_size, int stdev, int kern_orig);
+#include "init.h"
+
+int do_slave(int me, JOB_OPTS *opts);
 
 #endif /* _SLAVE_H_ */
@@ -0,0 +1,287 @@
+#include <errno.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "const.h"
+#include "timeline.h"
+#include "timing.h"
+#ifndef GAUSSIAN_LOCAL
+#include "mpi.h"
+#endif
+
+/* A phase of one thread, or an instant if end is negative */
+struct timeline_event {
+  double start, end;
+  double arg;                 /* Bytes moved, or the peer of an instant */
+  int phase;
+  int lane;                   /* Thread that recorded it, in order seen */
+};
+
+int timeline_on = 0;
+
+static struct timeline_event *events;
+static int nevent, max_event;
+static int next_lane;
+static __thread int lane = -1;
+static pthread_mutex_t events_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* push_event
+ * ------
+ * Append an event, growing the buffer if needed.  Events that do not fit
+ * are dropped, as the timeline is only a diagnostic.
+ *
+ * ev:      event (lane is filled in)
+ *
+ */
+static void push_event(struct timeline_event *ev) {
+
+  struct timeline_event *grown;
+
+  if (lane < 0) lane = __atomic_fetch_add(&next_lane, 1, __ATOMIC_RELAXED);
+  ev->lane = lane;
+
+  pthread_mutex_lock(&events_lock);
+  if (nevent == max_event) {
+    grown = realloc(events, (max_event + TIMELINE_GROW) * sizeof(*events));
+    if (grown == NULL) {
+      pthread_mutex_unlock(&events_lock);
+      return;
+    }
+    events = grown;
+    max_event += TIMELINE_GROW;
+  }
+  events[nevent++] = *ev;
+  pthread_mutex_unlock(&events_lock);
+
+}
+
+/* timeline_add
+ * ------
+ * Record a phase of the calling thread
+ *
+ * phase:   phase (see PHASE_READ)
+ * start:   timing_now when the phase began
+ * end:     timing_now when it ended
+ * bytes:   bytes moved during the phase
+ *
+ */
+void timeline_add(int phase, double start, double end, double bytes) {
+
+  struct timeline_event ev;
+
+  ev.start = start;
+  ev.end = end;
+  ev.arg = bytes;
+  ev.phase = phase;
+  push_event(&ev);
+
+}
+
+/* timeline_mark
+ * ------
+ * Record an instant, such as the completion of a receive
+ *
+ * phase:   phase the instant belongs to
+ * peer:    rank the instant concerns
+ *
+ */
+void timeline_mark(int phase, int peer) {
+
+  struct timeline_event ev;
+
+  ev.start = timing_now();
+  ev.end = -1;
+  ev.arg = peer;
+  ev.phase = phase;
+  push_event(&ev);
+
+}
+
+#ifndef GAUSSIAN_LOCAL
+/* clock_offset
+ * ------
+ * Estimate how far the clock of a slave (timing_now, which stamps the
+ * events) is ahead of the master's, from the round trip with the least
+ * delay.  Called by the master and by that slave, from their main threads,
+ * which alone make MPI calls.
+ *
+ * me:      current rank
+ * peer:    slave to align
+ *
+ * returns: offset to subtract from the slave's times (master only)
+ *
+ */
+static double clock_offset(int me, int peer) {
+
+  double t0, t1, remote, best_rtt, offset;
+  int i;
+
+  offset = 0;
+  best_rtt = -1;
+  for (i = 0; i < TIMELINE_PINGS; i++) {
+    if (me == MPI_MASTER_NODE) {
+      t0 = timing_now();
+      MPI_Send(&t0, 1, MPI_DOUBLE, peer, MPI_CLOCK_TAG, MPI_COMM_WORLD);
+      MPI_Recv(&remote, 1, MPI_DOUBLE, peer, MPI_CLOCK_TAG, MPI_COMM_WORLD,
+        MPI_STATUS_IGNORE);
+      t1 = timing_now();
+      if (best_rtt < 0 || t1 - t0 < best_rtt) {
+        best_rtt = t1 - t0;
+        offset = remote - (t0 + t1) / 2;
+      }
+    } else {
+      MPI_Recv(&t0, 1, MPI_DOUBLE, MPI_MASTER_NODE, MPI_CLOCK_TAG,
+        MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+      remote = timing_now();
+      MPI_Send(&remote, 1, MPI_DOUBLE, MPI_MASTER_NODE, MPI_CLOCK_TAG,
+        MPI_COMM_WORLD);
+    }
+  }
+
+  return offset;
+
+}
+#endif
+
+/* write_events
+ * ------
+ * Write the events of all ranks as Chrome trace event JSON, in microseconds
+ * from the earliest event
+ *
+ * fn_timeline: file to write
+ * all:         events of every rank, in rank order
+ * counts:      number of events of each rank
+ * offsets:     clock offset of each rank from the master
+ * nproc:       number of ranks
+ *
+ * returns: success or failure
+ *
+ */
+static int write_events(char *fn_timeline, struct timeline_event *all,
+  int *counts, double *offsets, int nproc) {
+
+  FILE *f;
+  struct timeline_event *ev;
+  double origin;
+  int rank, i, first;
+
+  if ((f = fopen(fn_timeline, "w")) == NULL) {
+    fprintf(stderr, EM_TIMELINE_WRITE, strerror(errno));
+    return EXIT_FAILURE;
+  }
+
+  origin = 0;
+  for (first = 1, ev = all, rank = 0; rank < nproc; rank++) {
+    for (i = 0; i < counts[rank]; i++, ev++) {
+      if (first || ev->start - offsets[rank] < origin) {
+        origin = ev->start - offsets[rank];
+        first = 0;
+      }
+    }
+  }
+
+  fprintf(f, "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n");
+  for (rank = 0; rank < nproc; rank++) {
+    fprintf(f, "  {\"name\": \"process_name\", \"ph\": \"M\", \"pid\": %d, "
+      "\"args\": {\"name\": \"%s %d\"}},\n", rank,
+      rank == MPI_MASTER_NODE ? "master" : "slave", rank);
+  }
+  for (ev = all, rank = 0; rank < nproc; rank++) {
+    for (i = 0; i < counts[rank]; i++, ev++) {
+      if (ev->end < 0) {
+        fprintf(f, "  {\"name\": \"%s\", \"ph\": \"i\", \"s\": \"t\", "
+          "\"pid\": %d, \"tid\": %d, \"ts\": %.3f, "
+          "\"args\": {\"peer\": %.0f}},\n", timing_name(ev->phase), rank,
+          ev->lane, (ev->start - offsets[rank] - origin) * 1e6, ev->arg);
+      } else {
+        fprintf(f, "  {\"name\": \"%s\", \"ph\": \"X\", \"pid\": %d, "
+          "\"tid\": %d, \"ts\": %.3f, \"dur\": %.3f, "
+          "\"args\": {\"bytes\": %.0f}},\n", timing_name(ev->phase), rank,
+          ev->lane, (ev->start - offsets[rank] - origin) * 1e6,
+          (ev->end - ev->start) * 1e6, ev->arg);
+      }
+    }
+  }
+  /* Chrome accepts no trailing comma, so finish on an empty metadata
+   * event */
+  fprintf(f, "  {\"name\": \"trace_end\", \"ph\": \"M\", \"pid\": 0}\n]}\n");
+
+  if (fclose(f) != 0) {
+    fprintf(stderr, EM_TIMELINE_WRITE, strerror(errno));
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+
+}
+
+/* timeline_write
+ * ------
+ * Align the clocks of every rank, gather their events on the master and
+ * write the timeline.  Must be called by all ranks if a timeline is on.
+ *
+ * me:          current rank
+ * nproc:       number of ranks
+ * fn_timeline: timeline file name
+ *
+ * returns: success or failure (on the master)
+ *
+ */
+int timeline_write(int me, int nproc, char *fn_timeline) {
+
+  struct timeline_event *all;
+  double offsets[nproc];
+  int counts[nproc], e;
+#ifndef GAUSSIAN_LOCAL
+  int displs[nproc], size, i;
+#endif
+
+  if (!timeline_on) return EXIT_SUCCESS;
+
+  offsets[0] = 0;
+  counts[0] = nevent;
+  all = events;
+
+#ifndef GAUSSIAN_LOCAL
+  for (i = 1; i < nproc; i++) {
+    if (me == MPI_MASTER_NODE) {
+      offsets[i] = clock_offset(me, i);
+    } else if (me == i) {
+      clock_offset(me, MPI_MASTER_NODE);
+    }
+  }
+
+  /* Events travel as bytes, as every rank runs the same binary */
+  size = nevent * sizeof(*events);
+  MPI_Gather(&size, 1, MPI_INT, counts, 1, MPI_INT, MPI_MASTER_NODE,
+    MPI_COMM_WORLD);
+  all = NULL;
+  if (me == MPI_MASTER_NODE) {
+    for (displs[0] = 0, i = 1; i < nproc; i++) {
+      displs[i] = displs[i - 1] + counts[i - 1];
+    }
+    all = malloc(displs[nproc - 1] + counts[nproc - 1] + 1);
+    if (all == NULL) {
+      fprintf(stderr, EM_TIMELINE_OOM);
+      MPI_Abort(MPI_COMM_WORLD, MPI_ABORT_FAIL_CODE);
+      return EXIT_FAILURE;
+    }
+  }
+  MPI_Gatherv(events, size, MPI_BYTE, all, counts, displs, MPI_BYTE,
+    MPI_MASTER_NODE, MPI_COMM_WORLD);
+  for (i = 0; i < nproc; i++) counts[i] /= sizeof(*events);
+#endif
+
+  e = EXIT_SUCCESS;
+  if (me == MPI_MASTER_NODE) {
+    e = write_events(fn_timeline, all, counts, offsets, nproc);
+  }
+  if (all != events) free(all);
+  free(events);
+  events = NULL;
+  nevent = max_event = 0;
+
+  return e;
+
+}
@@ -0,0 +1,37 @@
+#ifndef _TIMELINE_H_
+#define _TIMELINE_H_
+
+/*
+ * timeline.h
+ * ----------
+ * Records every timed phase (see timing.h) as an event with its start and
+ * end, on every rank and thread, and at the end of a job merges them into
+ * a single Chrome trace event file that chrome://tracing or Perfetto can
+ * open.  Each rank is shown as a process and each of its threads as a
+ * track.  The clock of every rank is aligned to the master's by timing a
+ * few round trips before the events are gathered.
+ *
+ * Completions seen by MPI_Testany are recorded as instant events naming the
+ * slave whose result arrived.
+ *
+ */
+
+/* Constants */
+#define TIMELINE_GROW     4096  /* Events allocated at a time */
+#define TIMELINE_PINGS    8     /* Round trips timed per rank */
+
+/* Error messages */
+#define EM_TIMELINE_OOM   "Out of memory for timeline events\n"
+#define EM_TIMELINE_WRITE "Failed to write timeline: %s\n"
+
+/* Set when a timeline was asked for */
+extern int timeline_on;
+
+#define TIMELINE_MARK(phase, peer) \
+  do { if (timeline_on) timeline_mark((phase), (peer)); } while (0)
+
+void timeline_add(int phase, double start, double end, double bytes);
+void timeline_mark(int phase, int peer);
+int timeline_write(int me, int nproc, char *fn_timeline);
+
+#endif /* _TIMELINE_H_ */
@@ -0,0 +1,312 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/resource.h>
+#include "const.h"
+#include "counters.h"
+#include "timeline.h"
+#include "timing.h"
+#ifndef GAUSSIAN_LOCAL
+#include "mpi.h"
+#endif
+
+/* Fields gathered from each rank: seconds, bytes and calls per phase, the
+ * peak resident set, then the hardware counters of each phase */
+#define TIMING_RSS        (3 * PHASE_COUNT)
+#define TIMING_COUNTERS   (TIMING_RSS + 1)
+#define TIMING_FIELDS     (TIMING_COUNTERS + PHASE_COUNT * COUNTER_FIELDS)
+
+int timing_on = 0;
+
+static double timing_seconds[PHASE_COUNT];
+static double timing_bytes[PHASE_COUNT];
+static double timing_calls[PHASE_COUNT];
+
+static const char *phase_names[PHASE_COUNT] = {
+  "read", "tile", "send", "convolve", "recv", "remap", "write"
+};
+
+/* timing_now
+ * ------
+ * Current time, from the monotonic clock rather than MPI_Wtime: the remap
+ * and writer threads of the pipeline time their phases too, and with
+ * MPI_THREAD_FUNNELED only the main thread may call MPI.  The timeline
+ * aligns this clock across ranks (see clock_offset).
+ *
+ * returns: seconds since an arbitrary point
+ *
+ */
+double timing_now(void) {
+
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+
+}
+
+/* timing_add
+ * ------
+ * Charge the time since start, and the bytes moved, to a phase
+ *
+ * phase:   phase to charge (see PHASE_READ)
+ * start:   value of timing_now when the phase began
+ * bytes:   bytes read, written, sent or received during the phase
+ *
+ */
+void timing_add(int phase, double start, double bytes) {
+
+  double end;
+
+  end = timing_now();
+  timing_seconds[phase] += end - start;
+  timing_bytes[phase] += bytes;
+  timing_calls[phase] += 1;
+  if (timeline_on) timeline_add(phase, start, end, bytes);
+
+}
+
+/* timing_name
+ * ------
+ * Name of a phase, as used in reports
+ *
+ * phase:   phase (see PHASE_READ)
+ *
+ * returns: name
+ *
+ */
+const char *timing_name(int phase) {
+
+  return phase_names[phase];
+
+}
+
+/* cmp_double
+ * ------
+ * qsort comparison for doubles, ascending
+ *
+ */
+static int cmp_double(const void *a, const void *b) {
+
+  double x = *(const double *) a, y = *(const double *) b;
+
+  return (x > y) - (x < y);
+
+}
+
+/* summarise
+ * ------
+ * Min, median and max of a set of values, which are sorted in place
+ *
+ * v:       values
+ * n:       number of values (may be 0)
+ * stats:   min, median and max (out)
+ *
+ */
+static void summarise(double *v, int n, double *stats) {
+
+  if (n == 0) {
+    stats[0] = stats[1] = stats[2] = 0;
+    return;
+  }
+  qsort(v, n, sizeof(double), cmp_double);
+  stats[0] = v[0];
+  stats[1] = n % 2 ? v[n / 2] : (v[n / 2 - 1] + v[n / 2]) / 2;
+  stats[2] = v[n - 1];
+
+}
+
+/* write_counters
+ * ------
+ * Write the hardware counters of every rank and phase that counted any
+ * pixels, with the metrics derived from them.  Counters that could not be
+ * read are written as null (JSON) or left empty (CSV).
+ *
+ * f:       report
+ * csv:     write CSV rather than JSON
+ * all:     TIMING_FIELDS values per rank
+ * nproc:   number of ranks
+ *
+ */
+static void write_counters(FILE *f, int csv, double *all, int nproc) {
+
+  double *c, derived[4];
+  int rank, p, i, first;
+  static const char *derived_names[4] = {
+    "ipc", "bytes_per_cycle", "l1d_misses_per_pixel", "llc_misses_per_pixel"
+  };
+
+  if (csv) {
+    fprintf(f, "\nrank,phase");
+    for (i = 0; i < COUNTER_COUNT; i++) fprintf(f, ",%s", counters_name(i));
+    for (i = 0; i < 4; i++) fprintf(f, ",%s", derived_names[i]);
+    fprintf(f, "\n");
+  } else {
+    fprintf(f, "  \"counters\": [");
+  }
+
+  first = 1;
+  for (rank = 0; rank < nproc; rank++) {
+    for (p = 0; p < PHASE_COUNT; p++) {
+      c = all + rank * TIMING_FIELDS + TIMING_COUNTERS + p * COUNTER_FIELDS;
+      if (c[COUNTER_COUNT] == 0) continue;
+
+      /* Metrics of unavailable counters are unavailable too */
+      derived[0] = c[COUNTER_CYCLES] > 0 && c[COUNTER_INSTRUCTIONS] >= 0
+        ? c[COUNTER_INSTRUCTIONS] / c[COUNTER_CYCLES] : -1;
+      derived[1] = c[COUNTER_CYCLES] > 0
+        ? c[COUNTER_COUNT + 1] / c[COUNTER_CYCLES] : -1;
+      derived[2] = c[COUNTER_L1D_MISSES] >= 0
+        ? c[COUNTER_L1D_MISSES] / c[COUNTER_COUNT] : -1;
+      derived[3] = c[COUNTER_LLC_MISSES] >= 0
+        ? c[COUNTER_LLC_MISSES] / c[COUNTER_COUNT] : -1;
+
+      if (csv) {
+        fprintf(f, "%d,%s", rank, timing_name(p));
+        for (i = 0; i < COUNTER_COUNT; i++) {
+          if (c[i] < 0) fprintf(f, ",");
+          else fprintf(f, ",%.0f", c[i]);
+        }
+        for (i = 0; i < 4; i++) {
+          if (derived[i] < 0) fprintf(f, ",");
+          else fprintf(f, ",%.4f", derived[i]);
+        }
+        fprintf(f, "\n");
+        continue;
+      }
+
+      fprintf(f, "%s\n    { \"rank\": %d, \"phase\": \"%s\", "
+        "\"pixels\": %.0f", first ? "" : ",", rank, timing_name(p),
+        c[COUNTER_COUNT]);
+      for (i = 0; i < COUNTER_COUNT; i++) {
+        if (c[i] < 0) fprintf(f, ", \"%s\": null", counters_name(i));
+        else fprintf(f, ", \"%s\": %.0f", counters_name(i), c[i]);
+      }
+      for (i = 0; i < 4; i++) {
+        if (derived[i] < 0) fprintf(f, ", \"%s\": null", derived_names[i]);
+        else fprintf(f, ", \"%s\": %.4f", derived_names[i], derived[i]);
+      }
+      fprintf(f, " }");
+      first = 0;
+    }
+  }
+
+  if (!csv) fprintf(f, "\n  ]\n");
+
+}
+
+/* write_report
+ * ------
+ * Write the gathered timings of all ranks, as CSV if the file name ends in
+ * ".csv" and as JSON otherwise
+ *
+ * fn_report: report file name
+ * all:       TIMING_FIELDS values per rank
+ * nproc:     number of ranks
+ *
+ * returns: success or failure
+ *
+ */
+static int write_report(char *fn_report, double *all, int nproc) {
+
+  FILE *f;
+  double v[nproc], stats[3], bytes;
+  int csv, p, i, n, len;
+
+  if ((f = fopen(fn_report, "w")) == NULL) {
+    fprintf(stderr, EM_TIMING_REPORT, strerror(errno));
+    return EXIT_FAILURE;
+  }
+  len = strlen(fn_report);
+  csv = len > 4 && strcmp(fn_report + len - 4, ".csv") == 0;
+
+  if (csv) {
+    fprintf(f, "phase,ranks,min,median,max,bytes\n");
+  } else {
+    fprintf(f, "{\n  \"ranks\": %d,\n  \"phases\": [\n", nproc);
+  }
+
+  /* Only ranks that ran a phase count towards its spread */
+  for (p = 0; p < PHASE_COUNT; p++) {
+    bytes = 0;
+    for (n = 0, i = 0; i < nproc; i++) {
+      if (all[i * TIMING_FIELDS + 2 * PHASE_COUNT + p] == 0) continue;
+      v[n++] = all[i * TIMING_FIELDS + p];
+      bytes += all[i * TIMING_FIELDS + PHASE_COUNT + p];
+    }
+    summarise(v, n, stats);
+    if (csv) {
+      fprintf(f, "%s,%d,%.6f,%.6f,%.6f,%.0f\n", phase_names[p], n, stats[0],
+        stats[1], stats[2], bytes);
+    } else {
+      fprintf(f, "    { \"phase\": \"%s\", \"ranks\": %d, \"min\": %.6f, "
+        "\"median\": %.6f, \"max\": %.6f, \"bytes\": %.0f }%s\n",
+        phase_names[p], n, stats[0], stats[1], stats[2], bytes,
+        p < PHASE_COUNT - 1 ? "," : "");
+    }
+  }
+
+  /* Peak resident set, in kB */
+  for (i = 0; i < nproc; i++) v[i] = all[i * TIMING_FIELDS + TIMING_RSS];
+  if (csv) {
+    summarise(v, nproc, stats);
+    fprintf(f, "peak_rss_kb,%d,%.0f,%.0f,%.0f,\n", nproc, stats[0], stats[1],
+      stats[2]);
+  } else {
+    fprintf(f, "  ],\n  \"peak_rss_kb\": [");
+    for (i = 0; i < nproc; i++) {
+      fprintf(f, "%s%.0f", i ? ", " : " ", v[i]);
+    }
+    fprintf(f, " ]%s\n", counters_on ? "," : "");
+  }
+  if (counters_on) write_counters(f, csv, all, nproc);
+  if (!csv) fprintf(f, "}\n");
+
+  if (fclose(f) != 0) {
+    fprintf(stderr, EM_TIMING_REPORT, strerror(errno));
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+
+}
+
+/* timing_report
+ * ------
+ * Gather the timings of every rank on the master and write the report.
+ * Must be called by all ranks if a report was asked for.
+ *
+ * me:          current rank
+ * nproc:       number of ranks
+ * fn_report:   report file name
+ *
+ * returns: success or failure (on the master)
+ *
+ */
+int timing_report(int me, int nproc, char *fn_report) {
+
+  struct rusage usage;
+  double local[TIMING_FIELDS], all[nproc * TIMING_FIELDS];
+
+  if (fn_report[0] == '\0') return EXIT_SUCCESS;
+
+  memcpy(local, timing_seconds, sizeof(timing_seconds));
+  memcpy(local + PHASE_COUNT, timing_bytes, sizeof(timing_bytes));
+  memcpy(local + 2 * PHASE_COUNT, timing_calls, sizeof(timing_calls));
+  getrusage(RUSAGE_SELF, &usage);
+  local[TIMING_RSS] = usage.ru_maxrss;
+  counters_totals(local + TIMING_COUNTERS);
+
+#ifndef GAUSSIAN_LOCAL
+  MPI_Gather(local, TIMING_FIELDS, MPI_DOUBLE, all, TIMING_FIELDS,
+    MPI_DOUBLE, MPI_MASTER_NODE, MPI_COMM_WORLD);
+  if (me != MPI_MASTER_NODE) return EXIT_SUCCESS;
+#else
+  memcpy(all, local, sizeof(local));
+#endif
+
+  return write_report(fn_report, all, nproc);
+
+}
@@ -0,0 +1,52 @@
+#ifndef _TIMING_H_
+#define _TIMING_H_
+
+/*
+ * timing.h
+ * --------
+ * Per phase timers kept by every rank and gathered on the master at the end
+ * of a job into a JSON or CSV report: min, median and max seconds across
+ * the ranks that ran each phase, the bytes each phase moved and the peak
+ * resident set of every rank.  Phases may nest (receiving results includes
+ * remapping them unless -t is given).
+ *
+ * Each timed phase is also recorded as an event when a timeline was asked
+ * for (see timeline.h).
+ *
+ * Timing is off unless a report or timeline was asked for, in which case
+ * each of the macros below costs a test of timing_on.
+ *
+ * Example:
+ *   double t;
+ *   TIMING_START(t);
+ *   ...
+ *   TIMING_STOP(PHASE_WRITE, t, bytes);
+ *
+ */
+
+/* Phases */
+#define PHASE_READ        0     /* Loading the source image */
+#define PHASE_TILE        1     /* Dividing it into tiles */
+#define PHASE_SEND        2     /* Sending tiles or results */
+#define PHASE_CONVOLVE    3     /* Blurring */
+#define PHASE_RECV        4     /* Receiving tiles or results */
+#define PHASE_REMAP       5     /* Copying results into the image */
+#define PHASE_WRITE       6     /* Writing the output image */
+#define PHASE_COUNT       7
+
+/* Error messages */
+#define EM_TIMING_REPORT  "Failed to write timing report: %s\n"
+
+/* Set when a report or timeline was asked for */
+extern int timing_on;
+
+#define TIMING_START(t)   ((t) = timing_on ? timing_now() : 0.0)
+#define TIMING_STOP(phase, t, bytes) \
+  do { if (timing_on) timing_add((phase), (t), (bytes)); } while (0)
+
+double timing_now(void);
+const char *timing_name(int phase);
+void timing_add(int phase, double start, double bytes);
+int timing_report(int me, int nproc, char *fn_report);
+
+#endif /* _TIMING_H_ */
@@ -0,0 +1,653 @@
+#include <errno.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "const.h"
+#include "gaussianLib.h"
+#include "init.h"
+#include "kern.h"
+#include "mosaic.h"
+#include "qdbmp.h"
+#include "timing.h"
+#include "tune.h"
+#ifndef GAUSSIAN_LOCAL
+#include "master.h"
+#include "mpi.h"
+#endif
+
+static const char *decomp_names[] = { "band", "block" };
+
+/* Grid tuned over: square images of each size, at each stdev */
+static const UINT tune_sizes[] = { 256, 512, 1024, 2048 };
+static const int tune_stdevs[] = { 1, 2, 3, 5, 8, 12, 16, 20 };
+#define TUNE_SIZES        (sizeof(tune_sizes) / sizeof(tune_sizes[0]))
+#define TUNE_STDEVS       (sizeof(tune_stdevs) / sizeof(tune_stdevs[0]))
+
+/* Profile loaded for the job */
+static TUNE_ENTRY *entries;
+static int nentry;
+
+/* Rows of a measurement given to one thread */
+struct tune_band {
+  int engine;
+  KERNEL *kern;
+  BMP *src, *dst;
+  int y0, y1;
+  int e;
+};
+
+/* band_main
+ * ------
+ * Measurement thread: blur a band of rows
+ *
+ * arg:     band
+ *
+ */
+static void *band_main(void *arg) {
+
+  struct tune_band *band;
+
+  band = arg;
+  band->e = convolveRows(band->engine, band->kern, EDGE_CLAMP,
+    BMP_GetData(band->src), BMP_GetStride(band->src), BMP_GetData(band->dst),
+    BMP_GetStride(band->dst), BMP_GetWidth(band->src),
+    BMP_GetHeight(band->src), BMP_GetDepth(band->src) >> 3, band->y0,
+    band->y1);
+
+  return NULL;
+
+}
+
+/* blur_rows
+ * ------
+ * Blur the first rows of an image, split into bands across threads
+ *
+ * engine:  convolution engine
+ * kern:    kernel
+ * src:     image to blur
+ * dst:     blurred image (out)
+ * rows:    rows to blur
+ * threads: threads to blur with (including the calling thread)
+ *
+ * returns: success or failure
+ *
+ */
+static int blur_rows(int engine, KERNEL *kern, BMP *src, BMP *dst, int rows,
+  int threads) {
+
+  struct tune_band bands[threads];
+  pthread_t tids[threads];
+  int i, started, e;
+
+  for (i = 0; i < threads; i++) {
+    bands[i].engine = engine;
+    bands[i].kern = kern;
+    bands[i].src = src;
+    bands[i].dst = dst;
+    bands[i].y0 = rows * i / threads;
+    bands[i].y1 = rows * (i + 1) / threads;
+    bands[i].e = EXIT_SUCCESS;
+  }
+
+  for (started = 1; started < threads; started++) {
+    if (pthread_create(&tids[started], NULL, band_main, &bands[started])
+        != 0) {
+      break;
+    }
+  }
+  band_main(&bands[0]);
+  for (i = 1; i < started; i++) pthread_join(tids[i], NULL);
+
+  e = started == threads ? EXIT_SUCCESS : EXIT_FAILURE;
+  for (i = 0; i < threads; i++) {
+    if (bands[i].e != EXIT_SUCCESS) e = EXIT_FAILURE;
+  }
+
+  return e;
+
+}
+
+/* measure
+ * ------
+ * Time an engine on an image.  Engines such as the direct one would take
+ * minutes over a large image, so the rows blurred start at one per thread
+ * and double until the rows the last doubling added take TUNE_MIN_S.  The
+ * rate is taken from those rows alone, leaving out the halo a separable
+ * pass recomputes (which a whole tile hardly pays).  A pass that covers
+ * the image sooner is repeated for TUNE_MIN_S instead.
+ *
+ * engine:  convolution engine
+ * kern:    kernel
+ * src:     image to blur
+ * dst:     blurred image (out)
+ * threads: threads to blur with
+ *
+ * returns: pixels per second, or a negative value on failure
+ *
+ */
+static double measure(int engine, KERNEL *kern, BMP *src, BMP *dst,
+  int threads) {
+
+  int rows, prev_rows, height, passes;
+  double start, elapsed, prev;
+
+  height = BMP_GetHeight(src);
+  rows = threads < height ? threads : height;
+  prev_rows = 0;
+  prev = 0;
+  while (1) {
+    start = timing_now();
+    if (blur_rows(engine, kern, src, dst, rows, threads) != EXIT_SUCCESS) {
+      return -1;
+    }
+    elapsed = timing_now() - start;
+    if (rows == height || (prev_rows > 0 && elapsed - prev >= TUNE_MIN_S)) {
+      break;
+    }
+    prev_rows = rows;
+    prev = elapsed;
+    rows = rows * 2 < height ? rows * 2 : height;
+  }
+
+  if (rows < height) {
+    return (double) (rows - prev_rows) * BMP_GetWidth(src) /
+      (elapsed - prev);
+  }
+
+  for (passes = 1; elapsed < TUNE_MIN_S; passes++) {
+    if (blur_rows(engine, kern, src, dst, rows, threads) != EXIT_SUCCESS) {
+      return -1;
+    }
+    elapsed = timing_now() - start;
+  }
+
+  return (double) passes * rows * BMP_GetWidth(src) / elapsed;
+
+}
+
+#ifndef GAUSSIAN_LOCAL
+/* measure_link
+ * ------
+ * Time round trips of a large message between the master and rank 1.  Must
+ * be called by all ranks.
+ *
+ * me:      current rank
+ *
+ * returns: bytes per second one way (master), or a negative value on
+ *          failure
+ *
+ */
+static double measure_link(int me) {
+
+  UCHAR *buf;
+  double start, elapsed;
+  int i;
+
+  if (me > 1) return 0;
+  if ((buf = calloc(TUNE_LINK_BYTES, 1)) == NULL) {
+    fprintf(stderr, EM_TUNE_OOM);
+    MPI_Abort(MPI_COMM_WORLD, MPI_ABORT_FAIL_CODE);
+    return -1;
+  }
+
+  start = MPI_Wtime();
+  for (i = 0; i < TUNE_LINK_TRIPS; i++) {
+    if (me == MPI_MASTER_NODE) {
+      MPI_Send(buf, TUNE_LINK_BYTES, MPI_UNSIGNED_CHAR, 1, MPI_DATA_TAG,
+        MPI_COMM_WORLD);
+      MPI_Recv(buf, TUNE_LINK_BYTES, MPI_UNSIGNED_CHAR, 1, MPI_DATA_TAG,
+        MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+    } else {
+      MPI_Recv(buf, TUNE_LINK_BYTES, MPI_UNSIGNED_CHAR, MPI_MASTER_NODE,
+        MPI_DATA_TAG, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+      MPI_Send(buf, TUNE_LINK_BYTES, MPI_UNSIGNED_CHAR, MPI_MASTER_NODE,
+        MPI_DATA_TAG, MPI_COMM_WORLD);
+    }
+  }
+  elapsed = MPI_Wtime() - start;
+  free(buf);
+
+  return 2.0 * TUNE_LINK_TRIPS * TUNE_LINK_BYTES / elapsed;
+
+}
+
+/* cost_decomp
+ * ------
+ * Estimate the time a decomposition takes: its largest tile blurred at the
+ * measured rate, plus every tile sent out and back over the link
+ *
+ * src:     image to divide
+ * nslave:  number of slaves
+ * kern:    kernel
+ * decomp:  decomposition (see DECOMP_BAND)
+ * rate:    pixels per second of a slave
+ * link:    bytes per second between master and slave
+ *
+ * returns: seconds, or a negative value if the image cannot be divided so
+ *
+ */
+static double cost_decomp(BMP *src, int nslave, KERNEL *kern, int decomp,
+  double rate, double link) {
+
+  struct mosaic_tile *head, *tile;
+  int ntile, overlap, max_data_size;
+  double max_px, bytes;
+
+  head = create_tiles(src, nslave, kern->size, decomp, 0, 1, NULL, &ntile,
+    &overlap, &max_data_size);
+  if (head == NULL) return -1;
+
+  max_px = 0;
+  bytes = 0;
+  for (tile = head; tile != NULL; tile = tile->next) {
+    if ((double) tile->w * tile->h > max_px) {
+      max_px = (double) tile->w * tile->h;
+    }
+    bytes += tile->size;
+  }
+  free_tiles(head);
+
+  return max_px / rate + 2 * bytes / link;
+
+}
+
+/* await_release
+ * ------
+ * Slave: sleep until the master has finished tuning, rather than spin in
+ * MPI_Finalize on a processor the master may be timing engines on
+ *
+ */
+static void await_release(void) {
+
+  UINT size;
+  int flag;
+
+  do {
+    usleep(SLEEP_U);
+    MPI_Iprobe(MPI_MASTER_NODE, MPI_SIZE_TAG, MPI_COMM_WORLD, &flag,
+      MPI_STATUS_IGNORE);
+  } while (!flag);
+  MPI_Recv(&size, 1, MPI_UNSIGNED_LONG, MPI_MASTER_NODE, MPI_SIZE_TAG,
+    MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+
+}
+#endif
+
+/* tune_point
+ * ------
+ * Find the best engine, thread count and decomposition for one image size
+ * and standard deviation, logging every measurement to the profile
+ *
+ * src:     synthetic image of the size
+ * dst:     scratch image of the same shape
+ * stdev:   standard deviation
+ * nslave:  slaves to choose a decomposition for (0 or 1 for none)
+ * link:    bytes per second between master and slave
+ * f:       profile
+ * best:    best choices (out)
+ *
+ * returns: success or failure
+ *
+ */
+static int tune_point(BMP *src, BMP *dst, int stdev, int nslave, double link,
+  FILE *f, TUNE_ENTRY *best) {
+
+  KERNEL *kern;
+  double pixels, rate, best_rate;
+  int engine, threads, max_threads;
+
+  if ((kern = create_kernel(stdev)) == NULL) return EXIT_FAILURE;
+  pixels = (double) BMP_GetWidth(src) * BMP_GetHeight(src);
+
+  best->pixels = pixels;
+  best->stdev = stdev;
+  best->rate = 0;
+  for (engine = 0; engine < ENGINE_COUNT; engine++) {
+    rate = measure(engine, kern, src, dst, 1);
+    if (rate < 0) {
+      free_kernel(kern);
+      return EXIT_FAILURE;
+    }
+    fprintf(f, "# engine %.0f %d %s %.3f\n", pixels, stdev,
+      engineName(engine), rate / 1e6);
+    if (rate > best->rate) {
+      best->engine = engine;
+      best->rate = rate;
+    }
+  }
+
+  best->threads = 1;
+  best_rate = best->rate;
+  max_threads = sysconf(_SC_NPROCESSORS_ONLN);
+  for (threads = 2; threads <= max_threads; threads *= 2) {
+    rate = measure(best->engine, kern, src, dst, threads);
+    fprintf(f, "# threads %.0f %d %d %.3f\n", pixels, stdev, threads,
+      rate / 1e6);
+    if (rate > best_rate) {
+      best->threads = threads;
+      best_rate = rate;
+    }
+  }
+
+  best->slaves = 0;
+  best->decomp = DECOMP_BAND;
+#ifndef GAUSSIAN_LOCAL
+  if (nslave > 1) {
+    double cost, best_cost;
+    int d;
+
+    best->slaves = nslave;
+    best_cost = -1;
+    for (d = DECOMP_BAND; d <= DECOMP_BLOCK; d++) {
+      cost = cost_decomp(src, nslave, kern, d, best->rate, link);
+      if (cost < 0) continue;
+      fprintf(f, "# decomp %.0f %d %d %s %.6f\n", pixels, stdev, nslave,
+        decomp_names[d], cost);
+      if (best_cost < 0 || cost < best_cost) {
+        best->decomp = d;
+        best_cost = cost;
+      }
+    }
+  }
+#endif
+
+  free_kernel(kern);
+
+  return EXIT_SUCCESS;
+
+}
+
+/* do_tune
+ * ------
+ * Benchmark this machine over the tuning grid and write the profile.  Must
+ * be called by all ranks; the slaves only take part in timing the link.
+ *
+ * me:      current rank
+ * nproc:   number of processes, including master
+ * opts:    job configuration (fn_tune names the profile)
+ *
+ * returns: success or failure
+ *
+ */
+int do_tune(int me, int nproc, JOB_OPTS *opts) {
+
+  FILE *f;
+  BMP *src, *dst;
+  TUNE_ENTRY best;
+  double link;
+  size_t s, i;
+  int e;
+
+  link = 0;
+#ifndef GAUSSIAN_LOCAL
+  if (nproc > 2) link = measure_link(me);
+  if (me != MPI_MASTER_NODE) {
+    await_release();
+    return EXIT_SUCCESS;
+  }
+#endif
+
+  if ((f = fopen(opts->fn_tune, "w")) == NULL) {
+    fprintf(stderr, EM_TUNE_PROFILE, strerror(errno));
+#ifndef GAUSSIAN_LOCAL
+    release_slaves(1, nproc - 1);
+#endif
+    return EXIT_FAILURE;
+  }
+  fprintf(f, "%s\n", TUNE_HEADER);
+  if (link > 0) fprintf(f, "# link %.3f MB/s\n", link / 1e6);
+
+  e = EXIT_SUCCESS;
+  for (s = 0; e == EXIT_SUCCESS && s < TUNE_SIZES; s++) {
+    if ((src = syntheticBMP(tune_sizes[s], tune_sizes[s], TUNE_DEPTH))
+        == NULL) {
+      e = EXIT_FAILURE;
+      break;
+    }
+    dst = BMP_Create(tune_sizes[s], tune_sizes[s], TUNE_DEPTH);
+    if (BMP_CheckError(stderr) != BMP_OK) {
+      BMP_Free(src);
+      e = EXIT_FAILURE;
+      break;
+    }
+
+    for (i = 0; e == EXIT_SUCCESS && i < TUNE_STDEVS; i++) {
+      e = tune_point(src, dst, tune_stdevs[i], nproc - 1, link, f, &best);
+      if (e != EXIT_SUCCESS) break;
+      fprintf(f, "%.0f %d %s %.3f %d %d %s\n", best.pixels, best.stdev,
+        engineName(best.engine), best.rate / 1e6, best.threads,
+        best.slaves, decomp_names[best.decomp]);
+      fflush(f);
+#ifdef TRACE
+      fprintf(stderr, "tuned %lux%lu at stdev %d: %s, %d threads, %s\n",
+        tune_sizes[s], tune_sizes[s], best.stdev, engineName(best.engine),
+        best.threads, decomp_names[best.decomp]);
+#endif
+    }
+
+    BMP_Free(src);
+    BMP_Free(dst);
+  }
+
+  if (fclose(f) != 0) {
+    fprintf(stderr, EM_TUNE_PROFILE, strerror(errno));
+    e = EXIT_FAILURE;
+  }
+#ifndef GAUSSIAN_LOCAL
+  release_slaves(1, nproc - 1);
+#endif
+
+  return e;
+
+}
+
+/* read_profile
+ * ------
+ * Read the entries of a tuning profile, skipping comments and lines that
+ * name an unknown engine or decomposition
+ *
+ * fn_tuned:  profile file name
+ *
+ * returns: success or failure
+ *
+ */
+static int read_profile(char *fn_tuned) {
+
+  FILE *f;
+  TUNE_ENTRY entry, *grown;
+  char line[TUNE_LINE_LEN], engine[TUNE_LINE_LEN], decomp[TUNE_LINE_LEN];
+  int max_entry;
+
+  if ((f = fopen(fn_tuned, "r")) == NULL) {
+    fprintf(stderr, EM_TUNE_LOAD, strerror(errno));
+    return EXIT_FAILURE;
+  }
+
+  max_entry = 0;
+  while (fgets(line, sizeof(line), f) != NULL) {
+    if (line[0] == '#') continue;
+    if (sscanf(line, "%lf %d %255s %lf %d %d %255s", &entry.pixels,
+          &entry.stdev, engine, &entry.rate, &entry.threads, &entry.slaves,
+          decomp) != 7 || entry.threads < 1) {
+      continue;
+    }
+    if ((entry.engine = engineByName(engine)) < 0) continue;
+    if (strcmp(decomp, decomp_names[DECOMP_BAND]) == 0) {
+      entry.decomp = DECOMP_BAND;
+    } else if (strcmp(decomp, decomp_names[DECOMP_BLOCK]) == 0) {
+      entry.decomp = DECOMP_BLOCK;
+    } else {
+      continue;
+    }
+    entry.rate *= 1e6;
+
+    if (nentry == max_entry) {
+      max_entry = max_entry ? 2 * max_entry : TUNE_SIZES * TUNE_STDEVS;
+      grown = realloc(entries, max_entry * sizeof(*entries));
+      if (grown == NULL) {
+        fprintf(stderr, EM_TUNE_OOM);
+        fclose(f);
+        return EXIT_FAILURE;
+      }
+      entries = grown;
+    }
+    entries[nentry++] = entry;
+  }
+  fclose(f);
+
+  if (nentry == 0) {
+    fprintf(stderr, EM_TUNE_EMPTY, fn_tuned);
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+
+}
+
+/* tune_load
+ * ------
+ * Load a tuning profile for the job.  In gaussianmpi this must be called
+ * by all ranks: the master reads the profile and passes it on, so it need
+ * only exist on the master's host.
+ *
+ * me:        current rank
+ * fn_tuned:  profile file name
+ *
+ * returns: success or failure
+ *
+ */
+int tune_load(int me, char *fn_tuned) {
+
+  int e;
+
+  e = EXIT_SUCCESS;
+  if (me == 0) e = read_profile(fn_tuned);
+#ifndef GAUSSIAN_LOCAL
+  MPI_Bcast(&e, 1, MPI_INT, MPI_MASTER_NODE, MPI_COMM_WORLD);
+  if (e != EXIT_SUCCESS) return e;
+  MPI_Bcast(&nentry, 1, MPI_INT, MPI_MASTER_NODE, MPI_COMM_WORLD);
+  if (me != MPI_MASTER_NODE) {
+    if ((entries = malloc(nentry * sizeof(*entries))) == NULL) {
+      fprintf(stderr, EM_TUNE_OOM);
+      MPI_Abort(MPI_COMM_WORLD, MPI_ABORT_FAIL_CODE);
+      return EXIT_FAILURE;
+    }
+  }
+  MPI_Bcast(entries, nentry * sizeof(*entries), MPI_BYTE, MPI_MASTER_NODE,
+    MPI_COMM_WORLD);
+#endif
+
+  return e;
+
+}
+
+/* tune_pick
+ * ------
+ * Entry of the loaded profile nearest an image: of those at the nearest
+ * standard deviation, the one nearest in size on a log scale
+ *
+ * pixels:  pixels of the image (or tile)
+ * stdev:   standard deviation
+ *
+ * returns: entry, or NULL if no profile was loaded
+ *
+ */
+const TUNE_ENTRY *tune_pick(UINT pixels, int stdev) {
+
+  const TUNE_ENTRY *best;
+  double d, best_d;
+  int i, ds, best_ds;
+
+  best = NULL;
+  best_d = 0;
+  best_ds = 0;
+  for (i = 0; i < nentry; i++) {
+    ds = abs(entries[i].stdev - stdev);
+    d = fabs(log((pixels + 1.0) / entries[i].pixels));
+    if (best == NULL || ds < best_ds || (ds == best_ds && d < best_d)) {
+      best = &entries[i];
+      best_ds = ds;
+      best_d = d;
+    }
+  }
+
+  return best;
+
+}
+
+/* tune_engine
+ * ------
+ * Engine to blur an image with: the one given on the command line, or
+ * else the one the profile picks
+ *
+ * opts:    job configuration
+ * pixels:  pixels of the image (or tile)
+ * stdev:   standard deviation
+ *
+ * returns: engine (see ENGINE_DIRECT)
+ *
+ */
+int tune_engine(JOB_OPTS *opts, UINT pixels, int stdev) {
+
+  const TUNE_ENTRY *entry;
+
+  if (opts->chosen & CHOSE_ENGINE) return opts->engine;
+  if ((entry = tune_pick(pixels, stdev)) == NULL) return opts->engine;
+
+  return entry->engine;
+
+}
+
+/* tune_decomp
+ * ------
+ * Decomposition to divide an image with: the one given on the command
+ * line, or else the one the profile picks if it was tuned for as many
+ * slaves
+ *
+ * opts:    job configuration
+ * pixels:  pixels of the image
+ * stdev:   standard deviation
+ * nslave:  number of slaves
+ *
+ * returns: decomposition (see DECOMP_BAND)
+ *
+ */
+int tune_decomp(JOB_OPTS *opts, UINT pixels, int stdev, int nslave) {
+
+  const TUNE_ENTRY *entry;
+
+  if (opts->chosen & CHOSE_DECOMP) return opts->decomp;
+  entry = tune_pick(pixels, stdev);
+  if (entry == NULL || entry->slaves != nslave) return opts->decomp;
+
+  return entry->decomp;
+
+}
+
+/* tune_threads
+ * ------
+ * Threads to blur an image with in a single process: the default, or
+ * fewer if the profile found more threads no faster
+ *
+ * opts:    job configuration
+ * pixels:  pixels of the image
+ * stdev:   standard deviation
+ * threads: default thread count
+ *
+ * returns: thread count
+ *
+ */
+int tune_threads(JOB_OPTS *opts, UINT pixels, int stdev, int threads) {
+
+  const TUNE_ENTRY *entry;
+
+  if (opts->chosen & CHOSE_THREADS) return threads;
+  entry = tune_pick(pixels, stdev);
+  if (entry == NULL || entry->threads >= threads) return threads;
+
+  return entry->threads;
+
+}
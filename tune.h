@@ -0,0 +1,64 @@
+#ifndef _TUNE_H_
+#define _TUNE_H_
+
+/*
+ * tune.h
+ * ------
+ * Chooses the convolution engine, thread count and decomposition for each
+ * job from a tuning profile of the machine, rather than by hand.
+ *
+ * Tuning (--tune) times every engine, one thread at a time, on synthetic
+ * images over a grid of sizes and standard deviations; then the fastest
+ * engine on 1, 2, 4... threads up to the processors online; then, given
+ * two or more slaves, the band and block decompositions, each costed as
+ * the largest tile at the measured rate plus every tile sent and returned
+ * at the bandwidth measured between the master and rank 1.  The best of
+ * each is written as a line of the profile, with every measurement kept
+ * as a comment.
+ *
+ * At run time (--tuned) the entry nearest the image (by standard deviation,
+ * then size on a log scale) picks whatever was not given on the command
+ * line: the engine each slave blurs its tile with (by the size of the
+ * tile), the decomposition (only if tuned for as many slaves as the job
+ * has) and, for a single process, a thread count no higher than the
+ * default.
+ *
+ */
+
+#include "init.h"
+#include "qdbmp.h"
+
+/* Constants */
+#define TUNE_MIN_S        0.05      /* Minimum time for each measurement */
+#define TUNE_DEPTH        24        /* Depth of the synthetic images */
+#define TUNE_LINK_BYTES   (4 << 20) /* Message timed between ranks */
+#define TUNE_LINK_TRIPS   4         /* Round trips timed */
+#define TUNE_LINE_LEN     256
+#define TUNE_HEADER       "# gaussianmpi tuning profile: <pixels> <stdev> " \
+  "<engine> <Mpx/s per thread> <threads> <slaves> <decomp>"
+
+/* Error messages */
+#define EM_TUNE_OOM       "Out of memory while tuning\n"
+#define EM_TUNE_PROFILE   "Failed to write tuning profile: %s\n"
+#define EM_TUNE_LOAD      "Failed to read tuning profile: %s\n"
+#define EM_TUNE_EMPTY     "Tuning profile %s has no entries\n"
+
+/* Best choices measured for one image size and standard deviation */
+typedef struct tune_entry {
+  double pixels;
+  int stdev;
+  int engine;                 /* Fastest engine (see ENGINE_DIRECT) */
+  double rate;                /* Pixels per second on one thread with it */
+  int threads;                /* Fastest thread count with it */
+  int slaves;                 /* Slaves the decomposition suits (0: none) */
+  int decomp;                 /* Fastest decomposition (see DECOMP_BAND) */
+} TUNE_ENTRY;
+
+int do_tune(int me, int nproc, JOB_OPTS *opts);
+int tune_load(int me, char *fn_tuned);
+const TUNE_ENTRY *tune_pick(UINT pixels, int stdev);
+int tune_engine(JOB_OPTS *opts, UINT pixels, int stdev);
+int tune_decomp(JOB_OPTS *opts, UINT pixels, int stdev, int nslave);
+int tune_threads(JOB_OPTS *opts, UINT pixels, int stdev, int threads);
+
+#endif /* _TUNE_H_ */